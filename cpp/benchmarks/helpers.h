@@ -0,0 +1,42 @@
+/// @file
+///
+/// Helpers used in Horus SDK benchmarks.
+
+#ifndef HORUS_SDK_CPP_BENCHMARKS_HELPERS_H_
+#define HORUS_SDK_CPP_BENCHMARKS_HELPERS_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "horus/strings/stdio.h"
+#include "horus/strings/string_view.h"
+#include "horus/strings/stringify.h"
+
+namespace horus {
+
+/// Calls `run()` `iterations` times after a warm-up call, then prints the average duration of a
+/// call prefixed by `name`.
+///
+/// `run()` must return a `std::size_t` (e.g. the number of processed bytes) which depends on the
+/// work it performed, so that this work cannot be optimized away.
+template <class F>
+void RunBenchmark(StringView name, std::size_t iterations, F&& run) {
+  volatile std::size_t result{run()};
+
+  const std::chrono::steady_clock::time_point start{std::chrono::steady_clock::now()};
+  for (std::size_t i{0}; i < iterations; ++i) {
+    result = run();
+  }
+  const std::chrono::steady_clock::duration elapsed{std::chrono::steady_clock::now() - start};
+  static_cast<void>(result);
+
+  const auto elapsed_ns = static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+  StringifyTo(StdoutSink(), name, ": ", elapsed_ns / iterations, " ns/iteration (", iterations,
+              " iterations)\n");
+}
+
+}  // namespace horus
+
+#endif  // HORUS_SDK_CPP_BENCHMARKS_HELPERS_H_
@@ -0,0 +1,79 @@
+/// @file
+///
+/// Measures deserializing `DetectionEvent`s, whose many small submessages exercise the
+/// table-driven parser shared by all generated messages, with and without validating them first.
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "benchmarks/helpers.h"
+#include "horus/pb/buffer.h"
+#include "horus/pb/config/metadata_pb.h"
+#include "horus/pb/cow.h"
+#include "horus/pb/cow_repeated.h"
+#include "horus/pb/detection_service/detection_pb.h"
+#include "horus/pb/serialize.h"
+
+namespace horus {
+namespace {
+
+/// Returns a `DetectionEvent` with `object_count` tracked objects.
+pb::DetectionEvent MakeDetectionEvent(std::size_t object_count) {
+  pb::DetectionEvent event;
+  CowRepeated<pb::DetectedObject>& objects{event.mutable_objects()};
+  for (std::size_t i{0}; i < object_count; ++i) {
+    const float position{static_cast<float>(i)};
+    pb::DetectedObject& object{objects.Add()};
+    object.mutable_classification()
+        .set_class_label(pb::ObjectLabel::kPedestrian)
+        .set_class_confidence(0.9F);
+    object.mutable_kinematics()
+        .set_linear_velocity(pb::Vector2f{}.set_x(1.F).set_y(-1.F))
+        .set_yaw_rate(0.1F);
+    object.mutable_shape().set_bounding_box(
+        pb::BoundingBox{}
+            .set_base(pb::Vector3f{}.set_x(position).set_y(position).set_z(0.F))
+            .set_size(pb::Vector3f{}.set_x(0.5F).set_y(0.5F).set_z(1.8F))
+            .set_yaw(0.F));
+    object.mutable_status()
+        .set_id(static_cast<std::uint32_t>(i))
+        .set_tracking_status(pb::TrackingStatus::kTracking);
+  }
+  return event;
+}
+
+/// Deserializes a `DetectionEvent` from `bytes` and decodes all its objects, validating the event
+/// first if `validate`.
+std::size_t ParseDetectionEvent(const std::vector<std::uint8_t>& bytes, bool validate) {
+  PbView view{PbBuffer{std::vector<std::uint8_t>{bytes}}};
+  if (validate && !view.Validate<pb::DetectionEvent>()) {
+    return 0;
+  }
+  PbReader reader{std::move(view)};
+  const pb::DetectionEvent event{reader};
+  std::size_t id_sum{0};
+  for (const Cow<pb::DetectedObject>& object : event.objects()) {
+    id_sum += object.Ref().status().id();
+  }
+  return id_sum;
+}
+
+void BenchmarkDetectionEvent(std::size_t object_count, std::size_t iterations) {
+  const std::vector<std::uint8_t> bytes{MakeDetectionEvent(object_count).SerializeToBuffer()};
+  StringifyTo(StdoutSink(), "DetectionEvent with ", object_count, " objects (", bytes.size(),
+              " bytes):\n");
+  RunBenchmark("  parse", iterations,
+               [&bytes] { return ParseDetectionEvent(bytes, /*validate=*/false); });
+  RunBenchmark("  validate and parse", iterations,
+               [&bytes] { return ParseDetectionEvent(bytes, /*validate=*/true); });
+}
+
+}  // namespace
+}  // namespace horus
+
+int main() {
+  horus::BenchmarkDetectionEvent(/*object_count=*/10, /*iterations=*/100000);
+  horus::BenchmarkDetectionEvent(/*object_count=*/500, /*iterations=*/2000);
+}
@@ -0,0 +1,468 @@
+/// @file
+///
+/// Measures converting the interleaved points of received `PointFrame`s to the aligned
+/// structure-of-arrays layout of `sdk::PointCloudView`, transforming them to world coordinates, and
+/// filtering them by attribute, with each supported instruction set; downsampling them with
+/// `sdk::VoxelGrid`; merging the frames of several lidars with `sdk::MergedPointCloud`;
+/// organizing them by ring with `sdk::RingPointCloud`; and querying them with `sdk::SpatialIndex`.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "benchmarks/helpers.h"
+#include "horus/pb/buffer.h"
+#include "horus/pb/point/point_message_pb.h"
+#include "horus/pb/serialize.h"
+#include "horus/pb/unaligned_span.h"
+#include "horus/sdk/merged_point_cloud.h"
+#include "horus/sdk/point_attribute_filter.h"
+#include "horus/sdk/point_cloud_view.h"
+#include "horus/sdk/point_filter.h"
+#include "horus/sdk/point_transform.h"
+#include "horus/sdk/ring_point_cloud.h"
+#include "horus/sdk/simd.h"
+#include "horus/sdk/spatial_index.h"
+#include "horus/sdk/voxel_grid.h"
+#include "horus/types/span.h"
+#include "horus/strings/string_view.h"
+
+namespace horus {
+namespace {
+
+/// Returns a received `PointFrame` with `point_count` points, whose fields refer to the (generally
+/// unaligned) received bytes.
+pb::PointFrame MakeReceivedPointFrame(std::size_t point_count) {
+  pb::PointFrame frame;
+  pb::AttributedPoints& points{frame.mutable_points()};
+  std::vector<float>& xyz{points.mutable_flattened_points().Vector()};
+  for (std::size_t i{0}; i < point_count; ++i) {
+    xyz.push_back(static_cast<float>(i % 100));
+    xyz.push_back(static_cast<float>(i % 37));
+    xyz.push_back(1.F);
+  }
+  std::vector<std::uint32_t>& attributes{points.mutable_attributes().Vector()};
+  attributes.resize((point_count + 1) / 2, 0x00020000);
+  std::vector<std::uint32_t>& intensities{points.mutable_intensities().Vector()};
+  intensities.resize((point_count + 1) / 2, 0x00400040);
+  std::vector<std::uint8_t>& ring_indices{points.mutable_ring_indices().String()};
+  for (std::size_t i{0}; i < point_count; ++i) {
+    ring_indices.push_back(static_cast<std::uint8_t>(i % 128));
+    ring_indices.push_back(0);
+  }
+
+  PbReader reader{PbBuffer{frame.SerializeToBuffer()}};
+  return pb::PointFrame{reader};
+}
+
+/// Returns the instruction sets supported by this CPU.
+std::vector<sdk::SimdLevel> SupportedSimdLevels() {
+  std::vector<sdk::SimdLevel> levels;
+  for (const sdk::SimdLevel level :
+       {sdk::SimdLevel::kScalar, sdk::SimdLevel::kSse41, sdk::SimdLevel::kAvx2}) {
+    if (sdk::IsSimdLevelSupported(level)) {
+      levels.push_back(level);
+    }
+  }
+  return levels;
+}
+
+/// Returns the name of `level`.
+StringView SimdLevelName(sdk::SimdLevel level) {
+  switch (level) {
+    case sdk::SimdLevel::kScalar:
+      return "scalar";
+    case sdk::SimdLevel::kSse41:
+      return "sse4.1";
+    case sdk::SimdLevel::kAvx2:
+      return "avx2";
+  }
+  return "unknown";
+}
+
+void BenchmarkPointCloudView(std::size_t point_count, std::size_t iterations) {
+  const pb::PointFrame frame{MakeReceivedPointFrame(point_count)};
+  StringifyTo(StdoutSink(), "PointFrame with ", point_count, " points:\n");
+
+  RunBenchmark("  sum x (UnalignedSpan)", iterations, [&frame] {
+    const UnalignedSpan<float> xyz{frame.points().flattened_points().Span()};
+    float sum{0};
+    for (std::size_t i{0}; i < xyz.size(); i += 3) {
+      sum += xyz[i];
+    }
+    return static_cast<std::size_t>(sum);
+  });
+
+  sdk::PointCloudView view;
+  for (const sdk::SimdLevel level : SupportedSimdLevels()) {
+    StringifyTo(StdoutSink(), "  ", SimdLevelName(level), ":\n");
+    RunBenchmark("    view", iterations, [&frame, &view, level] {
+      view.Assign(frame, level);
+      return view.size();
+    });
+    RunBenchmark("    view and sum x", iterations, [&frame, &view, level] {
+      view.Assign(frame, level);
+      float sum{0};
+      for (const float x : view.x()) {
+        sum += x;
+      }
+      return static_cast<std::size_t>(sum);
+    });
+  }
+}
+
+void BenchmarkPointTransform(std::size_t point_count, std::size_t iterations) {
+  const pb::PointFrame frame{MakeReceivedPointFrame(point_count)};
+  const sdk::PointTransform transform{
+      std::array<float, 12>{{0.F, -1.F, 0.F, 1.F, 1.F, 0.F, 0.F, 2.F, 0.F, 0.F, 1.F, 3.F}}};
+  // Half of the points are ground points.
+  const sdk::PointAttributeFilter no_ground{
+      sdk::PointAttributeFilter{}.Exclude(pb::PointAttribute::kGround)};
+  std::vector<float> x(point_count);
+  std::vector<float> y(point_count);
+  std::vector<float> z(point_count);
+  StringifyTo(StdoutSink(), "Transform PointFrame with ", point_count, " points:\n");
+
+  RunBenchmark("  UnalignedSpan loop", iterations, [&] {
+    const UnalignedSpan<float> xyz{frame.points().flattened_points().Span()};
+    const std::array<float, 12>& m{transform.Matrix()};
+    for (std::size_t i{0}; i < point_count; ++i) {
+      const float px{xyz[3 * i]};
+      const float py{xyz[3 * i + 1]};
+      const float pz{xyz[3 * i + 2]};
+      x[i] = m[0] * px + m[1] * py + m[2] * pz + m[3];
+      y[i] = m[4] * px + m[5] * py + m[6] * pz + m[7];
+      z[i] = m[8] * px + m[9] * py + m[10] * pz + m[11];
+    }
+    return static_cast<std::size_t>(x[point_count / 2]);
+  });
+
+  sdk::PointCloudView view{frame};
+  for (const sdk::SimdLevel level : SupportedSimdLevels()) {
+    StringifyTo(StdoutSink(), "  ", SimdLevelName(level), ":\n");
+    RunBenchmark("    transform", iterations, [&] {
+      sdk::TransformPoints(transform, view, x, y, z, level);
+      return static_cast<std::size_t>(x[point_count / 2]);
+    });
+    RunBenchmark("    transform and filter", iterations, [&] {
+      return sdk::TransformPoints(transform, view, no_ground, x, y, z, level);
+    });
+    RunBenchmark("    view and transform in place", iterations, [&] {
+      view.Assign(frame, level);
+      sdk::TransformPointsInPlace(transform, view, level);
+      return static_cast<std::size_t>(view.x()[point_count / 2]);
+    });
+  }
+}
+
+void BenchmarkPointFilter(std::size_t point_count, std::size_t iterations) {
+  const pb::PointFrame frame{MakeReceivedPointFrame(point_count)};
+  // Half of the points are ground points.
+  const sdk::PointAttributeFilter no_ground{
+      sdk::PointAttributeFilter{}.Exclude(pb::PointAttribute::kGround)};
+  StringifyTo(StdoutSink(), "Filter PointFrame with ", point_count, " points:\n");
+
+  std::vector<float> xyz;
+  std::vector<std::uint16_t> intensities;
+  std::vector<std::uint16_t> ring_indices;
+  xyz.reserve(point_count * 3);
+  intensities.reserve(point_count);
+  ring_indices.reserve(point_count);
+  RunBenchmark("  UnalignedSpan loop", iterations, [&] {
+    const pb::AttributedPoints& points{frame.points()};
+    const UnalignedSpan<float> in_xyz{points.flattened_points().Span()};
+    const UnalignedSpan<std::uint32_t> in_attributes{points.attributes().Span()};
+    const UnalignedSpan<std::uint32_t> in_intensities{points.intensities().Span()};
+    const StringView in_ring_indices{points.ring_indices().Str()};
+    xyz.clear();
+    intensities.clear();
+    ring_indices.clear();
+    for (std::size_t i{0}; i < point_count; ++i) {
+      const auto attributes =
+          static_cast<std::uint16_t>(in_attributes[i / 2] >> (i % 2 == 0 ? 0 : 16));
+      if (!no_ground.Keeps(attributes)) {
+        continue;
+      }
+      xyz.push_back(in_xyz[3 * i]);
+      xyz.push_back(in_xyz[3 * i + 1]);
+      xyz.push_back(in_xyz[3 * i + 2]);
+      intensities.push_back(
+          static_cast<std::uint16_t>(in_intensities[i / 2] >> (i % 2 == 0 ? 0 : 16)));
+      ring_indices.push_back(static_cast<std::uint16_t>(
+          static_cast<std::uint8_t>(in_ring_indices[2 * i]) |
+          static_cast<std::uint8_t>(in_ring_indices[2 * i + 1]) << 8));
+    }
+    return intensities.size();
+  });
+  RunBenchmark("  UnalignedSpan count", iterations, [&] {
+    const UnalignedSpan<std::uint32_t> in_attributes{frame.points().attributes().Span()};
+    std::size_t count{0};
+    for (std::size_t i{0}; i < point_count; ++i) {
+      const auto attributes =
+          static_cast<std::uint16_t>(in_attributes[i / 2] >> (i % 2 == 0 ? 0 : 16));
+      count += no_ground.Keeps(attributes) ? 1 : 0;
+    }
+    return count;
+  });
+
+  sdk::PointCloudView view{frame};
+  sdk::FilteredPointCloud cloud;
+  for (const sdk::SimdLevel level : SupportedSimdLevels()) {
+    StringifyTo(StdoutSink(), "  ", SimdLevelName(level), ":\n");
+    RunBenchmark("    filter", iterations, [&] {
+      cloud.Assign(view, no_ground, level);
+      return cloud.size();
+    });
+    RunBenchmark("    count", iterations,
+                 [&] { return sdk::CountPoints(view, no_ground, level); });
+  }
+}
+
+void BenchmarkVoxelGrid(std::size_t point_count, std::size_t iterations) {
+  const pb::PointFrame frame{MakeReceivedPointFrame(point_count)};
+  const sdk::VoxelGridOptions centroid{/*leaf_size=*/0.2F, sdk::VoxelPoint::kCentroid};
+  const sdk::VoxelGridOptions first{/*leaf_size=*/0.2F, sdk::VoxelPoint::kFirst};
+  StringifyTo(StdoutSink(), "Downsample PointFrame with ", point_count, " points:\n");
+
+  std::unordered_map<std::uint64_t, std::size_t> voxels;
+  RunBenchmark("  std::unordered_map first point", iterations, [&] {
+    const UnalignedSpan<float> xyz{frame.points().flattened_points().Span()};
+    voxels.clear();
+    for (std::size_t i{0}; i < point_count; ++i) {
+      const auto vx = static_cast<std::int64_t>(std::floor(xyz[3 * i] / first.leaf_size));
+      const auto vy = static_cast<std::int64_t>(std::floor(xyz[3 * i + 1] / first.leaf_size));
+      const auto vz = static_cast<std::int64_t>(std::floor(xyz[3 * i + 2] / first.leaf_size));
+      const auto key = static_cast<std::uint64_t>((vx & 0x1FFFFF) << 42 | (vy & 0x1FFFFF) << 21 |
+                                                  (vz & 0x1FFFFF));
+      voxels.emplace(key, i);
+    }
+    return voxels.size();
+  });
+
+  sdk::VoxelGrid grid;
+  RunBenchmark("  VoxelGrid first point", iterations, [&] {
+    grid.Assign(frame, first);
+    return grid.size();
+  });
+  RunBenchmark("  VoxelGrid centroid", iterations, [&] {
+    grid.Assign(frame, centroid);
+    return grid.size();
+  });
+
+  // A batch of 16 lidars.
+  const std::vector<const pb::PointFrame*> frames(16, &frame);
+  sdk::VoxelGridBatch batch;
+  std::vector<std::size_t> thread_counts{1};
+  if (std::thread::hardware_concurrency() > 1) {
+    thread_counts.push_back(std::thread::hardware_concurrency());
+  }
+  for (const std::size_t thread_count : thread_counts) {
+    StringifyTo(StdoutSink(), "  16 frames, ", thread_count, " threads:\n");
+    RunBenchmark("    VoxelGrid centroid", iterations / 16 + 1, [&] {
+      batch.Assign(frames, centroid, thread_count);
+      return batch.grids().back().size();
+    });
+  }
+}
+
+void BenchmarkMergedPointCloud(std::size_t frame_count, std::size_t point_count,
+                               std::size_t iterations) {
+  const pb::PointFrame frame{MakeReceivedPointFrame(point_count)};
+  const std::vector<const pb::PointFrame*> frames(frame_count, &frame);
+  StringifyTo(StdoutSink(), "Merge ", frame_count, " PointFrames with ", point_count,
+              " points:\n");
+
+  // Merging frames as delivered one at a time by `on_point_cloud`.
+  sdk::PointCloudView view;
+  std::vector<float> x;
+  std::vector<float> y;
+  std::vector<float> z;
+  RunBenchmark("  view, transform in place and append", iterations, [&] {
+    x.clear();
+    y.clear();
+    z.clear();
+    for (const pb::PointFrame* const lidar_frame : frames) {
+      view.Assign(*lidar_frame);
+      sdk::TransformPointsInPlace(sdk::PointTransform::FromFrame(*lidar_frame), view);
+      x.insert(x.end(), view.x().begin(), view.x().end());
+      y.insert(y.end(), view.y().begin(), view.y().end());
+      z.insert(z.end(), view.z().begin(), view.z().end());
+    }
+    return x.size();
+  });
+
+  sdk::MergedPointCloud cloud;
+  std::vector<std::size_t> thread_counts{1};
+  if (std::thread::hardware_concurrency() > 1) {
+    thread_counts.push_back(std::thread::hardware_concurrency());
+  }
+  for (const std::size_t thread_count : thread_counts) {
+    StringifyTo(StdoutSink(), "  ", thread_count, " threads:\n");
+    RunBenchmark("    MergedPointCloud", iterations, [&] {
+      cloud.Assign(frames, thread_count);
+      return cloud.size();
+    });
+  }
+}
+
+void BenchmarkRingPointCloud(std::size_t point_count, std::size_t iterations) {
+  const pb::PointFrame frame{MakeReceivedPointFrame(point_count)};
+  const sdk::PointCloudView view{frame};
+  StringifyTo(StdoutSink(), "Organize PointFrame with ", point_count, " points by ring:\n");
+
+  std::vector<std::vector<std::uint32_t>> rings;
+  std::vector<float> ranges(point_count);
+  std::vector<float> azimuths(point_count);
+  RunBenchmark("  index vectors, std::sqrt and std::atan2", iterations, [&] {
+    for (std::vector<std::uint32_t>& ring : rings) {
+      ring.clear();
+    }
+    const Span<const std::uint16_t> ring_indices{view.ring_indices()};
+    for (std::size_t i{0}; i < point_count; ++i) {
+      if (ring_indices[i] >= rings.size()) {
+        rings.resize(ring_indices[i] + std::size_t{1});
+      }
+      rings[ring_indices[i]].push_back(static_cast<std::uint32_t>(i));
+    }
+    for (std::size_t i{0}; i < point_count; ++i) {
+      const float x{view.x()[i]};
+      const float y{view.y()[i]};
+      const float z{view.z()[i]};
+      ranges[i] = std::sqrt(x * x + y * y + z * z);
+      azimuths[i] = std::atan2(y, x);
+    }
+    return rings.size();
+  });
+
+  sdk::RingPointCloud cloud;
+  for (const sdk::SimdLevel level : SupportedSimdLevels()) {
+    StringifyTo(StdoutSink(), "  ", SimdLevelName(level), ":\n");
+    RunBenchmark("    RingPointCloud", iterations, [&] {
+      cloud.Assign(view, /*azimuth_bins=*/0, level);
+      return cloud.ring_count();
+    });
+    RunBenchmark("    RingPointCloud with range image", iterations, [&] {
+      cloud.Assign(view, /*azimuth_bins=*/1800, level);
+      return cloud.ring_count();
+    });
+  }
+}
+
+void BenchmarkSpatialIndex(std::size_t point_count, std::size_t iterations) {
+  // Points spread over a 200 x 200 meters area, as in a lidar frame.
+  pb::PointFrame frame;
+  std::vector<float>& xyz{frame.mutable_points().mutable_flattened_points().Vector()};
+  std::uint32_t state{1};
+  const auto next = [&state](float scale) {
+    state = state * 1664525U + 1013904223U;
+    return static_cast<float>(state >> 8) / static_cast<float>(1U << 24) * scale;
+  };
+  for (std::size_t i{0}; i < point_count; ++i) {
+    xyz.push_back(next(200.F) - 100.F);
+    xyz.push_back(next(200.F) - 100.F);
+    xyz.push_back(next(4.F) - 2.F);
+  }
+  const sdk::PointCloudView view{frame};
+  std::vector<std::array<float, 3>> queries(1000);
+  for (std::array<float, 3>& query : queries) {
+    query = {next(200.F) - 100.F, next(200.F) - 100.F, next(4.F) - 2.F};
+  }
+  StringifyTo(StdoutSink(), "Index PointFrame with ", point_count, " points:\n");
+
+  sdk::SpatialIndex index;
+  std::vector<std::size_t> thread_counts{1};
+  if (std::thread::hardware_concurrency() > 1) {
+    thread_counts.push_back(std::thread::hardware_concurrency());
+  }
+  for (const std::size_t thread_count : thread_counts) {
+    StringifyTo(StdoutSink(), "  ", thread_count, " threads:\n");
+    RunBenchmark("    build SpatialIndex", iterations, [&] {
+      index.Assign(view, /*cell_size=*/1.F, thread_count);
+      return index.size();
+    });
+  }
+
+  StringifyTo(StdoutSink(), "  ", queries.size(), " queries:\n");
+  std::vector<std::uint32_t> indices;
+  RunBenchmark("    brute force radius 1m", iterations / 100 + 1, [&] {
+    std::size_t found{0};
+    for (const std::array<float, 3>& query : queries) {
+      for (std::size_t i{0}; i < point_count; ++i) {
+        const float dx{view.x()[i] - query[0]};
+        const float dy{view.y()[i] - query[1]};
+        const float dz{view.z()[i] - query[2]};
+        found += dx * dx + dy * dy + dz * dz <= 1.F ? 1 : 0;
+      }
+    }
+    return found;
+  });
+  RunBenchmark("    SpatialIndex radius 1m", iterations, [&] {
+    std::size_t found{0};
+    for (const std::array<float, 3>& query : queries) {
+      index.RadiusSearch(query[0], query[1], query[2], 1.F, indices);
+      found += indices.size();
+    }
+    return found;
+  });
+
+  std::vector<sdk::PointNeighbor> neighbors;
+  RunBenchmark("    brute force 16 nearest", iterations / 100 + 1, [&] {
+    std::size_t sum{0};
+    for (const std::array<float, 3>& query : queries) {
+      neighbors.clear();
+      for (std::size_t i{0}; i < point_count; ++i) {
+        const float dx{view.x()[i] - query[0]};
+        const float dy{view.y()[i] - query[1]};
+        const float dz{view.z()[i] - query[2]};
+        neighbors.push_back({static_cast<std::uint32_t>(i), dx * dx + dy * dy + dz * dz});
+      }
+      std::nth_element(neighbors.begin(), neighbors.begin() + 15, neighbors.end(),
+                       [](const sdk::PointNeighbor& lhs, const sdk::PointNeighbor& rhs) {
+                         return lhs.squared_distance < rhs.squared_distance;
+                       });
+      sum += neighbors[15].index;
+    }
+    return sum;
+  });
+  RunBenchmark("    SpatialIndex 16 nearest", iterations, [&] {
+    std::size_t sum{0};
+    for (const std::array<float, 3>& query : queries) {
+      index.NearestNeighbors(query[0], query[1], query[2], 16, neighbors);
+      sum += neighbors.back().index;
+    }
+    return sum;
+  });
+
+  RunBenchmark("    SpatialIndex 4.5 x 2 x 2m box", iterations, [&] {
+    std::size_t found{0};
+    sdk::OrientedBox box{0.F, 0.F, 0.F, 2.25F, 1.F, 1.F, 0.F};
+    for (const std::array<float, 3>& query : queries) {
+      box.center_x = query[0];
+      box.center_y = query[1];
+      box.yaw = query[2];
+      index.BoxSearch(box, indices);
+      found += indices.size();
+    }
+    return found;
+  });
+}
+
+}  // namespace
+}  // namespace horus
+
+int main() {
+  horus::BenchmarkPointCloudView(/*point_count=*/1000, /*iterations=*/100000);
+  horus::BenchmarkPointCloudView(/*point_count=*/200000, /*iterations=*/500);
+  horus::BenchmarkPointTransform(/*point_count=*/200000, /*iterations=*/500);
+  horus::BenchmarkPointFilter(/*point_count=*/200000, /*iterations=*/500);
+  horus::BenchmarkVoxelGrid(/*point_count=*/200000, /*iterations=*/200);
+  horus::BenchmarkMergedPointCloud(/*frame_count=*/8, /*point_count=*/50000, /*iterations=*/200);
+  horus::BenchmarkRingPointCloud(/*point_count=*/200000, /*iterations=*/200);
+  horus::BenchmarkSpatialIndex(/*point_count=*/100000, /*iterations=*/100);
+  horus::BenchmarkSpatialIndex(/*point_count=*/500000, /*iterations=*/20);
+}
@@ -0,0 +1,75 @@
+/// @file
+///
+/// Compares serializing `PointFrame`s into a growing buffer (streaming) with serializing them into a
+/// buffer allocated once from `PbMessage::ByteSizeLong()` (exact size), and, for relayed frames,
+/// into `PbSegments` which reference the received points (segments).
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "benchmarks/helpers.h"
+#include "horus/pb/buffer.h"
+#include "horus/pb/cow_bytes.h"
+#include "horus/pb/cow_repeated.h"
+#include "horus/pb/cow_span.h"
+#include "horus/pb/point/point_message_pb.h"
+#include "horus/pb/segments.h"
+#include "horus/pb/serialize.h"
+
+namespace horus {
+namespace {
+
+/// Returns a `PointFrame` with `point_count` attributed points.
+pb::PointFrame MakePointFrame(std::size_t point_count) {
+  std::vector<float> points(point_count * 3);
+  std::vector<std::uint32_t> attributes(point_count);
+  for (std::size_t i{0}; i < point_count; ++i) {
+    points[i * 3] = static_cast<float>(i);
+    points[i * 3 + 1] = static_cast<float>(i) * 0.5F;
+    points[i * 3 + 2] = 1.F;
+    attributes[i] = static_cast<std::uint32_t>(i % 4);
+  }
+  return pb::PointFrame{}
+      .set_id(42)
+      .set_header(pb::PointFrame::Header{}.set_lidar_id(CowBytes::Borrowed("lidar-0")))
+      .set_points(pb::AttributedPoints{}
+                      .set_flattened_points(CowSpan<float>{std::move(points)})
+                      .set_attributes(CowSpan<std::uint32_t>{std::move(attributes)}));
+}
+
+/// Serializes `message` into a growing buffer, as done before `ByteSizeLong()` was introduced.
+std::size_t SerializeStreaming(const PbMessage& message) {
+  PbWriter writer;
+  message.SerializeTo(writer);
+  return std::move(writer).ToVector().size();
+}
+
+/// Serializes `message` into a buffer allocated once with `ByteSizeLong()`.
+std::size_t SerializeExact(const PbMessage& message) { return message.SerializeToBuffer().size(); }
+
+void BenchmarkPointFrame(std::size_t point_count, std::size_t iterations) {
+  const pb::PointFrame frame{MakePointFrame(point_count)};
+  StringifyTo(StdoutSink(), "PointFrame with ", point_count, " points:\n");
+  RunBenchmark("  streaming", iterations, [&frame] { return SerializeStreaming(frame); });
+  RunBenchmark("  exact size", iterations, [&frame] { return SerializeExact(frame); });
+
+  // Relays re-serialize frames which they received, and which therefore reference a `PbView`.
+  PbReader reader{PbBuffer{frame.SerializeToBuffer()}};
+  const pb::PointFrame received{reader};
+  RunBenchmark("  streaming (relayed)", iterations,
+               [&received] { return SerializeStreaming(received); });
+  RunBenchmark("  exact size (relayed)", iterations,
+               [&received] { return SerializeExact(received); });
+  RunBenchmark("  segments (relayed)", iterations,
+               [&received] { return received.SerializeToSegments().OwnedByteSize(); });
+}
+
+}  // namespace
+}  // namespace horus
+
+int main() {
+  horus::BenchmarkPointFrame(/*point_count=*/1000, /*iterations=*/10000);
+  horus::BenchmarkPointFrame(/*point_count=*/100000, /*iterations=*/200);
+}
@@ -6,14 +6,17 @@
 #define HORUS_FUTURE_CHANNEL_H_
 
 #include <atomic>
+#include <algorithm>
 #include <cassert>
 #include <condition_variable>
 #include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <memory>
 #include <mutex>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include "horus/attributes.h"
 #include "horus/event_loop/waker.h"
@@ -33,6 +36,15 @@ class ChannelClosedError final : public std::runtime_error {
   ChannelClosedError() : std::runtime_error{"channel is closed"} {}
 };
 
+/// The data structure used to queue the values of a `Channel`.
+enum class ChannelKind : std::uint8_t {
+  /// A queue guarded by a mutex. Supports unbounded channels.
+  kLocked,
+  /// A bounded lock-free ring. Senders and the receiver only take the mutex of the channel to park
+  /// when the ring is full (respectively empty), or to wake up a parked peer.
+  kLockFree,
+};
+
 /// A multiple-producer-single-consumer channel of communication used to send data from any thread
 /// to the event loop.
 template <class T>
@@ -49,10 +61,13 @@ class Channel final {
   /// Initializes a bounded `Channel` which can queue up to `capacity` messages without blocking.
   /// Pass `kUnbounded` for an unbounded channel.
   ///
+  /// `ChannelKind::kLockFree` channels must be bounded.
+  ///
   /// @throws std::bad_alloc If the data for the channel could not be allocated.
-  explicit Channel(std::size_t capacity) noexcept(false)
-      : Channel{std::make_shared<Shared>(capacity)} {
+  explicit Channel(std::size_t capacity, ChannelKind kind = ChannelKind::kLocked) noexcept(false)
+      : Channel{std::make_shared<Shared>(capacity, kind)} {
     assert(capacity > 0);
+    assert(kind != ChannelKind::kLockFree || capacity != kUnbounded);
   }
 
   /// Returns the `Sender` for this channel.
@@ -76,10 +91,29 @@ class Channel final {
   /// A list of `WakerNode`s.
   using WakerList = IntrusiveListByField<WakerNode, &WakerNode::link>;
 
+  /// A slot of the ring of a `ChannelKind::kLockFree` channel.
+  struct Slot {
+    /// The position in the channel at which the slot can next be written (if equal to the position)
+    /// or read (if equal to the position plus one).
+    std::atomic<std::size_t> sequence{0};
+    /// The value stored in the slot, if any.
+    OneOf<T, void> value{InPlaceType<void>};
+  };
+
   /// Data shared between both ends of the channel.
   struct Shared {
     /// Constructs the shared state.
-    explicit Shared(std::size_t cap) noexcept : capacity{cap} {}
+    ///
+    /// @throws std::bad_alloc If the ring of a `ChannelKind::kLockFree` channel cannot be
+    /// allocated.
+    explicit Shared(std::size_t cap, ChannelKind kind) noexcept(false) : capacity{cap} {
+      if (kind == ChannelKind::kLockFree) {
+        slots.reset(new Slot[capacity]);
+        for (std::size_t i{0}; i < capacity; ++i) {
+          slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+      }
+    }
 
     /// The capacity of the `queue`.
     const std::size_t capacity;
@@ -89,23 +123,48 @@ class Channel final {
     /// A linked list of pending `ReceiveFuture` wakers.
     WakerList recv_wakers;
 
-    /// Mutex which guards the `queue`.
+    /// Mutex which guards the `queue` and the waker lists.
     std::mutex mutex;
     /// Condition variable used to notify of state changes.
     std::condition_variable queue_cv;
-    /// The queue of items to receive.
+    /// The queue of items to receive, unless the channel is lock-free.
     std::deque<T> queue;
     /// Whether one end of the queue was shutdown; whichever side of the queue observes this value
     /// to be true should free the queue.
     std::atomic<bool> shutdown{false};
 
-    /// Wakes up a pending sender. Requires `mutex` to be held.
-    void WakeSender() noexcept {
-      WakerNode* const waker_node{send_wakers.Front()};
-      if (waker_node != nullptr) {
+    /// The ring of items to receive of a lock-free channel, or null.
+    std::unique_ptr<Slot[]> slots;
+    /// The position at which the next sender writes to `slots`.
+    std::atomic<std::size_t> send_position{0};
+    /// The position at which the receiver next reads from `slots`. Only used by the receiver.
+    std::size_t receive_position{0};
+    /// The number of threads blocked in `SendOrWait()` on a lock-free channel. Guarded by `mutex`.
+    std::size_t blocked_senders{0};
+    /// Whether a sender is parked on a lock-free channel, i.e. `send_wakers` is not empty or
+    /// `blocked_senders` is not zero. Written with `mutex` held.
+    std::atomic<bool> senders_parked{false};
+    /// Whether `recv_wakers` is not empty on a lock-free channel. Written with `mutex` held.
+    std::atomic<bool> receiver_parked{false};
+
+    /// Returns whether the channel uses a lock-free ring rather than the `queue`.
+    bool IsLockFree() const noexcept { return slots != nullptr; }
+
+    /// Wakes up to `count` pending senders. Requires `mutex` to be held.
+    ///
+    /// Futures are prioritized: threads blocked in `SendOrWait()` are only notified if fewer than
+    /// `count` futures are pending.
+    void WakeSenders(std::size_t count) noexcept {
+      WakerNode* waker_node{send_wakers.Front()};
+      while (waker_node != nullptr && count > 0) {
         waker_node->waker.Wake();
-      } else {
+        waker_node = waker_node->link.next;
+        --count;
+      }
+      if (count == 1) {
         queue_cv.notify_one();
+      } else if (count > 1) {
+        queue_cv.notify_all();
       }
     }
 
@@ -116,6 +175,143 @@ class Channel final {
         waker_node->waker.Wake();
       }
     }
+
+    /// Adds `waker_node` to `wakers` (if it is not already part of it) so that it wakes up
+    /// `context`. Requires `mutex` to be held.
+    static void Park(WakerList& wakers, WakerNode& waker_node, PollContext& context) noexcept {
+      waker_node.waker = context.Waker();
+      if (waker_node.link.prev == nullptr && waker_node.link.next == nullptr) {
+        // This is the first time we get polled to this point, so we insert `waker_node` into the
+        // linked list.
+        wakers.PushBack(waker_node);
+      }
+    }
+
+    /// Updates `senders_parked` and `receiver_parked`. Requires `mutex` to be held.
+    void UpdateParked() noexcept {
+      senders_parked.store(!send_wakers.IsEmpty() || blocked_senders != 0,
+                           std::memory_order_relaxed);
+      receiver_parked.store(!recv_wakers.IsEmpty(), std::memory_order_relaxed);
+      // Pairs with the fences in `TryPushLockFree()` and `TryPopLockFree()`: either the peer
+      // observes that we are parked, or we observe the change it made to the ring.
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    /// Returns whether the ring of a lock-free channel is full.
+    bool IsFullLockFree() const noexcept {
+      const std::size_t position{send_position.load(std::memory_order_relaxed)};
+      const Slot& slot{slots[position % capacity]};
+      const std::size_t sequence{slot.sequence.load(std::memory_order_acquire)};
+      return static_cast<std::ptrdiff_t>(sequence - position) < 0;
+    }
+
+    /// Writes a value constructed with `args` to the ring of a lock-free channel, waking up the
+    /// receiver if it is parked. Returns false (without consuming `args`) if the ring is full.
+    template <class... Args>
+    bool TryPushLockFree(Args&&... args) noexcept {
+      std::size_t position{send_position.load(std::memory_order_relaxed)};
+      for (;;) {
+        Slot& slot{slots[position % capacity]};
+        const std::size_t sequence{slot.sequence.load(std::memory_order_acquire)};
+        const std::ptrdiff_t difference{static_cast<std::ptrdiff_t>(sequence - position)};
+        if (difference == 0) {
+          if (send_position.compare_exchange_weak(position, position + 1,
+                                                  std::memory_order_relaxed)) {
+            slot.value.template Emplace<T>(std::forward<Args>(args)...);
+            slot.sequence.store(position + 1, std::memory_order_release);
+            break;
+          }
+        } else if (difference < 0) {
+          // The slot still holds the value written `capacity` positions ago.
+          return false;
+        } else {
+          // Another sender claimed the slot.
+          position = send_position.load(std::memory_order_relaxed);
+        }
+      }
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (receiver_parked.load(std::memory_order_relaxed)) {
+        const std::unique_lock<std::mutex> lock{mutex};
+        WakeReceiver();
+      }
+      return true;
+    }
+
+    /// Reads up to `max_count` values from the ring of a lock-free channel and passes them to
+    /// `sink`, waking up parked senders. Returns the number of values read.
+    ///
+    /// `sink` must not throw.
+    template <class Sink>
+    std::size_t TryPopLockFree(std::size_t max_count, Sink& sink) noexcept {
+      std::size_t count{0};
+      while (count < max_count) {
+        Slot& slot{slots[receive_position % capacity]};
+        if (slot.sequence.load(std::memory_order_acquire) != receive_position + 1) {
+          break;
+        }
+        sink(std::move(*slot.value.template TryAs<T>()));
+        slot.value.template Emplace<void>();
+        slot.sequence.store(receive_position + capacity, std::memory_order_release);
+        ++receive_position;
+        ++count;
+      }
+      if (count > 0) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (senders_parked.load(std::memory_order_relaxed)) {
+          const std::unique_lock<std::mutex> lock{mutex};
+          WakeSenders(count);
+        }
+      }
+      return count;
+    }
+
+    /// Receives up to `max_count` values, passing them to `sink`. Returns the number of values
+    /// received; if zero, `waker_node` was parked to wake up `context` once values are sent.
+    ///
+    /// `sink` must not throw.
+    template <class Sink>
+    std::size_t Receive(std::size_t max_count, WakerNode& waker_node, PollContext& context,
+                        Sink& sink) noexcept {
+      if (!IsLockFree()) {
+        const std::unique_lock<std::mutex> lock{mutex};
+        std::size_t count{0};
+        while (count < max_count && !queue.empty()) {
+          sink(std::move(queue.front()));
+          queue.pop_front();
+          ++count;
+        }
+        if (count == 0) {
+          Park(recv_wakers, waker_node, context);
+          return 0;
+        }
+        recv_wakers.Remove(waker_node);
+        if (queue.size() + count == capacity) {
+          // Queue is no longer full, maybe senders are waiting?
+          WakeSenders(count);
+        }
+        return count;
+      }
+
+      std::size_t count{TryPopLockFree(max_count, sink)};
+      if (count == 0) {
+        {
+          const std::unique_lock<std::mutex> lock{mutex};
+          Park(recv_wakers, waker_node, context);
+          UpdateParked();
+        }
+        // A sender may have written a value before observing that we were parked.
+        count = TryPopLockFree(max_count, sink);
+        if (count == 0) {
+          return 0;
+        }
+      }
+      if (receiver_parked.load(std::memory_order_relaxed)) {
+        const std::unique_lock<std::mutex> lock{mutex};
+        recv_wakers.Remove(waker_node);
+        UpdateParked();
+      }
+      return count;
+    }
   };
 
   /// Constructs a `Channel`.
@@ -200,6 +396,8 @@ class Channel<T>::Receiver final {
  public:
   /// Future returned by `Receive()`.
   class ReceiveFuture;
+  /// Future returned by `ReceiveMany()`.
+  class ReceiveManyFuture;
 
   /// (Internal use only) Constructs the `Receiver`.
   explicit Receiver(const std::shared_ptr<Shared>& shared) noexcept(false) : shared_{shared} {}
@@ -221,6 +419,17 @@ class Channel<T>::Receiver final {
     return ReceiveFuture{shared_, info};
   }
 
+  /// Returns a future which will complete with the values sent to the channel, once at least one
+  /// value is available. At most `max_count` values are received at once.
+  ///
+  /// The values are appended to `batch` after clearing it, which allows reusing its storage across
+  /// calls.
+  ReceiveManyFuture ReceiveMany(std::size_t max_count, std::vector<T>&& batch = {},
+                                const FutureInfo& info = CurrentFutureInfo()) {
+    assert(max_count > 0);
+    return ReceiveManyFuture{shared_, max_count, std::move(batch), info};
+  }
+
  private:
   /// A pointer to the shared state.
   std::shared_ptr<Shared> shared_;
@@ -299,10 +508,74 @@ class Channel<T>::Receiver::ReceiveFuture final : public Future<T> {
   FutureInfo info_;
 };
 
+/// @copydoc Channel::Receiver::ReceiveManyFuture
+template <class T>
+using ChannelReceiveManyFuture = typename Channel<T>::Receiver::ReceiveManyFuture;
+
+template <class T>
+class Channel<T>::Receiver::ReceiveManyFuture final : public Future<std::vector<T>> {
+ public:
+  /// (Internal use only) Constructs the `ReceiveManyFuture`.
+  explicit ReceiveManyFuture(const std::shared_ptr<Shared>& shared, std::size_t max_count,
+                             std::vector<T>&& batch, const FutureInfo& info) noexcept
+      : shared_{shared},
+        max_count_{max_count},
+        batch_(std::move(batch)),  // Braces would construct a `T` from `batch` if possible.
+        info_{info} {
+    batch_.clear();
+  }
+
+  /// Not copyable.
+  ReceiveManyFuture(const ReceiveManyFuture&) = delete;
+  /// Not copyable.
+  ReceiveManyFuture& operator=(const ReceiveManyFuture&) = delete;
+  /// Move constructor.
+  ReceiveManyFuture(ReceiveManyFuture&&) noexcept = default;
+  /// Move assignment operator.
+  ReceiveManyFuture& operator=(ReceiveManyFuture&&) noexcept = default;
+
+  /// Destroys the future.
+  ~ReceiveManyFuture() noexcept final;
+
+  /// Polls the future until at least one message is sent through the channel.
+  ///
+  /// @throws std::bad_alloc If the batch cannot be allocated.
+  PollResult<std::vector<T>> UnsafePoll(PollContext& context) final;
+
+ private:
+  /// A pointer to the shared state.
+  std::weak_ptr<Shared> shared_;
+  /// The waker used to wake up the future.
+  WakerNode waker_;
+  /// The maximum number of values to receive.
+  std::size_t max_count_;
+  /// The received values.
+  std::vector<T> batch_;
+  /// Future information.
+  FutureInfo info_;
+};
+
 template <class T>
 template <class... Args>
 void Channel<T>::Sender::SendOrWait(Args&&... args) {
   Shared& shared{ThrowIfClosed(shared_)};
+  if (shared.IsLockFree()) {
+    T value{std::forward<Args>(args)...};
+    while (!shared.TryPushLockFree(std::move(value))) {
+      std::unique_lock<std::mutex> lock{shared.mutex};
+      ++shared.blocked_senders;
+      shared.UpdateParked();
+      shared.queue_cv.wait(lock, [&shared]() noexcept -> bool {
+        return shared.shutdown || !shared.IsFullLockFree();
+      });
+      --shared.blocked_senders;
+      shared.UpdateParked();
+      if (shared.shutdown) {
+        throw ChannelClosedError{};
+      }
+    }
+    return;
+  }
   std::unique_lock<std::mutex> lock{shared.mutex};
   shared.queue_cv.wait(lock, [&shared]() noexcept -> bool {
     return shared.shutdown || (shared.queue.size() < shared.capacity &&
@@ -318,9 +591,13 @@ void Channel<T>::Sender::SendOrWait(Args&&... args) {
 template <class T>
 bool Channel<T>::Sender::TrySend(T&& value) {
   Shared& shared{*shared_};
+  if (shared.IsLockFree()) {
+    return !shared.shutdown && !shared.senders_parked.load(std::memory_order_relaxed) &&
+           shared.TryPushLockFree(std::move(value));  // Prioritize futures.
+  }
   const std::unique_lock<std::mutex> lock{shared.mutex};
   if (shared.shutdown || shared.queue.size() == shared.capacity ||
-      shared.send_wakers.IsEmpty()) {  // Prioritize futures.
+      !shared.send_wakers.IsEmpty()) {  // Prioritize futures.
     return false;
   }
   shared.queue.push_back(std::move(value));
@@ -338,22 +615,34 @@ PollResult<void> Channel<T>::Sender::SendFuture::UnsafePoll(PollContext& context
   }
   const std::shared_ptr<Shared> shared_ptr{shared_.lock()};
   Shared& shared{ThrowIfClosed(shared_ptr)};
-  {
+  if (shared.IsLockFree()) {
+    if (!shared.TryPushLockFree(std::move(*value))) {
+      {
+        const std::unique_lock<std::mutex> lock{shared.mutex};
+        Shared::Park(shared.send_wakers, waker_, context);
+        shared.UpdateParked();
+      }
+      // The receiver may have made room before observing that we were parked.
+      if (!shared.TryPushLockFree(std::move(*value))) {
+        return PendingResult<void>();
+      }
+    }
+    if (shared.senders_parked.load(std::memory_order_relaxed)) {
+      const std::unique_lock<std::mutex> lock{shared.mutex};
+      shared.send_wakers.Remove(waker_);
+      shared.UpdateParked();
+    }
+  } else {
     const std::unique_lock<std::mutex> lock{shared.mutex};
     if (shared.queue.size() == shared.capacity) {
-      waker_.waker = context.Waker();
-      if (waker_.link.prev == nullptr && waker_.link.next == nullptr) {
-        // This is the first time we get polled to this point, so we insert `waker_` into the linked
-        // list.
-        shared.send_wakers.PushBack(waker_);
-      }
+      Shared::Park(shared.send_wakers, waker_, context);
       return PendingResult<void>();
     }
     shared.send_wakers.Remove(waker_);
     shared.queue.push_back(std::move(*value));
     shared.WakeReceiver();
-    value_.template Emplace<void>();  // So that future polls will throw.
   }
+  value_.template Emplace<void>();  // So that future polls will throw.
   shared_.reset();
   return ReadyResult<void>();
 }
@@ -364,6 +653,9 @@ Channel<T>::Sender::SendFuture::~SendFuture() noexcept {
   if (shared_ptr != nullptr) {
     const std::unique_lock<std::mutex> lock{shared_ptr->mutex};
     shared_ptr->send_wakers.Remove(waker_);
+    if (shared_ptr->IsLockFree()) {
+      shared_ptr->UpdateParked();
+    }
   }
 }
 
@@ -373,35 +665,53 @@ PollResult<T> Channel<T>::Receiver::ReceiveFuture::UnsafePoll(PollContext& conte
 
   const std::shared_ptr<Shared> shared_ptr{shared_.lock()};
   Shared& shared{ThrowIfClosed(shared_ptr)};
-  std::unique_lock<std::mutex> lock{shared.mutex};
-  if (shared.queue.empty()) {
-    waker_.waker = context.Waker();
-    if (waker_.link.prev == nullptr && waker_.link.next == nullptr) {
-      // This is the first time we get polled to this point, so we insert `waker_` into the linked
-      // list.
-      shared.recv_wakers.PushBack(waker_);
-    }
+  OneOf<T, void> result{InPlaceType<void>};
+  auto sink = [&result](T&& value) noexcept { result.template Emplace<T>(std::move(value)); };
+  if (shared.Receive(/*max_count=*/1, waker_, context, sink) == 0) {
     return PendingResult<T>();
   }
-  shared.recv_wakers.Remove(waker_);
+  shared_.reset();
+  return ReadyResult<T>(std::move(*result.template TryAs<T>()));
+}
 
-  T result{std::move(shared.queue.front())};
-  shared.queue.pop_front();
-  if (shared.queue.size() == shared.capacity - 1) {
-    // Queue is no longer full, maybe a sender is waiting?
-    shared.WakeSender();
+template <class T>
+Channel<T>::Receiver::ReceiveFuture::~ReceiveFuture() noexcept {
+  const std::shared_ptr<Shared> shared_ptr{shared_.lock()};
+  if (shared_ptr != nullptr) {
+    const std::unique_lock<std::mutex> lock{shared_ptr->mutex};
+    shared_ptr->recv_wakers.Remove(waker_);
+    if (shared_ptr->IsLockFree()) {
+      shared_ptr->UpdateParked();
+    }
+  }
+}
+
+template <class T>
+PollResult<std::vector<T>> Channel<T>::Receiver::ReceiveManyFuture::UnsafePoll(
+    PollContext& context) {
+  const PollContext::Trace trace{context, "ChannelReceiveMany", info_};
+
+  const std::shared_ptr<Shared> shared_ptr{shared_.lock()};
+  Shared& shared{ThrowIfClosed(shared_ptr)};
+  // Reserve beforehand so that received values can be appended without throwing.
+  batch_.reserve(std::min(max_count_, shared.capacity));
+  auto sink = [this](T&& value) noexcept { batch_.push_back(std::move(value)); };
+  if (shared.Receive(max_count_, waker_, context, sink) == 0) {
+    return PendingResult<std::vector<T>>();
   }
-  lock.unlock();  // Since `reset()` below might destroy the shared state.
   shared_.reset();
-  return ReadyResult<T>(std::move(result));
+  return ReadyResult<std::vector<T>>(std::move(batch_));
 }
 
 template <class T>
-Channel<T>::Receiver::ReceiveFuture::~ReceiveFuture() noexcept {
+Channel<T>::Receiver::ReceiveManyFuture::~ReceiveManyFuture() noexcept {
   const std::shared_ptr<Shared> shared_ptr{shared_.lock()};
   if (shared_ptr != nullptr) {
     const std::unique_lock<std::mutex> lock{shared_ptr->mutex};
     shared_ptr->recv_wakers.Remove(waker_);
+    if (shared_ptr->IsLockFree()) {
+      shared_ptr->UpdateParked();
+    }
   }
 }
 
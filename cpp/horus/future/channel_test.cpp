@@ -2,21 +2,95 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
 #include <cstdint>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
 
+#include "horus/future/join.h"
+#include "horus/future/map_to.h"
 #include "horus/testing/event_loop.h"
 
 namespace horus {
 namespace {
 
 TEST(Channel, Basic) {
-  Channel<std::int32_t> channel{/*capacity=*/4};
+  for (const ChannelKind kind : {ChannelKind::kLocked, ChannelKind::kLockFree}) {
+    Channel<std::int32_t> channel{/*capacity=*/4, kind};
 
-  channel.GetSender().SendOrWait(1);
-  channel.GetSender().SendOrWait(2);
+    channel.GetSender().SendOrWait(1);
+    channel.GetSender().SendOrWait(2);
 
-  EXPECT_EQ(TestOnlyExecute(channel.GetReceiver().Receive()), 1);
-  EXPECT_EQ(TestOnlyExecute(channel.GetReceiver().Receive()), 2);
+    EXPECT_EQ(TestOnlyExecute(channel.GetReceiver().Receive()), 1);
+    EXPECT_EQ(TestOnlyExecute(channel.GetReceiver().Receive()), 2);
+  }
+}
+
+TEST(Channel, ReceiveManyDrainsUpToMaxCount) {
+  for (const ChannelKind kind : {ChannelKind::kLocked, ChannelKind::kLockFree}) {
+    Channel<std::int32_t> channel{/*capacity=*/4, kind};
+    for (std::int32_t i{1}; i <= 3; ++i) {
+      ASSERT_TRUE(channel.GetSender().TrySend(std::int32_t{i}));
+    }
+
+    std::vector<std::int32_t> batch{
+        TestOnlyExecute(channel.GetReceiver().ReceiveMany(/*max_count=*/2))};
+    EXPECT_EQ(batch, (std::vector<std::int32_t>{1, 2}));
+
+    // The storage of the batch can be reused; previous values are discarded.
+    batch = TestOnlyExecute(channel.GetReceiver().ReceiveMany(/*max_count=*/8, std::move(batch)));
+    EXPECT_EQ(batch, (std::vector<std::int32_t>{3}));
+  }
+}
+
+TEST(Channel, SendFutureWaitsForRoom) {
+  for (const ChannelKind kind : {ChannelKind::kLocked, ChannelKind::kLockFree}) {
+    Channel<std::int32_t> channel{/*capacity=*/2, kind};
+    ASSERT_TRUE(channel.GetSender().TrySend(1));
+    ASSERT_TRUE(channel.GetSender().TrySend(2));
+    EXPECT_FALSE(channel.GetSender().TrySend(3));
+
+    // The send is polled first, while the channel is full.
+    EXPECT_EQ(TestOnlyExecute(Join(channel.GetSender().Send(3) | MapTo(true),
+                                   channel.GetReceiver().Receive())),
+              std::make_tuple(true, 1));
+    EXPECT_EQ(TestOnlyExecute(channel.GetReceiver().ReceiveMany(/*max_count=*/4)),
+              (std::vector<std::int32_t>{2, 3}));
+  }
+}
+
+TEST(Channel, LockFreeMultipleSenders) {
+  constexpr std::size_t kSenderCount{4};
+  constexpr std::int32_t kValuesPerSender{1000};
+  Channel<std::pair<std::size_t, std::int32_t>> channel{/*capacity=*/8, ChannelKind::kLockFree};
+
+  std::vector<std::thread> senders;
+  for (std::size_t sender{0}; sender < kSenderCount; ++sender) {
+    senders.emplace_back([&channel, sender]() {
+      for (std::int32_t value{0}; value < kValuesPerSender; ++value) {
+        channel.GetSender().SendOrWait(sender, value);
+      }
+    });
+  }
+
+  std::vector<std::int32_t> next_values(kSenderCount, 0);
+  std::size_t remaining{kSenderCount * kValuesPerSender};
+  std::vector<std::pair<std::size_t, std::int32_t>> batch;
+  while (remaining > 0) {
+    batch = TestOnlyExecute(channel.GetReceiver().ReceiveMany(/*max_count=*/16, std::move(batch)));
+    ASSERT_FALSE(batch.empty());
+    ASSERT_LE(batch.size(), 16);
+    for (const std::pair<std::size_t, std::int32_t>& value : batch) {
+      // Values sent by a single sender are received in order.
+      EXPECT_EQ(value.second, next_values[value.first]++);
+    }
+    remaining -= batch.size();
+  }
+  for (std::thread& sender : senders) {
+    sender.join();
+  }
 }
 
 }  // namespace
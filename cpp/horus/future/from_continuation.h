@@ -219,7 +219,7 @@ class FromContinuationFuture<T>::Continuation final {
   bool ContinueOrFailWith(const F& complete) noexcept;
 
   /// State shared with the `Continuation`.
-  Shared* shared_state_;
+  Shared* shared_state_{nullptr};
 };
 
 /// An object which can be used to make a `FromContinuationFuture<T>` complete.
@@ -0,0 +1,105 @@
+#include "horus/pb/arena.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "horus/pb/buffer.h"
+#include "horus/pb/message.h"
+#include "horus/pb/serialize.h"
+#include "horus/pointer/cast.h"
+#include "horus/strings/string_view.h"
+#include "horus/types/scope_guard.h"
+
+namespace horus {
+namespace {
+
+/// Appends `message`, whose size is `byte_size`, to `buffer`.
+///
+/// If `buffer` has enough capacity, its bytes do not move. If serialization fails, `buffer` is
+/// restored to its original size.
+void SerializeInto(const PbMessage& message, std::size_t byte_size,
+                   std::vector<std::uint8_t>& buffer) noexcept(false) {
+  const std::size_t size{buffer.size()};
+  PbWriter writer{std::move(buffer), byte_size};
+  const auto restore = Defer([&buffer, &writer, size, byte_size]() noexcept {
+    buffer = std::move(writer).ToVector();
+    if (buffer.size() != size + byte_size) {
+      buffer.resize(size);
+    }
+  });
+  message.SerializeTo(writer);
+}
+
+}  // namespace
+
+PbView PbArena::Copy(StringView bytes, std::size_t alignment) noexcept(false) {
+  if (bytes.size() > chunk_size_ / 2) {
+    // Large allocations get their own chunk, which would otherwise be mostly wasted.
+    ++allocated_chunk_count_;
+    return PbView{PbBuffer::Copy(bytes)};
+  }
+  const std::size_t offset{Reserve(bytes.size(), alignment)};
+  static_cast<void>(chunk_->insert(chunk_->end(), bytes.begin(), bytes.end()));
+  used_ = chunk_->size();
+  return ViewFrom(offset);
+}
+
+PbView PbArena::Serialize(const PbMessage& message) noexcept(false) {
+  const std::size_t byte_size{message.ByteSizeLong()};
+  if (byte_size > chunk_size_ / 2) {
+    ++allocated_chunk_count_;
+    std::vector<std::uint8_t> buffer;
+    SerializeInto(message, byte_size, buffer);
+    return PbView{PbBuffer{std::move(buffer)}};
+  }
+  const std::size_t offset{Reserve(byte_size, 1)};
+  const std::uint8_t* const data{chunk_->data()};
+  SerializeInto(message, byte_size, *chunk_);
+  // Views into the chunk must remain valid.
+  assert(chunk_->data() == data);
+  static_cast<void>(data);
+  used_ = chunk_->size();
+  return ViewFrom(offset);
+}
+
+void PbArena::Reset() noexcept {
+  used_ = 0;
+  if (chunk_.use_count() > 1) {
+    // Some views still refer to the chunk, which is freed once they are destroyed.
+    chunk_.reset();
+  } else if (chunk_ != nullptr) {
+    chunk_->clear();
+  }
+}
+
+std::size_t PbArena::Reserve(std::size_t size, std::size_t alignment) noexcept(false) {
+  assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+  assert(alignment <= alignof(std::max_align_t));
+  assert(size <= chunk_size_);
+
+  std::size_t offset{(used_ + alignment - 1) & ~(alignment - 1)};
+  if (chunk_ == nullptr || offset + size > chunk_->capacity()) {
+    std::shared_ptr<std::vector<std::uint8_t>> chunk{
+        std::make_shared<std::vector<std::uint8_t>>()};
+    chunk->reserve(chunk_size_);
+    chunk_ = std::move(chunk);
+    ++allocated_chunk_count_;
+    offset = 0;
+  }
+  // Does not reallocate since `offset <= chunk_->capacity()`.
+  chunk_->resize(offset);
+  used_ = offset;
+  return offset;
+}
+
+PbView PbArena::ViewFrom(std::size_t offset) const noexcept {
+  std::shared_ptr<const char> data{chunk_, SafePointerCast<char>(chunk_->data())};
+  return PbBuffer{std::move(data), chunk_->size()}.View(offset, chunk_->size() - offset);
+}
+
+}  // namespace horus
@@ -0,0 +1,126 @@
+/// @file
+///
+/// The `PbArena` class.
+
+#ifndef HORUS_PB_ARENA_H_
+#define HORUS_PB_ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "horus/pb/buffer.h"
+#include "horus/pb/cow_bytes.h"
+#include "horus/pb/cow_span.h"
+#include "horus/pb/message.h"
+#include "horus/pointer/cast.h"
+#include "horus/strings/string_view.h"
+#include "horus/types/span.h"
+
+namespace horus {
+
+/// Default size of the chunks allocated by a `PbArena`.
+constexpr std::size_t kPbDefaultArenaChunkSize{64 * 1024};
+
+/// An arena from which the contents of `CowBytes`, `CowSpan`s and serialized messages are
+/// allocated, rather than from individual heap allocations.
+///
+/// Allocations are carved out of large shared chunks, and returned as `PbView`s which keep their
+/// chunk alive. Chunks are therefore freed in one shot once the arena moved on to another chunk (or
+/// was `Reset()` or destroyed) and all the views into them were destroyed. Once a frame is
+/// processed, `Reset()` reuses the current chunk if no view refers to it anymore, so that steady
+/// per-frame processing does not allocate at all.
+///
+/// The arena only backs the values explicitly copied or serialized into it: mutating a `Cow*`
+/// container (e.g. with `Vector()` or a `mutable_*()` accessor) still copies its contents to a
+/// heap-allocated `std::vector`, and messages themselves are not allocated from the arena. Messages
+/// which are filled for each frame should rather be recycled with a `PbMessagePool`.
+///
+/// A `PbArena` is not thread-safe, and is meant to be used by a single thread (e.g. one per
+/// callback thread). The views it returns may be shared across threads.
+class PbArena final {
+ public:
+  /// Constructs an arena which allocates chunks of `chunk_size` bytes.
+  explicit PbArena(std::size_t chunk_size = kPbDefaultArenaChunkSize) noexcept
+      : chunk_size_{chunk_size} {}
+
+  /// Arenas cannot be copied.
+  PbArena(const PbArena&) = delete;
+  /// Arenas cannot be copied.
+  PbArena& operator=(const PbArena&) = delete;
+  /// Move constructor.
+  PbArena(PbArena&&) noexcept = default;
+  /// Move assignment operator.
+  PbArena& operator=(PbArena&&) noexcept = default;
+
+  /// Destroys the arena; chunks which are still referenced by views remain alive.
+  ~PbArena() noexcept = default;
+
+  /// Returns a view of a copy of `bytes` allocated from the arena, whose first byte is aligned to
+  /// `alignment` (which must be a power of two no greater than `alignof(std::max_align_t)`).
+  ///
+  /// @throws std::bad_alloc If a new chunk cannot be allocated.
+  PbView Copy(StringView bytes, std::size_t alignment = 1) noexcept(false);
+
+  /// Returns a `CowBytes` which refers to a copy of `bytes` allocated from the arena.
+  ///
+  /// @throws std::bad_alloc If a new chunk cannot be allocated.
+  CowBytes CopyBytes(StringView bytes) noexcept(false) { return CowBytes{Copy(bytes)}; }
+
+  /// Returns a `CowSpan` which refers to a copy of `values` allocated from the arena.
+  ///
+  /// @throws std::bad_alloc If a new chunk cannot be allocated.
+  template <class T>
+  CowSpan<T> CopySpan(Span<const T> values) noexcept(false) {
+    static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+    return CowSpan<T>{
+        Copy(StringView{SafePointerCast<char>(values.begin()), values.size() * sizeof(T)},
+             alignof(T))};
+  }
+
+  /// Serializes `message` into the arena and returns a view of the result.
+  ///
+  /// The message is written directly to the current chunk (after computing its size with
+  /// `PbMessage::ByteSizeLong()`), so that it is neither copied nor written to a temporary buffer.
+  ///
+  /// @throws std::bad_alloc If a new chunk cannot be allocated.
+  PbView Serialize(const PbMessage& message) noexcept(false);
+
+  /// Marks the end of a frame: subsequent allocations reuse the current chunk if no view refers to
+  /// it anymore, and a new chunk is allocated otherwise.
+  void Reset() noexcept;
+
+  /// Returns the number of chunks allocated by the arena since it was constructed.
+  constexpr std::size_t AllocatedChunkCount() const noexcept { return allocated_chunk_count_; }
+
+  /// Returns the number of bytes allocated from the current chunk.
+  constexpr std::size_t UsedBytes() const noexcept { return used_; }
+
+ private:
+  /// Makes room for `size` bytes aligned to `alignment` at the end of the current chunk, allocating
+  /// a new chunk if needed, and returns their offset in the chunk. The chunk is padded up to that
+  /// offset, so the bytes must then be appended to it.
+  ///
+  /// @throws std::bad_alloc If a new chunk cannot be allocated.
+  std::size_t Reserve(std::size_t size, std::size_t alignment) noexcept(false);
+
+  /// Returns a view of the bytes of the current chunk from `offset` to its end.
+  PbView ViewFrom(std::size_t offset) const noexcept;
+
+  /// The size of the chunks.
+  std::size_t chunk_size_;
+  /// The current chunk, whose size is the number of bytes allocated from it and whose capacity is
+  /// `chunk_size_`, or null if no chunk was allocated since the last `Reset()`. Since allocations
+  /// only append to the chunk within its capacity, its bytes never move.
+  std::shared_ptr<std::vector<std::uint8_t>> chunk_;
+  /// @see UsedBytes()
+  std::size_t used_{0};
+  /// @see AllocatedChunkCount()
+  std::size_t allocated_chunk_count_{0};
+};
+
+}  // namespace horus
+
+#endif  // HORUS_PB_ARENA_H_
@@ -0,0 +1,132 @@
+#include "horus/pb/arena.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "horus/pb/buffer.h"
+#include "horus/pb/cow_bytes.h"
+#include "horus/pb/cow_span.h"
+#include "horus/pb/serialize.h"
+#include "horus/pb/testing/messages_pb.h"
+#include "horus/pointer/cast.h"
+#include "horus/strings/string_view.h"
+
+namespace horus {
+namespace {
+
+TEST(PbArena, CopiesShareChunks) {
+  PbArena arena{/*chunk_size=*/256};
+  const CowBytes first{arena.CopyBytes("first")};
+  const CowBytes second{arena.CopyBytes("second")};
+  const std::vector<double> values{1.0, 2.0, 3.0};
+  const CowSpan<double> span{arena.CopySpan<double>(values)};
+
+  EXPECT_EQ(first.Str(), "first");
+  EXPECT_EQ(second.Str(), "second");
+  EXPECT_EQ(std::vector<double>(span.begin(), span.end()), values);
+  EXPECT_EQ(arena.AllocatedChunkCount(), 1);
+  ASSERT_NE(first.TryView(), nullptr);
+  ASSERT_NE(span.TryView(), nullptr);
+  EXPECT_EQ(first.TryView()->Buffer().Str().data(), span.TryView()->Buffer().Str().data());
+  // Spans are aligned.
+  EXPECT_EQ(PointerCastToUintptr(span.TryView()->Str().data()) % alignof(double), 0);
+}
+
+TEST(PbArena, LargeCopiesGetTheirOwnChunk) {
+  PbArena arena{/*chunk_size=*/256};
+  const CowBytes small{arena.CopyBytes("small")};
+  const std::string large(1000, 'x');
+  const CowBytes large_copy{arena.CopyBytes(large)};
+  const CowBytes other{arena.CopyBytes("other")};
+
+  EXPECT_EQ(large_copy.Str(), large);
+  EXPECT_EQ(arena.AllocatedChunkCount(), 2);
+  EXPECT_EQ(small.TryView()->Buffer().Str().data(), other.TryView()->Buffer().Str().data());
+}
+
+TEST(PbArena, ResetReusesUnreferencedChunks) {
+  PbArena arena{/*chunk_size=*/256};
+  for (int frame{0}; frame < 10; ++frame) {
+    const CowBytes bytes{arena.CopyBytes("frame")};
+    EXPECT_EQ(bytes.Str(), "frame");
+    arena.Reset();
+  }
+  // `Reset()` is called while `bytes` is alive, so a new chunk is allocated for each frame.
+  EXPECT_EQ(arena.AllocatedChunkCount(), 10);
+
+  PbArena reused{/*chunk_size=*/256};
+  for (int frame{0}; frame < 10; ++frame) {
+    {
+      const CowBytes bytes{reused.CopyBytes("frame")};
+      EXPECT_EQ(bytes.Str(), "frame");
+    }
+    reused.Reset();
+    EXPECT_EQ(reused.UsedBytes(), 0);
+  }
+  EXPECT_EQ(reused.AllocatedChunkCount(), 1);
+}
+
+TEST(PbArena, ViewsOutliveTheArena) {
+  CowBytes bytes;
+  {
+    PbArena arena;
+    bytes = arena.CopyBytes("kept alive");
+  }
+  EXPECT_EQ(bytes.Str(), "kept alive");
+}
+
+TEST(PbArena, Serialize) {
+  PbArena arena;
+  const pb::TestMessage message{
+      pb::TestMessage{}.set_u32(1).set_string(arena.CopyBytes("string")).set_rep_float(
+          arena.CopySpan<float>(std::vector<float>{1.F, 2.F}))};
+  const std::vector<std::uint8_t> expected{message.SerializeToBuffer()};
+
+  const PbView first{arena.Serialize(message)};
+  const PbView second{arena.Serialize(message)};
+  EXPECT_EQ(first.Str(), (StringView{SafePointerCast<char>(expected.data()), expected.size()}));
+  EXPECT_EQ(second.Str(), first.Str());
+  EXPECT_EQ(arena.AllocatedChunkCount(), 1);
+  // Messages are written directly to the chunk, after the previous allocations.
+  EXPECT_EQ(first.Buffer().Str().data(), second.Buffer().Str().data());
+  EXPECT_EQ(second.Offset(), first.Offset() + first.Size());
+  EXPECT_EQ(arena.UsedBytes(), second.Offset() + second.Size());
+
+  PbReader reader{PbView{first}};
+  const pb::TestMessage deserialized{reader};
+  EXPECT_EQ(deserialized.u32(), 1);
+  EXPECT_EQ(deserialized.string().Str(), "string");
+}
+
+TEST(PbArena, SerializeLargeMessages) {
+  PbArena arena{/*chunk_size=*/256};
+  const CowBytes small{arena.CopyBytes("small")};
+  const pb::TestMessage message{pb::TestMessage{}.set_string(CowBytes{CowBytes::Owned(1000, 'x')})};
+  const PbView large{arena.Serialize(message)};
+  const PbView full{
+      arena.Serialize(pb::TestMessage{}.set_string(CowBytes{CowBytes::Owned(100, 'y')}))};
+  const PbView fuller{
+      arena.Serialize(pb::TestMessage{}.set_string(CowBytes{CowBytes::Owned(100, 'y')}))};
+  const PbView next{
+      arena.Serialize(pb::TestMessage{}.set_string(CowBytes{CowBytes::Owned(100, 'z')}))};
+
+  const std::vector<std::uint8_t> expected{message.SerializeToBuffer()};
+  EXPECT_EQ(large.Str(), (StringView{SafePointerCast<char>(expected.data()), expected.size()}));
+  // `next` does not fit in the chunk of `small`, `full` and `fuller`, so a new chunk is allocated.
+  EXPECT_EQ(arena.AllocatedChunkCount(), 3);
+  EXPECT_EQ(small.TryView()->Buffer().Str().data(), full.Buffer().Str().data());
+  EXPECT_EQ(fuller.Str(), full.Str());
+  EXPECT_EQ(next.Offset(), 0);
+  EXPECT_EQ(small.Str(), "small");
+
+  PbReader reader{PbView{full}};
+  EXPECT_EQ(pb::TestMessage{reader}.string().Str(), std::string(100, 'y'));
+}
+
+}  // namespace
+}  // namespace horus
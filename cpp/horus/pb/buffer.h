@@ -19,8 +19,18 @@
 
 namespace horus {
 
+class PbArena;
+class PbReader;
 class PbView;
 
+namespace horus_internal {
+
+/// Returns whether `data` is a valid serialized message of type `T`. Defined in `table.h`.
+template <class T>
+bool PbValidate(StringView data) noexcept;
+
+}  // namespace horus_internal
+
 /// A read-only reference to a buffer which stores a Protobuf message.
 class PbBuffer final {
  public:
@@ -48,6 +58,10 @@ class PbBuffer final {
   /// Returns a read-only view into the buffer.
   StringView Str() const noexcept { return {buffer_.get(), size_}; }
 
+  /// Returns whether the buffer is owned (and therefore kept alive) by the `PbBuffer`, rather than
+  /// `Borrowed()`.
+  bool IsShared() const noexcept { return buffer_.use_count() != 0; }
+
   /// Returns a view into the whole buffer.
   inline PbView View() const noexcept;
 
@@ -55,6 +69,8 @@ class PbBuffer final {
   inline PbView View(std::size_t offset, std::size_t size) const noexcept;
 
  private:
+  friend class PbArena;
+
   /// Constructs a `PbBuffer` which refers to a borrowed string.
   ///
   /// This uses the _aliasing constructor_ of `std::shared_ptr` with an empty source
@@ -115,13 +131,41 @@ class PbView final {
     return buffer_.View(offset_ + offset, size);
   }
 
+  /// Checks in a single pass that the view holds a valid serialized message of type `T` (a
+  /// generated message), and records the result, which is returned.
+  ///
+  /// Fields deserialized from a validated view are themselves validated, and decoded without
+  /// further checks (e.g. packed fields are iterated without bounds checks). Received data should
+  /// therefore be validated once, when it is received.
+  template <class T>
+  bool Validate() noexcept {
+    validated_ = horus_internal::PbValidate<T>(Str());
+    return validated_;
+  }
+
+  /// Returns whether the view was successfully checked by `Validate()`, or was deserialized from
+  /// such a view.
+  constexpr bool IsValidated() const noexcept { return validated_; }
+
+  /// (Internal use only) Returns a subview starting at `offset` and with the given `size`, which
+  /// must delimit a field of this view, and which is therefore validated if this view is.
+  PbView InternalFieldView(std::size_t offset, std::size_t size) const noexcept {
+    PbView view{View(offset, size)};
+    view.validated_ = validated_;
+    return view;
+  }
+
  private:
+  friend class PbReader;
+
   /// The underlying buffer.
   PbBuffer buffer_;
   /// The offset from the start of the buffer.
   std::size_t offset_;
   /// The size of the view.
   std::size_t size_;
+  /// @see IsValidated()
+  bool validated_{false};
 };
 
 inline PbView PbBuffer::View() const noexcept { return PbView{PbBuffer{*this}}; }
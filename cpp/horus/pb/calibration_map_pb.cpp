@@ -1,6 +1,9 @@
 #include "horus/pb/calibration_map_pb.h"
 
+#include <cstddef>
+
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 
 namespace horus {
 namespace sdk {
@@ -12,35 +15,49 @@ CalibrationMap::CalibrationMap(const CalibrationMap& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void CalibrationMap::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowSpan<float>, PbDeserFlags::kFixed>(writer, /*tag=*/ 2, map_points_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 4, intensities_bytes_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t CalibrationMap::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void CalibrationMap::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 2: {
-        DeserializeField<CowSpan<float>, PbDeserFlags::kFixed>(reader, map_points_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<CowBytes>(reader, intensities_bytes_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void CalibrationMap::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
+// MARK: Field tables
+
+// Messages are not standard-layout since they have a vtable, so `offsetof()` is only
+// conditionally-supported on them; it is supported by all compilers targeted by the SDK.
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
+const horus_internal::PbMessageTable& CalibrationMap::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 2, offsetof(CalibrationMap, map_points_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowSpan<float>, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 4, offsetof(CalibrationMap, intensities_bytes_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
 }  // namespace pb
 }  // namespace sdk
 }  // namespace horus
@@ -8,6 +8,7 @@
 /// Generated by `/opt/actions-runner/_work/horus/horus/common/tools/sdk/pb.ts`.
 
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -17,6 +18,7 @@
 #include "horus/pb/cow_span.h"
 #include "horus/pb/message.h"
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 #include "horus/strings/string_view.h"
 
 #if HORUS_SDK_USE_PB_NAMESPACE_ALIAS
@@ -73,6 +75,11 @@ class CalibrationMap final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -81,12 +88,23 @@ class CalibrationMap final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.CalibrationMap`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.CalibrationMap"; }
 
   /// The full name of the message: `horus.pb.CalibrationMap`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `CalibrationMap`, e.g. to build a `PbFieldMask<CalibrationMap>`.
+  enum class Field : PbTag {
+    /// Field `map_points`.
+    kMapPoints = 2,
+    /// Field `intensities_bytes`.
+    kIntensitiesBytes = 4,
+  };
+
   // Field `map_points` (no 2).
   // -----
 
@@ -187,6 +205,10 @@ class CalibrationMap final : public PbMessage {
     return std::move(set_intensities_bytes(std::move(intensities_bytes)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see map_points()
   CowSpan<float> map_points_{};
@@ -1,6 +1,9 @@
 #include "horus/pb/config/metadata_pb.h"
 
+#include <cstddef>
+
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 
 namespace horus {
 namespace sdk {
@@ -12,33 +15,21 @@ Vector2f::Vector2f(const Vector2f& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void Vector2f::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<float, PbDeserFlags::kFixed>(writer, /*tag=*/ 1, x_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<float, PbDeserFlags::kFixed>(writer, /*tag=*/ 2, y_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t Vector2f::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void Vector2f::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<float, PbDeserFlags::kFixed>(reader, x_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<float, PbDeserFlags::kFixed>(reader, y_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void Vector2f::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 Vector3f::Vector3f(const Vector3f& other) noexcept(false)
@@ -48,41 +39,21 @@ Vector3f::Vector3f(const Vector3f& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void Vector3f::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<float, PbDeserFlags::kFixed>(writer, /*tag=*/ 1, x_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<float, PbDeserFlags::kFixed>(writer, /*tag=*/ 2, y_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<float, PbDeserFlags::kFixed>(writer, /*tag=*/ 3, z_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t Vector3f::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void Vector3f::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<float, PbDeserFlags::kFixed>(reader, x_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<float, PbDeserFlags::kFixed>(reader, y_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<float, PbDeserFlags::kFixed>(reader, z_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void Vector3f::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 Quaterniond::Quaterniond(const Quaterniond& other) noexcept(false)
@@ -93,49 +64,21 @@ Quaterniond::Quaterniond(const Quaterniond& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void Quaterniond::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<double, PbDeserFlags::kFixed>(writer, /*tag=*/ 1, qw_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<double, PbDeserFlags::kFixed>(writer, /*tag=*/ 2, qx_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<double, PbDeserFlags::kFixed>(writer, /*tag=*/ 3, qy_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<double, PbDeserFlags::kFixed>(writer, /*tag=*/ 4, qz_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t Quaterniond::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void Quaterniond::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<double, PbDeserFlags::kFixed>(reader, qw_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<double, PbDeserFlags::kFixed>(reader, qx_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<double, PbDeserFlags::kFixed>(reader, qy_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<double, PbDeserFlags::kFixed>(reader, qz_);
-        set_fields_[3] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void Quaterniond::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 Range::Range(const Range& other) noexcept(false)
@@ -144,33 +87,21 @@ Range::Range(const Range& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void Range::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<double, PbDeserFlags::kFixed>(writer, /*tag=*/ 1, start_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<double, PbDeserFlags::kFixed>(writer, /*tag=*/ 2, end_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t Range::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void Range::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<double, PbDeserFlags::kFixed>(reader, start_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<double, PbDeserFlags::kFixed>(reader, end_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void Range::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 UInt32List::UInt32List(const UInt32List& other) noexcept(false)
@@ -178,25 +109,21 @@ UInt32List::UInt32List(const UInt32List& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void UInt32List::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowRepeated<std::uint32_t>>(writer, /*tag=*/ 1, values_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t UInt32List::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void UInt32List::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowRepeated<std::uint32_t>>(reader, values_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void UInt32List::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -207,33 +134,21 @@ Timestamp::Timestamp(const Timestamp& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void Timestamp::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::int64_t>(writer, /*tag=*/ 1, seconds_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::int32_t>(writer, /*tag=*/ 2, nanos_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t Timestamp::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void Timestamp::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::int64_t>(reader, seconds_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::int32_t>(reader, nanos_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void Timestamp::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 Duration::Duration(const Duration& other) noexcept(false)
@@ -242,33 +157,21 @@ Duration::Duration(const Duration& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void Duration::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::int64_t>(writer, /*tag=*/ 1, seconds_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::int32_t>(writer, /*tag=*/ 2, nanos_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t Duration::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void Duration::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::int64_t>(reader, seconds_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::int32_t>(reader, nanos_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void Duration::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 AffineTransform3f::AffineTransform3f(const AffineTransform3f& other) noexcept(false)
@@ -276,27 +179,143 @@ AffineTransform3f::AffineTransform3f(const AffineTransform3f& other) noexcept(fa
     , set_fields_{other.set_fields_} {}
 
 void AffineTransform3f::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowSpan<float>, PbDeserFlags::kFixed>(writer, /*tag=*/ 1, data_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t AffineTransform3f::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void AffineTransform3f::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowSpan<float>, PbDeserFlags::kFixed>(reader, data_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void AffineTransform3f::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
+}
+
+// MARK: Field tables
+
+// Messages are not standard-layout since they have a vtable, so `offsetof()` is only
+// conditionally-supported on them; it is supported by all compilers targeted by the SDK.
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
+const horus_internal::PbMessageTable& Vector2f::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(Vector2f, x_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<float, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 2, offsetof(Vector2f, y_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<float, PbDeserFlags::kFixed>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& Vector3f::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(Vector3f, x_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<float, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 2, offsetof(Vector3f, y_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<float, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 3, offsetof(Vector3f, z_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<float, PbDeserFlags::kFixed>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
 }
 
+const horus_internal::PbMessageTable& Quaterniond::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(Quaterniond, qw_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<double, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 2, offsetof(Quaterniond, qx_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<double, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 3, offsetof(Quaterniond, qy_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<double, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 4, offsetof(Quaterniond, qz_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<double, PbDeserFlags::kFixed>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& Range::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(Range, start_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<double, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 2, offsetof(Range, end_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<double, PbDeserFlags::kFixed>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& UInt32List::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(UInt32List, values_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<std::uint32_t>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& Timestamp::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(Timestamp, seconds_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::int64_t>::kOps},
+      {/*tag=*/ 2, offsetof(Timestamp, nanos_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::int32_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& Duration::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(Duration, seconds_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::int64_t>::kOps},
+      {/*tag=*/ 2, offsetof(Duration, nanos_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::int32_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& AffineTransform3f::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(AffineTransform3f, data_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowSpan<float>, PbDeserFlags::kFixed>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
 }  // namespace pb
 }  // namespace sdk
 }  // namespace horus
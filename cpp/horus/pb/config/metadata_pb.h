@@ -8,6 +8,7 @@
 /// Generated by `/opt/actions-runner/_work/horus/horus/common/tools/sdk/pb.ts`.
 
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -17,6 +18,7 @@
 #include "horus/pb/cow_span.h"
 #include "horus/pb/message.h"
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 #include "horus/pb/types.h"
 #include "horus/strings/string_view.h"
 
@@ -95,6 +97,11 @@ class Vector2f final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -103,12 +110,23 @@ class Vector2f final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.Vector2f`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.Vector2f"; }
 
   /// The full name of the message: `horus.pb.Vector2f`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `Vector2f`, e.g. to build a `PbFieldMask<Vector2f>`.
+  enum class Field : PbTag {
+    /// Field `x`.
+    kX = 1,
+    /// Field `y`.
+    kY = 2,
+  };
+
   // Field `x` (no 1).
   // -----
 
@@ -185,6 +203,10 @@ class Vector2f final : public PbMessage {
     return std::move(set_y(y));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see x()
   float x_{};
@@ -233,6 +255,11 @@ class Vector3f final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -241,12 +268,25 @@ class Vector3f final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.Vector3f`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.Vector3f"; }
 
   /// The full name of the message: `horus.pb.Vector3f`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `Vector3f`, e.g. to build a `PbFieldMask<Vector3f>`.
+  enum class Field : PbTag {
+    /// Field `x`.
+    kX = 1,
+    /// Field `y`.
+    kY = 2,
+    /// Field `z`.
+    kZ = 3,
+  };
+
   // Field `x` (no 1).
   // -----
 
@@ -361,6 +401,10 @@ class Vector3f final : public PbMessage {
     return std::move(set_z(z));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see x()
   float x_{};
@@ -411,6 +455,11 @@ class Quaterniond final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -419,12 +468,27 @@ class Quaterniond final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.Quaterniond`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.Quaterniond"; }
 
   /// The full name of the message: `horus.pb.Quaterniond`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `Quaterniond`, e.g. to build a `PbFieldMask<Quaterniond>`.
+  enum class Field : PbTag {
+    /// Field `qw`.
+    kQw = 1,
+    /// Field `qx`.
+    kQx = 2,
+    /// Field `qy`.
+    kQy = 3,
+    /// Field `qz`.
+    kQz = 4,
+  };
+
   // Field `qw` (no 1).
   // -----
 
@@ -577,6 +641,10 @@ class Quaterniond final : public PbMessage {
     return std::move(set_qz(qz));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see qw()
   double qw_{};
@@ -630,6 +698,11 @@ class Range final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -638,12 +711,23 @@ class Range final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.Range`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.Range"; }
 
   /// The full name of the message: `horus.pb.Range`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `Range`, e.g. to build a `PbFieldMask<Range>`.
+  enum class Field : PbTag {
+    /// Field `start`.
+    kStart = 1,
+    /// Field `end`.
+    kEnd = 2,
+  };
+
   // Field `start` (no 1).
   // -----
 
@@ -720,6 +804,10 @@ class Range final : public PbMessage {
     return std::move(set_end(end));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see start()
   double start_{};
@@ -769,6 +857,11 @@ class UInt32List final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -777,12 +870,21 @@ class UInt32List final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.UInt32List`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.UInt32List"; }
 
   /// The full name of the message: `horus.pb.UInt32List`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `UInt32List`, e.g. to build a `PbFieldMask<UInt32List>`.
+  enum class Field : PbTag {
+    /// Field `values`.
+    kValues = 1,
+  };
+
   // Field `values` (no 1).
   // -----
 
@@ -833,6 +935,10 @@ class UInt32List final : public PbMessage {
     return std::move(set_values(std::move(values)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see values()
   CowRepeated<std::uint32_t> values_{};
@@ -882,6 +988,9 @@ class Vector2dList final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -892,6 +1001,9 @@ class Vector2dList final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.Vector2dList`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.Vector2dList"; }
 
@@ -946,6 +1058,11 @@ class Timestamp final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -954,12 +1071,23 @@ class Timestamp final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.Timestamp`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.Timestamp"; }
 
   /// The full name of the message: `horus.pb.Timestamp`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `Timestamp`, e.g. to build a `PbFieldMask<Timestamp>`.
+  enum class Field : PbTag {
+    /// Field `seconds`.
+    kSeconds = 1,
+    /// Field `nanos`.
+    kNanos = 2,
+  };
+
   // Field `seconds` (no 1).
   // -----
 
@@ -1038,6 +1166,10 @@ class Timestamp final : public PbMessage {
     return std::move(set_nanos(nanos));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see seconds()
   std::int64_t seconds_{};
@@ -1090,6 +1222,11 @@ class Duration final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1098,12 +1235,23 @@ class Duration final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.Duration`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.Duration"; }
 
   /// The full name of the message: `horus.pb.Duration`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `Duration`, e.g. to build a `PbFieldMask<Duration>`.
+  enum class Field : PbTag {
+    /// Field `seconds`.
+    kSeconds = 1,
+    /// Field `nanos`.
+    kNanos = 2,
+  };
+
   // Field `seconds` (no 1).
   // -----
 
@@ -1180,6 +1328,10 @@ class Duration final : public PbMessage {
     return std::move(set_nanos(nanos));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see seconds()
   std::int64_t seconds_{};
@@ -1230,6 +1382,11 @@ class AffineTransform3f final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1238,12 +1395,21 @@ class AffineTransform3f final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.AffineTransform3f`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.AffineTransform3f"; }
 
   /// The full name of the message: `horus.pb.AffineTransform3f`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `AffineTransform3f`, e.g. to build a `PbFieldMask<AffineTransform3f>`.
+  enum class Field : PbTag {
+    /// Field `data`.
+    kData = 1,
+  };
+
   // Field `data` (no 1).
   // -----
 
@@ -1294,6 +1460,10 @@ class AffineTransform3f final : public PbMessage {
     return std::move(set_data(std::move(data)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see data()
   CowSpan<float> data_{};
@@ -1343,6 +1513,11 @@ class PbTraits<horus::sdk::pb::RepeatedMessageStatus> final {
     writer.Writer().add_enum(tag, static_cast<PbEnum>(value));
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, horus::sdk::pb::RepeatedMessageStatus value) noexcept {
+    return PbTraits<PbEnum>::ByteSize(tag, static_cast<PbEnum>(value));
+  }
+
   /// Deserializes `horus::sdk::pb::RepeatedMessageStatus` from `reader`.
   static horus::sdk::pb::RepeatedMessageStatus Deserialize(PbReader& reader) {
     return PbEnumTraits<horus::sdk::pb::RepeatedMessageStatus>::ValueOf(reader.Reader().get_enum());
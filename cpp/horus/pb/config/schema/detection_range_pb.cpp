@@ -1,6 +1,9 @@
 #include "horus/pb/config/schema/detection_range_pb.h"
 
+#include <cstddef>
+
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 
 namespace horus {
 namespace sdk {
@@ -13,43 +16,52 @@ DetectionRange::DetectionRange(const DetectionRange& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void DetectionRange::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<Range>(writer, /*tag=*/ 1, x_range_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<Range>(writer, /*tag=*/ 2, y_range_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<Range>(writer, /*tag=*/ 3, z_range_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t DetectionRange::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void DetectionRange::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<Range>(reader, x_range_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<Range>(reader, y_range_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<Range>(reader, z_range_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void DetectionRange::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
+// MARK: Field tables
+
+// Messages are not standard-layout since they have a vtable, so `offsetof()` is only
+// conditionally-supported on them; it is supported by all compilers targeted by the SDK.
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
+const horus_internal::PbMessageTable& DetectionRange::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(DetectionRange, x_range_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Range>>::kOps},
+      {/*tag=*/ 2, offsetof(DetectionRange, y_range_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Range>>::kOps},
+      {/*tag=*/ 3, offsetof(DetectionRange, z_range_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Range>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
 }  // namespace pb
 }  // namespace sdk
 }  // namespace horus
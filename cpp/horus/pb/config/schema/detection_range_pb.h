@@ -8,14 +8,17 @@
 /// Generated by `/opt/actions-runner/_work/horus/horus/common/tools/sdk/pb.ts`.
 
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
 #include "horus/attributes.h"
 #include "horus/internal/attributes.h"
 #include "horus/pb/config/metadata_pb.h"
+#include "horus/pb/lazy.h"
 #include "horus/pb/message.h"
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 #include "horus/strings/string_view.h"
 
 #if HORUS_SDK_USE_PB_NAMESPACE_ALIAS
@@ -72,6 +75,11 @@ class DetectionRange final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -80,20 +88,37 @@ class DetectionRange final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.DetectionRange`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.DetectionRange"; }
 
   /// The full name of the message: `horus.pb.DetectionRange`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `DetectionRange`, e.g. to build a `PbFieldMask<DetectionRange>`.
+  enum class Field : PbTag {
+    /// Field `x_range`.
+    kXRange = 1,
+    /// Field `y_range`.
+    kYRange = 2,
+    /// Field `z_range`.
+    kZRange = 3,
+  };
+
   // Field `x_range` (no 1).
   // -----
 
   /// / The x-axis range for detection.
   ///
   /// Field no: 1.
-  constexpr const Range& x_range() const& noexcept HORUS_LIFETIME_BOUND {
-    return x_range_;
+  ///
+  /// If `x_range` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `x_range` was received and is not a valid message.
+  const Range& x_range() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return x_range_.Ref();
   }
 
   /// If `x_range` is set, moves it out of the message (without marking it as unset).
@@ -101,19 +126,23 @@ class DetectionRange final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  Range x_range() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `x_range` was received and is not a valid message.
+  Range x_range() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(x_range_);
+    return std::move(x_range_).Take();
   }
 
   /// / The x-axis range for detection.
   ///
   /// Field no: 1.
-  Range& mutable_x_range() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `x_range` was received and is not a valid message.
+  Range& mutable_x_range() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return x_range_;
+    return x_range_.Mutable();
   }
 
   /// Returns whether `x_range` (no 1) is set.
@@ -122,13 +151,13 @@ class DetectionRange final : public PbMessage {
   /// Clears `x_range` (no 1).
   void clear_x_range() & noexcept {
     set_fields_[0] = false;
-    x_range_ = {};
+    x_range_.Clear();
   }
 
   /// Sets `x_range` (no 1) and returns `*this`.
   DetectionRange& set_x_range(Range&& x_range) & noexcept {
     set_fields_[0] = true;
-    x_range_ = std::move(x_range);
+    x_range_.Set(std::move(x_range));
     return *this;
   }
   /// Sets `x_range` (no 1) and returns `*this`.
@@ -142,8 +171,12 @@ class DetectionRange final : public PbMessage {
   /// / The y-axis range for detection.
   ///
   /// Field no: 2.
-  constexpr const Range& y_range() const& noexcept HORUS_LIFETIME_BOUND {
-    return y_range_;
+  ///
+  /// If `y_range` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `y_range` was received and is not a valid message.
+  const Range& y_range() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return y_range_.Ref();
   }
 
   /// If `y_range` is set, moves it out of the message (without marking it as unset).
@@ -151,19 +184,23 @@ class DetectionRange final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  Range y_range() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `y_range` was received and is not a valid message.
+  Range y_range() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(y_range_);
+    return std::move(y_range_).Take();
   }
 
   /// / The y-axis range for detection.
   ///
   /// Field no: 2.
-  Range& mutable_y_range() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `y_range` was received and is not a valid message.
+  Range& mutable_y_range() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return y_range_;
+    return y_range_.Mutable();
   }
 
   /// Returns whether `y_range` (no 2) is set.
@@ -172,13 +209,13 @@ class DetectionRange final : public PbMessage {
   /// Clears `y_range` (no 2).
   void clear_y_range() & noexcept {
     set_fields_[1] = false;
-    y_range_ = {};
+    y_range_.Clear();
   }
 
   /// Sets `y_range` (no 2) and returns `*this`.
   DetectionRange& set_y_range(Range&& y_range) & noexcept {
     set_fields_[1] = true;
-    y_range_ = std::move(y_range);
+    y_range_.Set(std::move(y_range));
     return *this;
   }
   /// Sets `y_range` (no 2) and returns `*this`.
@@ -192,8 +229,12 @@ class DetectionRange final : public PbMessage {
   /// / The z-axis range for detection.
   ///
   /// Field no: 3.
-  constexpr const Range& z_range() const& noexcept HORUS_LIFETIME_BOUND {
-    return z_range_;
+  ///
+  /// If `z_range` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `z_range` was received and is not a valid message.
+  const Range& z_range() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return z_range_.Ref();
   }
 
   /// If `z_range` is set, moves it out of the message (without marking it as unset).
@@ -201,19 +242,23 @@ class DetectionRange final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 3.
-  Range z_range() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `z_range` was received and is not a valid message.
+  Range z_range() && noexcept(false) {
     if (!set_fields_[2]) {
       return {};
     }
-    return std::move(z_range_);
+    return std::move(z_range_).Take();
   }
 
   /// / The z-axis range for detection.
   ///
   /// Field no: 3.
-  Range& mutable_z_range() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `z_range` was received and is not a valid message.
+  Range& mutable_z_range() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[2] = true;
-    return z_range_;
+    return z_range_.Mutable();
   }
 
   /// Returns whether `z_range` (no 3) is set.
@@ -222,13 +267,13 @@ class DetectionRange final : public PbMessage {
   /// Clears `z_range` (no 3).
   void clear_z_range() & noexcept {
     set_fields_[2] = false;
-    z_range_ = {};
+    z_range_.Clear();
   }
 
   /// Sets `z_range` (no 3) and returns `*this`.
   DetectionRange& set_z_range(Range&& z_range) & noexcept {
     set_fields_[2] = true;
-    z_range_ = std::move(z_range);
+    z_range_.Set(std::move(z_range));
     return *this;
   }
   /// Sets `z_range` (no 3) and returns `*this`.
@@ -236,13 +281,17 @@ class DetectionRange final : public PbMessage {
     return std::move(set_z_range(std::move(z_range)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see x_range()
-  Range x_range_{};
+  PbLazy<Range> x_range_{};
   /// @see y_range()
-  Range y_range_{};
+  PbLazy<Range> y_range_{};
   /// @see z_range()
-  Range z_range_{};
+  PbLazy<Range> z_range_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<3> set_fields_;
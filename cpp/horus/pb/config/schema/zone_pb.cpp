@@ -1,6 +1,9 @@
 #include "horus/pb/config/schema/zone_pb.h"
 
+#include <cstddef>
+
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 
 namespace horus {
 namespace sdk {
@@ -16,67 +19,61 @@ Zone::Zone(const Zone& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void Zone::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, zone_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<RepeatedMessageStatus>(writer, /*tag=*/ 2, status_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<ZoneType>(writer, /*tag=*/ 3, type_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 4, name_);
-  }
-  if (set_fields_[4]) {
-    SerializeField<Range>(writer, /*tag=*/ 5, z_range_);
-  }
-  if (set_fields_[5]) {
-    SerializeField<Vector2dList>(writer, /*tag=*/ 6, vertices_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t Zone::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void Zone::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, zone_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<RepeatedMessageStatus>(reader, status_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<ZoneType>(reader, type_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<CowBytes>(reader, name_);
-        set_fields_[3] = true;
-        break;
-      }
-      case 5: {
-        DeserializeField<Range>(reader, z_range_);
-        set_fields_[4] = true;
-        break;
-      }
-      case 6: {
-        DeserializeField<Vector2dList>(reader, vertices_);
-        set_fields_[5] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void Zone::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
+// MARK: Field tables
+
+// Messages are not standard-layout since they have a vtable, so `offsetof()` is only
+// conditionally-supported on them; it is supported by all compilers targeted by the SDK.
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
+const horus_internal::PbMessageTable& Zone::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(Zone, zone_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(Zone, status_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<RepeatedMessageStatus>::kOps},
+      {/*tag=*/ 3, offsetof(Zone, type_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<ZoneType>::kOps},
+      {/*tag=*/ 4, offsetof(Zone, name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 5, offsetof(Zone, z_range_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Range>>::kOps},
+      {/*tag=*/ 6, offsetof(Zone, vertices_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Vector2dList>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
 }  // namespace pb
 }  // namespace sdk
 }  // namespace horus
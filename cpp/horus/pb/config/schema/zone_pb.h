@@ -8,6 +8,7 @@
 /// Generated by `/opt/actions-runner/_work/horus/horus/common/tools/sdk/pb.ts`.
 
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -15,8 +16,10 @@
 #include "horus/internal/attributes.h"
 #include "horus/pb/config/metadata_pb.h"
 #include "horus/pb/cow_bytes.h"
+#include "horus/pb/lazy.h"
 #include "horus/pb/message.h"
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 #include "horus/pb/types.h"
 #include "horus/strings/string_view.h"
 
@@ -97,6 +100,11 @@ class Zone final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -105,12 +113,31 @@ class Zone final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.Zone`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.Zone"; }
 
   /// The full name of the message: `horus.pb.Zone`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `Zone`, e.g. to build a `PbFieldMask<Zone>`.
+  enum class Field : PbTag {
+    /// Field `zone_id`.
+    kZoneId = 1,
+    /// Field `status`.
+    kStatus = 2,
+    /// Field `type`.
+    kType = 3,
+    /// Field `name`.
+    kName = 4,
+    /// Field `z_range`.
+    kZRange = 5,
+    /// Field `vertices`.
+    kVertices = 6,
+  };
+
   // Field `zone_id` (no 1).
   // -----
 
@@ -293,8 +320,12 @@ class Zone final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 5.
-  constexpr const Range& z_range() const& noexcept HORUS_LIFETIME_BOUND {
-    return z_range_;
+  ///
+  /// If `z_range` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `z_range` was received and is not a valid message.
+  const Range& z_range() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return z_range_.Ref();
   }
 
   /// If `z_range` is set, moves it out of the message (without marking it as unset).
@@ -302,19 +333,23 @@ class Zone final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 5.
-  Range z_range() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `z_range` was received and is not a valid message.
+  Range z_range() && noexcept(false) {
     if (!set_fields_[4]) {
       return {};
     }
-    return std::move(z_range_);
+    return std::move(z_range_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 5.
-  Range& mutable_z_range() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `z_range` was received and is not a valid message.
+  Range& mutable_z_range() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[4] = true;
-    return z_range_;
+    return z_range_.Mutable();
   }
 
   /// Returns whether `z_range` (no 5) is set.
@@ -323,13 +358,13 @@ class Zone final : public PbMessage {
   /// Clears `z_range` (no 5).
   void clear_z_range() & noexcept {
     set_fields_[4] = false;
-    z_range_ = {};
+    z_range_.Clear();
   }
 
   /// Sets `z_range` (no 5) and returns `*this`.
   Zone& set_z_range(Range&& z_range) & noexcept {
     set_fields_[4] = true;
-    z_range_ = std::move(z_range);
+    z_range_.Set(std::move(z_range));
     return *this;
   }
   /// Sets `z_range` (no 5) and returns `*this`.
@@ -343,8 +378,12 @@ class Zone final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 6.
-  constexpr const Vector2dList& vertices() const& noexcept HORUS_LIFETIME_BOUND {
-    return vertices_;
+  ///
+  /// If `vertices` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `vertices` was received and is not a valid message.
+  const Vector2dList& vertices() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return vertices_.Ref();
   }
 
   /// If `vertices` is set, moves it out of the message (without marking it as unset).
@@ -352,19 +391,23 @@ class Zone final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 6.
-  Vector2dList vertices() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `vertices` was received and is not a valid message.
+  Vector2dList vertices() && noexcept(false) {
     if (!set_fields_[5]) {
       return {};
     }
-    return std::move(vertices_);
+    return std::move(vertices_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 6.
-  Vector2dList& mutable_vertices() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `vertices` was received and is not a valid message.
+  Vector2dList& mutable_vertices() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[5] = true;
-    return vertices_;
+    return vertices_.Mutable();
   }
 
   /// Returns whether `vertices` (no 6) is set.
@@ -373,13 +416,13 @@ class Zone final : public PbMessage {
   /// Clears `vertices` (no 6).
   void clear_vertices() & noexcept {
     set_fields_[5] = false;
-    vertices_ = {};
+    vertices_.Clear();
   }
 
   /// Sets `vertices` (no 6) and returns `*this`.
   Zone& set_vertices(Vector2dList&& vertices) & noexcept {
     set_fields_[5] = true;
-    vertices_ = std::move(vertices);
+    vertices_.Set(std::move(vertices));
     return *this;
   }
   /// Sets `vertices` (no 6) and returns `*this`.
@@ -387,6 +430,10 @@ class Zone final : public PbMessage {
     return std::move(set_vertices(std::move(vertices)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see zone_id()
   CowBytes zone_id_{};
@@ -397,9 +444,9 @@ class Zone final : public PbMessage {
   /// @see name()
   CowBytes name_{};
   /// @see z_range()
-  Range z_range_{};
+  PbLazy<Range> z_range_{};
   /// @see vertices()
-  Vector2dList vertices_{};
+  PbLazy<Vector2dList> vertices_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<6> set_fields_;
@@ -506,6 +553,11 @@ class PbTraits<horus::sdk::pb::ZoneType> final {
     writer.Writer().add_enum(tag, static_cast<PbEnum>(value));
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, horus::sdk::pb::ZoneType value) noexcept {
+    return PbTraits<PbEnum>::ByteSize(tag, static_cast<PbEnum>(value));
+  }
+
   /// Deserializes `horus::sdk::pb::ZoneType` from `reader`.
   static horus::sdk::pb::ZoneType Deserialize(PbReader& reader) {
     return PbEnumTraits<horus::sdk::pb::ZoneType>::ValueOf(reader.Reader().get_enum());
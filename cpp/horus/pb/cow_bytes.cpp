@@ -67,4 +67,13 @@ PbView CowBytes::View() && noexcept {
   HORUS_ONEOF_RETURN_NOT_HANDLED;
 }
 
+void CowBytes::Clear() noexcept {
+  Owned* const owned{data_.TryAs<Owned>()};
+  if (owned != nullptr) {
+    owned->clear();
+  } else {
+    static_cast<void>(data_.Emplace<PbView>(PbBuffer{}));
+  }
+}
+
 }  // namespace horus
@@ -92,6 +92,13 @@ class CowBytes final {
   /// Returns a view of the stored bytes.
   PbView View() && noexcept;
 
+  /// Returns the `PbView` of the stored bytes if they are not owned, and null otherwise.
+  const PbView* TryView() const noexcept HORUS_LIFETIME_BOUND { return data_.TryAs<PbView>(); }
+
+  /// Empties the container. If its bytes are owned, their buffer is kept so that they can be
+  /// refilled without allocating.
+  void Clear() noexcept;
+
  private:
   /// Constructs a `CowBytes` which refers to a borrowed string.
   explicit CowBytes(StringView borrowed) noexcept
@@ -106,9 +113,18 @@ class PbTraits<CowBytes> final {
  public:
   /// Serializes `value` into `writer`.
   static void Serialize(PbWriter& writer, PbTag tag, const CowBytes& value) {
+    const PbView* const view{value.TryView()};
+    if (view != nullptr && writer.TryAddReference(tag, *view)) {
+      return;
+    }
     writer.Writer().add_bytes(tag, value.Str().data(), value.Str().size());
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static std::size_t ByteSize(PbTag tag, const CowBytes& value) noexcept {
+    return horus_internal::PbLengthDelimitedSize(tag, value.Str().size());
+  }
+
   /// Deserializes a `CowBytes` from `reader`.
   static CowBytes Deserialize(PbReader& reader) {
     return CowBytes{reader.View(reader.Reader().get_view())};
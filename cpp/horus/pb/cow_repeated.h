@@ -5,14 +5,19 @@
 #ifndef HORUS_PB_COW_REPEATED_H_
 #define HORUS_PB_COW_REPEATED_H_
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <protozero/data_view.hpp>
 #include <protozero/exception.hpp>
 #include <protozero/iterators.hpp>
 #include <protozero/pbf_reader.hpp>
+#include <protozero/types.hpp>
 #include <protozero/varint.hpp>
 #include <stdexcept>
 #include <type_traits>
@@ -23,29 +28,147 @@
 #include "horus/internal/type_traits.h"
 #include "horus/pb/buffer.h"
 #include "horus/pb/cow.h"
-#include "horus/pb/repeated_iterator.h"
 #include "horus/pb/serialize.h"
 #include "horus/pb/types.h"
+#include "horus/pb/varint.h"
 #include "horus/pointer/arithmetic.h"
 #include "horus/pointer/unsafe_cast.h"
 #include "horus/strings/string_view.h"
 #include "horus/types/in_place.h"
 #include "horus/types/one_of.h"
+#include "horus/types/span.h"
 
 namespace horus {
 namespace horus_internal {
 
+/// The location of the value of a length-delimited field in a `PbView`.
+struct PbItemRange final {
+  /// The offset of the value in the view.
+  std::size_t offset{0};
+  /// The size of the value.
+  std::size_t size{0};
+};
+
+/// The locations of the values of all the fields with a given tag in a `PbView`, in order.
+using PbItemIndex = std::vector<PbItemRange>;
+
 /// A `PbView` and a `PbTag`.
 struct PbViewAndTag {
   /// Constructs the struct.
   PbViewAndTag(PbView&& view_p, PbTag tag_p) noexcept : view{std::move(view_p)}, tag{tag_p} {}
 
+  /// Copy constructor, which shares the index of `other`. `other` may concurrently build its
+  /// index.
+  PbViewAndTag(const PbViewAndTag& other) noexcept
+      : view{other.view}, tag{other.tag}, index_{std::atomic_load(&other.index_)} {}
+
+  /// Copy assignment operator, which shares the index of `other`. `other` may concurrently build
+  /// its index.
+  PbViewAndTag& operator=(const PbViewAndTag& other) noexcept {
+    if (&other != this) {
+      view = other.view;
+      tag = other.tag;
+      std::atomic_store(&index_, std::atomic_load(&other.index_));
+    }
+    return *this;
+  }
+
+  /// Move constructor.
+  PbViewAndTag(PbViewAndTag&&) noexcept = default;
+  /// Move assignment operator.
+  PbViewAndTag& operator=(PbViewAndTag&&) noexcept = default;
+
+  /// Destructor.
+  ~PbViewAndTag() noexcept = default;
+
+  /// Returns the index of the fields with the `tag` in `view`, building it on first use.
+  ///
+  /// The index is shared by copies of the struct, and can safely be built concurrently from
+  /// several threads.
+  ///
+  /// @throws std::bad_alloc If the index cannot be allocated.
+  /// @throws protozero::exception If `view` is not a valid message (which is not checked again if
+  /// `view` was checked by `PbView::Validate()`).
+  const PbItemIndex& Index() const noexcept(false);
+
+  /// Discards the index built by `Index()`. Must be called when `view` or `tag` are modified.
+  void ResetIndex() noexcept { std::atomic_store(&index_, std::shared_ptr<const PbItemIndex>{}); }
+
   /// The view of the data.
   PbView view;
   /// The tag of the field of interest.
   PbTag tag{};
+
+ private:
+  /// @see Index()
+  mutable std::shared_ptr<const PbItemIndex> index_;
 };
 
+/// Appends the locations of the values of the fields with the given `tag` in `data`, a sequence of
+/// fields checked by `PbView::Validate()`, to `index`.
+///
+/// Since `data` is valid, it is scanned without bounds checks.
+inline void IndexValidatedItems(StringView data, PbTag tag, PbItemIndex& index) noexcept(false) {
+  const char* pos{data.data()};
+  const char* const end{PointerAdd(data.data(), data.size())};
+  while (pos != end) {
+    const std::uint64_t key{DecodeUncheckedVarint(pos)};
+    switch (static_cast<protozero::pbf_wire_type>(key & 0x07U)) {
+      case protozero::pbf_wire_type::varint: {
+        static_cast<void>(DecodeUncheckedVarint(pos));
+        break;
+      }
+      case protozero::pbf_wire_type::fixed64: {
+        pos = PointerAdd(pos, sizeof(std::uint64_t));
+        break;
+      }
+      case protozero::pbf_wire_type::fixed32: {
+        pos = PointerAdd(pos, sizeof(std::uint32_t));
+        break;
+      }
+      case protozero::pbf_wire_type::length_delimited: {
+        const std::size_t size{static_cast<std::size_t>(DecodeUncheckedVarint(pos))};
+        if ((key >> 3U) == tag) {
+          index.push_back(PbItemRange{PointerDist(data.data(), pos), size});
+        }
+        pos = PointerAdd(pos, size);
+        break;
+      }
+      case protozero::pbf_wire_type::unknown:
+      default: {
+        // Rejected by `PbView::Validate()`.
+        assert(false);
+        return;
+      }
+    }
+  }
+}
+
+inline const PbItemIndex& PbViewAndTag::Index() const noexcept(false) {
+  std::shared_ptr<const PbItemIndex> index{std::atomic_load(&index_)};
+  if (index != nullptr) {
+    return *index;
+  }
+  std::shared_ptr<PbItemIndex> new_index{std::make_shared<PbItemIndex>()};
+  const StringView data{view.Str()};
+  if (view.IsValidated()) {
+    IndexValidatedItems(data, tag, *new_index);
+  } else {
+    protozero::pbf_reader reader{data.data(), data.size()};
+    while (reader.next(tag)) {
+      const protozero::data_view value{reader.get_view()};
+      new_index->push_back(
+          PbItemRange{static_cast<std::size_t>(value.data() - data.data()), value.size()});
+    }
+  }
+  // If another thread built the index concurrently, keep the first one stored.
+  if (std::atomic_compare_exchange_strong(&index_, &index,
+                                          std::shared_ptr<const PbItemIndex>{new_index})) {
+    return *new_index;
+  }
+  return *index;
+}
+
 /// A wrapper around a `std::vector<std::uint8_t>` which acts like a `std::vector<bool>` (with no
 /// bitset-like semantics).
 class VectorBool final {
@@ -72,6 +195,8 @@ class VectorBool final {
 
   /// Returns a pointer to the first bool.
   const bool* data() const noexcept { return UnsafePointerCast<const bool>(inner_.data()); }
+  /// Returns a pointer to the first bool.
+  bool* data() noexcept { return UnsafePointerCast<bool>(inner_.data()); }
   /// Returns the size of the vector.
   std::size_t size() const noexcept { return inner_.size(); }
   /// Returns whether the vector is empty.
@@ -84,10 +209,14 @@ class VectorBool final {
 
   /// Reserves space for `capacity` booleans.
   void reserve(std::size_t capacity) noexcept(false) { inner_.reserve(capacity); }
+  /// Resizes the vector to `size` booleans, adding `false` values if it grows.
+  void resize(std::size_t size) noexcept(false) { inner_.resize(size); }
   /// Adds a boolean to the end of the vector.
   void push_back(bool value) noexcept(false) { inner_.push_back(Bool{value}); }
   /// Adds a boolean to the end of the vector.
   void emplace_back(bool value) noexcept(false) { push_back(value); }
+  /// Removes all booleans from the vector, keeping its capacity.
+  void clear() noexcept { inner_.clear(); }
 
  private:
   /// A trivial wrapper around a `bool` used to obtain a non-specialized `std::vector<Bool>`.
@@ -125,8 +254,10 @@ class CowRepeated<T, /*kPacked=*/true> final {
  public:
   /// Type of the iterator returned by `begin()` and `end()`.
   class const_iterator final {
-    /// Type of the inner `data_`.
-    using Data = OneOf<protozero::const_varint_iterator<T>, const T*>;
+    /// Type of the inner `data_`. Views checked by `PbView::Validate()` are iterated without bounds
+    /// checks.
+    using Data = OneOf<protozero::const_varint_iterator<T>, const T*,
+                       horus_internal::UncheckedVarintIterator<T>>;
 
    public:
     /// Iterator difference type.
@@ -175,7 +306,7 @@ class CowRepeated<T, /*kPacked=*/true> final {
         throw std::logic_error{
             "called lhs-rhs with iterators from different CowRepeated collections"};
       }
-      return lhs.data_.VisitConst([&rhs](auto iterator) noexcept -> bool {
+      return lhs.data_.VisitConst([&rhs](auto iterator) noexcept -> difference_type {
         return iterator - *rhs.data_.template TryAs<decltype(iterator)>();
       });
     }
@@ -220,6 +351,21 @@ class CowRepeated<T, /*kPacked=*/true> final {
   /// allocation failed.
   VectorT& Vector() noexcept(false) HORUS_LIFETIME_BOUND;
 
+  /// Empties the container. If its items are owned, their vector is kept so that it can be
+  /// refilled without allocating.
+  void Clear() noexcept {
+    VectorT* const owned{data_.template TryAs<VectorT>()};
+    if (owned != nullptr) {
+      owned->clear();
+    } else {
+      static_cast<void>(data_.template Emplace<VectorT>());
+    }
+  }
+
+  /// Copies the first items of the container to `out` without allocating, and returns the number
+  /// of copied items, i.e. the minimum of `size()` and `out.size()`.
+  std::size_t CopyTo(Span<T> out) const noexcept;
+
   /// Emplaces a new value at the end of the collection and returns a reference to it.
   template <class... Args>
   T& Add(Args&&... args) & noexcept(std::is_nothrow_constructible<T, Args...>::value) {
@@ -282,6 +428,11 @@ auto CowRepeated<T, /*kPacked=*/true>::const_iterator::DataFrom(const CowRepeate
       return Data{InPlaceType<const T*>, ptr};
     }
     HORUS_ONEOF_CASE(data, PbView) {
+      if (data.IsValidated()) {
+        const horus_internal::UncheckedVarintIterator<T> iterator{is_end ? data.Str().end()
+                                                                         : data.Str().begin()};
+        return Data{InPlaceType<horus_internal::UncheckedVarintIterator<T>>, iterator};
+      }
       const protozero::const_varint_iterator<T> iterator{
           is_end ? data.Str().end() : data.Str().begin(), data.Str().end()};
       return Data{InPlaceType<protozero::const_varint_iterator<T>>, iterator};
@@ -294,14 +445,7 @@ template <class T>
 std::size_t CowRepeated<T, /*kPacked=*/true>::size() const noexcept {
   HORUS_ONEOF_SWITCH(data_) {
     HORUS_ONEOF_CASE(data, VectorT) { return data.size(); }
-    HORUS_ONEOF_CASE(view, PbView) {
-      const StringView data{view.Str()};
-      const protozero::iterator_range<protozero::const_varint_iterator<T>> range{
-          protozero::const_varint_iterator<T>{data.data(), data.end()},
-          protozero::const_varint_iterator<T>{data.end(), data.end()},
-      };
-      return range.size();
-    }
+    HORUS_ONEOF_CASE(view, PbView) { return horus_internal::CountVarints(view.Str()); }
   }
   HORUS_ONEOF_RETURN_NOT_HANDLED;
 }
@@ -322,14 +466,28 @@ auto CowRepeated<T, /*kPacked=*/true>::Vector() noexcept(false) -> VectorT& {
   if (data_.template Is<VectorT>()) {
     return *data_.template TryAs<VectorT>();
   }
+  const StringView data{data_.template TryAs<PbView>()->Str()};
   VectorT result;
-  result.reserve(size());
-  for (const T value : *this) {
-    result.push_back(value);
-  }
+  result.resize(horus_internal::CountVarints(data));
+  result.resize(horus_internal::DecodePackedVarints(data, result.data(), result.size()));
   return data_.template Emplace<VectorT>(std::move(result));
 }
 
+template <class T>
+std::size_t CowRepeated<T, /*kPacked=*/true>::CopyTo(Span<T> out) const noexcept {
+  HORUS_ONEOF_SWITCH(data_) {
+    HORUS_ONEOF_CASE(data, VectorT) {
+      const std::size_t count{std::min(data.size(), out.size())};
+      static_cast<void>(std::copy_n(data.data(), count, out.data()));
+      return count;
+    }
+    HORUS_ONEOF_CASE(view, PbView) {
+      return horus_internal::DecodePackedVarints(view.Str(), out.data(), out.size());
+    }
+  }
+  HORUS_ONEOF_RETURN_NOT_HANDLED;
+}
+
 namespace horus_internal {
 
 /// `add_packed_*` and `get_packed_*` functions for `T`.
@@ -386,8 +544,28 @@ class PbTraits<CowRepeated<T, /*kPacked=*/true>> final {
  public:
   /// Serializes `value` into `writer`.
   static void Serialize(PbWriter& writer, PbTag tag, const CowRepeated<T, true>& value) {
-    static constexpr auto kAdd = horus_internal::PackedFns<T>::kAddPacked;
-    (writer.Writer().*kAdd)(tag, value.begin(), value.end());
+    if (!writer.UsesCachedSizes()) {
+      static constexpr auto kAdd = horus_internal::PackedFns<T>::kAddPacked;
+      (writer.Writer().*kAdd)(tag, value.begin(), value.end());
+      return;
+    }
+    // Write the length prefix directly rather than letting protozero reserve space for it and move
+    // the items once their size is known.
+    const std::size_t length{PayloadSize(value)};
+    if (length == 0) {
+      return;
+    }
+    writer.Writer().add_length_varint(tag, static_cast<protozero::pbf_length_type>(length));
+    for (const T item : value) {
+      writer.Writer().add_varint(static_cast<std::uint64_t>(item));
+    }
+  }
+
+  /// Returns the number of bytes used to serialize `value`.
+  static std::size_t ByteSize(PbTag tag, const CowRepeated<T, true>& value) noexcept {
+    const std::size_t length{PayloadSize(value)};
+    // protozero does not write anything for empty packed fields.
+    return length == 0 ? 0 : horus_internal::PbLengthDelimitedSize(tag, length);
   }
 
   /// Deserializes a `CowRepeated` from `reader`.
@@ -402,42 +580,64 @@ class PbTraits<CowRepeated<T, /*kPacked=*/true>> final {
     // Skip items.
     static_cast<void>((reader.Reader().*kGet)());
     const char* const span_end{reader.Reader().data().data()};
-    const char* const buffer_start{reader.Buffer().Str().data()};
-    std::size_t const buffer_offset{static_cast<std::size_t>(span_start - buffer_start)};
-    std::size_t const buffer_len{static_cast<std::size_t>(span_end - span_start)};
+    std::size_t const span_len{static_cast<std::size_t>(span_end - span_start)};
+
+    return CowRepeated<T, true>{reader.FieldView(protozero::data_view{span_start, span_len})};
+  }
 
-    return CowRepeated<T, true>{PbBuffer{reader.Buffer()}.View(buffer_offset, buffer_len)};
+ private:
+  /// Returns the number of bytes used to encode the items of `value` as varints.
+  static std::size_t PayloadSize(const CowRepeated<T, true>& value) noexcept {
+    std::size_t length{0};
+    for (const T item : value) {
+      // Negative values are sign-extended to 64 bits, like protozero does.
+      length += horus_internal::PbVarintSize(static_cast<std::uint64_t>(item));
+    }
+    return length;
   }
 };
 
 // MARK: CowRepeated<T, kPacked = false>
 
+/// If the list references a `PbView`, an index of the location of its items is built the first time
+/// it is needed (by `size()`, `operator[]()`, `begin()`, etc) and shared by copies of the list, so
+/// that these operations take constant time.
 template <class T>
 class CowRepeated<T, /*kPacked=*/false> final {
   /// Type of the inner `data_`.
   using Data = OneOf<horus_internal::PbViewAndTag, std::vector<T>>;
 
  public:
-  /// Type of the iterator returned by `begin()` and `end()`.
+  /// Type of the random-access iterator returned by `begin()` and `end()`.
   class const_iterator final {
-    /// Type of the inner `data_`.
-    using Data = OneOf<PbRepeatedIterator<T>, const T*>;
-
    public:
+    /// Iterator category.
+    using iterator_category = std::random_access_iterator_tag;
     /// Iterator difference type.
     using difference_type = std::ptrdiff_t;
     /// Iterator value type.
     using value_type = Cow<T>;
+    /// Iterator reference type; items may be deserialized on access, so they are returned by value.
+    using reference = Cow<T>;
+    /// Iterator pointer type; unsupported.
+    using pointer = void;
+
+    /// Constructs an iterator which points to nothing.
+    const_iterator() noexcept = default;
 
     /// Constructs a `begin()` or `end()` iterator over the items in `container`.
-    const_iterator(const CowRepeated& container, bool is_end) noexcept
-        : data_{DataFrom(container, is_end)} {}
+    ///
+    /// @throws std::bad_alloc If the index of `container` cannot be allocated.
+    const_iterator(const CowRepeated& container, bool is_end) noexcept(false);
 
     /// Returns the current value.
-    Cow<T> operator*() const HORUS_LIFETIME_BOUND;
+    Cow<T> operator*() const HORUS_LIFETIME_BOUND { return (*this)[0]; }
+
+    /// Returns the value `offset` items after the current one.
+    Cow<T> operator[](difference_type offset) const HORUS_LIFETIME_BOUND;
 
     /// Advances to the next value (`++it`).
-    const_iterator& operator++() noexcept;
+    const_iterator& operator++() noexcept { return *this += 1; }
 
     /// Returns a copy of the current iterator and advances to the next value (`it++`).
     const_iterator operator++(std::int32_t /* unused */) noexcept {  // NOLINT(cert-dcl21-cpp)
@@ -446,40 +646,139 @@ class CowRepeated<T, /*kPacked=*/false> final {
       return result;
     }
 
-    /// Returns whether `lhs` and `rhs` are equal.
-    friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) noexcept {
-      if (lhs.data_.Tag() != rhs.data_.Tag()) {
-        return false;
+    /// Moves back to the previous value (`--it`).
+    const_iterator& operator--() noexcept { return *this -= 1; }
+
+    /// Returns a copy of the current iterator and moves back to the previous value (`it--`).
+    const_iterator operator--(std::int32_t /* unused */) noexcept {  // NOLINT(cert-dcl21-cpp)
+      const_iterator result{*this};
+      --*this;
+      return result;
+    }
+
+    /// Advances by `offset` values.
+    const_iterator& operator+=(difference_type offset) noexcept {
+      if (view_ == nullptr) {
+        item_ = Advance(item_, offset);
+      } else {
+        range_ = Advance(range_, offset);
       }
-      return lhs.data_.VisitConst([&rhs](auto iterator) noexcept -> bool {
-        return iterator == *rhs.data_.template TryAs<decltype(iterator)>();
-      });
+      return *this;
     }
 
-    /// Returns whether `lhs` and `rhs` are not equal.
-    friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs) noexcept {
-      return !(lhs == rhs);
+    /// Moves back by `offset` values.
+    const_iterator& operator-=(difference_type offset) noexcept { return *this += -offset; }
+
+    /// Returns an iterator `offset` values after `it`.
+    friend const_iterator operator+(const_iterator it, difference_type offset) noexcept {
+      return it += offset;
+    }
+
+    /// Returns an iterator `offset` values after `it`.
+    friend const_iterator operator+(difference_type offset, const_iterator it) noexcept {
+      return it += offset;
+    }
+
+    /// Returns an iterator `offset` values before `it`.
+    friend const_iterator operator-(const_iterator it, difference_type offset) noexcept {
+      return it -= offset;
     }
 
     /// Returns the number of elements between `lhs` and `rhs`.
+    ///
+    /// @throws std::logic_error If `lhs` and `rhs` come from different collections.
     friend difference_type operator-(const const_iterator& lhs,
                                      const const_iterator& rhs) noexcept(false) {
-      if (lhs.data_.Tag() != rhs.data_.Tag()) {
+      if (lhs.view_ != rhs.view_) {
         throw std::logic_error{
             "called 'lhs - rhs' with iterators from different CowRepeated collections"};
       }
-      return lhs.data_.VisitConst([&rhs](auto iterator) noexcept -> bool {
-        return iterator - *rhs.data_.template TryAs<decltype(iterator)>();
-      });
+      return lhs.view_ == nullptr ? PointerDiff(lhs.item_, rhs.item_)
+                                  : PointerDiff(lhs.range_, rhs.range_);
+    }
+
+    /// Returns whether `lhs` and `rhs` are equal.
+    friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) noexcept {
+      return lhs.item_ == rhs.item_ && lhs.range_ == rhs.range_;
+    }
+
+    /// Returns whether `lhs` and `rhs` are not equal.
+    friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs) noexcept {
+      return !(lhs == rhs);
+    }
+
+    /// Returns whether `lhs` points before `rhs`, which must come from the same collection.
+    friend bool operator<(const const_iterator& lhs, const const_iterator& rhs) noexcept {
+      return lhs.view_ == nullptr ? lhs.item_ < rhs.item_ : lhs.range_ < rhs.range_;
+    }
+
+    /// Returns whether `lhs` points after `rhs`, which must come from the same collection.
+    friend bool operator>(const const_iterator& lhs, const const_iterator& rhs) noexcept {
+      return rhs < lhs;
+    }
+
+    /// Returns whether `lhs` does not point after `rhs`, which must come from the same collection.
+    friend bool operator<=(const const_iterator& lhs, const const_iterator& rhs) noexcept {
+      return !(rhs < lhs);
+    }
+
+    /// Returns whether `lhs` does not point before `rhs`, which must come from the same
+    /// collection.
+    friend bool operator>=(const const_iterator& lhs, const const_iterator& rhs) noexcept {
+      return !(lhs < rhs);
     }
 
    private:
-    /// Returns the value of `Data` given these constructor arguments.
-    static Data DataFrom(const CowRepeated& container, bool is_end) noexcept;
+    /// Returns `ptr + offset`.
+    template <class U>
+    static U* Advance(U* ptr, difference_type offset) noexcept {
+      return offset >= 0 ? PointerAdd(ptr, static_cast<std::size_t>(offset))
+                         : PointerSub(ptr, static_cast<std::size_t>(-offset));
+    }
 
-    /// The actual data.
-    Data data_;
+    /// The current item if the collection owns a vector, null otherwise.
+    const T* item_{nullptr};
+    /// The view of the collection if it references a `PbView`, null otherwise.
+    const PbView* view_{nullptr};
+    /// The location of the current item in `view_`, if non-null.
+    const horus_internal::PbItemRange* range_{nullptr};
   };
+
+  /// A contiguous range of items of a `CowRepeated`, e.g. the share of the items processed by one
+  /// worker of a parallel loop.
+  ///
+  /// The range refers to the `CowRepeated`, which must outlive it and not be modified.
+  class Range final {
+   public:
+    /// Type of the items yielded by `const_iterator`.
+    using value_type = Cow<T>;
+
+    /// Constructs a range of the items between `begin` and `end`.
+    Range(const_iterator begin, const_iterator end) noexcept : begin_{begin}, end_{end} {}
+
+    /// Returns the number of items in the range.
+    std::size_t size() const noexcept { return static_cast<std::size_t>(end_ - begin_); }
+    /// Returns whether the range is empty.
+    bool empty() const noexcept { return begin_ == end_; }
+
+    /// Returns the item at `index`, which must be less than `size()`.
+    Cow<T> operator[](std::size_t index) const HORUS_LIFETIME_BOUND {
+      assert(index < size());
+      return begin_[static_cast<std::ptrdiff_t>(index)];
+    }
+
+    /// Returns a `const_iterator` pointing to the first item of the range.
+    const_iterator begin() const noexcept { return begin_; }
+    /// Returns a `const_iterator` pointing past the last item of the range.
+    const_iterator end() const noexcept { return end_; }
+
+   private:
+    /// @see begin()
+    const_iterator begin_;
+    /// @see end()
+    const_iterator end_;
+  };
+
   /// Type of the items yielded by `const_iterator`.
   using value_type = Cow<T>;
 
@@ -492,7 +791,9 @@ class CowRepeated<T, /*kPacked=*/false> final {
       : data_{InPlaceType<horus_internal::PbViewAndTag>, std::move(view), tag} {
     static_assert(
         std::is_nothrow_constructible<horus_internal::PbViewAndTag, PbView&&, PbTag>::value, "");
-    assert(size() >= 0);  // Compute size, which will fail if the data is invalid.
+    // Compute size, which will fail if the data is invalid, unless it was already validated.
+    assert(data_.template TryAs<horus_internal::PbViewAndTag>()->view.IsValidated() ||
+           size() >= 0);
   }
 
   // Note that we don't provide `CowRepeated(std::initializer_list)` because it would imply copying
@@ -505,10 +806,21 @@ class CowRepeated<T, /*kPacked=*/false> final {
   /// Returns whether the container is empty.
   bool empty() const;
 
+  /// Returns the item at `index`, which must be less than `size()`.
+  ///
+  /// If the container references a `PbView`, the item is deserialized from it.
+  Cow<T> operator[](std::size_t index) const HORUS_LIFETIME_BOUND {
+    return begin()[static_cast<std::ptrdiff_t>(index)];
+  }
+
   /// Returns a `const_iterator` pointing to the first item of the container.
-  const_iterator begin() const noexcept { return const_iterator{*this, /*is_end=*/false}; }
+  const_iterator begin() const { return const_iterator{*this, /*is_end=*/false}; }
   /// Returns a `const_iterator` pointing past the last item of the container.
-  const_iterator end() const noexcept { return const_iterator{*this, /*is_end=*/true}; }
+  const_iterator end() const { return const_iterator{*this, /*is_end=*/true}; }
+
+  /// Returns the (up to) `count` items starting at `offset`. The range is empty if `offset` is
+  /// past the end of the container.
+  Range Slice(std::size_t offset, std::size_t count) const HORUS_LIFETIME_BOUND;
 
   /// Returns a mutable reference to the vector of elements.
   ///
@@ -516,6 +828,17 @@ class CowRepeated<T, /*kPacked=*/false> final {
   /// allocation failed.
   std::vector<T>& Vector() noexcept(false) HORUS_LIFETIME_BOUND;
 
+  /// Empties the container. If its items are owned, their vector is kept (though the items
+  /// themselves are destroyed) so that it can be refilled without reallocating it.
+  void Clear() noexcept {
+    std::vector<T>* const owned{data_.template TryAs<std::vector<T>>()};
+    if (owned != nullptr) {
+      owned->clear();
+    } else {
+      static_cast<void>(data_.template Emplace<std::vector<T>>());
+    }
+  }
+
   /// (Internal use only) Deserializes the repeated list from a `reader`.
   void InternalDeserialize(PbReader& reader) & noexcept(false);
 
@@ -541,54 +864,48 @@ class CowRepeated<T, /*kPacked=*/false> final {
   }
 
  private:
+  /// Deserializes the item at `range` in `view`.
+  static T ItemAt(const PbView& view, const horus_internal::PbItemRange& range) {
+    PbReader reader{view.InternalFieldView(range.offset, range.size)};
+    return T{reader};
+  }
+
   /// The actual data.
   Data data_;
 };
 
 template <class T>
-Cow<T> CowRepeated<T, /*kPacked=*/false>::const_iterator::operator*() const {
-  static_assert(std::is_nothrow_move_constructible<T>::value, "");
-  return data_.VisitConst([](const auto& iterator) -> Cow<T> { return *iterator; });
-}
-
-template <class T>
-auto CowRepeated<T, /*kPacked=*/false>::const_iterator::operator++() noexcept -> const_iterator& {
-  data_.Visit([](auto& iterator) noexcept { ++iterator; });
-  return *this;
-}
-
-// static
-template <class T>
-auto CowRepeated<T, /*kPacked=*/false>::const_iterator::DataFrom(const CowRepeated& container,
-                                                                 bool is_end) noexcept -> Data {
+CowRepeated<T, /*kPacked=*/false>::const_iterator::const_iterator(const CowRepeated& container,
+                                                                  bool is_end) noexcept(false) {
   HORUS_ONEOF_SWITCH(container.data_) {
     HORUS_ONEOF_CASE(data, std::vector<T>) {
-      const T* const ptr{is_end ? PointerAdd(data.data(), data.size()) : data.data()};
-      return Data{InPlaceType<const T*>, ptr};
+      item_ = is_end ? PointerAdd(data.data(), data.size()) : data.data();
+      return;
     }
     HORUS_ONEOF_CASE(data, horus_internal::PbViewAndTag) {
-      if (is_end) {
-        return Data{InPlaceType<PbRepeatedIterator<T>>};
-      }
-      return Data{InPlaceType<PbRepeatedIterator<T>>, data.tag, PbView{data.view}};
+      const horus_internal::PbItemIndex& index{data.Index()};
+      view_ = &data.view;
+      range_ = is_end ? PointerAdd(index.data(), index.size()) : index.data();
+      return;
     }
   }
-  HORUS_ONEOF_RETURN_NOT_HANDLED;
+}
+
+template <class T>
+Cow<T> CowRepeated<T, /*kPacked=*/false>::const_iterator::operator[](
+    difference_type offset) const {
+  static_assert(std::is_nothrow_move_constructible<T>::value, "");
+  if (view_ == nullptr) {
+    return *Advance(item_, offset);
+  }
+  return ItemAt(*view_, *Advance(range_, offset));
 }
 
 template <class T>
 std::size_t CowRepeated<T, /*kPacked=*/false>::size() const {
   HORUS_ONEOF_SWITCH(data_) {
     HORUS_ONEOF_CASE(data, std::vector<T>) { return data.size(); }
-    HORUS_ONEOF_CASE(data, horus_internal::PbViewAndTag) {
-      protozero::pbf_reader reader{data.view.Str().data(), data.view.Str().size()};
-      std::size_t length{0};
-      while (reader.next(data.tag)) {
-        reader.skip();
-        ++length;
-      }
-      return length;
-    }
+    HORUS_ONEOF_CASE(data, horus_internal::PbViewAndTag) { return data.Index().size(); }
   }
   HORUS_ONEOF_RETURN_NOT_HANDLED;
 }
@@ -597,14 +914,21 @@ template <class T>
 bool CowRepeated<T, /*kPacked=*/false>::empty() const {
   HORUS_ONEOF_SWITCH(data_) {
     HORUS_ONEOF_CASE(data, std::vector<T>) { return data.empty(); }
-    HORUS_ONEOF_CASE(data, horus_internal::PbViewAndTag) {
-      protozero::pbf_reader reader{data.view.Str().data(), data.view.Str().size()};
-      return !reader.next(data.tag);
-    }
+    HORUS_ONEOF_CASE(data, horus_internal::PbViewAndTag) { return data.Index().empty(); }
   }
   HORUS_ONEOF_RETURN_NOT_HANDLED;
 }
 
+template <class T>
+auto CowRepeated<T, /*kPacked=*/false>::Slice(std::size_t offset, std::size_t count) const
+    -> Range {
+  const std::size_t length{size()};
+  const std::size_t first{offset < length ? offset : length};
+  const std::size_t last{count < length - first ? first + count : length};
+  const const_iterator it{begin()};
+  return Range{it + static_cast<std::ptrdiff_t>(first), it + static_cast<std::ptrdiff_t>(last)};
+}
+
 template <class T>
 std::vector<T>& CowRepeated<T, /*kPacked=*/false>::Vector() noexcept(false) {
   static_assert(std::is_nothrow_constructible<T>::value, "");
@@ -612,12 +936,12 @@ std::vector<T>& CowRepeated<T, /*kPacked=*/false>::Vector() noexcept(false) {
   if (data_.template Is<std::vector<T>>()) {
     return *data_.template TryAs<std::vector<T>>();
   }
-  std::vector<T> result;
-  result.reserve(size());
   const horus_internal::PbViewAndTag& data{*data_.template TryAs<horus_internal::PbViewAndTag>()};
-  const PbRepeatedIterator<T> end;
-  for (PbRepeatedIterator<T> it{data.tag, PbView{data.view}}; it != end; ++it) {
-    result.push_back(*it);
+  const horus_internal::PbItemIndex& index{data.Index()};
+  std::vector<T> result;
+  result.reserve(index.size());
+  for (const horus_internal::PbItemRange& range : index) {
+    result.push_back(ItemAt(data.view, range));
   }
   return data_.template Emplace<std::vector<T>>(std::move(result));
 }
@@ -645,13 +969,15 @@ void CowRepeated<T, /*kPacked=*/false>::InternalDeserialize(PbReader& reader) &
         // The current view and the given view originate from the same buffer, so we're encountering
         // a new field in the same parent message.
         std::size_t const new_size{reader_view.Offset() - data.view.Offset() + reader_view.Size()};
-        data.view = data.view.Buffer().View(data.view.Offset(), new_size);
+        data.view = reader.FieldView(protozero::data_view{data.view.Str().data(), new_size});
       }
+      data.ResetIndex();
       break;  // We need an explicit break here because the `HORUS_ONEOF_CASE` macro uses a `for`
               // loop in C++14.
     }
   }
-  assert(size() >= 0);  // Make sure that whatever we deserialized is valid.
+  // Make sure that whatever we deserialized is valid, unless it was already validated.
+  assert(reader.IsValidated() || size() >= 0);
 }
 
 template <class T>
@@ -664,6 +990,15 @@ class PbTraits<CowRepeated<T, /*kPacked=*/false>> final {
     }
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static std::size_t ByteSize(PbTag tag, const CowRepeated<T, false>& value) {
+    std::size_t size{0};
+    for (const Cow<T>& item : value) {
+      size += PbTraits<T>::ByteSize(tag, item.Ref());
+    }
+    return size;
+  }
+
   /// Deserializes a `CowRepeated` from `reader`.
   static void Deserialize(PbReader& reader, CowRepeated<T, false>& value) {
     value.InternalDeserialize(reader);
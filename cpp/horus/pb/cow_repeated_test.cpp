@@ -4,10 +4,13 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <limits>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -94,6 +97,37 @@ TEST(CowRepeated, BasicPacked) {
   EXPECT_EQ(rep2.size(), 3);
 }
 
+TEST(CowRepeated, PackedBulkDecode) {
+  std::vector<std::int64_t> values;
+  for (std::int64_t i{0}; i < 100; ++i) {
+    values.push_back(i % 7 == 0 ? -i : i);
+  }
+
+  PbBuffer buffer;
+  {
+    PbWriter writer;
+    writer.Writer().add_packed_int64(1, values.begin(), values.end());
+    buffer = std::move(writer).ToBuffer();
+  }
+  // Skip tag and size.
+  PbView view{buffer.View(3, buffer.Str().size() - 3)};
+
+  const CowRepeated<std::int64_t> rep1{std::move(view)};
+  EXPECT_EQ(rep1.size(), values.size());
+
+  std::vector<std::int64_t> prefix(10);
+  EXPECT_EQ(rep1.CopyTo(prefix), prefix.size());
+  EXPECT_EQ(prefix, std::vector<std::int64_t>(values.begin(), values.begin() + 10));
+
+  std::vector<std::int64_t> all(200);
+  EXPECT_EQ(rep1.CopyTo(all), values.size());
+
+  CowRepeated<std::int64_t> rep2{rep1};
+  EXPECT_EQ(rep2.Vector(), values);
+  EXPECT_EQ(rep2.CopyTo(all), values.size());
+  EXPECT_EQ(std::vector<std::int64_t>(all.begin(), all.begin() + 100), values);
+}
+
 TEST(CowRepeated, BasicMessage) {
   constexpr PbTag kTag{1};
 
@@ -180,5 +214,96 @@ TEST(CowRepeated, EmptyMessageIterator) {
   }
 }
 
+TEST(CowRepeated, RandomAccessMessages) {
+  constexpr std::int64_t kCount{10};
+  std::vector<std::uint8_t> buffer;
+  {
+    pb::TestMessage message;
+    for (std::int64_t i = 0; i < kCount; ++i) {
+      message.mutable_rep_submessage().Add(
+          pb::TestMessage::SubMessage{}.set_string(CowBytes::OwnedCopy(std::to_string(i))));
+    }
+    message.SerializeToBuffer(buffer);
+  }
+
+  PbReader reader{PbBuffer::Borrowed({buffer.data(), buffer.size()})};
+  const pb::TestMessage root_message{reader};
+  const CowRepeated<pb::TestMessage::SubMessage>& rep{root_message.rep_submessage()};
+  ASSERT_EQ(rep.size(), kCount);
+  EXPECT_EQ(rep[7].Ref().string().Str(), "7");
+
+  const auto begin = rep.begin();
+  EXPECT_EQ(rep.end() - begin, kCount);
+  EXPECT_EQ((*(begin + 3)).Ref().string().Str(), "3");
+  EXPECT_EQ(begin[9].Ref().string().Str(), "9");
+  EXPECT_EQ((*std::prev(rep.end())).Ref().string().Str(), "9");
+  EXPECT_LT(begin, rep.end());
+
+  const auto slice = rep.Slice(3, 4);
+  ASSERT_EQ(slice.size(), 4);
+  EXPECT_EQ(slice[0].Ref().string().Str(), "3");
+  EXPECT_EQ((*std::prev(slice.end())).Ref().string().Str(), "6");
+  EXPECT_EQ(rep.Slice(8, 5).size(), 2);
+  EXPECT_TRUE(rep.Slice(20, 1).empty());
+
+  // Copies share the view (and its index); mutating a copy makes it own a vector.
+  CowRepeated<pb::TestMessage::SubMessage> copy{rep};
+  EXPECT_EQ(copy[4].Ref().string().Str(), "4");
+  copy.Vector()[4].set_string(CowBytes::Borrowed("four"));
+  EXPECT_EQ(copy.size(), kCount);
+  EXPECT_EQ(copy[4].Ref().string().Str(), "four");
+  EXPECT_EQ(copy.Slice(4, 1)[0].Ref().string().Str(), "four");
+  EXPECT_EQ(rep[4].Ref().string().Str(), "4");
+}
+
+TEST(CowRepeated, CopyWhileIndexing) {
+  constexpr PbTag kTag{1};
+  PbBuffer buffer;
+  {
+    PbWriter writer;
+    for (std::int32_t i{0}; i < 100; ++i) {
+      writer.Writer().add_string(kTag, "value");
+    }
+    buffer = std::move(writer).ToBuffer();
+  }
+
+  // Copying a shared `CowRepeated` while another thread builds its index is not a data race.
+  for (std::int32_t attempt{0}; attempt < 10; ++attempt) {
+    const CowRepeated<CowBytes> rep{kTag, buffer.View()};
+    std::atomic<bool> indexed{false};
+    std::thread indexer{[&rep, &indexed]() {
+      EXPECT_EQ(rep.size(), 100);
+      indexed.store(true);
+    }};
+    while (!indexed.load()) {
+      const CowRepeated<CowBytes> copy{rep};
+      EXPECT_EQ(copy.size(), 100);
+    }
+    indexer.join();
+  }
+}
+
+TEST(CowRepeated, IndexSpansInterleavedFields) {
+  constexpr PbTag kTag{1};
+  constexpr PbTag kOtherTag{2};
+
+  PbBuffer buffer;
+  {
+    PbWriter writer;
+    writer.Writer().add_string(kTag, "foo");
+    writer.Writer().add_int32(kOtherTag, 1);
+    writer.Writer().add_string(kTag, "bar");
+    writer.Writer().add_string(kOtherTag, "baz");
+    writer.Writer().add_string(kTag, "qux");
+    buffer = std::move(writer).ToBuffer();
+  }
+
+  const CowRepeated<CowBytes> rep{kTag, buffer.View()};
+  ASSERT_EQ(rep.size(), 3);
+  EXPECT_THAT(rep[1], CowEq("bar"));
+  EXPECT_THAT(rep[2], CowEq("qux"));
+  EXPECT_THAT(rep.Slice(1, 2), ElementsAre(CowEq("bar"), CowEq("qux")));
+}
+
 }  // namespace
 }  // namespace horus
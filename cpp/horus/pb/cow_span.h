@@ -74,6 +74,22 @@ class CowSpan final {
   /// @throws std::bad_alloc If the contents of the span had to be copied and the allocation failed.
   std::vector<T>& Vector() noexcept(false) HORUS_LIFETIME_BOUND;
 
+  /// Returns the `PbView` of the elements if they are not owned, and null otherwise.
+  const PbView* TryView() const noexcept HORUS_LIFETIME_BOUND {
+    return data_.template TryAs<PbView>();
+  }
+
+  /// Empties the span. If its elements are owned, their vector is kept so that it can be refilled
+  /// without allocating.
+  void Clear() noexcept {
+    std::vector<T>* const owned{data_.template TryAs<std::vector<T>>()};
+    if (owned != nullptr) {
+      owned->clear();
+    } else {
+      static_cast<void>(data_.template Emplace<PbView>(PbBuffer{}));
+    }
+  }
+
   /// Returns a `const_iterator` pointing to the first item of the container.
   const_iterator begin() const noexcept { return Span().begin(); }
   /// Returns a `const_iterator` pointing past the last item of the container.
@@ -110,7 +126,8 @@ UnalignedSpan<T> CowSpan<T>::Span() const noexcept {
       return UnalignedSpan<T>{vector.data(), vector.size()};
     }
     HORUS_ONEOF_CASE(view, PbView) {
-      assert(view.Str().size() % sizeof(T) == 0);
+      // Checked once by `PbView::Validate()` for validated views.
+      assert(view.IsValidated() || view.Str().size() % sizeof(T) == 0);
       return UnalignedSpan<T>{view.Str().data(), view.Str().size() / sizeof(T)};
     }
   }
@@ -189,10 +206,22 @@ class PbTraits<CowSpan<T>, PbDeserFlags::kFixed> final {
  public:
   /// Serializes `value` into `writer`.
   static void Serialize(PbWriter& writer, PbTag tag, const CowSpan<T>& value) {
+    // Views store the elements in their (little-endian) wire format, so they can be referenced.
+    const PbView* const view{value.TryView()};
+    if (view != nullptr && writer.TryAddReference(tag, *view)) {
+      return;
+    }
     static constexpr auto kAdd = horus_internal::FixedPackedFns<T>::kAddPacked;
     (writer.Writer().*kAdd)(tag, value.begin(), value.end());
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static std::size_t ByteSize(PbTag tag, const CowSpan<T>& value) noexcept {
+    const std::size_t size{value.Span().size()};
+    // protozero does not write anything for empty packed fields.
+    return size == 0 ? 0 : horus_internal::PbLengthDelimitedSize(tag, size * sizeof(T));
+  }
+
   /// Deserializes a `CowSpan<T>` from `reader`.
   static CowSpan<T> Deserialize(PbReader& reader) {
     static constexpr auto kGet = horus_internal::FixedPackedFns<T>::kGetPacked;
@@ -201,10 +230,8 @@ class PbTraits<CowSpan<T>, PbDeserFlags::kFixed> final {
     std::size_t const size{(reader.Reader().*kGet)().size()};  // `kGet()` will skip the span.
     const char* const span_end{reader.Reader().data().data()};
     const char* const span_start{PointerSub(span_end, sizeof(T) * size)};
-    const char* const buffer_start{reader.Buffer().Str().data()};
-    std::size_t const buffer_offset{static_cast<std::size_t>(span_start - buffer_start)};
 
-    return CowSpan<T>{PbBuffer{reader.Buffer()}.View(buffer_offset, size * sizeof(T))};
+    return CowSpan<T>{reader.FieldView(protozero::data_view{span_start, size * sizeof(T)})};
   }
 };
 
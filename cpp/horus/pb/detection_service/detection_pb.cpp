@@ -1,6 +1,9 @@
 #include "horus/pb/detection_service/detection_pb.h"
 
+#include <cstddef>
+
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 
 namespace horus {
 namespace sdk {
@@ -13,41 +16,21 @@ BoundingBox::BoundingBox(const BoundingBox& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void BoundingBox::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<Vector3f>(writer, /*tag=*/ 1, base_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<Vector3f>(writer, /*tag=*/ 2, size_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<float, PbDeserFlags::kFixed>(writer, /*tag=*/ 3, yaw_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t BoundingBox::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void BoundingBox::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<Vector3f>(reader, base_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<Vector3f>(reader, size_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<float, PbDeserFlags::kFixed>(reader, yaw_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void BoundingBox::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LabeledPointCloud::LabeledPointCloud(const LabeledPointCloud& other) noexcept(false)
@@ -56,33 +39,21 @@ LabeledPointCloud::LabeledPointCloud(const LabeledPointCloud& other) noexcept(fa
     , set_fields_{other.set_fields_} {}
 
 void LabeledPointCloud::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<PointFrame>(writer, /*tag=*/ 1, point_cloud_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<UInt32List>(writer, /*tag=*/ 2, point_index_to_object_id_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LabeledPointCloud::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LabeledPointCloud::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<PointFrame>(reader, point_cloud_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<UInt32List>(reader, point_index_to_object_id_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LabeledPointCloud::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 TimeRange::TimeRange(const TimeRange& other) noexcept(false)
@@ -91,33 +62,21 @@ TimeRange::TimeRange(const TimeRange& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void TimeRange::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<Timestamp>(writer, /*tag=*/ 1, start_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<Timestamp>(writer, /*tag=*/ 2, end_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t TimeRange::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void TimeRange::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<Timestamp>(reader, start_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<Timestamp>(reader, end_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void TimeRange::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 DetectedObject_Classification::DetectedObject_Classification(const DetectedObject_Classification& other) noexcept(false)
@@ -126,33 +85,21 @@ DetectedObject_Classification::DetectedObject_Classification(const DetectedObjec
     , set_fields_{other.set_fields_} {}
 
 void DetectedObject_Classification::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<ObjectLabel>(writer, /*tag=*/ 1, class_label_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<float, PbDeserFlags::kFixed>(writer, /*tag=*/ 2, class_confidence_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t DetectedObject_Classification::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void DetectedObject_Classification::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<ObjectLabel>(reader, class_label_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<float, PbDeserFlags::kFixed>(reader, class_confidence_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void DetectedObject_Classification::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 DetectedObject_Kinematics::DetectedObject_Kinematics(const DetectedObject_Kinematics& other) noexcept(false)
@@ -161,33 +108,21 @@ DetectedObject_Kinematics::DetectedObject_Kinematics(const DetectedObject_Kinema
     , set_fields_{other.set_fields_} {}
 
 void DetectedObject_Kinematics::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<Vector2f>(writer, /*tag=*/ 1, linear_velocity_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<float, PbDeserFlags::kFixed>(writer, /*tag=*/ 2, yaw_rate_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t DetectedObject_Kinematics::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void DetectedObject_Kinematics::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<Vector2f>(reader, linear_velocity_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<float, PbDeserFlags::kFixed>(reader, yaw_rate_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void DetectedObject_Kinematics::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 DetectedObject_Shape::DetectedObject_Shape(const DetectedObject_Shape& other) noexcept(false)
@@ -196,33 +131,21 @@ DetectedObject_Shape::DetectedObject_Shape(const DetectedObject_Shape& other) no
     , set_fields_{other.set_fields_} {}
 
 void DetectedObject_Shape::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<BoundingBox>(writer, /*tag=*/ 1, bounding_box_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<BoundingBox>(writer, /*tag=*/ 2, tight_bounding_box_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t DetectedObject_Shape::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void DetectedObject_Shape::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<BoundingBox>(reader, bounding_box_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<BoundingBox>(reader, tight_bounding_box_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void DetectedObject_Shape::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 DetectedObject_Status::DetectedObject_Status(const DetectedObject_Status& other) noexcept(false)
@@ -233,49 +156,21 @@ DetectedObject_Status::DetectedObject_Status(const DetectedObject_Status& other)
     , set_fields_{other.set_fields_} {}
 
 void DetectedObject_Status::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 1, id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<TrackingStatus>(writer, /*tag=*/ 2, tracking_status_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<Timestamp>(writer, /*tag=*/ 3, last_seen_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<TimeRange>(writer, /*tag=*/ 4, observation_time_range_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t DetectedObject_Status::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void DetectedObject_Status::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint32_t>(reader, id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<TrackingStatus>(reader, tracking_status_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<Timestamp>(reader, last_seen_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<TimeRange>(reader, observation_time_range_);
-        set_fields_[3] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void DetectedObject_Status::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 DetectedObject::DetectedObject(const DetectedObject& other) noexcept(false)
@@ -287,57 +182,21 @@ DetectedObject::DetectedObject(const DetectedObject& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void DetectedObject::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<DetectedObject_Classification>(writer, /*tag=*/ 1, classification_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<DetectedObject_Kinematics>(writer, /*tag=*/ 2, kinematics_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<DetectedObject_Shape>(writer, /*tag=*/ 3, shape_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<DetectedObject_Status>(writer, /*tag=*/ 4, status_);
-  }
-  if (set_fields_[4]) {
-    SerializeField<CowRepeated<CowBytes>>(writer, /*tag=*/ 5, event_zone_ids_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t DetectedObject::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void DetectedObject::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<DetectedObject_Classification>(reader, classification_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<DetectedObject_Kinematics>(reader, kinematics_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<DetectedObject_Shape>(reader, shape_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<DetectedObject_Status>(reader, status_);
-        set_fields_[3] = true;
-        break;
-      }
-      case 5: {
-        DeserializeField<CowRepeated<CowBytes>>(reader, event_zone_ids_);
-        set_fields_[4] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void DetectedObject::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ZoneEvent::ZoneEvent(const ZoneEvent& other) noexcept(false)
@@ -350,61 +209,21 @@ ZoneEvent::ZoneEvent(const ZoneEvent& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void ZoneEvent::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<Timestamp>(writer, /*tag=*/ 1, timestamp_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, zone_id_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<ZoneEvent_Type>(writer, /*tag=*/ 3, type_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<DetectedObject>(writer, /*tag=*/ 4, object_);
-  }
-  if (set_fields_[4]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 5, object_id_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ZoneEvent::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ZoneEvent::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<Timestamp>(reader, timestamp_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, zone_id_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<ZoneEvent_Type>(reader, type_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        clear_object_info();
-        object_info_ = ObjectInfoOneof::kObject;
-        DeserializeField<DetectedObject>(reader, object_);
-        set_fields_[3] = true;
-        break;
-      }
-      case 5: {
-        clear_object_info();
-        object_info_ = ObjectInfoOneof::kObjectId;
-        DeserializeField<std::uint32_t>(reader, object_id_);
-        set_fields_[4] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ZoneEvent::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ZoneEventList::ZoneEventList(const ZoneEventList& other) noexcept(false)
@@ -412,25 +231,21 @@ ZoneEventList::ZoneEventList(const ZoneEventList& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void ZoneEventList::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowRepeated<ZoneEvent>>(writer, /*tag=*/ 1, zone_events_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ZoneEventList::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ZoneEventList::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowRepeated<ZoneEvent>>(reader, zone_events_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ZoneEventList::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 DeepLearningObject_Classification::DeepLearningObject_Classification(const DeepLearningObject_Classification& other) noexcept(false)
@@ -439,33 +254,21 @@ DeepLearningObject_Classification::DeepLearningObject_Classification(const DeepL
     , set_fields_{other.set_fields_} {}
 
 void DeepLearningObject_Classification::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<ObjectLabel>(writer, /*tag=*/ 1, class_label_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<float, PbDeserFlags::kFixed>(writer, /*tag=*/ 2, class_confidence_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t DeepLearningObject_Classification::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void DeepLearningObject_Classification::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<ObjectLabel>(reader, class_label_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<float, PbDeserFlags::kFixed>(reader, class_confidence_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void DeepLearningObject_Classification::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 DeepLearningObject::DeepLearningObject(const DeepLearningObject& other) noexcept(false)
@@ -475,41 +278,21 @@ DeepLearningObject::DeepLearningObject(const DeepLearningObject& other) noexcept
     , set_fields_{other.set_fields_} {}
 
 void DeepLearningObject::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<DeepLearningObject_Classification>(writer, /*tag=*/ 1, classification_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<BoundingBox>(writer, /*tag=*/ 2, bounding_box_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 3, associated_object_id_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t DeepLearningObject::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void DeepLearningObject::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<DeepLearningObject_Classification>(reader, classification_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<BoundingBox>(reader, bounding_box_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<std::uint32_t>(reader, associated_object_id_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void DeepLearningObject::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -519,25 +302,21 @@ DetectionEvent_FrameInfo::DetectionEvent_FrameInfo(const DetectionEvent_FrameInf
     , set_fields_{other.set_fields_} {}
 
 void DetectionEvent_FrameInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<Timestamp>(writer, /*tag=*/ 1, frame_timestamp_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t DetectionEvent_FrameInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void DetectionEvent_FrameInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<Timestamp>(reader, frame_timestamp_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void DetectionEvent_FrameInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 DetectionEvent::DetectionEvent(const DetectionEvent& other) noexcept(false)
@@ -553,91 +332,263 @@ DetectionEvent::DetectionEvent(const DetectionEvent& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void DetectionEvent::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowRepeated<DetectedObject>>(writer, /*tag=*/ 1, objects_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowRepeated<LabeledPointCloud>>(writer, /*tag=*/ 2, labeled_point_clouds_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<DetectionEvent_FrameInfo>(writer, /*tag=*/ 3, frame_info_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<CowRepeated<DeepLearningObject>>(writer, /*tag=*/ 4, raw_deep_learning_objects_);
-  }
-  if (set_fields_[4]) {
-    SerializeField<CowRepeated<std::uint32_t>>(writer, /*tag=*/ 5, unrecovered_object_ids_);
-  }
-  if (set_fields_[5]) {
-    SerializeField<bool>(writer, /*tag=*/ 6, is_replaying_);
-  }
-  if (set_fields_[6]) {
-    SerializeField<Duration>(writer, /*tag=*/ 7, overall_frame_latency_);
-  }
-  if (set_fields_[7]) {
-    SerializeField<Timestamp>(writer, /*tag=*/ 8, publishing_time_);
-  }
-  if (set_fields_[8]) {
-    SerializeField<DebugMergerInfo>(writer, /*tag=*/ 9, debug_merger_info_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t DetectionEvent::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void DetectionEvent::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowRepeated<DetectedObject>>(reader, objects_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowRepeated<LabeledPointCloud>>(reader, labeled_point_clouds_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<DetectionEvent_FrameInfo>(reader, frame_info_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<CowRepeated<DeepLearningObject>>(reader, raw_deep_learning_objects_);
-        set_fields_[3] = true;
-        break;
-      }
-      case 5: {
-        DeserializeField<CowRepeated<std::uint32_t>>(reader, unrecovered_object_ids_);
-        set_fields_[4] = true;
-        break;
-      }
-      case 6: {
-        DeserializeField<bool>(reader, is_replaying_);
-        set_fields_[5] = true;
-        break;
-      }
-      case 7: {
-        DeserializeField<Duration>(reader, overall_frame_latency_);
-        set_fields_[6] = true;
-        break;
-      }
-      case 8: {
-        DeserializeField<Timestamp>(reader, publishing_time_);
-        set_fields_[7] = true;
-        break;
-      }
-      case 9: {
-        DeserializeField<DebugMergerInfo>(reader, debug_merger_info_);
-        set_fields_[8] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void DetectionEvent::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
+}
+
+// MARK: Field tables
+
+// Messages are not standard-layout since they have a vtable, so `offsetof()` is only
+// conditionally-supported on them; it is supported by all compilers targeted by the SDK.
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
+const horus_internal::PbMessageTable& BoundingBox::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(BoundingBox, base_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Vector3f>>::kOps},
+      {/*tag=*/ 2, offsetof(BoundingBox, size_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Vector3f>>::kOps},
+      {/*tag=*/ 3, offsetof(BoundingBox, yaw_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<float, PbDeserFlags::kFixed>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LabeledPointCloud::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LabeledPointCloud, point_cloud_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<PointFrame>>::kOps},
+      {/*tag=*/ 2, offsetof(LabeledPointCloud, point_index_to_object_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<UInt32List>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& TimeRange::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(TimeRange, start_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Timestamp>>::kOps},
+      {/*tag=*/ 2, offsetof(TimeRange, end_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Timestamp>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& DetectedObject_Classification::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(DetectedObject_Classification, class_label_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<ObjectLabel>::kOps},
+      {/*tag=*/ 2, offsetof(DetectedObject_Classification, class_confidence_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<float, PbDeserFlags::kFixed>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
 }
 
+const horus_internal::PbMessageTable& DetectedObject_Kinematics::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(DetectedObject_Kinematics, linear_velocity_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Vector2f>>::kOps},
+      {/*tag=*/ 2, offsetof(DetectedObject_Kinematics, yaw_rate_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<float, PbDeserFlags::kFixed>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& DetectedObject_Shape::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(DetectedObject_Shape, bounding_box_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<BoundingBox>>::kOps},
+      {/*tag=*/ 2, offsetof(DetectedObject_Shape, tight_bounding_box_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<BoundingBox>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& DetectedObject_Status::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(DetectedObject_Status, id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/ 2, offsetof(DetectedObject_Status, tracking_status_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<TrackingStatus>::kOps},
+      {/*tag=*/ 3, offsetof(DetectedObject_Status, last_seen_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Timestamp>>::kOps},
+      {/*tag=*/ 4, offsetof(DetectedObject_Status, observation_time_range_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<TimeRange>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& DetectedObject::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(DetectedObject, classification_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<DetectedObject_Classification>>::kOps},
+      {/*tag=*/ 2, offsetof(DetectedObject, kinematics_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<DetectedObject_Kinematics>>::kOps},
+      {/*tag=*/ 3, offsetof(DetectedObject, shape_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<DetectedObject_Shape>>::kOps},
+      {/*tag=*/ 4, offsetof(DetectedObject, status_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<DetectedObject_Status>>::kOps},
+      {/*tag=*/ 5, offsetof(DetectedObject, event_zone_ids_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<CowBytes>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ZoneEvent::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ZoneEvent, timestamp_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Timestamp>>::kOps},
+      {/*tag=*/ 2, offsetof(ZoneEvent, zone_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(ZoneEvent, type_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<ZoneEvent_Type>::kOps},
+      {/*tag=*/ 4, offsetof(ZoneEvent, object_),
+       /*oneof_offset=*/ offsetof(ZoneEvent, object_info_),
+       &horus_internal::PbFieldOpsFor<DetectedObject>::kOps},
+      {/*tag=*/ 5, offsetof(ZoneEvent, object_id_),
+       /*oneof_offset=*/ offsetof(ZoneEvent, object_info_),
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ZoneEventList::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ZoneEventList, zone_events_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<ZoneEvent>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& DeepLearningObject_Classification::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(DeepLearningObject_Classification, class_label_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<ObjectLabel>::kOps},
+      {/*tag=*/ 2, offsetof(DeepLearningObject_Classification, class_confidence_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<float, PbDeserFlags::kFixed>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& DeepLearningObject::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(DeepLearningObject, classification_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<DeepLearningObject_Classification>>::kOps},
+      {/*tag=*/ 2, offsetof(DeepLearningObject, bounding_box_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<BoundingBox>>::kOps},
+      {/*tag=*/ 3, offsetof(DeepLearningObject, associated_object_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& DetectionEvent_FrameInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(DetectionEvent_FrameInfo, frame_timestamp_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Timestamp>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& DetectionEvent::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(DetectionEvent, objects_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<DetectedObject>>::kOps},
+      {/*tag=*/ 2, offsetof(DetectionEvent, labeled_point_clouds_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<LabeledPointCloud>>::kOps},
+      {/*tag=*/ 3, offsetof(DetectionEvent, frame_info_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<DetectionEvent_FrameInfo>>::kOps},
+      {/*tag=*/ 4, offsetof(DetectionEvent, raw_deep_learning_objects_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<DeepLearningObject>>::kOps},
+      {/*tag=*/ 5, offsetof(DetectionEvent, unrecovered_object_ids_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<std::uint32_t>>::kOps},
+      {/*tag=*/ 6, offsetof(DetectionEvent, is_replaying_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<bool>::kOps},
+      {/*tag=*/ 7, offsetof(DetectionEvent, overall_frame_latency_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Duration>>::kOps},
+      {/*tag=*/ 8, offsetof(DetectionEvent, publishing_time_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Timestamp>>::kOps},
+      {/*tag=*/ 9, offsetof(DetectionEvent, debug_merger_info_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<DebugMergerInfo>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
 }  // namespace pb
 }  // namespace sdk
 }  // namespace horus
@@ -8,6 +8,7 @@
 /// Generated by `/opt/actions-runner/_work/horus/horus/common/tools/sdk/pb.ts`.
 
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -16,9 +17,11 @@
 #include "horus/pb/config/metadata_pb.h"
 #include "horus/pb/cow_bytes.h"
 #include "horus/pb/cow_repeated.h"
+#include "horus/pb/lazy.h"
 #include "horus/pb/message.h"
 #include "horus/pb/point/point_message_pb.h"
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 #include "horus/pb/types.h"
 #include "horus/strings/string_view.h"
 
@@ -145,6 +148,11 @@ class BoundingBox final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -153,12 +161,25 @@ class BoundingBox final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.BoundingBox`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.BoundingBox"; }
 
   /// The full name of the message: `horus.pb.BoundingBox`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `BoundingBox`, e.g. to build a `PbFieldMask<BoundingBox>`.
+  enum class Field : PbTag {
+    /// Field `base`.
+    kBase = 1,
+    /// Field `size`.
+    kSize = 2,
+    /// Field `yaw`.
+    kYaw = 3,
+  };
+
   // Field `base` (no 1).
   // -----
 
@@ -166,8 +187,12 @@ class BoundingBox final : public PbMessage {
   ///  relevant to the global origin.
   ///
   /// Field no: 1.
-  constexpr const Vector3f& base() const& noexcept HORUS_LIFETIME_BOUND {
-    return base_;
+  ///
+  /// If `base` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `base` was received and is not a valid message.
+  const Vector3f& base() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return base_.Ref();
   }
 
   /// If `base` is set, moves it out of the message (without marking it as unset).
@@ -175,20 +200,24 @@ class BoundingBox final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  Vector3f base() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `base` was received and is not a valid message.
+  Vector3f base() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(base_);
+    return std::move(base_).Take();
   }
 
   /// The base is defined by the center_x, center_y, and lowest_z in meters
   ///  relevant to the global origin.
   ///
   /// Field no: 1.
-  Vector3f& mutable_base() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `base` was received and is not a valid message.
+  Vector3f& mutable_base() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return base_;
+    return base_.Mutable();
   }
 
   /// Returns whether `base` (no 1) is set.
@@ -197,13 +226,13 @@ class BoundingBox final : public PbMessage {
   /// Clears `base` (no 1).
   void clear_base() & noexcept {
     set_fields_[0] = false;
-    base_ = {};
+    base_.Clear();
   }
 
   /// Sets `base` (no 1) and returns `*this`.
   BoundingBox& set_base(Vector3f&& base) & noexcept {
     set_fields_[0] = true;
-    base_ = std::move(base);
+    base_.Set(std::move(base));
     return *this;
   }
   /// Sets `base` (no 1) and returns `*this`.
@@ -217,8 +246,12 @@ class BoundingBox final : public PbMessage {
   /// The size is defined by the width, height and depth of the box in meters.
   ///
   /// Field no: 2.
-  constexpr const Vector3f& size() const& noexcept HORUS_LIFETIME_BOUND {
-    return size_;
+  ///
+  /// If `size` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `size` was received and is not a valid message.
+  const Vector3f& size() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return size_.Ref();
   }
 
   /// If `size` is set, moves it out of the message (without marking it as unset).
@@ -226,19 +259,23 @@ class BoundingBox final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  Vector3f size() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `size` was received and is not a valid message.
+  Vector3f size() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(size_);
+    return std::move(size_).Take();
   }
 
   /// The size is defined by the width, height and depth of the box in meters.
   ///
   /// Field no: 2.
-  Vector3f& mutable_size() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `size` was received and is not a valid message.
+  Vector3f& mutable_size() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return size_;
+    return size_.Mutable();
   }
 
   /// Returns whether `size` (no 2) is set.
@@ -247,13 +284,13 @@ class BoundingBox final : public PbMessage {
   /// Clears `size` (no 2).
   void clear_size() & noexcept {
     set_fields_[1] = false;
-    size_ = {};
+    size_.Clear();
   }
 
   /// Sets `size` (no 2) and returns `*this`.
   BoundingBox& set_size(Vector3f&& size) & noexcept {
     set_fields_[1] = true;
-    size_ = std::move(size);
+    size_.Set(std::move(size));
     return *this;
   }
   /// Sets `size` (no 2) and returns `*this`.
@@ -299,11 +336,15 @@ class BoundingBox final : public PbMessage {
     return std::move(set_yaw(yaw));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see base()
-  Vector3f base_{};
+  PbLazy<Vector3f> base_{};
   /// @see size()
-  Vector3f size_{};
+  PbLazy<Vector3f> size_{};
   /// @see yaw()
   float yaw_{};
 
@@ -349,6 +390,11 @@ class LabeledPointCloud final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -357,20 +403,35 @@ class LabeledPointCloud final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.LabeledPointCloud`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.LabeledPointCloud"; }
 
   /// The full name of the message: `horus.pb.LabeledPointCloud`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LabeledPointCloud`, e.g. to build a `PbFieldMask<LabeledPointCloud>`.
+  enum class Field : PbTag {
+    /// Field `point_cloud`.
+    kPointCloud = 1,
+    /// Field `point_index_to_object_id`.
+    kPointIndexToObjectId = 2,
+  };
+
   // Field `point_cloud` (no 1).
   // -----
 
   /// The point cloud and its metadata.
   ///
   /// Field no: 1.
-  constexpr const PointFrame& point_cloud() const& noexcept HORUS_LIFETIME_BOUND {
-    return point_cloud_;
+  ///
+  /// If `point_cloud` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `point_cloud` was received and is not a valid message.
+  const PointFrame& point_cloud() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return point_cloud_.Ref();
   }
 
   /// If `point_cloud` is set, moves it out of the message (without marking it as unset).
@@ -378,19 +439,23 @@ class LabeledPointCloud final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  PointFrame point_cloud() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `point_cloud` was received and is not a valid message.
+  PointFrame point_cloud() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(point_cloud_);
+    return std::move(point_cloud_).Take();
   }
 
   /// The point cloud and its metadata.
   ///
   /// Field no: 1.
-  PointFrame& mutable_point_cloud() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `point_cloud` was received and is not a valid message.
+  PointFrame& mutable_point_cloud() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return point_cloud_;
+    return point_cloud_.Mutable();
   }
 
   /// Returns whether `point_cloud` (no 1) is set.
@@ -399,13 +464,13 @@ class LabeledPointCloud final : public PbMessage {
   /// Clears `point_cloud` (no 1).
   void clear_point_cloud() & noexcept {
     set_fields_[0] = false;
-    point_cloud_ = {};
+    point_cloud_.Clear();
   }
 
   /// Sets `point_cloud` (no 1) and returns `*this`.
   LabeledPointCloud& set_point_cloud(PointFrame&& point_cloud) & noexcept {
     set_fields_[0] = true;
-    point_cloud_ = std::move(point_cloud);
+    point_cloud_.Set(std::move(point_cloud));
     return *this;
   }
   /// Sets `point_cloud` (no 1) and returns `*this`.
@@ -420,8 +485,12 @@ class LabeledPointCloud final : public PbMessage {
   ///  to. The int32_t::max is reserved for unassigned points.
   ///
   /// Field no: 2.
-  constexpr const UInt32List& point_index_to_object_id() const& noexcept HORUS_LIFETIME_BOUND {
-    return point_index_to_object_id_;
+  ///
+  /// If `point_index_to_object_id` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `point_index_to_object_id` was received and is not a valid message.
+  const UInt32List& point_index_to_object_id() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return point_index_to_object_id_.Ref();
   }
 
   /// If `point_index_to_object_id` is set, moves it out of the message (without marking it as unset).
@@ -429,20 +498,24 @@ class LabeledPointCloud final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  UInt32List point_index_to_object_id() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `point_index_to_object_id` was received and is not a valid message.
+  UInt32List point_index_to_object_id() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(point_index_to_object_id_);
+    return std::move(point_index_to_object_id_).Take();
   }
 
   /// Attributes for each point defining which `DetectedObject` a point belongs
   ///  to. The int32_t::max is reserved for unassigned points.
   ///
   /// Field no: 2.
-  UInt32List& mutable_point_index_to_object_id() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `point_index_to_object_id` was received and is not a valid message.
+  UInt32List& mutable_point_index_to_object_id() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return point_index_to_object_id_;
+    return point_index_to_object_id_.Mutable();
   }
 
   /// Returns whether `point_index_to_object_id` (no 2) is set.
@@ -451,13 +524,13 @@ class LabeledPointCloud final : public PbMessage {
   /// Clears `point_index_to_object_id` (no 2).
   void clear_point_index_to_object_id() & noexcept {
     set_fields_[1] = false;
-    point_index_to_object_id_ = {};
+    point_index_to_object_id_.Clear();
   }
 
   /// Sets `point_index_to_object_id` (no 2) and returns `*this`.
   LabeledPointCloud& set_point_index_to_object_id(UInt32List&& point_index_to_object_id) & noexcept {
     set_fields_[1] = true;
-    point_index_to_object_id_ = std::move(point_index_to_object_id);
+    point_index_to_object_id_.Set(std::move(point_index_to_object_id));
     return *this;
   }
   /// Sets `point_index_to_object_id` (no 2) and returns `*this`.
@@ -465,11 +538,15 @@ class LabeledPointCloud final : public PbMessage {
     return std::move(set_point_index_to_object_id(std::move(point_index_to_object_id)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see point_cloud()
-  PointFrame point_cloud_{};
+  PbLazy<PointFrame> point_cloud_{};
   /// @see point_index_to_object_id()
-  UInt32List point_index_to_object_id_{};
+  PbLazy<UInt32List> point_index_to_object_id_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<2> set_fields_;
@@ -513,6 +590,11 @@ class TimeRange final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -521,20 +603,35 @@ class TimeRange final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.TimeRange`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.TimeRange"; }
 
   /// The full name of the message: `horus.pb.TimeRange`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `TimeRange`, e.g. to build a `PbFieldMask<TimeRange>`.
+  enum class Field : PbTag {
+    /// Field `start`.
+    kStart = 1,
+    /// Field `end`.
+    kEnd = 2,
+  };
+
   // Field `start` (no 1).
   // -----
 
   /// No documentation.
   ///
   /// Field no: 1.
-  constexpr const Timestamp& start() const& noexcept HORUS_LIFETIME_BOUND {
-    return start_;
+  ///
+  /// If `start` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `start` was received and is not a valid message.
+  const Timestamp& start() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return start_.Ref();
   }
 
   /// If `start` is set, moves it out of the message (without marking it as unset).
@@ -542,19 +639,23 @@ class TimeRange final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  Timestamp start() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `start` was received and is not a valid message.
+  Timestamp start() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(start_);
+    return std::move(start_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 1.
-  Timestamp& mutable_start() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `start` was received and is not a valid message.
+  Timestamp& mutable_start() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return start_;
+    return start_.Mutable();
   }
 
   /// Returns whether `start` (no 1) is set.
@@ -563,13 +664,13 @@ class TimeRange final : public PbMessage {
   /// Clears `start` (no 1).
   void clear_start() & noexcept {
     set_fields_[0] = false;
-    start_ = {};
+    start_.Clear();
   }
 
   /// Sets `start` (no 1) and returns `*this`.
   TimeRange& set_start(Timestamp&& start) & noexcept {
     set_fields_[0] = true;
-    start_ = std::move(start);
+    start_.Set(std::move(start));
     return *this;
   }
   /// Sets `start` (no 1) and returns `*this`.
@@ -583,8 +684,12 @@ class TimeRange final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 2.
-  constexpr const Timestamp& end() const& noexcept HORUS_LIFETIME_BOUND {
-    return end_;
+  ///
+  /// If `end` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `end` was received and is not a valid message.
+  const Timestamp& end() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return end_.Ref();
   }
 
   /// If `end` is set, moves it out of the message (without marking it as unset).
@@ -592,19 +697,23 @@ class TimeRange final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  Timestamp end() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `end` was received and is not a valid message.
+  Timestamp end() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(end_);
+    return std::move(end_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 2.
-  Timestamp& mutable_end() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `end` was received and is not a valid message.
+  Timestamp& mutable_end() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return end_;
+    return end_.Mutable();
   }
 
   /// Returns whether `end` (no 2) is set.
@@ -613,13 +722,13 @@ class TimeRange final : public PbMessage {
   /// Clears `end` (no 2).
   void clear_end() & noexcept {
     set_fields_[1] = false;
-    end_ = {};
+    end_.Clear();
   }
 
   /// Sets `end` (no 2) and returns `*this`.
   TimeRange& set_end(Timestamp&& end) & noexcept {
     set_fields_[1] = true;
-    end_ = std::move(end);
+    end_.Set(std::move(end));
     return *this;
   }
   /// Sets `end` (no 2) and returns `*this`.
@@ -627,11 +736,15 @@ class TimeRange final : public PbMessage {
     return std::move(set_end(std::move(end)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see start()
-  Timestamp start_{};
+  PbLazy<Timestamp> start_{};
   /// @see end()
-  Timestamp end_{};
+  PbLazy<Timestamp> end_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<2> set_fields_;
@@ -675,6 +788,11 @@ class DetectedObject_Classification final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -683,12 +801,23 @@ class DetectedObject_Classification final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.DetectedObject.Classification`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.DetectedObject.Classification"; }
 
   /// The full name of the message: `horus.pb.DetectedObject.Classification`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `DetectedObject_Classification`, e.g. to build a `PbFieldMask<DetectedObject_Classification>`.
+  enum class Field : PbTag {
+    /// Field `class_label`.
+    kClassLabel = 1,
+    /// Field `class_confidence`.
+    kClassConfidence = 2,
+  };
+
   // Field `class_label` (no 1).
   // -----
 
@@ -765,6 +894,10 @@ class DetectedObject_Classification final : public PbMessage {
     return std::move(set_class_confidence(class_confidence));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see class_label()
   ObjectLabel class_label_{};
@@ -813,6 +946,11 @@ class DetectedObject_Kinematics final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -821,20 +959,35 @@ class DetectedObject_Kinematics final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.DetectedObject.Kinematics`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.DetectedObject.Kinematics"; }
 
   /// The full name of the message: `horus.pb.DetectedObject.Kinematics`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `DetectedObject_Kinematics`, e.g. to build a `PbFieldMask<DetectedObject_Kinematics>`.
+  enum class Field : PbTag {
+    /// Field `linear_velocity`.
+    kLinearVelocity = 1,
+    /// Field `yaw_rate`.
+    kYawRate = 2,
+  };
+
   // Field `linear_velocity` (no 1).
   // -----
 
   /// The (X, Y) linear velocity in m/s.
   ///
   /// Field no: 1.
-  constexpr const Vector2f& linear_velocity() const& noexcept HORUS_LIFETIME_BOUND {
-    return linear_velocity_;
+  ///
+  /// If `linear_velocity` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `linear_velocity` was received and is not a valid message.
+  const Vector2f& linear_velocity() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return linear_velocity_.Ref();
   }
 
   /// If `linear_velocity` is set, moves it out of the message (without marking it as unset).
@@ -842,19 +995,23 @@ class DetectedObject_Kinematics final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  Vector2f linear_velocity() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `linear_velocity` was received and is not a valid message.
+  Vector2f linear_velocity() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(linear_velocity_);
+    return std::move(linear_velocity_).Take();
   }
 
   /// The (X, Y) linear velocity in m/s.
   ///
   /// Field no: 1.
-  Vector2f& mutable_linear_velocity() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `linear_velocity` was received and is not a valid message.
+  Vector2f& mutable_linear_velocity() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return linear_velocity_;
+    return linear_velocity_.Mutable();
   }
 
   /// Returns whether `linear_velocity` (no 1) is set.
@@ -863,13 +1020,13 @@ class DetectedObject_Kinematics final : public PbMessage {
   /// Clears `linear_velocity` (no 1).
   void clear_linear_velocity() & noexcept {
     set_fields_[0] = false;
-    linear_velocity_ = {};
+    linear_velocity_.Clear();
   }
 
   /// Sets `linear_velocity` (no 1) and returns `*this`.
   DetectedObject_Kinematics& set_linear_velocity(Vector2f&& linear_velocity) & noexcept {
     set_fields_[0] = true;
-    linear_velocity_ = std::move(linear_velocity);
+    linear_velocity_.Set(std::move(linear_velocity));
     return *this;
   }
   /// Sets `linear_velocity` (no 1) and returns `*this`.
@@ -919,9 +1076,13 @@ class DetectedObject_Kinematics final : public PbMessage {
     return std::move(set_yaw_rate(yaw_rate));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see linear_velocity()
-  Vector2f linear_velocity_{};
+  PbLazy<Vector2f> linear_velocity_{};
   /// @see yaw_rate()
   float yaw_rate_{};
 
@@ -967,6 +1128,11 @@ class DetectedObject_Shape final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -975,20 +1141,35 @@ class DetectedObject_Shape final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.DetectedObject.Shape`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.DetectedObject.Shape"; }
 
   /// The full name of the message: `horus.pb.DetectedObject.Shape`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `DetectedObject_Shape`, e.g. to build a `PbFieldMask<DetectedObject_Shape>`.
+  enum class Field : PbTag {
+    /// Field `bounding_box`.
+    kBoundingBox = 1,
+    /// Field `tight_bounding_box`.
+    kTightBoundingBox = 2,
+  };
+
   // Field `bounding_box` (no 1).
   // -----
 
   /// The bounding box of the detected object.
   ///
   /// Field no: 1.
-  constexpr const BoundingBox& bounding_box() const& noexcept HORUS_LIFETIME_BOUND {
-    return bounding_box_;
+  ///
+  /// If `bounding_box` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `bounding_box` was received and is not a valid message.
+  const BoundingBox& bounding_box() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return bounding_box_.Ref();
   }
 
   /// If `bounding_box` is set, moves it out of the message (without marking it as unset).
@@ -996,19 +1177,23 @@ class DetectedObject_Shape final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  BoundingBox bounding_box() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `bounding_box` was received and is not a valid message.
+  BoundingBox bounding_box() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(bounding_box_);
+    return std::move(bounding_box_).Take();
   }
 
   /// The bounding box of the detected object.
   ///
   /// Field no: 1.
-  BoundingBox& mutable_bounding_box() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `bounding_box` was received and is not a valid message.
+  BoundingBox& mutable_bounding_box() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return bounding_box_;
+    return bounding_box_.Mutable();
   }
 
   /// Returns whether `bounding_box` (no 1) is set.
@@ -1017,13 +1202,13 @@ class DetectedObject_Shape final : public PbMessage {
   /// Clears `bounding_box` (no 1).
   void clear_bounding_box() & noexcept {
     set_fields_[0] = false;
-    bounding_box_ = {};
+    bounding_box_.Clear();
   }
 
   /// Sets `bounding_box` (no 1) and returns `*this`.
   DetectedObject_Shape& set_bounding_box(BoundingBox&& bounding_box) & noexcept {
     set_fields_[0] = true;
-    bounding_box_ = std::move(bounding_box);
+    bounding_box_.Set(std::move(bounding_box));
     return *this;
   }
   /// Sets `bounding_box` (no 1) and returns `*this`.
@@ -1037,8 +1222,12 @@ class DetectedObject_Shape final : public PbMessage {
   /// The tight bounding box around the object points.
   ///
   /// Field no: 2.
-  constexpr const BoundingBox& tight_bounding_box() const& noexcept HORUS_LIFETIME_BOUND {
-    return tight_bounding_box_;
+  ///
+  /// If `tight_bounding_box` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `tight_bounding_box` was received and is not a valid message.
+  const BoundingBox& tight_bounding_box() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return tight_bounding_box_.Ref();
   }
 
   /// If `tight_bounding_box` is set, moves it out of the message (without marking it as unset).
@@ -1046,19 +1235,23 @@ class DetectedObject_Shape final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  BoundingBox tight_bounding_box() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `tight_bounding_box` was received and is not a valid message.
+  BoundingBox tight_bounding_box() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(tight_bounding_box_);
+    return std::move(tight_bounding_box_).Take();
   }
 
   /// The tight bounding box around the object points.
   ///
   /// Field no: 2.
-  BoundingBox& mutable_tight_bounding_box() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `tight_bounding_box` was received and is not a valid message.
+  BoundingBox& mutable_tight_bounding_box() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return tight_bounding_box_;
+    return tight_bounding_box_.Mutable();
   }
 
   /// Returns whether `tight_bounding_box` (no 2) is set.
@@ -1067,13 +1260,13 @@ class DetectedObject_Shape final : public PbMessage {
   /// Clears `tight_bounding_box` (no 2).
   void clear_tight_bounding_box() & noexcept {
     set_fields_[1] = false;
-    tight_bounding_box_ = {};
+    tight_bounding_box_.Clear();
   }
 
   /// Sets `tight_bounding_box` (no 2) and returns `*this`.
   DetectedObject_Shape& set_tight_bounding_box(BoundingBox&& tight_bounding_box) & noexcept {
     set_fields_[1] = true;
-    tight_bounding_box_ = std::move(tight_bounding_box);
+    tight_bounding_box_.Set(std::move(tight_bounding_box));
     return *this;
   }
   /// Sets `tight_bounding_box` (no 2) and returns `*this`.
@@ -1081,11 +1274,15 @@ class DetectedObject_Shape final : public PbMessage {
     return std::move(set_tight_bounding_box(std::move(tight_bounding_box)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see bounding_box()
-  BoundingBox bounding_box_{};
+  PbLazy<BoundingBox> bounding_box_{};
   /// @see tight_bounding_box()
-  BoundingBox tight_bounding_box_{};
+  PbLazy<BoundingBox> tight_bounding_box_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<2> set_fields_;
@@ -1129,6 +1326,11 @@ class DetectedObject_Status final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1137,12 +1339,27 @@ class DetectedObject_Status final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.DetectedObject.Status`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.DetectedObject.Status"; }
 
   /// The full name of the message: `horus.pb.DetectedObject.Status`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `DetectedObject_Status`, e.g. to build a `PbFieldMask<DetectedObject_Status>`.
+  enum class Field : PbTag {
+    /// Field `id`.
+    kId = 1,
+    /// Field `tracking_status`.
+    kTrackingStatus = 2,
+    /// Field `last_seen`.
+    kLastSeen = 3,
+    /// Field `observation_time_range`.
+    kObservationTimeRange = 4,
+  };
+
   // Field `id` (no 1).
   // -----
 
@@ -1227,8 +1444,12 @@ class DetectedObject_Status final : public PbMessage {
   /// The timestamp at which the detected object was last seen.
   ///
   /// Field no: 3.
-  constexpr const Timestamp& last_seen() const& noexcept HORUS_LIFETIME_BOUND {
-    return last_seen_;
+  ///
+  /// If `last_seen` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `last_seen` was received and is not a valid message.
+  const Timestamp& last_seen() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return last_seen_.Ref();
   }
 
   /// If `last_seen` is set, moves it out of the message (without marking it as unset).
@@ -1236,19 +1457,23 @@ class DetectedObject_Status final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 3.
-  Timestamp last_seen() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `last_seen` was received and is not a valid message.
+  Timestamp last_seen() && noexcept(false) {
     if (!set_fields_[2]) {
       return {};
     }
-    return std::move(last_seen_);
+    return std::move(last_seen_).Take();
   }
 
   /// The timestamp at which the detected object was last seen.
   ///
   /// Field no: 3.
-  Timestamp& mutable_last_seen() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `last_seen` was received and is not a valid message.
+  Timestamp& mutable_last_seen() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[2] = true;
-    return last_seen_;
+    return last_seen_.Mutable();
   }
 
   /// Returns whether `last_seen` (no 3) is set.
@@ -1257,13 +1482,13 @@ class DetectedObject_Status final : public PbMessage {
   /// Clears `last_seen` (no 3).
   void clear_last_seen() & noexcept {
     set_fields_[2] = false;
-    last_seen_ = {};
+    last_seen_.Clear();
   }
 
   /// Sets `last_seen` (no 3) and returns `*this`.
   DetectedObject_Status& set_last_seen(Timestamp&& last_seen) & noexcept {
     set_fields_[2] = true;
-    last_seen_ = std::move(last_seen);
+    last_seen_.Set(std::move(last_seen));
     return *this;
   }
   /// Sets `last_seen` (no 3) and returns `*this`.
@@ -1278,8 +1503,12 @@ class DetectedObject_Status final : public PbMessage {
   ///  detected object points.
   ///
   /// Field no: 4.
-  constexpr const TimeRange& observation_time_range() const& noexcept HORUS_LIFETIME_BOUND {
-    return observation_time_range_;
+  ///
+  /// If `observation_time_range` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `observation_time_range` was received and is not a valid message.
+  const TimeRange& observation_time_range() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return observation_time_range_.Ref();
   }
 
   /// If `observation_time_range` is set, moves it out of the message (without marking it as unset).
@@ -1287,20 +1516,24 @@ class DetectedObject_Status final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 4.
-  TimeRange observation_time_range() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `observation_time_range` was received and is not a valid message.
+  TimeRange observation_time_range() && noexcept(false) {
     if (!set_fields_[3]) {
       return {};
     }
-    return std::move(observation_time_range_);
+    return std::move(observation_time_range_).Take();
   }
 
   /// The start and end timestamps of the observation time range for the
   ///  detected object points.
   ///
   /// Field no: 4.
-  TimeRange& mutable_observation_time_range() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `observation_time_range` was received and is not a valid message.
+  TimeRange& mutable_observation_time_range() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[3] = true;
-    return observation_time_range_;
+    return observation_time_range_.Mutable();
   }
 
   /// Returns whether `observation_time_range` (no 4) is set.
@@ -1309,13 +1542,13 @@ class DetectedObject_Status final : public PbMessage {
   /// Clears `observation_time_range` (no 4).
   void clear_observation_time_range() & noexcept {
     set_fields_[3] = false;
-    observation_time_range_ = {};
+    observation_time_range_.Clear();
   }
 
   /// Sets `observation_time_range` (no 4) and returns `*this`.
   DetectedObject_Status& set_observation_time_range(TimeRange&& observation_time_range) & noexcept {
     set_fields_[3] = true;
-    observation_time_range_ = std::move(observation_time_range);
+    observation_time_range_.Set(std::move(observation_time_range));
     return *this;
   }
   /// Sets `observation_time_range` (no 4) and returns `*this`.
@@ -1323,15 +1556,19 @@ class DetectedObject_Status final : public PbMessage {
     return std::move(set_observation_time_range(std::move(observation_time_range)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see id()
   std::uint32_t id_{};
   /// @see tracking_status()
   TrackingStatus tracking_status_{};
   /// @see last_seen()
-  Timestamp last_seen_{};
+  PbLazy<Timestamp> last_seen_{};
   /// @see observation_time_range()
-  TimeRange observation_time_range_{};
+  PbLazy<TimeRange> observation_time_range_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<4> set_fields_;
@@ -1383,6 +1620,11 @@ class DetectedObject final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1391,20 +1633,41 @@ class DetectedObject final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.DetectedObject`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.DetectedObject"; }
 
   /// The full name of the message: `horus.pb.DetectedObject`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `DetectedObject`, e.g. to build a `PbFieldMask<DetectedObject>`.
+  enum class Field : PbTag {
+    /// Field `classification`.
+    kClassification = 1,
+    /// Field `kinematics`.
+    kKinematics = 2,
+    /// Field `shape`.
+    kShape = 3,
+    /// Field `status`.
+    kStatus = 4,
+    /// Field `event_zone_ids`.
+    kEventZoneIds = 5,
+  };
+
   // Field `classification` (no 1).
   // -----
 
   /// No documentation.
   ///
   /// Field no: 1.
-  constexpr const DetectedObject_Classification& classification() const& noexcept HORUS_LIFETIME_BOUND {
-    return classification_;
+  ///
+  /// If `classification` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `classification` was received and is not a valid message.
+  const DetectedObject_Classification& classification() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return classification_.Ref();
   }
 
   /// If `classification` is set, moves it out of the message (without marking it as unset).
@@ -1412,19 +1675,23 @@ class DetectedObject final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  DetectedObject_Classification classification() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `classification` was received and is not a valid message.
+  DetectedObject_Classification classification() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(classification_);
+    return std::move(classification_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 1.
-  DetectedObject_Classification& mutable_classification() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `classification` was received and is not a valid message.
+  DetectedObject_Classification& mutable_classification() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return classification_;
+    return classification_.Mutable();
   }
 
   /// Returns whether `classification` (no 1) is set.
@@ -1433,13 +1700,13 @@ class DetectedObject final : public PbMessage {
   /// Clears `classification` (no 1).
   void clear_classification() & noexcept {
     set_fields_[0] = false;
-    classification_ = {};
+    classification_.Clear();
   }
 
   /// Sets `classification` (no 1) and returns `*this`.
   DetectedObject& set_classification(DetectedObject_Classification&& classification) & noexcept {
     set_fields_[0] = true;
-    classification_ = std::move(classification);
+    classification_.Set(std::move(classification));
     return *this;
   }
   /// Sets `classification` (no 1) and returns `*this`.
@@ -1453,8 +1720,12 @@ class DetectedObject final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 2.
-  constexpr const DetectedObject_Kinematics& kinematics() const& noexcept HORUS_LIFETIME_BOUND {
-    return kinematics_;
+  ///
+  /// If `kinematics` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `kinematics` was received and is not a valid message.
+  const DetectedObject_Kinematics& kinematics() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return kinematics_.Ref();
   }
 
   /// If `kinematics` is set, moves it out of the message (without marking it as unset).
@@ -1462,19 +1733,23 @@ class DetectedObject final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  DetectedObject_Kinematics kinematics() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `kinematics` was received and is not a valid message.
+  DetectedObject_Kinematics kinematics() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(kinematics_);
+    return std::move(kinematics_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 2.
-  DetectedObject_Kinematics& mutable_kinematics() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `kinematics` was received and is not a valid message.
+  DetectedObject_Kinematics& mutable_kinematics() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return kinematics_;
+    return kinematics_.Mutable();
   }
 
   /// Returns whether `kinematics` (no 2) is set.
@@ -1483,13 +1758,13 @@ class DetectedObject final : public PbMessage {
   /// Clears `kinematics` (no 2).
   void clear_kinematics() & noexcept {
     set_fields_[1] = false;
-    kinematics_ = {};
+    kinematics_.Clear();
   }
 
   /// Sets `kinematics` (no 2) and returns `*this`.
   DetectedObject& set_kinematics(DetectedObject_Kinematics&& kinematics) & noexcept {
     set_fields_[1] = true;
-    kinematics_ = std::move(kinematics);
+    kinematics_.Set(std::move(kinematics));
     return *this;
   }
   /// Sets `kinematics` (no 2) and returns `*this`.
@@ -1503,8 +1778,12 @@ class DetectedObject final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 3.
-  constexpr const DetectedObject_Shape& shape() const& noexcept HORUS_LIFETIME_BOUND {
-    return shape_;
+  ///
+  /// If `shape` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `shape` was received and is not a valid message.
+  const DetectedObject_Shape& shape() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return shape_.Ref();
   }
 
   /// If `shape` is set, moves it out of the message (without marking it as unset).
@@ -1512,19 +1791,23 @@ class DetectedObject final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 3.
-  DetectedObject_Shape shape() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `shape` was received and is not a valid message.
+  DetectedObject_Shape shape() && noexcept(false) {
     if (!set_fields_[2]) {
       return {};
     }
-    return std::move(shape_);
+    return std::move(shape_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 3.
-  DetectedObject_Shape& mutable_shape() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `shape` was received and is not a valid message.
+  DetectedObject_Shape& mutable_shape() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[2] = true;
-    return shape_;
+    return shape_.Mutable();
   }
 
   /// Returns whether `shape` (no 3) is set.
@@ -1533,13 +1816,13 @@ class DetectedObject final : public PbMessage {
   /// Clears `shape` (no 3).
   void clear_shape() & noexcept {
     set_fields_[2] = false;
-    shape_ = {};
+    shape_.Clear();
   }
 
   /// Sets `shape` (no 3) and returns `*this`.
   DetectedObject& set_shape(DetectedObject_Shape&& shape) & noexcept {
     set_fields_[2] = true;
-    shape_ = std::move(shape);
+    shape_.Set(std::move(shape));
     return *this;
   }
   /// Sets `shape` (no 3) and returns `*this`.
@@ -1553,8 +1836,12 @@ class DetectedObject final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 4.
-  constexpr const DetectedObject_Status& status() const& noexcept HORUS_LIFETIME_BOUND {
-    return status_;
+  ///
+  /// If `status` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `status` was received and is not a valid message.
+  const DetectedObject_Status& status() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return status_.Ref();
   }
 
   /// If `status` is set, moves it out of the message (without marking it as unset).
@@ -1562,19 +1849,23 @@ class DetectedObject final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 4.
-  DetectedObject_Status status() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `status` was received and is not a valid message.
+  DetectedObject_Status status() && noexcept(false) {
     if (!set_fields_[3]) {
       return {};
     }
-    return std::move(status_);
+    return std::move(status_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 4.
-  DetectedObject_Status& mutable_status() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `status` was received and is not a valid message.
+  DetectedObject_Status& mutable_status() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[3] = true;
-    return status_;
+    return status_.Mutable();
   }
 
   /// Returns whether `status` (no 4) is set.
@@ -1583,13 +1874,13 @@ class DetectedObject final : public PbMessage {
   /// Clears `status` (no 4).
   void clear_status() & noexcept {
     set_fields_[3] = false;
-    status_ = {};
+    status_.Clear();
   }
 
   /// Sets `status` (no 4) and returns `*this`.
   DetectedObject& set_status(DetectedObject_Status&& status) & noexcept {
     set_fields_[3] = true;
-    status_ = std::move(status);
+    status_.Set(std::move(status));
     return *this;
   }
   /// Sets `status` (no 4) and returns `*this`.
@@ -1647,15 +1938,19 @@ class DetectedObject final : public PbMessage {
     return std::move(set_event_zone_ids(std::move(event_zone_ids)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see classification()
-  DetectedObject_Classification classification_{};
+  PbLazy<DetectedObject_Classification> classification_{};
   /// @see kinematics()
-  DetectedObject_Kinematics kinematics_{};
+  PbLazy<DetectedObject_Kinematics> kinematics_{};
   /// @see shape()
-  DetectedObject_Shape shape_{};
+  PbLazy<DetectedObject_Shape> shape_{};
   /// @see status()
-  DetectedObject_Status status_{};
+  PbLazy<DetectedObject_Status> status_{};
   /// @see event_zone_ids()
   CowRepeated<CowBytes> event_zone_ids_{};
 
@@ -1703,6 +1998,11 @@ class ZoneEvent final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1711,20 +2011,41 @@ class ZoneEvent final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.ZoneEvent`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.ZoneEvent"; }
 
   /// The full name of the message: `horus.pb.ZoneEvent`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ZoneEvent`, e.g. to build a `PbFieldMask<ZoneEvent>`.
+  enum class Field : PbTag {
+    /// Field `timestamp`.
+    kTimestamp = 1,
+    /// Field `zone_id`.
+    kZoneId = 2,
+    /// Field `type`.
+    kType = 3,
+    /// Field `object`.
+    kObject = 4,
+    /// Field `object_id`.
+    kObjectId = 5,
+  };
+
   // Field `timestamp` (no 1).
   // -----
 
   /// The frame timestamp at which the event occurred.
   ///
   /// Field no: 1.
-  constexpr const Timestamp& timestamp() const& noexcept HORUS_LIFETIME_BOUND {
-    return timestamp_;
+  ///
+  /// If `timestamp` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `timestamp` was received and is not a valid message.
+  const Timestamp& timestamp() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return timestamp_.Ref();
   }
 
   /// If `timestamp` is set, moves it out of the message (without marking it as unset).
@@ -1732,19 +2053,23 @@ class ZoneEvent final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  Timestamp timestamp() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `timestamp` was received and is not a valid message.
+  Timestamp timestamp() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(timestamp_);
+    return std::move(timestamp_).Take();
   }
 
   /// The frame timestamp at which the event occurred.
   ///
   /// Field no: 1.
-  Timestamp& mutable_timestamp() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `timestamp` was received and is not a valid message.
+  Timestamp& mutable_timestamp() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return timestamp_;
+    return timestamp_.Mutable();
   }
 
   /// Returns whether `timestamp` (no 1) is set.
@@ -1753,13 +2078,13 @@ class ZoneEvent final : public PbMessage {
   /// Clears `timestamp` (no 1).
   void clear_timestamp() & noexcept {
     set_fields_[0] = false;
-    timestamp_ = {};
+    timestamp_.Clear();
   }
 
   /// Sets `timestamp` (no 1) and returns `*this`.
   ZoneEvent& set_timestamp(Timestamp&& timestamp) & noexcept {
     set_fields_[0] = true;
-    timestamp_ = std::move(timestamp);
+    timestamp_.Set(std::move(timestamp));
     return *this;
   }
   /// Sets `timestamp` (no 1) and returns `*this`.
@@ -1988,9 +2313,13 @@ class ZoneEvent final : public PbMessage {
     }
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see timestamp()
-  Timestamp timestamp_{};
+  PbLazy<Timestamp> timestamp_{};
   /// @see zone_id()
   CowBytes zone_id_{};
   /// @see type()
@@ -2045,6 +2374,11 @@ class ZoneEventList final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -2053,12 +2387,21 @@ class ZoneEventList final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.ZoneEventList`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.ZoneEventList"; }
 
   /// The full name of the message: `horus.pb.ZoneEventList`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ZoneEventList`, e.g. to build a `PbFieldMask<ZoneEventList>`.
+  enum class Field : PbTag {
+    /// Field `zone_events`.
+    kZoneEvents = 1,
+  };
+
   // Field `zone_events` (no 1).
   // -----
 
@@ -2109,6 +2452,10 @@ class ZoneEventList final : public PbMessage {
     return std::move(set_zone_events(std::move(zone_events)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see zone_events()
   CowRepeated<ZoneEvent> zone_events_{};
@@ -2155,6 +2502,11 @@ class DeepLearningObject_Classification final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -2163,12 +2515,23 @@ class DeepLearningObject_Classification final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.DeepLearningObject.Classification`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.DeepLearningObject.Classification"; }
 
   /// The full name of the message: `horus.pb.DeepLearningObject.Classification`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `DeepLearningObject_Classification`, e.g. to build a `PbFieldMask<DeepLearningObject_Classification>`.
+  enum class Field : PbTag {
+    /// Field `class_label`.
+    kClassLabel = 1,
+    /// Field `class_confidence`.
+    kClassConfidence = 2,
+  };
+
   // Field `class_label` (no 1).
   // -----
 
@@ -2245,6 +2608,10 @@ class DeepLearningObject_Classification final : public PbMessage {
     return std::move(set_class_confidence(class_confidence));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see class_label()
   ObjectLabel class_label_{};
@@ -2295,6 +2662,11 @@ class DeepLearningObject final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -2303,20 +2675,37 @@ class DeepLearningObject final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.DeepLearningObject`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.DeepLearningObject"; }
 
   /// The full name of the message: `horus.pb.DeepLearningObject`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `DeepLearningObject`, e.g. to build a `PbFieldMask<DeepLearningObject>`.
+  enum class Field : PbTag {
+    /// Field `classification`.
+    kClassification = 1,
+    /// Field `bounding_box`.
+    kBoundingBox = 2,
+    /// Field `associated_object_id`.
+    kAssociatedObjectId = 3,
+  };
+
   // Field `classification` (no 1).
   // -----
 
   /// The label of the detected object.
   ///
   /// Field no: 1.
-  constexpr const DeepLearningObject_Classification& classification() const& noexcept HORUS_LIFETIME_BOUND {
-    return classification_;
+  ///
+  /// If `classification` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `classification` was received and is not a valid message.
+  const DeepLearningObject_Classification& classification() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return classification_.Ref();
   }
 
   /// If `classification` is set, moves it out of the message (without marking it as unset).
@@ -2324,19 +2713,23 @@ class DeepLearningObject final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  DeepLearningObject_Classification classification() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `classification` was received and is not a valid message.
+  DeepLearningObject_Classification classification() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(classification_);
+    return std::move(classification_).Take();
   }
 
   /// The label of the detected object.
   ///
   /// Field no: 1.
-  DeepLearningObject_Classification& mutable_classification() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `classification` was received and is not a valid message.
+  DeepLearningObject_Classification& mutable_classification() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return classification_;
+    return classification_.Mutable();
   }
 
   /// Returns whether `classification` (no 1) is set.
@@ -2345,13 +2738,13 @@ class DeepLearningObject final : public PbMessage {
   /// Clears `classification` (no 1).
   void clear_classification() & noexcept {
     set_fields_[0] = false;
-    classification_ = {};
+    classification_.Clear();
   }
 
   /// Sets `classification` (no 1) and returns `*this`.
   DeepLearningObject& set_classification(DeepLearningObject_Classification&& classification) & noexcept {
     set_fields_[0] = true;
-    classification_ = std::move(classification);
+    classification_.Set(std::move(classification));
     return *this;
   }
   /// Sets `classification` (no 1) and returns `*this`.
@@ -2365,8 +2758,12 @@ class DeepLearningObject final : public PbMessage {
   /// The bounding box of the detected object.
   ///
   /// Field no: 2.
-  constexpr const BoundingBox& bounding_box() const& noexcept HORUS_LIFETIME_BOUND {
-    return bounding_box_;
+  ///
+  /// If `bounding_box` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `bounding_box` was received and is not a valid message.
+  const BoundingBox& bounding_box() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return bounding_box_.Ref();
   }
 
   /// If `bounding_box` is set, moves it out of the message (without marking it as unset).
@@ -2374,19 +2771,23 @@ class DeepLearningObject final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  BoundingBox bounding_box() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `bounding_box` was received and is not a valid message.
+  BoundingBox bounding_box() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(bounding_box_);
+    return std::move(bounding_box_).Take();
   }
 
   /// The bounding box of the detected object.
   ///
   /// Field no: 2.
-  BoundingBox& mutable_bounding_box() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `bounding_box` was received and is not a valid message.
+  BoundingBox& mutable_bounding_box() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return bounding_box_;
+    return bounding_box_.Mutable();
   }
 
   /// Returns whether `bounding_box` (no 2) is set.
@@ -2395,13 +2796,13 @@ class DeepLearningObject final : public PbMessage {
   /// Clears `bounding_box` (no 2).
   void clear_bounding_box() & noexcept {
     set_fields_[1] = false;
-    bounding_box_ = {};
+    bounding_box_.Clear();
   }
 
   /// Sets `bounding_box` (no 2) and returns `*this`.
   DeepLearningObject& set_bounding_box(BoundingBox&& bounding_box) & noexcept {
     set_fields_[1] = true;
-    bounding_box_ = std::move(bounding_box);
+    bounding_box_.Set(std::move(bounding_box));
     return *this;
   }
   /// Sets `bounding_box` (no 2) and returns `*this`.
@@ -2451,11 +2852,15 @@ class DeepLearningObject final : public PbMessage {
     return std::move(set_associated_object_id(associated_object_id));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see classification()
-  DeepLearningObject_Classification classification_{};
+  PbLazy<DeepLearningObject_Classification> classification_{};
   /// @see bounding_box()
-  BoundingBox bounding_box_{};
+  PbLazy<BoundingBox> bounding_box_{};
   /// @see associated_object_id()
   std::uint32_t associated_object_id_{};
 
@@ -2504,6 +2909,9 @@ class DebugMergerInfo final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -2514,6 +2922,9 @@ class DebugMergerInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.DebugMergerInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.DebugMergerInfo"; }
 
@@ -2564,6 +2975,11 @@ class DetectionEvent_FrameInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -2572,20 +2988,33 @@ class DetectionEvent_FrameInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.DetectionEvent.FrameInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.DetectionEvent.FrameInfo"; }
 
   /// The full name of the message: `horus.pb.DetectionEvent.FrameInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `DetectionEvent_FrameInfo`, e.g. to build a `PbFieldMask<DetectionEvent_FrameInfo>`.
+  enum class Field : PbTag {
+    /// Field `frame_timestamp`.
+    kFrameTimestamp = 1,
+  };
+
   // Field `frame_timestamp` (no 1).
   // -----
 
   /// The detection frame timestamp.
   ///
   /// Field no: 1.
-  constexpr const Timestamp& frame_timestamp() const& noexcept HORUS_LIFETIME_BOUND {
-    return frame_timestamp_;
+  ///
+  /// If `frame_timestamp` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `frame_timestamp` was received and is not a valid message.
+  const Timestamp& frame_timestamp() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return frame_timestamp_.Ref();
   }
 
   /// If `frame_timestamp` is set, moves it out of the message (without marking it as unset).
@@ -2593,19 +3022,23 @@ class DetectionEvent_FrameInfo final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  Timestamp frame_timestamp() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `frame_timestamp` was received and is not a valid message.
+  Timestamp frame_timestamp() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(frame_timestamp_);
+    return std::move(frame_timestamp_).Take();
   }
 
   /// The detection frame timestamp.
   ///
   /// Field no: 1.
-  Timestamp& mutable_frame_timestamp() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `frame_timestamp` was received and is not a valid message.
+  Timestamp& mutable_frame_timestamp() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return frame_timestamp_;
+    return frame_timestamp_.Mutable();
   }
 
   /// Returns whether `frame_timestamp` (no 1) is set.
@@ -2614,13 +3047,13 @@ class DetectionEvent_FrameInfo final : public PbMessage {
   /// Clears `frame_timestamp` (no 1).
   void clear_frame_timestamp() & noexcept {
     set_fields_[0] = false;
-    frame_timestamp_ = {};
+    frame_timestamp_.Clear();
   }
 
   /// Sets `frame_timestamp` (no 1) and returns `*this`.
   DetectionEvent_FrameInfo& set_frame_timestamp(Timestamp&& frame_timestamp) & noexcept {
     set_fields_[0] = true;
-    frame_timestamp_ = std::move(frame_timestamp);
+    frame_timestamp_.Set(std::move(frame_timestamp));
     return *this;
   }
   /// Sets `frame_timestamp` (no 1) and returns `*this`.
@@ -2628,9 +3061,13 @@ class DetectionEvent_FrameInfo final : public PbMessage {
     return std::move(set_frame_timestamp(std::move(frame_timestamp)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see frame_timestamp()
-  Timestamp frame_timestamp_{};
+  PbLazy<Timestamp> frame_timestamp_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<1> set_fields_;
@@ -2676,6 +3113,11 @@ class DetectionEvent final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -2684,12 +3126,37 @@ class DetectionEvent final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.DetectionEvent`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.DetectionEvent"; }
 
   /// The full name of the message: `horus.pb.DetectionEvent`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `DetectionEvent`, e.g. to build a `PbFieldMask<DetectionEvent>`.
+  enum class Field : PbTag {
+    /// Field `objects`.
+    kObjects = 1,
+    /// Field `labeled_point_clouds`.
+    kLabeledPointClouds = 2,
+    /// Field `frame_info`.
+    kFrameInfo = 3,
+    /// Field `raw_deep_learning_objects`.
+    kRawDeepLearningObjects = 4,
+    /// Field `unrecovered_object_ids`.
+    kUnrecoveredObjectIds = 5,
+    /// Field `is_replaying`.
+    kIsReplaying = 6,
+    /// Field `overall_frame_latency`.
+    kOverallFrameLatency = 7,
+    /// Field `publishing_time`.
+    kPublishingTime = 8,
+    /// Field `debug_merger_info`.
+    kDebugMergerInfo = 9,
+  };
+
   // Field `objects` (no 1).
   // -----
 
@@ -2796,8 +3263,12 @@ class DetectionEvent final : public PbMessage {
   /// The frame info of the detection event.
   ///
   /// Field no: 3.
-  constexpr const DetectionEvent_FrameInfo& frame_info() const& noexcept HORUS_LIFETIME_BOUND {
-    return frame_info_;
+  ///
+  /// If `frame_info` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `frame_info` was received and is not a valid message.
+  const DetectionEvent_FrameInfo& frame_info() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return frame_info_.Ref();
   }
 
   /// If `frame_info` is set, moves it out of the message (without marking it as unset).
@@ -2805,19 +3276,23 @@ class DetectionEvent final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 3.
-  DetectionEvent_FrameInfo frame_info() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `frame_info` was received and is not a valid message.
+  DetectionEvent_FrameInfo frame_info() && noexcept(false) {
     if (!set_fields_[2]) {
       return {};
     }
-    return std::move(frame_info_);
+    return std::move(frame_info_).Take();
   }
 
   /// The frame info of the detection event.
   ///
   /// Field no: 3.
-  DetectionEvent_FrameInfo& mutable_frame_info() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `frame_info` was received and is not a valid message.
+  DetectionEvent_FrameInfo& mutable_frame_info() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[2] = true;
-    return frame_info_;
+    return frame_info_.Mutable();
   }
 
   /// Returns whether `frame_info` (no 3) is set.
@@ -2826,13 +3301,13 @@ class DetectionEvent final : public PbMessage {
   /// Clears `frame_info` (no 3).
   void clear_frame_info() & noexcept {
     set_fields_[2] = false;
-    frame_info_ = {};
+    frame_info_.Clear();
   }
 
   /// Sets `frame_info` (no 3) and returns `*this`.
   DetectionEvent& set_frame_info(DetectionEvent_FrameInfo&& frame_info) & noexcept {
     set_fields_[2] = true;
-    frame_info_ = std::move(frame_info);
+    frame_info_.Set(std::move(frame_info));
     return *this;
   }
   /// Sets `frame_info` (no 3) and returns `*this`.
@@ -2991,8 +3466,12 @@ class DetectionEvent final : public PbMessage {
   ///  earliest LiDAR point arrival to the publishing of this event.
   ///
   /// Field no: 7.
-  constexpr const Duration& overall_frame_latency() const& noexcept HORUS_LIFETIME_BOUND {
-    return overall_frame_latency_;
+  ///
+  /// If `overall_frame_latency` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `overall_frame_latency` was received and is not a valid message.
+  const Duration& overall_frame_latency() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return overall_frame_latency_.Ref();
   }
 
   /// If `overall_frame_latency` is set, moves it out of the message (without marking it as unset).
@@ -3000,20 +3479,24 @@ class DetectionEvent final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 7.
-  Duration overall_frame_latency() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `overall_frame_latency` was received and is not a valid message.
+  Duration overall_frame_latency() && noexcept(false) {
     if (!set_fields_[6]) {
       return {};
     }
-    return std::move(overall_frame_latency_);
+    return std::move(overall_frame_latency_).Take();
   }
 
   /// The total frame latency computed by this detection service node, from the
   ///  earliest LiDAR point arrival to the publishing of this event.
   ///
   /// Field no: 7.
-  Duration& mutable_overall_frame_latency() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `overall_frame_latency` was received and is not a valid message.
+  Duration& mutable_overall_frame_latency() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[6] = true;
-    return overall_frame_latency_;
+    return overall_frame_latency_.Mutable();
   }
 
   /// Returns whether `overall_frame_latency` (no 7) is set.
@@ -3022,13 +3505,13 @@ class DetectionEvent final : public PbMessage {
   /// Clears `overall_frame_latency` (no 7).
   void clear_overall_frame_latency() & noexcept {
     set_fields_[6] = false;
-    overall_frame_latency_ = {};
+    overall_frame_latency_.Clear();
   }
 
   /// Sets `overall_frame_latency` (no 7) and returns `*this`.
   DetectionEvent& set_overall_frame_latency(Duration&& overall_frame_latency) & noexcept {
     set_fields_[6] = true;
-    overall_frame_latency_ = std::move(overall_frame_latency);
+    overall_frame_latency_.Set(std::move(overall_frame_latency));
     return *this;
   }
   /// Sets `overall_frame_latency` (no 7) and returns `*this`.
@@ -3042,8 +3525,12 @@ class DetectionEvent final : public PbMessage {
   /// The system time when this detection service published this event.
   ///
   /// Field no: 8.
-  constexpr const Timestamp& publishing_time() const& noexcept HORUS_LIFETIME_BOUND {
-    return publishing_time_;
+  ///
+  /// If `publishing_time` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `publishing_time` was received and is not a valid message.
+  const Timestamp& publishing_time() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return publishing_time_.Ref();
   }
 
   /// If `publishing_time` is set, moves it out of the message (without marking it as unset).
@@ -3051,19 +3538,23 @@ class DetectionEvent final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 8.
-  Timestamp publishing_time() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `publishing_time` was received and is not a valid message.
+  Timestamp publishing_time() && noexcept(false) {
     if (!set_fields_[7]) {
       return {};
     }
-    return std::move(publishing_time_);
+    return std::move(publishing_time_).Take();
   }
 
   /// The system time when this detection service published this event.
   ///
   /// Field no: 8.
-  Timestamp& mutable_publishing_time() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `publishing_time` was received and is not a valid message.
+  Timestamp& mutable_publishing_time() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[7] = true;
-    return publishing_time_;
+    return publishing_time_.Mutable();
   }
 
   /// Returns whether `publishing_time` (no 8) is set.
@@ -3072,13 +3563,13 @@ class DetectionEvent final : public PbMessage {
   /// Clears `publishing_time` (no 8).
   void clear_publishing_time() & noexcept {
     set_fields_[7] = false;
-    publishing_time_ = {};
+    publishing_time_.Clear();
   }
 
   /// Sets `publishing_time` (no 8) and returns `*this`.
   DetectionEvent& set_publishing_time(Timestamp&& publishing_time) & noexcept {
     set_fields_[7] = true;
-    publishing_time_ = std::move(publishing_time);
+    publishing_time_.Set(std::move(publishing_time));
     return *this;
   }
   /// Sets `publishing_time` (no 8) and returns `*this`.
@@ -3094,8 +3585,12 @@ class DetectionEvent final : public PbMessage {
   ///  merger configuration.
   ///
   /// Field no: 9.
-  constexpr const DebugMergerInfo& debug_merger_info() const& noexcept HORUS_LIFETIME_BOUND {
-    return debug_merger_info_;
+  ///
+  /// If `debug_merger_info` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `debug_merger_info` was received and is not a valid message.
+  const DebugMergerInfo& debug_merger_info() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return debug_merger_info_.Ref();
   }
 
   /// If `debug_merger_info` is set, moves it out of the message (without marking it as unset).
@@ -3103,11 +3598,13 @@ class DetectionEvent final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 9.
-  DebugMergerInfo debug_merger_info() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `debug_merger_info` was received and is not a valid message.
+  DebugMergerInfo debug_merger_info() && noexcept(false) {
     if (!set_fields_[8]) {
       return {};
     }
-    return std::move(debug_merger_info_);
+    return std::move(debug_merger_info_).Take();
   }
 
   /// Optional debug info containing pre-merge local objects from each detection
@@ -3115,9 +3612,11 @@ class DetectionEvent final : public PbMessage {
   ///  merger configuration.
   ///
   /// Field no: 9.
-  DebugMergerInfo& mutable_debug_merger_info() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `debug_merger_info` was received and is not a valid message.
+  DebugMergerInfo& mutable_debug_merger_info() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[8] = true;
-    return debug_merger_info_;
+    return debug_merger_info_.Mutable();
   }
 
   /// Returns whether `debug_merger_info` (no 9) is set.
@@ -3126,13 +3625,13 @@ class DetectionEvent final : public PbMessage {
   /// Clears `debug_merger_info` (no 9).
   void clear_debug_merger_info() & noexcept {
     set_fields_[8] = false;
-    debug_merger_info_ = {};
+    debug_merger_info_.Clear();
   }
 
   /// Sets `debug_merger_info` (no 9) and returns `*this`.
   DetectionEvent& set_debug_merger_info(DebugMergerInfo&& debug_merger_info) & noexcept {
     set_fields_[8] = true;
-    debug_merger_info_ = std::move(debug_merger_info);
+    debug_merger_info_.Set(std::move(debug_merger_info));
     return *this;
   }
   /// Sets `debug_merger_info` (no 9) and returns `*this`.
@@ -3140,13 +3639,17 @@ class DetectionEvent final : public PbMessage {
     return std::move(set_debug_merger_info(std::move(debug_merger_info)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see objects()
   CowRepeated<DetectedObject> objects_{};
   /// @see labeled_point_clouds()
   CowRepeated<LabeledPointCloud> labeled_point_clouds_{};
   /// @see frame_info()
-  DetectionEvent_FrameInfo frame_info_{};
+  PbLazy<DetectionEvent_FrameInfo> frame_info_{};
   /// @see raw_deep_learning_objects()
   CowRepeated<DeepLearningObject> raw_deep_learning_objects_{};
   /// @see unrecovered_object_ids()
@@ -3154,11 +3657,11 @@ class DetectionEvent final : public PbMessage {
   /// @see is_replaying()
   bool is_replaying_{};
   /// @see overall_frame_latency()
-  Duration overall_frame_latency_{};
+  PbLazy<Duration> overall_frame_latency_{};
   /// @see publishing_time()
-  Timestamp publishing_time_{};
+  PbLazy<Timestamp> publishing_time_{};
   /// @see debug_merger_info()
-  DebugMergerInfo debug_merger_info_{};
+  PbLazy<DebugMergerInfo> debug_merger_info_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<9> set_fields_;
@@ -3256,6 +3759,11 @@ class PbTraits<horus::sdk::pb::ObjectLabel> final {
     writer.Writer().add_enum(tag, static_cast<PbEnum>(value));
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, horus::sdk::pb::ObjectLabel value) noexcept {
+    return PbTraits<PbEnum>::ByteSize(tag, static_cast<PbEnum>(value));
+  }
+
   /// Deserializes `horus::sdk::pb::ObjectLabel` from `reader`.
   static horus::sdk::pb::ObjectLabel Deserialize(PbReader& reader) {
     return PbEnumTraits<horus::sdk::pb::ObjectLabel>::ValueOf(reader.Reader().get_enum());
@@ -3346,6 +3854,11 @@ class PbTraits<horus::sdk::pb::TrackingStatus> final {
     writer.Writer().add_enum(tag, static_cast<PbEnum>(value));
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, horus::sdk::pb::TrackingStatus value) noexcept {
+    return PbTraits<PbEnum>::ByteSize(tag, static_cast<PbEnum>(value));
+  }
+
   /// Deserializes `horus::sdk::pb::TrackingStatus` from `reader`.
   static horus::sdk::pb::TrackingStatus Deserialize(PbReader& reader) {
     return PbEnumTraits<horus::sdk::pb::TrackingStatus>::ValueOf(reader.Reader().get_enum());
@@ -3418,6 +3931,11 @@ class PbTraits<horus::sdk::pb::ZoneEvent_Type> final {
     writer.Writer().add_enum(tag, static_cast<PbEnum>(value));
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, horus::sdk::pb::ZoneEvent_Type value) noexcept {
+    return PbTraits<PbEnum>::ByteSize(tag, static_cast<PbEnum>(value));
+  }
+
   /// Deserializes `horus::sdk::pb::ZoneEvent_Type` from `reader`.
   static horus::sdk::pb::ZoneEvent_Type Deserialize(PbReader& reader) {
     return PbEnumTraits<horus::sdk::pb::ZoneEvent_Type>::ValueOf(reader.Reader().get_enum());
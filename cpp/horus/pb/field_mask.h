@@ -0,0 +1,160 @@
+/// @file
+///
+/// The `PbFieldMask` class.
+
+#ifndef HORUS_PB_FIELD_MASK_H_
+#define HORUS_PB_FIELD_MASK_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "horus/internal/type_traits.h"
+#include "horus/pb/types.h"
+
+namespace horus {
+namespace horus_internal {
+
+/// A set of tags skipped during deserialization. This is the untyped representation of a
+/// `PbFieldMask`.
+class PbSkippedTags final {
+ public:
+  /// Constructs an empty set.
+  PbSkippedTags() noexcept = default;
+
+  /// Returns whether `tag` is in the set.
+  bool Contains(PbTag tag) const noexcept {
+    if (tag < kMaxLowTag) {
+      return (low_tags_ & (std::uint64_t{1} << tag)) != 0;
+    }
+    return std::binary_search(high_tags_.begin(), high_tags_.end(), tag);
+  }
+
+  /// Returns whether the set is empty.
+  bool IsEmpty() const noexcept { return low_tags_ == 0 && high_tags_.empty(); }
+
+  /// Adds `tag` to the set.
+  ///
+  /// @throws std::bad_alloc If `tag` is 64 or greater and cannot be added.
+  void Add(PbTag tag) noexcept(false) {
+    if (tag < kMaxLowTag) {
+      low_tags_ |= std::uint64_t{1} << tag;
+    } else if (!Contains(tag)) {
+      static_cast<void>(high_tags_.insert(
+          std::lower_bound(high_tags_.begin(), high_tags_.end(), tag), tag));
+    }
+  }
+
+  /// Removes `tag` from the set.
+  void Remove(PbTag tag) noexcept {
+    if (tag < kMaxLowTag) {
+      low_tags_ &= ~(std::uint64_t{1} << tag);
+    } else {
+      const auto it = std::lower_bound(high_tags_.begin(), high_tags_.end(), tag);
+      if (it != high_tags_.end() && *it == tag) {
+        static_cast<void>(high_tags_.erase(it));
+      }
+    }
+  }
+
+  /// Returns the tags which are in both `*this` and `other`.
+  ///
+  /// @throws std::bad_alloc If the result cannot be allocated.
+  PbSkippedTags Intersect(const PbSkippedTags& other) const noexcept(false) {
+    PbSkippedTags result;
+    result.low_tags_ = low_tags_ & other.low_tags_;
+    static_cast<void>(std::set_intersection(high_tags_.begin(), high_tags_.end(),
+                                            other.high_tags_.begin(), other.high_tags_.end(),
+                                            std::back_inserter(result.high_tags_)));
+    return result;
+  }
+
+ private:
+  /// Tags below this value are stored in `low_tags_`.
+  static constexpr PbTag kMaxLowTag{64};
+
+  /// Bit `n` is set if tag `n` is in the set.
+  std::uint64_t low_tags_{0};
+  /// The sorted tags greater than or equal to `kMaxLowTag`.
+  std::vector<PbTag> high_tags_;
+};
+
+/// The generated `Field` enum of the message `T`.
+template <class T>
+using PbFieldOf = typename T::Field;
+
+}  // namespace horus_internal
+
+/// The set of fields of the message `T` to skip when deserializing it.
+///
+/// Skipped fields are not deserialized at all (no `PbView` is created for them), and are therefore
+/// not set in the resulting message. This is used to avoid deserializing large fields which are
+/// not read, such as `DetectionEvent::labeled_point_clouds()`.
+///
+/// Masks only apply to the top-level message; submessages are always fully deserialized.
+template <class T>
+class PbFieldMask final {
+ public:
+  /// The type of the fields of `T`: `T::Field` for generated messages, and `PbTag` otherwise.
+  using Field = typename horus_internal::Detector<PbTag, void, horus_internal::PbFieldOf, T>::Type;
+
+  /// Constructs a mask which keeps all fields.
+  PbFieldMask() noexcept = default;
+
+  /// Skips `field` and returns `*this`.
+  ///
+  /// @throws std::bad_alloc If the mask cannot be reallocated.
+  PbFieldMask& Skip(Field field) & noexcept(false) {
+    skipped_tags_.Add(static_cast<PbTag>(field));
+    return *this;
+  }
+
+  /// Skips `field` and returns `*this`.
+  ///
+  /// @throws std::bad_alloc If the mask cannot be reallocated.
+  PbFieldMask&& Skip(Field field) && noexcept(false) { return std::move(Skip(field)); }
+
+  /// Keeps `field` and returns `*this`.
+  PbFieldMask& Keep(Field field) & noexcept {
+    skipped_tags_.Remove(static_cast<PbTag>(field));
+    return *this;
+  }
+
+  /// Keeps `field` and returns `*this`.
+  PbFieldMask&& Keep(Field field) && noexcept { return std::move(Keep(field)); }
+
+  /// Returns whether `field` is skipped.
+  bool IsSkipped(Field field) const noexcept {
+    return skipped_tags_.Contains(static_cast<PbTag>(field));
+  }
+
+  /// Returns whether all fields are kept.
+  bool KeepsAll() const noexcept { return skipped_tags_.IsEmpty(); }
+
+  /// Returns a mask which keeps the fields kept by `*this` or by `other`, i.e. which only skips
+  /// fields skipped by both.
+  ///
+  /// @throws std::bad_alloc If the result cannot be allocated.
+  PbFieldMask Union(const PbFieldMask& other) const noexcept(false) {
+    return PbFieldMask{skipped_tags_.Intersect(other.skipped_tags_)};
+  }
+
+  /// Returns the tags of the skipped fields.
+  constexpr const horus_internal::PbSkippedTags& SkippedTags() const noexcept {
+    return skipped_tags_;
+  }
+
+ private:
+  /// Constructs a mask which skips the given tags.
+  explicit PbFieldMask(horus_internal::PbSkippedTags&& skipped_tags) noexcept
+      : skipped_tags_{std::move(skipped_tags)} {}
+
+  /// @see SkippedTags()
+  horus_internal::PbSkippedTags skipped_tags_;
+};
+
+}  // namespace horus
+
+#endif  // HORUS_PB_FIELD_MASK_H_
@@ -0,0 +1,109 @@
+#include "horus/pb/field_mask.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "horus/pb/buffer.h"
+#include "horus/pb/cow_bytes.h"
+#include "horus/pb/serialize.h"
+#include "horus/pb/testing/messages_pb.h"
+#include "horus/pb/types.h"
+#include "horus/pointer/cast.h"
+#include "horus/strings/string_view.h"
+
+namespace horus {
+namespace {
+
+using Field = pb::TestMessage::Field;
+
+TEST(PbSkippedTags, LowAndHighTags) {
+  horus_internal::PbSkippedTags tags;
+  EXPECT_TRUE(tags.IsEmpty());
+
+  tags.Add(1);
+  tags.Add(63);
+  tags.Add(200);
+  tags.Add(64);
+  tags.Add(200);
+  EXPECT_FALSE(tags.IsEmpty());
+  EXPECT_TRUE(tags.Contains(1));
+  EXPECT_TRUE(tags.Contains(63));
+  EXPECT_TRUE(tags.Contains(64));
+  EXPECT_TRUE(tags.Contains(200));
+  EXPECT_FALSE(tags.Contains(2));
+  EXPECT_FALSE(tags.Contains(65));
+
+  horus_internal::PbSkippedTags other;
+  other.Add(63);
+  other.Add(200);
+  other.Add(300);
+  const horus_internal::PbSkippedTags both{tags.Intersect(other)};
+  EXPECT_FALSE(both.Contains(1));
+  EXPECT_TRUE(both.Contains(63));
+  EXPECT_FALSE(both.Contains(64));
+  EXPECT_TRUE(both.Contains(200));
+  EXPECT_FALSE(both.Contains(300));
+
+  tags.Remove(1);
+  tags.Remove(64);
+  tags.Remove(200);
+  tags.Remove(63);
+  EXPECT_TRUE(tags.IsEmpty());
+}
+
+TEST(PbFieldMask, SkipKeepUnion) {
+  const PbFieldMask<pb::TestMessage> mask{
+      PbFieldMask<pb::TestMessage>{}.Skip(Field::kString).Skip(Field::kBytes).Skip(Field::kI32)};
+  EXPECT_FALSE(mask.KeepsAll());
+  EXPECT_TRUE(mask.IsSkipped(Field::kString));
+  EXPECT_FALSE(mask.IsSkipped(Field::kU32));
+
+  const PbFieldMask<pb::TestMessage> other{
+      PbFieldMask<pb::TestMessage>{}.Skip(Field::kString).Skip(Field::kI32).Keep(Field::kI32)};
+  const PbFieldMask<pb::TestMessage> both{mask.Union(other)};
+  EXPECT_TRUE(both.IsSkipped(Field::kString));
+  EXPECT_FALSE(both.IsSkipped(Field::kBytes));
+  EXPECT_FALSE(both.IsSkipped(Field::kI32));
+
+  EXPECT_TRUE(mask.Union(PbFieldMask<pb::TestMessage>{}).KeepsAll());
+}
+
+TEST(PbFieldMask, SkippedFieldsAreNotDeserialized) {
+  const std::vector<std::uint8_t> bytes{
+      pb::TestMessage{}
+          .set_u32(1)
+          .set_i32(-2)
+          .set_string(CowBytes::OwnedCopy("skipped"))
+          .set_submessage(
+              pb::TestMessage::SubMessage{}.set_i32(3).set_string(CowBytes::OwnedCopy("kept")))
+          .SerializeToBuffer()};
+  const PbFieldMask<pb::TestMessage> mask{
+      PbFieldMask<pb::TestMessage>{}.Skip(Field::kString).Skip(Field::kI32)};
+
+  const StringView bytes_view{SafePointerCast<char>(bytes.data()), bytes.size()};
+
+  PbReader reader{PbBuffer::Borrowed(bytes_view)};
+  reader.SetFieldMask(mask);
+  const pb::TestMessage message{reader};
+
+  EXPECT_EQ(message.u32(), 1);
+  EXPECT_FALSE(message.has_i32());
+  EXPECT_FALSE(message.has_string());
+  // Submessages are fully deserialized, even if they have fields with the same numbers.
+  ASSERT_TRUE(message.has_submessage());
+  EXPECT_EQ(message.submessage().i32(), 3);
+  EXPECT_EQ(message.submessage().string().Str(), "kept");
+
+  // An empty mask keeps all fields.
+  const PbFieldMask<pb::TestMessage> empty_mask;
+  PbReader full_reader{PbBuffer::Borrowed(bytes_view)};
+  full_reader.SetFieldMask(empty_mask);
+  const pb::TestMessage full_message{full_reader};
+  EXPECT_EQ(full_message.i32(), -2);
+  EXPECT_EQ(full_message.string().Str(), "skipped");
+}
+
+}  // namespace
+}  // namespace horus
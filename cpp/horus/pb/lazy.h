@@ -0,0 +1,228 @@
+/// @file
+///
+/// The `PbLazy` class.
+
+#ifndef HORUS_PB_LAZY_H_
+#define HORUS_PB_LAZY_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+#include "horus/attributes.h"
+#include "horus/pb/buffer.h"
+#include "horus/pb/serialize.h"
+#include "horus/pb/types.h"
+
+namespace horus {
+
+/// A singular submessage `T` which is stored as an unparsed `PbView` when received, and decoded on
+/// first access.
+///
+/// Receiving a message therefore costs O(top-level fields), and consumers which only read some of
+/// its fields (e.g. IDs or timestamps) do not pay for the others. As long as the submessage is not
+/// mutated, it is serialized from its unparsed bytes.
+///
+/// `Ref()` may be called concurrently from several threads: the first caller decodes the
+/// submessage while the others wait for it.
+template <class T>
+class PbLazy final {
+ public:
+  /// Constructs a default-initialized submessage.
+  PbLazy() noexcept = default;
+
+  /// Move constructor. `other` must not be accessed concurrently.
+  PbLazy(PbLazy&& other) noexcept
+      : state_{other.state_.load(std::memory_order_relaxed)},
+        value_{std::move(other.value_)},
+        view_{std::move(other.view_)},
+        has_view_{other.has_view_} {
+    other.Reset();
+  }
+
+  /// Move assignment operator. `other` must not be accessed concurrently.
+  PbLazy& operator=(PbLazy&& other) noexcept {
+    state_.store(other.state_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    value_ = std::move(other.value_);
+    view_ = std::move(other.view_);
+    has_view_ = other.has_view_;
+    other.Reset();
+    return *this;
+  }
+
+  /// Constructs a clone of `other`, which only copies the unparsed bytes of `other` if it has not
+  /// been mutated.
+  ///
+  /// @throws std::bad_alloc If `other` is cloned and owns heap-allocated data which could not be
+  /// cloned.
+  explicit PbLazy(const PbLazy& other) noexcept(false)
+      : state_{other.has_view_ ? State::kEncoded : State::kDecoded},
+        value_{other.has_view_ ? T{} : T{other.value_}},
+        view_{other.view_},
+        has_view_{other.has_view_} {}
+
+  /// Cannot copy-assign to avoid implicit allocations.
+  PbLazy& operator=(const PbLazy&) = delete;
+
+  /// Destructor.
+  ~PbLazy() noexcept = default;
+
+  /// Returns a reference to the submessage, decoding it if needed.
+  ///
+  /// @throws InvalidProtobufMessage If the unparsed bytes are not a valid Protobuf message.
+  const T& Ref() const noexcept(false) HORUS_LIFETIME_BOUND {
+    if (state_.load(std::memory_order_acquire) != State::kDecoded) {
+      Decode();
+    }
+    return value_;
+  }
+
+  /// Returns a mutable reference to the submessage, decoding it if needed. Its unparsed bytes are
+  /// discarded.
+  ///
+  /// @throws InvalidProtobufMessage If the unparsed bytes are not a valid Protobuf message.
+  T& Mutable() noexcept(false) HORUS_LIFETIME_BOUND {
+    static_cast<void>(Ref());
+    DiscardView();
+    return value_;
+  }
+
+  /// Moves the submessage out of `*this`, decoding it if needed.
+  ///
+  /// @throws InvalidProtobufMessage If the unparsed bytes are not a valid Protobuf message.
+  T Take() && noexcept(false) { return std::move(Mutable()); }
+
+  /// Replaces the submessage by `value`.
+  void Set(T&& value) noexcept {
+    value_ = std::move(value);
+    DiscardView();
+    state_.store(State::kDecoded, std::memory_order_relaxed);
+  }
+
+  /// Clears the submessage, keeping the capacity of the buffers it owns.
+  void Clear() noexcept {
+    value_.Clear();
+    DiscardView();
+    state_.store(State::kDecoded, std::memory_order_relaxed);
+  }
+
+  /// Replaces the submessage by the unparsed message `view`, which will be decoded on first access.
+  void SetView(PbView&& view) noexcept {
+    value_.Clear();
+    view_ = std::move(view);
+    has_view_ = true;
+    state_.store(State::kEncoded, std::memory_order_relaxed);
+  }
+
+  /// Returns the unparsed bytes of the submessage if it was received and not mutated since, or
+  /// null otherwise.
+  const PbView* TryView() const noexcept HORUS_LIFETIME_BOUND {
+    return has_view_ ? &view_ : nullptr;
+  }
+
+  /// Returns whether the submessage was decoded (or never received).
+  bool IsDecoded() const noexcept {
+    return state_.load(std::memory_order_acquire) == State::kDecoded;
+  }
+
+  /// Returns whether the submessage is known to be default-initialized without decoding it.
+  bool IsDefault() const noexcept {
+    return !has_view_ && state_.load(std::memory_order_relaxed) == State::kDecoded &&
+           value_.IsEmpty();
+  }
+
+ private:
+  /// The decoding state of `value_`.
+  enum class State : std::uint8_t {
+    /// `value_` is up to date.
+    kDecoded,
+    /// `value_` is being decoded from `view_` by another thread.
+    kDecoding,
+    /// `value_` must be decoded from `view_`.
+    kEncoded,
+  };
+
+  /// Decodes `value_` from `view_`, or waits for another thread to do it.
+  void Decode() const noexcept(false) {
+    for (;;) {
+      State expected{State::kEncoded};
+      if (state_.compare_exchange_strong(expected, State::kDecoding, std::memory_order_acquire)) {
+        try {
+          PbReader reader{PbView{view_}};
+          value_.DeserializeFrom(reader);
+        } catch (...) {
+          value_ = T{};
+          state_.store(State::kEncoded, std::memory_order_release);
+          throw;
+        }
+        state_.store(State::kDecoded, std::memory_order_release);
+        return;
+      }
+      if (expected == State::kDecoded) {
+        return;
+      }
+      // Another thread is decoding the value; its decoding is short, so we simply wait for it.
+      std::this_thread::yield();
+    }
+  }
+
+  /// Discards `view_` after `value_` was modified.
+  void DiscardView() noexcept {
+    view_ = PbView{PbBuffer{}};
+    has_view_ = false;
+  }
+
+  /// Leaves a moved-from `PbLazy` in a valid state.
+  void Reset() noexcept {
+    DiscardView();
+    state_.store(State::kDecoded, std::memory_order_relaxed);
+  }
+
+  /// The decoding state of `value_`.
+  mutable std::atomic<State> state_{State::kDecoded};
+  /// The submessage, if `state_` is `kDecoded`.
+  mutable T value_{};
+  /// The unparsed submessage, if `has_view_`.
+  PbView view_{PbBuffer{}};
+  /// Whether `view_` holds the unparsed submessage, i.e. whether it was received and not mutated.
+  bool has_view_{false};
+};
+
+template <class T>
+class PbTraits<PbLazy<T>> final {
+ public:
+  /// Serializes `value` into `writer`, copying (or referencing) its unparsed bytes if possible.
+  static void Serialize(PbWriter& writer, PbTag tag, const PbLazy<T>& value) {
+    const PbView* const view{value.TryView()};
+    if (view == nullptr) {
+      PbTraits<T>::Serialize(writer, tag, value.Ref());
+    } else if (!writer.TryAddReference(tag, *view)) {
+      writer.Writer().add_bytes(tag, view->Str().data(), view->Str().size());
+    }
+  }
+
+  /// Returns the number of bytes used to serialize `value`.
+  static std::size_t ByteSize(PbTag tag, const PbLazy<T>& value) {
+    const PbView* const view{value.TryView()};
+    if (view == nullptr) {
+      return PbTraits<T>::ByteSize(tag, value.Ref());
+    }
+    return horus_internal::PbLengthDelimitedSize(tag, view->Size());
+  }
+
+  /// Deserializes a `PbLazy<T>` from `reader` without decoding it, unless it must be merged into a
+  /// previous occurrence of the field.
+  static void Deserialize(PbReader& reader, PbLazy<T>& value) {
+    if (value.IsDefault()) {
+      value.SetView(reader.FieldView(reader.Reader().get_view()));
+    } else {
+      PbTraits<T>::Deserialize(reader, value.Mutable());
+    }
+  }
+};
+
+}  // namespace horus
+
+#endif  // HORUS_PB_LAZY_H_
@@ -0,0 +1,126 @@
+#include "horus/pb/lazy.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "horus/pb/buffer.h"
+#include "horus/pb/cow_bytes.h"
+#include "horus/pb/serialize.h"
+#include "horus/pb/testing/messages_pb.h"
+
+namespace horus {
+namespace {
+
+using SubMessage = pb::TestMessage::SubMessage;
+
+/// Returns a `PbLazy<SubMessage>` holding the unparsed `message`.
+PbLazy<SubMessage> MakeUnparsed(const SubMessage& message) {
+  PbLazy<SubMessage> lazy;
+  lazy.SetView(PbBuffer{message.SerializeToBuffer()}.View());
+  return lazy;
+}
+
+TEST(PbLazy, DecodesOnFirstAccess) {
+  PbLazy<SubMessage> lazy{MakeUnparsed(SubMessage{}.set_u32(7))};
+  EXPECT_FALSE(lazy.IsDecoded());
+  ASSERT_NE(lazy.TryView(), nullptr);
+
+  EXPECT_EQ(lazy.Ref().u32(), 7);
+  EXPECT_TRUE(lazy.IsDecoded());
+  // The unparsed bytes are kept until the submessage is mutated.
+  EXPECT_NE(lazy.TryView(), nullptr);
+
+  lazy.Mutable().set_i32(-1);
+  EXPECT_EQ(lazy.TryView(), nullptr);
+  EXPECT_EQ(lazy.Ref().u32(), 7);
+  EXPECT_EQ(lazy.Ref().i32(), -1);
+
+  lazy.Clear();
+  EXPECT_TRUE(lazy.IsDefault());
+}
+
+TEST(PbLazy, CopiesUnparsedBytes) {
+  const PbLazy<SubMessage> lazy{MakeUnparsed(SubMessage{}.set_string(CowBytes::OwnedCopy("a")))};
+  PbLazy<SubMessage> copy{lazy};
+  EXPECT_FALSE(copy.IsDecoded());
+  ASSERT_NE(copy.TryView(), nullptr);
+  EXPECT_EQ(copy.TryView()->Str().data(), lazy.TryView()->Str().data());
+  EXPECT_EQ(copy.Ref().string().Str(), "a");
+
+  PbLazy<SubMessage> moved{std::move(copy)};
+  EXPECT_EQ(moved.Ref().string().Str(), "a");
+  EXPECT_EQ(std::move(moved).Take().string().Str(), "a");
+}
+
+TEST(PbLazy, InvalidBytesThrowOnAccess) {
+  const std::string invalid{"\x1A\x7F"};  // Field 3 (string), length 127, but no data.
+  PbLazy<SubMessage> lazy;
+  lazy.SetView(PbBuffer::Copy(invalid).View());
+
+  EXPECT_ANY_THROW(static_cast<void>(lazy.Ref()));
+  EXPECT_FALSE(lazy.IsDecoded());
+  EXPECT_ANY_THROW(static_cast<void>(lazy.Ref()));
+}
+
+TEST(PbLazy, ConcurrentAccessDecodesOnce) {
+  const PbLazy<SubMessage> lazy{MakeUnparsed(SubMessage{}.set_u32(42))};
+
+  std::vector<const SubMessage*> refs(4, nullptr);
+  std::vector<std::thread> threads;
+  for (std::size_t i{0}; i < refs.size(); ++i) {
+    threads.emplace_back([&lazy, &refs, i]() { refs[i] = &lazy.Ref(); });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  for (const SubMessage* ref : refs) {
+    ASSERT_EQ(ref, &lazy.Ref());
+  }
+  EXPECT_EQ(lazy.Ref().u32(), 42);
+}
+
+TEST(PbLazy, ReceivedMessage) {
+  const std::vector<std::uint8_t> bytes{
+      pb::TestMessage{}
+          .set_u32(1)
+          .set_submessage(SubMessage{}.set_u32(2).set_string(CowBytes::OwnedCopy("sub")))
+          .SerializeToBuffer()};
+
+  PbReader reader{PbBuffer{std::vector<std::uint8_t>{bytes}}};
+  pb::TestMessage message{reader};
+  EXPECT_EQ(message.u32(), 1);
+  ASSERT_TRUE(message.has_submessage());
+
+  // Unmodified submessages are serialized from their unparsed bytes.
+  EXPECT_EQ(message.SerializeToBuffer(), bytes);
+  EXPECT_EQ(message.submessage().string().Str(), "sub");
+  EXPECT_EQ(message.SerializeToBuffer(), bytes);
+
+  message.mutable_submessage().set_u32(3);
+  PbReader modified_reader{PbBuffer{message.SerializeToBuffer()}};
+  const pb::TestMessage modified{modified_reader};
+  EXPECT_EQ(modified.submessage().u32(), 3);
+  EXPECT_EQ(modified.submessage().string().Str(), "sub");
+}
+
+TEST(PbLazy, RepeatedOccurrencesAreMerged) {
+  std::vector<std::uint8_t> bytes{
+      pb::TestMessage{}.set_submessage(SubMessage{}.set_u32(1)).SerializeToBuffer()};
+  const std::vector<std::uint8_t> second{
+      pb::TestMessage{}.set_submessage(SubMessage{}.set_i32(2)).SerializeToBuffer()};
+  static_cast<void>(bytes.insert(bytes.end(), second.begin(), second.end()));
+
+  PbReader reader{PbBuffer{std::move(bytes)}};
+  const pb::TestMessage message{reader};
+  EXPECT_EQ(message.submessage().u32(), 1);
+  EXPECT_EQ(message.submessage().i32(), 2);
+}
+
+}  // namespace
+}  // namespace horus
@@ -1,6 +1,9 @@
 #include "horus/pb/license_server/messages_pb.h"
 
+#include <cstddef>
+
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 
 namespace horus {
 namespace sdk {
@@ -11,25 +14,21 @@ LicenseInfo_AllowedFeature::LicenseInfo_AllowedFeature(const LicenseInfo_Allowed
     , set_fields_{other.set_fields_} {}
 
 void LicenseInfo_AllowedFeature::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<LicenseFeature>(writer, /*tag=*/ 1, feature_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LicenseInfo_AllowedFeature::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LicenseInfo_AllowedFeature::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<LicenseFeature>(reader, feature_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LicenseInfo_AllowedFeature::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LicenseInfo::LicenseInfo(const LicenseInfo& other) noexcept(false)
@@ -39,43 +38,62 @@ LicenseInfo::LicenseInfo(const LicenseInfo& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void LicenseInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<Timestamp>(writer, /*tag=*/ 1, expiration_date_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 2, lidar_count_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowRepeated<LicenseInfo_AllowedFeature>>(writer, /*tag=*/ 3, allowed_features_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LicenseInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LicenseInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<Timestamp>(reader, expiration_date_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::uint32_t>(reader, lidar_count_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowRepeated<LicenseInfo_AllowedFeature>>(reader, allowed_features_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LicenseInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
+}
+
+// MARK: Field tables
+
+// Messages are not standard-layout since they have a vtable, so `offsetof()` is only
+// conditionally-supported on them; it is supported by all compilers targeted by the SDK.
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
+const horus_internal::PbMessageTable& LicenseInfo_AllowedFeature::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LicenseInfo_AllowedFeature, feature_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<LicenseFeature>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LicenseInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LicenseInfo, expiration_date_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Timestamp>>::kOps},
+      {/*tag=*/ 2, offsetof(LicenseInfo, lidar_count_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/ 3, offsetof(LicenseInfo, allowed_features_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<LicenseInfo_AllowedFeature>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
 }
 
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
 }  // namespace pb
 }  // namespace sdk
 }  // namespace horus
@@ -8,6 +8,7 @@
 /// Generated by `/opt/actions-runner/_work/horus/horus/common/tools/sdk/pb.ts`.
 
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -15,8 +16,10 @@
 #include "horus/internal/attributes.h"
 #include "horus/pb/config/metadata_pb.h"
 #include "horus/pb/cow_repeated.h"
+#include "horus/pb/lazy.h"
 #include "horus/pb/message.h"
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 #include "horus/pb/types.h"
 #include "horus/strings/string_view.h"
 
@@ -100,6 +103,11 @@ class LicenseInfo_AllowedFeature final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -108,12 +116,21 @@ class LicenseInfo_AllowedFeature final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.LicenseInfo.AllowedFeature`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.LicenseInfo.AllowedFeature"; }
 
   /// The full name of the message: `horus.pb.LicenseInfo.AllowedFeature`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LicenseInfo_AllowedFeature`, e.g. to build a `PbFieldMask<LicenseInfo_AllowedFeature>`.
+  enum class Field : PbTag {
+    /// Field `feature`.
+    kFeature = 1,
+  };
+
   // Field `feature` (no 1).
   // -----
 
@@ -152,6 +169,10 @@ class LicenseInfo_AllowedFeature final : public PbMessage {
     return std::move(set_feature(feature));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see feature()
   LicenseFeature feature_{};
@@ -200,6 +221,11 @@ class LicenseInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -208,20 +234,37 @@ class LicenseInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.LicenseInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.LicenseInfo"; }
 
   /// The full name of the message: `horus.pb.LicenseInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LicenseInfo`, e.g. to build a `PbFieldMask<LicenseInfo>`.
+  enum class Field : PbTag {
+    /// Field `expiration_date`.
+    kExpirationDate = 1,
+    /// Field `lidar_count`.
+    kLidarCount = 2,
+    /// Field `allowed_features`.
+    kAllowedFeatures = 3,
+  };
+
   // Field `expiration_date` (no 1).
   // -----
 
   /// Timestamp defining the license's end date of validity
   ///
   /// Field no: 1.
-  constexpr const Timestamp& expiration_date() const& noexcept HORUS_LIFETIME_BOUND {
-    return expiration_date_;
+  ///
+  /// If `expiration_date` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `expiration_date` was received and is not a valid message.
+  const Timestamp& expiration_date() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return expiration_date_.Ref();
   }
 
   /// If `expiration_date` is set, moves it out of the message (without marking it as unset).
@@ -229,19 +272,23 @@ class LicenseInfo final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  Timestamp expiration_date() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `expiration_date` was received and is not a valid message.
+  Timestamp expiration_date() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(expiration_date_);
+    return std::move(expiration_date_).Take();
   }
 
   /// Timestamp defining the license's end date of validity
   ///
   /// Field no: 1.
-  Timestamp& mutable_expiration_date() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `expiration_date` was received and is not a valid message.
+  Timestamp& mutable_expiration_date() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return expiration_date_;
+    return expiration_date_.Mutable();
   }
 
   /// Returns whether `expiration_date` (no 1) is set.
@@ -250,13 +297,13 @@ class LicenseInfo final : public PbMessage {
   /// Clears `expiration_date` (no 1).
   void clear_expiration_date() & noexcept {
     set_fields_[0] = false;
-    expiration_date_ = {};
+    expiration_date_.Clear();
   }
 
   /// Sets `expiration_date` (no 1) and returns `*this`.
   LicenseInfo& set_expiration_date(Timestamp&& expiration_date) & noexcept {
     set_fields_[0] = true;
-    expiration_date_ = std::move(expiration_date);
+    expiration_date_.Set(std::move(expiration_date));
     return *this;
   }
   /// Sets `expiration_date` (no 1) and returns `*this`.
@@ -352,9 +399,13 @@ class LicenseInfo final : public PbMessage {
     return std::move(set_allowed_features(std::move(allowed_features)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see expiration_date()
-  Timestamp expiration_date_{};
+  PbLazy<Timestamp> expiration_date_{};
   /// @see lidar_count()
   std::uint32_t lidar_count_{};
   /// @see allowed_features()
@@ -465,6 +516,11 @@ class PbTraits<horus::sdk::pb::LicenseFeature> final {
     writer.Writer().add_enum(tag, static_cast<PbEnum>(value));
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, horus::sdk::pb::LicenseFeature value) noexcept {
+    return PbTraits<PbEnum>::ByteSize(tag, static_cast<PbEnum>(value));
+  }
+
   /// Deserializes `horus::sdk::pb::LicenseFeature` from `reader`.
   static horus::sdk::pb::LicenseFeature Deserialize(PbReader& reader) {
     return PbEnumTraits<horus::sdk::pb::LicenseFeature>::ValueOf(reader.Reader().get_enum());
@@ -1,6 +1,9 @@
 #include "horus/pb/logs/common_pb.h"
 
+#include <cstddef>
+
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 
 namespace horus {
 namespace sdk {
@@ -13,35 +16,49 @@ ValidationError::ValidationError(const ValidationError& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void ValidationError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, path_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, message_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ValidationError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ValidationError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, path_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, message_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ValidationError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
+// MARK: Field tables
+
+// Messages are not standard-layout since they have a vtable, so `offsetof()` is only
+// conditionally-supported on them; it is supported by all compilers targeted by the SDK.
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
+const horus_internal::PbMessageTable& ValidationError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ValidationError, path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(ValidationError, message_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
 }  // namespace logs
 }  // namespace pb
 }  // namespace sdk
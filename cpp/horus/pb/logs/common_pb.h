@@ -8,6 +8,7 @@
 /// Generated by `/opt/actions-runner/_work/horus/horus/common/tools/sdk/pb.ts`.
 
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -16,6 +17,7 @@
 #include "horus/pb/cow_bytes.h"
 #include "horus/pb/message.h"
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 #include "horus/strings/string_view.h"
 
 #if HORUS_SDK_USE_PB_NAMESPACE_ALIAS
@@ -73,6 +75,11 @@ class ValidationError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -81,12 +88,23 @@ class ValidationError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ValidationError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ValidationError"; }
 
   /// The full name of the message: `horus.pb.logs.ValidationError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ValidationError`, e.g. to build a `PbFieldMask<ValidationError>`.
+  enum class Field : PbTag {
+    /// Field `path`.
+    kPath = 1,
+    /// Field `message`.
+    kMessage = 2,
+  };
+
   // Field `path` (no 1).
   // -----
 
@@ -187,6 +205,10 @@ class ValidationError final : public PbMessage {
     return std::move(set_message(std::move(message)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see path()
   CowBytes path_{};
@@ -1,6 +1,9 @@
 #include "horus/pb/logs/logs_pb.h"
 
+#include <cstddef>
+
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 
 namespace horus {
 namespace sdk {
@@ -13,33 +16,21 @@ Generic::Generic(const Generic& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void Generic::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, message_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<horus::pb::LogMetadata_SourceLocation>(writer, /*tag=*/ 2, location_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t Generic::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void Generic::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, message_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<horus::pb::LogMetadata_SourceLocation>(reader, location_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void Generic::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -51,41 +42,21 @@ RpcConnectionError::RpcConnectionError(const RpcConnectionError& other) noexcept
     , set_fields_{other.set_fields_} {}
 
 void RpcConnectionError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, target_service_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, target_uri_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t RpcConnectionError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void RpcConnectionError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, target_service_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, target_uri_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void RpcConnectionError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 InvalidProjectName::InvalidProjectName(const InvalidProjectName& other) noexcept(false)
@@ -94,33 +65,21 @@ InvalidProjectName::InvalidProjectName(const InvalidProjectName& other) noexcept
     , set_fields_{other.set_fields_} {}
 
 void InvalidProjectName::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, name_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t InvalidProjectName::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void InvalidProjectName::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, name_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void InvalidProjectName::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ProjectNotFound::ProjectNotFound(const ProjectNotFound& other) noexcept(false)
@@ -128,25 +87,21 @@ ProjectNotFound::ProjectNotFound(const ProjectNotFound& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void ProjectNotFound::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ProjectNotFound::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ProjectNotFound::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, name_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ProjectNotFound::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ProjectAlreadyExists::ProjectAlreadyExists(const ProjectAlreadyExists& other) noexcept(false)
@@ -154,25 +109,21 @@ ProjectAlreadyExists::ProjectAlreadyExists(const ProjectAlreadyExists& other) no
     , set_fields_{other.set_fields_} {}
 
 void ProjectAlreadyExists::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ProjectAlreadyExists::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ProjectAlreadyExists::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, name_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ProjectAlreadyExists::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 InvalidConfiguration::InvalidConfiguration(const InvalidConfiguration& other) noexcept(false)
@@ -180,25 +131,21 @@ InvalidConfiguration::InvalidConfiguration(const InvalidConfiguration& other) no
     , set_fields_{other.set_fields_} {}
 
 void InvalidConfiguration::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowRepeated<ValidationError>>(writer, /*tag=*/ 1, validation_errors_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t InvalidConfiguration::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void InvalidConfiguration::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowRepeated<ValidationError>>(reader, validation_errors_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void InvalidConfiguration::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 EntityNotFound::EntityNotFound(const EntityNotFound& other) noexcept(false)
@@ -207,33 +154,21 @@ EntityNotFound::EntityNotFound(const EntityNotFound& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void EntityNotFound::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, entity_type_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t EntityNotFound::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void EntityNotFound::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, entity_type_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void EntityNotFound::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -245,41 +180,21 @@ RpcDisconnectionError::RpcDisconnectionError(const RpcDisconnectionError& other)
     , set_fields_{other.set_fields_} {}
 
 void RpcDisconnectionError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, target_service_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, target_uri_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t RpcDisconnectionError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void RpcDisconnectionError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, target_service_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, target_uri_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void RpcDisconnectionError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 DroppedLogs::DroppedLogs(const DroppedLogs& other) noexcept(false)
@@ -287,25 +202,21 @@ DroppedLogs::DroppedLogs(const DroppedLogs& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void DroppedLogs::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 1, n_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t DroppedLogs::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void DroppedLogs::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint64_t>(reader, n_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void DroppedLogs::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 OpenedProject::OpenedProject(const OpenedProject& other) noexcept(false)
@@ -313,25 +224,21 @@ OpenedProject::OpenedProject(const OpenedProject& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void OpenedProject::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, project_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t OpenedProject::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void OpenedProject::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, project_name_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void OpenedProject::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 CreatedProject::CreatedProject(const CreatedProject& other) noexcept(false)
@@ -340,33 +247,21 @@ CreatedProject::CreatedProject(const CreatedProject& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void CreatedProject::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, project_name_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, source_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t CreatedProject::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void CreatedProject::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, project_name_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, source_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void CreatedProject::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -376,25 +271,21 @@ InvalidRequest::InvalidRequest(const InvalidRequest& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void InvalidRequest::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t InvalidRequest::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void InvalidRequest::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void InvalidRequest::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 SanityCheckError::SanityCheckError(const SanityCheckError& other) noexcept(false)
@@ -403,33 +294,21 @@ SanityCheckError::SanityCheckError(const SanityCheckError& other) noexcept(false
     , set_fields_{other.set_fields_} {}
 
 void SanityCheckError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, sanity_check_name_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t SanityCheckError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void SanityCheckError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, sanity_check_name_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void SanityCheckError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 BagFailedToOpen::BagFailedToOpen(const BagFailedToOpen& other) noexcept(false)
@@ -438,33 +317,21 @@ BagFailedToOpen::BagFailedToOpen(const BagFailedToOpen& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void BagFailedToOpen::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, horus_bag_path_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t BagFailedToOpen::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void BagFailedToOpen::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, horus_bag_path_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void BagFailedToOpen::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 BagFailedToClose::BagFailedToClose(const BagFailedToClose& other) noexcept(false)
@@ -472,25 +339,21 @@ BagFailedToClose::BagFailedToClose(const BagFailedToClose& other) noexcept(false
     , set_fields_{other.set_fields_} {}
 
 void BagFailedToClose::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t BagFailedToClose::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void BagFailedToClose::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void BagFailedToClose::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 BagConversionFailed::BagConversionFailed(const BagConversionFailed& other) noexcept(false)
@@ -498,25 +361,21 @@ BagConversionFailed::BagConversionFailed(const BagConversionFailed& other) noexc
     , set_fields_{other.set_fields_} {}
 
 void BagConversionFailed::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t BagConversionFailed::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void BagConversionFailed::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void BagConversionFailed::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 BagFailedToWrite::BagFailedToWrite(const BagFailedToWrite& other) noexcept(false)
@@ -525,33 +384,21 @@ BagFailedToWrite::BagFailedToWrite(const BagFailedToWrite& other) noexcept(false
     , set_fields_{other.set_fields_} {}
 
 void BagFailedToWrite::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, name_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t BagFailedToWrite::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void BagFailedToWrite::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, name_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void BagFailedToWrite::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 CalibrationError::CalibrationError(const CalibrationError& other) noexcept(false)
@@ -559,25 +406,21 @@ CalibrationError::CalibrationError(const CalibrationError& other) noexcept(false
     , set_fields_{other.set_fields_} {}
 
 void CalibrationError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t CalibrationError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void CalibrationError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void CalibrationError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ProjectManagerFailedToStartRecording::ProjectManagerFailedToStartRecording(const ProjectManagerFailedToStartRecording& other) noexcept(false)
@@ -585,25 +428,21 @@ ProjectManagerFailedToStartRecording::ProjectManagerFailedToStartRecording(const
     , set_fields_{other.set_fields_} {}
 
 void ProjectManagerFailedToStartRecording::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ProjectManagerFailedToStartRecording::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ProjectManagerFailedToStartRecording::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ProjectManagerFailedToStartRecording::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ProjectManagerFailedToStopRecording::ProjectManagerFailedToStopRecording(const ProjectManagerFailedToStopRecording& other) noexcept(false)
@@ -611,25 +450,21 @@ ProjectManagerFailedToStopRecording::ProjectManagerFailedToStopRecording(const P
     , set_fields_{other.set_fields_} {}
 
 void ProjectManagerFailedToStopRecording::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ProjectManagerFailedToStopRecording::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ProjectManagerFailedToStopRecording::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ProjectManagerFailedToStopRecording::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ServiceConnectionTimedOut::ServiceConnectionTimedOut(const ServiceConnectionTimedOut& other) noexcept(false)
@@ -638,33 +473,21 @@ ServiceConnectionTimedOut::ServiceConnectionTimedOut(const ServiceConnectionTime
     , set_fields_{other.set_fields_} {}
 
 void ServiceConnectionTimedOut::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, node_type_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, node_id_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ServiceConnectionTimedOut::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ServiceConnectionTimedOut::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, node_type_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, node_id_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ServiceConnectionTimedOut::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 BagRecorderAlreadyRunning::BagRecorderAlreadyRunning(const BagRecorderAlreadyRunning& other) noexcept(false)
@@ -672,25 +495,21 @@ BagRecorderAlreadyRunning::BagRecorderAlreadyRunning(const BagRecorderAlreadyRun
     , set_fields_{other.set_fields_} {}
 
 void BagRecorderAlreadyRunning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, path_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t BagRecorderAlreadyRunning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void BagRecorderAlreadyRunning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, path_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void BagRecorderAlreadyRunning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LicenseServerConnectionError::LicenseServerConnectionError(const LicenseServerConnectionError& other) noexcept(false)
@@ -698,25 +517,21 @@ LicenseServerConnectionError::LicenseServerConnectionError(const LicenseServerCo
     , set_fields_{other.set_fields_} {}
 
 void LicenseServerConnectionError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LicenseServerConnectionError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LicenseServerConnectionError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LicenseServerConnectionError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LicenseError::LicenseError(const LicenseError& other) noexcept(false)
@@ -724,25 +539,21 @@ LicenseError::LicenseError(const LicenseError& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void LicenseError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LicenseError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LicenseError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LicenseError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -752,25 +563,21 @@ LicenseExpiredError::LicenseExpiredError(const LicenseExpiredError& other) noexc
     , set_fields_{other.set_fields_} {}
 
 void LicenseExpiredError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<horus::pb::LogMetadata_Timestamp>(writer, /*tag=*/ 1, expiration_time_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LicenseExpiredError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LicenseExpiredError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<horus::pb::LogMetadata_Timestamp>(reader, expiration_time_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LicenseExpiredError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LicenseExceededError::LicenseExceededError(const LicenseExceededError& other) noexcept(false)
@@ -779,33 +586,21 @@ LicenseExceededError::LicenseExceededError(const LicenseExceededError& other) no
     , set_fields_{other.set_fields_} {}
 
 void LicenseExceededError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 1, lidar_count_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 2, max_lidar_count_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LicenseExceededError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LicenseExceededError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint32_t>(reader, lidar_count_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::uint32_t>(reader, max_lidar_count_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LicenseExceededError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LicenseHostMachineError::LicenseHostMachineError(const LicenseHostMachineError& other) noexcept(false)
@@ -813,25 +608,21 @@ LicenseHostMachineError::LicenseHostMachineError(const LicenseHostMachineError&
     , set_fields_{other.set_fields_} {}
 
 void LicenseHostMachineError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LicenseHostMachineError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LicenseHostMachineError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LicenseHostMachineError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LicensePrivilegeError::LicensePrivilegeError(const LicensePrivilegeError& other) noexcept(false)
@@ -840,33 +631,21 @@ LicensePrivilegeError::LicensePrivilegeError(const LicensePrivilegeError& other)
     , set_fields_{other.set_fields_} {}
 
 void LicensePrivilegeError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, missing_privilege_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, level_error_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LicensePrivilegeError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LicensePrivilegeError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, missing_privilege_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, level_error_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LicensePrivilegeError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -877,33 +656,21 @@ MultipleLicensesWarning::MultipleLicensesWarning(const MultipleLicensesWarning&
     , set_fields_{other.set_fields_} {}
 
 void MultipleLicensesWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 1, non_expired_licenses_count_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, active_license_filename_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t MultipleLicensesWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void MultipleLicensesWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint32_t>(reader, non_expired_licenses_count_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, active_license_filename_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void MultipleLicensesWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LicenseCurrentLicenseStatusInfo::LicenseCurrentLicenseStatusInfo(const LicenseCurrentLicenseStatusInfo& other) noexcept(false)
@@ -912,33 +679,21 @@ LicenseCurrentLicenseStatusInfo::LicenseCurrentLicenseStatusInfo(const LicenseCu
     , set_fields_{other.set_fields_} {}
 
 void LicenseCurrentLicenseStatusInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<horus::pb::LogMetadata_Timestamp>(writer, /*tag=*/ 1, expiration_time_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 2, max_lidar_count_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LicenseCurrentLicenseStatusInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LicenseCurrentLicenseStatusInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<horus::pb::LogMetadata_Timestamp>(reader, expiration_time_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::uint32_t>(reader, max_lidar_count_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LicenseCurrentLicenseStatusInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 BagRecordingStoppedInfo::BagRecordingStoppedInfo(const BagRecordingStoppedInfo& other) noexcept(false)
@@ -947,33 +702,21 @@ BagRecordingStoppedInfo::BagRecordingStoppedInfo(const BagRecordingStoppedInfo&
     , set_fields_{other.set_fields_} {}
 
 void BagRecordingStoppedInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, path_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t BagRecordingStoppedInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void BagRecordingStoppedInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, path_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void BagRecordingStoppedInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 BagRecordingFailedToStart::BagRecordingFailedToStart(const BagRecordingFailedToStart& other) noexcept(false)
@@ -981,25 +724,21 @@ BagRecordingFailedToStart::BagRecordingFailedToStart(const BagRecordingFailedToS
     , set_fields_{other.set_fields_} {}
 
 void BagRecordingFailedToStart::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t BagRecordingFailedToStart::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void BagRecordingFailedToStart::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void BagRecordingFailedToStart::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 BagRecordingStartedInfo::BagRecordingStartedInfo(const BagRecordingStartedInfo& other) noexcept(false)
@@ -1007,25 +746,21 @@ BagRecordingStartedInfo::BagRecordingStartedInfo(const BagRecordingStartedInfo&
     , set_fields_{other.set_fields_} {}
 
 void BagRecordingStartedInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, path_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t BagRecordingStartedInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void BagRecordingStartedInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, path_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void BagRecordingStartedInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -1035,25 +770,21 @@ InputSourceChangeRequestedInfo::InputSourceChangeRequestedInfo(const InputSource
     , set_fields_{other.set_fields_} {}
 
 void InputSourceChangeRequestedInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, source_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t InputSourceChangeRequestedInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void InputSourceChangeRequestedInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, source_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void InputSourceChangeRequestedInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 InputSourceSwitchedInfo::InputSourceSwitchedInfo(const InputSourceSwitchedInfo& other) noexcept(false)
@@ -1061,25 +792,21 @@ InputSourceSwitchedInfo::InputSourceSwitchedInfo(const InputSourceSwitchedInfo&
     , set_fields_{other.set_fields_} {}
 
 void InputSourceSwitchedInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, source_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t InputSourceSwitchedInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void InputSourceSwitchedInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, source_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void InputSourceSwitchedInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 RpcTimeoutWarning::RpcTimeoutWarning(const RpcTimeoutWarning& other) noexcept(false)
@@ -1089,41 +816,21 @@ RpcTimeoutWarning::RpcTimeoutWarning(const RpcTimeoutWarning& other) noexcept(fa
     , set_fields_{other.set_fields_} {}
 
 void RpcTimeoutWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, request_name_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, endpoint_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<horus::pb::LogMetadata_Duration>(writer, /*tag=*/ 3, elapsed_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t RpcTimeoutWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void RpcTimeoutWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, request_name_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, endpoint_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<horus::pb::LogMetadata_Duration>(reader, elapsed_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void RpcTimeoutWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 CannotWriteLogFile::CannotWriteLogFile(const CannotWriteLogFile& other) noexcept(false)
@@ -1132,33 +839,21 @@ CannotWriteLogFile::CannotWriteLogFile(const CannotWriteLogFile& other) noexcept
     , set_fields_{other.set_fields_} {}
 
 void CannotWriteLogFile::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, path_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t CannotWriteLogFile::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void CannotWriteLogFile::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, path_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void CannotWriteLogFile::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 PointCloudParsingFailureWarning::PointCloudParsingFailureWarning(const PointCloudParsingFailureWarning& other) noexcept(false)
@@ -1166,25 +861,21 @@ PointCloudParsingFailureWarning::PointCloudParsingFailureWarning(const PointClou
     , set_fields_{other.set_fields_} {}
 
 void PointCloudParsingFailureWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t PointCloudParsingFailureWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void PointCloudParsingFailureWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void PointCloudParsingFailureWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LidarIsDead::LidarIsDead(const LidarIsDead& other) noexcept(false)
@@ -1193,33 +884,21 @@ LidarIsDead::LidarIsDead(const LidarIsDead& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void LidarIsDead::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LidarIsDead::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LidarIsDead::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LidarIsDead::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LidarIsNotDeadAnymore::LidarIsNotDeadAnymore(const LidarIsNotDeadAnymore& other) noexcept(false)
@@ -1228,33 +907,21 @@ LidarIsNotDeadAnymore::LidarIsNotDeadAnymore(const LidarIsNotDeadAnymore& other)
     , set_fields_{other.set_fields_} {}
 
 void LidarIsNotDeadAnymore::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LidarIsNotDeadAnymore::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LidarIsNotDeadAnymore::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LidarIsNotDeadAnymore::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LidarIsObstructed::LidarIsObstructed(const LidarIsObstructed& other) noexcept(false)
@@ -1263,33 +930,21 @@ LidarIsObstructed::LidarIsObstructed(const LidarIsObstructed& other) noexcept(fa
     , set_fields_{other.set_fields_} {}
 
 void LidarIsObstructed::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LidarIsObstructed::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LidarIsObstructed::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LidarIsObstructed::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LidarIsNotObstructedAnymore::LidarIsNotObstructedAnymore(const LidarIsNotObstructedAnymore& other) noexcept(false)
@@ -1298,33 +953,21 @@ LidarIsNotObstructedAnymore::LidarIsNotObstructedAnymore(const LidarIsNotObstruc
     , set_fields_{other.set_fields_} {}
 
 void LidarIsNotObstructedAnymore::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LidarIsNotObstructedAnymore::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LidarIsNotObstructedAnymore::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LidarIsNotObstructedAnymore::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LidarIsTilted::LidarIsTilted(const LidarIsTilted& other) noexcept(false)
@@ -1333,33 +976,21 @@ LidarIsTilted::LidarIsTilted(const LidarIsTilted& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void LidarIsTilted::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LidarIsTilted::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LidarIsTilted::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LidarIsTilted::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LidarIsNotTiltedAnymore::LidarIsNotTiltedAnymore(const LidarIsNotTiltedAnymore& other) noexcept(false)
@@ -1368,33 +999,21 @@ LidarIsNotTiltedAnymore::LidarIsNotTiltedAnymore(const LidarIsNotTiltedAnymore&
     , set_fields_{other.set_fields_} {}
 
 void LidarIsNotTiltedAnymore::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LidarIsNotTiltedAnymore::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LidarIsNotTiltedAnymore::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LidarIsNotTiltedAnymore::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LidarHasBeenAutomaticallyRecalibrated::LidarHasBeenAutomaticallyRecalibrated(const LidarHasBeenAutomaticallyRecalibrated& other) noexcept(false)
@@ -1405,49 +1024,21 @@ LidarHasBeenAutomaticallyRecalibrated::LidarHasBeenAutomaticallyRecalibrated(con
     , set_fields_{other.set_fields_} {}
 
 void LidarHasBeenAutomaticallyRecalibrated::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_name_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, translation_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 4, rotation_rpy_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LidarHasBeenAutomaticallyRecalibrated::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LidarHasBeenAutomaticallyRecalibrated::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, translation_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<CowBytes>(reader, rotation_rpy_);
-        set_fields_[3] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LidarHasBeenAutomaticallyRecalibrated::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LidarAutoCorrectionFailed::LidarAutoCorrectionFailed(const LidarAutoCorrectionFailed& other) noexcept(false)
@@ -1457,41 +1048,21 @@ LidarAutoCorrectionFailed::LidarAutoCorrectionFailed(const LidarAutoCorrectionFa
     , set_fields_{other.set_fields_} {}
 
 void LidarAutoCorrectionFailed::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_name_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 3, failure_count_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LidarAutoCorrectionFailed::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LidarAutoCorrectionFailed::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<std::uint32_t>(reader, failure_count_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LidarAutoCorrectionFailed::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LidarIcpFailed::LidarIcpFailed(const LidarIcpFailed& other) noexcept(false)
@@ -1501,41 +1072,21 @@ LidarIcpFailed::LidarIcpFailed(const LidarIcpFailed& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void LidarIcpFailed::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_name_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 3, failure_count_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LidarIcpFailed::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LidarIcpFailed::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<std::uint32_t>(reader, failure_count_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LidarIcpFailed::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ReceivedFirstDataForLidar::ReceivedFirstDataForLidar(const ReceivedFirstDataForLidar& other) noexcept(false)
@@ -1544,33 +1095,21 @@ ReceivedFirstDataForLidar::ReceivedFirstDataForLidar(const ReceivedFirstDataForL
     , set_fields_{other.set_fields_} {}
 
 void ReceivedFirstDataForLidar::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ReceivedFirstDataForLidar::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ReceivedFirstDataForLidar::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ReceivedFirstDataForLidar::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 TerminationFailureError::TerminationFailureError(const TerminationFailureError& other) noexcept(false)
@@ -1579,33 +1118,21 @@ TerminationFailureError::TerminationFailureError(const TerminationFailureError&
     , set_fields_{other.set_fields_} {}
 
 void TerminationFailureError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, component_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t TerminationFailureError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void TerminationFailureError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, component_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void TerminationFailureError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 FrameProcessingError::FrameProcessingError(const FrameProcessingError& other) noexcept(false)
@@ -1613,25 +1140,21 @@ FrameProcessingError::FrameProcessingError(const FrameProcessingError& other) no
     , set_fields_{other.set_fields_} {}
 
 void FrameProcessingError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t FrameProcessingError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void FrameProcessingError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void FrameProcessingError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ThreadPoolUnavailableError::ThreadPoolUnavailableError(const ThreadPoolUnavailableError& other) noexcept(false)
@@ -1639,25 +1162,21 @@ ThreadPoolUnavailableError::ThreadPoolUnavailableError(const ThreadPoolUnavailab
     , set_fields_{other.set_fields_} {}
 
 void ThreadPoolUnavailableError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, consequence_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ThreadPoolUnavailableError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ThreadPoolUnavailableError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, consequence_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ThreadPoolUnavailableError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 InvalidArgument::InvalidArgument(const InvalidArgument& other) noexcept(false)
@@ -1665,25 +1184,21 @@ InvalidArgument::InvalidArgument(const InvalidArgument& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void InvalidArgument::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t InvalidArgument::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void InvalidArgument::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void InvalidArgument::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ComponentInitializationFailureFatal::ComponentInitializationFailureFatal(const ComponentInitializationFailureFatal& other) noexcept(false)
@@ -1692,33 +1207,21 @@ ComponentInitializationFailureFatal::ComponentInitializationFailureFatal(const C
     , set_fields_{other.set_fields_} {}
 
 void ComponentInitializationFailureFatal::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, component_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ComponentInitializationFailureFatal::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ComponentInitializationFailureFatal::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, component_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ComponentInitializationFailureFatal::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 UnhandledEnumCaseError::UnhandledEnumCaseError(const UnhandledEnumCaseError& other) noexcept(false)
@@ -1727,33 +1230,21 @@ UnhandledEnumCaseError::UnhandledEnumCaseError(const UnhandledEnumCaseError& oth
     , set_fields_{other.set_fields_} {}
 
 void UnhandledEnumCaseError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, case_name_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<horus::pb::LogMetadata_SourceLocation>(writer, /*tag=*/ 2, location_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t UnhandledEnumCaseError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void UnhandledEnumCaseError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, case_name_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<horus::pb::LogMetadata_SourceLocation>(reader, location_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void UnhandledEnumCaseError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -1764,33 +1255,21 @@ DiscardingDataError::DiscardingDataError(const DiscardingDataError& other) noexc
     , set_fields_{other.set_fields_} {}
 
 void DiscardingDataError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, component_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t DiscardingDataError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void DiscardingDataError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, component_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void DiscardingDataError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 DiscardingDataWarning::DiscardingDataWarning(const DiscardingDataWarning& other) noexcept(false)
@@ -1799,33 +1278,21 @@ DiscardingDataWarning::DiscardingDataWarning(const DiscardingDataWarning& other)
     , set_fields_{other.set_fields_} {}
 
 void DiscardingDataWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, component_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t DiscardingDataWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void DiscardingDataWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, component_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void DiscardingDataWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 NothingToProcess::NothingToProcess(const NothingToProcess& other) noexcept(false)
@@ -1833,25 +1300,21 @@ NothingToProcess::NothingToProcess(const NothingToProcess& other) noexcept(false
     , set_fields_{other.set_fields_} {}
 
 void NothingToProcess::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t NothingToProcess::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void NothingToProcess::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void NothingToProcess::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 InvalidComponentConfiguration::InvalidComponentConfiguration(const InvalidComponentConfiguration& other) noexcept(false)
@@ -1860,33 +1323,21 @@ InvalidComponentConfiguration::InvalidComponentConfiguration(const InvalidCompon
     , set_fields_{other.set_fields_} {}
 
 void InvalidComponentConfiguration::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, component_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t InvalidComponentConfiguration::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void InvalidComponentConfiguration::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, component_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void InvalidComponentConfiguration::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ChannelReceiverNotFoundWarning::ChannelReceiverNotFoundWarning(const ChannelReceiverNotFoundWarning& other) noexcept(false)
@@ -1894,25 +1345,21 @@ ChannelReceiverNotFoundWarning::ChannelReceiverNotFoundWarning(const ChannelRece
     , set_fields_{other.set_fields_} {}
 
 void ChannelReceiverNotFoundWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, key_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ChannelReceiverNotFoundWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ChannelReceiverNotFoundWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, key_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ChannelReceiverNotFoundWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ModelLoadFailure::ModelLoadFailure(const ModelLoadFailure& other) noexcept(false)
@@ -1921,33 +1368,21 @@ ModelLoadFailure::ModelLoadFailure(const ModelLoadFailure& other) noexcept(false
     , set_fields_{other.set_fields_} {}
 
 void ModelLoadFailure::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, model_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ModelLoadFailure::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ModelLoadFailure::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, model_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ModelLoadFailure::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ModelExecutionFailureError::ModelExecutionFailureError(const ModelExecutionFailureError& other) noexcept(false)
@@ -1956,33 +1391,21 @@ ModelExecutionFailureError::ModelExecutionFailureError(const ModelExecutionFailu
     , set_fields_{other.set_fields_} {}
 
 void ModelExecutionFailureError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, model_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ModelExecutionFailureError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ModelExecutionFailureError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, model_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ModelExecutionFailureError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ServiceReadyInfo::ServiceReadyInfo(const ServiceReadyInfo& other) noexcept(false)
@@ -1990,25 +1413,21 @@ ServiceReadyInfo::ServiceReadyInfo(const ServiceReadyInfo& other) noexcept(false
     , set_fields_{other.set_fields_} {}
 
 void ServiceReadyInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, service_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ServiceReadyInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ServiceReadyInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, service_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ServiceReadyInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ModelPreparingInfo::ModelPreparingInfo(const ModelPreparingInfo& other) noexcept(false)
@@ -2016,25 +1435,21 @@ ModelPreparingInfo::ModelPreparingInfo(const ModelPreparingInfo& other) noexcept
     , set_fields_{other.set_fields_} {}
 
 void ModelPreparingInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, model_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ModelPreparingInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ModelPreparingInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, model_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ModelPreparingInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ModelInitializedInfo::ModelInitializedInfo(const ModelInitializedInfo& other) noexcept(false)
@@ -2042,60 +1457,44 @@ ModelInitializedInfo::ModelInitializedInfo(const ModelInitializedInfo& other) no
     , set_fields_{other.set_fields_} {}
 
 void ModelInitializedInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ModelInitializedInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ModelInitializedInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, name_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
 }
 
-ModelInitializationFailureWarning::ModelInitializationFailureWarning(const ModelInitializationFailureWarning& other) noexcept(false)
+void ModelInitializedInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
+}
+
+ModelInitializationFailureWarning::ModelInitializationFailureWarning(const ModelInitializationFailureWarning& other) noexcept(false)
     : model_{other.model_}
     , details_{other.details_}
     , set_fields_{other.set_fields_} {}
 
 void ModelInitializationFailureWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, model_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ModelInitializationFailureWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ModelInitializationFailureWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, model_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ModelInitializationFailureWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 RosSpinnerStoppedWarning::RosSpinnerStoppedWarning(const RosSpinnerStoppedWarning& other) noexcept(false)
@@ -2103,25 +1502,21 @@ RosSpinnerStoppedWarning::RosSpinnerStoppedWarning(const RosSpinnerStoppedWarnin
     , set_fields_{other.set_fields_} {}
 
 void RosSpinnerStoppedWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t RosSpinnerStoppedWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void RosSpinnerStoppedWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void RosSpinnerStoppedWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -2131,25 +1526,21 @@ ConfigNodeNotFoundError::ConfigNodeNotFoundError(const ConfigNodeNotFoundError&
     , set_fields_{other.set_fields_} {}
 
 void ConfigNodeNotFoundError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, node_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ConfigNodeNotFoundError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ConfigNodeNotFoundError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, node_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ConfigNodeNotFoundError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 BagTimestampOutOfOrderError::BagTimestampOutOfOrderError(const BagTimestampOutOfOrderError& other) noexcept(false)
@@ -2158,33 +1549,21 @@ BagTimestampOutOfOrderError::BagTimestampOutOfOrderError(const BagTimestampOutOf
     , set_fields_{other.set_fields_} {}
 
 void BagTimestampOutOfOrderError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<horus::pb::LogMetadata_Timestamp>(writer, /*tag=*/ 1, prior_timestamp_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<horus::pb::LogMetadata_Timestamp>(writer, /*tag=*/ 2, current_timestamp_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t BagTimestampOutOfOrderError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void BagTimestampOutOfOrderError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<horus::pb::LogMetadata_Timestamp>(reader, prior_timestamp_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<horus::pb::LogMetadata_Timestamp>(reader, current_timestamp_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void BagTimestampOutOfOrderError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 BagReplayUnexpectedTimestampError::BagReplayUnexpectedTimestampError(const BagReplayUnexpectedTimestampError& other) noexcept(false)
@@ -2193,33 +1572,21 @@ BagReplayUnexpectedTimestampError::BagReplayUnexpectedTimestampError(const BagRe
     , set_fields_{other.set_fields_} {}
 
 void BagReplayUnexpectedTimestampError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<horus::pb::LogMetadata_Timestamp>(writer, /*tag=*/ 1, expected_timestamp_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<horus::pb::LogMetadata_Timestamp>(writer, /*tag=*/ 2, received_timestamp_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t BagReplayUnexpectedTimestampError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void BagReplayUnexpectedTimestampError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<horus::pb::LogMetadata_Timestamp>(reader, expected_timestamp_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<horus::pb::LogMetadata_Timestamp>(reader, received_timestamp_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void BagReplayUnexpectedTimestampError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 WebsocketClosedInfo::WebsocketClosedInfo(const WebsocketClosedInfo& other) noexcept(false)
@@ -2228,33 +1595,21 @@ WebsocketClosedInfo::WebsocketClosedInfo(const WebsocketClosedInfo& other) noexc
     , set_fields_{other.set_fields_} {}
 
 void WebsocketClosedInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, uri_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, reason_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t WebsocketClosedInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void WebsocketClosedInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, uri_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, reason_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void WebsocketClosedInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 WebsocketOpenedInfo::WebsocketOpenedInfo(const WebsocketOpenedInfo& other) noexcept(false)
@@ -2263,33 +1618,21 @@ WebsocketOpenedInfo::WebsocketOpenedInfo(const WebsocketOpenedInfo& other) noexc
     , set_fields_{other.set_fields_} {}
 
 void WebsocketOpenedInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, uri_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, endpoint_is_server_client_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t WebsocketOpenedInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void WebsocketOpenedInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, uri_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, endpoint_is_server_client_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void WebsocketOpenedInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 SubscriberDisconnectedInfo::SubscriberDisconnectedInfo(const SubscriberDisconnectedInfo& other) noexcept(false)
@@ -2298,33 +1641,21 @@ SubscriberDisconnectedInfo::SubscriberDisconnectedInfo(const SubscriberDisconnec
     , set_fields_{other.set_fields_} {}
 
 void SubscriberDisconnectedInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, name_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, uri_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t SubscriberDisconnectedInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void SubscriberDisconnectedInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, name_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, uri_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void SubscriberDisconnectedInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ThreadPoolSlowingDownWarning::ThreadPoolSlowingDownWarning(const ThreadPoolSlowingDownWarning& other) noexcept(false)
@@ -2332,25 +1663,21 @@ ThreadPoolSlowingDownWarning::ThreadPoolSlowingDownWarning(const ThreadPoolSlowi
     , set_fields_{other.set_fields_} {}
 
 void ThreadPoolSlowingDownWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 1, number_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ThreadPoolSlowingDownWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ThreadPoolSlowingDownWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint64_t>(reader, number_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ThreadPoolSlowingDownWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ThreadPoolNotRespondingWarning::ThreadPoolNotRespondingWarning(const ThreadPoolNotRespondingWarning& other) noexcept(false)
@@ -2358,25 +1685,21 @@ ThreadPoolNotRespondingWarning::ThreadPoolNotRespondingWarning(const ThreadPoolN
     , set_fields_{other.set_fields_} {}
 
 void ThreadPoolNotRespondingWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<horus::pb::LogMetadata_Duration>(writer, /*tag=*/ 1, not_responding_for_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ThreadPoolNotRespondingWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ThreadPoolNotRespondingWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<horus::pb::LogMetadata_Duration>(reader, not_responding_for_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ThreadPoolNotRespondingWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -2388,25 +1711,21 @@ FailedToRemoveStalePointsWarning::FailedToRemoveStalePointsWarning(const FailedT
     , set_fields_{other.set_fields_} {}
 
 void FailedToRemoveStalePointsWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t FailedToRemoveStalePointsWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void FailedToRemoveStalePointsWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void FailedToRemoveStalePointsWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 IrregularBroadcastingPeriodWarning::IrregularBroadcastingPeriodWarning(const IrregularBroadcastingPeriodWarning& other) noexcept(false)
@@ -2416,41 +1735,21 @@ IrregularBroadcastingPeriodWarning::IrregularBroadcastingPeriodWarning(const Irr
     , set_fields_{other.set_fields_} {}
 
 void IrregularBroadcastingPeriodWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 1, num_irregular_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<horus::pb::LogMetadata_Duration>(writer, /*tag=*/ 2, duration_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<horus::pb::LogMetadata_Duration>(writer, /*tag=*/ 3, mean_deviation_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t IrregularBroadcastingPeriodWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void IrregularBroadcastingPeriodWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint64_t>(reader, num_irregular_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<horus::pb::LogMetadata_Duration>(reader, duration_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<horus::pb::LogMetadata_Duration>(reader, mean_deviation_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void IrregularBroadcastingPeriodWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ClustererPointsOutOfRangeWarning::ClustererPointsOutOfRangeWarning(const ClustererPointsOutOfRangeWarning& other) noexcept(false)
@@ -2459,33 +1758,21 @@ ClustererPointsOutOfRangeWarning::ClustererPointsOutOfRangeWarning(const Cluster
     , set_fields_{other.set_fields_} {}
 
 void ClustererPointsOutOfRangeWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 1, num_points_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, sample_points_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ClustererPointsOutOfRangeWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ClustererPointsOutOfRangeWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint64_t>(reader, num_points_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, sample_points_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ClustererPointsOutOfRangeWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 InternalError::InternalError(const InternalError& other) noexcept(false)
@@ -2493,25 +1780,21 @@ InternalError::InternalError(const InternalError& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void InternalError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t InternalError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void InternalError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void InternalError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 InternalFatal::InternalFatal(const InternalFatal& other) noexcept(false)
@@ -2519,25 +1802,21 @@ InternalFatal::InternalFatal(const InternalFatal& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void InternalFatal::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t InternalFatal::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void InternalFatal::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void InternalFatal::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ServiceStartingInfo::ServiceStartingInfo(const ServiceStartingInfo& other) noexcept(false)
@@ -2545,25 +1824,21 @@ ServiceStartingInfo::ServiceStartingInfo(const ServiceStartingInfo& other) noexc
     , set_fields_{other.set_fields_} {}
 
 void ServiceStartingInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, service_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ServiceStartingInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ServiceStartingInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, service_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ServiceStartingInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ConfigNodeNotFoundFatal::ConfigNodeNotFoundFatal(const ConfigNodeNotFoundFatal& other) noexcept(false)
@@ -2571,25 +1846,21 @@ ConfigNodeNotFoundFatal::ConfigNodeNotFoundFatal(const ConfigNodeNotFoundFatal&
     , set_fields_{other.set_fields_} {}
 
 void ConfigNodeNotFoundFatal::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, node_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ConfigNodeNotFoundFatal::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ConfigNodeNotFoundFatal::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, node_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ConfigNodeNotFoundFatal::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ServiceSetupError::ServiceSetupError(const ServiceSetupError& other) noexcept(false)
@@ -2597,25 +1868,21 @@ ServiceSetupError::ServiceSetupError(const ServiceSetupError& other) noexcept(fa
     , set_fields_{other.set_fields_} {}
 
 void ServiceSetupError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ServiceSetupError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ServiceSetupError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ServiceSetupError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 FilesystemError::FilesystemError(const FilesystemError& other) noexcept(false)
@@ -2623,25 +1890,21 @@ FilesystemError::FilesystemError(const FilesystemError& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void FilesystemError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t FilesystemError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void FilesystemError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void FilesystemError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 InvalidPresetWarning::InvalidPresetWarning(const InvalidPresetWarning& other) noexcept(false)
@@ -2651,41 +1914,21 @@ InvalidPresetWarning::InvalidPresetWarning(const InvalidPresetWarning& other) no
     , set_fields_{other.set_fields_} {}
 
 void InvalidPresetWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, preset_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, fallback_name_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, reason_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t InvalidPresetWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void InvalidPresetWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, preset_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, fallback_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, reason_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void InvalidPresetWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 WebsocketFailedClearPendingError::WebsocketFailedClearPendingError(const WebsocketFailedClearPendingError& other) noexcept(false)
@@ -2693,25 +1936,21 @@ WebsocketFailedClearPendingError::WebsocketFailedClearPendingError(const Websock
     , set_fields_{other.set_fields_} {}
 
 void WebsocketFailedClearPendingError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, exception_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t WebsocketFailedClearPendingError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void WebsocketFailedClearPendingError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, exception_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void WebsocketFailedClearPendingError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 WebsocketFailedToStopError::WebsocketFailedToStopError(const WebsocketFailedToStopError& other) noexcept(false)
@@ -2719,25 +1958,21 @@ WebsocketFailedToStopError::WebsocketFailedToStopError(const WebsocketFailedToSt
     , set_fields_{other.set_fields_} {}
 
 void WebsocketFailedToStopError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, exception_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t WebsocketFailedToStopError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void WebsocketFailedToStopError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, exception_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void WebsocketFailedToStopError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 WebsocketFailedToCreateError::WebsocketFailedToCreateError(const WebsocketFailedToCreateError& other) noexcept(false)
@@ -2747,41 +1982,21 @@ WebsocketFailedToCreateError::WebsocketFailedToCreateError(const WebsocketFailed
     , set_fields_{other.set_fields_} {}
 
 void WebsocketFailedToCreateError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, host_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 2, port_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, exception_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t WebsocketFailedToCreateError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void WebsocketFailedToCreateError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, host_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::uint32_t>(reader, port_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, exception_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void WebsocketFailedToCreateError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 UnexpectedRpcError::UnexpectedRpcError(const UnexpectedRpcError& other) noexcept(false)
@@ -2789,25 +2004,21 @@ UnexpectedRpcError::UnexpectedRpcError(const UnexpectedRpcError& other) noexcept
     , set_fields_{other.set_fields_} {}
 
 void UnexpectedRpcError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t UnexpectedRpcError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void UnexpectedRpcError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void UnexpectedRpcError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LicensePollFailed::LicensePollFailed(const LicensePollFailed& other) noexcept(false)
@@ -2815,25 +2026,21 @@ LicensePollFailed::LicensePollFailed(const LicensePollFailed& other) noexcept(fa
     , set_fields_{other.set_fields_} {}
 
 void LicensePollFailed::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LicensePollFailed::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LicensePollFailed::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LicensePollFailed::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LicenseExpiredWarning::LicenseExpiredWarning(const LicenseExpiredWarning& other) noexcept(false)
@@ -2841,25 +2048,21 @@ LicenseExpiredWarning::LicenseExpiredWarning(const LicenseExpiredWarning& other)
     , set_fields_{other.set_fields_} {}
 
 void LicenseExpiredWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<horus::pb::LogMetadata_Timestamp>(writer, /*tag=*/ 1, expiration_time_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LicenseExpiredWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LicenseExpiredWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<horus::pb::LogMetadata_Timestamp>(reader, expiration_time_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LicenseExpiredWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LicenseUsageExceededWarning::LicenseUsageExceededWarning(const LicenseUsageExceededWarning& other) noexcept(false)
@@ -2868,33 +2071,21 @@ LicenseUsageExceededWarning::LicenseUsageExceededWarning(const LicenseUsageExcee
     , set_fields_{other.set_fields_} {}
 
 void LicenseUsageExceededWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 1, lidar_count_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::int64_t>(writer, /*tag=*/ 2, max_lidar_count_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LicenseUsageExceededWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LicenseUsageExceededWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint64_t>(reader, lidar_count_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::int64_t>(reader, max_lidar_count_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LicenseUsageExceededWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 StaticThreadPoolSlowTaskWarning::StaticThreadPoolSlowTaskWarning(const StaticThreadPoolSlowTaskWarning& other) noexcept(false)
@@ -2903,33 +2094,21 @@ StaticThreadPoolSlowTaskWarning::StaticThreadPoolSlowTaskWarning(const StaticThr
     , set_fields_{other.set_fields_} {}
 
 void StaticThreadPoolSlowTaskWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<horus::pb::LogMetadata_Duration>(writer, /*tag=*/ 1, time_elapsed_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<horus::pb::LogMetadata_SourceLocation>(writer, /*tag=*/ 2, enqueue_location_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t StaticThreadPoolSlowTaskWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void StaticThreadPoolSlowTaskWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<horus::pb::LogMetadata_Duration>(reader, time_elapsed_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<horus::pb::LogMetadata_SourceLocation>(reader, enqueue_location_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void StaticThreadPoolSlowTaskWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 RpcUnsupportedServiceWarning::RpcUnsupportedServiceWarning(const RpcUnsupportedServiceWarning& other) noexcept(false)
@@ -2937,25 +2116,21 @@ RpcUnsupportedServiceWarning::RpcUnsupportedServiceWarning(const RpcUnsupportedS
     , set_fields_{other.set_fields_} {}
 
 void RpcUnsupportedServiceWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 1, service_id_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t RpcUnsupportedServiceWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void RpcUnsupportedServiceWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint32_t>(reader, service_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void RpcUnsupportedServiceWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 WebsocketHandlerProblem::WebsocketHandlerProblem(const WebsocketHandlerProblem& other) noexcept(false)
@@ -2963,25 +2138,21 @@ WebsocketHandlerProblem::WebsocketHandlerProblem(const WebsocketHandlerProblem&
     , set_fields_{other.set_fields_} {}
 
 void WebsocketHandlerProblem::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, what_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t WebsocketHandlerProblem::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void WebsocketHandlerProblem::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, what_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void WebsocketHandlerProblem::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 WebsocketDeserializeError::WebsocketDeserializeError(const WebsocketDeserializeError& other) noexcept(false)
@@ -2989,25 +2160,21 @@ WebsocketDeserializeError::WebsocketDeserializeError(const WebsocketDeserializeE
     , set_fields_{other.set_fields_} {}
 
 void WebsocketDeserializeError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, what_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t WebsocketDeserializeError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void WebsocketDeserializeError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, what_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void WebsocketDeserializeError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 WebsocketExpiredRpcEndpointWarning::WebsocketExpiredRpcEndpointWarning(const WebsocketExpiredRpcEndpointWarning& other) noexcept(false)
@@ -3015,25 +2182,21 @@ WebsocketExpiredRpcEndpointWarning::WebsocketExpiredRpcEndpointWarning(const Web
     , set_fields_{other.set_fields_} {}
 
 void WebsocketExpiredRpcEndpointWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, uri_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t WebsocketExpiredRpcEndpointWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void WebsocketExpiredRpcEndpointWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, uri_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void WebsocketExpiredRpcEndpointWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 WebsocketQueueOverloadedWarning::WebsocketQueueOverloadedWarning(const WebsocketQueueOverloadedWarning& other) noexcept(false)
@@ -3042,33 +2205,21 @@ WebsocketQueueOverloadedWarning::WebsocketQueueOverloadedWarning(const Websocket
     , set_fields_{other.set_fields_} {}
 
 void WebsocketQueueOverloadedWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 1, current_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 2, max_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t WebsocketQueueOverloadedWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void WebsocketQueueOverloadedWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint64_t>(reader, current_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::uint64_t>(reader, max_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void WebsocketQueueOverloadedWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 RpcFailedToNotifyWarning::RpcFailedToNotifyWarning(const RpcFailedToNotifyWarning& other) noexcept(false)
@@ -3079,49 +2230,21 @@ RpcFailedToNotifyWarning::RpcFailedToNotifyWarning(const RpcFailedToNotifyWarnin
     , set_fields_{other.set_fields_} {}
 
 void RpcFailedToNotifyWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, service_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, uri_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, notification_name_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 4, what_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t RpcFailedToNotifyWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void RpcFailedToNotifyWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, service_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, uri_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, notification_name_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<CowBytes>(reader, what_);
-        set_fields_[3] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void RpcFailedToNotifyWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ConfigSubscriptionFailedWarning::ConfigSubscriptionFailedWarning(const ConfigSubscriptionFailedWarning& other) noexcept(false)
@@ -3129,25 +2252,21 @@ ConfigSubscriptionFailedWarning::ConfigSubscriptionFailedWarning(const ConfigSub
     , set_fields_{other.set_fields_} {}
 
 void ConfigSubscriptionFailedWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ConfigSubscriptionFailedWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ConfigSubscriptionFailedWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ConfigSubscriptionFailedWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ThreadPoolClampedWorkersWarning::ThreadPoolClampedWorkersWarning(const ThreadPoolClampedWorkersWarning& other) noexcept(false)
@@ -3156,33 +2275,21 @@ ThreadPoolClampedWorkersWarning::ThreadPoolClampedWorkersWarning(const ThreadPoo
     , set_fields_{other.set_fields_} {}
 
 void ThreadPoolClampedWorkersWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 1, clamped_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 2, requested_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ThreadPoolClampedWorkersWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ThreadPoolClampedWorkersWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint64_t>(reader, clamped_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::uint64_t>(reader, requested_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ThreadPoolClampedWorkersWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -3194,25 +2301,21 @@ ClampingDataWarning::ClampingDataWarning(const ClampingDataWarning& other) noexc
     , set_fields_{other.set_fields_} {}
 
 void ClampingDataWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ClampingDataWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ClampingDataWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ClampingDataWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LidarIncompatibleValues::LidarIncompatibleValues(const LidarIncompatibleValues& other) noexcept(false)
@@ -3225,65 +2328,21 @@ LidarIncompatibleValues::LidarIncompatibleValues(const LidarIncompatibleValues&
     , set_fields_{other.set_fields_} {}
 
 void LidarIncompatibleValues::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_ip1_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_ip2_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, value1_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 4, value2_);
-  }
-  if (set_fields_[4]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 5, value_names_);
-  }
-  if (set_fields_[5]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 6, resolution_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LidarIncompatibleValues::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LidarIncompatibleValues::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_ip1_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_ip2_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, value1_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<CowBytes>(reader, value2_);
-        set_fields_[3] = true;
-        break;
-      }
-      case 5: {
-        DeserializeField<CowBytes>(reader, value_names_);
-        set_fields_[4] = true;
-        break;
-      }
-      case 6: {
-        DeserializeField<CowBytes>(reader, resolution_);
-        set_fields_[5] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LidarIncompatibleValues::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 CannotDetermineContainerIdError::CannotDetermineContainerIdError(const CannotDetermineContainerIdError& other) noexcept(false)
@@ -3291,25 +2350,21 @@ CannotDetermineContainerIdError::CannotDetermineContainerIdError(const CannotDet
     , set_fields_{other.set_fields_} {}
 
 void CannotDetermineContainerIdError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, container_id_file_path_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t CannotDetermineContainerIdError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void CannotDetermineContainerIdError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, container_id_file_path_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void CannotDetermineContainerIdError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 StartedLidarDriver::StartedLidarDriver(const StartedLidarDriver& other) noexcept(false)
@@ -3318,33 +2373,21 @@ StartedLidarDriver::StartedLidarDriver(const StartedLidarDriver& other) noexcept
     , set_fields_{other.set_fields_} {}
 
 void StartedLidarDriver::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t StartedLidarDriver::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void StartedLidarDriver::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void StartedLidarDriver::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 CannotStartLidarDriver::CannotStartLidarDriver(const CannotStartLidarDriver& other) noexcept(false)
@@ -3354,41 +2397,21 @@ CannotStartLidarDriver::CannotStartLidarDriver(const CannotStartLidarDriver& oth
     , set_fields_{other.set_fields_} {}
 
 void CannotStartLidarDriver::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t CannotStartLidarDriver::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void CannotStartLidarDriver::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void CannotStartLidarDriver::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 StoppedLidarDriver::StoppedLidarDriver(const StoppedLidarDriver& other) noexcept(false)
@@ -3397,33 +2420,21 @@ StoppedLidarDriver::StoppedLidarDriver(const StoppedLidarDriver& other) noexcept
     , set_fields_{other.set_fields_} {}
 
 void StoppedLidarDriver::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t StoppedLidarDriver::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void StoppedLidarDriver::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void StoppedLidarDriver::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 CannotStopLidarDriver::CannotStopLidarDriver(const CannotStopLidarDriver& other) noexcept(false)
@@ -3433,41 +2444,21 @@ CannotStopLidarDriver::CannotStopLidarDriver(const CannotStopLidarDriver& other)
     , set_fields_{other.set_fields_} {}
 
 void CannotStopLidarDriver::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t CannotStopLidarDriver::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void CannotStopLidarDriver::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void CannotStopLidarDriver::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 RestartedLidarDriver::RestartedLidarDriver(const RestartedLidarDriver& other) noexcept(false)
@@ -3476,33 +2467,21 @@ RestartedLidarDriver::RestartedLidarDriver(const RestartedLidarDriver& other) no
     , set_fields_{other.set_fields_} {}
 
 void RestartedLidarDriver::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t RestartedLidarDriver::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void RestartedLidarDriver::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void RestartedLidarDriver::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 CannotRestartLidarDriver::CannotRestartLidarDriver(const CannotRestartLidarDriver& other) noexcept(false)
@@ -3512,41 +2491,21 @@ CannotRestartLidarDriver::CannotRestartLidarDriver(const CannotRestartLidarDrive
     , set_fields_{other.set_fields_} {}
 
 void CannotRestartLidarDriver::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t CannotRestartLidarDriver::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void CannotRestartLidarDriver::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void CannotRestartLidarDriver::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 RemovedUnusedLidarDriver::RemovedUnusedLidarDriver(const RemovedUnusedLidarDriver& other) noexcept(false)
@@ -3555,33 +2514,21 @@ RemovedUnusedLidarDriver::RemovedUnusedLidarDriver(const RemovedUnusedLidarDrive
     , set_fields_{other.set_fields_} {}
 
 void RemovedUnusedLidarDriver::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t RemovedUnusedLidarDriver::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void RemovedUnusedLidarDriver::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void RemovedUnusedLidarDriver::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 CannotRemoveUnusedLidarDriver::CannotRemoveUnusedLidarDriver(const CannotRemoveUnusedLidarDriver& other) noexcept(false)
@@ -3591,41 +2538,21 @@ CannotRemoveUnusedLidarDriver::CannotRemoveUnusedLidarDriver(const CannotRemoveU
     , set_fields_{other.set_fields_} {}
 
 void CannotRemoveUnusedLidarDriver::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t CannotRemoveUnusedLidarDriver::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void CannotRemoveUnusedLidarDriver::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void CannotRemoveUnusedLidarDriver::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LidarDriverGcFailure::LidarDriverGcFailure(const LidarDriverGcFailure& other) noexcept(false)
@@ -3633,25 +2560,21 @@ LidarDriverGcFailure::LidarDriverGcFailure(const LidarDriverGcFailure& other) no
     , set_fields_{other.set_fields_} {}
 
 void LidarDriverGcFailure::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LidarDriverGcFailure::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LidarDriverGcFailure::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LidarDriverGcFailure::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 IdSpaceExhausted::IdSpaceExhausted(const IdSpaceExhausted& other) noexcept(false)
@@ -3659,25 +2582,21 @@ IdSpaceExhausted::IdSpaceExhausted(const IdSpaceExhausted& other) noexcept(false
     , set_fields_{other.set_fields_} {}
 
 void IdSpaceExhausted::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, prefix_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t IdSpaceExhausted::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void IdSpaceExhausted::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, prefix_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void IdSpaceExhausted::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 PreprocessingToPointAggregatorPointsSkipped::PreprocessingToPointAggregatorPointsSkipped(const PreprocessingToPointAggregatorPointsSkipped& other) noexcept(false)
@@ -3686,33 +2605,21 @@ PreprocessingToPointAggregatorPointsSkipped::PreprocessingToPointAggregatorPoint
     , set_fields_{other.set_fields_} {}
 
 void PreprocessingToPointAggregatorPointsSkipped::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 1, num_skipped_points_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<horus::pb::LogMetadata_Duration>(writer, /*tag=*/ 2, check_interval_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t PreprocessingToPointAggregatorPointsSkipped::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void PreprocessingToPointAggregatorPointsSkipped::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint64_t>(reader, num_skipped_points_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<horus::pb::LogMetadata_Duration>(reader, check_interval_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void PreprocessingToPointAggregatorPointsSkipped::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 MinMsgIntervalLessThanThreshold::MinMsgIntervalLessThanThreshold(const MinMsgIntervalLessThanThreshold& other) noexcept(false)
@@ -3722,41 +2629,21 @@ MinMsgIntervalLessThanThreshold::MinMsgIntervalLessThanThreshold(const MinMsgInt
     , set_fields_{other.set_fields_} {}
 
 void MinMsgIntervalLessThanThreshold::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<horus::pb::LogMetadata_Duration>(writer, /*tag=*/ 2, threshold_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t MinMsgIntervalLessThanThreshold::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void MinMsgIntervalLessThanThreshold::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<horus::pb::LogMetadata_Duration>(reader, threshold_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void MinMsgIntervalLessThanThreshold::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 FailedToCleanupRosWarning::FailedToCleanupRosWarning(const FailedToCleanupRosWarning& other) noexcept(false)
@@ -3764,25 +2651,21 @@ FailedToCleanupRosWarning::FailedToCleanupRosWarning(const FailedToCleanupRosWar
     , set_fields_{other.set_fields_} {}
 
 void FailedToCleanupRosWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t FailedToCleanupRosWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void FailedToCleanupRosWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void FailedToCleanupRosWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 RpcDisconnectedWarning::RpcDisconnectedWarning(const RpcDisconnectedWarning& other) noexcept(false)
@@ -3791,33 +2674,21 @@ RpcDisconnectedWarning::RpcDisconnectedWarning(const RpcDisconnectedWarning& oth
     , set_fields_{other.set_fields_} {}
 
 void RpcDisconnectedWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, request_name_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, endpoint_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t RpcDisconnectedWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void RpcDisconnectedWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, request_name_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, endpoint_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void RpcDisconnectedWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 RpcUnhandledError::RpcUnhandledError(const RpcUnhandledError& other) noexcept(false)
@@ -3826,33 +2697,21 @@ RpcUnhandledError::RpcUnhandledError(const RpcUnhandledError& other) noexcept(fa
     , set_fields_{other.set_fields_} {}
 
 void RpcUnhandledError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, request_name_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t RpcUnhandledError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void RpcUnhandledError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, request_name_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void RpcUnhandledError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 TimeDiffOutOfRangeWarning::TimeDiffOutOfRangeWarning(const TimeDiffOutOfRangeWarning& other) noexcept(false)
@@ -3862,41 +2721,21 @@ TimeDiffOutOfRangeWarning::TimeDiffOutOfRangeWarning(const TimeDiffOutOfRangeWar
     , set_fields_{other.set_fields_} {}
 
 void TimeDiffOutOfRangeWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<horus::pb::LogMetadata_Timestamp>(writer, /*tag=*/ 1, prev_time_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<horus::pb::LogMetadata_Timestamp>(writer, /*tag=*/ 2, curr_time_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<horus::pb::LogMetadata_Duration>(writer, /*tag=*/ 3, diff_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t TimeDiffOutOfRangeWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void TimeDiffOutOfRangeWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<horus::pb::LogMetadata_Timestamp>(reader, prev_time_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<horus::pb::LogMetadata_Timestamp>(reader, curr_time_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<horus::pb::LogMetadata_Duration>(reader, diff_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void TimeDiffOutOfRangeWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 TensorrtLog::TensorrtLog(const TensorrtLog& other) noexcept(false)
@@ -3904,25 +2743,21 @@ TensorrtLog::TensorrtLog(const TensorrtLog& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void TensorrtLog::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, log_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t TensorrtLog::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void TensorrtLog::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, log_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void TensorrtLog::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -3934,25 +2769,21 @@ CalibrationMapNotFound::CalibrationMapNotFound(const CalibrationMapNotFound& oth
     , set_fields_{other.set_fields_} {}
 
 void CalibrationMapNotFound::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, path_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t CalibrationMapNotFound::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void CalibrationMapNotFound::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, path_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void CalibrationMapNotFound::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 CalibrationMapNotValid::CalibrationMapNotValid(const CalibrationMapNotValid& other) noexcept(false)
@@ -3960,25 +2791,21 @@ CalibrationMapNotValid::CalibrationMapNotValid(const CalibrationMapNotValid& oth
     , set_fields_{other.set_fields_} {}
 
 void CalibrationMapNotValid::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, path_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t CalibrationMapNotValid::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void CalibrationMapNotValid::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, path_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void CalibrationMapNotValid::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 CalibrationMapPathAlreadyExists::CalibrationMapPathAlreadyExists(const CalibrationMapPathAlreadyExists& other) noexcept(false)
@@ -3986,25 +2813,21 @@ CalibrationMapPathAlreadyExists::CalibrationMapPathAlreadyExists(const Calibrati
     , set_fields_{other.set_fields_} {}
 
 void CalibrationMapPathAlreadyExists::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, path_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t CalibrationMapPathAlreadyExists::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void CalibrationMapPathAlreadyExists::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, path_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void CalibrationMapPathAlreadyExists::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 FailedToSaveCalibrationMap::FailedToSaveCalibrationMap(const FailedToSaveCalibrationMap& other) noexcept(false)
@@ -4012,25 +2835,21 @@ FailedToSaveCalibrationMap::FailedToSaveCalibrationMap(const FailedToSaveCalibra
     , set_fields_{other.set_fields_} {}
 
 void FailedToSaveCalibrationMap::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, path_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t FailedToSaveCalibrationMap::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void FailedToSaveCalibrationMap::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, path_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void FailedToSaveCalibrationMap::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 FailedToRemoveCalibrationMap::FailedToRemoveCalibrationMap(const FailedToRemoveCalibrationMap& other) noexcept(false)
@@ -4038,25 +2857,21 @@ FailedToRemoveCalibrationMap::FailedToRemoveCalibrationMap(const FailedToRemoveC
     , set_fields_{other.set_fields_} {}
 
 void FailedToRemoveCalibrationMap::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, path_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t FailedToRemoveCalibrationMap::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void FailedToRemoveCalibrationMap::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, path_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void FailedToRemoveCalibrationMap::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 FailedToIterateInDirectory::FailedToIterateInDirectory(const FailedToIterateInDirectory& other) noexcept(false)
@@ -4066,41 +2881,21 @@ FailedToIterateInDirectory::FailedToIterateInDirectory(const FailedToIterateInDi
     , set_fields_{other.set_fields_} {}
 
 void FailedToIterateInDirectory::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, directory_name_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, directory_path_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t FailedToIterateInDirectory::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void FailedToIterateInDirectory::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, directory_name_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, directory_path_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void FailedToIterateInDirectory::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -4115,33 +2910,21 @@ BagStreamNotFound::BagStreamNotFound(const BagStreamNotFound& other) noexcept(fa
     , set_fields_{other.set_fields_} {}
 
 void BagStreamNotFound::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, bag_path_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, stream_id_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t BagStreamNotFound::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void BagStreamNotFound::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, bag_path_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, stream_id_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void BagStreamNotFound::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 EvaluationBagStartedInfo::EvaluationBagStartedInfo(const EvaluationBagStartedInfo& other) noexcept(false)
@@ -4149,25 +2932,21 @@ EvaluationBagStartedInfo::EvaluationBagStartedInfo(const EvaluationBagStartedInf
     , set_fields_{other.set_fields_} {}
 
 void EvaluationBagStartedInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, bag_path_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t EvaluationBagStartedInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void EvaluationBagStartedInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, bag_path_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void EvaluationBagStartedInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 EvaluationBagFinishedInfo::EvaluationBagFinishedInfo(const EvaluationBagFinishedInfo& other) noexcept(false)
@@ -4175,25 +2954,21 @@ EvaluationBagFinishedInfo::EvaluationBagFinishedInfo(const EvaluationBagFinished
     , set_fields_{other.set_fields_} {}
 
 void EvaluationBagFinishedInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, bag_path_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t EvaluationBagFinishedInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void EvaluationBagFinishedInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, bag_path_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void EvaluationBagFinishedInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 BagNotFound::BagNotFound(const BagNotFound& other) noexcept(false)
@@ -4201,25 +2976,21 @@ BagNotFound::BagNotFound(const BagNotFound& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void BagNotFound::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, bag_path_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t BagNotFound::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void BagNotFound::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, bag_path_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void BagNotFound::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 BuildingPipelineInfo::BuildingPipelineInfo(const BuildingPipelineInfo& other) noexcept(false)
@@ -4227,25 +2998,21 @@ BuildingPipelineInfo::BuildingPipelineInfo(const BuildingPipelineInfo& other) no
     , set_fields_{other.set_fields_} {}
 
 void BuildingPipelineInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, pipeline_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t BuildingPipelineInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void BuildingPipelineInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, pipeline_name_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void BuildingPipelineInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 BagIsNotEvaluation::BagIsNotEvaluation(const BagIsNotEvaluation& other) noexcept(false)
@@ -4253,25 +3020,21 @@ BagIsNotEvaluation::BagIsNotEvaluation(const BagIsNotEvaluation& other) noexcept
     , set_fields_{other.set_fields_} {}
 
 void BagIsNotEvaluation::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, bag_path_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t BagIsNotEvaluation::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
+}
+
+void BagIsNotEvaluation::DeserializeFrom(PbReader& reader) noexcept(false) {
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
 }
 
-void BagIsNotEvaluation::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, bag_path_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+void BagIsNotEvaluation::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -4281,25 +3044,21 @@ AutoGroundCalibrationWarning::AutoGroundCalibrationWarning(const AutoGroundCalib
     , set_fields_{other.set_fields_} {}
 
 void AutoGroundCalibrationWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, failed_lidar_ids_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t AutoGroundCalibrationWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void AutoGroundCalibrationWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 2: {
-        DeserializeField<CowBytes>(reader, failed_lidar_ids_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void AutoGroundCalibrationWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -4313,25 +3072,21 @@ ModelInitInProgressInfo::ModelInitInProgressInfo(const ModelInitInProgressInfo&
     , set_fields_{other.set_fields_} {}
 
 void ModelInitInProgressInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, component_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ModelInitInProgressInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ModelInitInProgressInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, component_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ModelInitInProgressInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 RpcTimeoutWithResolutionWarning::RpcTimeoutWithResolutionWarning(const RpcTimeoutWithResolutionWarning& other) noexcept(false)
@@ -4342,49 +3097,21 @@ RpcTimeoutWithResolutionWarning::RpcTimeoutWithResolutionWarning(const RpcTimeou
     , set_fields_{other.set_fields_} {}
 
 void RpcTimeoutWithResolutionWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, request_name_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, endpoint_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<horus::pb::LogMetadata_Duration>(writer, /*tag=*/ 3, elapsed_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 4, resolution_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t RpcTimeoutWithResolutionWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void RpcTimeoutWithResolutionWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, request_name_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, endpoint_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<horus::pb::LogMetadata_Duration>(reader, elapsed_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<CowBytes>(reader, resolution_);
-        set_fields_[3] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void RpcTimeoutWithResolutionWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 CalibrationWasCancelledInfo::CalibrationWasCancelledInfo(const CalibrationWasCancelledInfo& other) noexcept(false)
@@ -4392,25 +3119,21 @@ CalibrationWasCancelledInfo::CalibrationWasCancelledInfo(const CalibrationWasCan
     , set_fields_{other.set_fields_} {}
 
 void CalibrationWasCancelledInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, calibration_process_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t CalibrationWasCancelledInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void CalibrationWasCancelledInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, calibration_process_name_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void CalibrationWasCancelledInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 CalibrationMapRecordingFailedToStart::CalibrationMapRecordingFailedToStart(const CalibrationMapRecordingFailedToStart& other) noexcept(false)
@@ -4418,25 +3141,21 @@ CalibrationMapRecordingFailedToStart::CalibrationMapRecordingFailedToStart(const
     , set_fields_{other.set_fields_} {}
 
 void CalibrationMapRecordingFailedToStart::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, path_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t CalibrationMapRecordingFailedToStart::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void CalibrationMapRecordingFailedToStart::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, path_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void CalibrationMapRecordingFailedToStart::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 DetectionPipelineRequestedResetInfo::DetectionPipelineRequestedResetInfo(const DetectionPipelineRequestedResetInfo& other) noexcept(false)
@@ -4444,25 +3163,21 @@ DetectionPipelineRequestedResetInfo::DetectionPipelineRequestedResetInfo(const D
     , set_fields_{other.set_fields_} {}
 
 void DetectionPipelineRequestedResetInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, reason_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t DetectionPipelineRequestedResetInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void DetectionPipelineRequestedResetInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, reason_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void DetectionPipelineRequestedResetInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 PreprocessingServicePipelineUnavailable::PreprocessingServicePipelineUnavailable(const PreprocessingServicePipelineUnavailable& other) noexcept(false)
@@ -4470,25 +3185,21 @@ PreprocessingServicePipelineUnavailable::PreprocessingServicePipelineUnavailable
     , set_fields_{other.set_fields_} {}
 
 void PreprocessingServicePipelineUnavailable::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, reason_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t PreprocessingServicePipelineUnavailable::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void PreprocessingServicePipelineUnavailable::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, reason_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void PreprocessingServicePipelineUnavailable::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 CircularRecordingDisabledWarning::CircularRecordingDisabledWarning(const CircularRecordingDisabledWarning& other) noexcept(false)
@@ -4496,25 +3207,21 @@ CircularRecordingDisabledWarning::CircularRecordingDisabledWarning(const Circula
     , set_fields_{other.set_fields_} {}
 
 void CircularRecordingDisabledWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, reason_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t CircularRecordingDisabledWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void CircularRecordingDisabledWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, reason_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void CircularRecordingDisabledWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -4530,41 +3237,21 @@ InvalidLidarTimestamp::InvalidLidarTimestamp(const InvalidLidarTimestamp& other)
     , set_fields_{other.set_fields_} {}
 
 void InvalidLidarTimestamp::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<horus::pb::LogMetadata_Timestamp>(writer, /*tag=*/ 2, timestamp_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t InvalidLidarTimestamp::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void InvalidLidarTimestamp::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<horus::pb::LogMetadata_Timestamp>(reader, timestamp_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void InvalidLidarTimestamp::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 CalibrationAccumulatingPointsInfo::CalibrationAccumulatingPointsInfo(const CalibrationAccumulatingPointsInfo& other) noexcept(false)
@@ -4572,25 +3259,21 @@ CalibrationAccumulatingPointsInfo::CalibrationAccumulatingPointsInfo(const Calib
     , set_fields_{other.set_fields_} {}
 
 void CalibrationAccumulatingPointsInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<horus::pb::LogMetadata_Duration>(writer, /*tag=*/ 1, time_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t CalibrationAccumulatingPointsInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void CalibrationAccumulatingPointsInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<horus::pb::LogMetadata_Duration>(reader, time_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void CalibrationAccumulatingPointsInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -4601,33 +3284,21 @@ FileWriteWarning::FileWriteWarning(const FileWriteWarning& other) noexcept(false
     , set_fields_{other.set_fields_} {}
 
 void FileWriteWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, filename_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t FileWriteWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void FileWriteWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, filename_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void FileWriteWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LicenseForbiddenFeature::LicenseForbiddenFeature(const LicenseForbiddenFeature& other) noexcept(false)
@@ -4635,25 +3306,21 @@ LicenseForbiddenFeature::LicenseForbiddenFeature(const LicenseForbiddenFeature&
     , set_fields_{other.set_fields_} {}
 
 void LicenseForbiddenFeature::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, feature_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LicenseForbiddenFeature::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LicenseForbiddenFeature::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, feature_name_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LicenseForbiddenFeature::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 FailedToUpdateConfiguration::FailedToUpdateConfiguration(const FailedToUpdateConfiguration& other) noexcept(false)
@@ -4661,25 +3328,21 @@ FailedToUpdateConfiguration::FailedToUpdateConfiguration(const FailedToUpdateCon
     , set_fields_{other.set_fields_} {}
 
 void FailedToUpdateConfiguration::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t FailedToUpdateConfiguration::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void FailedToUpdateConfiguration::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void FailedToUpdateConfiguration::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -4689,25 +3352,21 @@ ProjectFileInvalidPermissionsError::ProjectFileInvalidPermissionsError(const Pro
     , set_fields_{other.set_fields_} {}
 
 void ProjectFileInvalidPermissionsError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, filename_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ProjectFileInvalidPermissionsError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ProjectFileInvalidPermissionsError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, filename_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ProjectFileInvalidPermissionsError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 PipelineSchedulerError::PipelineSchedulerError(const PipelineSchedulerError& other) noexcept(false)
@@ -4715,25 +3374,21 @@ PipelineSchedulerError::PipelineSchedulerError(const PipelineSchedulerError& oth
     , set_fields_{other.set_fields_} {}
 
 void PipelineSchedulerError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t PipelineSchedulerError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void PipelineSchedulerError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void PipelineSchedulerError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 MultiLidarCalibrationWarning::MultiLidarCalibrationWarning(const MultiLidarCalibrationWarning& other) noexcept(false)
@@ -4741,25 +3396,21 @@ MultiLidarCalibrationWarning::MultiLidarCalibrationWarning(const MultiLidarCalib
     , set_fields_{other.set_fields_} {}
 
 void MultiLidarCalibrationWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, failed_lidar_ids_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t MultiLidarCalibrationWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void MultiLidarCalibrationWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, failed_lidar_ids_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void MultiLidarCalibrationWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -4770,33 +3421,21 @@ OldBagWarning::OldBagWarning(const OldBagWarning& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void OldBagWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, bag_path_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 2, version_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t OldBagWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void OldBagWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, bag_path_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::uint32_t>(reader, version_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void OldBagWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 UpgradingBagInfo::UpgradingBagInfo(const UpgradingBagInfo& other) noexcept(false)
@@ -4804,25 +3443,21 @@ UpgradingBagInfo::UpgradingBagInfo(const UpgradingBagInfo& other) noexcept(false
     , set_fields_{other.set_fields_} {}
 
 void UpgradingBagInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, bag_path_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t UpgradingBagInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void UpgradingBagInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, bag_path_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void UpgradingBagInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 BagCalibrationSaveFailed::BagCalibrationSaveFailed(const BagCalibrationSaveFailed& other) noexcept(false)
@@ -4830,25 +3465,21 @@ BagCalibrationSaveFailed::BagCalibrationSaveFailed(const BagCalibrationSaveFaile
     , set_fields_{other.set_fields_} {}
 
 void BagCalibrationSaveFailed::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t BagCalibrationSaveFailed::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void BagCalibrationSaveFailed::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void BagCalibrationSaveFailed::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 BagUpgradeFailed::BagUpgradeFailed(const BagUpgradeFailed& other) noexcept(false)
@@ -4857,33 +3488,21 @@ BagUpgradeFailed::BagUpgradeFailed(const BagUpgradeFailed& other) noexcept(false
     , set_fields_{other.set_fields_} {}
 
 void BagUpgradeFailed::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, bag_path_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t BagUpgradeFailed::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void BagUpgradeFailed::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, bag_path_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void BagUpgradeFailed::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 UnknownLidarError::UnknownLidarError(const UnknownLidarError& other) noexcept(false)
@@ -4892,33 +3511,21 @@ UnknownLidarError::UnknownLidarError(const UnknownLidarError& other) noexcept(fa
     , set_fields_{other.set_fields_} {}
 
 void UnknownLidarError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t UnknownLidarError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void UnknownLidarError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void UnknownLidarError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 InvalidPointCloudWarning::InvalidPointCloudWarning(const InvalidPointCloudWarning& other) noexcept(false)
@@ -4928,41 +3535,21 @@ InvalidPointCloudWarning::InvalidPointCloudWarning(const InvalidPointCloudWarnin
     , set_fields_{other.set_fields_} {}
 
 void InvalidPointCloudWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, reason_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t InvalidPointCloudWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void InvalidPointCloudWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, reason_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void InvalidPointCloudWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LidarIsDroppingPackets::LidarIsDroppingPackets(const LidarIsDroppingPackets& other) noexcept(false)
@@ -4973,49 +3560,21 @@ LidarIsDroppingPackets::LidarIsDroppingPackets(const LidarIsDroppingPackets& oth
     , set_fields_{other.set_fields_} {}
 
 void LidarIsDroppingPackets::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 2, num_total_dropped_packets_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 3, num_total_expected_packets_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 4, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LidarIsDroppingPackets::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LidarIsDroppingPackets::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::uint64_t>(reader, num_total_dropped_packets_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<std::uint64_t>(reader, num_total_expected_packets_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[3] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LidarIsDroppingPackets::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 RemovedInvalidLidarsFromConfigWarning::RemovedInvalidLidarsFromConfigWarning(const RemovedInvalidLidarsFromConfigWarning& other) noexcept(false)
@@ -5023,25 +3582,21 @@ RemovedInvalidLidarsFromConfigWarning::RemovedInvalidLidarsFromConfigWarning(con
     , set_fields_{other.set_fields_} {}
 
 void RemovedInvalidLidarsFromConfigWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, backup_path_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t RemovedInvalidLidarsFromConfigWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void RemovedInvalidLidarsFromConfigWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, backup_path_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void RemovedInvalidLidarsFromConfigWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 CalibrationMapRecordingFailed::CalibrationMapRecordingFailed(const CalibrationMapRecordingFailed& other) noexcept(false)
@@ -5049,25 +3604,21 @@ CalibrationMapRecordingFailed::CalibrationMapRecordingFailed(const CalibrationMa
     , set_fields_{other.set_fields_} {}
 
 void CalibrationMapRecordingFailed::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, message_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t CalibrationMapRecordingFailed::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void CalibrationMapRecordingFailed::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, message_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void CalibrationMapRecordingFailed::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 DetectionNodeNotFoundError::DetectionNodeNotFoundError(const DetectionNodeNotFoundError& other) noexcept(false)
@@ -5075,25 +3626,21 @@ DetectionNodeNotFoundError::DetectionNodeNotFoundError(const DetectionNodeNotFou
     , set_fields_{other.set_fields_} {}
 
 void DetectionNodeNotFoundError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, node_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t DetectionNodeNotFoundError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void DetectionNodeNotFoundError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, node_name_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void DetectionNodeNotFoundError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 CreatedVersionBackupInfo::CreatedVersionBackupInfo(const CreatedVersionBackupInfo& other) noexcept(false)
@@ -5103,41 +3650,21 @@ CreatedVersionBackupInfo::CreatedVersionBackupInfo(const CreatedVersionBackupInf
     , set_fields_{other.set_fields_} {}
 
 void CreatedVersionBackupInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, old_horus_version_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, new_horus_version_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, backup_path_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t CreatedVersionBackupInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void CreatedVersionBackupInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, old_horus_version_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, new_horus_version_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, backup_path_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void CreatedVersionBackupInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 PlyFileLoadFailedError::PlyFileLoadFailedError(const PlyFileLoadFailedError& other) noexcept(false)
@@ -5146,33 +3673,21 @@ PlyFileLoadFailedError::PlyFileLoadFailedError(const PlyFileLoadFailedError& oth
     , set_fields_{other.set_fields_} {}
 
 void PlyFileLoadFailedError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, file_path_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t PlyFileLoadFailedError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void PlyFileLoadFailedError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, file_path_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void PlyFileLoadFailedError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 HesaiDriverLifecycle::HesaiDriverLifecycle(const HesaiDriverLifecycle& other) noexcept(false)
@@ -5183,49 +3698,21 @@ HesaiDriverLifecycle::HesaiDriverLifecycle(const HesaiDriverLifecycle& other) no
     , set_fields_{other.set_fields_} {}
 
 void HesaiDriverLifecycle::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, action_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_id_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, lidar_name_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 4, lidar_type_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t HesaiDriverLifecycle::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void HesaiDriverLifecycle::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, action_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<CowBytes>(reader, lidar_type_);
-        set_fields_[3] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void HesaiDriverLifecycle::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 HesaiDriverError::HesaiDriverError(const HesaiDriverError& other) noexcept(false)
@@ -5236,49 +3723,21 @@ HesaiDriverError::HesaiDriverError(const HesaiDriverError& other) noexcept(false
     , set_fields_{other.set_fields_} {}
 
 void HesaiDriverError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_id_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, lidar_name_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 4, lidar_type_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t HesaiDriverError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void HesaiDriverError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<CowBytes>(reader, lidar_type_);
-        set_fields_[3] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void HesaiDriverError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 HesaiPacketProcessingFailed::HesaiPacketProcessingFailed(const HesaiPacketProcessingFailed& other) noexcept(false)
@@ -5288,41 +3747,21 @@ HesaiPacketProcessingFailed::HesaiPacketProcessingFailed(const HesaiPacketProces
     , set_fields_{other.set_fields_} {}
 
 void HesaiPacketProcessingFailed::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t HesaiPacketProcessingFailed::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void HesaiPacketProcessingFailed::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void HesaiPacketProcessingFailed::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 HesaiCorrectionFileError::HesaiCorrectionFileError(const HesaiCorrectionFileError& other) noexcept(false)
@@ -5334,57 +3773,21 @@ HesaiCorrectionFileError::HesaiCorrectionFileError(const HesaiCorrectionFileErro
     , set_fields_{other.set_fields_} {}
 
 void HesaiCorrectionFileError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, file_type_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, lidar_id_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 4, lidar_name_);
-  }
-  if (set_fields_[4]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 5, lidar_type_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t HesaiCorrectionFileError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void HesaiCorrectionFileError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, file_type_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[3] = true;
-        break;
-      }
-      case 5: {
-        DeserializeField<CowBytes>(reader, lidar_type_);
-        set_fields_[4] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void HesaiCorrectionFileError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 HesaiPacketStatistics::HesaiPacketStatistics(const HesaiPacketStatistics& other) noexcept(false)
@@ -5398,73 +3801,21 @@ HesaiPacketStatistics::HesaiPacketStatistics(const HesaiPacketStatistics& other)
     , set_fields_{other.set_fields_} {}
 
 void HesaiPacketStatistics::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 1, packets_received_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 2, packets_published_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 3, packets_dropped_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 4, packets_decode_failed_);
-  }
-  if (set_fields_[4]) {
-    SerializeField<double, PbDeserFlags::kFixed>(writer, /*tag=*/ 5, success_rate_);
-  }
-  if (set_fields_[5]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 6, lidar_id_);
-  }
-  if (set_fields_[6]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 7, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t HesaiPacketStatistics::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void HesaiPacketStatistics::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint64_t>(reader, packets_received_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::uint64_t>(reader, packets_published_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<std::uint64_t>(reader, packets_dropped_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<std::uint64_t>(reader, packets_decode_failed_);
-        set_fields_[3] = true;
-        break;
-      }
-      case 5: {
-        DeserializeField<double, PbDeserFlags::kFixed>(reader, success_rate_);
-        set_fields_[4] = true;
-        break;
-      }
-      case 6: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[5] = true;
-        break;
-      }
-      case 7: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[6] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void HesaiPacketStatistics::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 PlyFileWriteFailedError::PlyFileWriteFailedError(const PlyFileWriteFailedError& other) noexcept(false)
@@ -5473,33 +3824,21 @@ PlyFileWriteFailedError::PlyFileWriteFailedError(const PlyFileWriteFailedError&
     , set_fields_{other.set_fields_} {}
 
 void PlyFileWriteFailedError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, file_path_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t PlyFileWriteFailedError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void PlyFileWriteFailedError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, file_path_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void PlyFileWriteFailedError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ProjectSaveError::ProjectSaveError(const ProjectSaveError& other) noexcept(false)
@@ -5507,25 +3846,21 @@ ProjectSaveError::ProjectSaveError(const ProjectSaveError& other) noexcept(false
     , set_fields_{other.set_fields_} {}
 
 void ProjectSaveError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, error_message_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ProjectSaveError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ProjectSaveError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, error_message_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ProjectSaveError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -5535,25 +3870,21 @@ SaveStaticEnvironmentFailed::SaveStaticEnvironmentFailed(const SaveStaticEnviron
     , set_fields_{other.set_fields_} {}
 
 void SaveStaticEnvironmentFailed::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t SaveStaticEnvironmentFailed::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void SaveStaticEnvironmentFailed::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void SaveStaticEnvironmentFailed::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -5563,25 +3894,21 @@ LoadStaticEnvironmentFailed::LoadStaticEnvironmentFailed(const LoadStaticEnviron
     , set_fields_{other.set_fields_} {}
 
 void LoadStaticEnvironmentFailed::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LoadStaticEnvironmentFailed::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LoadStaticEnvironmentFailed::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LoadStaticEnvironmentFailed::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 AttemptToInjectInvalidLidarIdWarning::AttemptToInjectInvalidLidarIdWarning(const AttemptToInjectInvalidLidarIdWarning& other) noexcept(false)
@@ -5589,25 +3916,21 @@ AttemptToInjectInvalidLidarIdWarning::AttemptToInjectInvalidLidarIdWarning(const
     , set_fields_{other.set_fields_} {}
 
 void AttemptToInjectInvalidLidarIdWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t AttemptToInjectInvalidLidarIdWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void AttemptToInjectInvalidLidarIdWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void AttemptToInjectInvalidLidarIdWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ResetBundledPacketDueToUnexpectedPacket::ResetBundledPacketDueToUnexpectedPacket(const ResetBundledPacketDueToUnexpectedPacket& other) noexcept(false)
@@ -5616,33 +3939,21 @@ ResetBundledPacketDueToUnexpectedPacket::ResetBundledPacketDueToUnexpectedPacket
     , set_fields_{other.set_fields_} {}
 
 void ResetBundledPacketDueToUnexpectedPacket::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ResetBundledPacketDueToUnexpectedPacket::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ResetBundledPacketDueToUnexpectedPacket::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ResetBundledPacketDueToUnexpectedPacket::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 PacketBundlerDroppedPacketsWarning::PacketBundlerDroppedPacketsWarning(const PacketBundlerDroppedPacketsWarning& other) noexcept(false)
@@ -5653,49 +3964,21 @@ PacketBundlerDroppedPacketsWarning::PacketBundlerDroppedPacketsWarning(const Pac
     , set_fields_{other.set_fields_} {}
 
 void PacketBundlerDroppedPacketsWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 2, num_dropped_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<horus::pb::LogMetadata_Duration>(writer, /*tag=*/ 3, duration_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 4, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t PacketBundlerDroppedPacketsWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void PacketBundlerDroppedPacketsWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::uint64_t>(reader, num_dropped_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<horus::pb::LogMetadata_Duration>(reader, duration_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[3] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void PacketBundlerDroppedPacketsWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 PacketBundlerFrameJumpWarning::PacketBundlerFrameJumpWarning(const PacketBundlerFrameJumpWarning& other) noexcept(false)
@@ -5706,49 +3989,21 @@ PacketBundlerFrameJumpWarning::PacketBundlerFrameJumpWarning(const PacketBundler
     , set_fields_{other.set_fields_} {}
 
 void PacketBundlerFrameJumpWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 2, frame_id_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 3, next_frame_id_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 4, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t PacketBundlerFrameJumpWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void PacketBundlerFrameJumpWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::uint64_t>(reader, frame_id_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<std::uint64_t>(reader, next_frame_id_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[3] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void PacketBundlerFrameJumpWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LidarCorrectionLoadingSuccess::LidarCorrectionLoadingSuccess(const LidarCorrectionLoadingSuccess& other) noexcept(false)
@@ -5758,41 +4013,21 @@ LidarCorrectionLoadingSuccess::LidarCorrectionLoadingSuccess(const LidarCorrecti
     , set_fields_{other.set_fields_} {}
 
 void LidarCorrectionLoadingSuccess::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, correction_type_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_id_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LidarCorrectionLoadingSuccess::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LidarCorrectionLoadingSuccess::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, correction_type_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LidarCorrectionLoadingSuccess::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LidarCorrectionLoadingFailure::LidarCorrectionLoadingFailure(const LidarCorrectionLoadingFailure& other) noexcept(false)
@@ -5803,49 +4038,21 @@ LidarCorrectionLoadingFailure::LidarCorrectionLoadingFailure(const LidarCorrecti
     , set_fields_{other.set_fields_} {}
 
 void LidarCorrectionLoadingFailure::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, correction_type_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, details_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, lidar_id_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 4, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LidarCorrectionLoadingFailure::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LidarCorrectionLoadingFailure::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, correction_type_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[3] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LidarCorrectionLoadingFailure::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 HesaiPacketStatisticsLidar::HesaiPacketStatisticsLidar(const HesaiPacketStatisticsLidar& other) noexcept(false)
@@ -5858,65 +4065,21 @@ HesaiPacketStatisticsLidar::HesaiPacketStatisticsLidar(const HesaiPacketStatisti
     , set_fields_{other.set_fields_} {}
 
 void HesaiPacketStatisticsLidar::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 1, packets_received_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 2, packets_published_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 3, packets_dropped_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 4, packets_decode_failed_);
-  }
-  if (set_fields_[4]) {
-    SerializeField<double, PbDeserFlags::kFixed>(writer, /*tag=*/ 5, success_rate_);
-  }
-  if (set_fields_[5]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 6, lidar_id_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t HesaiPacketStatisticsLidar::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void HesaiPacketStatisticsLidar::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint64_t>(reader, packets_received_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::uint64_t>(reader, packets_published_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<std::uint64_t>(reader, packets_dropped_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<std::uint64_t>(reader, packets_decode_failed_);
-        set_fields_[3] = true;
-        break;
-      }
-      case 5: {
-        DeserializeField<double, PbDeserFlags::kFixed>(reader, success_rate_);
-        set_fields_[4] = true;
-        break;
-      }
-      case 6: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[5] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void HesaiPacketStatisticsLidar::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LidarTiltDetectionAlignedToCalibrationMapInfo::LidarTiltDetectionAlignedToCalibrationMapInfo(const LidarTiltDetectionAlignedToCalibrationMapInfo& other) noexcept(false)
@@ -5925,33 +4088,21 @@ LidarTiltDetectionAlignedToCalibrationMapInfo::LidarTiltDetectionAlignedToCalibr
     , set_fields_{other.set_fields_} {}
 
 void LidarTiltDetectionAlignedToCalibrationMapInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LidarTiltDetectionAlignedToCalibrationMapInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LidarTiltDetectionAlignedToCalibrationMapInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LidarTiltDetectionAlignedToCalibrationMapInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LidarTiltDetectionMisalignedToCalibrationMapWarning::LidarTiltDetectionMisalignedToCalibrationMapWarning(const LidarTiltDetectionMisalignedToCalibrationMapWarning& other) noexcept(false)
@@ -5962,49 +4113,21 @@ LidarTiltDetectionMisalignedToCalibrationMapWarning::LidarTiltDetectionMisaligne
     , set_fields_{other.set_fields_} {}
 
 void LidarTiltDetectionMisalignedToCalibrationMapWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_name_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<double, PbDeserFlags::kFixed>(writer, /*tag=*/ 3, angle_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<double, PbDeserFlags::kFixed>(writer, /*tag=*/ 4, distance_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LidarTiltDetectionMisalignedToCalibrationMapWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LidarTiltDetectionMisalignedToCalibrationMapWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<double, PbDeserFlags::kFixed>(reader, angle_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<double, PbDeserFlags::kFixed>(reader, distance_);
-        set_fields_[3] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LidarTiltDetectionMisalignedToCalibrationMapWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -6014,25 +4137,21 @@ RecoveredCarIdsInfo::RecoveredCarIdsInfo(const RecoveredCarIdsInfo& other) noexc
     , set_fields_{other.set_fields_} {}
 
 void RecoveredCarIdsInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t RecoveredCarIdsInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void RecoveredCarIdsInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void RecoveredCarIdsInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 FailedToRecoverCarIds::FailedToRecoverCarIds(const FailedToRecoverCarIds& other) noexcept(false)
@@ -6040,25 +4159,21 @@ FailedToRecoverCarIds::FailedToRecoverCarIds(const FailedToRecoverCarIds& other)
     , set_fields_{other.set_fields_} {}
 
 void FailedToRecoverCarIds::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t FailedToRecoverCarIds::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void FailedToRecoverCarIds::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void FailedToRecoverCarIds::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 FailedToEmplaceRecoveredCarId::FailedToEmplaceRecoveredCarId(const FailedToEmplaceRecoveredCarId& other) noexcept(false)
@@ -6066,25 +4181,21 @@ FailedToEmplaceRecoveredCarId::FailedToEmplaceRecoveredCarId(const FailedToEmpla
     , set_fields_{other.set_fields_} {}
 
 void FailedToEmplaceRecoveredCarId::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 1, object_id_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t FailedToEmplaceRecoveredCarId::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void FailedToEmplaceRecoveredCarId::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint64_t>(reader, object_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void FailedToEmplaceRecoveredCarId::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 PersistentStorageError::PersistentStorageError(const PersistentStorageError& other) noexcept(false)
@@ -6093,33 +4204,21 @@ PersistentStorageError::PersistentStorageError(const PersistentStorageError& oth
     , set_fields_{other.set_fields_} {}
 
 void PersistentStorageError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, operation_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, filepath_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t PersistentStorageError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void PersistentStorageError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, operation_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, filepath_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void PersistentStorageError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 TrackCapacityExceededWarning::TrackCapacityExceededWarning(const TrackCapacityExceededWarning& other) noexcept(false)
@@ -6128,33 +4227,21 @@ TrackCapacityExceededWarning::TrackCapacityExceededWarning(const TrackCapacityEx
     , set_fields_{other.set_fields_} {}
 
 void TrackCapacityExceededWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 1, attempted_count_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 2, max_tracks_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t TrackCapacityExceededWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void TrackCapacityExceededWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint64_t>(reader, attempted_count_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::uint64_t>(reader, max_tracks_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void TrackCapacityExceededWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 TrackerStatePathUnavailableWarning::TrackerStatePathUnavailableWarning(const TrackerStatePathUnavailableWarning& other) noexcept(false)
@@ -6162,25 +4249,21 @@ TrackerStatePathUnavailableWarning::TrackerStatePathUnavailableWarning(const Tra
     , set_fields_{other.set_fields_} {}
 
 void TrackerStatePathUnavailableWarning::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, project_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t TrackerStatePathUnavailableWarning::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void TrackerStatePathUnavailableWarning::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, project_name_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void TrackerStatePathUnavailableWarning::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 TrackerStateRecoveryError::TrackerStateRecoveryError(const TrackerStateRecoveryError& other) noexcept(false)
@@ -6188,25 +4271,21 @@ TrackerStateRecoveryError::TrackerStateRecoveryError(const TrackerStateRecoveryE
     , set_fields_{other.set_fields_} {}
 
 void TrackerStateRecoveryError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, error_message_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t TrackerStateRecoveryError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void TrackerStateRecoveryError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, error_message_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void TrackerStateRecoveryError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 TrackerStateSaveError::TrackerStateSaveError(const TrackerStateSaveError& other) noexcept(false)
@@ -6214,25 +4293,21 @@ TrackerStateSaveError::TrackerStateSaveError(const TrackerStateSaveError& other)
     , set_fields_{other.set_fields_} {}
 
 void TrackerStateSaveError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, error_message_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t TrackerStateSaveError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void TrackerStateSaveError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, error_message_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void TrackerStateSaveError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 TrackerIdRecoveryFailedError::TrackerIdRecoveryFailedError(const TrackerIdRecoveryFailedError& other) noexcept(false)
@@ -6241,33 +4316,21 @@ TrackerIdRecoveryFailedError::TrackerIdRecoveryFailedError(const TrackerIdRecove
     , set_fields_{other.set_fields_} {}
 
 void TrackerIdRecoveryFailedError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 1, id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, error_message_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t TrackerIdRecoveryFailedError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void TrackerIdRecoveryFailedError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint64_t>(reader, id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, error_message_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void TrackerIdRecoveryFailedError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 TrackerIdFastForwardFailedError::TrackerIdFastForwardFailedError(const TrackerIdFastForwardFailedError& other) noexcept(false)
@@ -6276,33 +4339,21 @@ TrackerIdFastForwardFailedError::TrackerIdFastForwardFailedError(const TrackerId
     , set_fields_{other.set_fields_} {}
 
 void TrackerIdFastForwardFailedError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 1, target_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, error_message_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t TrackerIdFastForwardFailedError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void TrackerIdFastForwardFailedError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint64_t>(reader, target_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, error_message_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void TrackerIdFastForwardFailedError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 CircularRecordingSnapshotCreated::CircularRecordingSnapshotCreated(const CircularRecordingSnapshotCreated& other) noexcept(false)
@@ -6312,41 +4363,21 @@ CircularRecordingSnapshotCreated::CircularRecordingSnapshotCreated(const Circula
     , set_fields_{other.set_fields_} {}
 
 void CircularRecordingSnapshotCreated::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 1, message_count_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<double, PbDeserFlags::kFixed>(writer, /*tag=*/ 2, actual_duration_seconds_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<double, PbDeserFlags::kFixed>(writer, /*tag=*/ 3, max_buffer_duration_seconds_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t CircularRecordingSnapshotCreated::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void CircularRecordingSnapshotCreated::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint64_t>(reader, message_count_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<double, PbDeserFlags::kFixed>(reader, actual_duration_seconds_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<double, PbDeserFlags::kFixed>(reader, max_buffer_duration_seconds_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void CircularRecordingSnapshotCreated::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 CircularRecordingFileOperationError::CircularRecordingFileOperationError(const CircularRecordingFileOperationError& other) noexcept(false)
@@ -6356,41 +4387,21 @@ CircularRecordingFileOperationError::CircularRecordingFileOperationError(const C
     , set_fields_{other.set_fields_} {}
 
 void CircularRecordingFileOperationError::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, operation_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, file_path_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t CircularRecordingFileOperationError::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void CircularRecordingFileOperationError::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, operation_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, file_path_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void CircularRecordingFileOperationError::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ObjectIdRecoveryRejectedInfo::ObjectIdRecoveryRejectedInfo(const ObjectIdRecoveryRejectedInfo& other) noexcept(false)
@@ -6399,33 +4410,21 @@ ObjectIdRecoveryRejectedInfo::ObjectIdRecoveryRejectedInfo(const ObjectIdRecover
     , set_fields_{other.set_fields_} {}
 
 void ObjectIdRecoveryRejectedInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 1, id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, reason_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ObjectIdRecoveryRejectedInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ObjectIdRecoveryRejectedInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint64_t>(reader, id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, reason_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ObjectIdRecoveryRejectedInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ExpiredRecoveryIdsInfo::ExpiredRecoveryIdsInfo(const ExpiredRecoveryIdsInfo& other) noexcept(false)
@@ -6433,25 +4432,21 @@ ExpiredRecoveryIdsInfo::ExpiredRecoveryIdsInfo(const ExpiredRecoveryIdsInfo& oth
     , set_fields_{other.set_fields_} {}
 
 void ExpiredRecoveryIdsInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, expired_ids_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ExpiredRecoveryIdsInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ExpiredRecoveryIdsInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, expired_ids_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ExpiredRecoveryIdsInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 HesaiUdpReceiverInfo::HesaiUdpReceiverInfo(const HesaiUdpReceiverInfo& other) noexcept(false)
@@ -6461,41 +4456,21 @@ HesaiUdpReceiverInfo::HesaiUdpReceiverInfo(const HesaiUdpReceiverInfo& other) no
     , set_fields_{other.set_fields_} {}
 
 void HesaiUdpReceiverInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, action_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_id_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, lidar_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t HesaiUdpReceiverInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void HesaiUdpReceiverInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, action_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void HesaiUdpReceiverInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 DbCommitFailed::DbCommitFailed(const DbCommitFailed& other) noexcept(false)
@@ -6504,33 +4479,21 @@ DbCommitFailed::DbCommitFailed(const DbCommitFailed& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void DbCommitFailed::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, action_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, error_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t DbCommitFailed::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void DbCommitFailed::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, action_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, error_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void DbCommitFailed::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 DetectionServiceRpcQueueFull::DetectionServiceRpcQueueFull(const DetectionServiceRpcQueueFull& other) noexcept(false)
@@ -6540,41 +4503,21 @@ DetectionServiceRpcQueueFull::DetectionServiceRpcQueueFull(const DetectionServic
     , set_fields_{other.set_fields_} {}
 
 void DetectionServiceRpcQueueFull::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 1, num_packets_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 2, queue_size_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, node_id_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t DetectionServiceRpcQueueFull::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void DetectionServiceRpcQueueFull::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint64_t>(reader, num_packets_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::uint64_t>(reader, queue_size_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, node_id_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void DetectionServiceRpcQueueFull::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ProjectMigrationFailed::ProjectMigrationFailed(const ProjectMigrationFailed& other) noexcept(false)
@@ -6582,27 +4525,2476 @@ ProjectMigrationFailed::ProjectMigrationFailed(const ProjectMigrationFailed& oth
     , set_fields_{other.set_fields_} {}
 
 void ProjectMigrationFailed::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, details_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
 }
 
-void ProjectMigrationFailed::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, details_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+std::size_t ProjectMigrationFailed::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
+void ProjectMigrationFailed::DeserializeFrom(PbReader& reader) noexcept(false) {
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ProjectMigrationFailed::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
+}
+
+// MARK: Field tables
+
+// Messages are not standard-layout since they have a vtable, so `offsetof()` is only
+// conditionally-supported on them; it is supported by all compilers targeted by the SDK.
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
+const horus_internal::PbMessageTable& Generic::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(Generic, message_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(Generic, location_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_SourceLocation>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& RpcConnectionError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(RpcConnectionError, target_service_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(RpcConnectionError, target_uri_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(RpcConnectionError, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& InvalidProjectName::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(InvalidProjectName, name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(InvalidProjectName, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ProjectNotFound::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ProjectNotFound, name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ProjectAlreadyExists::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ProjectAlreadyExists, name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& InvalidConfiguration::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(InvalidConfiguration, validation_errors_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<ValidationError>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& EntityNotFound::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(EntityNotFound, id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(EntityNotFound, entity_type_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& RpcDisconnectionError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(RpcDisconnectionError, target_service_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(RpcDisconnectionError, target_uri_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(RpcDisconnectionError, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& DroppedLogs::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(DroppedLogs, n_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& OpenedProject::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(OpenedProject, project_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& CreatedProject::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(CreatedProject, project_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(CreatedProject, source_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& InvalidRequest::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(InvalidRequest, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& SanityCheckError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(SanityCheckError, sanity_check_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(SanityCheckError, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& BagFailedToOpen::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(BagFailedToOpen, horus_bag_path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(BagFailedToOpen, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& BagFailedToClose::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(BagFailedToClose, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& BagConversionFailed::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(BagConversionFailed, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& BagFailedToWrite::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(BagFailedToWrite, name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(BagFailedToWrite, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& CalibrationError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(CalibrationError, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ProjectManagerFailedToStartRecording::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ProjectManagerFailedToStartRecording, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ProjectManagerFailedToStopRecording::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ProjectManagerFailedToStopRecording, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ServiceConnectionTimedOut::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ServiceConnectionTimedOut, node_type_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(ServiceConnectionTimedOut, node_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& BagRecorderAlreadyRunning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(BagRecorderAlreadyRunning, path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LicenseServerConnectionError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LicenseServerConnectionError, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LicenseError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LicenseError, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LicenseExpiredError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LicenseExpiredError, expiration_time_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_Timestamp>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LicenseExceededError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LicenseExceededError, lidar_count_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/ 2, offsetof(LicenseExceededError, max_lidar_count_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LicenseHostMachineError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LicenseHostMachineError, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LicensePrivilegeError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LicensePrivilegeError, missing_privilege_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(LicensePrivilegeError, level_error_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& MultipleLicensesWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(MultipleLicensesWarning, non_expired_licenses_count_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/ 2, offsetof(MultipleLicensesWarning, active_license_filename_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LicenseCurrentLicenseStatusInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LicenseCurrentLicenseStatusInfo, expiration_time_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_Timestamp>>::kOps},
+      {/*tag=*/ 2, offsetof(LicenseCurrentLicenseStatusInfo, max_lidar_count_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& BagRecordingStoppedInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(BagRecordingStoppedInfo, path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(BagRecordingStoppedInfo, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& BagRecordingFailedToStart::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(BagRecordingFailedToStart, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& BagRecordingStartedInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(BagRecordingStartedInfo, path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& InputSourceChangeRequestedInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(InputSourceChangeRequestedInfo, source_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& InputSourceSwitchedInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(InputSourceSwitchedInfo, source_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& RpcTimeoutWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(RpcTimeoutWarning, request_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(RpcTimeoutWarning, endpoint_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(RpcTimeoutWarning, elapsed_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_Duration>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& CannotWriteLogFile::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(CannotWriteLogFile, path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(CannotWriteLogFile, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& PointCloudParsingFailureWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(PointCloudParsingFailureWarning, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LidarIsDead::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LidarIsDead, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(LidarIsDead, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LidarIsNotDeadAnymore::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LidarIsNotDeadAnymore, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(LidarIsNotDeadAnymore, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LidarIsObstructed::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LidarIsObstructed, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(LidarIsObstructed, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LidarIsNotObstructedAnymore::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LidarIsNotObstructedAnymore, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(LidarIsNotObstructedAnymore, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LidarIsTilted::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LidarIsTilted, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(LidarIsTilted, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LidarIsNotTiltedAnymore::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LidarIsNotTiltedAnymore, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(LidarIsNotTiltedAnymore, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LidarHasBeenAutomaticallyRecalibrated::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LidarHasBeenAutomaticallyRecalibrated, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(LidarHasBeenAutomaticallyRecalibrated, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(LidarHasBeenAutomaticallyRecalibrated, translation_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 4, offsetof(LidarHasBeenAutomaticallyRecalibrated, rotation_rpy_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LidarAutoCorrectionFailed::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LidarAutoCorrectionFailed, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(LidarAutoCorrectionFailed, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(LidarAutoCorrectionFailed, failure_count_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LidarIcpFailed::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LidarIcpFailed, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(LidarIcpFailed, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(LidarIcpFailed, failure_count_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ReceivedFirstDataForLidar::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ReceivedFirstDataForLidar, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(ReceivedFirstDataForLidar, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& TerminationFailureError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(TerminationFailureError, component_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(TerminationFailureError, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& FrameProcessingError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(FrameProcessingError, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ThreadPoolUnavailableError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ThreadPoolUnavailableError, consequence_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& InvalidArgument::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(InvalidArgument, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ComponentInitializationFailureFatal::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ComponentInitializationFailureFatal, component_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(ComponentInitializationFailureFatal, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& UnhandledEnumCaseError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(UnhandledEnumCaseError, case_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(UnhandledEnumCaseError, location_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_SourceLocation>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& DiscardingDataError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(DiscardingDataError, component_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(DiscardingDataError, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& DiscardingDataWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(DiscardingDataWarning, component_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(DiscardingDataWarning, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& NothingToProcess::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(NothingToProcess, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& InvalidComponentConfiguration::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(InvalidComponentConfiguration, component_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(InvalidComponentConfiguration, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ChannelReceiverNotFoundWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ChannelReceiverNotFoundWarning, key_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ModelLoadFailure::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ModelLoadFailure, model_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(ModelLoadFailure, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ModelExecutionFailureError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ModelExecutionFailureError, model_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(ModelExecutionFailureError, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ServiceReadyInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ServiceReadyInfo, service_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ModelPreparingInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ModelPreparingInfo, model_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ModelInitializedInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ModelInitializedInfo, name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ModelInitializationFailureWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ModelInitializationFailureWarning, model_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(ModelInitializationFailureWarning, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& RosSpinnerStoppedWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(RosSpinnerStoppedWarning, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ConfigNodeNotFoundError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ConfigNodeNotFoundError, node_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& BagTimestampOutOfOrderError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(BagTimestampOutOfOrderError, prior_timestamp_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_Timestamp>>::kOps},
+      {/*tag=*/ 2, offsetof(BagTimestampOutOfOrderError, current_timestamp_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_Timestamp>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& BagReplayUnexpectedTimestampError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(BagReplayUnexpectedTimestampError, expected_timestamp_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_Timestamp>>::kOps},
+      {/*tag=*/ 2, offsetof(BagReplayUnexpectedTimestampError, received_timestamp_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_Timestamp>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& WebsocketClosedInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(WebsocketClosedInfo, uri_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(WebsocketClosedInfo, reason_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& WebsocketOpenedInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(WebsocketOpenedInfo, uri_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(WebsocketOpenedInfo, endpoint_is_server_client_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& SubscriberDisconnectedInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(SubscriberDisconnectedInfo, name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(SubscriberDisconnectedInfo, uri_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ThreadPoolSlowingDownWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ThreadPoolSlowingDownWarning, number_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ThreadPoolNotRespondingWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ThreadPoolNotRespondingWarning, not_responding_for_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_Duration>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& FailedToRemoveStalePointsWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(FailedToRemoveStalePointsWarning, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& IrregularBroadcastingPeriodWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(IrregularBroadcastingPeriodWarning, num_irregular_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 2, offsetof(IrregularBroadcastingPeriodWarning, duration_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_Duration>>::kOps},
+      {/*tag=*/ 3, offsetof(IrregularBroadcastingPeriodWarning, mean_deviation_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_Duration>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ClustererPointsOutOfRangeWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ClustererPointsOutOfRangeWarning, num_points_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 2, offsetof(ClustererPointsOutOfRangeWarning, sample_points_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& InternalError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(InternalError, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& InternalFatal::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(InternalFatal, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ServiceStartingInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ServiceStartingInfo, service_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ConfigNodeNotFoundFatal::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ConfigNodeNotFoundFatal, node_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ServiceSetupError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ServiceSetupError, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& FilesystemError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(FilesystemError, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& InvalidPresetWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(InvalidPresetWarning, preset_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(InvalidPresetWarning, fallback_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(InvalidPresetWarning, reason_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& WebsocketFailedClearPendingError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(WebsocketFailedClearPendingError, exception_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& WebsocketFailedToStopError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(WebsocketFailedToStopError, exception_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& WebsocketFailedToCreateError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(WebsocketFailedToCreateError, host_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(WebsocketFailedToCreateError, port_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/ 3, offsetof(WebsocketFailedToCreateError, exception_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& UnexpectedRpcError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(UnexpectedRpcError, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LicensePollFailed::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LicensePollFailed, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LicenseExpiredWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LicenseExpiredWarning, expiration_time_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_Timestamp>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LicenseUsageExceededWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LicenseUsageExceededWarning, lidar_count_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 2, offsetof(LicenseUsageExceededWarning, max_lidar_count_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::int64_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& StaticThreadPoolSlowTaskWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(StaticThreadPoolSlowTaskWarning, time_elapsed_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_Duration>>::kOps},
+      {/*tag=*/ 2, offsetof(StaticThreadPoolSlowTaskWarning, enqueue_location_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_SourceLocation>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& RpcUnsupportedServiceWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(RpcUnsupportedServiceWarning, service_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& WebsocketHandlerProblem::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(WebsocketHandlerProblem, what_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& WebsocketDeserializeError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(WebsocketDeserializeError, what_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& WebsocketExpiredRpcEndpointWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(WebsocketExpiredRpcEndpointWarning, uri_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& WebsocketQueueOverloadedWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(WebsocketQueueOverloadedWarning, current_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 2, offsetof(WebsocketQueueOverloadedWarning, max_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& RpcFailedToNotifyWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(RpcFailedToNotifyWarning, service_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(RpcFailedToNotifyWarning, uri_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(RpcFailedToNotifyWarning, notification_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 4, offsetof(RpcFailedToNotifyWarning, what_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ConfigSubscriptionFailedWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ConfigSubscriptionFailedWarning, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ThreadPoolClampedWorkersWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ThreadPoolClampedWorkersWarning, clamped_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 2, offsetof(ThreadPoolClampedWorkersWarning, requested_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ClampingDataWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ClampingDataWarning, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LidarIncompatibleValues::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LidarIncompatibleValues, lidar_ip1_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(LidarIncompatibleValues, lidar_ip2_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(LidarIncompatibleValues, value1_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 4, offsetof(LidarIncompatibleValues, value2_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 5, offsetof(LidarIncompatibleValues, value_names_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 6, offsetof(LidarIncompatibleValues, resolution_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& CannotDetermineContainerIdError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(CannotDetermineContainerIdError, container_id_file_path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& StartedLidarDriver::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(StartedLidarDriver, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(StartedLidarDriver, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& CannotStartLidarDriver::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(CannotStartLidarDriver, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(CannotStartLidarDriver, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(CannotStartLidarDriver, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& StoppedLidarDriver::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(StoppedLidarDriver, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(StoppedLidarDriver, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& CannotStopLidarDriver::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(CannotStopLidarDriver, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(CannotStopLidarDriver, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(CannotStopLidarDriver, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& RestartedLidarDriver::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(RestartedLidarDriver, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(RestartedLidarDriver, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& CannotRestartLidarDriver::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(CannotRestartLidarDriver, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(CannotRestartLidarDriver, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(CannotRestartLidarDriver, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& RemovedUnusedLidarDriver::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(RemovedUnusedLidarDriver, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(RemovedUnusedLidarDriver, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& CannotRemoveUnusedLidarDriver::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(CannotRemoveUnusedLidarDriver, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(CannotRemoveUnusedLidarDriver, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(CannotRemoveUnusedLidarDriver, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LidarDriverGcFailure::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LidarDriverGcFailure, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& IdSpaceExhausted::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(IdSpaceExhausted, prefix_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& PreprocessingToPointAggregatorPointsSkipped::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(PreprocessingToPointAggregatorPointsSkipped, num_skipped_points_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 2, offsetof(PreprocessingToPointAggregatorPointsSkipped, check_interval_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_Duration>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& MinMsgIntervalLessThanThreshold::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(MinMsgIntervalLessThanThreshold, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(MinMsgIntervalLessThanThreshold, threshold_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_Duration>>::kOps},
+      {/*tag=*/ 3, offsetof(MinMsgIntervalLessThanThreshold, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& FailedToCleanupRosWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(FailedToCleanupRosWarning, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& RpcDisconnectedWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(RpcDisconnectedWarning, request_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(RpcDisconnectedWarning, endpoint_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& RpcUnhandledError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(RpcUnhandledError, request_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(RpcUnhandledError, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& TimeDiffOutOfRangeWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(TimeDiffOutOfRangeWarning, prev_time_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_Timestamp>>::kOps},
+      {/*tag=*/ 2, offsetof(TimeDiffOutOfRangeWarning, curr_time_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_Timestamp>>::kOps},
+      {/*tag=*/ 3, offsetof(TimeDiffOutOfRangeWarning, diff_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_Duration>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& TensorrtLog::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(TensorrtLog, log_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& CalibrationMapNotFound::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(CalibrationMapNotFound, path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& CalibrationMapNotValid::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(CalibrationMapNotValid, path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& CalibrationMapPathAlreadyExists::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(CalibrationMapPathAlreadyExists, path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& FailedToSaveCalibrationMap::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(FailedToSaveCalibrationMap, path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& FailedToRemoveCalibrationMap::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(FailedToRemoveCalibrationMap, path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& FailedToIterateInDirectory::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(FailedToIterateInDirectory, directory_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(FailedToIterateInDirectory, directory_path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(FailedToIterateInDirectory, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& BagStreamNotFound::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(BagStreamNotFound, bag_path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(BagStreamNotFound, stream_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& EvaluationBagStartedInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(EvaluationBagStartedInfo, bag_path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& EvaluationBagFinishedInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(EvaluationBagFinishedInfo, bag_path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& BagNotFound::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(BagNotFound, bag_path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& BuildingPipelineInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(BuildingPipelineInfo, pipeline_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& BagIsNotEvaluation::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(BagIsNotEvaluation, bag_path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& AutoGroundCalibrationWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 2, offsetof(AutoGroundCalibrationWarning, failed_lidar_ids_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ModelInitInProgressInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ModelInitInProgressInfo, component_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& RpcTimeoutWithResolutionWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(RpcTimeoutWithResolutionWarning, request_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(RpcTimeoutWithResolutionWarning, endpoint_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(RpcTimeoutWithResolutionWarning, elapsed_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_Duration>>::kOps},
+      {/*tag=*/ 4, offsetof(RpcTimeoutWithResolutionWarning, resolution_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& CalibrationWasCancelledInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(CalibrationWasCancelledInfo, calibration_process_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& CalibrationMapRecordingFailedToStart::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(CalibrationMapRecordingFailedToStart, path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& DetectionPipelineRequestedResetInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(DetectionPipelineRequestedResetInfo, reason_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& PreprocessingServicePipelineUnavailable::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(PreprocessingServicePipelineUnavailable, reason_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& CircularRecordingDisabledWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(CircularRecordingDisabledWarning, reason_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& InvalidLidarTimestamp::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(InvalidLidarTimestamp, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(InvalidLidarTimestamp, timestamp_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_Timestamp>>::kOps},
+      {/*tag=*/ 3, offsetof(InvalidLidarTimestamp, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& CalibrationAccumulatingPointsInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(CalibrationAccumulatingPointsInfo, time_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_Duration>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& FileWriteWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(FileWriteWarning, filename_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(FileWriteWarning, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LicenseForbiddenFeature::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LicenseForbiddenFeature, feature_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& FailedToUpdateConfiguration::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(FailedToUpdateConfiguration, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ProjectFileInvalidPermissionsError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ProjectFileInvalidPermissionsError, filename_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& PipelineSchedulerError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(PipelineSchedulerError, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& MultiLidarCalibrationWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(MultiLidarCalibrationWarning, failed_lidar_ids_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& OldBagWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(OldBagWarning, bag_path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(OldBagWarning, version_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& UpgradingBagInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(UpgradingBagInfo, bag_path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& BagCalibrationSaveFailed::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(BagCalibrationSaveFailed, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& BagUpgradeFailed::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(BagUpgradeFailed, bag_path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(BagUpgradeFailed, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& UnknownLidarError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(UnknownLidarError, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(UnknownLidarError, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& InvalidPointCloudWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(InvalidPointCloudWarning, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(InvalidPointCloudWarning, reason_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(InvalidPointCloudWarning, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LidarIsDroppingPackets::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LidarIsDroppingPackets, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(LidarIsDroppingPackets, num_total_dropped_packets_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 3, offsetof(LidarIsDroppingPackets, num_total_expected_packets_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 4, offsetof(LidarIsDroppingPackets, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& RemovedInvalidLidarsFromConfigWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(RemovedInvalidLidarsFromConfigWarning, backup_path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& CalibrationMapRecordingFailed::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(CalibrationMapRecordingFailed, message_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& DetectionNodeNotFoundError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(DetectionNodeNotFoundError, node_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& CreatedVersionBackupInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(CreatedVersionBackupInfo, old_horus_version_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(CreatedVersionBackupInfo, new_horus_version_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(CreatedVersionBackupInfo, backup_path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& PlyFileLoadFailedError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(PlyFileLoadFailedError, file_path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(PlyFileLoadFailedError, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& HesaiDriverLifecycle::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(HesaiDriverLifecycle, action_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(HesaiDriverLifecycle, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(HesaiDriverLifecycle, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 4, offsetof(HesaiDriverLifecycle, lidar_type_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& HesaiDriverError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(HesaiDriverError, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(HesaiDriverError, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(HesaiDriverError, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 4, offsetof(HesaiDriverError, lidar_type_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& HesaiPacketProcessingFailed::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(HesaiPacketProcessingFailed, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(HesaiPacketProcessingFailed, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(HesaiPacketProcessingFailed, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& HesaiCorrectionFileError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(HesaiCorrectionFileError, file_type_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(HesaiCorrectionFileError, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(HesaiCorrectionFileError, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 4, offsetof(HesaiCorrectionFileError, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 5, offsetof(HesaiCorrectionFileError, lidar_type_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& HesaiPacketStatistics::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(HesaiPacketStatistics, packets_received_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 2, offsetof(HesaiPacketStatistics, packets_published_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 3, offsetof(HesaiPacketStatistics, packets_dropped_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 4, offsetof(HesaiPacketStatistics, packets_decode_failed_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 5, offsetof(HesaiPacketStatistics, success_rate_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<double, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 6, offsetof(HesaiPacketStatistics, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 7, offsetof(HesaiPacketStatistics, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& PlyFileWriteFailedError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(PlyFileWriteFailedError, file_path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(PlyFileWriteFailedError, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ProjectSaveError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ProjectSaveError, error_message_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& SaveStaticEnvironmentFailed::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(SaveStaticEnvironmentFailed, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LoadStaticEnvironmentFailed::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LoadStaticEnvironmentFailed, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& AttemptToInjectInvalidLidarIdWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(AttemptToInjectInvalidLidarIdWarning, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ResetBundledPacketDueToUnexpectedPacket::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ResetBundledPacketDueToUnexpectedPacket, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(ResetBundledPacketDueToUnexpectedPacket, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& PacketBundlerDroppedPacketsWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(PacketBundlerDroppedPacketsWarning, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(PacketBundlerDroppedPacketsWarning, num_dropped_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 3, offsetof(PacketBundlerDroppedPacketsWarning, duration_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<horus::pb::LogMetadata_Duration>>::kOps},
+      {/*tag=*/ 4, offsetof(PacketBundlerDroppedPacketsWarning, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& PacketBundlerFrameJumpWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(PacketBundlerFrameJumpWarning, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(PacketBundlerFrameJumpWarning, frame_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 3, offsetof(PacketBundlerFrameJumpWarning, next_frame_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 4, offsetof(PacketBundlerFrameJumpWarning, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LidarCorrectionLoadingSuccess::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LidarCorrectionLoadingSuccess, correction_type_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(LidarCorrectionLoadingSuccess, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(LidarCorrectionLoadingSuccess, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LidarCorrectionLoadingFailure::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LidarCorrectionLoadingFailure, correction_type_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(LidarCorrectionLoadingFailure, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(LidarCorrectionLoadingFailure, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 4, offsetof(LidarCorrectionLoadingFailure, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& HesaiPacketStatisticsLidar::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(HesaiPacketStatisticsLidar, packets_received_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 2, offsetof(HesaiPacketStatisticsLidar, packets_published_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 3, offsetof(HesaiPacketStatisticsLidar, packets_dropped_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 4, offsetof(HesaiPacketStatisticsLidar, packets_decode_failed_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 5, offsetof(HesaiPacketStatisticsLidar, success_rate_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<double, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 6, offsetof(HesaiPacketStatisticsLidar, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LidarTiltDetectionAlignedToCalibrationMapInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LidarTiltDetectionAlignedToCalibrationMapInfo, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(LidarTiltDetectionAlignedToCalibrationMapInfo, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LidarTiltDetectionMisalignedToCalibrationMapWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LidarTiltDetectionMisalignedToCalibrationMapWarning, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(LidarTiltDetectionMisalignedToCalibrationMapWarning, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(LidarTiltDetectionMisalignedToCalibrationMapWarning, angle_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<double, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 4, offsetof(LidarTiltDetectionMisalignedToCalibrationMapWarning, distance_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<double, PbDeserFlags::kFixed>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& RecoveredCarIdsInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(RecoveredCarIdsInfo, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& FailedToRecoverCarIds::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(FailedToRecoverCarIds, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& FailedToEmplaceRecoveredCarId::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(FailedToEmplaceRecoveredCarId, object_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& PersistentStorageError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(PersistentStorageError, operation_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(PersistentStorageError, filepath_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& TrackCapacityExceededWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(TrackCapacityExceededWarning, attempted_count_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 2, offsetof(TrackCapacityExceededWarning, max_tracks_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& TrackerStatePathUnavailableWarning::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(TrackerStatePathUnavailableWarning, project_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& TrackerStateRecoveryError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(TrackerStateRecoveryError, error_message_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& TrackerStateSaveError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(TrackerStateSaveError, error_message_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& TrackerIdRecoveryFailedError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(TrackerIdRecoveryFailedError, id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 2, offsetof(TrackerIdRecoveryFailedError, error_message_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& TrackerIdFastForwardFailedError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(TrackerIdFastForwardFailedError, target_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 2, offsetof(TrackerIdFastForwardFailedError, error_message_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& CircularRecordingSnapshotCreated::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(CircularRecordingSnapshotCreated, message_count_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 2, offsetof(CircularRecordingSnapshotCreated, actual_duration_seconds_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<double, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 3, offsetof(CircularRecordingSnapshotCreated, max_buffer_duration_seconds_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<double, PbDeserFlags::kFixed>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& CircularRecordingFileOperationError::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(CircularRecordingFileOperationError, operation_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(CircularRecordingFileOperationError, file_path_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(CircularRecordingFileOperationError, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ObjectIdRecoveryRejectedInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ObjectIdRecoveryRejectedInfo, id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 2, offsetof(ObjectIdRecoveryRejectedInfo, reason_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ExpiredRecoveryIdsInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ExpiredRecoveryIdsInfo, expired_ids_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& HesaiUdpReceiverInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(HesaiUdpReceiverInfo, action_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(HesaiUdpReceiverInfo, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(HesaiUdpReceiverInfo, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& DbCommitFailed::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(DbCommitFailed, action_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(DbCommitFailed, error_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& DetectionServiceRpcQueueFull::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(DetectionServiceRpcQueueFull, num_packets_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 2, offsetof(DetectionServiceRpcQueueFull, queue_size_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 3, offsetof(DetectionServiceRpcQueueFull, node_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ProjectMigrationFailed::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ProjectMigrationFailed, details_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
 }  // namespace logs
 }  // namespace pb
 }  // namespace sdk
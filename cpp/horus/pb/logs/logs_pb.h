@@ -8,6 +8,7 @@
 /// Generated by `/opt/actions-runner/_work/horus/horus/common/tools/sdk/pb.ts`.
 
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -17,8 +18,10 @@
 #include "horus/pb/cow_repeated.h"
 #include "horus/pb/logs/common_pb.h"
 #include "horus/pb/logs/metadata_pb.h"
+#include "horus/pb/lazy.h"
 #include "horus/pb/message.h"
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 #include "horus/strings/string_view.h"
 
 #if HORUS_SDK_USE_PB_NAMESPACE_ALIAS
@@ -303,6 +306,11 @@ class Generic final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -311,12 +319,23 @@ class Generic final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.Generic`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.Generic"; }
 
   /// The full name of the message: `horus.pb.logs.Generic`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `Generic`, e.g. to build a `PbFieldMask<Generic>`.
+  enum class Field : PbTag {
+    /// Field `message`.
+    kMessage = 1,
+    /// Field `location`.
+    kLocation = 2,
+  };
+
   // Field `message` (no 1).
   // -----
 
@@ -373,8 +392,12 @@ class Generic final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 2.
-  constexpr const horus::pb::LogMetadata_SourceLocation& location() const& noexcept HORUS_LIFETIME_BOUND {
-    return location_;
+  ///
+  /// If `location` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `location` was received and is not a valid message.
+  const horus::pb::LogMetadata_SourceLocation& location() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return location_.Ref();
   }
 
   /// If `location` is set, moves it out of the message (without marking it as unset).
@@ -382,19 +405,23 @@ class Generic final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  horus::pb::LogMetadata_SourceLocation location() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `location` was received and is not a valid message.
+  horus::pb::LogMetadata_SourceLocation location() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(location_);
+    return std::move(location_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 2.
-  horus::pb::LogMetadata_SourceLocation& mutable_location() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `location` was received and is not a valid message.
+  horus::pb::LogMetadata_SourceLocation& mutable_location() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return location_;
+    return location_.Mutable();
   }
 
   /// Returns whether `location` (no 2) is set.
@@ -403,13 +430,13 @@ class Generic final : public PbMessage {
   /// Clears `location` (no 2).
   void clear_location() & noexcept {
     set_fields_[1] = false;
-    location_ = {};
+    location_.Clear();
   }
 
   /// Sets `location` (no 2) and returns `*this`.
   Generic& set_location(horus::pb::LogMetadata_SourceLocation&& location) & noexcept {
     set_fields_[1] = true;
-    location_ = std::move(location);
+    location_.Set(std::move(location));
     return *this;
   }
   /// Sets `location` (no 2) and returns `*this`.
@@ -417,11 +444,15 @@ class Generic final : public PbMessage {
     return std::move(set_location(std::move(location)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see message()
   CowBytes message_{};
   /// @see location()
-  horus::pb::LogMetadata_SourceLocation location_{};
+  PbLazy<horus::pb::LogMetadata_SourceLocation> location_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<2> set_fields_;
@@ -469,6 +500,9 @@ class Oom final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -479,6 +513,9 @@ class Oom final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.Oom`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.Oom"; }
 
@@ -531,6 +568,11 @@ class RpcConnectionError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -539,12 +581,25 @@ class RpcConnectionError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.RpcConnectionError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.RpcConnectionError"; }
 
   /// The full name of the message: `horus.pb.logs.RpcConnectionError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `RpcConnectionError`, e.g. to build a `PbFieldMask<RpcConnectionError>`.
+  enum class Field : PbTag {
+    /// Field `target_service`.
+    kTargetService = 1,
+    /// Field `target_uri`.
+    kTargetUri = 2,
+    /// Field `details`.
+    kDetails = 3,
+  };
+
   // Field `target_service` (no 1).
   // -----
 
@@ -695,6 +750,10 @@ class RpcConnectionError final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see target_service()
   CowBytes target_service_{};
@@ -747,6 +806,11 @@ class InvalidProjectName final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -755,12 +819,23 @@ class InvalidProjectName final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.InvalidProjectName`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.InvalidProjectName"; }
 
   /// The full name of the message: `horus.pb.logs.InvalidProjectName`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `InvalidProjectName`, e.g. to build a `PbFieldMask<InvalidProjectName>`.
+  enum class Field : PbTag {
+    /// Field `name`.
+    kName = 1,
+    /// Field `details`.
+    kDetails = 2,
+  };
+
   // Field `name` (no 1).
   // -----
 
@@ -861,6 +936,10 @@ class InvalidProjectName final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see name()
   CowBytes name_{};
@@ -911,6 +990,11 @@ class ProjectNotFound final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -919,12 +1003,21 @@ class ProjectNotFound final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ProjectNotFound`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ProjectNotFound"; }
 
   /// The full name of the message: `horus.pb.logs.ProjectNotFound`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ProjectNotFound`, e.g. to build a `PbFieldMask<ProjectNotFound>`.
+  enum class Field : PbTag {
+    /// Field `name`.
+    kName = 1,
+  };
+
   // Field `name` (no 1).
   // -----
 
@@ -975,6 +1068,10 @@ class ProjectNotFound final : public PbMessage {
     return std::move(set_name(std::move(name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see name()
   CowBytes name_{};
@@ -1023,6 +1120,11 @@ class ProjectAlreadyExists final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1031,12 +1133,21 @@ class ProjectAlreadyExists final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ProjectAlreadyExists`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ProjectAlreadyExists"; }
 
   /// The full name of the message: `horus.pb.logs.ProjectAlreadyExists`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ProjectAlreadyExists`, e.g. to build a `PbFieldMask<ProjectAlreadyExists>`.
+  enum class Field : PbTag {
+    /// Field `name`.
+    kName = 1,
+  };
+
   // Field `name` (no 1).
   // -----
 
@@ -1087,6 +1198,10 @@ class ProjectAlreadyExists final : public PbMessage {
     return std::move(set_name(std::move(name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see name()
   CowBytes name_{};
@@ -1135,6 +1250,11 @@ class InvalidConfiguration final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1143,12 +1263,21 @@ class InvalidConfiguration final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.InvalidConfiguration`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.InvalidConfiguration"; }
 
   /// The full name of the message: `horus.pb.logs.InvalidConfiguration`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `InvalidConfiguration`, e.g. to build a `PbFieldMask<InvalidConfiguration>`.
+  enum class Field : PbTag {
+    /// Field `validation_errors`.
+    kValidationErrors = 1,
+  };
+
   // Field `validation_errors` (no 1).
   // -----
 
@@ -1199,6 +1328,10 @@ class InvalidConfiguration final : public PbMessage {
     return std::move(set_validation_errors(std::move(validation_errors)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see validation_errors()
   CowRepeated<ValidationError> validation_errors_{};
@@ -1247,6 +1380,11 @@ class EntityNotFound final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1255,12 +1393,23 @@ class EntityNotFound final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.EntityNotFound`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.EntityNotFound"; }
 
   /// The full name of the message: `horus.pb.logs.EntityNotFound`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `EntityNotFound`, e.g. to build a `PbFieldMask<EntityNotFound>`.
+  enum class Field : PbTag {
+    /// Field `id`.
+    kId = 1,
+    /// Field `entity_type`.
+    kEntityType = 2,
+  };
+
   // Field `id` (no 1).
   // -----
 
@@ -1361,6 +1510,10 @@ class EntityNotFound final : public PbMessage {
     return std::move(set_entity_type(std::move(entity_type)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see id()
   CowBytes id_{};
@@ -1413,6 +1566,9 @@ class ActiveProjectCannotBeDeleted final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1423,6 +1579,9 @@ class ActiveProjectCannotBeDeleted final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.ActiveProjectCannotBeDeleted`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ActiveProjectCannotBeDeleted"; }
 
@@ -1475,6 +1634,11 @@ class RpcDisconnectionError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1483,12 +1647,25 @@ class RpcDisconnectionError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.RpcDisconnectionError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.RpcDisconnectionError"; }
 
   /// The full name of the message: `horus.pb.logs.RpcDisconnectionError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `RpcDisconnectionError`, e.g. to build a `PbFieldMask<RpcDisconnectionError>`.
+  enum class Field : PbTag {
+    /// Field `target_service`.
+    kTargetService = 1,
+    /// Field `target_uri`.
+    kTargetUri = 2,
+    /// Field `details`.
+    kDetails = 3,
+  };
+
   // Field `target_service` (no 1).
   // -----
 
@@ -1639,6 +1816,10 @@ class RpcDisconnectionError final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see target_service()
   CowBytes target_service_{};
@@ -1691,6 +1872,11 @@ class DroppedLogs final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1699,12 +1885,21 @@ class DroppedLogs final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.DroppedLogs`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.DroppedLogs"; }
 
   /// The full name of the message: `horus.pb.logs.DroppedLogs`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `DroppedLogs`, e.g. to build a `PbFieldMask<DroppedLogs>`.
+  enum class Field : PbTag {
+    /// Field `n`.
+    kN = 1,
+  };
+
   // Field `n` (no 1).
   // -----
 
@@ -1743,6 +1938,10 @@ class DroppedLogs final : public PbMessage {
     return std::move(set_n(n));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see n()
   std::uint64_t n_{};
@@ -1791,6 +1990,11 @@ class OpenedProject final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1799,12 +2003,21 @@ class OpenedProject final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.OpenedProject`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.OpenedProject"; }
 
   /// The full name of the message: `horus.pb.logs.OpenedProject`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `OpenedProject`, e.g. to build a `PbFieldMask<OpenedProject>`.
+  enum class Field : PbTag {
+    /// Field `project_name`.
+    kProjectName = 1,
+  };
+
   // Field `project_name` (no 1).
   // -----
 
@@ -1855,6 +2068,10 @@ class OpenedProject final : public PbMessage {
     return std::move(set_project_name(std::move(project_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see project_name()
   CowBytes project_name_{};
@@ -1903,6 +2120,11 @@ class CreatedProject final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1911,12 +2133,23 @@ class CreatedProject final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.CreatedProject`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.CreatedProject"; }
 
   /// The full name of the message: `horus.pb.logs.CreatedProject`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `CreatedProject`, e.g. to build a `PbFieldMask<CreatedProject>`.
+  enum class Field : PbTag {
+    /// Field `project_name`.
+    kProjectName = 1,
+    /// Field `source_name`.
+    kSourceName = 2,
+  };
+
   // Field `project_name` (no 1).
   // -----
 
@@ -2017,6 +2250,10 @@ class CreatedProject final : public PbMessage {
     return std::move(set_source_name(std::move(source_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see project_name()
   CowBytes project_name_{};
@@ -2069,6 +2306,9 @@ class ConfigUnavailable final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -2079,6 +2319,9 @@ class ConfigUnavailable final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.ConfigUnavailable`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ConfigUnavailable"; }
 
@@ -2131,6 +2374,11 @@ class InvalidRequest final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -2139,12 +2387,21 @@ class InvalidRequest final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.InvalidRequest`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.InvalidRequest"; }
 
   /// The full name of the message: `horus.pb.logs.InvalidRequest`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `InvalidRequest`, e.g. to build a `PbFieldMask<InvalidRequest>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -2195,6 +2452,10 @@ class InvalidRequest final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -2243,6 +2504,11 @@ class SanityCheckError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -2251,12 +2517,23 @@ class SanityCheckError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.SanityCheckError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.SanityCheckError"; }
 
   /// The full name of the message: `horus.pb.logs.SanityCheckError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `SanityCheckError`, e.g. to build a `PbFieldMask<SanityCheckError>`.
+  enum class Field : PbTag {
+    /// Field `sanity_check_name`.
+    kSanityCheckName = 1,
+    /// Field `details`.
+    kDetails = 2,
+  };
+
   // Field `sanity_check_name` (no 1).
   // -----
 
@@ -2357,6 +2634,10 @@ class SanityCheckError final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see sanity_check_name()
   CowBytes sanity_check_name_{};
@@ -2407,6 +2688,11 @@ class BagFailedToOpen final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -2415,12 +2701,23 @@ class BagFailedToOpen final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.BagFailedToOpen`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.BagFailedToOpen"; }
 
   /// The full name of the message: `horus.pb.logs.BagFailedToOpen`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `BagFailedToOpen`, e.g. to build a `PbFieldMask<BagFailedToOpen>`.
+  enum class Field : PbTag {
+    /// Field `horus_bag_path`.
+    kHorusBagPath = 1,
+    /// Field `details`.
+    kDetails = 2,
+  };
+
   // Field `horus_bag_path` (no 1).
   // -----
 
@@ -2521,6 +2818,10 @@ class BagFailedToOpen final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see horus_bag_path()
   CowBytes horus_bag_path_{};
@@ -2571,6 +2872,11 @@ class BagFailedToClose final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -2579,12 +2885,21 @@ class BagFailedToClose final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.BagFailedToClose`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.BagFailedToClose"; }
 
   /// The full name of the message: `horus.pb.logs.BagFailedToClose`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `BagFailedToClose`, e.g. to build a `PbFieldMask<BagFailedToClose>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -2635,6 +2950,10 @@ class BagFailedToClose final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -2683,6 +3002,11 @@ class BagConversionFailed final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -2691,12 +3015,21 @@ class BagConversionFailed final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.BagConversionFailed`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.BagConversionFailed"; }
 
   /// The full name of the message: `horus.pb.logs.BagConversionFailed`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `BagConversionFailed`, e.g. to build a `PbFieldMask<BagConversionFailed>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -2747,6 +3080,10 @@ class BagConversionFailed final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -2795,6 +3132,11 @@ class BagFailedToWrite final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -2803,12 +3145,23 @@ class BagFailedToWrite final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.BagFailedToWrite`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.BagFailedToWrite"; }
 
   /// The full name of the message: `horus.pb.logs.BagFailedToWrite`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `BagFailedToWrite`, e.g. to build a `PbFieldMask<BagFailedToWrite>`.
+  enum class Field : PbTag {
+    /// Field `name`.
+    kName = 1,
+    /// Field `details`.
+    kDetails = 2,
+  };
+
   // Field `name` (no 1).
   // -----
 
@@ -2909,6 +3262,10 @@ class BagFailedToWrite final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see name()
   CowBytes name_{};
@@ -2959,6 +3316,11 @@ class CalibrationError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -2967,12 +3329,21 @@ class CalibrationError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.CalibrationError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.CalibrationError"; }
 
   /// The full name of the message: `horus.pb.logs.CalibrationError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `CalibrationError`, e.g. to build a `PbFieldMask<CalibrationError>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -3023,6 +3394,10 @@ class CalibrationError final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -3071,6 +3446,11 @@ class ProjectManagerFailedToStartRecording final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -3079,12 +3459,21 @@ class ProjectManagerFailedToStartRecording final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ProjectManagerFailedToStartRecording`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ProjectManagerFailedToStartRecording"; }
 
   /// The full name of the message: `horus.pb.logs.ProjectManagerFailedToStartRecording`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ProjectManagerFailedToStartRecording`, e.g. to build a `PbFieldMask<ProjectManagerFailedToStartRecording>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -3135,6 +3524,10 @@ class ProjectManagerFailedToStartRecording final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -3183,6 +3576,11 @@ class ProjectManagerFailedToStopRecording final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -3191,12 +3589,21 @@ class ProjectManagerFailedToStopRecording final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ProjectManagerFailedToStopRecording`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ProjectManagerFailedToStopRecording"; }
 
   /// The full name of the message: `horus.pb.logs.ProjectManagerFailedToStopRecording`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ProjectManagerFailedToStopRecording`, e.g. to build a `PbFieldMask<ProjectManagerFailedToStopRecording>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -3247,6 +3654,10 @@ class ProjectManagerFailedToStopRecording final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -3295,6 +3706,11 @@ class ServiceConnectionTimedOut final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -3303,12 +3719,23 @@ class ServiceConnectionTimedOut final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ServiceConnectionTimedOut`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ServiceConnectionTimedOut"; }
 
   /// The full name of the message: `horus.pb.logs.ServiceConnectionTimedOut`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ServiceConnectionTimedOut`, e.g. to build a `PbFieldMask<ServiceConnectionTimedOut>`.
+  enum class Field : PbTag {
+    /// Field `node_type`.
+    kNodeType = 1,
+    /// Field `node_id`.
+    kNodeId = 2,
+  };
+
   // Field `node_type` (no 1).
   // -----
 
@@ -3409,6 +3836,10 @@ class ServiceConnectionTimedOut final : public PbMessage {
     return std::move(set_node_id(std::move(node_id)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see node_type()
   CowBytes node_type_{};
@@ -3459,6 +3890,11 @@ class BagRecorderAlreadyRunning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -3467,12 +3903,21 @@ class BagRecorderAlreadyRunning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.BagRecorderAlreadyRunning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.BagRecorderAlreadyRunning"; }
 
   /// The full name of the message: `horus.pb.logs.BagRecorderAlreadyRunning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `BagRecorderAlreadyRunning`, e.g. to build a `PbFieldMask<BagRecorderAlreadyRunning>`.
+  enum class Field : PbTag {
+    /// Field `path`.
+    kPath = 1,
+  };
+
   // Field `path` (no 1).
   // -----
 
@@ -3523,6 +3968,10 @@ class BagRecorderAlreadyRunning final : public PbMessage {
     return std::move(set_path(std::move(path)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see path()
   CowBytes path_{};
@@ -3571,6 +4020,11 @@ class LicenseServerConnectionError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -3579,12 +4033,21 @@ class LicenseServerConnectionError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LicenseServerConnectionError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LicenseServerConnectionError"; }
 
   /// The full name of the message: `horus.pb.logs.LicenseServerConnectionError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LicenseServerConnectionError`, e.g. to build a `PbFieldMask<LicenseServerConnectionError>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -3635,6 +4098,10 @@ class LicenseServerConnectionError final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -3683,6 +4150,11 @@ class LicenseError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -3691,12 +4163,21 @@ class LicenseError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LicenseError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LicenseError"; }
 
   /// The full name of the message: `horus.pb.logs.LicenseError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LicenseError`, e.g. to build a `PbFieldMask<LicenseError>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -3747,6 +4228,10 @@ class LicenseError final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -3797,6 +4282,9 @@ class LicenseNotFoundError final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -3807,6 +4295,9 @@ class LicenseNotFoundError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.LicenseNotFoundError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LicenseNotFoundError"; }
 
@@ -3859,6 +4350,11 @@ class LicenseExpiredError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -3867,20 +4363,33 @@ class LicenseExpiredError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LicenseExpiredError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LicenseExpiredError"; }
 
   /// The full name of the message: `horus.pb.logs.LicenseExpiredError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LicenseExpiredError`, e.g. to build a `PbFieldMask<LicenseExpiredError>`.
+  enum class Field : PbTag {
+    /// Field `expiration_time`.
+    kExpirationTime = 1,
+  };
+
   // Field `expiration_time` (no 1).
   // -----
 
   /// No documentation.
   ///
   /// Field no: 1.
-  constexpr const horus::pb::LogMetadata_Timestamp& expiration_time() const& noexcept HORUS_LIFETIME_BOUND {
-    return expiration_time_;
+  ///
+  /// If `expiration_time` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `expiration_time` was received and is not a valid message.
+  const horus::pb::LogMetadata_Timestamp& expiration_time() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return expiration_time_.Ref();
   }
 
   /// If `expiration_time` is set, moves it out of the message (without marking it as unset).
@@ -3888,19 +4397,23 @@ class LicenseExpiredError final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  horus::pb::LogMetadata_Timestamp expiration_time() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `expiration_time` was received and is not a valid message.
+  horus::pb::LogMetadata_Timestamp expiration_time() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(expiration_time_);
+    return std::move(expiration_time_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 1.
-  horus::pb::LogMetadata_Timestamp& mutable_expiration_time() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `expiration_time` was received and is not a valid message.
+  horus::pb::LogMetadata_Timestamp& mutable_expiration_time() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return expiration_time_;
+    return expiration_time_.Mutable();
   }
 
   /// Returns whether `expiration_time` (no 1) is set.
@@ -3909,13 +4422,13 @@ class LicenseExpiredError final : public PbMessage {
   /// Clears `expiration_time` (no 1).
   void clear_expiration_time() & noexcept {
     set_fields_[0] = false;
-    expiration_time_ = {};
+    expiration_time_.Clear();
   }
 
   /// Sets `expiration_time` (no 1) and returns `*this`.
   LicenseExpiredError& set_expiration_time(horus::pb::LogMetadata_Timestamp&& expiration_time) & noexcept {
     set_fields_[0] = true;
-    expiration_time_ = std::move(expiration_time);
+    expiration_time_.Set(std::move(expiration_time));
     return *this;
   }
   /// Sets `expiration_time` (no 1) and returns `*this`.
@@ -3923,9 +4436,13 @@ class LicenseExpiredError final : public PbMessage {
     return std::move(set_expiration_time(std::move(expiration_time)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see expiration_time()
-  horus::pb::LogMetadata_Timestamp expiration_time_{};
+  PbLazy<horus::pb::LogMetadata_Timestamp> expiration_time_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<1> set_fields_;
@@ -3971,6 +4488,11 @@ class LicenseExceededError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -3979,12 +4501,23 @@ class LicenseExceededError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LicenseExceededError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LicenseExceededError"; }
 
   /// The full name of the message: `horus.pb.logs.LicenseExceededError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LicenseExceededError`, e.g. to build a `PbFieldMask<LicenseExceededError>`.
+  enum class Field : PbTag {
+    /// Field `lidar_count`.
+    kLidarCount = 1,
+    /// Field `max_lidar_count`.
+    kMaxLidarCount = 2,
+  };
+
   // Field `lidar_count` (no 1).
   // -----
 
@@ -4061,6 +4594,10 @@ class LicenseExceededError final : public PbMessage {
     return std::move(set_max_lidar_count(max_lidar_count));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_count()
   std::uint32_t lidar_count_{};
@@ -4111,6 +4648,11 @@ class LicenseHostMachineError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -4119,12 +4661,21 @@ class LicenseHostMachineError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LicenseHostMachineError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LicenseHostMachineError"; }
 
   /// The full name of the message: `horus.pb.logs.LicenseHostMachineError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LicenseHostMachineError`, e.g. to build a `PbFieldMask<LicenseHostMachineError>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -4175,6 +4726,10 @@ class LicenseHostMachineError final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -4223,6 +4778,11 @@ class LicensePrivilegeError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -4231,12 +4791,23 @@ class LicensePrivilegeError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LicensePrivilegeError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LicensePrivilegeError"; }
 
   /// The full name of the message: `horus.pb.logs.LicensePrivilegeError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LicensePrivilegeError`, e.g. to build a `PbFieldMask<LicensePrivilegeError>`.
+  enum class Field : PbTag {
+    /// Field `missing_privilege`.
+    kMissingPrivilege = 1,
+    /// Field `level_error`.
+    kLevelError = 2,
+  };
+
   // Field `missing_privilege` (no 1).
   // -----
 
@@ -4337,6 +4908,10 @@ class LicensePrivilegeError final : public PbMessage {
     return std::move(set_level_error(std::move(level_error)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see missing_privilege()
   CowBytes missing_privilege_{};
@@ -4389,6 +4964,9 @@ class LicenseActiveInfo final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -4399,6 +4977,9 @@ class LicenseActiveInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.LicenseActiveInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LicenseActiveInfo"; }
 
@@ -4451,6 +5032,11 @@ class MultipleLicensesWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -4459,12 +5045,23 @@ class MultipleLicensesWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.MultipleLicensesWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.MultipleLicensesWarning"; }
 
   /// The full name of the message: `horus.pb.logs.MultipleLicensesWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `MultipleLicensesWarning`, e.g. to build a `PbFieldMask<MultipleLicensesWarning>`.
+  enum class Field : PbTag {
+    /// Field `non_expired_licenses_count`.
+    kNonExpiredLicensesCount = 1,
+    /// Field `active_license_filename`.
+    kActiveLicenseFilename = 2,
+  };
+
   // Field `non_expired_licenses_count` (no 1).
   // -----
 
@@ -4553,6 +5150,10 @@ class MultipleLicensesWarning final : public PbMessage {
     return std::move(set_active_license_filename(std::move(active_license_filename)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see non_expired_licenses_count()
   std::uint32_t non_expired_licenses_count_{};
@@ -4603,6 +5204,11 @@ class LicenseCurrentLicenseStatusInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -4611,20 +5217,35 @@ class LicenseCurrentLicenseStatusInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LicenseCurrentLicenseStatusInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LicenseCurrentLicenseStatusInfo"; }
 
   /// The full name of the message: `horus.pb.logs.LicenseCurrentLicenseStatusInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LicenseCurrentLicenseStatusInfo`, e.g. to build a `PbFieldMask<LicenseCurrentLicenseStatusInfo>`.
+  enum class Field : PbTag {
+    /// Field `expiration_time`.
+    kExpirationTime = 1,
+    /// Field `max_lidar_count`.
+    kMaxLidarCount = 2,
+  };
+
   // Field `expiration_time` (no 1).
   // -----
 
   /// No documentation.
   ///
   /// Field no: 1.
-  constexpr const horus::pb::LogMetadata_Timestamp& expiration_time() const& noexcept HORUS_LIFETIME_BOUND {
-    return expiration_time_;
+  ///
+  /// If `expiration_time` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `expiration_time` was received and is not a valid message.
+  const horus::pb::LogMetadata_Timestamp& expiration_time() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return expiration_time_.Ref();
   }
 
   /// If `expiration_time` is set, moves it out of the message (without marking it as unset).
@@ -4632,19 +5253,23 @@ class LicenseCurrentLicenseStatusInfo final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  horus::pb::LogMetadata_Timestamp expiration_time() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `expiration_time` was received and is not a valid message.
+  horus::pb::LogMetadata_Timestamp expiration_time() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(expiration_time_);
+    return std::move(expiration_time_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 1.
-  horus::pb::LogMetadata_Timestamp& mutable_expiration_time() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `expiration_time` was received and is not a valid message.
+  horus::pb::LogMetadata_Timestamp& mutable_expiration_time() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return expiration_time_;
+    return expiration_time_.Mutable();
   }
 
   /// Returns whether `expiration_time` (no 1) is set.
@@ -4653,13 +5278,13 @@ class LicenseCurrentLicenseStatusInfo final : public PbMessage {
   /// Clears `expiration_time` (no 1).
   void clear_expiration_time() & noexcept {
     set_fields_[0] = false;
-    expiration_time_ = {};
+    expiration_time_.Clear();
   }
 
   /// Sets `expiration_time` (no 1) and returns `*this`.
   LicenseCurrentLicenseStatusInfo& set_expiration_time(horus::pb::LogMetadata_Timestamp&& expiration_time) & noexcept {
     set_fields_[0] = true;
-    expiration_time_ = std::move(expiration_time);
+    expiration_time_.Set(std::move(expiration_time));
     return *this;
   }
   /// Sets `expiration_time` (no 1) and returns `*this`.
@@ -4705,9 +5330,13 @@ class LicenseCurrentLicenseStatusInfo final : public PbMessage {
     return std::move(set_max_lidar_count(max_lidar_count));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see expiration_time()
-  horus::pb::LogMetadata_Timestamp expiration_time_{};
+  PbLazy<horus::pb::LogMetadata_Timestamp> expiration_time_{};
   /// @see max_lidar_count()
   std::uint32_t max_lidar_count_{};
 
@@ -4755,6 +5384,11 @@ class BagRecordingStoppedInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -4763,12 +5397,23 @@ class BagRecordingStoppedInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.BagRecordingStoppedInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.BagRecordingStoppedInfo"; }
 
   /// The full name of the message: `horus.pb.logs.BagRecordingStoppedInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `BagRecordingStoppedInfo`, e.g. to build a `PbFieldMask<BagRecordingStoppedInfo>`.
+  enum class Field : PbTag {
+    /// Field `path`.
+    kPath = 1,
+    /// Field `details`.
+    kDetails = 2,
+  };
+
   // Field `path` (no 1).
   // -----
 
@@ -4869,6 +5514,10 @@ class BagRecordingStoppedInfo final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see path()
   CowBytes path_{};
@@ -4919,6 +5568,11 @@ class BagRecordingFailedToStart final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -4927,12 +5581,21 @@ class BagRecordingFailedToStart final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.BagRecordingFailedToStart`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.BagRecordingFailedToStart"; }
 
   /// The full name of the message: `horus.pb.logs.BagRecordingFailedToStart`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `BagRecordingFailedToStart`, e.g. to build a `PbFieldMask<BagRecordingFailedToStart>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -4983,6 +5646,10 @@ class BagRecordingFailedToStart final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -5031,6 +5698,11 @@ class BagRecordingStartedInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -5039,12 +5711,21 @@ class BagRecordingStartedInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.BagRecordingStartedInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.BagRecordingStartedInfo"; }
 
   /// The full name of the message: `horus.pb.logs.BagRecordingStartedInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `BagRecordingStartedInfo`, e.g. to build a `PbFieldMask<BagRecordingStartedInfo>`.
+  enum class Field : PbTag {
+    /// Field `path`.
+    kPath = 1,
+  };
+
   // Field `path` (no 1).
   // -----
 
@@ -5095,6 +5776,10 @@ class BagRecordingStartedInfo final : public PbMessage {
     return std::move(set_path(std::move(path)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see path()
   CowBytes path_{};
@@ -5145,6 +5830,9 @@ class ReplayRestartedInfo final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -5155,6 +5843,9 @@ class ReplayRestartedInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.ReplayRestartedInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ReplayRestartedInfo"; }
 
@@ -5207,6 +5898,11 @@ class InputSourceChangeRequestedInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -5215,12 +5911,21 @@ class InputSourceChangeRequestedInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.InputSourceChangeRequestedInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.InputSourceChangeRequestedInfo"; }
 
   /// The full name of the message: `horus.pb.logs.InputSourceChangeRequestedInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `InputSourceChangeRequestedInfo`, e.g. to build a `PbFieldMask<InputSourceChangeRequestedInfo>`.
+  enum class Field : PbTag {
+    /// Field `source`.
+    kSource = 1,
+  };
+
   // Field `source` (no 1).
   // -----
 
@@ -5271,6 +5976,10 @@ class InputSourceChangeRequestedInfo final : public PbMessage {
     return std::move(set_source(std::move(source)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see source()
   CowBytes source_{};
@@ -5319,6 +6028,11 @@ class InputSourceSwitchedInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -5327,12 +6041,21 @@ class InputSourceSwitchedInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.InputSourceSwitchedInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.InputSourceSwitchedInfo"; }
 
   /// The full name of the message: `horus.pb.logs.InputSourceSwitchedInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `InputSourceSwitchedInfo`, e.g. to build a `PbFieldMask<InputSourceSwitchedInfo>`.
+  enum class Field : PbTag {
+    /// Field `source`.
+    kSource = 1,
+  };
+
   // Field `source` (no 1).
   // -----
 
@@ -5383,6 +6106,10 @@ class InputSourceSwitchedInfo final : public PbMessage {
     return std::move(set_source(std::move(source)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see source()
   CowBytes source_{};
@@ -5431,6 +6158,11 @@ class RpcTimeoutWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -5439,12 +6171,25 @@ class RpcTimeoutWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.RpcTimeoutWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.RpcTimeoutWarning"; }
 
   /// The full name of the message: `horus.pb.logs.RpcTimeoutWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `RpcTimeoutWarning`, e.g. to build a `PbFieldMask<RpcTimeoutWarning>`.
+  enum class Field : PbTag {
+    /// Field `request_name`.
+    kRequestName = 1,
+    /// Field `endpoint`.
+    kEndpoint = 2,
+    /// Field `elapsed`.
+    kElapsed = 3,
+  };
+
   // Field `request_name` (no 1).
   // -----
 
@@ -5551,8 +6296,12 @@ class RpcTimeoutWarning final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 3.
-  constexpr const horus::pb::LogMetadata_Duration& elapsed() const& noexcept HORUS_LIFETIME_BOUND {
-    return elapsed_;
+  ///
+  /// If `elapsed` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `elapsed` was received and is not a valid message.
+  const horus::pb::LogMetadata_Duration& elapsed() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return elapsed_.Ref();
   }
 
   /// If `elapsed` is set, moves it out of the message (without marking it as unset).
@@ -5560,19 +6309,23 @@ class RpcTimeoutWarning final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 3.
-  horus::pb::LogMetadata_Duration elapsed() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `elapsed` was received and is not a valid message.
+  horus::pb::LogMetadata_Duration elapsed() && noexcept(false) {
     if (!set_fields_[2]) {
       return {};
     }
-    return std::move(elapsed_);
+    return std::move(elapsed_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 3.
-  horus::pb::LogMetadata_Duration& mutable_elapsed() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `elapsed` was received and is not a valid message.
+  horus::pb::LogMetadata_Duration& mutable_elapsed() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[2] = true;
-    return elapsed_;
+    return elapsed_.Mutable();
   }
 
   /// Returns whether `elapsed` (no 3) is set.
@@ -5581,13 +6334,13 @@ class RpcTimeoutWarning final : public PbMessage {
   /// Clears `elapsed` (no 3).
   void clear_elapsed() & noexcept {
     set_fields_[2] = false;
-    elapsed_ = {};
+    elapsed_.Clear();
   }
 
   /// Sets `elapsed` (no 3) and returns `*this`.
   RpcTimeoutWarning& set_elapsed(horus::pb::LogMetadata_Duration&& elapsed) & noexcept {
     set_fields_[2] = true;
-    elapsed_ = std::move(elapsed);
+    elapsed_.Set(std::move(elapsed));
     return *this;
   }
   /// Sets `elapsed` (no 3) and returns `*this`.
@@ -5595,13 +6348,17 @@ class RpcTimeoutWarning final : public PbMessage {
     return std::move(set_elapsed(std::move(elapsed)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see request_name()
   CowBytes request_name_{};
   /// @see endpoint()
   CowBytes endpoint_{};
   /// @see elapsed()
-  horus::pb::LogMetadata_Duration elapsed_{};
+  PbLazy<horus::pb::LogMetadata_Duration> elapsed_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<3> set_fields_;
@@ -5647,6 +6404,11 @@ class CannotWriteLogFile final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -5655,12 +6417,23 @@ class CannotWriteLogFile final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.CannotWriteLogFile`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.CannotWriteLogFile"; }
 
   /// The full name of the message: `horus.pb.logs.CannotWriteLogFile`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `CannotWriteLogFile`, e.g. to build a `PbFieldMask<CannotWriteLogFile>`.
+  enum class Field : PbTag {
+    /// Field `path`.
+    kPath = 1,
+    /// Field `details`.
+    kDetails = 2,
+  };
+
   // Field `path` (no 1).
   // -----
 
@@ -5761,6 +6534,10 @@ class CannotWriteLogFile final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see path()
   CowBytes path_{};
@@ -5811,6 +6588,11 @@ class PointCloudParsingFailureWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -5819,12 +6601,21 @@ class PointCloudParsingFailureWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.PointCloudParsingFailureWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.PointCloudParsingFailureWarning"; }
 
   /// The full name of the message: `horus.pb.logs.PointCloudParsingFailureWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `PointCloudParsingFailureWarning`, e.g. to build a `PbFieldMask<PointCloudParsingFailureWarning>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -5875,6 +6666,10 @@ class PointCloudParsingFailureWarning final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -5923,6 +6718,11 @@ class LidarIsDead final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -5931,12 +6731,23 @@ class LidarIsDead final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LidarIsDead`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LidarIsDead"; }
 
   /// The full name of the message: `horus.pb.logs.LidarIsDead`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LidarIsDead`, e.g. to build a `PbFieldMask<LidarIsDead>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `lidar_name`.
+    kLidarName = 2,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -6037,6 +6848,10 @@ class LidarIsDead final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -6087,6 +6902,11 @@ class LidarIsNotDeadAnymore final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -6095,12 +6915,23 @@ class LidarIsNotDeadAnymore final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LidarIsNotDeadAnymore`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LidarIsNotDeadAnymore"; }
 
   /// The full name of the message: `horus.pb.logs.LidarIsNotDeadAnymore`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LidarIsNotDeadAnymore`, e.g. to build a `PbFieldMask<LidarIsNotDeadAnymore>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `lidar_name`.
+    kLidarName = 2,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -6201,6 +7032,10 @@ class LidarIsNotDeadAnymore final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -6251,6 +7086,11 @@ class LidarIsObstructed final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -6259,12 +7099,23 @@ class LidarIsObstructed final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LidarIsObstructed`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LidarIsObstructed"; }
 
   /// The full name of the message: `horus.pb.logs.LidarIsObstructed`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LidarIsObstructed`, e.g. to build a `PbFieldMask<LidarIsObstructed>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `lidar_name`.
+    kLidarName = 2,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -6365,6 +7216,10 @@ class LidarIsObstructed final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -6415,6 +7270,11 @@ class LidarIsNotObstructedAnymore final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -6423,12 +7283,23 @@ class LidarIsNotObstructedAnymore final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LidarIsNotObstructedAnymore`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LidarIsNotObstructedAnymore"; }
 
   /// The full name of the message: `horus.pb.logs.LidarIsNotObstructedAnymore`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LidarIsNotObstructedAnymore`, e.g. to build a `PbFieldMask<LidarIsNotObstructedAnymore>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `lidar_name`.
+    kLidarName = 2,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -6529,6 +7400,10 @@ class LidarIsNotObstructedAnymore final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -6579,6 +7454,11 @@ class LidarIsTilted final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -6587,12 +7467,23 @@ class LidarIsTilted final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LidarIsTilted`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LidarIsTilted"; }
 
   /// The full name of the message: `horus.pb.logs.LidarIsTilted`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LidarIsTilted`, e.g. to build a `PbFieldMask<LidarIsTilted>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `lidar_name`.
+    kLidarName = 2,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -6693,6 +7584,10 @@ class LidarIsTilted final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -6743,6 +7638,11 @@ class LidarIsNotTiltedAnymore final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -6751,12 +7651,23 @@ class LidarIsNotTiltedAnymore final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LidarIsNotTiltedAnymore`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LidarIsNotTiltedAnymore"; }
 
   /// The full name of the message: `horus.pb.logs.LidarIsNotTiltedAnymore`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LidarIsNotTiltedAnymore`, e.g. to build a `PbFieldMask<LidarIsNotTiltedAnymore>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `lidar_name`.
+    kLidarName = 2,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -6857,6 +7768,10 @@ class LidarIsNotTiltedAnymore final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -6907,6 +7822,11 @@ class LidarHasBeenAutomaticallyRecalibrated final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -6915,12 +7835,27 @@ class LidarHasBeenAutomaticallyRecalibrated final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LidarHasBeenAutomaticallyRecalibrated`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LidarHasBeenAutomaticallyRecalibrated"; }
 
   /// The full name of the message: `horus.pb.logs.LidarHasBeenAutomaticallyRecalibrated`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LidarHasBeenAutomaticallyRecalibrated`, e.g. to build a `PbFieldMask<LidarHasBeenAutomaticallyRecalibrated>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `lidar_name`.
+    kLidarName = 2,
+    /// Field `translation`.
+    kTranslation = 3,
+    /// Field `rotation_rpy`.
+    kRotationRpy = 4,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -7121,6 +8056,10 @@ class LidarHasBeenAutomaticallyRecalibrated final : public PbMessage {
     return std::move(set_rotation_rpy(std::move(rotation_rpy)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -7175,6 +8114,11 @@ class LidarAutoCorrectionFailed final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -7183,12 +8127,25 @@ class LidarAutoCorrectionFailed final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LidarAutoCorrectionFailed`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LidarAutoCorrectionFailed"; }
 
   /// The full name of the message: `horus.pb.logs.LidarAutoCorrectionFailed`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LidarAutoCorrectionFailed`, e.g. to build a `PbFieldMask<LidarAutoCorrectionFailed>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `lidar_name`.
+    kLidarName = 2,
+    /// Field `failure_count`.
+    kFailureCount = 3,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -7327,6 +8284,10 @@ class LidarAutoCorrectionFailed final : public PbMessage {
     return std::move(set_failure_count(failure_count));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -7379,6 +8340,11 @@ class LidarIcpFailed final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -7387,12 +8353,25 @@ class LidarIcpFailed final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LidarIcpFailed`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LidarIcpFailed"; }
 
   /// The full name of the message: `horus.pb.logs.LidarIcpFailed`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LidarIcpFailed`, e.g. to build a `PbFieldMask<LidarIcpFailed>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `lidar_name`.
+    kLidarName = 2,
+    /// Field `failure_count`.
+    kFailureCount = 3,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -7531,6 +8510,10 @@ class LidarIcpFailed final : public PbMessage {
     return std::move(set_failure_count(failure_count));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -7583,6 +8566,11 @@ class ReceivedFirstDataForLidar final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -7591,12 +8579,23 @@ class ReceivedFirstDataForLidar final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ReceivedFirstDataForLidar`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ReceivedFirstDataForLidar"; }
 
   /// The full name of the message: `horus.pb.logs.ReceivedFirstDataForLidar`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ReceivedFirstDataForLidar`, e.g. to build a `PbFieldMask<ReceivedFirstDataForLidar>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `lidar_name`.
+    kLidarName = 2,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -7697,6 +8696,10 @@ class ReceivedFirstDataForLidar final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -7747,6 +8750,11 @@ class TerminationFailureError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -7755,12 +8763,23 @@ class TerminationFailureError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.TerminationFailureError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.TerminationFailureError"; }
 
   /// The full name of the message: `horus.pb.logs.TerminationFailureError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `TerminationFailureError`, e.g. to build a `PbFieldMask<TerminationFailureError>`.
+  enum class Field : PbTag {
+    /// Field `component`.
+    kComponent = 1,
+    /// Field `details`.
+    kDetails = 2,
+  };
+
   // Field `component` (no 1).
   // -----
 
@@ -7861,6 +8880,10 @@ class TerminationFailureError final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see component()
   CowBytes component_{};
@@ -7911,6 +8934,11 @@ class FrameProcessingError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -7919,12 +8947,21 @@ class FrameProcessingError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.FrameProcessingError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.FrameProcessingError"; }
 
   /// The full name of the message: `horus.pb.logs.FrameProcessingError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `FrameProcessingError`, e.g. to build a `PbFieldMask<FrameProcessingError>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -7975,6 +9012,10 @@ class FrameProcessingError final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -8023,6 +9064,11 @@ class ThreadPoolUnavailableError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -8031,12 +9077,21 @@ class ThreadPoolUnavailableError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ThreadPoolUnavailableError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ThreadPoolUnavailableError"; }
 
   /// The full name of the message: `horus.pb.logs.ThreadPoolUnavailableError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ThreadPoolUnavailableError`, e.g. to build a `PbFieldMask<ThreadPoolUnavailableError>`.
+  enum class Field : PbTag {
+    /// Field `consequence`.
+    kConsequence = 1,
+  };
+
   // Field `consequence` (no 1).
   // -----
 
@@ -8087,6 +9142,10 @@ class ThreadPoolUnavailableError final : public PbMessage {
     return std::move(set_consequence(std::move(consequence)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see consequence()
   CowBytes consequence_{};
@@ -8135,6 +9194,11 @@ class InvalidArgument final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -8143,12 +9207,21 @@ class InvalidArgument final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.InvalidArgument`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.InvalidArgument"; }
 
   /// The full name of the message: `horus.pb.logs.InvalidArgument`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `InvalidArgument`, e.g. to build a `PbFieldMask<InvalidArgument>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -8199,6 +9272,10 @@ class InvalidArgument final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -8247,6 +9324,11 @@ class ComponentInitializationFailureFatal final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -8255,12 +9337,23 @@ class ComponentInitializationFailureFatal final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ComponentInitializationFailureFatal`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ComponentInitializationFailureFatal"; }
 
   /// The full name of the message: `horus.pb.logs.ComponentInitializationFailureFatal`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ComponentInitializationFailureFatal`, e.g. to build a `PbFieldMask<ComponentInitializationFailureFatal>`.
+  enum class Field : PbTag {
+    /// Field `component`.
+    kComponent = 1,
+    /// Field `details`.
+    kDetails = 2,
+  };
+
   // Field `component` (no 1).
   // -----
 
@@ -8361,6 +9454,10 @@ class ComponentInitializationFailureFatal final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see component()
   CowBytes component_{};
@@ -8411,6 +9508,11 @@ class UnhandledEnumCaseError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -8419,12 +9521,23 @@ class UnhandledEnumCaseError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.UnhandledEnumCaseError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.UnhandledEnumCaseError"; }
 
   /// The full name of the message: `horus.pb.logs.UnhandledEnumCaseError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `UnhandledEnumCaseError`, e.g. to build a `PbFieldMask<UnhandledEnumCaseError>`.
+  enum class Field : PbTag {
+    /// Field `case_name`.
+    kCaseName = 1,
+    /// Field `location`.
+    kLocation = 2,
+  };
+
   // Field `case_name` (no 1).
   // -----
 
@@ -8481,8 +9594,12 @@ class UnhandledEnumCaseError final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 2.
-  constexpr const horus::pb::LogMetadata_SourceLocation& location() const& noexcept HORUS_LIFETIME_BOUND {
-    return location_;
+  ///
+  /// If `location` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `location` was received and is not a valid message.
+  const horus::pb::LogMetadata_SourceLocation& location() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return location_.Ref();
   }
 
   /// If `location` is set, moves it out of the message (without marking it as unset).
@@ -8490,19 +9607,23 @@ class UnhandledEnumCaseError final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  horus::pb::LogMetadata_SourceLocation location() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `location` was received and is not a valid message.
+  horus::pb::LogMetadata_SourceLocation location() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(location_);
+    return std::move(location_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 2.
-  horus::pb::LogMetadata_SourceLocation& mutable_location() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `location` was received and is not a valid message.
+  horus::pb::LogMetadata_SourceLocation& mutable_location() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return location_;
+    return location_.Mutable();
   }
 
   /// Returns whether `location` (no 2) is set.
@@ -8511,13 +9632,13 @@ class UnhandledEnumCaseError final : public PbMessage {
   /// Clears `location` (no 2).
   void clear_location() & noexcept {
     set_fields_[1] = false;
-    location_ = {};
+    location_.Clear();
   }
 
   /// Sets `location` (no 2) and returns `*this`.
   UnhandledEnumCaseError& set_location(horus::pb::LogMetadata_SourceLocation&& location) & noexcept {
     set_fields_[1] = true;
-    location_ = std::move(location);
+    location_.Set(std::move(location));
     return *this;
   }
   /// Sets `location` (no 2) and returns `*this`.
@@ -8525,11 +9646,15 @@ class UnhandledEnumCaseError final : public PbMessage {
     return std::move(set_location(std::move(location)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see case_name()
   CowBytes case_name_{};
   /// @see location()
-  horus::pb::LogMetadata_SourceLocation location_{};
+  PbLazy<horus::pb::LogMetadata_SourceLocation> location_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<2> set_fields_;
@@ -8577,6 +9702,9 @@ class BagEmptyError final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -8587,6 +9715,9 @@ class BagEmptyError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.BagEmptyError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.BagEmptyError"; }
 
@@ -8639,6 +9770,11 @@ class DiscardingDataError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -8647,12 +9783,23 @@ class DiscardingDataError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.DiscardingDataError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.DiscardingDataError"; }
 
   /// The full name of the message: `horus.pb.logs.DiscardingDataError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `DiscardingDataError`, e.g. to build a `PbFieldMask<DiscardingDataError>`.
+  enum class Field : PbTag {
+    /// Field `component`.
+    kComponent = 1,
+    /// Field `details`.
+    kDetails = 2,
+  };
+
   // Field `component` (no 1).
   // -----
 
@@ -8753,6 +9900,10 @@ class DiscardingDataError final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see component()
   CowBytes component_{};
@@ -8803,6 +9954,11 @@ class DiscardingDataWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -8811,12 +9967,23 @@ class DiscardingDataWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.DiscardingDataWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.DiscardingDataWarning"; }
 
   /// The full name of the message: `horus.pb.logs.DiscardingDataWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `DiscardingDataWarning`, e.g. to build a `PbFieldMask<DiscardingDataWarning>`.
+  enum class Field : PbTag {
+    /// Field `component`.
+    kComponent = 1,
+    /// Field `details`.
+    kDetails = 2,
+  };
+
   // Field `component` (no 1).
   // -----
 
@@ -8917,6 +10084,10 @@ class DiscardingDataWarning final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see component()
   CowBytes component_{};
@@ -8967,6 +10138,11 @@ class NothingToProcess final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -8975,12 +10151,21 @@ class NothingToProcess final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.NothingToProcess`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.NothingToProcess"; }
 
   /// The full name of the message: `horus.pb.logs.NothingToProcess`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `NothingToProcess`, e.g. to build a `PbFieldMask<NothingToProcess>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -9031,6 +10216,10 @@ class NothingToProcess final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -9079,6 +10268,11 @@ class InvalidComponentConfiguration final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -9087,12 +10281,23 @@ class InvalidComponentConfiguration final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.InvalidComponentConfiguration`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.InvalidComponentConfiguration"; }
 
   /// The full name of the message: `horus.pb.logs.InvalidComponentConfiguration`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `InvalidComponentConfiguration`, e.g. to build a `PbFieldMask<InvalidComponentConfiguration>`.
+  enum class Field : PbTag {
+    /// Field `component`.
+    kComponent = 1,
+    /// Field `details`.
+    kDetails = 2,
+  };
+
   // Field `component` (no 1).
   // -----
 
@@ -9193,6 +10398,10 @@ class InvalidComponentConfiguration final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see component()
   CowBytes component_{};
@@ -9243,6 +10452,11 @@ class ChannelReceiverNotFoundWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -9251,12 +10465,21 @@ class ChannelReceiverNotFoundWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ChannelReceiverNotFoundWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ChannelReceiverNotFoundWarning"; }
 
   /// The full name of the message: `horus.pb.logs.ChannelReceiverNotFoundWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ChannelReceiverNotFoundWarning`, e.g. to build a `PbFieldMask<ChannelReceiverNotFoundWarning>`.
+  enum class Field : PbTag {
+    /// Field `key`.
+    kKey = 1,
+  };
+
   // Field `key` (no 1).
   // -----
 
@@ -9307,6 +10530,10 @@ class ChannelReceiverNotFoundWarning final : public PbMessage {
     return std::move(set_key(std::move(key)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see key()
   CowBytes key_{};
@@ -9355,6 +10582,11 @@ class ModelLoadFailure final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -9363,12 +10595,23 @@ class ModelLoadFailure final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ModelLoadFailure`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ModelLoadFailure"; }
 
   /// The full name of the message: `horus.pb.logs.ModelLoadFailure`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ModelLoadFailure`, e.g. to build a `PbFieldMask<ModelLoadFailure>`.
+  enum class Field : PbTag {
+    /// Field `model`.
+    kModel = 1,
+    /// Field `details`.
+    kDetails = 2,
+  };
+
   // Field `model` (no 1).
   // -----
 
@@ -9469,6 +10712,10 @@ class ModelLoadFailure final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see model()
   CowBytes model_{};
@@ -9519,6 +10766,11 @@ class ModelExecutionFailureError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -9527,12 +10779,23 @@ class ModelExecutionFailureError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ModelExecutionFailureError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ModelExecutionFailureError"; }
 
   /// The full name of the message: `horus.pb.logs.ModelExecutionFailureError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ModelExecutionFailureError`, e.g. to build a `PbFieldMask<ModelExecutionFailureError>`.
+  enum class Field : PbTag {
+    /// Field `model`.
+    kModel = 1,
+    /// Field `details`.
+    kDetails = 2,
+  };
+
   // Field `model` (no 1).
   // -----
 
@@ -9633,6 +10896,10 @@ class ModelExecutionFailureError final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see model()
   CowBytes model_{};
@@ -9683,6 +10950,11 @@ class ServiceReadyInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -9691,12 +10963,21 @@ class ServiceReadyInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ServiceReadyInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ServiceReadyInfo"; }
 
   /// The full name of the message: `horus.pb.logs.ServiceReadyInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ServiceReadyInfo`, e.g. to build a `PbFieldMask<ServiceReadyInfo>`.
+  enum class Field : PbTag {
+    /// Field `service`.
+    kService = 1,
+  };
+
   // Field `service` (no 1).
   // -----
 
@@ -9747,6 +11028,10 @@ class ServiceReadyInfo final : public PbMessage {
     return std::move(set_service(std::move(service)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see service()
   CowBytes service_{};
@@ -9795,6 +11080,11 @@ class ModelPreparingInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -9803,12 +11093,21 @@ class ModelPreparingInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ModelPreparingInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ModelPreparingInfo"; }
 
   /// The full name of the message: `horus.pb.logs.ModelPreparingInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ModelPreparingInfo`, e.g. to build a `PbFieldMask<ModelPreparingInfo>`.
+  enum class Field : PbTag {
+    /// Field `model`.
+    kModel = 1,
+  };
+
   // Field `model` (no 1).
   // -----
 
@@ -9859,6 +11158,10 @@ class ModelPreparingInfo final : public PbMessage {
     return std::move(set_model(std::move(model)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see model()
   CowBytes model_{};
@@ -9907,6 +11210,11 @@ class ModelInitializedInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -9915,12 +11223,21 @@ class ModelInitializedInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ModelInitializedInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ModelInitializedInfo"; }
 
   /// The full name of the message: `horus.pb.logs.ModelInitializedInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ModelInitializedInfo`, e.g. to build a `PbFieldMask<ModelInitializedInfo>`.
+  enum class Field : PbTag {
+    /// Field `name`.
+    kName = 1,
+  };
+
   // Field `name` (no 1).
   // -----
 
@@ -9971,6 +11288,10 @@ class ModelInitializedInfo final : public PbMessage {
     return std::move(set_name(std::move(name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see name()
   CowBytes name_{};
@@ -10019,6 +11340,11 @@ class ModelInitializationFailureWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -10027,12 +11353,23 @@ class ModelInitializationFailureWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ModelInitializationFailureWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ModelInitializationFailureWarning"; }
 
   /// The full name of the message: `horus.pb.logs.ModelInitializationFailureWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ModelInitializationFailureWarning`, e.g. to build a `PbFieldMask<ModelInitializationFailureWarning>`.
+  enum class Field : PbTag {
+    /// Field `model`.
+    kModel = 1,
+    /// Field `details`.
+    kDetails = 2,
+  };
+
   // Field `model` (no 1).
   // -----
 
@@ -10133,6 +11470,10 @@ class ModelInitializationFailureWarning final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see model()
   CowBytes model_{};
@@ -10183,6 +11524,11 @@ class RosSpinnerStoppedWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -10191,12 +11537,21 @@ class RosSpinnerStoppedWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.RosSpinnerStoppedWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.RosSpinnerStoppedWarning"; }
 
   /// The full name of the message: `horus.pb.logs.RosSpinnerStoppedWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `RosSpinnerStoppedWarning`, e.g. to build a `PbFieldMask<RosSpinnerStoppedWarning>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -10247,6 +11602,10 @@ class RosSpinnerStoppedWarning final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -10297,6 +11656,9 @@ class ActorSystemUnavailableError final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -10307,6 +11669,9 @@ class ActorSystemUnavailableError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.ActorSystemUnavailableError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ActorSystemUnavailableError"; }
 
@@ -10359,6 +11724,11 @@ class ConfigNodeNotFoundError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -10367,12 +11737,21 @@ class ConfigNodeNotFoundError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ConfigNodeNotFoundError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ConfigNodeNotFoundError"; }
 
   /// The full name of the message: `horus.pb.logs.ConfigNodeNotFoundError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ConfigNodeNotFoundError`, e.g. to build a `PbFieldMask<ConfigNodeNotFoundError>`.
+  enum class Field : PbTag {
+    /// Field `node`.
+    kNode = 1,
+  };
+
   // Field `node` (no 1).
   // -----
 
@@ -10423,6 +11802,10 @@ class ConfigNodeNotFoundError final : public PbMessage {
     return std::move(set_node(std::move(node)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see node()
   CowBytes node_{};
@@ -10471,6 +11854,11 @@ class BagTimestampOutOfOrderError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -10479,20 +11867,35 @@ class BagTimestampOutOfOrderError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.BagTimestampOutOfOrderError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.BagTimestampOutOfOrderError"; }
 
   /// The full name of the message: `horus.pb.logs.BagTimestampOutOfOrderError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `BagTimestampOutOfOrderError`, e.g. to build a `PbFieldMask<BagTimestampOutOfOrderError>`.
+  enum class Field : PbTag {
+    /// Field `prior_timestamp`.
+    kPriorTimestamp = 1,
+    /// Field `current_timestamp`.
+    kCurrentTimestamp = 2,
+  };
+
   // Field `prior_timestamp` (no 1).
   // -----
 
   /// No documentation.
   ///
   /// Field no: 1.
-  constexpr const horus::pb::LogMetadata_Timestamp& prior_timestamp() const& noexcept HORUS_LIFETIME_BOUND {
-    return prior_timestamp_;
+  ///
+  /// If `prior_timestamp` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `prior_timestamp` was received and is not a valid message.
+  const horus::pb::LogMetadata_Timestamp& prior_timestamp() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return prior_timestamp_.Ref();
   }
 
   /// If `prior_timestamp` is set, moves it out of the message (without marking it as unset).
@@ -10500,19 +11903,23 @@ class BagTimestampOutOfOrderError final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  horus::pb::LogMetadata_Timestamp prior_timestamp() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `prior_timestamp` was received and is not a valid message.
+  horus::pb::LogMetadata_Timestamp prior_timestamp() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(prior_timestamp_);
+    return std::move(prior_timestamp_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 1.
-  horus::pb::LogMetadata_Timestamp& mutable_prior_timestamp() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `prior_timestamp` was received and is not a valid message.
+  horus::pb::LogMetadata_Timestamp& mutable_prior_timestamp() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return prior_timestamp_;
+    return prior_timestamp_.Mutable();
   }
 
   /// Returns whether `prior_timestamp` (no 1) is set.
@@ -10521,13 +11928,13 @@ class BagTimestampOutOfOrderError final : public PbMessage {
   /// Clears `prior_timestamp` (no 1).
   void clear_prior_timestamp() & noexcept {
     set_fields_[0] = false;
-    prior_timestamp_ = {};
+    prior_timestamp_.Clear();
   }
 
   /// Sets `prior_timestamp` (no 1) and returns `*this`.
   BagTimestampOutOfOrderError& set_prior_timestamp(horus::pb::LogMetadata_Timestamp&& prior_timestamp) & noexcept {
     set_fields_[0] = true;
-    prior_timestamp_ = std::move(prior_timestamp);
+    prior_timestamp_.Set(std::move(prior_timestamp));
     return *this;
   }
   /// Sets `prior_timestamp` (no 1) and returns `*this`.
@@ -10541,8 +11948,12 @@ class BagTimestampOutOfOrderError final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 2.
-  constexpr const horus::pb::LogMetadata_Timestamp& current_timestamp() const& noexcept HORUS_LIFETIME_BOUND {
-    return current_timestamp_;
+  ///
+  /// If `current_timestamp` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `current_timestamp` was received and is not a valid message.
+  const horus::pb::LogMetadata_Timestamp& current_timestamp() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return current_timestamp_.Ref();
   }
 
   /// If `current_timestamp` is set, moves it out of the message (without marking it as unset).
@@ -10550,19 +11961,23 @@ class BagTimestampOutOfOrderError final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  horus::pb::LogMetadata_Timestamp current_timestamp() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `current_timestamp` was received and is not a valid message.
+  horus::pb::LogMetadata_Timestamp current_timestamp() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(current_timestamp_);
+    return std::move(current_timestamp_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 2.
-  horus::pb::LogMetadata_Timestamp& mutable_current_timestamp() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `current_timestamp` was received and is not a valid message.
+  horus::pb::LogMetadata_Timestamp& mutable_current_timestamp() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return current_timestamp_;
+    return current_timestamp_.Mutable();
   }
 
   /// Returns whether `current_timestamp` (no 2) is set.
@@ -10571,13 +11986,13 @@ class BagTimestampOutOfOrderError final : public PbMessage {
   /// Clears `current_timestamp` (no 2).
   void clear_current_timestamp() & noexcept {
     set_fields_[1] = false;
-    current_timestamp_ = {};
+    current_timestamp_.Clear();
   }
 
   /// Sets `current_timestamp` (no 2) and returns `*this`.
   BagTimestampOutOfOrderError& set_current_timestamp(horus::pb::LogMetadata_Timestamp&& current_timestamp) & noexcept {
     set_fields_[1] = true;
-    current_timestamp_ = std::move(current_timestamp);
+    current_timestamp_.Set(std::move(current_timestamp));
     return *this;
   }
   /// Sets `current_timestamp` (no 2) and returns `*this`.
@@ -10585,11 +12000,15 @@ class BagTimestampOutOfOrderError final : public PbMessage {
     return std::move(set_current_timestamp(std::move(current_timestamp)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see prior_timestamp()
-  horus::pb::LogMetadata_Timestamp prior_timestamp_{};
+  PbLazy<horus::pb::LogMetadata_Timestamp> prior_timestamp_{};
   /// @see current_timestamp()
-  horus::pb::LogMetadata_Timestamp current_timestamp_{};
+  PbLazy<horus::pb::LogMetadata_Timestamp> current_timestamp_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<2> set_fields_;
@@ -10635,6 +12054,11 @@ class BagReplayUnexpectedTimestampError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -10643,20 +12067,35 @@ class BagReplayUnexpectedTimestampError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.BagReplayUnexpectedTimestampError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.BagReplayUnexpectedTimestampError"; }
 
   /// The full name of the message: `horus.pb.logs.BagReplayUnexpectedTimestampError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `BagReplayUnexpectedTimestampError`, e.g. to build a `PbFieldMask<BagReplayUnexpectedTimestampError>`.
+  enum class Field : PbTag {
+    /// Field `expected_timestamp`.
+    kExpectedTimestamp = 1,
+    /// Field `received_timestamp`.
+    kReceivedTimestamp = 2,
+  };
+
   // Field `expected_timestamp` (no 1).
   // -----
 
   /// No documentation.
   ///
   /// Field no: 1.
-  constexpr const horus::pb::LogMetadata_Timestamp& expected_timestamp() const& noexcept HORUS_LIFETIME_BOUND {
-    return expected_timestamp_;
+  ///
+  /// If `expected_timestamp` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `expected_timestamp` was received and is not a valid message.
+  const horus::pb::LogMetadata_Timestamp& expected_timestamp() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return expected_timestamp_.Ref();
   }
 
   /// If `expected_timestamp` is set, moves it out of the message (without marking it as unset).
@@ -10664,19 +12103,23 @@ class BagReplayUnexpectedTimestampError final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  horus::pb::LogMetadata_Timestamp expected_timestamp() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `expected_timestamp` was received and is not a valid message.
+  horus::pb::LogMetadata_Timestamp expected_timestamp() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(expected_timestamp_);
+    return std::move(expected_timestamp_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 1.
-  horus::pb::LogMetadata_Timestamp& mutable_expected_timestamp() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `expected_timestamp` was received and is not a valid message.
+  horus::pb::LogMetadata_Timestamp& mutable_expected_timestamp() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return expected_timestamp_;
+    return expected_timestamp_.Mutable();
   }
 
   /// Returns whether `expected_timestamp` (no 1) is set.
@@ -10685,13 +12128,13 @@ class BagReplayUnexpectedTimestampError final : public PbMessage {
   /// Clears `expected_timestamp` (no 1).
   void clear_expected_timestamp() & noexcept {
     set_fields_[0] = false;
-    expected_timestamp_ = {};
+    expected_timestamp_.Clear();
   }
 
   /// Sets `expected_timestamp` (no 1) and returns `*this`.
   BagReplayUnexpectedTimestampError& set_expected_timestamp(horus::pb::LogMetadata_Timestamp&& expected_timestamp) & noexcept {
     set_fields_[0] = true;
-    expected_timestamp_ = std::move(expected_timestamp);
+    expected_timestamp_.Set(std::move(expected_timestamp));
     return *this;
   }
   /// Sets `expected_timestamp` (no 1) and returns `*this`.
@@ -10705,8 +12148,12 @@ class BagReplayUnexpectedTimestampError final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 2.
-  constexpr const horus::pb::LogMetadata_Timestamp& received_timestamp() const& noexcept HORUS_LIFETIME_BOUND {
-    return received_timestamp_;
+  ///
+  /// If `received_timestamp` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `received_timestamp` was received and is not a valid message.
+  const horus::pb::LogMetadata_Timestamp& received_timestamp() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return received_timestamp_.Ref();
   }
 
   /// If `received_timestamp` is set, moves it out of the message (without marking it as unset).
@@ -10714,19 +12161,23 @@ class BagReplayUnexpectedTimestampError final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  horus::pb::LogMetadata_Timestamp received_timestamp() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `received_timestamp` was received and is not a valid message.
+  horus::pb::LogMetadata_Timestamp received_timestamp() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(received_timestamp_);
+    return std::move(received_timestamp_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 2.
-  horus::pb::LogMetadata_Timestamp& mutable_received_timestamp() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `received_timestamp` was received and is not a valid message.
+  horus::pb::LogMetadata_Timestamp& mutable_received_timestamp() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return received_timestamp_;
+    return received_timestamp_.Mutable();
   }
 
   /// Returns whether `received_timestamp` (no 2) is set.
@@ -10735,13 +12186,13 @@ class BagReplayUnexpectedTimestampError final : public PbMessage {
   /// Clears `received_timestamp` (no 2).
   void clear_received_timestamp() & noexcept {
     set_fields_[1] = false;
-    received_timestamp_ = {};
+    received_timestamp_.Clear();
   }
 
   /// Sets `received_timestamp` (no 2) and returns `*this`.
   BagReplayUnexpectedTimestampError& set_received_timestamp(horus::pb::LogMetadata_Timestamp&& received_timestamp) & noexcept {
     set_fields_[1] = true;
-    received_timestamp_ = std::move(received_timestamp);
+    received_timestamp_.Set(std::move(received_timestamp));
     return *this;
   }
   /// Sets `received_timestamp` (no 2) and returns `*this`.
@@ -10749,11 +12200,15 @@ class BagReplayUnexpectedTimestampError final : public PbMessage {
     return std::move(set_received_timestamp(std::move(received_timestamp)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see expected_timestamp()
-  horus::pb::LogMetadata_Timestamp expected_timestamp_{};
+  PbLazy<horus::pb::LogMetadata_Timestamp> expected_timestamp_{};
   /// @see received_timestamp()
-  horus::pb::LogMetadata_Timestamp received_timestamp_{};
+  PbLazy<horus::pb::LogMetadata_Timestamp> received_timestamp_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<2> set_fields_;
@@ -10799,6 +12254,11 @@ class WebsocketClosedInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -10807,12 +12267,23 @@ class WebsocketClosedInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.WebsocketClosedInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.WebsocketClosedInfo"; }
 
   /// The full name of the message: `horus.pb.logs.WebsocketClosedInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `WebsocketClosedInfo`, e.g. to build a `PbFieldMask<WebsocketClosedInfo>`.
+  enum class Field : PbTag {
+    /// Field `uri`.
+    kUri = 1,
+    /// Field `reason`.
+    kReason = 2,
+  };
+
   // Field `uri` (no 1).
   // -----
 
@@ -10913,6 +12384,10 @@ class WebsocketClosedInfo final : public PbMessage {
     return std::move(set_reason(std::move(reason)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see uri()
   CowBytes uri_{};
@@ -10963,6 +12438,11 @@ class WebsocketOpenedInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -10971,12 +12451,23 @@ class WebsocketOpenedInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.WebsocketOpenedInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.WebsocketOpenedInfo"; }
 
   /// The full name of the message: `horus.pb.logs.WebsocketOpenedInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `WebsocketOpenedInfo`, e.g. to build a `PbFieldMask<WebsocketOpenedInfo>`.
+  enum class Field : PbTag {
+    /// Field `uri`.
+    kUri = 1,
+    /// Field `endpoint_is_server_client`.
+    kEndpointIsServerClient = 2,
+  };
+
   // Field `uri` (no 1).
   // -----
 
@@ -11077,6 +12568,10 @@ class WebsocketOpenedInfo final : public PbMessage {
     return std::move(set_endpoint_is_server_client(std::move(endpoint_is_server_client)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see uri()
   CowBytes uri_{};
@@ -11127,6 +12622,11 @@ class SubscriberDisconnectedInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -11135,12 +12635,23 @@ class SubscriberDisconnectedInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.SubscriberDisconnectedInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.SubscriberDisconnectedInfo"; }
 
   /// The full name of the message: `horus.pb.logs.SubscriberDisconnectedInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `SubscriberDisconnectedInfo`, e.g. to build a `PbFieldMask<SubscriberDisconnectedInfo>`.
+  enum class Field : PbTag {
+    /// Field `name`.
+    kName = 1,
+    /// Field `uri`.
+    kUri = 2,
+  };
+
   // Field `name` (no 1).
   // -----
 
@@ -11241,6 +12752,10 @@ class SubscriberDisconnectedInfo final : public PbMessage {
     return std::move(set_uri(std::move(uri)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see name()
   CowBytes name_{};
@@ -11291,6 +12806,11 @@ class ThreadPoolSlowingDownWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -11299,12 +12819,21 @@ class ThreadPoolSlowingDownWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ThreadPoolSlowingDownWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ThreadPoolSlowingDownWarning"; }
 
   /// The full name of the message: `horus.pb.logs.ThreadPoolSlowingDownWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ThreadPoolSlowingDownWarning`, e.g. to build a `PbFieldMask<ThreadPoolSlowingDownWarning>`.
+  enum class Field : PbTag {
+    /// Field `number`.
+    kNumber = 1,
+  };
+
   // Field `number` (no 1).
   // -----
 
@@ -11343,6 +12872,10 @@ class ThreadPoolSlowingDownWarning final : public PbMessage {
     return std::move(set_number(number));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see number()
   std::uint64_t number_{};
@@ -11391,6 +12924,11 @@ class ThreadPoolNotRespondingWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -11399,20 +12937,33 @@ class ThreadPoolNotRespondingWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ThreadPoolNotRespondingWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ThreadPoolNotRespondingWarning"; }
 
   /// The full name of the message: `horus.pb.logs.ThreadPoolNotRespondingWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ThreadPoolNotRespondingWarning`, e.g. to build a `PbFieldMask<ThreadPoolNotRespondingWarning>`.
+  enum class Field : PbTag {
+    /// Field `not_responding_for`.
+    kNotRespondingFor = 1,
+  };
+
   // Field `not_responding_for` (no 1).
   // -----
 
   /// No documentation.
   ///
   /// Field no: 1.
-  constexpr const horus::pb::LogMetadata_Duration& not_responding_for() const& noexcept HORUS_LIFETIME_BOUND {
-    return not_responding_for_;
+  ///
+  /// If `not_responding_for` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `not_responding_for` was received and is not a valid message.
+  const horus::pb::LogMetadata_Duration& not_responding_for() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return not_responding_for_.Ref();
   }
 
   /// If `not_responding_for` is set, moves it out of the message (without marking it as unset).
@@ -11420,19 +12971,23 @@ class ThreadPoolNotRespondingWarning final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  horus::pb::LogMetadata_Duration not_responding_for() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `not_responding_for` was received and is not a valid message.
+  horus::pb::LogMetadata_Duration not_responding_for() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(not_responding_for_);
+    return std::move(not_responding_for_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 1.
-  horus::pb::LogMetadata_Duration& mutable_not_responding_for() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `not_responding_for` was received and is not a valid message.
+  horus::pb::LogMetadata_Duration& mutable_not_responding_for() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return not_responding_for_;
+    return not_responding_for_.Mutable();
   }
 
   /// Returns whether `not_responding_for` (no 1) is set.
@@ -11441,13 +12996,13 @@ class ThreadPoolNotRespondingWarning final : public PbMessage {
   /// Clears `not_responding_for` (no 1).
   void clear_not_responding_for() & noexcept {
     set_fields_[0] = false;
-    not_responding_for_ = {};
+    not_responding_for_.Clear();
   }
 
   /// Sets `not_responding_for` (no 1) and returns `*this`.
   ThreadPoolNotRespondingWarning& set_not_responding_for(horus::pb::LogMetadata_Duration&& not_responding_for) & noexcept {
     set_fields_[0] = true;
-    not_responding_for_ = std::move(not_responding_for);
+    not_responding_for_.Set(std::move(not_responding_for));
     return *this;
   }
   /// Sets `not_responding_for` (no 1) and returns `*this`.
@@ -11455,9 +13010,13 @@ class ThreadPoolNotRespondingWarning final : public PbMessage {
     return std::move(set_not_responding_for(std::move(not_responding_for)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see not_responding_for()
-  horus::pb::LogMetadata_Duration not_responding_for_{};
+  PbLazy<horus::pb::LogMetadata_Duration> not_responding_for_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<1> set_fields_;
@@ -11505,6 +13064,9 @@ class ThreadPoolBrokenPromiseWarning final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -11515,6 +13077,9 @@ class ThreadPoolBrokenPromiseWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.ThreadPoolBrokenPromiseWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ThreadPoolBrokenPromiseWarning"; }
 
@@ -11569,6 +13134,9 @@ class BoxFittingPointsBelowBaseWarning final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -11579,6 +13147,9 @@ class BoxFittingPointsBelowBaseWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.BoxFittingPointsBelowBaseWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.BoxFittingPointsBelowBaseWarning"; }
 
@@ -11631,6 +13202,11 @@ class FailedToRemoveStalePointsWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -11639,12 +13215,21 @@ class FailedToRemoveStalePointsWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.FailedToRemoveStalePointsWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.FailedToRemoveStalePointsWarning"; }
 
   /// The full name of the message: `horus.pb.logs.FailedToRemoveStalePointsWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `FailedToRemoveStalePointsWarning`, e.g. to build a `PbFieldMask<FailedToRemoveStalePointsWarning>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -11695,6 +13280,10 @@ class FailedToRemoveStalePointsWarning final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -11743,6 +13332,11 @@ class IrregularBroadcastingPeriodWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -11751,12 +13345,25 @@ class IrregularBroadcastingPeriodWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.IrregularBroadcastingPeriodWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.IrregularBroadcastingPeriodWarning"; }
 
   /// The full name of the message: `horus.pb.logs.IrregularBroadcastingPeriodWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `IrregularBroadcastingPeriodWarning`, e.g. to build a `PbFieldMask<IrregularBroadcastingPeriodWarning>`.
+  enum class Field : PbTag {
+    /// Field `num_irregular`.
+    kNumIrregular = 1,
+    /// Field `duration`.
+    kDuration = 2,
+    /// Field `mean_deviation`.
+    kMeanDeviation = 3,
+  };
+
   // Field `num_irregular` (no 1).
   // -----
 
@@ -11801,8 +13408,12 @@ class IrregularBroadcastingPeriodWarning final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 2.
-  constexpr const horus::pb::LogMetadata_Duration& duration() const& noexcept HORUS_LIFETIME_BOUND {
-    return duration_;
+  ///
+  /// If `duration` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `duration` was received and is not a valid message.
+  const horus::pb::LogMetadata_Duration& duration() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return duration_.Ref();
   }
 
   /// If `duration` is set, moves it out of the message (without marking it as unset).
@@ -11810,19 +13421,23 @@ class IrregularBroadcastingPeriodWarning final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  horus::pb::LogMetadata_Duration duration() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `duration` was received and is not a valid message.
+  horus::pb::LogMetadata_Duration duration() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(duration_);
+    return std::move(duration_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 2.
-  horus::pb::LogMetadata_Duration& mutable_duration() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `duration` was received and is not a valid message.
+  horus::pb::LogMetadata_Duration& mutable_duration() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return duration_;
+    return duration_.Mutable();
   }
 
   /// Returns whether `duration` (no 2) is set.
@@ -11831,13 +13446,13 @@ class IrregularBroadcastingPeriodWarning final : public PbMessage {
   /// Clears `duration` (no 2).
   void clear_duration() & noexcept {
     set_fields_[1] = false;
-    duration_ = {};
+    duration_.Clear();
   }
 
   /// Sets `duration` (no 2) and returns `*this`.
   IrregularBroadcastingPeriodWarning& set_duration(horus::pb::LogMetadata_Duration&& duration) & noexcept {
     set_fields_[1] = true;
-    duration_ = std::move(duration);
+    duration_.Set(std::move(duration));
     return *this;
   }
   /// Sets `duration` (no 2) and returns `*this`.
@@ -11851,8 +13466,12 @@ class IrregularBroadcastingPeriodWarning final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 3.
-  constexpr const horus::pb::LogMetadata_Duration& mean_deviation() const& noexcept HORUS_LIFETIME_BOUND {
-    return mean_deviation_;
+  ///
+  /// If `mean_deviation` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `mean_deviation` was received and is not a valid message.
+  const horus::pb::LogMetadata_Duration& mean_deviation() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return mean_deviation_.Ref();
   }
 
   /// If `mean_deviation` is set, moves it out of the message (without marking it as unset).
@@ -11860,19 +13479,23 @@ class IrregularBroadcastingPeriodWarning final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 3.
-  horus::pb::LogMetadata_Duration mean_deviation() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `mean_deviation` was received and is not a valid message.
+  horus::pb::LogMetadata_Duration mean_deviation() && noexcept(false) {
     if (!set_fields_[2]) {
       return {};
     }
-    return std::move(mean_deviation_);
+    return std::move(mean_deviation_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 3.
-  horus::pb::LogMetadata_Duration& mutable_mean_deviation() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `mean_deviation` was received and is not a valid message.
+  horus::pb::LogMetadata_Duration& mutable_mean_deviation() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[2] = true;
-    return mean_deviation_;
+    return mean_deviation_.Mutable();
   }
 
   /// Returns whether `mean_deviation` (no 3) is set.
@@ -11881,13 +13504,13 @@ class IrregularBroadcastingPeriodWarning final : public PbMessage {
   /// Clears `mean_deviation` (no 3).
   void clear_mean_deviation() & noexcept {
     set_fields_[2] = false;
-    mean_deviation_ = {};
+    mean_deviation_.Clear();
   }
 
   /// Sets `mean_deviation` (no 3) and returns `*this`.
   IrregularBroadcastingPeriodWarning& set_mean_deviation(horus::pb::LogMetadata_Duration&& mean_deviation) & noexcept {
     set_fields_[2] = true;
-    mean_deviation_ = std::move(mean_deviation);
+    mean_deviation_.Set(std::move(mean_deviation));
     return *this;
   }
   /// Sets `mean_deviation` (no 3) and returns `*this`.
@@ -11895,13 +13518,17 @@ class IrregularBroadcastingPeriodWarning final : public PbMessage {
     return std::move(set_mean_deviation(std::move(mean_deviation)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see num_irregular()
   std::uint64_t num_irregular_{};
   /// @see duration()
-  horus::pb::LogMetadata_Duration duration_{};
+  PbLazy<horus::pb::LogMetadata_Duration> duration_{};
   /// @see mean_deviation()
-  horus::pb::LogMetadata_Duration mean_deviation_{};
+  PbLazy<horus::pb::LogMetadata_Duration> mean_deviation_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<3> set_fields_;
@@ -11947,6 +13574,11 @@ class ClustererPointsOutOfRangeWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -11955,12 +13587,23 @@ class ClustererPointsOutOfRangeWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ClustererPointsOutOfRangeWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ClustererPointsOutOfRangeWarning"; }
 
   /// The full name of the message: `horus.pb.logs.ClustererPointsOutOfRangeWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ClustererPointsOutOfRangeWarning`, e.g. to build a `PbFieldMask<ClustererPointsOutOfRangeWarning>`.
+  enum class Field : PbTag {
+    /// Field `num_points`.
+    kNumPoints = 1,
+    /// Field `sample_points`.
+    kSamplePoints = 2,
+  };
+
   // Field `num_points` (no 1).
   // -----
 
@@ -12049,6 +13692,10 @@ class ClustererPointsOutOfRangeWarning final : public PbMessage {
     return std::move(set_sample_points(std::move(sample_points)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see num_points()
   std::uint64_t num_points_{};
@@ -12099,6 +13746,11 @@ class InternalError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -12107,12 +13759,21 @@ class InternalError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.InternalError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.InternalError"; }
 
   /// The full name of the message: `horus.pb.logs.InternalError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `InternalError`, e.g. to build a `PbFieldMask<InternalError>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -12163,6 +13824,10 @@ class InternalError final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -12211,6 +13876,11 @@ class InternalFatal final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -12219,12 +13889,21 @@ class InternalFatal final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.InternalFatal`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.InternalFatal"; }
 
   /// The full name of the message: `horus.pb.logs.InternalFatal`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `InternalFatal`, e.g. to build a `PbFieldMask<InternalFatal>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -12275,6 +13954,10 @@ class InternalFatal final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -12323,6 +14006,11 @@ class ServiceStartingInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -12331,12 +14019,21 @@ class ServiceStartingInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ServiceStartingInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ServiceStartingInfo"; }
 
   /// The full name of the message: `horus.pb.logs.ServiceStartingInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ServiceStartingInfo`, e.g. to build a `PbFieldMask<ServiceStartingInfo>`.
+  enum class Field : PbTag {
+    /// Field `service`.
+    kService = 1,
+  };
+
   // Field `service` (no 1).
   // -----
 
@@ -12387,6 +14084,10 @@ class ServiceStartingInfo final : public PbMessage {
     return std::move(set_service(std::move(service)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see service()
   CowBytes service_{};
@@ -12435,6 +14136,11 @@ class ConfigNodeNotFoundFatal final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -12443,12 +14149,21 @@ class ConfigNodeNotFoundFatal final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ConfigNodeNotFoundFatal`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ConfigNodeNotFoundFatal"; }
 
   /// The full name of the message: `horus.pb.logs.ConfigNodeNotFoundFatal`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ConfigNodeNotFoundFatal`, e.g. to build a `PbFieldMask<ConfigNodeNotFoundFatal>`.
+  enum class Field : PbTag {
+    /// Field `node`.
+    kNode = 1,
+  };
+
   // Field `node` (no 1).
   // -----
 
@@ -12499,6 +14214,10 @@ class ConfigNodeNotFoundFatal final : public PbMessage {
     return std::move(set_node(std::move(node)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see node()
   CowBytes node_{};
@@ -12547,6 +14266,11 @@ class ServiceSetupError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -12555,12 +14279,21 @@ class ServiceSetupError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ServiceSetupError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ServiceSetupError"; }
 
   /// The full name of the message: `horus.pb.logs.ServiceSetupError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ServiceSetupError`, e.g. to build a `PbFieldMask<ServiceSetupError>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -12611,6 +14344,10 @@ class ServiceSetupError final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -12659,6 +14396,11 @@ class FilesystemError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -12667,12 +14409,21 @@ class FilesystemError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.FilesystemError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.FilesystemError"; }
 
   /// The full name of the message: `horus.pb.logs.FilesystemError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `FilesystemError`, e.g. to build a `PbFieldMask<FilesystemError>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -12723,6 +14474,10 @@ class FilesystemError final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -12771,6 +14526,11 @@ class InvalidPresetWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -12779,12 +14539,25 @@ class InvalidPresetWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.InvalidPresetWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.InvalidPresetWarning"; }
 
   /// The full name of the message: `horus.pb.logs.InvalidPresetWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `InvalidPresetWarning`, e.g. to build a `PbFieldMask<InvalidPresetWarning>`.
+  enum class Field : PbTag {
+    /// Field `preset`.
+    kPreset = 1,
+    /// Field `fallback_name`.
+    kFallbackName = 2,
+    /// Field `reason`.
+    kReason = 3,
+  };
+
   // Field `preset` (no 1).
   // -----
 
@@ -12935,6 +14708,10 @@ class InvalidPresetWarning final : public PbMessage {
     return std::move(set_reason(std::move(reason)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see preset()
   CowBytes preset_{};
@@ -12987,6 +14764,11 @@ class WebsocketFailedClearPendingError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -12995,12 +14777,21 @@ class WebsocketFailedClearPendingError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.WebsocketFailedClearPendingError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.WebsocketFailedClearPendingError"; }
 
   /// The full name of the message: `horus.pb.logs.WebsocketFailedClearPendingError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `WebsocketFailedClearPendingError`, e.g. to build a `PbFieldMask<WebsocketFailedClearPendingError>`.
+  enum class Field : PbTag {
+    /// Field `exception`.
+    kException = 1,
+  };
+
   // Field `exception` (no 1).
   // -----
 
@@ -13051,6 +14842,10 @@ class WebsocketFailedClearPendingError final : public PbMessage {
     return std::move(set_exception(std::move(exception)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see exception()
   CowBytes exception_{};
@@ -13099,6 +14894,11 @@ class WebsocketFailedToStopError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -13107,12 +14907,21 @@ class WebsocketFailedToStopError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.WebsocketFailedToStopError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.WebsocketFailedToStopError"; }
 
   /// The full name of the message: `horus.pb.logs.WebsocketFailedToStopError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `WebsocketFailedToStopError`, e.g. to build a `PbFieldMask<WebsocketFailedToStopError>`.
+  enum class Field : PbTag {
+    /// Field `exception`.
+    kException = 1,
+  };
+
   // Field `exception` (no 1).
   // -----
 
@@ -13163,6 +14972,10 @@ class WebsocketFailedToStopError final : public PbMessage {
     return std::move(set_exception(std::move(exception)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see exception()
   CowBytes exception_{};
@@ -13211,6 +15024,11 @@ class WebsocketFailedToCreateError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -13219,12 +15037,25 @@ class WebsocketFailedToCreateError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.WebsocketFailedToCreateError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.WebsocketFailedToCreateError"; }
 
   /// The full name of the message: `horus.pb.logs.WebsocketFailedToCreateError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `WebsocketFailedToCreateError`, e.g. to build a `PbFieldMask<WebsocketFailedToCreateError>`.
+  enum class Field : PbTag {
+    /// Field `host`.
+    kHost = 1,
+    /// Field `port`.
+    kPort = 2,
+    /// Field `exception`.
+    kException = 3,
+  };
+
   // Field `host` (no 1).
   // -----
 
@@ -13363,6 +15194,10 @@ class WebsocketFailedToCreateError final : public PbMessage {
     return std::move(set_exception(std::move(exception)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see host()
   CowBytes host_{};
@@ -13415,6 +15250,11 @@ class UnexpectedRpcError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -13423,12 +15263,21 @@ class UnexpectedRpcError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.UnexpectedRpcError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.UnexpectedRpcError"; }
 
   /// The full name of the message: `horus.pb.logs.UnexpectedRpcError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `UnexpectedRpcError`, e.g. to build a `PbFieldMask<UnexpectedRpcError>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -13479,6 +15328,10 @@ class UnexpectedRpcError final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -13527,6 +15380,11 @@ class LicensePollFailed final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -13535,12 +15393,21 @@ class LicensePollFailed final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LicensePollFailed`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LicensePollFailed"; }
 
   /// The full name of the message: `horus.pb.logs.LicensePollFailed`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LicensePollFailed`, e.g. to build a `PbFieldMask<LicensePollFailed>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -13591,6 +15458,10 @@ class LicensePollFailed final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -13639,6 +15510,11 @@ class LicenseExpiredWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -13647,20 +15523,33 @@ class LicenseExpiredWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LicenseExpiredWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LicenseExpiredWarning"; }
 
   /// The full name of the message: `horus.pb.logs.LicenseExpiredWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LicenseExpiredWarning`, e.g. to build a `PbFieldMask<LicenseExpiredWarning>`.
+  enum class Field : PbTag {
+    /// Field `expiration_time`.
+    kExpirationTime = 1,
+  };
+
   // Field `expiration_time` (no 1).
   // -----
 
   /// No documentation.
   ///
   /// Field no: 1.
-  constexpr const horus::pb::LogMetadata_Timestamp& expiration_time() const& noexcept HORUS_LIFETIME_BOUND {
-    return expiration_time_;
+  ///
+  /// If `expiration_time` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `expiration_time` was received and is not a valid message.
+  const horus::pb::LogMetadata_Timestamp& expiration_time() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return expiration_time_.Ref();
   }
 
   /// If `expiration_time` is set, moves it out of the message (without marking it as unset).
@@ -13668,19 +15557,23 @@ class LicenseExpiredWarning final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  horus::pb::LogMetadata_Timestamp expiration_time() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `expiration_time` was received and is not a valid message.
+  horus::pb::LogMetadata_Timestamp expiration_time() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(expiration_time_);
+    return std::move(expiration_time_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 1.
-  horus::pb::LogMetadata_Timestamp& mutable_expiration_time() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `expiration_time` was received and is not a valid message.
+  horus::pb::LogMetadata_Timestamp& mutable_expiration_time() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return expiration_time_;
+    return expiration_time_.Mutable();
   }
 
   /// Returns whether `expiration_time` (no 1) is set.
@@ -13689,13 +15582,13 @@ class LicenseExpiredWarning final : public PbMessage {
   /// Clears `expiration_time` (no 1).
   void clear_expiration_time() & noexcept {
     set_fields_[0] = false;
-    expiration_time_ = {};
+    expiration_time_.Clear();
   }
 
   /// Sets `expiration_time` (no 1) and returns `*this`.
   LicenseExpiredWarning& set_expiration_time(horus::pb::LogMetadata_Timestamp&& expiration_time) & noexcept {
     set_fields_[0] = true;
-    expiration_time_ = std::move(expiration_time);
+    expiration_time_.Set(std::move(expiration_time));
     return *this;
   }
   /// Sets `expiration_time` (no 1) and returns `*this`.
@@ -13703,9 +15596,13 @@ class LicenseExpiredWarning final : public PbMessage {
     return std::move(set_expiration_time(std::move(expiration_time)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see expiration_time()
-  horus::pb::LogMetadata_Timestamp expiration_time_{};
+  PbLazy<horus::pb::LogMetadata_Timestamp> expiration_time_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<1> set_fields_;
@@ -13751,6 +15648,11 @@ class LicenseUsageExceededWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -13759,12 +15661,23 @@ class LicenseUsageExceededWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LicenseUsageExceededWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LicenseUsageExceededWarning"; }
 
   /// The full name of the message: `horus.pb.logs.LicenseUsageExceededWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LicenseUsageExceededWarning`, e.g. to build a `PbFieldMask<LicenseUsageExceededWarning>`.
+  enum class Field : PbTag {
+    /// Field `lidar_count`.
+    kLidarCount = 1,
+    /// Field `max_lidar_count`.
+    kMaxLidarCount = 2,
+  };
+
   // Field `lidar_count` (no 1).
   // -----
 
@@ -13841,6 +15754,10 @@ class LicenseUsageExceededWarning final : public PbMessage {
     return std::move(set_max_lidar_count(max_lidar_count));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_count()
   std::uint64_t lidar_count_{};
@@ -13891,6 +15808,11 @@ class StaticThreadPoolSlowTaskWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -13899,20 +15821,35 @@ class StaticThreadPoolSlowTaskWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.StaticThreadPoolSlowTaskWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.StaticThreadPoolSlowTaskWarning"; }
 
   /// The full name of the message: `horus.pb.logs.StaticThreadPoolSlowTaskWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `StaticThreadPoolSlowTaskWarning`, e.g. to build a `PbFieldMask<StaticThreadPoolSlowTaskWarning>`.
+  enum class Field : PbTag {
+    /// Field `time_elapsed`.
+    kTimeElapsed = 1,
+    /// Field `enqueue_location`.
+    kEnqueueLocation = 2,
+  };
+
   // Field `time_elapsed` (no 1).
   // -----
 
   /// No documentation.
   ///
   /// Field no: 1.
-  constexpr const horus::pb::LogMetadata_Duration& time_elapsed() const& noexcept HORUS_LIFETIME_BOUND {
-    return time_elapsed_;
+  ///
+  /// If `time_elapsed` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `time_elapsed` was received and is not a valid message.
+  const horus::pb::LogMetadata_Duration& time_elapsed() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return time_elapsed_.Ref();
   }
 
   /// If `time_elapsed` is set, moves it out of the message (without marking it as unset).
@@ -13920,19 +15857,23 @@ class StaticThreadPoolSlowTaskWarning final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  horus::pb::LogMetadata_Duration time_elapsed() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `time_elapsed` was received and is not a valid message.
+  horus::pb::LogMetadata_Duration time_elapsed() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(time_elapsed_);
+    return std::move(time_elapsed_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 1.
-  horus::pb::LogMetadata_Duration& mutable_time_elapsed() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `time_elapsed` was received and is not a valid message.
+  horus::pb::LogMetadata_Duration& mutable_time_elapsed() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return time_elapsed_;
+    return time_elapsed_.Mutable();
   }
 
   /// Returns whether `time_elapsed` (no 1) is set.
@@ -13941,13 +15882,13 @@ class StaticThreadPoolSlowTaskWarning final : public PbMessage {
   /// Clears `time_elapsed` (no 1).
   void clear_time_elapsed() & noexcept {
     set_fields_[0] = false;
-    time_elapsed_ = {};
+    time_elapsed_.Clear();
   }
 
   /// Sets `time_elapsed` (no 1) and returns `*this`.
   StaticThreadPoolSlowTaskWarning& set_time_elapsed(horus::pb::LogMetadata_Duration&& time_elapsed) & noexcept {
     set_fields_[0] = true;
-    time_elapsed_ = std::move(time_elapsed);
+    time_elapsed_.Set(std::move(time_elapsed));
     return *this;
   }
   /// Sets `time_elapsed` (no 1) and returns `*this`.
@@ -13961,8 +15902,12 @@ class StaticThreadPoolSlowTaskWarning final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 2.
-  constexpr const horus::pb::LogMetadata_SourceLocation& enqueue_location() const& noexcept HORUS_LIFETIME_BOUND {
-    return enqueue_location_;
+  ///
+  /// If `enqueue_location` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `enqueue_location` was received and is not a valid message.
+  const horus::pb::LogMetadata_SourceLocation& enqueue_location() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return enqueue_location_.Ref();
   }
 
   /// If `enqueue_location` is set, moves it out of the message (without marking it as unset).
@@ -13970,19 +15915,23 @@ class StaticThreadPoolSlowTaskWarning final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  horus::pb::LogMetadata_SourceLocation enqueue_location() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `enqueue_location` was received and is not a valid message.
+  horus::pb::LogMetadata_SourceLocation enqueue_location() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(enqueue_location_);
+    return std::move(enqueue_location_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 2.
-  horus::pb::LogMetadata_SourceLocation& mutable_enqueue_location() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `enqueue_location` was received and is not a valid message.
+  horus::pb::LogMetadata_SourceLocation& mutable_enqueue_location() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return enqueue_location_;
+    return enqueue_location_.Mutable();
   }
 
   /// Returns whether `enqueue_location` (no 2) is set.
@@ -13991,13 +15940,13 @@ class StaticThreadPoolSlowTaskWarning final : public PbMessage {
   /// Clears `enqueue_location` (no 2).
   void clear_enqueue_location() & noexcept {
     set_fields_[1] = false;
-    enqueue_location_ = {};
+    enqueue_location_.Clear();
   }
 
   /// Sets `enqueue_location` (no 2) and returns `*this`.
   StaticThreadPoolSlowTaskWarning& set_enqueue_location(horus::pb::LogMetadata_SourceLocation&& enqueue_location) & noexcept {
     set_fields_[1] = true;
-    enqueue_location_ = std::move(enqueue_location);
+    enqueue_location_.Set(std::move(enqueue_location));
     return *this;
   }
   /// Sets `enqueue_location` (no 2) and returns `*this`.
@@ -14005,11 +15954,15 @@ class StaticThreadPoolSlowTaskWarning final : public PbMessage {
     return std::move(set_enqueue_location(std::move(enqueue_location)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see time_elapsed()
-  horus::pb::LogMetadata_Duration time_elapsed_{};
+  PbLazy<horus::pb::LogMetadata_Duration> time_elapsed_{};
   /// @see enqueue_location()
-  horus::pb::LogMetadata_SourceLocation enqueue_location_{};
+  PbLazy<horus::pb::LogMetadata_SourceLocation> enqueue_location_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<2> set_fields_;
@@ -14055,6 +16008,11 @@ class RpcUnsupportedServiceWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -14063,12 +16021,21 @@ class RpcUnsupportedServiceWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.RpcUnsupportedServiceWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.RpcUnsupportedServiceWarning"; }
 
   /// The full name of the message: `horus.pb.logs.RpcUnsupportedServiceWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `RpcUnsupportedServiceWarning`, e.g. to build a `PbFieldMask<RpcUnsupportedServiceWarning>`.
+  enum class Field : PbTag {
+    /// Field `service_id`.
+    kServiceId = 1,
+  };
+
   // Field `service_id` (no 1).
   // -----
 
@@ -14107,6 +16074,10 @@ class RpcUnsupportedServiceWarning final : public PbMessage {
     return std::move(set_service_id(service_id));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see service_id()
   std::uint32_t service_id_{};
@@ -14155,6 +16126,11 @@ class WebsocketHandlerProblem final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -14163,12 +16139,21 @@ class WebsocketHandlerProblem final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.WebsocketHandlerProblem`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.WebsocketHandlerProblem"; }
 
   /// The full name of the message: `horus.pb.logs.WebsocketHandlerProblem`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `WebsocketHandlerProblem`, e.g. to build a `PbFieldMask<WebsocketHandlerProblem>`.
+  enum class Field : PbTag {
+    /// Field `what`.
+    kWhat = 1,
+  };
+
   // Field `what` (no 1).
   // -----
 
@@ -14219,6 +16204,10 @@ class WebsocketHandlerProblem final : public PbMessage {
     return std::move(set_what(std::move(what)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see what()
   CowBytes what_{};
@@ -14267,6 +16256,11 @@ class WebsocketDeserializeError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -14275,12 +16269,21 @@ class WebsocketDeserializeError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.WebsocketDeserializeError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.WebsocketDeserializeError"; }
 
   /// The full name of the message: `horus.pb.logs.WebsocketDeserializeError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `WebsocketDeserializeError`, e.g. to build a `PbFieldMask<WebsocketDeserializeError>`.
+  enum class Field : PbTag {
+    /// Field `what`.
+    kWhat = 1,
+  };
+
   // Field `what` (no 1).
   // -----
 
@@ -14331,6 +16334,10 @@ class WebsocketDeserializeError final : public PbMessage {
     return std::move(set_what(std::move(what)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see what()
   CowBytes what_{};
@@ -14379,6 +16386,11 @@ class WebsocketExpiredRpcEndpointWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -14387,12 +16399,21 @@ class WebsocketExpiredRpcEndpointWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.WebsocketExpiredRpcEndpointWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.WebsocketExpiredRpcEndpointWarning"; }
 
   /// The full name of the message: `horus.pb.logs.WebsocketExpiredRpcEndpointWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `WebsocketExpiredRpcEndpointWarning`, e.g. to build a `PbFieldMask<WebsocketExpiredRpcEndpointWarning>`.
+  enum class Field : PbTag {
+    /// Field `uri`.
+    kUri = 1,
+  };
+
   // Field `uri` (no 1).
   // -----
 
@@ -14443,6 +16464,10 @@ class WebsocketExpiredRpcEndpointWarning final : public PbMessage {
     return std::move(set_uri(std::move(uri)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see uri()
   CowBytes uri_{};
@@ -14491,6 +16516,11 @@ class WebsocketQueueOverloadedWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -14499,12 +16529,23 @@ class WebsocketQueueOverloadedWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.WebsocketQueueOverloadedWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.WebsocketQueueOverloadedWarning"; }
 
   /// The full name of the message: `horus.pb.logs.WebsocketQueueOverloadedWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `WebsocketQueueOverloadedWarning`, e.g. to build a `PbFieldMask<WebsocketQueueOverloadedWarning>`.
+  enum class Field : PbTag {
+    /// Field `current`.
+    kCurrent = 1,
+    /// Field `max`.
+    kMax = 2,
+  };
+
   // Field `current` (no 1).
   // -----
 
@@ -14581,6 +16622,10 @@ class WebsocketQueueOverloadedWarning final : public PbMessage {
     return std::move(set_max(max));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see current()
   std::uint64_t current_{};
@@ -14631,6 +16676,11 @@ class RpcFailedToNotifyWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -14639,12 +16689,27 @@ class RpcFailedToNotifyWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.RpcFailedToNotifyWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.RpcFailedToNotifyWarning"; }
 
   /// The full name of the message: `horus.pb.logs.RpcFailedToNotifyWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `RpcFailedToNotifyWarning`, e.g. to build a `PbFieldMask<RpcFailedToNotifyWarning>`.
+  enum class Field : PbTag {
+    /// Field `service`.
+    kService = 1,
+    /// Field `uri`.
+    kUri = 2,
+    /// Field `notification_name`.
+    kNotificationName = 3,
+    /// Field `what`.
+    kWhat = 4,
+  };
+
   // Field `service` (no 1).
   // -----
 
@@ -14845,6 +16910,10 @@ class RpcFailedToNotifyWarning final : public PbMessage {
     return std::move(set_what(std::move(what)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see service()
   CowBytes service_{};
@@ -14899,6 +16968,11 @@ class ConfigSubscriptionFailedWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -14907,12 +16981,21 @@ class ConfigSubscriptionFailedWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ConfigSubscriptionFailedWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ConfigSubscriptionFailedWarning"; }
 
   /// The full name of the message: `horus.pb.logs.ConfigSubscriptionFailedWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ConfigSubscriptionFailedWarning`, e.g. to build a `PbFieldMask<ConfigSubscriptionFailedWarning>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -14963,6 +17046,10 @@ class ConfigSubscriptionFailedWarning final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -15011,6 +17098,11 @@ class ThreadPoolClampedWorkersWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -15019,12 +17111,23 @@ class ThreadPoolClampedWorkersWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ThreadPoolClampedWorkersWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ThreadPoolClampedWorkersWarning"; }
 
   /// The full name of the message: `horus.pb.logs.ThreadPoolClampedWorkersWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ThreadPoolClampedWorkersWarning`, e.g. to build a `PbFieldMask<ThreadPoolClampedWorkersWarning>`.
+  enum class Field : PbTag {
+    /// Field `clamped`.
+    kClamped = 1,
+    /// Field `requested`.
+    kRequested = 2,
+  };
+
   // Field `clamped` (no 1).
   // -----
 
@@ -15101,6 +17204,10 @@ class ThreadPoolClampedWorkersWarning final : public PbMessage {
     return std::move(set_requested(requested));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see clamped()
   std::uint64_t clamped_{};
@@ -15153,6 +17260,9 @@ class StoppingHorusBagRecorderAlreadyStopped final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -15163,6 +17273,9 @@ class StoppingHorusBagRecorderAlreadyStopped final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.StoppingHorusBagRecorderAlreadyStopped`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.StoppingHorusBagRecorderAlreadyStopped"; }
 
@@ -15217,6 +17330,9 @@ class RecorderConfigUpdateWhileRunning final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -15227,6 +17343,9 @@ class RecorderConfigUpdateWhileRunning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.RecorderConfigUpdateWhileRunning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.RecorderConfigUpdateWhileRunning"; }
 
@@ -15279,6 +17398,11 @@ class ClampingDataWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -15287,12 +17411,21 @@ class ClampingDataWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ClampingDataWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ClampingDataWarning"; }
 
   /// The full name of the message: `horus.pb.logs.ClampingDataWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ClampingDataWarning`, e.g. to build a `PbFieldMask<ClampingDataWarning>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -15343,6 +17476,10 @@ class ClampingDataWarning final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -15391,6 +17528,11 @@ class LidarIncompatibleValues final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -15399,12 +17541,31 @@ class LidarIncompatibleValues final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LidarIncompatibleValues`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LidarIncompatibleValues"; }
 
   /// The full name of the message: `horus.pb.logs.LidarIncompatibleValues`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LidarIncompatibleValues`, e.g. to build a `PbFieldMask<LidarIncompatibleValues>`.
+  enum class Field : PbTag {
+    /// Field `lidar_ip1`.
+    kLidarIp1 = 1,
+    /// Field `lidar_ip2`.
+    kLidarIp2 = 2,
+    /// Field `value1`.
+    kValue1 = 3,
+    /// Field `value2`.
+    kValue2 = 4,
+    /// Field `value_names`.
+    kValueNames = 5,
+    /// Field `resolution`.
+    kResolution = 6,
+  };
+
   // Field `lidar_ip1` (no 1).
   // -----
 
@@ -15705,6 +17866,10 @@ class LidarIncompatibleValues final : public PbMessage {
     return std::move(set_resolution(std::move(resolution)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_ip1()
   CowBytes lidar_ip1_{};
@@ -15763,6 +17928,11 @@ class CannotDetermineContainerIdError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -15771,12 +17941,21 @@ class CannotDetermineContainerIdError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.CannotDetermineContainerIdError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.CannotDetermineContainerIdError"; }
 
   /// The full name of the message: `horus.pb.logs.CannotDetermineContainerIdError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `CannotDetermineContainerIdError`, e.g. to build a `PbFieldMask<CannotDetermineContainerIdError>`.
+  enum class Field : PbTag {
+    /// Field `container_id_file_path`.
+    kContainerIdFilePath = 1,
+  };
+
   // Field `container_id_file_path` (no 1).
   // -----
 
@@ -15827,6 +18006,10 @@ class CannotDetermineContainerIdError final : public PbMessage {
     return std::move(set_container_id_file_path(std::move(container_id_file_path)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see container_id_file_path()
   CowBytes container_id_file_path_{};
@@ -15875,6 +18058,11 @@ class StartedLidarDriver final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -15883,12 +18071,23 @@ class StartedLidarDriver final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.StartedLidarDriver`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.StartedLidarDriver"; }
 
   /// The full name of the message: `horus.pb.logs.StartedLidarDriver`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `StartedLidarDriver`, e.g. to build a `PbFieldMask<StartedLidarDriver>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `lidar_name`.
+    kLidarName = 2,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -15989,6 +18188,10 @@ class StartedLidarDriver final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -16039,6 +18242,11 @@ class CannotStartLidarDriver final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -16047,12 +18255,25 @@ class CannotStartLidarDriver final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.CannotStartLidarDriver`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.CannotStartLidarDriver"; }
 
   /// The full name of the message: `horus.pb.logs.CannotStartLidarDriver`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `CannotStartLidarDriver`, e.g. to build a `PbFieldMask<CannotStartLidarDriver>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `details`.
+    kDetails = 2,
+    /// Field `lidar_name`.
+    kLidarName = 3,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -16203,6 +18424,10 @@ class CannotStartLidarDriver final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -16255,6 +18480,11 @@ class StoppedLidarDriver final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -16263,12 +18493,23 @@ class StoppedLidarDriver final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.StoppedLidarDriver`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.StoppedLidarDriver"; }
 
   /// The full name of the message: `horus.pb.logs.StoppedLidarDriver`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `StoppedLidarDriver`, e.g. to build a `PbFieldMask<StoppedLidarDriver>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `lidar_name`.
+    kLidarName = 2,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -16369,6 +18610,10 @@ class StoppedLidarDriver final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -16419,6 +18664,11 @@ class CannotStopLidarDriver final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -16427,12 +18677,25 @@ class CannotStopLidarDriver final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.CannotStopLidarDriver`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.CannotStopLidarDriver"; }
 
   /// The full name of the message: `horus.pb.logs.CannotStopLidarDriver`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `CannotStopLidarDriver`, e.g. to build a `PbFieldMask<CannotStopLidarDriver>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `details`.
+    kDetails = 2,
+    /// Field `lidar_name`.
+    kLidarName = 3,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -16583,6 +18846,10 @@ class CannotStopLidarDriver final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -16635,6 +18902,11 @@ class RestartedLidarDriver final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -16643,12 +18915,23 @@ class RestartedLidarDriver final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.RestartedLidarDriver`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.RestartedLidarDriver"; }
 
   /// The full name of the message: `horus.pb.logs.RestartedLidarDriver`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `RestartedLidarDriver`, e.g. to build a `PbFieldMask<RestartedLidarDriver>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `lidar_name`.
+    kLidarName = 2,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -16749,6 +19032,10 @@ class RestartedLidarDriver final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -16799,6 +19086,11 @@ class CannotRestartLidarDriver final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -16807,12 +19099,25 @@ class CannotRestartLidarDriver final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.CannotRestartLidarDriver`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.CannotRestartLidarDriver"; }
 
   /// The full name of the message: `horus.pb.logs.CannotRestartLidarDriver`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `CannotRestartLidarDriver`, e.g. to build a `PbFieldMask<CannotRestartLidarDriver>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `details`.
+    kDetails = 2,
+    /// Field `lidar_name`.
+    kLidarName = 3,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -16963,6 +19268,10 @@ class CannotRestartLidarDriver final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -17015,6 +19324,11 @@ class RemovedUnusedLidarDriver final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -17023,12 +19337,23 @@ class RemovedUnusedLidarDriver final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.RemovedUnusedLidarDriver`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.RemovedUnusedLidarDriver"; }
 
   /// The full name of the message: `horus.pb.logs.RemovedUnusedLidarDriver`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `RemovedUnusedLidarDriver`, e.g. to build a `PbFieldMask<RemovedUnusedLidarDriver>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `lidar_name`.
+    kLidarName = 2,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -17129,6 +19454,10 @@ class RemovedUnusedLidarDriver final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -17179,6 +19508,11 @@ class CannotRemoveUnusedLidarDriver final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -17187,12 +19521,25 @@ class CannotRemoveUnusedLidarDriver final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.CannotRemoveUnusedLidarDriver`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.CannotRemoveUnusedLidarDriver"; }
 
   /// The full name of the message: `horus.pb.logs.CannotRemoveUnusedLidarDriver`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `CannotRemoveUnusedLidarDriver`, e.g. to build a `PbFieldMask<CannotRemoveUnusedLidarDriver>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `details`.
+    kDetails = 2,
+    /// Field `lidar_name`.
+    kLidarName = 3,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -17343,6 +19690,10 @@ class CannotRemoveUnusedLidarDriver final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -17395,6 +19746,11 @@ class LidarDriverGcFailure final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -17403,12 +19759,21 @@ class LidarDriverGcFailure final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LidarDriverGcFailure`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LidarDriverGcFailure"; }
 
   /// The full name of the message: `horus.pb.logs.LidarDriverGcFailure`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LidarDriverGcFailure`, e.g. to build a `PbFieldMask<LidarDriverGcFailure>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -17459,6 +19824,10 @@ class LidarDriverGcFailure final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -17507,6 +19876,11 @@ class IdSpaceExhausted final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -17515,12 +19889,21 @@ class IdSpaceExhausted final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.IdSpaceExhausted`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.IdSpaceExhausted"; }
 
   /// The full name of the message: `horus.pb.logs.IdSpaceExhausted`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `IdSpaceExhausted`, e.g. to build a `PbFieldMask<IdSpaceExhausted>`.
+  enum class Field : PbTag {
+    /// Field `prefix`.
+    kPrefix = 1,
+  };
+
   // Field `prefix` (no 1).
   // -----
 
@@ -17571,6 +19954,10 @@ class IdSpaceExhausted final : public PbMessage {
     return std::move(set_prefix(std::move(prefix)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see prefix()
   CowBytes prefix_{};
@@ -17619,6 +20006,11 @@ class PreprocessingToPointAggregatorPointsSkipped final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -17627,12 +20019,23 @@ class PreprocessingToPointAggregatorPointsSkipped final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.PreprocessingToPointAggregatorPointsSkipped`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.PreprocessingToPointAggregatorPointsSkipped"; }
 
   /// The full name of the message: `horus.pb.logs.PreprocessingToPointAggregatorPointsSkipped`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `PreprocessingToPointAggregatorPointsSkipped`, e.g. to build a `PbFieldMask<PreprocessingToPointAggregatorPointsSkipped>`.
+  enum class Field : PbTag {
+    /// Field `num_skipped_points`.
+    kNumSkippedPoints = 1,
+    /// Field `check_interval`.
+    kCheckInterval = 2,
+  };
+
   // Field `num_skipped_points` (no 1).
   // -----
 
@@ -17677,8 +20080,12 @@ class PreprocessingToPointAggregatorPointsSkipped final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 2.
-  constexpr const horus::pb::LogMetadata_Duration& check_interval() const& noexcept HORUS_LIFETIME_BOUND {
-    return check_interval_;
+  ///
+  /// If `check_interval` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `check_interval` was received and is not a valid message.
+  const horus::pb::LogMetadata_Duration& check_interval() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return check_interval_.Ref();
   }
 
   /// If `check_interval` is set, moves it out of the message (without marking it as unset).
@@ -17686,19 +20093,23 @@ class PreprocessingToPointAggregatorPointsSkipped final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  horus::pb::LogMetadata_Duration check_interval() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `check_interval` was received and is not a valid message.
+  horus::pb::LogMetadata_Duration check_interval() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(check_interval_);
+    return std::move(check_interval_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 2.
-  horus::pb::LogMetadata_Duration& mutable_check_interval() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `check_interval` was received and is not a valid message.
+  horus::pb::LogMetadata_Duration& mutable_check_interval() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return check_interval_;
+    return check_interval_.Mutable();
   }
 
   /// Returns whether `check_interval` (no 2) is set.
@@ -17707,13 +20118,13 @@ class PreprocessingToPointAggregatorPointsSkipped final : public PbMessage {
   /// Clears `check_interval` (no 2).
   void clear_check_interval() & noexcept {
     set_fields_[1] = false;
-    check_interval_ = {};
+    check_interval_.Clear();
   }
 
   /// Sets `check_interval` (no 2) and returns `*this`.
   PreprocessingToPointAggregatorPointsSkipped& set_check_interval(horus::pb::LogMetadata_Duration&& check_interval) & noexcept {
     set_fields_[1] = true;
-    check_interval_ = std::move(check_interval);
+    check_interval_.Set(std::move(check_interval));
     return *this;
   }
   /// Sets `check_interval` (no 2) and returns `*this`.
@@ -17721,11 +20132,15 @@ class PreprocessingToPointAggregatorPointsSkipped final : public PbMessage {
     return std::move(set_check_interval(std::move(check_interval)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see num_skipped_points()
   std::uint64_t num_skipped_points_{};
   /// @see check_interval()
-  horus::pb::LogMetadata_Duration check_interval_{};
+  PbLazy<horus::pb::LogMetadata_Duration> check_interval_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<2> set_fields_;
@@ -17771,6 +20186,11 @@ class MinMsgIntervalLessThanThreshold final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -17779,12 +20199,25 @@ class MinMsgIntervalLessThanThreshold final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.MinMsgIntervalLessThanThreshold`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.MinMsgIntervalLessThanThreshold"; }
 
   /// The full name of the message: `horus.pb.logs.MinMsgIntervalLessThanThreshold`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `MinMsgIntervalLessThanThreshold`, e.g. to build a `PbFieldMask<MinMsgIntervalLessThanThreshold>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `threshold`.
+    kThreshold = 2,
+    /// Field `lidar_name`.
+    kLidarName = 3,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -17841,8 +20274,12 @@ class MinMsgIntervalLessThanThreshold final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 2.
-  constexpr const horus::pb::LogMetadata_Duration& threshold() const& noexcept HORUS_LIFETIME_BOUND {
-    return threshold_;
+  ///
+  /// If `threshold` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `threshold` was received and is not a valid message.
+  const horus::pb::LogMetadata_Duration& threshold() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return threshold_.Ref();
   }
 
   /// If `threshold` is set, moves it out of the message (without marking it as unset).
@@ -17850,19 +20287,23 @@ class MinMsgIntervalLessThanThreshold final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  horus::pb::LogMetadata_Duration threshold() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `threshold` was received and is not a valid message.
+  horus::pb::LogMetadata_Duration threshold() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(threshold_);
+    return std::move(threshold_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 2.
-  horus::pb::LogMetadata_Duration& mutable_threshold() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `threshold` was received and is not a valid message.
+  horus::pb::LogMetadata_Duration& mutable_threshold() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return threshold_;
+    return threshold_.Mutable();
   }
 
   /// Returns whether `threshold` (no 2) is set.
@@ -17871,13 +20312,13 @@ class MinMsgIntervalLessThanThreshold final : public PbMessage {
   /// Clears `threshold` (no 2).
   void clear_threshold() & noexcept {
     set_fields_[1] = false;
-    threshold_ = {};
+    threshold_.Clear();
   }
 
   /// Sets `threshold` (no 2) and returns `*this`.
   MinMsgIntervalLessThanThreshold& set_threshold(horus::pb::LogMetadata_Duration&& threshold) & noexcept {
     set_fields_[1] = true;
-    threshold_ = std::move(threshold);
+    threshold_.Set(std::move(threshold));
     return *this;
   }
   /// Sets `threshold` (no 2) and returns `*this`.
@@ -17935,11 +20376,15 @@ class MinMsgIntervalLessThanThreshold final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
   /// @see threshold()
-  horus::pb::LogMetadata_Duration threshold_{};
+  PbLazy<horus::pb::LogMetadata_Duration> threshold_{};
   /// @see lidar_name()
   CowBytes lidar_name_{};
 
@@ -17987,6 +20432,11 @@ class FailedToCleanupRosWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -17995,12 +20445,21 @@ class FailedToCleanupRosWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.FailedToCleanupRosWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.FailedToCleanupRosWarning"; }
 
   /// The full name of the message: `horus.pb.logs.FailedToCleanupRosWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `FailedToCleanupRosWarning`, e.g. to build a `PbFieldMask<FailedToCleanupRosWarning>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -18051,6 +20510,10 @@ class FailedToCleanupRosWarning final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -18099,6 +20562,11 @@ class RpcDisconnectedWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -18107,12 +20575,23 @@ class RpcDisconnectedWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.RpcDisconnectedWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.RpcDisconnectedWarning"; }
 
   /// The full name of the message: `horus.pb.logs.RpcDisconnectedWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `RpcDisconnectedWarning`, e.g. to build a `PbFieldMask<RpcDisconnectedWarning>`.
+  enum class Field : PbTag {
+    /// Field `request_name`.
+    kRequestName = 1,
+    /// Field `endpoint`.
+    kEndpoint = 2,
+  };
+
   // Field `request_name` (no 1).
   // -----
 
@@ -18213,6 +20692,10 @@ class RpcDisconnectedWarning final : public PbMessage {
     return std::move(set_endpoint(std::move(endpoint)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see request_name()
   CowBytes request_name_{};
@@ -18263,6 +20746,11 @@ class RpcUnhandledError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -18271,12 +20759,23 @@ class RpcUnhandledError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.RpcUnhandledError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.RpcUnhandledError"; }
 
   /// The full name of the message: `horus.pb.logs.RpcUnhandledError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `RpcUnhandledError`, e.g. to build a `PbFieldMask<RpcUnhandledError>`.
+  enum class Field : PbTag {
+    /// Field `request_name`.
+    kRequestName = 1,
+    /// Field `details`.
+    kDetails = 2,
+  };
+
   // Field `request_name` (no 1).
   // -----
 
@@ -18377,6 +20876,10 @@ class RpcUnhandledError final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see request_name()
   CowBytes request_name_{};
@@ -18427,6 +20930,11 @@ class TimeDiffOutOfRangeWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -18435,20 +20943,37 @@ class TimeDiffOutOfRangeWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.TimeDiffOutOfRangeWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.TimeDiffOutOfRangeWarning"; }
 
   /// The full name of the message: `horus.pb.logs.TimeDiffOutOfRangeWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `TimeDiffOutOfRangeWarning`, e.g. to build a `PbFieldMask<TimeDiffOutOfRangeWarning>`.
+  enum class Field : PbTag {
+    /// Field `prev_time`.
+    kPrevTime = 1,
+    /// Field `curr_time`.
+    kCurrTime = 2,
+    /// Field `diff`.
+    kDiff = 3,
+  };
+
   // Field `prev_time` (no 1).
   // -----
 
   /// No documentation.
   ///
   /// Field no: 1.
-  constexpr const horus::pb::LogMetadata_Timestamp& prev_time() const& noexcept HORUS_LIFETIME_BOUND {
-    return prev_time_;
+  ///
+  /// If `prev_time` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `prev_time` was received and is not a valid message.
+  const horus::pb::LogMetadata_Timestamp& prev_time() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return prev_time_.Ref();
   }
 
   /// If `prev_time` is set, moves it out of the message (without marking it as unset).
@@ -18456,19 +20981,23 @@ class TimeDiffOutOfRangeWarning final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  horus::pb::LogMetadata_Timestamp prev_time() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `prev_time` was received and is not a valid message.
+  horus::pb::LogMetadata_Timestamp prev_time() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(prev_time_);
+    return std::move(prev_time_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 1.
-  horus::pb::LogMetadata_Timestamp& mutable_prev_time() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `prev_time` was received and is not a valid message.
+  horus::pb::LogMetadata_Timestamp& mutable_prev_time() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return prev_time_;
+    return prev_time_.Mutable();
   }
 
   /// Returns whether `prev_time` (no 1) is set.
@@ -18477,13 +21006,13 @@ class TimeDiffOutOfRangeWarning final : public PbMessage {
   /// Clears `prev_time` (no 1).
   void clear_prev_time() & noexcept {
     set_fields_[0] = false;
-    prev_time_ = {};
+    prev_time_.Clear();
   }
 
   /// Sets `prev_time` (no 1) and returns `*this`.
   TimeDiffOutOfRangeWarning& set_prev_time(horus::pb::LogMetadata_Timestamp&& prev_time) & noexcept {
     set_fields_[0] = true;
-    prev_time_ = std::move(prev_time);
+    prev_time_.Set(std::move(prev_time));
     return *this;
   }
   /// Sets `prev_time` (no 1) and returns `*this`.
@@ -18497,8 +21026,12 @@ class TimeDiffOutOfRangeWarning final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 2.
-  constexpr const horus::pb::LogMetadata_Timestamp& curr_time() const& noexcept HORUS_LIFETIME_BOUND {
-    return curr_time_;
+  ///
+  /// If `curr_time` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `curr_time` was received and is not a valid message.
+  const horus::pb::LogMetadata_Timestamp& curr_time() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return curr_time_.Ref();
   }
 
   /// If `curr_time` is set, moves it out of the message (without marking it as unset).
@@ -18506,19 +21039,23 @@ class TimeDiffOutOfRangeWarning final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  horus::pb::LogMetadata_Timestamp curr_time() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `curr_time` was received and is not a valid message.
+  horus::pb::LogMetadata_Timestamp curr_time() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(curr_time_);
+    return std::move(curr_time_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 2.
-  horus::pb::LogMetadata_Timestamp& mutable_curr_time() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `curr_time` was received and is not a valid message.
+  horus::pb::LogMetadata_Timestamp& mutable_curr_time() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return curr_time_;
+    return curr_time_.Mutable();
   }
 
   /// Returns whether `curr_time` (no 2) is set.
@@ -18527,13 +21064,13 @@ class TimeDiffOutOfRangeWarning final : public PbMessage {
   /// Clears `curr_time` (no 2).
   void clear_curr_time() & noexcept {
     set_fields_[1] = false;
-    curr_time_ = {};
+    curr_time_.Clear();
   }
 
   /// Sets `curr_time` (no 2) and returns `*this`.
   TimeDiffOutOfRangeWarning& set_curr_time(horus::pb::LogMetadata_Timestamp&& curr_time) & noexcept {
     set_fields_[1] = true;
-    curr_time_ = std::move(curr_time);
+    curr_time_.Set(std::move(curr_time));
     return *this;
   }
   /// Sets `curr_time` (no 2) and returns `*this`.
@@ -18547,8 +21084,12 @@ class TimeDiffOutOfRangeWarning final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 3.
-  constexpr const horus::pb::LogMetadata_Duration& diff() const& noexcept HORUS_LIFETIME_BOUND {
-    return diff_;
+  ///
+  /// If `diff` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `diff` was received and is not a valid message.
+  const horus::pb::LogMetadata_Duration& diff() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return diff_.Ref();
   }
 
   /// If `diff` is set, moves it out of the message (without marking it as unset).
@@ -18556,19 +21097,23 @@ class TimeDiffOutOfRangeWarning final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 3.
-  horus::pb::LogMetadata_Duration diff() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `diff` was received and is not a valid message.
+  horus::pb::LogMetadata_Duration diff() && noexcept(false) {
     if (!set_fields_[2]) {
       return {};
     }
-    return std::move(diff_);
+    return std::move(diff_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 3.
-  horus::pb::LogMetadata_Duration& mutable_diff() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `diff` was received and is not a valid message.
+  horus::pb::LogMetadata_Duration& mutable_diff() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[2] = true;
-    return diff_;
+    return diff_.Mutable();
   }
 
   /// Returns whether `diff` (no 3) is set.
@@ -18577,13 +21122,13 @@ class TimeDiffOutOfRangeWarning final : public PbMessage {
   /// Clears `diff` (no 3).
   void clear_diff() & noexcept {
     set_fields_[2] = false;
-    diff_ = {};
+    diff_.Clear();
   }
 
   /// Sets `diff` (no 3) and returns `*this`.
   TimeDiffOutOfRangeWarning& set_diff(horus::pb::LogMetadata_Duration&& diff) & noexcept {
     set_fields_[2] = true;
-    diff_ = std::move(diff);
+    diff_.Set(std::move(diff));
     return *this;
   }
   /// Sets `diff` (no 3) and returns `*this`.
@@ -18591,13 +21136,17 @@ class TimeDiffOutOfRangeWarning final : public PbMessage {
     return std::move(set_diff(std::move(diff)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see prev_time()
-  horus::pb::LogMetadata_Timestamp prev_time_{};
+  PbLazy<horus::pb::LogMetadata_Timestamp> prev_time_{};
   /// @see curr_time()
-  horus::pb::LogMetadata_Timestamp curr_time_{};
+  PbLazy<horus::pb::LogMetadata_Timestamp> curr_time_{};
   /// @see diff()
-  horus::pb::LogMetadata_Duration diff_{};
+  PbLazy<horus::pb::LogMetadata_Duration> diff_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<3> set_fields_;
@@ -18643,6 +21192,11 @@ class TensorrtLog final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -18651,12 +21205,21 @@ class TensorrtLog final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.TensorrtLog`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.TensorrtLog"; }
 
   /// The full name of the message: `horus.pb.logs.TensorrtLog`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `TensorrtLog`, e.g. to build a `PbFieldMask<TensorrtLog>`.
+  enum class Field : PbTag {
+    /// Field `log`.
+    kLog = 1,
+  };
+
   // Field `log` (no 1).
   // -----
 
@@ -18707,6 +21270,10 @@ class TensorrtLog final : public PbMessage {
     return std::move(set_log(std::move(log)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see log()
   CowBytes log_{};
@@ -18757,6 +21324,9 @@ class BuildingTensorrtEngineInfo final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -18767,6 +21337,9 @@ class BuildingTensorrtEngineInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.BuildingTensorrtEngineInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.BuildingTensorrtEngineInfo"; }
 
@@ -18821,6 +21394,9 @@ class LoadingTensorrtEngineInfo final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -18831,6 +21407,9 @@ class LoadingTensorrtEngineInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.LoadingTensorrtEngineInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LoadingTensorrtEngineInfo"; }
 
@@ -18883,6 +21462,11 @@ class CalibrationMapNotFound final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -18891,12 +21475,21 @@ class CalibrationMapNotFound final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.CalibrationMapNotFound`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.CalibrationMapNotFound"; }
 
   /// The full name of the message: `horus.pb.logs.CalibrationMapNotFound`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `CalibrationMapNotFound`, e.g. to build a `PbFieldMask<CalibrationMapNotFound>`.
+  enum class Field : PbTag {
+    /// Field `path`.
+    kPath = 1,
+  };
+
   // Field `path` (no 1).
   // -----
 
@@ -18947,6 +21540,10 @@ class CalibrationMapNotFound final : public PbMessage {
     return std::move(set_path(std::move(path)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see path()
   CowBytes path_{};
@@ -18995,6 +21592,11 @@ class CalibrationMapNotValid final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -19003,12 +21605,21 @@ class CalibrationMapNotValid final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.CalibrationMapNotValid`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.CalibrationMapNotValid"; }
 
   /// The full name of the message: `horus.pb.logs.CalibrationMapNotValid`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `CalibrationMapNotValid`, e.g. to build a `PbFieldMask<CalibrationMapNotValid>`.
+  enum class Field : PbTag {
+    /// Field `path`.
+    kPath = 1,
+  };
+
   // Field `path` (no 1).
   // -----
 
@@ -19059,6 +21670,10 @@ class CalibrationMapNotValid final : public PbMessage {
     return std::move(set_path(std::move(path)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see path()
   CowBytes path_{};
@@ -19107,6 +21722,11 @@ class CalibrationMapPathAlreadyExists final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -19115,12 +21735,21 @@ class CalibrationMapPathAlreadyExists final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.CalibrationMapPathAlreadyExists`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.CalibrationMapPathAlreadyExists"; }
 
   /// The full name of the message: `horus.pb.logs.CalibrationMapPathAlreadyExists`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `CalibrationMapPathAlreadyExists`, e.g. to build a `PbFieldMask<CalibrationMapPathAlreadyExists>`.
+  enum class Field : PbTag {
+    /// Field `path`.
+    kPath = 1,
+  };
+
   // Field `path` (no 1).
   // -----
 
@@ -19171,6 +21800,10 @@ class CalibrationMapPathAlreadyExists final : public PbMessage {
     return std::move(set_path(std::move(path)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see path()
   CowBytes path_{};
@@ -19219,6 +21852,11 @@ class FailedToSaveCalibrationMap final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -19227,12 +21865,21 @@ class FailedToSaveCalibrationMap final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.FailedToSaveCalibrationMap`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.FailedToSaveCalibrationMap"; }
 
   /// The full name of the message: `horus.pb.logs.FailedToSaveCalibrationMap`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `FailedToSaveCalibrationMap`, e.g. to build a `PbFieldMask<FailedToSaveCalibrationMap>`.
+  enum class Field : PbTag {
+    /// Field `path`.
+    kPath = 1,
+  };
+
   // Field `path` (no 1).
   // -----
 
@@ -19283,6 +21930,10 @@ class FailedToSaveCalibrationMap final : public PbMessage {
     return std::move(set_path(std::move(path)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see path()
   CowBytes path_{};
@@ -19331,6 +21982,11 @@ class FailedToRemoveCalibrationMap final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -19339,12 +21995,21 @@ class FailedToRemoveCalibrationMap final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.FailedToRemoveCalibrationMap`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.FailedToRemoveCalibrationMap"; }
 
   /// The full name of the message: `horus.pb.logs.FailedToRemoveCalibrationMap`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `FailedToRemoveCalibrationMap`, e.g. to build a `PbFieldMask<FailedToRemoveCalibrationMap>`.
+  enum class Field : PbTag {
+    /// Field `path`.
+    kPath = 1,
+  };
+
   // Field `path` (no 1).
   // -----
 
@@ -19395,6 +22060,10 @@ class FailedToRemoveCalibrationMap final : public PbMessage {
     return std::move(set_path(std::move(path)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see path()
   CowBytes path_{};
@@ -19443,6 +22112,11 @@ class FailedToIterateInDirectory final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -19451,12 +22125,25 @@ class FailedToIterateInDirectory final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.FailedToIterateInDirectory`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.FailedToIterateInDirectory"; }
 
   /// The full name of the message: `horus.pb.logs.FailedToIterateInDirectory`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `FailedToIterateInDirectory`, e.g. to build a `PbFieldMask<FailedToIterateInDirectory>`.
+  enum class Field : PbTag {
+    /// Field `directory_name`.
+    kDirectoryName = 1,
+    /// Field `directory_path`.
+    kDirectoryPath = 2,
+    /// Field `details`.
+    kDetails = 3,
+  };
+
   // Field `directory_name` (no 1).
   // -----
 
@@ -19607,6 +22294,10 @@ class FailedToIterateInDirectory final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see directory_name()
   CowBytes directory_name_{};
@@ -19661,6 +22352,9 @@ class MapBasedCalibrationWithoutMapLoading final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -19671,6 +22365,9 @@ class MapBasedCalibrationWithoutMapLoading final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.MapBasedCalibrationWithoutMapLoading`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.MapBasedCalibrationWithoutMapLoading"; }
 
@@ -19725,6 +22422,9 @@ class MapBasedCalibrationAlreadyRunning final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -19735,6 +22435,9 @@ class MapBasedCalibrationAlreadyRunning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.MapBasedCalibrationAlreadyRunning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.MapBasedCalibrationAlreadyRunning"; }
 
@@ -19789,6 +22492,9 @@ class CancelMapBasedCalibrationNotRunning final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -19799,6 +22505,9 @@ class CancelMapBasedCalibrationNotRunning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.CancelMapBasedCalibrationNotRunning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.CancelMapBasedCalibrationNotRunning"; }
 
@@ -19851,6 +22560,11 @@ class BagStreamNotFound final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -19859,12 +22573,23 @@ class BagStreamNotFound final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.BagStreamNotFound`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.BagStreamNotFound"; }
 
   /// The full name of the message: `horus.pb.logs.BagStreamNotFound`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `BagStreamNotFound`, e.g. to build a `PbFieldMask<BagStreamNotFound>`.
+  enum class Field : PbTag {
+    /// Field `bag_path`.
+    kBagPath = 1,
+    /// Field `stream_id`.
+    kStreamId = 2,
+  };
+
   // Field `bag_path` (no 1).
   // -----
 
@@ -19965,6 +22690,10 @@ class BagStreamNotFound final : public PbMessage {
     return std::move(set_stream_id(std::move(stream_id)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see bag_path()
   CowBytes bag_path_{};
@@ -20015,6 +22744,11 @@ class EvaluationBagStartedInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -20023,12 +22757,21 @@ class EvaluationBagStartedInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.EvaluationBagStartedInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.EvaluationBagStartedInfo"; }
 
   /// The full name of the message: `horus.pb.logs.EvaluationBagStartedInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `EvaluationBagStartedInfo`, e.g. to build a `PbFieldMask<EvaluationBagStartedInfo>`.
+  enum class Field : PbTag {
+    /// Field `bag_path`.
+    kBagPath = 1,
+  };
+
   // Field `bag_path` (no 1).
   // -----
 
@@ -20079,6 +22822,10 @@ class EvaluationBagStartedInfo final : public PbMessage {
     return std::move(set_bag_path(std::move(bag_path)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see bag_path()
   CowBytes bag_path_{};
@@ -20127,6 +22874,11 @@ class EvaluationBagFinishedInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -20135,12 +22887,21 @@ class EvaluationBagFinishedInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.EvaluationBagFinishedInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.EvaluationBagFinishedInfo"; }
 
   /// The full name of the message: `horus.pb.logs.EvaluationBagFinishedInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `EvaluationBagFinishedInfo`, e.g. to build a `PbFieldMask<EvaluationBagFinishedInfo>`.
+  enum class Field : PbTag {
+    /// Field `bag_path`.
+    kBagPath = 1,
+  };
+
   // Field `bag_path` (no 1).
   // -----
 
@@ -20191,6 +22952,10 @@ class EvaluationBagFinishedInfo final : public PbMessage {
     return std::move(set_bag_path(std::move(bag_path)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see bag_path()
   CowBytes bag_path_{};
@@ -20239,6 +23004,11 @@ class BagNotFound final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -20247,12 +23017,21 @@ class BagNotFound final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.BagNotFound`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.BagNotFound"; }
 
   /// The full name of the message: `horus.pb.logs.BagNotFound`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `BagNotFound`, e.g. to build a `PbFieldMask<BagNotFound>`.
+  enum class Field : PbTag {
+    /// Field `bag_path`.
+    kBagPath = 1,
+  };
+
   // Field `bag_path` (no 1).
   // -----
 
@@ -20303,6 +23082,10 @@ class BagNotFound final : public PbMessage {
     return std::move(set_bag_path(std::move(bag_path)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see bag_path()
   CowBytes bag_path_{};
@@ -20351,6 +23134,11 @@ class BuildingPipelineInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -20359,12 +23147,21 @@ class BuildingPipelineInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.BuildingPipelineInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.BuildingPipelineInfo"; }
 
   /// The full name of the message: `horus.pb.logs.BuildingPipelineInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `BuildingPipelineInfo`, e.g. to build a `PbFieldMask<BuildingPipelineInfo>`.
+  enum class Field : PbTag {
+    /// Field `pipeline_name`.
+    kPipelineName = 1,
+  };
+
   // Field `pipeline_name` (no 1).
   // -----
 
@@ -20415,6 +23212,10 @@ class BuildingPipelineInfo final : public PbMessage {
     return std::move(set_pipeline_name(std::move(pipeline_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see pipeline_name()
   CowBytes pipeline_name_{};
@@ -20463,6 +23264,11 @@ class BagIsNotEvaluation final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -20471,12 +23277,21 @@ class BagIsNotEvaluation final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.BagIsNotEvaluation`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.BagIsNotEvaluation"; }
 
   /// The full name of the message: `horus.pb.logs.BagIsNotEvaluation`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `BagIsNotEvaluation`, e.g. to build a `PbFieldMask<BagIsNotEvaluation>`.
+  enum class Field : PbTag {
+    /// Field `bag_path`.
+    kBagPath = 1,
+  };
+
   // Field `bag_path` (no 1).
   // -----
 
@@ -20527,6 +23342,10 @@ class BagIsNotEvaluation final : public PbMessage {
     return std::move(set_bag_path(std::move(bag_path)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see bag_path()
   CowBytes bag_path_{};
@@ -20577,6 +23396,9 @@ class HorusBagRunning final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -20587,6 +23409,9 @@ class HorusBagRunning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.HorusBagRunning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.HorusBagRunning"; }
 
@@ -20639,6 +23464,11 @@ class AutoGroundCalibrationWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -20647,12 +23477,21 @@ class AutoGroundCalibrationWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.AutoGroundCalibrationWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.AutoGroundCalibrationWarning"; }
 
   /// The full name of the message: `horus.pb.logs.AutoGroundCalibrationWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `AutoGroundCalibrationWarning`, e.g. to build a `PbFieldMask<AutoGroundCalibrationWarning>`.
+  enum class Field : PbTag {
+    /// Field `failed_lidar_ids`.
+    kFailedLidarIds = 2,
+  };
+
   // Field `failed_lidar_ids` (no 2).
   // -----
 
@@ -20703,6 +23542,10 @@ class AutoGroundCalibrationWarning final : public PbMessage {
     return std::move(set_failed_lidar_ids(std::move(failed_lidar_ids)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see failed_lidar_ids()
   CowBytes failed_lidar_ids_{};
@@ -20753,6 +23596,9 @@ class AutoGroundCalibrationError final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -20763,6 +23609,9 @@ class AutoGroundCalibrationError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.AutoGroundCalibrationError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.AutoGroundCalibrationError"; }
 
@@ -20817,6 +23666,9 @@ class ObjectDetectorNotLoadedWarning final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -20827,6 +23679,9 @@ class ObjectDetectorNotLoadedWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.ObjectDetectorNotLoadedWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ObjectDetectorNotLoadedWarning"; }
 
@@ -20881,6 +23736,9 @@ class CalibrationIsRunningError final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -20891,6 +23749,9 @@ class CalibrationIsRunningError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.CalibrationIsRunningError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.CalibrationIsRunningError"; }
 
@@ -20943,6 +23804,11 @@ class ModelInitInProgressInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -20951,12 +23817,21 @@ class ModelInitInProgressInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ModelInitInProgressInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ModelInitInProgressInfo"; }
 
   /// The full name of the message: `horus.pb.logs.ModelInitInProgressInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ModelInitInProgressInfo`, e.g. to build a `PbFieldMask<ModelInitInProgressInfo>`.
+  enum class Field : PbTag {
+    /// Field `component`.
+    kComponent = 1,
+  };
+
   // Field `component` (no 1).
   // -----
 
@@ -21007,6 +23882,10 @@ class ModelInitInProgressInfo final : public PbMessage {
     return std::move(set_component(std::move(component)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see component()
   CowBytes component_{};
@@ -21055,6 +23934,11 @@ class RpcTimeoutWithResolutionWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -21063,12 +23947,27 @@ class RpcTimeoutWithResolutionWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.RpcTimeoutWithResolutionWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.RpcTimeoutWithResolutionWarning"; }
 
   /// The full name of the message: `horus.pb.logs.RpcTimeoutWithResolutionWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `RpcTimeoutWithResolutionWarning`, e.g. to build a `PbFieldMask<RpcTimeoutWithResolutionWarning>`.
+  enum class Field : PbTag {
+    /// Field `request_name`.
+    kRequestName = 1,
+    /// Field `endpoint`.
+    kEndpoint = 2,
+    /// Field `elapsed`.
+    kElapsed = 3,
+    /// Field `resolution`.
+    kResolution = 4,
+  };
+
   // Field `request_name` (no 1).
   // -----
 
@@ -21175,8 +24074,12 @@ class RpcTimeoutWithResolutionWarning final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 3.
-  constexpr const horus::pb::LogMetadata_Duration& elapsed() const& noexcept HORUS_LIFETIME_BOUND {
-    return elapsed_;
+  ///
+  /// If `elapsed` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `elapsed` was received and is not a valid message.
+  const horus::pb::LogMetadata_Duration& elapsed() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return elapsed_.Ref();
   }
 
   /// If `elapsed` is set, moves it out of the message (without marking it as unset).
@@ -21184,19 +24087,23 @@ class RpcTimeoutWithResolutionWarning final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 3.
-  horus::pb::LogMetadata_Duration elapsed() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `elapsed` was received and is not a valid message.
+  horus::pb::LogMetadata_Duration elapsed() && noexcept(false) {
     if (!set_fields_[2]) {
       return {};
     }
-    return std::move(elapsed_);
+    return std::move(elapsed_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 3.
-  horus::pb::LogMetadata_Duration& mutable_elapsed() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `elapsed` was received and is not a valid message.
+  horus::pb::LogMetadata_Duration& mutable_elapsed() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[2] = true;
-    return elapsed_;
+    return elapsed_.Mutable();
   }
 
   /// Returns whether `elapsed` (no 3) is set.
@@ -21205,13 +24112,13 @@ class RpcTimeoutWithResolutionWarning final : public PbMessage {
   /// Clears `elapsed` (no 3).
   void clear_elapsed() & noexcept {
     set_fields_[2] = false;
-    elapsed_ = {};
+    elapsed_.Clear();
   }
 
   /// Sets `elapsed` (no 3) and returns `*this`.
   RpcTimeoutWithResolutionWarning& set_elapsed(horus::pb::LogMetadata_Duration&& elapsed) & noexcept {
     set_fields_[2] = true;
-    elapsed_ = std::move(elapsed);
+    elapsed_.Set(std::move(elapsed));
     return *this;
   }
   /// Sets `elapsed` (no 3) and returns `*this`.
@@ -21269,13 +24176,17 @@ class RpcTimeoutWithResolutionWarning final : public PbMessage {
     return std::move(set_resolution(std::move(resolution)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see request_name()
   CowBytes request_name_{};
   /// @see endpoint()
   CowBytes endpoint_{};
   /// @see elapsed()
-  horus::pb::LogMetadata_Duration elapsed_{};
+  PbLazy<horus::pb::LogMetadata_Duration> elapsed_{};
   /// @see resolution()
   CowBytes resolution_{};
 
@@ -21323,6 +24234,11 @@ class CalibrationWasCancelledInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -21331,12 +24247,21 @@ class CalibrationWasCancelledInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.CalibrationWasCancelledInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.CalibrationWasCancelledInfo"; }
 
   /// The full name of the message: `horus.pb.logs.CalibrationWasCancelledInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `CalibrationWasCancelledInfo`, e.g. to build a `PbFieldMask<CalibrationWasCancelledInfo>`.
+  enum class Field : PbTag {
+    /// Field `calibration_process_name`.
+    kCalibrationProcessName = 1,
+  };
+
   // Field `calibration_process_name` (no 1).
   // -----
 
@@ -21387,6 +24312,10 @@ class CalibrationWasCancelledInfo final : public PbMessage {
     return std::move(set_calibration_process_name(std::move(calibration_process_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see calibration_process_name()
   CowBytes calibration_process_name_{};
@@ -21435,6 +24364,11 @@ class CalibrationMapRecordingFailedToStart final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -21443,12 +24377,21 @@ class CalibrationMapRecordingFailedToStart final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.CalibrationMapRecordingFailedToStart`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.CalibrationMapRecordingFailedToStart"; }
 
   /// The full name of the message: `horus.pb.logs.CalibrationMapRecordingFailedToStart`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `CalibrationMapRecordingFailedToStart`, e.g. to build a `PbFieldMask<CalibrationMapRecordingFailedToStart>`.
+  enum class Field : PbTag {
+    /// Field `path`.
+    kPath = 1,
+  };
+
   // Field `path` (no 1).
   // -----
 
@@ -21499,6 +24442,10 @@ class CalibrationMapRecordingFailedToStart final : public PbMessage {
     return std::move(set_path(std::move(path)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see path()
   CowBytes path_{};
@@ -21547,6 +24494,11 @@ class DetectionPipelineRequestedResetInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -21555,12 +24507,21 @@ class DetectionPipelineRequestedResetInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.DetectionPipelineRequestedResetInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.DetectionPipelineRequestedResetInfo"; }
 
   /// The full name of the message: `horus.pb.logs.DetectionPipelineRequestedResetInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `DetectionPipelineRequestedResetInfo`, e.g. to build a `PbFieldMask<DetectionPipelineRequestedResetInfo>`.
+  enum class Field : PbTag {
+    /// Field `reason`.
+    kReason = 1,
+  };
+
   // Field `reason` (no 1).
   // -----
 
@@ -21611,6 +24572,10 @@ class DetectionPipelineRequestedResetInfo final : public PbMessage {
     return std::move(set_reason(std::move(reason)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see reason()
   CowBytes reason_{};
@@ -21659,6 +24624,11 @@ class PreprocessingServicePipelineUnavailable final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -21667,12 +24637,21 @@ class PreprocessingServicePipelineUnavailable final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.PreprocessingServicePipelineUnavailable`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.PreprocessingServicePipelineUnavailable"; }
 
   /// The full name of the message: `horus.pb.logs.PreprocessingServicePipelineUnavailable`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `PreprocessingServicePipelineUnavailable`, e.g. to build a `PbFieldMask<PreprocessingServicePipelineUnavailable>`.
+  enum class Field : PbTag {
+    /// Field `reason`.
+    kReason = 1,
+  };
+
   // Field `reason` (no 1).
   // -----
 
@@ -21723,6 +24702,10 @@ class PreprocessingServicePipelineUnavailable final : public PbMessage {
     return std::move(set_reason(std::move(reason)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see reason()
   CowBytes reason_{};
@@ -21771,6 +24754,11 @@ class CircularRecordingDisabledWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -21779,12 +24767,21 @@ class CircularRecordingDisabledWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.CircularRecordingDisabledWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.CircularRecordingDisabledWarning"; }
 
   /// The full name of the message: `horus.pb.logs.CircularRecordingDisabledWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `CircularRecordingDisabledWarning`, e.g. to build a `PbFieldMask<CircularRecordingDisabledWarning>`.
+  enum class Field : PbTag {
+    /// Field `reason`.
+    kReason = 1,
+  };
+
   // Field `reason` (no 1).
   // -----
 
@@ -21835,6 +24832,10 @@ class CircularRecordingDisabledWarning final : public PbMessage {
     return std::move(set_reason(std::move(reason)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see reason()
   CowBytes reason_{};
@@ -21885,6 +24886,9 @@ class SnapshotAlreadyRunningWarning final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -21895,6 +24899,9 @@ class SnapshotAlreadyRunningWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.SnapshotAlreadyRunningWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.SnapshotAlreadyRunningWarning"; }
 
@@ -21949,6 +24956,9 @@ class ActiveProjectChangedInfo final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -21959,6 +24969,9 @@ class ActiveProjectChangedInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.ActiveProjectChangedInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ActiveProjectChangedInfo"; }
 
@@ -22013,6 +25026,9 @@ class ProjectConfigUpdatedInfo final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -22023,6 +25039,9 @@ class ProjectConfigUpdatedInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.ProjectConfigUpdatedInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ProjectConfigUpdatedInfo"; }
 
@@ -22075,6 +25094,11 @@ class InvalidLidarTimestamp final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -22083,12 +25107,25 @@ class InvalidLidarTimestamp final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.InvalidLidarTimestamp`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.InvalidLidarTimestamp"; }
 
   /// The full name of the message: `horus.pb.logs.InvalidLidarTimestamp`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `InvalidLidarTimestamp`, e.g. to build a `PbFieldMask<InvalidLidarTimestamp>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `timestamp`.
+    kTimestamp = 2,
+    /// Field `lidar_name`.
+    kLidarName = 3,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -22145,8 +25182,12 @@ class InvalidLidarTimestamp final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 2.
-  constexpr const horus::pb::LogMetadata_Timestamp& timestamp() const& noexcept HORUS_LIFETIME_BOUND {
-    return timestamp_;
+  ///
+  /// If `timestamp` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `timestamp` was received and is not a valid message.
+  const horus::pb::LogMetadata_Timestamp& timestamp() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return timestamp_.Ref();
   }
 
   /// If `timestamp` is set, moves it out of the message (without marking it as unset).
@@ -22154,19 +25195,23 @@ class InvalidLidarTimestamp final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  horus::pb::LogMetadata_Timestamp timestamp() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `timestamp` was received and is not a valid message.
+  horus::pb::LogMetadata_Timestamp timestamp() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(timestamp_);
+    return std::move(timestamp_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 2.
-  horus::pb::LogMetadata_Timestamp& mutable_timestamp() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `timestamp` was received and is not a valid message.
+  horus::pb::LogMetadata_Timestamp& mutable_timestamp() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return timestamp_;
+    return timestamp_.Mutable();
   }
 
   /// Returns whether `timestamp` (no 2) is set.
@@ -22175,13 +25220,13 @@ class InvalidLidarTimestamp final : public PbMessage {
   /// Clears `timestamp` (no 2).
   void clear_timestamp() & noexcept {
     set_fields_[1] = false;
-    timestamp_ = {};
+    timestamp_.Clear();
   }
 
   /// Sets `timestamp` (no 2) and returns `*this`.
   InvalidLidarTimestamp& set_timestamp(horus::pb::LogMetadata_Timestamp&& timestamp) & noexcept {
     set_fields_[1] = true;
-    timestamp_ = std::move(timestamp);
+    timestamp_.Set(std::move(timestamp));
     return *this;
   }
   /// Sets `timestamp` (no 2) and returns `*this`.
@@ -22239,11 +25284,15 @@ class InvalidLidarTimestamp final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
   /// @see timestamp()
-  horus::pb::LogMetadata_Timestamp timestamp_{};
+  PbLazy<horus::pb::LogMetadata_Timestamp> timestamp_{};
   /// @see lidar_name()
   CowBytes lidar_name_{};
 
@@ -22291,6 +25340,11 @@ class CalibrationAccumulatingPointsInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -22299,20 +25353,33 @@ class CalibrationAccumulatingPointsInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.CalibrationAccumulatingPointsInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.CalibrationAccumulatingPointsInfo"; }
 
   /// The full name of the message: `horus.pb.logs.CalibrationAccumulatingPointsInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `CalibrationAccumulatingPointsInfo`, e.g. to build a `PbFieldMask<CalibrationAccumulatingPointsInfo>`.
+  enum class Field : PbTag {
+    /// Field `time`.
+    kTime = 1,
+  };
+
   // Field `time` (no 1).
   // -----
 
   /// No documentation.
   ///
   /// Field no: 1.
-  constexpr const horus::pb::LogMetadata_Duration& time() const& noexcept HORUS_LIFETIME_BOUND {
-    return time_;
+  ///
+  /// If `time` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `time` was received and is not a valid message.
+  const horus::pb::LogMetadata_Duration& time() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return time_.Ref();
   }
 
   /// If `time` is set, moves it out of the message (without marking it as unset).
@@ -22320,19 +25387,23 @@ class CalibrationAccumulatingPointsInfo final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  horus::pb::LogMetadata_Duration time() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `time` was received and is not a valid message.
+  horus::pb::LogMetadata_Duration time() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(time_);
+    return std::move(time_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 1.
-  horus::pb::LogMetadata_Duration& mutable_time() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `time` was received and is not a valid message.
+  horus::pb::LogMetadata_Duration& mutable_time() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return time_;
+    return time_.Mutable();
   }
 
   /// Returns whether `time` (no 1) is set.
@@ -22341,13 +25412,13 @@ class CalibrationAccumulatingPointsInfo final : public PbMessage {
   /// Clears `time` (no 1).
   void clear_time() & noexcept {
     set_fields_[0] = false;
-    time_ = {};
+    time_.Clear();
   }
 
   /// Sets `time` (no 1) and returns `*this`.
   CalibrationAccumulatingPointsInfo& set_time(horus::pb::LogMetadata_Duration&& time) & noexcept {
     set_fields_[0] = true;
-    time_ = std::move(time);
+    time_.Set(std::move(time));
     return *this;
   }
   /// Sets `time` (no 1) and returns `*this`.
@@ -22355,9 +25426,13 @@ class CalibrationAccumulatingPointsInfo final : public PbMessage {
     return std::move(set_time(std::move(time)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see time()
-  horus::pb::LogMetadata_Duration time_{};
+  PbLazy<horus::pb::LogMetadata_Duration> time_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<1> set_fields_;
@@ -22405,6 +25480,9 @@ class SparseNoiseFilterUsageNonRotationalLidars final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -22415,6 +25493,9 @@ class SparseNoiseFilterUsageNonRotationalLidars final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.SparseNoiseFilterUsageNonRotationalLidars`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.SparseNoiseFilterUsageNonRotationalLidars"; }
 
@@ -22467,6 +25548,11 @@ class FileWriteWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -22475,12 +25561,23 @@ class FileWriteWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.FileWriteWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.FileWriteWarning"; }
 
   /// The full name of the message: `horus.pb.logs.FileWriteWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `FileWriteWarning`, e.g. to build a `PbFieldMask<FileWriteWarning>`.
+  enum class Field : PbTag {
+    /// Field `filename`.
+    kFilename = 1,
+    /// Field `details`.
+    kDetails = 2,
+  };
+
   // Field `filename` (no 1).
   // -----
 
@@ -22581,6 +25678,10 @@ class FileWriteWarning final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see filename()
   CowBytes filename_{};
@@ -22631,6 +25732,11 @@ class LicenseForbiddenFeature final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -22639,12 +25745,21 @@ class LicenseForbiddenFeature final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LicenseForbiddenFeature`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LicenseForbiddenFeature"; }
 
   /// The full name of the message: `horus.pb.logs.LicenseForbiddenFeature`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LicenseForbiddenFeature`, e.g. to build a `PbFieldMask<LicenseForbiddenFeature>`.
+  enum class Field : PbTag {
+    /// Field `feature_name`.
+    kFeatureName = 1,
+  };
+
   // Field `feature_name` (no 1).
   // -----
 
@@ -22695,6 +25810,10 @@ class LicenseForbiddenFeature final : public PbMessage {
     return std::move(set_feature_name(std::move(feature_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see feature_name()
   CowBytes feature_name_{};
@@ -22743,6 +25862,11 @@ class FailedToUpdateConfiguration final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -22751,12 +25875,21 @@ class FailedToUpdateConfiguration final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.FailedToUpdateConfiguration`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.FailedToUpdateConfiguration"; }
 
   /// The full name of the message: `horus.pb.logs.FailedToUpdateConfiguration`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `FailedToUpdateConfiguration`, e.g. to build a `PbFieldMask<FailedToUpdateConfiguration>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -22807,6 +25940,10 @@ class FailedToUpdateConfiguration final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -22857,6 +25994,9 @@ class ObstructionDetectorBadReferenceWarning final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -22867,6 +26007,9 @@ class ObstructionDetectorBadReferenceWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.ObstructionDetectorBadReferenceWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ObstructionDetectorBadReferenceWarning"; }
 
@@ -22919,6 +26062,11 @@ class ProjectFileInvalidPermissionsError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -22927,12 +26075,21 @@ class ProjectFileInvalidPermissionsError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ProjectFileInvalidPermissionsError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ProjectFileInvalidPermissionsError"; }
 
   /// The full name of the message: `horus.pb.logs.ProjectFileInvalidPermissionsError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ProjectFileInvalidPermissionsError`, e.g. to build a `PbFieldMask<ProjectFileInvalidPermissionsError>`.
+  enum class Field : PbTag {
+    /// Field `filename`.
+    kFilename = 1,
+  };
+
   // Field `filename` (no 1).
   // -----
 
@@ -22983,6 +26140,10 @@ class ProjectFileInvalidPermissionsError final : public PbMessage {
     return std::move(set_filename(std::move(filename)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see filename()
   CowBytes filename_{};
@@ -23031,6 +26192,11 @@ class PipelineSchedulerError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -23039,12 +26205,21 @@ class PipelineSchedulerError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.PipelineSchedulerError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.PipelineSchedulerError"; }
 
   /// The full name of the message: `horus.pb.logs.PipelineSchedulerError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `PipelineSchedulerError`, e.g. to build a `PbFieldMask<PipelineSchedulerError>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -23095,6 +26270,10 @@ class PipelineSchedulerError final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -23143,6 +26322,11 @@ class MultiLidarCalibrationWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -23151,12 +26335,21 @@ class MultiLidarCalibrationWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.MultiLidarCalibrationWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.MultiLidarCalibrationWarning"; }
 
   /// The full name of the message: `horus.pb.logs.MultiLidarCalibrationWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `MultiLidarCalibrationWarning`, e.g. to build a `PbFieldMask<MultiLidarCalibrationWarning>`.
+  enum class Field : PbTag {
+    /// Field `failed_lidar_ids`.
+    kFailedLidarIds = 1,
+  };
+
   // Field `failed_lidar_ids` (no 1).
   // -----
 
@@ -23207,6 +26400,10 @@ class MultiLidarCalibrationWarning final : public PbMessage {
     return std::move(set_failed_lidar_ids(std::move(failed_lidar_ids)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see failed_lidar_ids()
   CowBytes failed_lidar_ids_{};
@@ -23257,6 +26454,9 @@ class MultiLidarCalibrationError final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -23267,6 +26467,9 @@ class MultiLidarCalibrationError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.MultiLidarCalibrationError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.MultiLidarCalibrationError"; }
 
@@ -23319,6 +26522,11 @@ class OldBagWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -23327,12 +26535,23 @@ class OldBagWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.OldBagWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.OldBagWarning"; }
 
   /// The full name of the message: `horus.pb.logs.OldBagWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `OldBagWarning`, e.g. to build a `PbFieldMask<OldBagWarning>`.
+  enum class Field : PbTag {
+    /// Field `bag_path`.
+    kBagPath = 1,
+    /// Field `version`.
+    kVersion = 2,
+  };
+
   // Field `bag_path` (no 1).
   // -----
 
@@ -23421,6 +26640,10 @@ class OldBagWarning final : public PbMessage {
     return std::move(set_version(version));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see bag_path()
   CowBytes bag_path_{};
@@ -23471,6 +26694,11 @@ class UpgradingBagInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -23479,12 +26707,21 @@ class UpgradingBagInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.UpgradingBagInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.UpgradingBagInfo"; }
 
   /// The full name of the message: `horus.pb.logs.UpgradingBagInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `UpgradingBagInfo`, e.g. to build a `PbFieldMask<UpgradingBagInfo>`.
+  enum class Field : PbTag {
+    /// Field `bag_path`.
+    kBagPath = 1,
+  };
+
   // Field `bag_path` (no 1).
   // -----
 
@@ -23535,6 +26772,10 @@ class UpgradingBagInfo final : public PbMessage {
     return std::move(set_bag_path(std::move(bag_path)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see bag_path()
   CowBytes bag_path_{};
@@ -23583,6 +26824,11 @@ class BagCalibrationSaveFailed final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -23591,12 +26837,21 @@ class BagCalibrationSaveFailed final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.BagCalibrationSaveFailed`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.BagCalibrationSaveFailed"; }
 
   /// The full name of the message: `horus.pb.logs.BagCalibrationSaveFailed`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `BagCalibrationSaveFailed`, e.g. to build a `PbFieldMask<BagCalibrationSaveFailed>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -23647,6 +26902,10 @@ class BagCalibrationSaveFailed final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -23695,6 +26954,11 @@ class BagUpgradeFailed final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -23703,12 +26967,23 @@ class BagUpgradeFailed final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.BagUpgradeFailed`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.BagUpgradeFailed"; }
 
   /// The full name of the message: `horus.pb.logs.BagUpgradeFailed`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `BagUpgradeFailed`, e.g. to build a `PbFieldMask<BagUpgradeFailed>`.
+  enum class Field : PbTag {
+    /// Field `bag_path`.
+    kBagPath = 1,
+    /// Field `details`.
+    kDetails = 2,
+  };
+
   // Field `bag_path` (no 1).
   // -----
 
@@ -23809,6 +27084,10 @@ class BagUpgradeFailed final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see bag_path()
   CowBytes bag_path_{};
@@ -23859,6 +27138,11 @@ class UnknownLidarError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -23867,12 +27151,23 @@ class UnknownLidarError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.UnknownLidarError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.UnknownLidarError"; }
 
   /// The full name of the message: `horus.pb.logs.UnknownLidarError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `UnknownLidarError`, e.g. to build a `PbFieldMask<UnknownLidarError>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `lidar_name`.
+    kLidarName = 2,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -23973,6 +27268,10 @@ class UnknownLidarError final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -24023,6 +27322,11 @@ class InvalidPointCloudWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -24031,12 +27335,25 @@ class InvalidPointCloudWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.InvalidPointCloudWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.InvalidPointCloudWarning"; }
 
   /// The full name of the message: `horus.pb.logs.InvalidPointCloudWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `InvalidPointCloudWarning`, e.g. to build a `PbFieldMask<InvalidPointCloudWarning>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `reason`.
+    kReason = 2,
+    /// Field `lidar_name`.
+    kLidarName = 3,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -24187,6 +27504,10 @@ class InvalidPointCloudWarning final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -24239,6 +27560,11 @@ class LidarIsDroppingPackets final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -24247,12 +27573,27 @@ class LidarIsDroppingPackets final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LidarIsDroppingPackets`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LidarIsDroppingPackets"; }
 
   /// The full name of the message: `horus.pb.logs.LidarIsDroppingPackets`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LidarIsDroppingPackets`, e.g. to build a `PbFieldMask<LidarIsDroppingPackets>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `num_total_dropped_packets`.
+    kNumTotalDroppedPackets = 2,
+    /// Field `num_total_expected_packets`.
+    kNumTotalExpectedPackets = 3,
+    /// Field `lidar_name`.
+    kLidarName = 4,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -24429,6 +27770,10 @@ class LidarIsDroppingPackets final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -24483,6 +27828,11 @@ class RemovedInvalidLidarsFromConfigWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -24491,12 +27841,21 @@ class RemovedInvalidLidarsFromConfigWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.RemovedInvalidLidarsFromConfigWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.RemovedInvalidLidarsFromConfigWarning"; }
 
   /// The full name of the message: `horus.pb.logs.RemovedInvalidLidarsFromConfigWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `RemovedInvalidLidarsFromConfigWarning`, e.g. to build a `PbFieldMask<RemovedInvalidLidarsFromConfigWarning>`.
+  enum class Field : PbTag {
+    /// Field `backup_path`.
+    kBackupPath = 1,
+  };
+
   // Field `backup_path` (no 1).
   // -----
 
@@ -24547,6 +27906,10 @@ class RemovedInvalidLidarsFromConfigWarning final : public PbMessage {
     return std::move(set_backup_path(std::move(backup_path)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see backup_path()
   CowBytes backup_path_{};
@@ -24595,6 +27958,11 @@ class CalibrationMapRecordingFailed final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -24603,12 +27971,21 @@ class CalibrationMapRecordingFailed final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.CalibrationMapRecordingFailed`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.CalibrationMapRecordingFailed"; }
 
   /// The full name of the message: `horus.pb.logs.CalibrationMapRecordingFailed`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `CalibrationMapRecordingFailed`, e.g. to build a `PbFieldMask<CalibrationMapRecordingFailed>`.
+  enum class Field : PbTag {
+    /// Field `message`.
+    kMessage = 1,
+  };
+
   // Field `message` (no 1).
   // -----
 
@@ -24659,6 +28036,10 @@ class CalibrationMapRecordingFailed final : public PbMessage {
     return std::move(set_message(std::move(message)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see message()
   CowBytes message_{};
@@ -24707,6 +28088,11 @@ class DetectionNodeNotFoundError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -24715,12 +28101,21 @@ class DetectionNodeNotFoundError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.DetectionNodeNotFoundError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.DetectionNodeNotFoundError"; }
 
   /// The full name of the message: `horus.pb.logs.DetectionNodeNotFoundError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `DetectionNodeNotFoundError`, e.g. to build a `PbFieldMask<DetectionNodeNotFoundError>`.
+  enum class Field : PbTag {
+    /// Field `node_name`.
+    kNodeName = 1,
+  };
+
   // Field `node_name` (no 1).
   // -----
 
@@ -24771,6 +28166,10 @@ class DetectionNodeNotFoundError final : public PbMessage {
     return std::move(set_node_name(std::move(node_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see node_name()
   CowBytes node_name_{};
@@ -24819,6 +28218,11 @@ class CreatedVersionBackupInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -24827,12 +28231,25 @@ class CreatedVersionBackupInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.CreatedVersionBackupInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.CreatedVersionBackupInfo"; }
 
   /// The full name of the message: `horus.pb.logs.CreatedVersionBackupInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `CreatedVersionBackupInfo`, e.g. to build a `PbFieldMask<CreatedVersionBackupInfo>`.
+  enum class Field : PbTag {
+    /// Field `old_horus_version`.
+    kOldHorusVersion = 1,
+    /// Field `new_horus_version`.
+    kNewHorusVersion = 2,
+    /// Field `backup_path`.
+    kBackupPath = 3,
+  };
+
   // Field `old_horus_version` (no 1).
   // -----
 
@@ -24983,6 +28400,10 @@ class CreatedVersionBackupInfo final : public PbMessage {
     return std::move(set_backup_path(std::move(backup_path)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see old_horus_version()
   CowBytes old_horus_version_{};
@@ -25035,6 +28456,11 @@ class PlyFileLoadFailedError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -25043,12 +28469,23 @@ class PlyFileLoadFailedError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.PlyFileLoadFailedError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.PlyFileLoadFailedError"; }
 
   /// The full name of the message: `horus.pb.logs.PlyFileLoadFailedError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `PlyFileLoadFailedError`, e.g. to build a `PbFieldMask<PlyFileLoadFailedError>`.
+  enum class Field : PbTag {
+    /// Field `file_path`.
+    kFilePath = 1,
+    /// Field `details`.
+    kDetails = 2,
+  };
+
   // Field `file_path` (no 1).
   // -----
 
@@ -25149,6 +28586,10 @@ class PlyFileLoadFailedError final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see file_path()
   CowBytes file_path_{};
@@ -25199,6 +28640,11 @@ class HesaiDriverLifecycle final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -25207,12 +28653,27 @@ class HesaiDriverLifecycle final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.HesaiDriverLifecycle`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.HesaiDriverLifecycle"; }
 
   /// The full name of the message: `horus.pb.logs.HesaiDriverLifecycle`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `HesaiDriverLifecycle`, e.g. to build a `PbFieldMask<HesaiDriverLifecycle>`.
+  enum class Field : PbTag {
+    /// Field `action`.
+    kAction = 1,
+    /// Field `lidar_id`.
+    kLidarId = 2,
+    /// Field `lidar_name`.
+    kLidarName = 3,
+    /// Field `lidar_type`.
+    kLidarType = 4,
+  };
+
   // Field `action` (no 1).
   // -----
 
@@ -25413,6 +28874,10 @@ class HesaiDriverLifecycle final : public PbMessage {
     return std::move(set_lidar_type(std::move(lidar_type)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see action()
   CowBytes action_{};
@@ -25467,6 +28932,11 @@ class HesaiDriverError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -25475,12 +28945,27 @@ class HesaiDriverError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.HesaiDriverError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.HesaiDriverError"; }
 
   /// The full name of the message: `horus.pb.logs.HesaiDriverError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `HesaiDriverError`, e.g. to build a `PbFieldMask<HesaiDriverError>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+    /// Field `lidar_id`.
+    kLidarId = 2,
+    /// Field `lidar_name`.
+    kLidarName = 3,
+    /// Field `lidar_type`.
+    kLidarType = 4,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -25681,6 +29166,10 @@ class HesaiDriverError final : public PbMessage {
     return std::move(set_lidar_type(std::move(lidar_type)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -25735,6 +29224,11 @@ class HesaiPacketProcessingFailed final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -25743,12 +29237,25 @@ class HesaiPacketProcessingFailed final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.HesaiPacketProcessingFailed`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.HesaiPacketProcessingFailed"; }
 
   /// The full name of the message: `horus.pb.logs.HesaiPacketProcessingFailed`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `HesaiPacketProcessingFailed`, e.g. to build a `PbFieldMask<HesaiPacketProcessingFailed>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `details`.
+    kDetails = 2,
+    /// Field `lidar_name`.
+    kLidarName = 3,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -25899,6 +29406,10 @@ class HesaiPacketProcessingFailed final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -25951,6 +29462,11 @@ class HesaiCorrectionFileError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -25959,12 +29475,29 @@ class HesaiCorrectionFileError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.HesaiCorrectionFileError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.HesaiCorrectionFileError"; }
 
   /// The full name of the message: `horus.pb.logs.HesaiCorrectionFileError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `HesaiCorrectionFileError`, e.g. to build a `PbFieldMask<HesaiCorrectionFileError>`.
+  enum class Field : PbTag {
+    /// Field `file_type`.
+    kFileType = 1,
+    /// Field `details`.
+    kDetails = 2,
+    /// Field `lidar_id`.
+    kLidarId = 3,
+    /// Field `lidar_name`.
+    kLidarName = 4,
+    /// Field `lidar_type`.
+    kLidarType = 5,
+  };
+
   // Field `file_type` (no 1).
   // -----
 
@@ -26215,6 +29748,10 @@ class HesaiCorrectionFileError final : public PbMessage {
     return std::move(set_lidar_type(std::move(lidar_type)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see file_type()
   CowBytes file_type_{};
@@ -26271,6 +29808,11 @@ class HesaiPacketStatistics final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -26279,12 +29821,33 @@ class HesaiPacketStatistics final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.HesaiPacketStatistics`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.HesaiPacketStatistics"; }
 
   /// The full name of the message: `horus.pb.logs.HesaiPacketStatistics`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `HesaiPacketStatistics`, e.g. to build a `PbFieldMask<HesaiPacketStatistics>`.
+  enum class Field : PbTag {
+    /// Field `packets_received`.
+    kPacketsReceived = 1,
+    /// Field `packets_published`.
+    kPacketsPublished = 2,
+    /// Field `packets_dropped`.
+    kPacketsDropped = 3,
+    /// Field `packets_decode_failed`.
+    kPacketsDecodeFailed = 4,
+    /// Field `success_rate`.
+    kSuccessRate = 5,
+    /// Field `lidar_id`.
+    kLidarId = 6,
+    /// Field `lidar_name`.
+    kLidarName = 7,
+  };
+
   // Field `packets_received` (no 1).
   // -----
 
@@ -26575,6 +30138,10 @@ class HesaiPacketStatistics final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see packets_received()
   std::uint64_t packets_received_{};
@@ -26635,6 +30202,11 @@ class PlyFileWriteFailedError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -26643,12 +30215,23 @@ class PlyFileWriteFailedError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.PlyFileWriteFailedError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.PlyFileWriteFailedError"; }
 
   /// The full name of the message: `horus.pb.logs.PlyFileWriteFailedError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `PlyFileWriteFailedError`, e.g. to build a `PbFieldMask<PlyFileWriteFailedError>`.
+  enum class Field : PbTag {
+    /// Field `file_path`.
+    kFilePath = 1,
+    /// Field `details`.
+    kDetails = 2,
+  };
+
   // Field `file_path` (no 1).
   // -----
 
@@ -26749,6 +30332,10 @@ class PlyFileWriteFailedError final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see file_path()
   CowBytes file_path_{};
@@ -26799,6 +30386,11 @@ class ProjectSaveError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -26807,12 +30399,21 @@ class ProjectSaveError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ProjectSaveError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ProjectSaveError"; }
 
   /// The full name of the message: `horus.pb.logs.ProjectSaveError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ProjectSaveError`, e.g. to build a `PbFieldMask<ProjectSaveError>`.
+  enum class Field : PbTag {
+    /// Field `error_message`.
+    kErrorMessage = 1,
+  };
+
   // Field `error_message` (no 1).
   // -----
 
@@ -26863,6 +30464,10 @@ class ProjectSaveError final : public PbMessage {
     return std::move(set_error_message(std::move(error_message)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see error_message()
   CowBytes error_message_{};
@@ -26913,6 +30518,9 @@ class SaveStaticEnvironmentSuccess final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -26923,6 +30531,9 @@ class SaveStaticEnvironmentSuccess final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.SaveStaticEnvironmentSuccess`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.SaveStaticEnvironmentSuccess"; }
 
@@ -26975,6 +30586,11 @@ class SaveStaticEnvironmentFailed final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -26983,12 +30599,21 @@ class SaveStaticEnvironmentFailed final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.SaveStaticEnvironmentFailed`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.SaveStaticEnvironmentFailed"; }
 
   /// The full name of the message: `horus.pb.logs.SaveStaticEnvironmentFailed`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `SaveStaticEnvironmentFailed`, e.g. to build a `PbFieldMask<SaveStaticEnvironmentFailed>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -27039,6 +30664,10 @@ class SaveStaticEnvironmentFailed final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -27089,6 +30718,9 @@ class LoadStaticEnvironmentSuccess final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -27099,6 +30731,9 @@ class LoadStaticEnvironmentSuccess final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.LoadStaticEnvironmentSuccess`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LoadStaticEnvironmentSuccess"; }
 
@@ -27151,6 +30786,11 @@ class LoadStaticEnvironmentFailed final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -27159,12 +30799,21 @@ class LoadStaticEnvironmentFailed final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LoadStaticEnvironmentFailed`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LoadStaticEnvironmentFailed"; }
 
   /// The full name of the message: `horus.pb.logs.LoadStaticEnvironmentFailed`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LoadStaticEnvironmentFailed`, e.g. to build a `PbFieldMask<LoadStaticEnvironmentFailed>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -27215,6 +30864,10 @@ class LoadStaticEnvironmentFailed final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -27263,6 +30916,11 @@ class AttemptToInjectInvalidLidarIdWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -27271,12 +30929,21 @@ class AttemptToInjectInvalidLidarIdWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.AttemptToInjectInvalidLidarIdWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.AttemptToInjectInvalidLidarIdWarning"; }
 
   /// The full name of the message: `horus.pb.logs.AttemptToInjectInvalidLidarIdWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `AttemptToInjectInvalidLidarIdWarning`, e.g. to build a `PbFieldMask<AttemptToInjectInvalidLidarIdWarning>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -27327,6 +30994,10 @@ class AttemptToInjectInvalidLidarIdWarning final : public PbMessage {
     return std::move(set_lidar_id(std::move(lidar_id)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -27375,6 +31046,11 @@ class ResetBundledPacketDueToUnexpectedPacket final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -27383,12 +31059,23 @@ class ResetBundledPacketDueToUnexpectedPacket final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ResetBundledPacketDueToUnexpectedPacket`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ResetBundledPacketDueToUnexpectedPacket"; }
 
   /// The full name of the message: `horus.pb.logs.ResetBundledPacketDueToUnexpectedPacket`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ResetBundledPacketDueToUnexpectedPacket`, e.g. to build a `PbFieldMask<ResetBundledPacketDueToUnexpectedPacket>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `lidar_name`.
+    kLidarName = 2,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -27489,6 +31176,10 @@ class ResetBundledPacketDueToUnexpectedPacket final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -27539,6 +31230,11 @@ class PacketBundlerDroppedPacketsWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -27547,12 +31243,27 @@ class PacketBundlerDroppedPacketsWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.PacketBundlerDroppedPacketsWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.PacketBundlerDroppedPacketsWarning"; }
 
   /// The full name of the message: `horus.pb.logs.PacketBundlerDroppedPacketsWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `PacketBundlerDroppedPacketsWarning`, e.g. to build a `PbFieldMask<PacketBundlerDroppedPacketsWarning>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `num_dropped`.
+    kNumDropped = 2,
+    /// Field `duration`.
+    kDuration = 3,
+    /// Field `lidar_name`.
+    kLidarName = 4,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -27647,8 +31358,12 @@ class PacketBundlerDroppedPacketsWarning final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 3.
-  constexpr const horus::pb::LogMetadata_Duration& duration() const& noexcept HORUS_LIFETIME_BOUND {
-    return duration_;
+  ///
+  /// If `duration` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `duration` was received and is not a valid message.
+  const horus::pb::LogMetadata_Duration& duration() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return duration_.Ref();
   }
 
   /// If `duration` is set, moves it out of the message (without marking it as unset).
@@ -27656,19 +31371,23 @@ class PacketBundlerDroppedPacketsWarning final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 3.
-  horus::pb::LogMetadata_Duration duration() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `duration` was received and is not a valid message.
+  horus::pb::LogMetadata_Duration duration() && noexcept(false) {
     if (!set_fields_[2]) {
       return {};
     }
-    return std::move(duration_);
+    return std::move(duration_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 3.
-  horus::pb::LogMetadata_Duration& mutable_duration() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `duration` was received and is not a valid message.
+  horus::pb::LogMetadata_Duration& mutable_duration() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[2] = true;
-    return duration_;
+    return duration_.Mutable();
   }
 
   /// Returns whether `duration` (no 3) is set.
@@ -27677,13 +31396,13 @@ class PacketBundlerDroppedPacketsWarning final : public PbMessage {
   /// Clears `duration` (no 3).
   void clear_duration() & noexcept {
     set_fields_[2] = false;
-    duration_ = {};
+    duration_.Clear();
   }
 
   /// Sets `duration` (no 3) and returns `*this`.
   PacketBundlerDroppedPacketsWarning& set_duration(horus::pb::LogMetadata_Duration&& duration) & noexcept {
     set_fields_[2] = true;
-    duration_ = std::move(duration);
+    duration_.Set(std::move(duration));
     return *this;
   }
   /// Sets `duration` (no 3) and returns `*this`.
@@ -27741,13 +31460,17 @@ class PacketBundlerDroppedPacketsWarning final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
   /// @see num_dropped()
   std::uint64_t num_dropped_{};
   /// @see duration()
-  horus::pb::LogMetadata_Duration duration_{};
+  PbLazy<horus::pb::LogMetadata_Duration> duration_{};
   /// @see lidar_name()
   CowBytes lidar_name_{};
 
@@ -27795,6 +31518,11 @@ class PacketBundlerFrameJumpWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -27803,12 +31531,27 @@ class PacketBundlerFrameJumpWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.PacketBundlerFrameJumpWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.PacketBundlerFrameJumpWarning"; }
 
   /// The full name of the message: `horus.pb.logs.PacketBundlerFrameJumpWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `PacketBundlerFrameJumpWarning`, e.g. to build a `PbFieldMask<PacketBundlerFrameJumpWarning>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `frame_id`.
+    kFrameId = 2,
+    /// Field `next_frame_id`.
+    kNextFrameId = 3,
+    /// Field `lidar_name`.
+    kLidarName = 4,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -27985,6 +31728,10 @@ class PacketBundlerFrameJumpWarning final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -28039,6 +31786,11 @@ class LidarCorrectionLoadingSuccess final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -28047,12 +31799,25 @@ class LidarCorrectionLoadingSuccess final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LidarCorrectionLoadingSuccess`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LidarCorrectionLoadingSuccess"; }
 
   /// The full name of the message: `horus.pb.logs.LidarCorrectionLoadingSuccess`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LidarCorrectionLoadingSuccess`, e.g. to build a `PbFieldMask<LidarCorrectionLoadingSuccess>`.
+  enum class Field : PbTag {
+    /// Field `correction_type`.
+    kCorrectionType = 1,
+    /// Field `lidar_id`.
+    kLidarId = 2,
+    /// Field `lidar_name`.
+    kLidarName = 3,
+  };
+
   // Field `correction_type` (no 1).
   // -----
 
@@ -28203,6 +31968,10 @@ class LidarCorrectionLoadingSuccess final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see correction_type()
   CowBytes correction_type_{};
@@ -28255,6 +32024,11 @@ class LidarCorrectionLoadingFailure final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -28263,12 +32037,27 @@ class LidarCorrectionLoadingFailure final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LidarCorrectionLoadingFailure`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LidarCorrectionLoadingFailure"; }
 
   /// The full name of the message: `horus.pb.logs.LidarCorrectionLoadingFailure`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LidarCorrectionLoadingFailure`, e.g. to build a `PbFieldMask<LidarCorrectionLoadingFailure>`.
+  enum class Field : PbTag {
+    /// Field `correction_type`.
+    kCorrectionType = 1,
+    /// Field `details`.
+    kDetails = 2,
+    /// Field `lidar_id`.
+    kLidarId = 3,
+    /// Field `lidar_name`.
+    kLidarName = 4,
+  };
+
   // Field `correction_type` (no 1).
   // -----
 
@@ -28469,6 +32258,10 @@ class LidarCorrectionLoadingFailure final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see correction_type()
   CowBytes correction_type_{};
@@ -28523,6 +32316,11 @@ class HesaiPacketStatisticsLidar final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -28531,12 +32329,31 @@ class HesaiPacketStatisticsLidar final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.HesaiPacketStatisticsLidar`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.HesaiPacketStatisticsLidar"; }
 
   /// The full name of the message: `horus.pb.logs.HesaiPacketStatisticsLidar`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `HesaiPacketStatisticsLidar`, e.g. to build a `PbFieldMask<HesaiPacketStatisticsLidar>`.
+  enum class Field : PbTag {
+    /// Field `packets_received`.
+    kPacketsReceived = 1,
+    /// Field `packets_published`.
+    kPacketsPublished = 2,
+    /// Field `packets_dropped`.
+    kPacketsDropped = 3,
+    /// Field `packets_decode_failed`.
+    kPacketsDecodeFailed = 4,
+    /// Field `success_rate`.
+    kSuccessRate = 5,
+    /// Field `lidar_id`.
+    kLidarId = 6,
+  };
+
   // Field `packets_received` (no 1).
   // -----
 
@@ -28777,6 +32594,10 @@ class HesaiPacketStatisticsLidar final : public PbMessage {
     return std::move(set_lidar_id(std::move(lidar_id)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see packets_received()
   std::uint64_t packets_received_{};
@@ -28835,6 +32656,11 @@ class LidarTiltDetectionAlignedToCalibrationMapInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -28843,12 +32669,23 @@ class LidarTiltDetectionAlignedToCalibrationMapInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LidarTiltDetectionAlignedToCalibrationMapInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LidarTiltDetectionAlignedToCalibrationMapInfo"; }
 
   /// The full name of the message: `horus.pb.logs.LidarTiltDetectionAlignedToCalibrationMapInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LidarTiltDetectionAlignedToCalibrationMapInfo`, e.g. to build a `PbFieldMask<LidarTiltDetectionAlignedToCalibrationMapInfo>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `lidar_name`.
+    kLidarName = 2,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -28949,6 +32786,10 @@ class LidarTiltDetectionAlignedToCalibrationMapInfo final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -28999,6 +32840,11 @@ class LidarTiltDetectionMisalignedToCalibrationMapWarning final : public PbMessa
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -29007,12 +32853,27 @@ class LidarTiltDetectionMisalignedToCalibrationMapWarning final : public PbMessa
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.LidarTiltDetectionMisalignedToCalibrationMapWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LidarTiltDetectionMisalignedToCalibrationMapWarning"; }
 
   /// The full name of the message: `horus.pb.logs.LidarTiltDetectionMisalignedToCalibrationMapWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LidarTiltDetectionMisalignedToCalibrationMapWarning`, e.g. to build a `PbFieldMask<LidarTiltDetectionMisalignedToCalibrationMapWarning>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `lidar_name`.
+    kLidarName = 2,
+    /// Field `angle`.
+    kAngle = 3,
+    /// Field `distance`.
+    kDistance = 4,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -29189,6 +33050,10 @@ class LidarTiltDetectionMisalignedToCalibrationMapWarning final : public PbMessa
     return std::move(set_distance(distance));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -29245,6 +33110,9 @@ class LidarOriginalPoseDiffersForAutoCorrectionError final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -29255,6 +33123,9 @@ class LidarOriginalPoseDiffersForAutoCorrectionError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.logs.LidarOriginalPoseDiffersForAutoCorrectionError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.LidarOriginalPoseDiffersForAutoCorrectionError"; }
 
@@ -29307,6 +33178,11 @@ class RecoveredCarIdsInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -29315,12 +33191,21 @@ class RecoveredCarIdsInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.RecoveredCarIdsInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.RecoveredCarIdsInfo"; }
 
   /// The full name of the message: `horus.pb.logs.RecoveredCarIdsInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `RecoveredCarIdsInfo`, e.g. to build a `PbFieldMask<RecoveredCarIdsInfo>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -29371,6 +33256,10 @@ class RecoveredCarIdsInfo final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -29419,6 +33308,11 @@ class FailedToRecoverCarIds final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -29427,12 +33321,21 @@ class FailedToRecoverCarIds final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.FailedToRecoverCarIds`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.FailedToRecoverCarIds"; }
 
   /// The full name of the message: `horus.pb.logs.FailedToRecoverCarIds`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `FailedToRecoverCarIds`, e.g. to build a `PbFieldMask<FailedToRecoverCarIds>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -29483,6 +33386,10 @@ class FailedToRecoverCarIds final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -29531,6 +33438,11 @@ class FailedToEmplaceRecoveredCarId final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -29539,12 +33451,21 @@ class FailedToEmplaceRecoveredCarId final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.FailedToEmplaceRecoveredCarId`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.FailedToEmplaceRecoveredCarId"; }
 
   /// The full name of the message: `horus.pb.logs.FailedToEmplaceRecoveredCarId`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `FailedToEmplaceRecoveredCarId`, e.g. to build a `PbFieldMask<FailedToEmplaceRecoveredCarId>`.
+  enum class Field : PbTag {
+    /// Field `object_id`.
+    kObjectId = 1,
+  };
+
   // Field `object_id` (no 1).
   // -----
 
@@ -29583,6 +33504,10 @@ class FailedToEmplaceRecoveredCarId final : public PbMessage {
     return std::move(set_object_id(object_id));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see object_id()
   std::uint64_t object_id_{};
@@ -29631,6 +33556,11 @@ class PersistentStorageError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -29639,12 +33569,23 @@ class PersistentStorageError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.PersistentStorageError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.PersistentStorageError"; }
 
   /// The full name of the message: `horus.pb.logs.PersistentStorageError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `PersistentStorageError`, e.g. to build a `PbFieldMask<PersistentStorageError>`.
+  enum class Field : PbTag {
+    /// Field `operation`.
+    kOperation = 1,
+    /// Field `filepath`.
+    kFilepath = 2,
+  };
+
   // Field `operation` (no 1).
   // -----
 
@@ -29745,6 +33686,10 @@ class PersistentStorageError final : public PbMessage {
     return std::move(set_filepath(std::move(filepath)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see operation()
   CowBytes operation_{};
@@ -29795,6 +33740,11 @@ class TrackCapacityExceededWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -29803,12 +33753,23 @@ class TrackCapacityExceededWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.TrackCapacityExceededWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.TrackCapacityExceededWarning"; }
 
   /// The full name of the message: `horus.pb.logs.TrackCapacityExceededWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `TrackCapacityExceededWarning`, e.g. to build a `PbFieldMask<TrackCapacityExceededWarning>`.
+  enum class Field : PbTag {
+    /// Field `attempted_count`.
+    kAttemptedCount = 1,
+    /// Field `max_tracks`.
+    kMaxTracks = 2,
+  };
+
   // Field `attempted_count` (no 1).
   // -----
 
@@ -29885,6 +33846,10 @@ class TrackCapacityExceededWarning final : public PbMessage {
     return std::move(set_max_tracks(max_tracks));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see attempted_count()
   std::uint64_t attempted_count_{};
@@ -29935,6 +33900,11 @@ class TrackerStatePathUnavailableWarning final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -29943,12 +33913,21 @@ class TrackerStatePathUnavailableWarning final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.TrackerStatePathUnavailableWarning`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.TrackerStatePathUnavailableWarning"; }
 
   /// The full name of the message: `horus.pb.logs.TrackerStatePathUnavailableWarning`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `TrackerStatePathUnavailableWarning`, e.g. to build a `PbFieldMask<TrackerStatePathUnavailableWarning>`.
+  enum class Field : PbTag {
+    /// Field `project_name`.
+    kProjectName = 1,
+  };
+
   // Field `project_name` (no 1).
   // -----
 
@@ -29999,6 +33978,10 @@ class TrackerStatePathUnavailableWarning final : public PbMessage {
     return std::move(set_project_name(std::move(project_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see project_name()
   CowBytes project_name_{};
@@ -30047,6 +34030,11 @@ class TrackerStateRecoveryError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -30055,12 +34043,21 @@ class TrackerStateRecoveryError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.TrackerStateRecoveryError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.TrackerStateRecoveryError"; }
 
   /// The full name of the message: `horus.pb.logs.TrackerStateRecoveryError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `TrackerStateRecoveryError`, e.g. to build a `PbFieldMask<TrackerStateRecoveryError>`.
+  enum class Field : PbTag {
+    /// Field `error_message`.
+    kErrorMessage = 1,
+  };
+
   // Field `error_message` (no 1).
   // -----
 
@@ -30111,6 +34108,10 @@ class TrackerStateRecoveryError final : public PbMessage {
     return std::move(set_error_message(std::move(error_message)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see error_message()
   CowBytes error_message_{};
@@ -30159,6 +34160,11 @@ class TrackerStateSaveError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -30167,12 +34173,21 @@ class TrackerStateSaveError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.TrackerStateSaveError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.TrackerStateSaveError"; }
 
   /// The full name of the message: `horus.pb.logs.TrackerStateSaveError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `TrackerStateSaveError`, e.g. to build a `PbFieldMask<TrackerStateSaveError>`.
+  enum class Field : PbTag {
+    /// Field `error_message`.
+    kErrorMessage = 1,
+  };
+
   // Field `error_message` (no 1).
   // -----
 
@@ -30223,6 +34238,10 @@ class TrackerStateSaveError final : public PbMessage {
     return std::move(set_error_message(std::move(error_message)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see error_message()
   CowBytes error_message_{};
@@ -30271,6 +34290,11 @@ class TrackerIdRecoveryFailedError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -30279,12 +34303,23 @@ class TrackerIdRecoveryFailedError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.TrackerIdRecoveryFailedError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.TrackerIdRecoveryFailedError"; }
 
   /// The full name of the message: `horus.pb.logs.TrackerIdRecoveryFailedError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `TrackerIdRecoveryFailedError`, e.g. to build a `PbFieldMask<TrackerIdRecoveryFailedError>`.
+  enum class Field : PbTag {
+    /// Field `id`.
+    kId = 1,
+    /// Field `error_message`.
+    kErrorMessage = 2,
+  };
+
   // Field `id` (no 1).
   // -----
 
@@ -30373,6 +34408,10 @@ class TrackerIdRecoveryFailedError final : public PbMessage {
     return std::move(set_error_message(std::move(error_message)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see id()
   std::uint64_t id_{};
@@ -30423,6 +34462,11 @@ class TrackerIdFastForwardFailedError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -30431,12 +34475,23 @@ class TrackerIdFastForwardFailedError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.TrackerIdFastForwardFailedError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.TrackerIdFastForwardFailedError"; }
 
   /// The full name of the message: `horus.pb.logs.TrackerIdFastForwardFailedError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `TrackerIdFastForwardFailedError`, e.g. to build a `PbFieldMask<TrackerIdFastForwardFailedError>`.
+  enum class Field : PbTag {
+    /// Field `target_id`.
+    kTargetId = 1,
+    /// Field `error_message`.
+    kErrorMessage = 2,
+  };
+
   // Field `target_id` (no 1).
   // -----
 
@@ -30525,6 +34580,10 @@ class TrackerIdFastForwardFailedError final : public PbMessage {
     return std::move(set_error_message(std::move(error_message)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see target_id()
   std::uint64_t target_id_{};
@@ -30575,6 +34634,11 @@ class CircularRecordingSnapshotCreated final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -30583,12 +34647,25 @@ class CircularRecordingSnapshotCreated final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.CircularRecordingSnapshotCreated`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.CircularRecordingSnapshotCreated"; }
 
   /// The full name of the message: `horus.pb.logs.CircularRecordingSnapshotCreated`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `CircularRecordingSnapshotCreated`, e.g. to build a `PbFieldMask<CircularRecordingSnapshotCreated>`.
+  enum class Field : PbTag {
+    /// Field `message_count`.
+    kMessageCount = 1,
+    /// Field `actual_duration_seconds`.
+    kActualDurationSeconds = 2,
+    /// Field `max_buffer_duration_seconds`.
+    kMaxBufferDurationSeconds = 3,
+  };
+
   // Field `message_count` (no 1).
   // -----
 
@@ -30703,6 +34780,10 @@ class CircularRecordingSnapshotCreated final : public PbMessage {
     return std::move(set_max_buffer_duration_seconds(max_buffer_duration_seconds));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see message_count()
   std::uint64_t message_count_{};
@@ -30755,6 +34836,11 @@ class CircularRecordingFileOperationError final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -30763,12 +34849,25 @@ class CircularRecordingFileOperationError final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.CircularRecordingFileOperationError`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.CircularRecordingFileOperationError"; }
 
   /// The full name of the message: `horus.pb.logs.CircularRecordingFileOperationError`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `CircularRecordingFileOperationError`, e.g. to build a `PbFieldMask<CircularRecordingFileOperationError>`.
+  enum class Field : PbTag {
+    /// Field `operation`.
+    kOperation = 1,
+    /// Field `file_path`.
+    kFilePath = 2,
+    /// Field `details`.
+    kDetails = 3,
+  };
+
   // Field `operation` (no 1).
   // -----
 
@@ -30919,6 +35018,10 @@ class CircularRecordingFileOperationError final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see operation()
   CowBytes operation_{};
@@ -30971,6 +35074,11 @@ class ObjectIdRecoveryRejectedInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -30979,12 +35087,23 @@ class ObjectIdRecoveryRejectedInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ObjectIdRecoveryRejectedInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ObjectIdRecoveryRejectedInfo"; }
 
   /// The full name of the message: `horus.pb.logs.ObjectIdRecoveryRejectedInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ObjectIdRecoveryRejectedInfo`, e.g. to build a `PbFieldMask<ObjectIdRecoveryRejectedInfo>`.
+  enum class Field : PbTag {
+    /// Field `id`.
+    kId = 1,
+    /// Field `reason`.
+    kReason = 2,
+  };
+
   // Field `id` (no 1).
   // -----
 
@@ -31073,6 +35192,10 @@ class ObjectIdRecoveryRejectedInfo final : public PbMessage {
     return std::move(set_reason(std::move(reason)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see id()
   std::uint64_t id_{};
@@ -31123,6 +35246,11 @@ class ExpiredRecoveryIdsInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -31131,12 +35259,21 @@ class ExpiredRecoveryIdsInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ExpiredRecoveryIdsInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ExpiredRecoveryIdsInfo"; }
 
   /// The full name of the message: `horus.pb.logs.ExpiredRecoveryIdsInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ExpiredRecoveryIdsInfo`, e.g. to build a `PbFieldMask<ExpiredRecoveryIdsInfo>`.
+  enum class Field : PbTag {
+    /// Field `expired_ids`.
+    kExpiredIds = 1,
+  };
+
   // Field `expired_ids` (no 1).
   // -----
 
@@ -31187,6 +35324,10 @@ class ExpiredRecoveryIdsInfo final : public PbMessage {
     return std::move(set_expired_ids(std::move(expired_ids)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see expired_ids()
   CowBytes expired_ids_{};
@@ -31235,6 +35376,11 @@ class HesaiUdpReceiverInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -31243,12 +35389,25 @@ class HesaiUdpReceiverInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.HesaiUdpReceiverInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.HesaiUdpReceiverInfo"; }
 
   /// The full name of the message: `horus.pb.logs.HesaiUdpReceiverInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `HesaiUdpReceiverInfo`, e.g. to build a `PbFieldMask<HesaiUdpReceiverInfo>`.
+  enum class Field : PbTag {
+    /// Field `action`.
+    kAction = 1,
+    /// Field `lidar_id`.
+    kLidarId = 2,
+    /// Field `lidar_name`.
+    kLidarName = 3,
+  };
+
   // Field `action` (no 1).
   // -----
 
@@ -31399,6 +35558,10 @@ class HesaiUdpReceiverInfo final : public PbMessage {
     return std::move(set_lidar_name(std::move(lidar_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see action()
   CowBytes action_{};
@@ -31451,6 +35614,11 @@ class DbCommitFailed final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -31459,12 +35627,23 @@ class DbCommitFailed final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.DbCommitFailed`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.DbCommitFailed"; }
 
   /// The full name of the message: `horus.pb.logs.DbCommitFailed`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `DbCommitFailed`, e.g. to build a `PbFieldMask<DbCommitFailed>`.
+  enum class Field : PbTag {
+    /// Field `action`.
+    kAction = 1,
+    /// Field `error`.
+    kError = 2,
+  };
+
   // Field `action` (no 1).
   // -----
 
@@ -31565,6 +35744,10 @@ class DbCommitFailed final : public PbMessage {
     return std::move(set_error(std::move(error)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see action()
   CowBytes action_{};
@@ -31615,6 +35798,11 @@ class DetectionServiceRpcQueueFull final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -31623,12 +35811,25 @@ class DetectionServiceRpcQueueFull final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.DetectionServiceRpcQueueFull`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.DetectionServiceRpcQueueFull"; }
 
   /// The full name of the message: `horus.pb.logs.DetectionServiceRpcQueueFull`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `DetectionServiceRpcQueueFull`, e.g. to build a `PbFieldMask<DetectionServiceRpcQueueFull>`.
+  enum class Field : PbTag {
+    /// Field `num_packets`.
+    kNumPackets = 1,
+    /// Field `queue_size`.
+    kQueueSize = 2,
+    /// Field `node_id`.
+    kNodeId = 3,
+  };
+
   // Field `num_packets` (no 1).
   // -----
 
@@ -31755,6 +35956,10 @@ class DetectionServiceRpcQueueFull final : public PbMessage {
     return std::move(set_node_id(std::move(node_id)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see num_packets()
   std::uint64_t num_packets_{};
@@ -31807,6 +36012,11 @@ class ProjectMigrationFailed final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -31815,12 +36025,21 @@ class ProjectMigrationFailed final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.logs.ProjectMigrationFailed`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.logs.ProjectMigrationFailed"; }
 
   /// The full name of the message: `horus.pb.logs.ProjectMigrationFailed`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ProjectMigrationFailed`, e.g. to build a `PbFieldMask<ProjectMigrationFailed>`.
+  enum class Field : PbTag {
+    /// Field `details`.
+    kDetails = 1,
+  };
+
   // Field `details` (no 1).
   // -----
 
@@ -31871,6 +36090,10 @@ class ProjectMigrationFailed final : public PbMessage {
     return std::move(set_details(std::move(details)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details()
   CowBytes details_{};
@@ -1,6 +1,9 @@
 #include "horus/pb/logs/message_pb.h"
 
+#include <cstddef>
+
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 
 namespace horus {
 namespace sdk {
@@ -237,2277 +240,21 @@ LogData::LogData(const LogData& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void LogData::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<logs::Generic>(writer, /*tag=*/ 1, generic_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<logs::Oom>(writer, /*tag=*/ 2, oom_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<logs::RpcConnectionError>(writer, /*tag=*/ 3, rpc_connection_error_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<logs::InvalidProjectName>(writer, /*tag=*/ 4, invalid_project_name_);
-  }
-  if (set_fields_[4]) {
-    SerializeField<logs::ProjectNotFound>(writer, /*tag=*/ 5, project_not_found_);
-  }
-  if (set_fields_[5]) {
-    SerializeField<logs::ProjectAlreadyExists>(writer, /*tag=*/ 6, project_already_exists_);
-  }
-  if (set_fields_[6]) {
-    SerializeField<logs::InvalidConfiguration>(writer, /*tag=*/ 7, invalid_configuration_);
-  }
-  if (set_fields_[7]) {
-    SerializeField<logs::EntityNotFound>(writer, /*tag=*/ 8, entity_not_found_);
-  }
-  if (set_fields_[8]) {
-    SerializeField<logs::ActiveProjectCannotBeDeleted>(writer, /*tag=*/ 9, active_project_cannot_be_deleted_);
-  }
-  if (set_fields_[9]) {
-    SerializeField<logs::RpcDisconnectionError>(writer, /*tag=*/ 10, rpc_disconnection_error_);
-  }
-  if (set_fields_[10]) {
-    SerializeField<logs::DroppedLogs>(writer, /*tag=*/ 11, dropped_logs_);
-  }
-  if (set_fields_[11]) {
-    SerializeField<logs::OpenedProject>(writer, /*tag=*/ 12, opened_project_);
-  }
-  if (set_fields_[12]) {
-    SerializeField<logs::CreatedProject>(writer, /*tag=*/ 13, created_project_);
-  }
-  if (set_fields_[13]) {
-    SerializeField<logs::ConfigUnavailable>(writer, /*tag=*/ 14, config_unavailable_);
-  }
-  if (set_fields_[14]) {
-    SerializeField<logs::InvalidRequest>(writer, /*tag=*/ 15, invalid_request_);
-  }
-  if (set_fields_[15]) {
-    SerializeField<logs::SanityCheckError>(writer, /*tag=*/ 16, sanity_check_error_);
-  }
-  if (set_fields_[16]) {
-    SerializeField<logs::BagFailedToOpen>(writer, /*tag=*/ 17, bag_failed_to_open_);
-  }
-  if (set_fields_[17]) {
-    SerializeField<logs::BagFailedToClose>(writer, /*tag=*/ 18, bag_failed_to_close_);
-  }
-  if (set_fields_[18]) {
-    SerializeField<logs::BagConversionFailed>(writer, /*tag=*/ 19, bag_conversion_failed_);
-  }
-  if (set_fields_[19]) {
-    SerializeField<logs::BagFailedToWrite>(writer, /*tag=*/ 20, bag_failed_to_write_);
-  }
-  if (set_fields_[20]) {
-    SerializeField<logs::CalibrationError>(writer, /*tag=*/ 21, calibration_error_);
-  }
-  if (set_fields_[21]) {
-    SerializeField<logs::ProjectManagerFailedToStartRecording>(writer, /*tag=*/ 22, project_manager_failed_to_start_recording_);
-  }
-  if (set_fields_[22]) {
-    SerializeField<logs::ProjectManagerFailedToStopRecording>(writer, /*tag=*/ 23, project_manager_failed_to_stop_recording_);
-  }
-  if (set_fields_[23]) {
-    SerializeField<logs::ServiceConnectionTimedOut>(writer, /*tag=*/ 24, service_connection_timed_out_);
-  }
-  if (set_fields_[24]) {
-    SerializeField<logs::BagRecorderAlreadyRunning>(writer, /*tag=*/ 25, bag_recorder_already_running_);
-  }
-  if (set_fields_[25]) {
-    SerializeField<logs::LicenseServerConnectionError>(writer, /*tag=*/ 26, license_server_connection_error_);
-  }
-  if (set_fields_[26]) {
-    SerializeField<logs::LicenseError>(writer, /*tag=*/ 27, license_error_);
-  }
-  if (set_fields_[27]) {
-    SerializeField<logs::LicenseNotFoundError>(writer, /*tag=*/ 145, license_not_found_error_);
-  }
-  if (set_fields_[28]) {
-    SerializeField<logs::LicenseExpiredError>(writer, /*tag=*/ 146, license_expired_error_);
-  }
-  if (set_fields_[29]) {
-    SerializeField<logs::LicenseExceededError>(writer, /*tag=*/ 147, license_exceeded_error_);
-  }
-  if (set_fields_[30]) {
-    SerializeField<logs::LicenseHostMachineError>(writer, /*tag=*/ 28, license_host_machine_error_);
-  }
-  if (set_fields_[31]) {
-    SerializeField<logs::LicensePrivilegeError>(writer, /*tag=*/ 148, license_privilege_error_);
-  }
-  if (set_fields_[32]) {
-    SerializeField<logs::LicenseActiveInfo>(writer, /*tag=*/ 149, license_active_info_);
-  }
-  if (set_fields_[33]) {
-    SerializeField<logs::MultipleLicensesWarning>(writer, /*tag=*/ 150, multiple_licenses_warning_);
-  }
-  if (set_fields_[34]) {
-    SerializeField<logs::LicenseCurrentLicenseStatusInfo>(writer, /*tag=*/ 29, license_current_license_status_info_);
-  }
-  if (set_fields_[35]) {
-    SerializeField<logs::BagRecordingStoppedInfo>(writer, /*tag=*/ 30, bag_recording_stopped_info_);
-  }
-  if (set_fields_[36]) {
-    SerializeField<logs::BagRecordingFailedToStart>(writer, /*tag=*/ 31, bag_recording_failed_to_start_);
-  }
-  if (set_fields_[37]) {
-    SerializeField<logs::BagRecordingStartedInfo>(writer, /*tag=*/ 32, bag_recording_started_info_);
-  }
-  if (set_fields_[38]) {
-    SerializeField<logs::ReplayRestartedInfo>(writer, /*tag=*/ 33, replay_restarted_info_);
-  }
-  if (set_fields_[39]) {
-    SerializeField<logs::InputSourceChangeRequestedInfo>(writer, /*tag=*/ 34, input_source_change_requested_info_);
-  }
-  if (set_fields_[40]) {
-    SerializeField<logs::InputSourceSwitchedInfo>(writer, /*tag=*/ 35, input_source_switched_info_);
-  }
-  if (set_fields_[41]) {
-    SerializeField<logs::RpcTimeoutWarning>(writer, /*tag=*/ 36, rpc_timeout_warning_);
-  }
-  if (set_fields_[42]) {
-    SerializeField<logs::CannotWriteLogFile>(writer, /*tag=*/ 37, cannot_write_log_file_);
-  }
-  if (set_fields_[43]) {
-    SerializeField<logs::PointCloudParsingFailureWarning>(writer, /*tag=*/ 38, point_cloud_parsing_failure_warning_);
-  }
-  if (set_fields_[44]) {
-    SerializeField<logs::LidarIsDead>(writer, /*tag=*/ 39, lidar_is_dead_);
-  }
-  if (set_fields_[45]) {
-    SerializeField<logs::LidarIsNotDeadAnymore>(writer, /*tag=*/ 40, lidar_is_not_dead_anymore_);
-  }
-  if (set_fields_[46]) {
-    SerializeField<logs::LidarIsObstructed>(writer, /*tag=*/ 41, lidar_is_obstructed_);
-  }
-  if (set_fields_[47]) {
-    SerializeField<logs::LidarIsNotObstructedAnymore>(writer, /*tag=*/ 42, lidar_is_not_obstructed_anymore_);
-  }
-  if (set_fields_[48]) {
-    SerializeField<logs::LidarIsTilted>(writer, /*tag=*/ 43, lidar_is_tilted_);
-  }
-  if (set_fields_[49]) {
-    SerializeField<logs::LidarIsNotTiltedAnymore>(writer, /*tag=*/ 44, lidar_is_not_tilted_anymore_);
-  }
-  if (set_fields_[50]) {
-    SerializeField<logs::LidarHasBeenAutomaticallyRecalibrated>(writer, /*tag=*/ 45, lidar_has_been_automatically_recalibrated_);
-  }
-  if (set_fields_[51]) {
-    SerializeField<logs::LidarAutoCorrectionFailed>(writer, /*tag=*/ 207, lidar_auto_correction_failed_);
-  }
-  if (set_fields_[52]) {
-    SerializeField<logs::LidarIcpFailed>(writer, /*tag=*/ 208, lidar_icp_failed_);
-  }
-  if (set_fields_[53]) {
-    SerializeField<logs::ReceivedFirstDataForLidar>(writer, /*tag=*/ 46, received_first_data_for_lidar_);
-  }
-  if (set_fields_[54]) {
-    SerializeField<logs::TerminationFailureError>(writer, /*tag=*/ 47, termination_failure_error_);
-  }
-  if (set_fields_[55]) {
-    SerializeField<logs::FrameProcessingError>(writer, /*tag=*/ 48, frame_processing_error_);
-  }
-  if (set_fields_[56]) {
-    SerializeField<logs::ThreadPoolUnavailableError>(writer, /*tag=*/ 49, thread_pool_unavailable_error_);
-  }
-  if (set_fields_[57]) {
-    SerializeField<logs::InvalidArgument>(writer, /*tag=*/ 50, invalid_argument_);
-  }
-  if (set_fields_[58]) {
-    SerializeField<logs::ComponentInitializationFailureFatal>(writer, /*tag=*/ 51, component_initialization_failure_fatal_);
-  }
-  if (set_fields_[59]) {
-    SerializeField<logs::UnhandledEnumCaseError>(writer, /*tag=*/ 52, unhandled_enum_case_error_);
-  }
-  if (set_fields_[60]) {
-    SerializeField<logs::BagEmptyError>(writer, /*tag=*/ 53, bag_empty_error_);
-  }
-  if (set_fields_[61]) {
-    SerializeField<logs::DiscardingDataError>(writer, /*tag=*/ 54, discarding_data_error_);
-  }
-  if (set_fields_[62]) {
-    SerializeField<logs::DiscardingDataWarning>(writer, /*tag=*/ 55, discarding_data_warning_);
-  }
-  if (set_fields_[63]) {
-    SerializeField<logs::NothingToProcess>(writer, /*tag=*/ 56, nothing_to_process_);
-  }
-  if (set_fields_[64]) {
-    SerializeField<logs::InvalidComponentConfiguration>(writer, /*tag=*/ 57, invalid_component_configuration_);
-  }
-  if (set_fields_[65]) {
-    SerializeField<logs::ChannelReceiverNotFoundWarning>(writer, /*tag=*/ 58, channel_receiver_not_found_warning_);
-  }
-  if (set_fields_[66]) {
-    SerializeField<logs::ModelLoadFailure>(writer, /*tag=*/ 59, model_load_failure_);
-  }
-  if (set_fields_[67]) {
-    SerializeField<logs::ModelExecutionFailureError>(writer, /*tag=*/ 60, model_execution_failure_error_);
-  }
-  if (set_fields_[68]) {
-    SerializeField<logs::ServiceReadyInfo>(writer, /*tag=*/ 61, service_ready_info_);
-  }
-  if (set_fields_[69]) {
-    SerializeField<logs::ModelPreparingInfo>(writer, /*tag=*/ 62, model_preparing_info_);
-  }
-  if (set_fields_[70]) {
-    SerializeField<logs::ModelInitializedInfo>(writer, /*tag=*/ 63, model_initialized_info_);
-  }
-  if (set_fields_[71]) {
-    SerializeField<logs::ModelInitializationFailureWarning>(writer, /*tag=*/ 64, model_initialization_failure_warning_);
-  }
-  if (set_fields_[72]) {
-    SerializeField<logs::RosSpinnerStoppedWarning>(writer, /*tag=*/ 65, ros_spinner_stopped_warning_);
-  }
-  if (set_fields_[73]) {
-    SerializeField<logs::ActorSystemUnavailableError>(writer, /*tag=*/ 66, actor_system_unavailable_error_);
-  }
-  if (set_fields_[74]) {
-    SerializeField<logs::ConfigNodeNotFoundError>(writer, /*tag=*/ 67, config_node_not_found_error_);
-  }
-  if (set_fields_[75]) {
-    SerializeField<logs::BagTimestampOutOfOrderError>(writer, /*tag=*/ 68, bag_timestamp_out_of_order_error_);
-  }
-  if (set_fields_[76]) {
-    SerializeField<logs::BagReplayUnexpectedTimestampError>(writer, /*tag=*/ 69, bag_replay_unexpected_timestamp_error_);
-  }
-  if (set_fields_[77]) {
-    SerializeField<logs::WebsocketClosedInfo>(writer, /*tag=*/ 70, websocket_closed_info_);
-  }
-  if (set_fields_[78]) {
-    SerializeField<logs::WebsocketOpenedInfo>(writer, /*tag=*/ 71, websocket_opened_info_);
-  }
-  if (set_fields_[79]) {
-    SerializeField<logs::SubscriberDisconnectedInfo>(writer, /*tag=*/ 72, subscriber_disconnected_info_);
-  }
-  if (set_fields_[80]) {
-    SerializeField<logs::ThreadPoolSlowingDownWarning>(writer, /*tag=*/ 73, thread_pool_slowing_down_warning_);
-  }
-  if (set_fields_[81]) {
-    SerializeField<logs::ThreadPoolNotRespondingWarning>(writer, /*tag=*/ 74, thread_pool_not_responding_warning_);
-  }
-  if (set_fields_[82]) {
-    SerializeField<logs::ThreadPoolBrokenPromiseWarning>(writer, /*tag=*/ 75, thread_pool_broken_promise_warning_);
-  }
-  if (set_fields_[83]) {
-    SerializeField<logs::BoxFittingPointsBelowBaseWarning>(writer, /*tag=*/ 76, box_fitting_points_below_base_warning_);
-  }
-  if (set_fields_[84]) {
-    SerializeField<logs::FailedToRemoveStalePointsWarning>(writer, /*tag=*/ 77, failed_to_remove_stale_points_warning_);
-  }
-  if (set_fields_[85]) {
-    SerializeField<logs::IrregularBroadcastingPeriodWarning>(writer, /*tag=*/ 78, irregular_broadcasting_period_warning_);
-  }
-  if (set_fields_[86]) {
-    SerializeField<logs::ClustererPointsOutOfRangeWarning>(writer, /*tag=*/ 79, clusterer_points_out_of_range_warning_);
-  }
-  if (set_fields_[87]) {
-    SerializeField<logs::InternalError>(writer, /*tag=*/ 80, internal_error_);
-  }
-  if (set_fields_[88]) {
-    SerializeField<logs::InternalFatal>(writer, /*tag=*/ 81, internal_fatal_);
-  }
-  if (set_fields_[89]) {
-    SerializeField<logs::ServiceStartingInfo>(writer, /*tag=*/ 82, service_starting_info_);
-  }
-  if (set_fields_[90]) {
-    SerializeField<logs::ConfigNodeNotFoundFatal>(writer, /*tag=*/ 83, config_node_not_found_fatal_);
-  }
-  if (set_fields_[91]) {
-    SerializeField<logs::ServiceSetupError>(writer, /*tag=*/ 84, service_setup_error_);
-  }
-  if (set_fields_[92]) {
-    SerializeField<logs::FilesystemError>(writer, /*tag=*/ 85, filesystem_error_);
-  }
-  if (set_fields_[93]) {
-    SerializeField<logs::InvalidPresetWarning>(writer, /*tag=*/ 86, invalid_preset_warning_);
-  }
-  if (set_fields_[94]) {
-    SerializeField<logs::WebsocketFailedClearPendingError>(writer, /*tag=*/ 87, websocket_failed_clear_pending_error_);
-  }
-  if (set_fields_[95]) {
-    SerializeField<logs::WebsocketFailedToStopError>(writer, /*tag=*/ 88, websocket_failed_to_stop_error_);
-  }
-  if (set_fields_[96]) {
-    SerializeField<logs::WebsocketFailedToCreateError>(writer, /*tag=*/ 89, websocket_failed_to_create_error_);
-  }
-  if (set_fields_[97]) {
-    SerializeField<logs::UnexpectedRpcError>(writer, /*tag=*/ 90, unexpected_rpc_error_);
-  }
-  if (set_fields_[98]) {
-    SerializeField<logs::LicensePollFailed>(writer, /*tag=*/ 91, license_poll_failed_);
-  }
-  if (set_fields_[99]) {
-    SerializeField<logs::LicenseExpiredWarning>(writer, /*tag=*/ 92, license_expired_warning_);
-  }
-  if (set_fields_[100]) {
-    SerializeField<logs::LicenseUsageExceededWarning>(writer, /*tag=*/ 93, license_usage_exceeded_warning_);
-  }
-  if (set_fields_[101]) {
-    SerializeField<logs::StaticThreadPoolSlowTaskWarning>(writer, /*tag=*/ 94, static_thread_pool_slow_task_warning_);
-  }
-  if (set_fields_[102]) {
-    SerializeField<logs::RpcUnsupportedServiceWarning>(writer, /*tag=*/ 95, rpc_unsupported_service_warning_);
-  }
-  if (set_fields_[103]) {
-    SerializeField<logs::WebsocketHandlerProblem>(writer, /*tag=*/ 96, websocket_handler_problem_);
-  }
-  if (set_fields_[104]) {
-    SerializeField<logs::WebsocketDeserializeError>(writer, /*tag=*/ 97, websocket_deserialize_error_);
-  }
-  if (set_fields_[105]) {
-    SerializeField<logs::WebsocketExpiredRpcEndpointWarning>(writer, /*tag=*/ 98, websocket_expired_rpc_endpoint_warning_);
-  }
-  if (set_fields_[106]) {
-    SerializeField<logs::WebsocketQueueOverloadedWarning>(writer, /*tag=*/ 99, websocket_queue_overloaded_warning_);
-  }
-  if (set_fields_[107]) {
-    SerializeField<logs::RpcFailedToNotifyWarning>(writer, /*tag=*/ 100, rpc_failed_to_notify_warning_);
-  }
-  if (set_fields_[108]) {
-    SerializeField<logs::ConfigSubscriptionFailedWarning>(writer, /*tag=*/ 101, config_subscription_failed_warning_);
-  }
-  if (set_fields_[109]) {
-    SerializeField<logs::ThreadPoolClampedWorkersWarning>(writer, /*tag=*/ 102, thread_pool_clamped_workers_warning_);
-  }
-  if (set_fields_[110]) {
-    SerializeField<logs::StoppingHorusBagRecorderAlreadyStopped>(writer, /*tag=*/ 103, stopping_horus_bag_recorder_already_stopped_);
-  }
-  if (set_fields_[111]) {
-    SerializeField<logs::RecorderConfigUpdateWhileRunning>(writer, /*tag=*/ 104, recorder_config_update_while_running_);
-  }
-  if (set_fields_[112]) {
-    SerializeField<logs::ClampingDataWarning>(writer, /*tag=*/ 105, clamping_data_warning_);
-  }
-  if (set_fields_[113]) {
-    SerializeField<logs::LidarIncompatibleValues>(writer, /*tag=*/ 106, lidar_incompatible_values_);
-  }
-  if (set_fields_[114]) {
-    SerializeField<logs::CannotDetermineContainerIdError>(writer, /*tag=*/ 107, cannot_determine_container_id_error_);
-  }
-  if (set_fields_[115]) {
-    SerializeField<logs::StartedLidarDriver>(writer, /*tag=*/ 108, started_lidar_driver_);
-  }
-  if (set_fields_[116]) {
-    SerializeField<logs::CannotStartLidarDriver>(writer, /*tag=*/ 109, cannot_start_lidar_driver_);
-  }
-  if (set_fields_[117]) {
-    SerializeField<logs::StoppedLidarDriver>(writer, /*tag=*/ 110, stopped_lidar_driver_);
-  }
-  if (set_fields_[118]) {
-    SerializeField<logs::CannotStopLidarDriver>(writer, /*tag=*/ 111, cannot_stop_lidar_driver_);
-  }
-  if (set_fields_[119]) {
-    SerializeField<logs::RestartedLidarDriver>(writer, /*tag=*/ 112, restarted_lidar_driver_);
-  }
-  if (set_fields_[120]) {
-    SerializeField<logs::CannotRestartLidarDriver>(writer, /*tag=*/ 113, cannot_restart_lidar_driver_);
-  }
-  if (set_fields_[121]) {
-    SerializeField<logs::RemovedUnusedLidarDriver>(writer, /*tag=*/ 114, removed_unused_lidar_driver_);
-  }
-  if (set_fields_[122]) {
-    SerializeField<logs::CannotRemoveUnusedLidarDriver>(writer, /*tag=*/ 115, cannot_remove_unused_lidar_driver_);
-  }
-  if (set_fields_[123]) {
-    SerializeField<logs::LidarDriverGcFailure>(writer, /*tag=*/ 116, lidar_driver_gc_failure_);
-  }
-  if (set_fields_[124]) {
-    SerializeField<logs::IdSpaceExhausted>(writer, /*tag=*/ 117, id_space_exhausted_);
-  }
-  if (set_fields_[125]) {
-    SerializeField<logs::PreprocessingToPointAggregatorPointsSkipped>(writer, /*tag=*/ 118, preprocessing_to_point_aggregator_points_skipped_);
-  }
-  if (set_fields_[126]) {
-    SerializeField<logs::MinMsgIntervalLessThanThreshold>(writer, /*tag=*/ 119, min_msg_interval_less_than_threshold_);
-  }
-  if (set_fields_[127]) {
-    SerializeField<logs::FailedToCleanupRosWarning>(writer, /*tag=*/ 120, failed_to_cleanup_ros_warning_);
-  }
-  if (set_fields_[128]) {
-    SerializeField<logs::RpcDisconnectedWarning>(writer, /*tag=*/ 121, rpc_disconnected_warning_);
-  }
-  if (set_fields_[129]) {
-    SerializeField<logs::RpcUnhandledError>(writer, /*tag=*/ 122, rpc_unhandled_error_);
-  }
-  if (set_fields_[130]) {
-    SerializeField<logs::TimeDiffOutOfRangeWarning>(writer, /*tag=*/ 123, time_diff_out_of_range_warning_);
-  }
-  if (set_fields_[131]) {
-    SerializeField<logs::TensorrtLog>(writer, /*tag=*/ 124, tensorrt_log_);
-  }
-  if (set_fields_[132]) {
-    SerializeField<logs::BuildingTensorrtEngineInfo>(writer, /*tag=*/ 125, building_tensorrt_engine_info_);
-  }
-  if (set_fields_[133]) {
-    SerializeField<logs::LoadingTensorrtEngineInfo>(writer, /*tag=*/ 126, loading_tensorrt_engine_info_);
-  }
-  if (set_fields_[134]) {
-    SerializeField<logs::CalibrationMapNotFound>(writer, /*tag=*/ 127, calibration_map_not_found_);
-  }
-  if (set_fields_[135]) {
-    SerializeField<logs::CalibrationMapNotValid>(writer, /*tag=*/ 128, calibration_map_not_valid_);
-  }
-  if (set_fields_[136]) {
-    SerializeField<logs::CalibrationMapPathAlreadyExists>(writer, /*tag=*/ 129, calibration_map_path_already_exists_);
-  }
-  if (set_fields_[137]) {
-    SerializeField<logs::FailedToSaveCalibrationMap>(writer, /*tag=*/ 130, failed_to_save_calibration_map_);
-  }
-  if (set_fields_[138]) {
-    SerializeField<logs::FailedToRemoveCalibrationMap>(writer, /*tag=*/ 131, failed_to_remove_calibration_map_);
-  }
-  if (set_fields_[139]) {
-    SerializeField<logs::FailedToIterateInDirectory>(writer, /*tag=*/ 132, failed_to_iterate_in_directory_);
-  }
-  if (set_fields_[140]) {
-    SerializeField<logs::MapBasedCalibrationWithoutMapLoading>(writer, /*tag=*/ 133, map_based_calibration_without_map_loading_);
-  }
-  if (set_fields_[141]) {
-    SerializeField<logs::MapBasedCalibrationAlreadyRunning>(writer, /*tag=*/ 134, map_based_calibration_already_running_);
-  }
-  if (set_fields_[142]) {
-    SerializeField<logs::CancelMapBasedCalibrationNotRunning>(writer, /*tag=*/ 135, cancel_map_based_calibration_not_running_);
-  }
-  if (set_fields_[143]) {
-    SerializeField<logs::BagStreamNotFound>(writer, /*tag=*/ 136, bag_stream_not_found_);
-  }
-  if (set_fields_[144]) {
-    SerializeField<logs::EvaluationBagStartedInfo>(writer, /*tag=*/ 137, evaluation_bag_started_info_);
-  }
-  if (set_fields_[145]) {
-    SerializeField<logs::EvaluationBagFinishedInfo>(writer, /*tag=*/ 138, evaluation_bag_finished_info_);
-  }
-  if (set_fields_[146]) {
-    SerializeField<logs::BagNotFound>(writer, /*tag=*/ 139, bag_not_found_);
-  }
-  if (set_fields_[147]) {
-    SerializeField<logs::BuildingPipelineInfo>(writer, /*tag=*/ 140, building_pipeline_info_);
-  }
-  if (set_fields_[148]) {
-    SerializeField<logs::BagIsNotEvaluation>(writer, /*tag=*/ 141, bag_is_not_evaluation_);
-  }
-  if (set_fields_[149]) {
-    SerializeField<logs::HorusBagRunning>(writer, /*tag=*/ 142, horus_bag_running_);
-  }
-  if (set_fields_[150]) {
-    SerializeField<logs::AutoGroundCalibrationWarning>(writer, /*tag=*/ 143, auto_ground_calibration_warning_);
-  }
-  if (set_fields_[151]) {
-    SerializeField<logs::AutoGroundCalibrationError>(writer, /*tag=*/ 144, auto_ground_calibration_error_);
-  }
-  if (set_fields_[152]) {
-    SerializeField<logs::ObjectDetectorNotLoadedWarning>(writer, /*tag=*/ 151, object_detector_not_loaded_warning_);
-  }
-  if (set_fields_[153]) {
-    SerializeField<logs::CalibrationIsRunningError>(writer, /*tag=*/ 152, calibration_is_running_error_);
-  }
-  if (set_fields_[154]) {
-    SerializeField<logs::ModelInitInProgressInfo>(writer, /*tag=*/ 153, model_init_in_progress_info_);
-  }
-  if (set_fields_[155]) {
-    SerializeField<logs::RpcTimeoutWithResolutionWarning>(writer, /*tag=*/ 154, rpc_timeout_with_resolution_warning_);
-  }
-  if (set_fields_[156]) {
-    SerializeField<logs::CalibrationWasCancelledInfo>(writer, /*tag=*/ 155, calibration_was_cancelled_info_);
-  }
-  if (set_fields_[157]) {
-    SerializeField<logs::CalibrationMapRecordingFailedToStart>(writer, /*tag=*/ 156, calibration_map_recording_failed_to_start_);
-  }
-  if (set_fields_[158]) {
-    SerializeField<logs::DetectionPipelineRequestedResetInfo>(writer, /*tag=*/ 157, detection_pipeline_requested_reset_info_);
-  }
-  if (set_fields_[159]) {
-    SerializeField<logs::PreprocessingServicePipelineUnavailable>(writer, /*tag=*/ 158, preprocessing_service_pipeline_unavailable_);
-  }
-  if (set_fields_[160]) {
-    SerializeField<logs::CircularRecordingDisabledWarning>(writer, /*tag=*/ 159, circular_recording_disabled_warning_);
-  }
-  if (set_fields_[161]) {
-    SerializeField<logs::SnapshotAlreadyRunningWarning>(writer, /*tag=*/ 160, snapshot_already_running_warning_);
-  }
-  if (set_fields_[162]) {
-    SerializeField<logs::ActiveProjectChangedInfo>(writer, /*tag=*/ 161, active_project_changed_info_);
-  }
-  if (set_fields_[163]) {
-    SerializeField<logs::ProjectConfigUpdatedInfo>(writer, /*tag=*/ 162, project_config_updated_info_);
-  }
-  if (set_fields_[164]) {
-    SerializeField<logs::InvalidLidarTimestamp>(writer, /*tag=*/ 163, invalid_lidar_timestamp_);
-  }
-  if (set_fields_[165]) {
-    SerializeField<logs::CalibrationAccumulatingPointsInfo>(writer, /*tag=*/ 164, calibration_accumulating_points_info_);
-  }
-  if (set_fields_[166]) {
-    SerializeField<logs::SparseNoiseFilterUsageNonRotationalLidars>(writer, /*tag=*/ 165, sparse_noise_filter_usage_non_rotational_lidars_);
-  }
-  if (set_fields_[167]) {
-    SerializeField<logs::FileWriteWarning>(writer, /*tag=*/ 166, file_write_warning_);
-  }
-  if (set_fields_[168]) {
-    SerializeField<logs::LicenseForbiddenFeature>(writer, /*tag=*/ 167, license_forbidden_feature_);
-  }
-  if (set_fields_[169]) {
-    SerializeField<logs::FailedToUpdateConfiguration>(writer, /*tag=*/ 168, failed_to_update_configuration_);
-  }
-  if (set_fields_[170]) {
-    SerializeField<logs::ObstructionDetectorBadReferenceWarning>(writer, /*tag=*/ 169, obstruction_detector_bad_reference_warning_);
-  }
-  if (set_fields_[171]) {
-    SerializeField<logs::ProjectFileInvalidPermissionsError>(writer, /*tag=*/ 170, project_file_invalid_permissions_error_);
-  }
-  if (set_fields_[172]) {
-    SerializeField<logs::PipelineSchedulerError>(writer, /*tag=*/ 171, pipeline_scheduler_error_);
-  }
-  if (set_fields_[173]) {
-    SerializeField<logs::MultiLidarCalibrationWarning>(writer, /*tag=*/ 172, multi_lidar_calibration_warning_);
-  }
-  if (set_fields_[174]) {
-    SerializeField<logs::MultiLidarCalibrationError>(writer, /*tag=*/ 173, multi_lidar_calibration_error_);
-  }
-  if (set_fields_[175]) {
-    SerializeField<logs::OldBagWarning>(writer, /*tag=*/ 174, old_bag_warning_);
-  }
-  if (set_fields_[176]) {
-    SerializeField<logs::UpgradingBagInfo>(writer, /*tag=*/ 175, upgrading_bag_info_);
-  }
-  if (set_fields_[177]) {
-    SerializeField<logs::BagCalibrationSaveFailed>(writer, /*tag=*/ 176, bag_calibration_save_failed_);
-  }
-  if (set_fields_[178]) {
-    SerializeField<logs::BagUpgradeFailed>(writer, /*tag=*/ 177, bag_upgrade_failed_);
-  }
-  if (set_fields_[179]) {
-    SerializeField<logs::UnknownLidarError>(writer, /*tag=*/ 178, unknown_lidar_error_);
-  }
-  if (set_fields_[180]) {
-    SerializeField<logs::InvalidPointCloudWarning>(writer, /*tag=*/ 179, invalid_point_cloud_warning_);
-  }
-  if (set_fields_[181]) {
-    SerializeField<logs::LidarIsDroppingPackets>(writer, /*tag=*/ 180, lidar_is_dropping_packets_);
-  }
-  if (set_fields_[182]) {
-    SerializeField<logs::RemovedInvalidLidarsFromConfigWarning>(writer, /*tag=*/ 181, removed_invalid_lidars_from_config_warning_);
-  }
-  if (set_fields_[183]) {
-    SerializeField<logs::CalibrationMapRecordingFailed>(writer, /*tag=*/ 182, calibration_map_recording_failed_);
-  }
-  if (set_fields_[184]) {
-    SerializeField<logs::DetectionNodeNotFoundError>(writer, /*tag=*/ 183, detection_node_not_found_error_);
-  }
-  if (set_fields_[185]) {
-    SerializeField<logs::CreatedVersionBackupInfo>(writer, /*tag=*/ 184, created_version_backup_info_);
-  }
-  if (set_fields_[186]) {
-    SerializeField<logs::PlyFileLoadFailedError>(writer, /*tag=*/ 185, ply_file_load_failed_error_);
-  }
-  if (set_fields_[187]) {
-    SerializeField<logs::HesaiDriverLifecycle>(writer, /*tag=*/ 186, hesai_driver_lifecycle_);
-  }
-  if (set_fields_[188]) {
-    SerializeField<logs::HesaiDriverError>(writer, /*tag=*/ 187, hesai_driver_error_);
-  }
-  if (set_fields_[189]) {
-    SerializeField<logs::HesaiPacketProcessingFailed>(writer, /*tag=*/ 188, hesai_packet_processing_failed_);
-  }
-  if (set_fields_[190]) {
-    SerializeField<logs::HesaiCorrectionFileError>(writer, /*tag=*/ 189, hesai_correction_file_error_);
-  }
-  if (set_fields_[191]) {
-    SerializeField<logs::HesaiPacketStatistics>(writer, /*tag=*/ 190, hesai_packet_statistics_);
-  }
-  if (set_fields_[192]) {
-    SerializeField<logs::PlyFileWriteFailedError>(writer, /*tag=*/ 191, ply_file_write_failed_error_);
-  }
-  if (set_fields_[193]) {
-    SerializeField<logs::ProjectSaveError>(writer, /*tag=*/ 192, project_save_error_);
-  }
-  if (set_fields_[194]) {
-    SerializeField<logs::SaveStaticEnvironmentSuccess>(writer, /*tag=*/ 193, save_static_environment_success_);
-  }
-  if (set_fields_[195]) {
-    SerializeField<logs::SaveStaticEnvironmentFailed>(writer, /*tag=*/ 194, save_static_environment_failed_);
-  }
-  if (set_fields_[196]) {
-    SerializeField<logs::LoadStaticEnvironmentSuccess>(writer, /*tag=*/ 195, load_static_environment_success_);
-  }
-  if (set_fields_[197]) {
-    SerializeField<logs::LoadStaticEnvironmentFailed>(writer, /*tag=*/ 196, load_static_environment_failed_);
-  }
-  if (set_fields_[198]) {
-    SerializeField<logs::AttemptToInjectInvalidLidarIdWarning>(writer, /*tag=*/ 197, attempt_to_inject_invalid_lidar_id_warning_);
-  }
-  if (set_fields_[199]) {
-    SerializeField<logs::ResetBundledPacketDueToUnexpectedPacket>(writer, /*tag=*/ 198, reset_bundled_packet_due_to_unexpected_packet_);
-  }
-  if (set_fields_[200]) {
-    SerializeField<logs::PacketBundlerDroppedPacketsWarning>(writer, /*tag=*/ 199, packet_bundler_dropped_packets_warning_);
-  }
-  if (set_fields_[201]) {
-    SerializeField<logs::PacketBundlerFrameJumpWarning>(writer, /*tag=*/ 200, packet_bundler_frame_jump_warning_);
-  }
-  if (set_fields_[202]) {
-    SerializeField<logs::LidarCorrectionLoadingSuccess>(writer, /*tag=*/ 201, lidar_correction_loading_success_);
-  }
-  if (set_fields_[203]) {
-    SerializeField<logs::LidarCorrectionLoadingFailure>(writer, /*tag=*/ 202, lidar_correction_loading_failure_);
-  }
-  if (set_fields_[204]) {
-    SerializeField<logs::HesaiPacketStatisticsLidar>(writer, /*tag=*/ 203, hesai_packet_statistics_lidar_);
-  }
-  if (set_fields_[205]) {
-    SerializeField<logs::LidarTiltDetectionAlignedToCalibrationMapInfo>(writer, /*tag=*/ 204, lidar_tilt_detection_aligned_to_calibration_map_info_);
-  }
-  if (set_fields_[206]) {
-    SerializeField<logs::LidarTiltDetectionMisalignedToCalibrationMapWarning>(writer, /*tag=*/ 205, lidar_tilt_detection_misaligned_to_calibration_map_warning_);
-  }
-  if (set_fields_[207]) {
-    SerializeField<logs::LidarOriginalPoseDiffersForAutoCorrectionError>(writer, /*tag=*/ 209, lidar_original_pose_differs_for_auto_correction_error_);
-  }
-  if (set_fields_[208]) {
-    SerializeField<logs::RecoveredCarIdsInfo>(writer, /*tag=*/ 210, recovered_car_ids_info_);
-  }
-  if (set_fields_[209]) {
-    SerializeField<logs::FailedToRecoverCarIds>(writer, /*tag=*/ 211, failed_to_recover_car_ids_);
-  }
-  if (set_fields_[210]) {
-    SerializeField<logs::FailedToEmplaceRecoveredCarId>(writer, /*tag=*/ 212, failed_to_emplace_recovered_car_id_);
-  }
-  if (set_fields_[211]) {
-    SerializeField<logs::PersistentStorageError>(writer, /*tag=*/ 213, persistent_storage_error_);
-  }
-  if (set_fields_[212]) {
-    SerializeField<logs::TrackCapacityExceededWarning>(writer, /*tag=*/ 214, track_capacity_exceeded_warning_);
-  }
-  if (set_fields_[213]) {
-    SerializeField<logs::TrackerStatePathUnavailableWarning>(writer, /*tag=*/ 215, tracker_state_path_unavailable_warning_);
-  }
-  if (set_fields_[214]) {
-    SerializeField<logs::TrackerStateRecoveryError>(writer, /*tag=*/ 224, tracker_state_recovery_error_);
-  }
-  if (set_fields_[215]) {
-    SerializeField<logs::TrackerStateSaveError>(writer, /*tag=*/ 225, tracker_state_save_error_);
-  }
-  if (set_fields_[216]) {
-    SerializeField<logs::TrackerIdRecoveryFailedError>(writer, /*tag=*/ 216, tracker_id_recovery_failed_error_);
-  }
-  if (set_fields_[217]) {
-    SerializeField<logs::TrackerIdFastForwardFailedError>(writer, /*tag=*/ 217, tracker_id_fast_forward_failed_error_);
-  }
-  if (set_fields_[218]) {
-    SerializeField<logs::CircularRecordingSnapshotCreated>(writer, /*tag=*/ 218, circular_recording_snapshot_created_);
-  }
-  if (set_fields_[219]) {
-    SerializeField<logs::CircularRecordingFileOperationError>(writer, /*tag=*/ 219, circular_recording_file_operation_error_);
-  }
-  if (set_fields_[220]) {
-    SerializeField<logs::ObjectIdRecoveryRejectedInfo>(writer, /*tag=*/ 220, object_id_recovery_rejected_info_);
-  }
-  if (set_fields_[221]) {
-    SerializeField<logs::ExpiredRecoveryIdsInfo>(writer, /*tag=*/ 221, expired_recovery_ids_info_);
-  }
-  if (set_fields_[222]) {
-    SerializeField<logs::HesaiUdpReceiverInfo>(writer, /*tag=*/ 222, hesai_udp_receiver_info_);
-  }
-  if (set_fields_[223]) {
-    SerializeField<logs::DbCommitFailed>(writer, /*tag=*/ 223, db_commit_failed_);
-  }
-  if (set_fields_[224]) {
-    SerializeField<logs::DetectionServiceRpcQueueFull>(writer, /*tag=*/ 226, detection_service_rpc_queue_full_);
-  }
-  if (set_fields_[225]) {
-    SerializeField<logs::ProjectMigrationFailed>(writer, /*tag=*/ 227, project_migration_failed_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LogData::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LogData::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        clear_data();
-        data_ = DataOneof::kGeneric;
-        DeserializeField<logs::Generic>(reader, generic_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        clear_data();
-        data_ = DataOneof::kOom;
-        DeserializeField<logs::Oom>(reader, oom_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        clear_data();
-        data_ = DataOneof::kRpcConnectionError;
-        DeserializeField<logs::RpcConnectionError>(reader, rpc_connection_error_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        clear_data();
-        data_ = DataOneof::kInvalidProjectName;
-        DeserializeField<logs::InvalidProjectName>(reader, invalid_project_name_);
-        set_fields_[3] = true;
-        break;
-      }
-      case 5: {
-        clear_data();
-        data_ = DataOneof::kProjectNotFound;
-        DeserializeField<logs::ProjectNotFound>(reader, project_not_found_);
-        set_fields_[4] = true;
-        break;
-      }
-      case 6: {
-        clear_data();
-        data_ = DataOneof::kProjectAlreadyExists;
-        DeserializeField<logs::ProjectAlreadyExists>(reader, project_already_exists_);
-        set_fields_[5] = true;
-        break;
-      }
-      case 7: {
-        clear_data();
-        data_ = DataOneof::kInvalidConfiguration;
-        DeserializeField<logs::InvalidConfiguration>(reader, invalid_configuration_);
-        set_fields_[6] = true;
-        break;
-      }
-      case 8: {
-        clear_data();
-        data_ = DataOneof::kEntityNotFound;
-        DeserializeField<logs::EntityNotFound>(reader, entity_not_found_);
-        set_fields_[7] = true;
-        break;
-      }
-      case 9: {
-        clear_data();
-        data_ = DataOneof::kActiveProjectCannotBeDeleted;
-        DeserializeField<logs::ActiveProjectCannotBeDeleted>(reader, active_project_cannot_be_deleted_);
-        set_fields_[8] = true;
-        break;
-      }
-      case 10: {
-        clear_data();
-        data_ = DataOneof::kRpcDisconnectionError;
-        DeserializeField<logs::RpcDisconnectionError>(reader, rpc_disconnection_error_);
-        set_fields_[9] = true;
-        break;
-      }
-      case 11: {
-        clear_data();
-        data_ = DataOneof::kDroppedLogs;
-        DeserializeField<logs::DroppedLogs>(reader, dropped_logs_);
-        set_fields_[10] = true;
-        break;
-      }
-      case 12: {
-        clear_data();
-        data_ = DataOneof::kOpenedProject;
-        DeserializeField<logs::OpenedProject>(reader, opened_project_);
-        set_fields_[11] = true;
-        break;
-      }
-      case 13: {
-        clear_data();
-        data_ = DataOneof::kCreatedProject;
-        DeserializeField<logs::CreatedProject>(reader, created_project_);
-        set_fields_[12] = true;
-        break;
-      }
-      case 14: {
-        clear_data();
-        data_ = DataOneof::kConfigUnavailable;
-        DeserializeField<logs::ConfigUnavailable>(reader, config_unavailable_);
-        set_fields_[13] = true;
-        break;
-      }
-      case 15: {
-        clear_data();
-        data_ = DataOneof::kInvalidRequest;
-        DeserializeField<logs::InvalidRequest>(reader, invalid_request_);
-        set_fields_[14] = true;
-        break;
-      }
-      case 16: {
-        clear_data();
-        data_ = DataOneof::kSanityCheckError;
-        DeserializeField<logs::SanityCheckError>(reader, sanity_check_error_);
-        set_fields_[15] = true;
-        break;
-      }
-      case 17: {
-        clear_data();
-        data_ = DataOneof::kBagFailedToOpen;
-        DeserializeField<logs::BagFailedToOpen>(reader, bag_failed_to_open_);
-        set_fields_[16] = true;
-        break;
-      }
-      case 18: {
-        clear_data();
-        data_ = DataOneof::kBagFailedToClose;
-        DeserializeField<logs::BagFailedToClose>(reader, bag_failed_to_close_);
-        set_fields_[17] = true;
-        break;
-      }
-      case 19: {
-        clear_data();
-        data_ = DataOneof::kBagConversionFailed;
-        DeserializeField<logs::BagConversionFailed>(reader, bag_conversion_failed_);
-        set_fields_[18] = true;
-        break;
-      }
-      case 20: {
-        clear_data();
-        data_ = DataOneof::kBagFailedToWrite;
-        DeserializeField<logs::BagFailedToWrite>(reader, bag_failed_to_write_);
-        set_fields_[19] = true;
-        break;
-      }
-      case 21: {
-        clear_data();
-        data_ = DataOneof::kCalibrationError;
-        DeserializeField<logs::CalibrationError>(reader, calibration_error_);
-        set_fields_[20] = true;
-        break;
-      }
-      case 22: {
-        clear_data();
-        data_ = DataOneof::kProjectManagerFailedToStartRecording;
-        DeserializeField<logs::ProjectManagerFailedToStartRecording>(reader, project_manager_failed_to_start_recording_);
-        set_fields_[21] = true;
-        break;
-      }
-      case 23: {
-        clear_data();
-        data_ = DataOneof::kProjectManagerFailedToStopRecording;
-        DeserializeField<logs::ProjectManagerFailedToStopRecording>(reader, project_manager_failed_to_stop_recording_);
-        set_fields_[22] = true;
-        break;
-      }
-      case 24: {
-        clear_data();
-        data_ = DataOneof::kServiceConnectionTimedOut;
-        DeserializeField<logs::ServiceConnectionTimedOut>(reader, service_connection_timed_out_);
-        set_fields_[23] = true;
-        break;
-      }
-      case 25: {
-        clear_data();
-        data_ = DataOneof::kBagRecorderAlreadyRunning;
-        DeserializeField<logs::BagRecorderAlreadyRunning>(reader, bag_recorder_already_running_);
-        set_fields_[24] = true;
-        break;
-      }
-      case 26: {
-        clear_data();
-        data_ = DataOneof::kLicenseServerConnectionError;
-        DeserializeField<logs::LicenseServerConnectionError>(reader, license_server_connection_error_);
-        set_fields_[25] = true;
-        break;
-      }
-      case 27: {
-        clear_data();
-        data_ = DataOneof::kLicenseError;
-        DeserializeField<logs::LicenseError>(reader, license_error_);
-        set_fields_[26] = true;
-        break;
-      }
-      case 145: {
-        clear_data();
-        data_ = DataOneof::kLicenseNotFoundError;
-        DeserializeField<logs::LicenseNotFoundError>(reader, license_not_found_error_);
-        set_fields_[27] = true;
-        break;
-      }
-      case 146: {
-        clear_data();
-        data_ = DataOneof::kLicenseExpiredError;
-        DeserializeField<logs::LicenseExpiredError>(reader, license_expired_error_);
-        set_fields_[28] = true;
-        break;
-      }
-      case 147: {
-        clear_data();
-        data_ = DataOneof::kLicenseExceededError;
-        DeserializeField<logs::LicenseExceededError>(reader, license_exceeded_error_);
-        set_fields_[29] = true;
-        break;
-      }
-      case 28: {
-        clear_data();
-        data_ = DataOneof::kLicenseHostMachineError;
-        DeserializeField<logs::LicenseHostMachineError>(reader, license_host_machine_error_);
-        set_fields_[30] = true;
-        break;
-      }
-      case 148: {
-        clear_data();
-        data_ = DataOneof::kLicensePrivilegeError;
-        DeserializeField<logs::LicensePrivilegeError>(reader, license_privilege_error_);
-        set_fields_[31] = true;
-        break;
-      }
-      case 149: {
-        clear_data();
-        data_ = DataOneof::kLicenseActiveInfo;
-        DeserializeField<logs::LicenseActiveInfo>(reader, license_active_info_);
-        set_fields_[32] = true;
-        break;
-      }
-      case 150: {
-        clear_data();
-        data_ = DataOneof::kMultipleLicensesWarning;
-        DeserializeField<logs::MultipleLicensesWarning>(reader, multiple_licenses_warning_);
-        set_fields_[33] = true;
-        break;
-      }
-      case 29: {
-        clear_data();
-        data_ = DataOneof::kLicenseCurrentLicenseStatusInfo;
-        DeserializeField<logs::LicenseCurrentLicenseStatusInfo>(reader, license_current_license_status_info_);
-        set_fields_[34] = true;
-        break;
-      }
-      case 30: {
-        clear_data();
-        data_ = DataOneof::kBagRecordingStoppedInfo;
-        DeserializeField<logs::BagRecordingStoppedInfo>(reader, bag_recording_stopped_info_);
-        set_fields_[35] = true;
-        break;
-      }
-      case 31: {
-        clear_data();
-        data_ = DataOneof::kBagRecordingFailedToStart;
-        DeserializeField<logs::BagRecordingFailedToStart>(reader, bag_recording_failed_to_start_);
-        set_fields_[36] = true;
-        break;
-      }
-      case 32: {
-        clear_data();
-        data_ = DataOneof::kBagRecordingStartedInfo;
-        DeserializeField<logs::BagRecordingStartedInfo>(reader, bag_recording_started_info_);
-        set_fields_[37] = true;
-        break;
-      }
-      case 33: {
-        clear_data();
-        data_ = DataOneof::kReplayRestartedInfo;
-        DeserializeField<logs::ReplayRestartedInfo>(reader, replay_restarted_info_);
-        set_fields_[38] = true;
-        break;
-      }
-      case 34: {
-        clear_data();
-        data_ = DataOneof::kInputSourceChangeRequestedInfo;
-        DeserializeField<logs::InputSourceChangeRequestedInfo>(reader, input_source_change_requested_info_);
-        set_fields_[39] = true;
-        break;
-      }
-      case 35: {
-        clear_data();
-        data_ = DataOneof::kInputSourceSwitchedInfo;
-        DeserializeField<logs::InputSourceSwitchedInfo>(reader, input_source_switched_info_);
-        set_fields_[40] = true;
-        break;
-      }
-      case 36: {
-        clear_data();
-        data_ = DataOneof::kRpcTimeoutWarning;
-        DeserializeField<logs::RpcTimeoutWarning>(reader, rpc_timeout_warning_);
-        set_fields_[41] = true;
-        break;
-      }
-      case 37: {
-        clear_data();
-        data_ = DataOneof::kCannotWriteLogFile;
-        DeserializeField<logs::CannotWriteLogFile>(reader, cannot_write_log_file_);
-        set_fields_[42] = true;
-        break;
-      }
-      case 38: {
-        clear_data();
-        data_ = DataOneof::kPointCloudParsingFailureWarning;
-        DeserializeField<logs::PointCloudParsingFailureWarning>(reader, point_cloud_parsing_failure_warning_);
-        set_fields_[43] = true;
-        break;
-      }
-      case 39: {
-        clear_data();
-        data_ = DataOneof::kLidarIsDead;
-        DeserializeField<logs::LidarIsDead>(reader, lidar_is_dead_);
-        set_fields_[44] = true;
-        break;
-      }
-      case 40: {
-        clear_data();
-        data_ = DataOneof::kLidarIsNotDeadAnymore;
-        DeserializeField<logs::LidarIsNotDeadAnymore>(reader, lidar_is_not_dead_anymore_);
-        set_fields_[45] = true;
-        break;
-      }
-      case 41: {
-        clear_data();
-        data_ = DataOneof::kLidarIsObstructed;
-        DeserializeField<logs::LidarIsObstructed>(reader, lidar_is_obstructed_);
-        set_fields_[46] = true;
-        break;
-      }
-      case 42: {
-        clear_data();
-        data_ = DataOneof::kLidarIsNotObstructedAnymore;
-        DeserializeField<logs::LidarIsNotObstructedAnymore>(reader, lidar_is_not_obstructed_anymore_);
-        set_fields_[47] = true;
-        break;
-      }
-      case 43: {
-        clear_data();
-        data_ = DataOneof::kLidarIsTilted;
-        DeserializeField<logs::LidarIsTilted>(reader, lidar_is_tilted_);
-        set_fields_[48] = true;
-        break;
-      }
-      case 44: {
-        clear_data();
-        data_ = DataOneof::kLidarIsNotTiltedAnymore;
-        DeserializeField<logs::LidarIsNotTiltedAnymore>(reader, lidar_is_not_tilted_anymore_);
-        set_fields_[49] = true;
-        break;
-      }
-      case 45: {
-        clear_data();
-        data_ = DataOneof::kLidarHasBeenAutomaticallyRecalibrated;
-        DeserializeField<logs::LidarHasBeenAutomaticallyRecalibrated>(reader, lidar_has_been_automatically_recalibrated_);
-        set_fields_[50] = true;
-        break;
-      }
-      case 207: {
-        clear_data();
-        data_ = DataOneof::kLidarAutoCorrectionFailed;
-        DeserializeField<logs::LidarAutoCorrectionFailed>(reader, lidar_auto_correction_failed_);
-        set_fields_[51] = true;
-        break;
-      }
-      case 208: {
-        clear_data();
-        data_ = DataOneof::kLidarIcpFailed;
-        DeserializeField<logs::LidarIcpFailed>(reader, lidar_icp_failed_);
-        set_fields_[52] = true;
-        break;
-      }
-      case 46: {
-        clear_data();
-        data_ = DataOneof::kReceivedFirstDataForLidar;
-        DeserializeField<logs::ReceivedFirstDataForLidar>(reader, received_first_data_for_lidar_);
-        set_fields_[53] = true;
-        break;
-      }
-      case 47: {
-        clear_data();
-        data_ = DataOneof::kTerminationFailureError;
-        DeserializeField<logs::TerminationFailureError>(reader, termination_failure_error_);
-        set_fields_[54] = true;
-        break;
-      }
-      case 48: {
-        clear_data();
-        data_ = DataOneof::kFrameProcessingError;
-        DeserializeField<logs::FrameProcessingError>(reader, frame_processing_error_);
-        set_fields_[55] = true;
-        break;
-      }
-      case 49: {
-        clear_data();
-        data_ = DataOneof::kThreadPoolUnavailableError;
-        DeserializeField<logs::ThreadPoolUnavailableError>(reader, thread_pool_unavailable_error_);
-        set_fields_[56] = true;
-        break;
-      }
-      case 50: {
-        clear_data();
-        data_ = DataOneof::kInvalidArgument;
-        DeserializeField<logs::InvalidArgument>(reader, invalid_argument_);
-        set_fields_[57] = true;
-        break;
-      }
-      case 51: {
-        clear_data();
-        data_ = DataOneof::kComponentInitializationFailureFatal;
-        DeserializeField<logs::ComponentInitializationFailureFatal>(reader, component_initialization_failure_fatal_);
-        set_fields_[58] = true;
-        break;
-      }
-      case 52: {
-        clear_data();
-        data_ = DataOneof::kUnhandledEnumCaseError;
-        DeserializeField<logs::UnhandledEnumCaseError>(reader, unhandled_enum_case_error_);
-        set_fields_[59] = true;
-        break;
-      }
-      case 53: {
-        clear_data();
-        data_ = DataOneof::kBagEmptyError;
-        DeserializeField<logs::BagEmptyError>(reader, bag_empty_error_);
-        set_fields_[60] = true;
-        break;
-      }
-      case 54: {
-        clear_data();
-        data_ = DataOneof::kDiscardingDataError;
-        DeserializeField<logs::DiscardingDataError>(reader, discarding_data_error_);
-        set_fields_[61] = true;
-        break;
-      }
-      case 55: {
-        clear_data();
-        data_ = DataOneof::kDiscardingDataWarning;
-        DeserializeField<logs::DiscardingDataWarning>(reader, discarding_data_warning_);
-        set_fields_[62] = true;
-        break;
-      }
-      case 56: {
-        clear_data();
-        data_ = DataOneof::kNothingToProcess;
-        DeserializeField<logs::NothingToProcess>(reader, nothing_to_process_);
-        set_fields_[63] = true;
-        break;
-      }
-      case 57: {
-        clear_data();
-        data_ = DataOneof::kInvalidComponentConfiguration;
-        DeserializeField<logs::InvalidComponentConfiguration>(reader, invalid_component_configuration_);
-        set_fields_[64] = true;
-        break;
-      }
-      case 58: {
-        clear_data();
-        data_ = DataOneof::kChannelReceiverNotFoundWarning;
-        DeserializeField<logs::ChannelReceiverNotFoundWarning>(reader, channel_receiver_not_found_warning_);
-        set_fields_[65] = true;
-        break;
-      }
-      case 59: {
-        clear_data();
-        data_ = DataOneof::kModelLoadFailure;
-        DeserializeField<logs::ModelLoadFailure>(reader, model_load_failure_);
-        set_fields_[66] = true;
-        break;
-      }
-      case 60: {
-        clear_data();
-        data_ = DataOneof::kModelExecutionFailureError;
-        DeserializeField<logs::ModelExecutionFailureError>(reader, model_execution_failure_error_);
-        set_fields_[67] = true;
-        break;
-      }
-      case 61: {
-        clear_data();
-        data_ = DataOneof::kServiceReadyInfo;
-        DeserializeField<logs::ServiceReadyInfo>(reader, service_ready_info_);
-        set_fields_[68] = true;
-        break;
-      }
-      case 62: {
-        clear_data();
-        data_ = DataOneof::kModelPreparingInfo;
-        DeserializeField<logs::ModelPreparingInfo>(reader, model_preparing_info_);
-        set_fields_[69] = true;
-        break;
-      }
-      case 63: {
-        clear_data();
-        data_ = DataOneof::kModelInitializedInfo;
-        DeserializeField<logs::ModelInitializedInfo>(reader, model_initialized_info_);
-        set_fields_[70] = true;
-        break;
-      }
-      case 64: {
-        clear_data();
-        data_ = DataOneof::kModelInitializationFailureWarning;
-        DeserializeField<logs::ModelInitializationFailureWarning>(reader, model_initialization_failure_warning_);
-        set_fields_[71] = true;
-        break;
-      }
-      case 65: {
-        clear_data();
-        data_ = DataOneof::kRosSpinnerStoppedWarning;
-        DeserializeField<logs::RosSpinnerStoppedWarning>(reader, ros_spinner_stopped_warning_);
-        set_fields_[72] = true;
-        break;
-      }
-      case 66: {
-        clear_data();
-        data_ = DataOneof::kActorSystemUnavailableError;
-        DeserializeField<logs::ActorSystemUnavailableError>(reader, actor_system_unavailable_error_);
-        set_fields_[73] = true;
-        break;
-      }
-      case 67: {
-        clear_data();
-        data_ = DataOneof::kConfigNodeNotFoundError;
-        DeserializeField<logs::ConfigNodeNotFoundError>(reader, config_node_not_found_error_);
-        set_fields_[74] = true;
-        break;
-      }
-      case 68: {
-        clear_data();
-        data_ = DataOneof::kBagTimestampOutOfOrderError;
-        DeserializeField<logs::BagTimestampOutOfOrderError>(reader, bag_timestamp_out_of_order_error_);
-        set_fields_[75] = true;
-        break;
-      }
-      case 69: {
-        clear_data();
-        data_ = DataOneof::kBagReplayUnexpectedTimestampError;
-        DeserializeField<logs::BagReplayUnexpectedTimestampError>(reader, bag_replay_unexpected_timestamp_error_);
-        set_fields_[76] = true;
-        break;
-      }
-      case 70: {
-        clear_data();
-        data_ = DataOneof::kWebsocketClosedInfo;
-        DeserializeField<logs::WebsocketClosedInfo>(reader, websocket_closed_info_);
-        set_fields_[77] = true;
-        break;
-      }
-      case 71: {
-        clear_data();
-        data_ = DataOneof::kWebsocketOpenedInfo;
-        DeserializeField<logs::WebsocketOpenedInfo>(reader, websocket_opened_info_);
-        set_fields_[78] = true;
-        break;
-      }
-      case 72: {
-        clear_data();
-        data_ = DataOneof::kSubscriberDisconnectedInfo;
-        DeserializeField<logs::SubscriberDisconnectedInfo>(reader, subscriber_disconnected_info_);
-        set_fields_[79] = true;
-        break;
-      }
-      case 73: {
-        clear_data();
-        data_ = DataOneof::kThreadPoolSlowingDownWarning;
-        DeserializeField<logs::ThreadPoolSlowingDownWarning>(reader, thread_pool_slowing_down_warning_);
-        set_fields_[80] = true;
-        break;
-      }
-      case 74: {
-        clear_data();
-        data_ = DataOneof::kThreadPoolNotRespondingWarning;
-        DeserializeField<logs::ThreadPoolNotRespondingWarning>(reader, thread_pool_not_responding_warning_);
-        set_fields_[81] = true;
-        break;
-      }
-      case 75: {
-        clear_data();
-        data_ = DataOneof::kThreadPoolBrokenPromiseWarning;
-        DeserializeField<logs::ThreadPoolBrokenPromiseWarning>(reader, thread_pool_broken_promise_warning_);
-        set_fields_[82] = true;
-        break;
-      }
-      case 76: {
-        clear_data();
-        data_ = DataOneof::kBoxFittingPointsBelowBaseWarning;
-        DeserializeField<logs::BoxFittingPointsBelowBaseWarning>(reader, box_fitting_points_below_base_warning_);
-        set_fields_[83] = true;
-        break;
-      }
-      case 77: {
-        clear_data();
-        data_ = DataOneof::kFailedToRemoveStalePointsWarning;
-        DeserializeField<logs::FailedToRemoveStalePointsWarning>(reader, failed_to_remove_stale_points_warning_);
-        set_fields_[84] = true;
-        break;
-      }
-      case 78: {
-        clear_data();
-        data_ = DataOneof::kIrregularBroadcastingPeriodWarning;
-        DeserializeField<logs::IrregularBroadcastingPeriodWarning>(reader, irregular_broadcasting_period_warning_);
-        set_fields_[85] = true;
-        break;
-      }
-      case 79: {
-        clear_data();
-        data_ = DataOneof::kClustererPointsOutOfRangeWarning;
-        DeserializeField<logs::ClustererPointsOutOfRangeWarning>(reader, clusterer_points_out_of_range_warning_);
-        set_fields_[86] = true;
-        break;
-      }
-      case 80: {
-        clear_data();
-        data_ = DataOneof::kInternalError;
-        DeserializeField<logs::InternalError>(reader, internal_error_);
-        set_fields_[87] = true;
-        break;
-      }
-      case 81: {
-        clear_data();
-        data_ = DataOneof::kInternalFatal;
-        DeserializeField<logs::InternalFatal>(reader, internal_fatal_);
-        set_fields_[88] = true;
-        break;
-      }
-      case 82: {
-        clear_data();
-        data_ = DataOneof::kServiceStartingInfo;
-        DeserializeField<logs::ServiceStartingInfo>(reader, service_starting_info_);
-        set_fields_[89] = true;
-        break;
-      }
-      case 83: {
-        clear_data();
-        data_ = DataOneof::kConfigNodeNotFoundFatal;
-        DeserializeField<logs::ConfigNodeNotFoundFatal>(reader, config_node_not_found_fatal_);
-        set_fields_[90] = true;
-        break;
-      }
-      case 84: {
-        clear_data();
-        data_ = DataOneof::kServiceSetupError;
-        DeserializeField<logs::ServiceSetupError>(reader, service_setup_error_);
-        set_fields_[91] = true;
-        break;
-      }
-      case 85: {
-        clear_data();
-        data_ = DataOneof::kFilesystemError;
-        DeserializeField<logs::FilesystemError>(reader, filesystem_error_);
-        set_fields_[92] = true;
-        break;
-      }
-      case 86: {
-        clear_data();
-        data_ = DataOneof::kInvalidPresetWarning;
-        DeserializeField<logs::InvalidPresetWarning>(reader, invalid_preset_warning_);
-        set_fields_[93] = true;
-        break;
-      }
-      case 87: {
-        clear_data();
-        data_ = DataOneof::kWebsocketFailedClearPendingError;
-        DeserializeField<logs::WebsocketFailedClearPendingError>(reader, websocket_failed_clear_pending_error_);
-        set_fields_[94] = true;
-        break;
-      }
-      case 88: {
-        clear_data();
-        data_ = DataOneof::kWebsocketFailedToStopError;
-        DeserializeField<logs::WebsocketFailedToStopError>(reader, websocket_failed_to_stop_error_);
-        set_fields_[95] = true;
-        break;
-      }
-      case 89: {
-        clear_data();
-        data_ = DataOneof::kWebsocketFailedToCreateError;
-        DeserializeField<logs::WebsocketFailedToCreateError>(reader, websocket_failed_to_create_error_);
-        set_fields_[96] = true;
-        break;
-      }
-      case 90: {
-        clear_data();
-        data_ = DataOneof::kUnexpectedRpcError;
-        DeserializeField<logs::UnexpectedRpcError>(reader, unexpected_rpc_error_);
-        set_fields_[97] = true;
-        break;
-      }
-      case 91: {
-        clear_data();
-        data_ = DataOneof::kLicensePollFailed;
-        DeserializeField<logs::LicensePollFailed>(reader, license_poll_failed_);
-        set_fields_[98] = true;
-        break;
-      }
-      case 92: {
-        clear_data();
-        data_ = DataOneof::kLicenseExpiredWarning;
-        DeserializeField<logs::LicenseExpiredWarning>(reader, license_expired_warning_);
-        set_fields_[99] = true;
-        break;
-      }
-      case 93: {
-        clear_data();
-        data_ = DataOneof::kLicenseUsageExceededWarning;
-        DeserializeField<logs::LicenseUsageExceededWarning>(reader, license_usage_exceeded_warning_);
-        set_fields_[100] = true;
-        break;
-      }
-      case 94: {
-        clear_data();
-        data_ = DataOneof::kStaticThreadPoolSlowTaskWarning;
-        DeserializeField<logs::StaticThreadPoolSlowTaskWarning>(reader, static_thread_pool_slow_task_warning_);
-        set_fields_[101] = true;
-        break;
-      }
-      case 95: {
-        clear_data();
-        data_ = DataOneof::kRpcUnsupportedServiceWarning;
-        DeserializeField<logs::RpcUnsupportedServiceWarning>(reader, rpc_unsupported_service_warning_);
-        set_fields_[102] = true;
-        break;
-      }
-      case 96: {
-        clear_data();
-        data_ = DataOneof::kWebsocketHandlerProblem;
-        DeserializeField<logs::WebsocketHandlerProblem>(reader, websocket_handler_problem_);
-        set_fields_[103] = true;
-        break;
-      }
-      case 97: {
-        clear_data();
-        data_ = DataOneof::kWebsocketDeserializeError;
-        DeserializeField<logs::WebsocketDeserializeError>(reader, websocket_deserialize_error_);
-        set_fields_[104] = true;
-        break;
-      }
-      case 98: {
-        clear_data();
-        data_ = DataOneof::kWebsocketExpiredRpcEndpointWarning;
-        DeserializeField<logs::WebsocketExpiredRpcEndpointWarning>(reader, websocket_expired_rpc_endpoint_warning_);
-        set_fields_[105] = true;
-        break;
-      }
-      case 99: {
-        clear_data();
-        data_ = DataOneof::kWebsocketQueueOverloadedWarning;
-        DeserializeField<logs::WebsocketQueueOverloadedWarning>(reader, websocket_queue_overloaded_warning_);
-        set_fields_[106] = true;
-        break;
-      }
-      case 100: {
-        clear_data();
-        data_ = DataOneof::kRpcFailedToNotifyWarning;
-        DeserializeField<logs::RpcFailedToNotifyWarning>(reader, rpc_failed_to_notify_warning_);
-        set_fields_[107] = true;
-        break;
-      }
-      case 101: {
-        clear_data();
-        data_ = DataOneof::kConfigSubscriptionFailedWarning;
-        DeserializeField<logs::ConfigSubscriptionFailedWarning>(reader, config_subscription_failed_warning_);
-        set_fields_[108] = true;
-        break;
-      }
-      case 102: {
-        clear_data();
-        data_ = DataOneof::kThreadPoolClampedWorkersWarning;
-        DeserializeField<logs::ThreadPoolClampedWorkersWarning>(reader, thread_pool_clamped_workers_warning_);
-        set_fields_[109] = true;
-        break;
-      }
-      case 103: {
-        clear_data();
-        data_ = DataOneof::kStoppingHorusBagRecorderAlreadyStopped;
-        DeserializeField<logs::StoppingHorusBagRecorderAlreadyStopped>(reader, stopping_horus_bag_recorder_already_stopped_);
-        set_fields_[110] = true;
-        break;
-      }
-      case 104: {
-        clear_data();
-        data_ = DataOneof::kRecorderConfigUpdateWhileRunning;
-        DeserializeField<logs::RecorderConfigUpdateWhileRunning>(reader, recorder_config_update_while_running_);
-        set_fields_[111] = true;
-        break;
-      }
-      case 105: {
-        clear_data();
-        data_ = DataOneof::kClampingDataWarning;
-        DeserializeField<logs::ClampingDataWarning>(reader, clamping_data_warning_);
-        set_fields_[112] = true;
-        break;
-      }
-      case 106: {
-        clear_data();
-        data_ = DataOneof::kLidarIncompatibleValues;
-        DeserializeField<logs::LidarIncompatibleValues>(reader, lidar_incompatible_values_);
-        set_fields_[113] = true;
-        break;
-      }
-      case 107: {
-        clear_data();
-        data_ = DataOneof::kCannotDetermineContainerIdError;
-        DeserializeField<logs::CannotDetermineContainerIdError>(reader, cannot_determine_container_id_error_);
-        set_fields_[114] = true;
-        break;
-      }
-      case 108: {
-        clear_data();
-        data_ = DataOneof::kStartedLidarDriver;
-        DeserializeField<logs::StartedLidarDriver>(reader, started_lidar_driver_);
-        set_fields_[115] = true;
-        break;
-      }
-      case 109: {
-        clear_data();
-        data_ = DataOneof::kCannotStartLidarDriver;
-        DeserializeField<logs::CannotStartLidarDriver>(reader, cannot_start_lidar_driver_);
-        set_fields_[116] = true;
-        break;
-      }
-      case 110: {
-        clear_data();
-        data_ = DataOneof::kStoppedLidarDriver;
-        DeserializeField<logs::StoppedLidarDriver>(reader, stopped_lidar_driver_);
-        set_fields_[117] = true;
-        break;
-      }
-      case 111: {
-        clear_data();
-        data_ = DataOneof::kCannotStopLidarDriver;
-        DeserializeField<logs::CannotStopLidarDriver>(reader, cannot_stop_lidar_driver_);
-        set_fields_[118] = true;
-        break;
-      }
-      case 112: {
-        clear_data();
-        data_ = DataOneof::kRestartedLidarDriver;
-        DeserializeField<logs::RestartedLidarDriver>(reader, restarted_lidar_driver_);
-        set_fields_[119] = true;
-        break;
-      }
-      case 113: {
-        clear_data();
-        data_ = DataOneof::kCannotRestartLidarDriver;
-        DeserializeField<logs::CannotRestartLidarDriver>(reader, cannot_restart_lidar_driver_);
-        set_fields_[120] = true;
-        break;
-      }
-      case 114: {
-        clear_data();
-        data_ = DataOneof::kRemovedUnusedLidarDriver;
-        DeserializeField<logs::RemovedUnusedLidarDriver>(reader, removed_unused_lidar_driver_);
-        set_fields_[121] = true;
-        break;
-      }
-      case 115: {
-        clear_data();
-        data_ = DataOneof::kCannotRemoveUnusedLidarDriver;
-        DeserializeField<logs::CannotRemoveUnusedLidarDriver>(reader, cannot_remove_unused_lidar_driver_);
-        set_fields_[122] = true;
-        break;
-      }
-      case 116: {
-        clear_data();
-        data_ = DataOneof::kLidarDriverGcFailure;
-        DeserializeField<logs::LidarDriverGcFailure>(reader, lidar_driver_gc_failure_);
-        set_fields_[123] = true;
-        break;
-      }
-      case 117: {
-        clear_data();
-        data_ = DataOneof::kIdSpaceExhausted;
-        DeserializeField<logs::IdSpaceExhausted>(reader, id_space_exhausted_);
-        set_fields_[124] = true;
-        break;
-      }
-      case 118: {
-        clear_data();
-        data_ = DataOneof::kPreprocessingToPointAggregatorPointsSkipped;
-        DeserializeField<logs::PreprocessingToPointAggregatorPointsSkipped>(reader, preprocessing_to_point_aggregator_points_skipped_);
-        set_fields_[125] = true;
-        break;
-      }
-      case 119: {
-        clear_data();
-        data_ = DataOneof::kMinMsgIntervalLessThanThreshold;
-        DeserializeField<logs::MinMsgIntervalLessThanThreshold>(reader, min_msg_interval_less_than_threshold_);
-        set_fields_[126] = true;
-        break;
-      }
-      case 120: {
-        clear_data();
-        data_ = DataOneof::kFailedToCleanupRosWarning;
-        DeserializeField<logs::FailedToCleanupRosWarning>(reader, failed_to_cleanup_ros_warning_);
-        set_fields_[127] = true;
-        break;
-      }
-      case 121: {
-        clear_data();
-        data_ = DataOneof::kRpcDisconnectedWarning;
-        DeserializeField<logs::RpcDisconnectedWarning>(reader, rpc_disconnected_warning_);
-        set_fields_[128] = true;
-        break;
-      }
-      case 122: {
-        clear_data();
-        data_ = DataOneof::kRpcUnhandledError;
-        DeserializeField<logs::RpcUnhandledError>(reader, rpc_unhandled_error_);
-        set_fields_[129] = true;
-        break;
-      }
-      case 123: {
-        clear_data();
-        data_ = DataOneof::kTimeDiffOutOfRangeWarning;
-        DeserializeField<logs::TimeDiffOutOfRangeWarning>(reader, time_diff_out_of_range_warning_);
-        set_fields_[130] = true;
-        break;
-      }
-      case 124: {
-        clear_data();
-        data_ = DataOneof::kTensorrtLog;
-        DeserializeField<logs::TensorrtLog>(reader, tensorrt_log_);
-        set_fields_[131] = true;
-        break;
-      }
-      case 125: {
-        clear_data();
-        data_ = DataOneof::kBuildingTensorrtEngineInfo;
-        DeserializeField<logs::BuildingTensorrtEngineInfo>(reader, building_tensorrt_engine_info_);
-        set_fields_[132] = true;
-        break;
-      }
-      case 126: {
-        clear_data();
-        data_ = DataOneof::kLoadingTensorrtEngineInfo;
-        DeserializeField<logs::LoadingTensorrtEngineInfo>(reader, loading_tensorrt_engine_info_);
-        set_fields_[133] = true;
-        break;
-      }
-      case 127: {
-        clear_data();
-        data_ = DataOneof::kCalibrationMapNotFound;
-        DeserializeField<logs::CalibrationMapNotFound>(reader, calibration_map_not_found_);
-        set_fields_[134] = true;
-        break;
-      }
-      case 128: {
-        clear_data();
-        data_ = DataOneof::kCalibrationMapNotValid;
-        DeserializeField<logs::CalibrationMapNotValid>(reader, calibration_map_not_valid_);
-        set_fields_[135] = true;
-        break;
-      }
-      case 129: {
-        clear_data();
-        data_ = DataOneof::kCalibrationMapPathAlreadyExists;
-        DeserializeField<logs::CalibrationMapPathAlreadyExists>(reader, calibration_map_path_already_exists_);
-        set_fields_[136] = true;
-        break;
-      }
-      case 130: {
-        clear_data();
-        data_ = DataOneof::kFailedToSaveCalibrationMap;
-        DeserializeField<logs::FailedToSaveCalibrationMap>(reader, failed_to_save_calibration_map_);
-        set_fields_[137] = true;
-        break;
-      }
-      case 131: {
-        clear_data();
-        data_ = DataOneof::kFailedToRemoveCalibrationMap;
-        DeserializeField<logs::FailedToRemoveCalibrationMap>(reader, failed_to_remove_calibration_map_);
-        set_fields_[138] = true;
-        break;
-      }
-      case 132: {
-        clear_data();
-        data_ = DataOneof::kFailedToIterateInDirectory;
-        DeserializeField<logs::FailedToIterateInDirectory>(reader, failed_to_iterate_in_directory_);
-        set_fields_[139] = true;
-        break;
-      }
-      case 133: {
-        clear_data();
-        data_ = DataOneof::kMapBasedCalibrationWithoutMapLoading;
-        DeserializeField<logs::MapBasedCalibrationWithoutMapLoading>(reader, map_based_calibration_without_map_loading_);
-        set_fields_[140] = true;
-        break;
-      }
-      case 134: {
-        clear_data();
-        data_ = DataOneof::kMapBasedCalibrationAlreadyRunning;
-        DeserializeField<logs::MapBasedCalibrationAlreadyRunning>(reader, map_based_calibration_already_running_);
-        set_fields_[141] = true;
-        break;
-      }
-      case 135: {
-        clear_data();
-        data_ = DataOneof::kCancelMapBasedCalibrationNotRunning;
-        DeserializeField<logs::CancelMapBasedCalibrationNotRunning>(reader, cancel_map_based_calibration_not_running_);
-        set_fields_[142] = true;
-        break;
-      }
-      case 136: {
-        clear_data();
-        data_ = DataOneof::kBagStreamNotFound;
-        DeserializeField<logs::BagStreamNotFound>(reader, bag_stream_not_found_);
-        set_fields_[143] = true;
-        break;
-      }
-      case 137: {
-        clear_data();
-        data_ = DataOneof::kEvaluationBagStartedInfo;
-        DeserializeField<logs::EvaluationBagStartedInfo>(reader, evaluation_bag_started_info_);
-        set_fields_[144] = true;
-        break;
-      }
-      case 138: {
-        clear_data();
-        data_ = DataOneof::kEvaluationBagFinishedInfo;
-        DeserializeField<logs::EvaluationBagFinishedInfo>(reader, evaluation_bag_finished_info_);
-        set_fields_[145] = true;
-        break;
-      }
-      case 139: {
-        clear_data();
-        data_ = DataOneof::kBagNotFound;
-        DeserializeField<logs::BagNotFound>(reader, bag_not_found_);
-        set_fields_[146] = true;
-        break;
-      }
-      case 140: {
-        clear_data();
-        data_ = DataOneof::kBuildingPipelineInfo;
-        DeserializeField<logs::BuildingPipelineInfo>(reader, building_pipeline_info_);
-        set_fields_[147] = true;
-        break;
-      }
-      case 141: {
-        clear_data();
-        data_ = DataOneof::kBagIsNotEvaluation;
-        DeserializeField<logs::BagIsNotEvaluation>(reader, bag_is_not_evaluation_);
-        set_fields_[148] = true;
-        break;
-      }
-      case 142: {
-        clear_data();
-        data_ = DataOneof::kHorusBagRunning;
-        DeserializeField<logs::HorusBagRunning>(reader, horus_bag_running_);
-        set_fields_[149] = true;
-        break;
-      }
-      case 143: {
-        clear_data();
-        data_ = DataOneof::kAutoGroundCalibrationWarning;
-        DeserializeField<logs::AutoGroundCalibrationWarning>(reader, auto_ground_calibration_warning_);
-        set_fields_[150] = true;
-        break;
-      }
-      case 144: {
-        clear_data();
-        data_ = DataOneof::kAutoGroundCalibrationError;
-        DeserializeField<logs::AutoGroundCalibrationError>(reader, auto_ground_calibration_error_);
-        set_fields_[151] = true;
-        break;
-      }
-      case 151: {
-        clear_data();
-        data_ = DataOneof::kObjectDetectorNotLoadedWarning;
-        DeserializeField<logs::ObjectDetectorNotLoadedWarning>(reader, object_detector_not_loaded_warning_);
-        set_fields_[152] = true;
-        break;
-      }
-      case 152: {
-        clear_data();
-        data_ = DataOneof::kCalibrationIsRunningError;
-        DeserializeField<logs::CalibrationIsRunningError>(reader, calibration_is_running_error_);
-        set_fields_[153] = true;
-        break;
-      }
-      case 153: {
-        clear_data();
-        data_ = DataOneof::kModelInitInProgressInfo;
-        DeserializeField<logs::ModelInitInProgressInfo>(reader, model_init_in_progress_info_);
-        set_fields_[154] = true;
-        break;
-      }
-      case 154: {
-        clear_data();
-        data_ = DataOneof::kRpcTimeoutWithResolutionWarning;
-        DeserializeField<logs::RpcTimeoutWithResolutionWarning>(reader, rpc_timeout_with_resolution_warning_);
-        set_fields_[155] = true;
-        break;
-      }
-      case 155: {
-        clear_data();
-        data_ = DataOneof::kCalibrationWasCancelledInfo;
-        DeserializeField<logs::CalibrationWasCancelledInfo>(reader, calibration_was_cancelled_info_);
-        set_fields_[156] = true;
-        break;
-      }
-      case 156: {
-        clear_data();
-        data_ = DataOneof::kCalibrationMapRecordingFailedToStart;
-        DeserializeField<logs::CalibrationMapRecordingFailedToStart>(reader, calibration_map_recording_failed_to_start_);
-        set_fields_[157] = true;
-        break;
-      }
-      case 157: {
-        clear_data();
-        data_ = DataOneof::kDetectionPipelineRequestedResetInfo;
-        DeserializeField<logs::DetectionPipelineRequestedResetInfo>(reader, detection_pipeline_requested_reset_info_);
-        set_fields_[158] = true;
-        break;
-      }
-      case 158: {
-        clear_data();
-        data_ = DataOneof::kPreprocessingServicePipelineUnavailable;
-        DeserializeField<logs::PreprocessingServicePipelineUnavailable>(reader, preprocessing_service_pipeline_unavailable_);
-        set_fields_[159] = true;
-        break;
-      }
-      case 159: {
-        clear_data();
-        data_ = DataOneof::kCircularRecordingDisabledWarning;
-        DeserializeField<logs::CircularRecordingDisabledWarning>(reader, circular_recording_disabled_warning_);
-        set_fields_[160] = true;
-        break;
-      }
-      case 160: {
-        clear_data();
-        data_ = DataOneof::kSnapshotAlreadyRunningWarning;
-        DeserializeField<logs::SnapshotAlreadyRunningWarning>(reader, snapshot_already_running_warning_);
-        set_fields_[161] = true;
-        break;
-      }
-      case 161: {
-        clear_data();
-        data_ = DataOneof::kActiveProjectChangedInfo;
-        DeserializeField<logs::ActiveProjectChangedInfo>(reader, active_project_changed_info_);
-        set_fields_[162] = true;
-        break;
-      }
-      case 162: {
-        clear_data();
-        data_ = DataOneof::kProjectConfigUpdatedInfo;
-        DeserializeField<logs::ProjectConfigUpdatedInfo>(reader, project_config_updated_info_);
-        set_fields_[163] = true;
-        break;
-      }
-      case 163: {
-        clear_data();
-        data_ = DataOneof::kInvalidLidarTimestamp;
-        DeserializeField<logs::InvalidLidarTimestamp>(reader, invalid_lidar_timestamp_);
-        set_fields_[164] = true;
-        break;
-      }
-      case 164: {
-        clear_data();
-        data_ = DataOneof::kCalibrationAccumulatingPointsInfo;
-        DeserializeField<logs::CalibrationAccumulatingPointsInfo>(reader, calibration_accumulating_points_info_);
-        set_fields_[165] = true;
-        break;
-      }
-      case 165: {
-        clear_data();
-        data_ = DataOneof::kSparseNoiseFilterUsageNonRotationalLidars;
-        DeserializeField<logs::SparseNoiseFilterUsageNonRotationalLidars>(reader, sparse_noise_filter_usage_non_rotational_lidars_);
-        set_fields_[166] = true;
-        break;
-      }
-      case 166: {
-        clear_data();
-        data_ = DataOneof::kFileWriteWarning;
-        DeserializeField<logs::FileWriteWarning>(reader, file_write_warning_);
-        set_fields_[167] = true;
-        break;
-      }
-      case 167: {
-        clear_data();
-        data_ = DataOneof::kLicenseForbiddenFeature;
-        DeserializeField<logs::LicenseForbiddenFeature>(reader, license_forbidden_feature_);
-        set_fields_[168] = true;
-        break;
-      }
-      case 168: {
-        clear_data();
-        data_ = DataOneof::kFailedToUpdateConfiguration;
-        DeserializeField<logs::FailedToUpdateConfiguration>(reader, failed_to_update_configuration_);
-        set_fields_[169] = true;
-        break;
-      }
-      case 169: {
-        clear_data();
-        data_ = DataOneof::kObstructionDetectorBadReferenceWarning;
-        DeserializeField<logs::ObstructionDetectorBadReferenceWarning>(reader, obstruction_detector_bad_reference_warning_);
-        set_fields_[170] = true;
-        break;
-      }
-      case 170: {
-        clear_data();
-        data_ = DataOneof::kProjectFileInvalidPermissionsError;
-        DeserializeField<logs::ProjectFileInvalidPermissionsError>(reader, project_file_invalid_permissions_error_);
-        set_fields_[171] = true;
-        break;
-      }
-      case 171: {
-        clear_data();
-        data_ = DataOneof::kPipelineSchedulerError;
-        DeserializeField<logs::PipelineSchedulerError>(reader, pipeline_scheduler_error_);
-        set_fields_[172] = true;
-        break;
-      }
-      case 172: {
-        clear_data();
-        data_ = DataOneof::kMultiLidarCalibrationWarning;
-        DeserializeField<logs::MultiLidarCalibrationWarning>(reader, multi_lidar_calibration_warning_);
-        set_fields_[173] = true;
-        break;
-      }
-      case 173: {
-        clear_data();
-        data_ = DataOneof::kMultiLidarCalibrationError;
-        DeserializeField<logs::MultiLidarCalibrationError>(reader, multi_lidar_calibration_error_);
-        set_fields_[174] = true;
-        break;
-      }
-      case 174: {
-        clear_data();
-        data_ = DataOneof::kOldBagWarning;
-        DeserializeField<logs::OldBagWarning>(reader, old_bag_warning_);
-        set_fields_[175] = true;
-        break;
-      }
-      case 175: {
-        clear_data();
-        data_ = DataOneof::kUpgradingBagInfo;
-        DeserializeField<logs::UpgradingBagInfo>(reader, upgrading_bag_info_);
-        set_fields_[176] = true;
-        break;
-      }
-      case 176: {
-        clear_data();
-        data_ = DataOneof::kBagCalibrationSaveFailed;
-        DeserializeField<logs::BagCalibrationSaveFailed>(reader, bag_calibration_save_failed_);
-        set_fields_[177] = true;
-        break;
-      }
-      case 177: {
-        clear_data();
-        data_ = DataOneof::kBagUpgradeFailed;
-        DeserializeField<logs::BagUpgradeFailed>(reader, bag_upgrade_failed_);
-        set_fields_[178] = true;
-        break;
-      }
-      case 178: {
-        clear_data();
-        data_ = DataOneof::kUnknownLidarError;
-        DeserializeField<logs::UnknownLidarError>(reader, unknown_lidar_error_);
-        set_fields_[179] = true;
-        break;
-      }
-      case 179: {
-        clear_data();
-        data_ = DataOneof::kInvalidPointCloudWarning;
-        DeserializeField<logs::InvalidPointCloudWarning>(reader, invalid_point_cloud_warning_);
-        set_fields_[180] = true;
-        break;
-      }
-      case 180: {
-        clear_data();
-        data_ = DataOneof::kLidarIsDroppingPackets;
-        DeserializeField<logs::LidarIsDroppingPackets>(reader, lidar_is_dropping_packets_);
-        set_fields_[181] = true;
-        break;
-      }
-      case 181: {
-        clear_data();
-        data_ = DataOneof::kRemovedInvalidLidarsFromConfigWarning;
-        DeserializeField<logs::RemovedInvalidLidarsFromConfigWarning>(reader, removed_invalid_lidars_from_config_warning_);
-        set_fields_[182] = true;
-        break;
-      }
-      case 182: {
-        clear_data();
-        data_ = DataOneof::kCalibrationMapRecordingFailed;
-        DeserializeField<logs::CalibrationMapRecordingFailed>(reader, calibration_map_recording_failed_);
-        set_fields_[183] = true;
-        break;
-      }
-      case 183: {
-        clear_data();
-        data_ = DataOneof::kDetectionNodeNotFoundError;
-        DeserializeField<logs::DetectionNodeNotFoundError>(reader, detection_node_not_found_error_);
-        set_fields_[184] = true;
-        break;
-      }
-      case 184: {
-        clear_data();
-        data_ = DataOneof::kCreatedVersionBackupInfo;
-        DeserializeField<logs::CreatedVersionBackupInfo>(reader, created_version_backup_info_);
-        set_fields_[185] = true;
-        break;
-      }
-      case 185: {
-        clear_data();
-        data_ = DataOneof::kPlyFileLoadFailedError;
-        DeserializeField<logs::PlyFileLoadFailedError>(reader, ply_file_load_failed_error_);
-        set_fields_[186] = true;
-        break;
-      }
-      case 186: {
-        clear_data();
-        data_ = DataOneof::kHesaiDriverLifecycle;
-        DeserializeField<logs::HesaiDriverLifecycle>(reader, hesai_driver_lifecycle_);
-        set_fields_[187] = true;
-        break;
-      }
-      case 187: {
-        clear_data();
-        data_ = DataOneof::kHesaiDriverError;
-        DeserializeField<logs::HesaiDriverError>(reader, hesai_driver_error_);
-        set_fields_[188] = true;
-        break;
-      }
-      case 188: {
-        clear_data();
-        data_ = DataOneof::kHesaiPacketProcessingFailed;
-        DeserializeField<logs::HesaiPacketProcessingFailed>(reader, hesai_packet_processing_failed_);
-        set_fields_[189] = true;
-        break;
-      }
-      case 189: {
-        clear_data();
-        data_ = DataOneof::kHesaiCorrectionFileError;
-        DeserializeField<logs::HesaiCorrectionFileError>(reader, hesai_correction_file_error_);
-        set_fields_[190] = true;
-        break;
-      }
-      case 190: {
-        clear_data();
-        data_ = DataOneof::kHesaiPacketStatistics;
-        DeserializeField<logs::HesaiPacketStatistics>(reader, hesai_packet_statistics_);
-        set_fields_[191] = true;
-        break;
-      }
-      case 191: {
-        clear_data();
-        data_ = DataOneof::kPlyFileWriteFailedError;
-        DeserializeField<logs::PlyFileWriteFailedError>(reader, ply_file_write_failed_error_);
-        set_fields_[192] = true;
-        break;
-      }
-      case 192: {
-        clear_data();
-        data_ = DataOneof::kProjectSaveError;
-        DeserializeField<logs::ProjectSaveError>(reader, project_save_error_);
-        set_fields_[193] = true;
-        break;
-      }
-      case 193: {
-        clear_data();
-        data_ = DataOneof::kSaveStaticEnvironmentSuccess;
-        DeserializeField<logs::SaveStaticEnvironmentSuccess>(reader, save_static_environment_success_);
-        set_fields_[194] = true;
-        break;
-      }
-      case 194: {
-        clear_data();
-        data_ = DataOneof::kSaveStaticEnvironmentFailed;
-        DeserializeField<logs::SaveStaticEnvironmentFailed>(reader, save_static_environment_failed_);
-        set_fields_[195] = true;
-        break;
-      }
-      case 195: {
-        clear_data();
-        data_ = DataOneof::kLoadStaticEnvironmentSuccess;
-        DeserializeField<logs::LoadStaticEnvironmentSuccess>(reader, load_static_environment_success_);
-        set_fields_[196] = true;
-        break;
-      }
-      case 196: {
-        clear_data();
-        data_ = DataOneof::kLoadStaticEnvironmentFailed;
-        DeserializeField<logs::LoadStaticEnvironmentFailed>(reader, load_static_environment_failed_);
-        set_fields_[197] = true;
-        break;
-      }
-      case 197: {
-        clear_data();
-        data_ = DataOneof::kAttemptToInjectInvalidLidarIdWarning;
-        DeserializeField<logs::AttemptToInjectInvalidLidarIdWarning>(reader, attempt_to_inject_invalid_lidar_id_warning_);
-        set_fields_[198] = true;
-        break;
-      }
-      case 198: {
-        clear_data();
-        data_ = DataOneof::kResetBundledPacketDueToUnexpectedPacket;
-        DeserializeField<logs::ResetBundledPacketDueToUnexpectedPacket>(reader, reset_bundled_packet_due_to_unexpected_packet_);
-        set_fields_[199] = true;
-        break;
-      }
-      case 199: {
-        clear_data();
-        data_ = DataOneof::kPacketBundlerDroppedPacketsWarning;
-        DeserializeField<logs::PacketBundlerDroppedPacketsWarning>(reader, packet_bundler_dropped_packets_warning_);
-        set_fields_[200] = true;
-        break;
-      }
-      case 200: {
-        clear_data();
-        data_ = DataOneof::kPacketBundlerFrameJumpWarning;
-        DeserializeField<logs::PacketBundlerFrameJumpWarning>(reader, packet_bundler_frame_jump_warning_);
-        set_fields_[201] = true;
-        break;
-      }
-      case 201: {
-        clear_data();
-        data_ = DataOneof::kLidarCorrectionLoadingSuccess;
-        DeserializeField<logs::LidarCorrectionLoadingSuccess>(reader, lidar_correction_loading_success_);
-        set_fields_[202] = true;
-        break;
-      }
-      case 202: {
-        clear_data();
-        data_ = DataOneof::kLidarCorrectionLoadingFailure;
-        DeserializeField<logs::LidarCorrectionLoadingFailure>(reader, lidar_correction_loading_failure_);
-        set_fields_[203] = true;
-        break;
-      }
-      case 203: {
-        clear_data();
-        data_ = DataOneof::kHesaiPacketStatisticsLidar;
-        DeserializeField<logs::HesaiPacketStatisticsLidar>(reader, hesai_packet_statistics_lidar_);
-        set_fields_[204] = true;
-        break;
-      }
-      case 204: {
-        clear_data();
-        data_ = DataOneof::kLidarTiltDetectionAlignedToCalibrationMapInfo;
-        DeserializeField<logs::LidarTiltDetectionAlignedToCalibrationMapInfo>(reader, lidar_tilt_detection_aligned_to_calibration_map_info_);
-        set_fields_[205] = true;
-        break;
-      }
-      case 205: {
-        clear_data();
-        data_ = DataOneof::kLidarTiltDetectionMisalignedToCalibrationMapWarning;
-        DeserializeField<logs::LidarTiltDetectionMisalignedToCalibrationMapWarning>(reader, lidar_tilt_detection_misaligned_to_calibration_map_warning_);
-        set_fields_[206] = true;
-        break;
-      }
-      case 209: {
-        clear_data();
-        data_ = DataOneof::kLidarOriginalPoseDiffersForAutoCorrectionError;
-        DeserializeField<logs::LidarOriginalPoseDiffersForAutoCorrectionError>(reader, lidar_original_pose_differs_for_auto_correction_error_);
-        set_fields_[207] = true;
-        break;
-      }
-      case 210: {
-        clear_data();
-        data_ = DataOneof::kRecoveredCarIdsInfo;
-        DeserializeField<logs::RecoveredCarIdsInfo>(reader, recovered_car_ids_info_);
-        set_fields_[208] = true;
-        break;
-      }
-      case 211: {
-        clear_data();
-        data_ = DataOneof::kFailedToRecoverCarIds;
-        DeserializeField<logs::FailedToRecoverCarIds>(reader, failed_to_recover_car_ids_);
-        set_fields_[209] = true;
-        break;
-      }
-      case 212: {
-        clear_data();
-        data_ = DataOneof::kFailedToEmplaceRecoveredCarId;
-        DeserializeField<logs::FailedToEmplaceRecoveredCarId>(reader, failed_to_emplace_recovered_car_id_);
-        set_fields_[210] = true;
-        break;
-      }
-      case 213: {
-        clear_data();
-        data_ = DataOneof::kPersistentStorageError;
-        DeserializeField<logs::PersistentStorageError>(reader, persistent_storage_error_);
-        set_fields_[211] = true;
-        break;
-      }
-      case 214: {
-        clear_data();
-        data_ = DataOneof::kTrackCapacityExceededWarning;
-        DeserializeField<logs::TrackCapacityExceededWarning>(reader, track_capacity_exceeded_warning_);
-        set_fields_[212] = true;
-        break;
-      }
-      case 215: {
-        clear_data();
-        data_ = DataOneof::kTrackerStatePathUnavailableWarning;
-        DeserializeField<logs::TrackerStatePathUnavailableWarning>(reader, tracker_state_path_unavailable_warning_);
-        set_fields_[213] = true;
-        break;
-      }
-      case 224: {
-        clear_data();
-        data_ = DataOneof::kTrackerStateRecoveryError;
-        DeserializeField<logs::TrackerStateRecoveryError>(reader, tracker_state_recovery_error_);
-        set_fields_[214] = true;
-        break;
-      }
-      case 225: {
-        clear_data();
-        data_ = DataOneof::kTrackerStateSaveError;
-        DeserializeField<logs::TrackerStateSaveError>(reader, tracker_state_save_error_);
-        set_fields_[215] = true;
-        break;
-      }
-      case 216: {
-        clear_data();
-        data_ = DataOneof::kTrackerIdRecoveryFailedError;
-        DeserializeField<logs::TrackerIdRecoveryFailedError>(reader, tracker_id_recovery_failed_error_);
-        set_fields_[216] = true;
-        break;
-      }
-      case 217: {
-        clear_data();
-        data_ = DataOneof::kTrackerIdFastForwardFailedError;
-        DeserializeField<logs::TrackerIdFastForwardFailedError>(reader, tracker_id_fast_forward_failed_error_);
-        set_fields_[217] = true;
-        break;
-      }
-      case 218: {
-        clear_data();
-        data_ = DataOneof::kCircularRecordingSnapshotCreated;
-        DeserializeField<logs::CircularRecordingSnapshotCreated>(reader, circular_recording_snapshot_created_);
-        set_fields_[218] = true;
-        break;
-      }
-      case 219: {
-        clear_data();
-        data_ = DataOneof::kCircularRecordingFileOperationError;
-        DeserializeField<logs::CircularRecordingFileOperationError>(reader, circular_recording_file_operation_error_);
-        set_fields_[219] = true;
-        break;
-      }
-      case 220: {
-        clear_data();
-        data_ = DataOneof::kObjectIdRecoveryRejectedInfo;
-        DeserializeField<logs::ObjectIdRecoveryRejectedInfo>(reader, object_id_recovery_rejected_info_);
-        set_fields_[220] = true;
-        break;
-      }
-      case 221: {
-        clear_data();
-        data_ = DataOneof::kExpiredRecoveryIdsInfo;
-        DeserializeField<logs::ExpiredRecoveryIdsInfo>(reader, expired_recovery_ids_info_);
-        set_fields_[221] = true;
-        break;
-      }
-      case 222: {
-        clear_data();
-        data_ = DataOneof::kHesaiUdpReceiverInfo;
-        DeserializeField<logs::HesaiUdpReceiverInfo>(reader, hesai_udp_receiver_info_);
-        set_fields_[222] = true;
-        break;
-      }
-      case 223: {
-        clear_data();
-        data_ = DataOneof::kDbCommitFailed;
-        DeserializeField<logs::DbCommitFailed>(reader, db_commit_failed_);
-        set_fields_[223] = true;
-        break;
-      }
-      case 226: {
-        clear_data();
-        data_ = DataOneof::kDetectionServiceRpcQueueFull;
-        DeserializeField<logs::DetectionServiceRpcQueueFull>(reader, detection_service_rpc_queue_full_);
-        set_fields_[224] = true;
-        break;
-      }
-      case 227: {
-        clear_data();
-        data_ = DataOneof::kProjectMigrationFailed;
-        DeserializeField<logs::ProjectMigrationFailed>(reader, project_migration_failed_);
-        set_fields_[225] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LogData::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LogMessage::LogMessage(const LogMessage& other) noexcept(false)
@@ -2516,35 +263,734 @@ LogMessage::LogMessage(const LogMessage& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void LogMessage::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<LogMetadata>(writer, /*tag=*/ 1, metadata_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<LogData>(writer, /*tag=*/ 2, data_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LogMessage::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LogMessage::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<LogMetadata>(reader, metadata_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<LogData>(reader, data_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LogMessage::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
+}
+
+// MARK: Field tables
+
+// Messages are not standard-layout since they have a vtable, so `offsetof()` is only
+// conditionally-supported on them; it is supported by all compilers targeted by the SDK.
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
+const horus_internal::PbMessageTable& LogData::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LogData, generic_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::Generic>::kOps},
+      {/*tag=*/ 2, offsetof(LogData, oom_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::Oom>::kOps},
+      {/*tag=*/ 3, offsetof(LogData, rpc_connection_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::RpcConnectionError>::kOps},
+      {/*tag=*/ 4, offsetof(LogData, invalid_project_name_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::InvalidProjectName>::kOps},
+      {/*tag=*/ 5, offsetof(LogData, project_not_found_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ProjectNotFound>::kOps},
+      {/*tag=*/ 6, offsetof(LogData, project_already_exists_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ProjectAlreadyExists>::kOps},
+      {/*tag=*/ 7, offsetof(LogData, invalid_configuration_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::InvalidConfiguration>::kOps},
+      {/*tag=*/ 8, offsetof(LogData, entity_not_found_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::EntityNotFound>::kOps},
+      {/*tag=*/ 9, offsetof(LogData, active_project_cannot_be_deleted_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ActiveProjectCannotBeDeleted>::kOps},
+      {/*tag=*/ 10, offsetof(LogData, rpc_disconnection_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::RpcDisconnectionError>::kOps},
+      {/*tag=*/ 11, offsetof(LogData, dropped_logs_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::DroppedLogs>::kOps},
+      {/*tag=*/ 12, offsetof(LogData, opened_project_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::OpenedProject>::kOps},
+      {/*tag=*/ 13, offsetof(LogData, created_project_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::CreatedProject>::kOps},
+      {/*tag=*/ 14, offsetof(LogData, config_unavailable_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ConfigUnavailable>::kOps},
+      {/*tag=*/ 15, offsetof(LogData, invalid_request_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::InvalidRequest>::kOps},
+      {/*tag=*/ 16, offsetof(LogData, sanity_check_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::SanityCheckError>::kOps},
+      {/*tag=*/ 17, offsetof(LogData, bag_failed_to_open_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::BagFailedToOpen>::kOps},
+      {/*tag=*/ 18, offsetof(LogData, bag_failed_to_close_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::BagFailedToClose>::kOps},
+      {/*tag=*/ 19, offsetof(LogData, bag_conversion_failed_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::BagConversionFailed>::kOps},
+      {/*tag=*/ 20, offsetof(LogData, bag_failed_to_write_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::BagFailedToWrite>::kOps},
+      {/*tag=*/ 21, offsetof(LogData, calibration_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::CalibrationError>::kOps},
+      {/*tag=*/ 22, offsetof(LogData, project_manager_failed_to_start_recording_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ProjectManagerFailedToStartRecording>::kOps},
+      {/*tag=*/ 23, offsetof(LogData, project_manager_failed_to_stop_recording_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ProjectManagerFailedToStopRecording>::kOps},
+      {/*tag=*/ 24, offsetof(LogData, service_connection_timed_out_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ServiceConnectionTimedOut>::kOps},
+      {/*tag=*/ 25, offsetof(LogData, bag_recorder_already_running_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::BagRecorderAlreadyRunning>::kOps},
+      {/*tag=*/ 26, offsetof(LogData, license_server_connection_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LicenseServerConnectionError>::kOps},
+      {/*tag=*/ 27, offsetof(LogData, license_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LicenseError>::kOps},
+      {/*tag=*/ 145, offsetof(LogData, license_not_found_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LicenseNotFoundError>::kOps},
+      {/*tag=*/ 146, offsetof(LogData, license_expired_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LicenseExpiredError>::kOps},
+      {/*tag=*/ 147, offsetof(LogData, license_exceeded_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LicenseExceededError>::kOps},
+      {/*tag=*/ 28, offsetof(LogData, license_host_machine_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LicenseHostMachineError>::kOps},
+      {/*tag=*/ 148, offsetof(LogData, license_privilege_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LicensePrivilegeError>::kOps},
+      {/*tag=*/ 149, offsetof(LogData, license_active_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LicenseActiveInfo>::kOps},
+      {/*tag=*/ 150, offsetof(LogData, multiple_licenses_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::MultipleLicensesWarning>::kOps},
+      {/*tag=*/ 29, offsetof(LogData, license_current_license_status_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LicenseCurrentLicenseStatusInfo>::kOps},
+      {/*tag=*/ 30, offsetof(LogData, bag_recording_stopped_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::BagRecordingStoppedInfo>::kOps},
+      {/*tag=*/ 31, offsetof(LogData, bag_recording_failed_to_start_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::BagRecordingFailedToStart>::kOps},
+      {/*tag=*/ 32, offsetof(LogData, bag_recording_started_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::BagRecordingStartedInfo>::kOps},
+      {/*tag=*/ 33, offsetof(LogData, replay_restarted_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ReplayRestartedInfo>::kOps},
+      {/*tag=*/ 34, offsetof(LogData, input_source_change_requested_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::InputSourceChangeRequestedInfo>::kOps},
+      {/*tag=*/ 35, offsetof(LogData, input_source_switched_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::InputSourceSwitchedInfo>::kOps},
+      {/*tag=*/ 36, offsetof(LogData, rpc_timeout_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::RpcTimeoutWarning>::kOps},
+      {/*tag=*/ 37, offsetof(LogData, cannot_write_log_file_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::CannotWriteLogFile>::kOps},
+      {/*tag=*/ 38, offsetof(LogData, point_cloud_parsing_failure_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::PointCloudParsingFailureWarning>::kOps},
+      {/*tag=*/ 39, offsetof(LogData, lidar_is_dead_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LidarIsDead>::kOps},
+      {/*tag=*/ 40, offsetof(LogData, lidar_is_not_dead_anymore_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LidarIsNotDeadAnymore>::kOps},
+      {/*tag=*/ 41, offsetof(LogData, lidar_is_obstructed_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LidarIsObstructed>::kOps},
+      {/*tag=*/ 42, offsetof(LogData, lidar_is_not_obstructed_anymore_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LidarIsNotObstructedAnymore>::kOps},
+      {/*tag=*/ 43, offsetof(LogData, lidar_is_tilted_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LidarIsTilted>::kOps},
+      {/*tag=*/ 44, offsetof(LogData, lidar_is_not_tilted_anymore_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LidarIsNotTiltedAnymore>::kOps},
+      {/*tag=*/ 45, offsetof(LogData, lidar_has_been_automatically_recalibrated_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LidarHasBeenAutomaticallyRecalibrated>::kOps},
+      {/*tag=*/ 207, offsetof(LogData, lidar_auto_correction_failed_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LidarAutoCorrectionFailed>::kOps},
+      {/*tag=*/ 208, offsetof(LogData, lidar_icp_failed_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LidarIcpFailed>::kOps},
+      {/*tag=*/ 46, offsetof(LogData, received_first_data_for_lidar_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ReceivedFirstDataForLidar>::kOps},
+      {/*tag=*/ 47, offsetof(LogData, termination_failure_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::TerminationFailureError>::kOps},
+      {/*tag=*/ 48, offsetof(LogData, frame_processing_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::FrameProcessingError>::kOps},
+      {/*tag=*/ 49, offsetof(LogData, thread_pool_unavailable_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ThreadPoolUnavailableError>::kOps},
+      {/*tag=*/ 50, offsetof(LogData, invalid_argument_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::InvalidArgument>::kOps},
+      {/*tag=*/ 51, offsetof(LogData, component_initialization_failure_fatal_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ComponentInitializationFailureFatal>::kOps},
+      {/*tag=*/ 52, offsetof(LogData, unhandled_enum_case_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::UnhandledEnumCaseError>::kOps},
+      {/*tag=*/ 53, offsetof(LogData, bag_empty_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::BagEmptyError>::kOps},
+      {/*tag=*/ 54, offsetof(LogData, discarding_data_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::DiscardingDataError>::kOps},
+      {/*tag=*/ 55, offsetof(LogData, discarding_data_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::DiscardingDataWarning>::kOps},
+      {/*tag=*/ 56, offsetof(LogData, nothing_to_process_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::NothingToProcess>::kOps},
+      {/*tag=*/ 57, offsetof(LogData, invalid_component_configuration_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::InvalidComponentConfiguration>::kOps},
+      {/*tag=*/ 58, offsetof(LogData, channel_receiver_not_found_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ChannelReceiverNotFoundWarning>::kOps},
+      {/*tag=*/ 59, offsetof(LogData, model_load_failure_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ModelLoadFailure>::kOps},
+      {/*tag=*/ 60, offsetof(LogData, model_execution_failure_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ModelExecutionFailureError>::kOps},
+      {/*tag=*/ 61, offsetof(LogData, service_ready_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ServiceReadyInfo>::kOps},
+      {/*tag=*/ 62, offsetof(LogData, model_preparing_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ModelPreparingInfo>::kOps},
+      {/*tag=*/ 63, offsetof(LogData, model_initialized_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ModelInitializedInfo>::kOps},
+      {/*tag=*/ 64, offsetof(LogData, model_initialization_failure_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ModelInitializationFailureWarning>::kOps},
+      {/*tag=*/ 65, offsetof(LogData, ros_spinner_stopped_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::RosSpinnerStoppedWarning>::kOps},
+      {/*tag=*/ 66, offsetof(LogData, actor_system_unavailable_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ActorSystemUnavailableError>::kOps},
+      {/*tag=*/ 67, offsetof(LogData, config_node_not_found_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ConfigNodeNotFoundError>::kOps},
+      {/*tag=*/ 68, offsetof(LogData, bag_timestamp_out_of_order_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::BagTimestampOutOfOrderError>::kOps},
+      {/*tag=*/ 69, offsetof(LogData, bag_replay_unexpected_timestamp_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::BagReplayUnexpectedTimestampError>::kOps},
+      {/*tag=*/ 70, offsetof(LogData, websocket_closed_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::WebsocketClosedInfo>::kOps},
+      {/*tag=*/ 71, offsetof(LogData, websocket_opened_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::WebsocketOpenedInfo>::kOps},
+      {/*tag=*/ 72, offsetof(LogData, subscriber_disconnected_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::SubscriberDisconnectedInfo>::kOps},
+      {/*tag=*/ 73, offsetof(LogData, thread_pool_slowing_down_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ThreadPoolSlowingDownWarning>::kOps},
+      {/*tag=*/ 74, offsetof(LogData, thread_pool_not_responding_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ThreadPoolNotRespondingWarning>::kOps},
+      {/*tag=*/ 75, offsetof(LogData, thread_pool_broken_promise_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ThreadPoolBrokenPromiseWarning>::kOps},
+      {/*tag=*/ 76, offsetof(LogData, box_fitting_points_below_base_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::BoxFittingPointsBelowBaseWarning>::kOps},
+      {/*tag=*/ 77, offsetof(LogData, failed_to_remove_stale_points_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::FailedToRemoveStalePointsWarning>::kOps},
+      {/*tag=*/ 78, offsetof(LogData, irregular_broadcasting_period_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::IrregularBroadcastingPeriodWarning>::kOps},
+      {/*tag=*/ 79, offsetof(LogData, clusterer_points_out_of_range_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ClustererPointsOutOfRangeWarning>::kOps},
+      {/*tag=*/ 80, offsetof(LogData, internal_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::InternalError>::kOps},
+      {/*tag=*/ 81, offsetof(LogData, internal_fatal_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::InternalFatal>::kOps},
+      {/*tag=*/ 82, offsetof(LogData, service_starting_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ServiceStartingInfo>::kOps},
+      {/*tag=*/ 83, offsetof(LogData, config_node_not_found_fatal_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ConfigNodeNotFoundFatal>::kOps},
+      {/*tag=*/ 84, offsetof(LogData, service_setup_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ServiceSetupError>::kOps},
+      {/*tag=*/ 85, offsetof(LogData, filesystem_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::FilesystemError>::kOps},
+      {/*tag=*/ 86, offsetof(LogData, invalid_preset_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::InvalidPresetWarning>::kOps},
+      {/*tag=*/ 87, offsetof(LogData, websocket_failed_clear_pending_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::WebsocketFailedClearPendingError>::kOps},
+      {/*tag=*/ 88, offsetof(LogData, websocket_failed_to_stop_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::WebsocketFailedToStopError>::kOps},
+      {/*tag=*/ 89, offsetof(LogData, websocket_failed_to_create_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::WebsocketFailedToCreateError>::kOps},
+      {/*tag=*/ 90, offsetof(LogData, unexpected_rpc_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::UnexpectedRpcError>::kOps},
+      {/*tag=*/ 91, offsetof(LogData, license_poll_failed_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LicensePollFailed>::kOps},
+      {/*tag=*/ 92, offsetof(LogData, license_expired_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LicenseExpiredWarning>::kOps},
+      {/*tag=*/ 93, offsetof(LogData, license_usage_exceeded_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LicenseUsageExceededWarning>::kOps},
+      {/*tag=*/ 94, offsetof(LogData, static_thread_pool_slow_task_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::StaticThreadPoolSlowTaskWarning>::kOps},
+      {/*tag=*/ 95, offsetof(LogData, rpc_unsupported_service_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::RpcUnsupportedServiceWarning>::kOps},
+      {/*tag=*/ 96, offsetof(LogData, websocket_handler_problem_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::WebsocketHandlerProblem>::kOps},
+      {/*tag=*/ 97, offsetof(LogData, websocket_deserialize_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::WebsocketDeserializeError>::kOps},
+      {/*tag=*/ 98, offsetof(LogData, websocket_expired_rpc_endpoint_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::WebsocketExpiredRpcEndpointWarning>::kOps},
+      {/*tag=*/ 99, offsetof(LogData, websocket_queue_overloaded_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::WebsocketQueueOverloadedWarning>::kOps},
+      {/*tag=*/ 100, offsetof(LogData, rpc_failed_to_notify_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::RpcFailedToNotifyWarning>::kOps},
+      {/*tag=*/ 101, offsetof(LogData, config_subscription_failed_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ConfigSubscriptionFailedWarning>::kOps},
+      {/*tag=*/ 102, offsetof(LogData, thread_pool_clamped_workers_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ThreadPoolClampedWorkersWarning>::kOps},
+      {/*tag=*/ 103, offsetof(LogData, stopping_horus_bag_recorder_already_stopped_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::StoppingHorusBagRecorderAlreadyStopped>::kOps},
+      {/*tag=*/ 104, offsetof(LogData, recorder_config_update_while_running_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::RecorderConfigUpdateWhileRunning>::kOps},
+      {/*tag=*/ 105, offsetof(LogData, clamping_data_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ClampingDataWarning>::kOps},
+      {/*tag=*/ 106, offsetof(LogData, lidar_incompatible_values_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LidarIncompatibleValues>::kOps},
+      {/*tag=*/ 107, offsetof(LogData, cannot_determine_container_id_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::CannotDetermineContainerIdError>::kOps},
+      {/*tag=*/ 108, offsetof(LogData, started_lidar_driver_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::StartedLidarDriver>::kOps},
+      {/*tag=*/ 109, offsetof(LogData, cannot_start_lidar_driver_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::CannotStartLidarDriver>::kOps},
+      {/*tag=*/ 110, offsetof(LogData, stopped_lidar_driver_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::StoppedLidarDriver>::kOps},
+      {/*tag=*/ 111, offsetof(LogData, cannot_stop_lidar_driver_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::CannotStopLidarDriver>::kOps},
+      {/*tag=*/ 112, offsetof(LogData, restarted_lidar_driver_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::RestartedLidarDriver>::kOps},
+      {/*tag=*/ 113, offsetof(LogData, cannot_restart_lidar_driver_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::CannotRestartLidarDriver>::kOps},
+      {/*tag=*/ 114, offsetof(LogData, removed_unused_lidar_driver_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::RemovedUnusedLidarDriver>::kOps},
+      {/*tag=*/ 115, offsetof(LogData, cannot_remove_unused_lidar_driver_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::CannotRemoveUnusedLidarDriver>::kOps},
+      {/*tag=*/ 116, offsetof(LogData, lidar_driver_gc_failure_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LidarDriverGcFailure>::kOps},
+      {/*tag=*/ 117, offsetof(LogData, id_space_exhausted_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::IdSpaceExhausted>::kOps},
+      {/*tag=*/ 118, offsetof(LogData, preprocessing_to_point_aggregator_points_skipped_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::PreprocessingToPointAggregatorPointsSkipped>::kOps},
+      {/*tag=*/ 119, offsetof(LogData, min_msg_interval_less_than_threshold_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::MinMsgIntervalLessThanThreshold>::kOps},
+      {/*tag=*/ 120, offsetof(LogData, failed_to_cleanup_ros_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::FailedToCleanupRosWarning>::kOps},
+      {/*tag=*/ 121, offsetof(LogData, rpc_disconnected_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::RpcDisconnectedWarning>::kOps},
+      {/*tag=*/ 122, offsetof(LogData, rpc_unhandled_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::RpcUnhandledError>::kOps},
+      {/*tag=*/ 123, offsetof(LogData, time_diff_out_of_range_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::TimeDiffOutOfRangeWarning>::kOps},
+      {/*tag=*/ 124, offsetof(LogData, tensorrt_log_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::TensorrtLog>::kOps},
+      {/*tag=*/ 125, offsetof(LogData, building_tensorrt_engine_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::BuildingTensorrtEngineInfo>::kOps},
+      {/*tag=*/ 126, offsetof(LogData, loading_tensorrt_engine_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LoadingTensorrtEngineInfo>::kOps},
+      {/*tag=*/ 127, offsetof(LogData, calibration_map_not_found_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::CalibrationMapNotFound>::kOps},
+      {/*tag=*/ 128, offsetof(LogData, calibration_map_not_valid_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::CalibrationMapNotValid>::kOps},
+      {/*tag=*/ 129, offsetof(LogData, calibration_map_path_already_exists_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::CalibrationMapPathAlreadyExists>::kOps},
+      {/*tag=*/ 130, offsetof(LogData, failed_to_save_calibration_map_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::FailedToSaveCalibrationMap>::kOps},
+      {/*tag=*/ 131, offsetof(LogData, failed_to_remove_calibration_map_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::FailedToRemoveCalibrationMap>::kOps},
+      {/*tag=*/ 132, offsetof(LogData, failed_to_iterate_in_directory_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::FailedToIterateInDirectory>::kOps},
+      {/*tag=*/ 133, offsetof(LogData, map_based_calibration_without_map_loading_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::MapBasedCalibrationWithoutMapLoading>::kOps},
+      {/*tag=*/ 134, offsetof(LogData, map_based_calibration_already_running_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::MapBasedCalibrationAlreadyRunning>::kOps},
+      {/*tag=*/ 135, offsetof(LogData, cancel_map_based_calibration_not_running_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::CancelMapBasedCalibrationNotRunning>::kOps},
+      {/*tag=*/ 136, offsetof(LogData, bag_stream_not_found_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::BagStreamNotFound>::kOps},
+      {/*tag=*/ 137, offsetof(LogData, evaluation_bag_started_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::EvaluationBagStartedInfo>::kOps},
+      {/*tag=*/ 138, offsetof(LogData, evaluation_bag_finished_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::EvaluationBagFinishedInfo>::kOps},
+      {/*tag=*/ 139, offsetof(LogData, bag_not_found_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::BagNotFound>::kOps},
+      {/*tag=*/ 140, offsetof(LogData, building_pipeline_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::BuildingPipelineInfo>::kOps},
+      {/*tag=*/ 141, offsetof(LogData, bag_is_not_evaluation_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::BagIsNotEvaluation>::kOps},
+      {/*tag=*/ 142, offsetof(LogData, horus_bag_running_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::HorusBagRunning>::kOps},
+      {/*tag=*/ 143, offsetof(LogData, auto_ground_calibration_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::AutoGroundCalibrationWarning>::kOps},
+      {/*tag=*/ 144, offsetof(LogData, auto_ground_calibration_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::AutoGroundCalibrationError>::kOps},
+      {/*tag=*/ 151, offsetof(LogData, object_detector_not_loaded_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ObjectDetectorNotLoadedWarning>::kOps},
+      {/*tag=*/ 152, offsetof(LogData, calibration_is_running_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::CalibrationIsRunningError>::kOps},
+      {/*tag=*/ 153, offsetof(LogData, model_init_in_progress_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ModelInitInProgressInfo>::kOps},
+      {/*tag=*/ 154, offsetof(LogData, rpc_timeout_with_resolution_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::RpcTimeoutWithResolutionWarning>::kOps},
+      {/*tag=*/ 155, offsetof(LogData, calibration_was_cancelled_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::CalibrationWasCancelledInfo>::kOps},
+      {/*tag=*/ 156, offsetof(LogData, calibration_map_recording_failed_to_start_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::CalibrationMapRecordingFailedToStart>::kOps},
+      {/*tag=*/ 157, offsetof(LogData, detection_pipeline_requested_reset_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::DetectionPipelineRequestedResetInfo>::kOps},
+      {/*tag=*/ 158, offsetof(LogData, preprocessing_service_pipeline_unavailable_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::PreprocessingServicePipelineUnavailable>::kOps},
+      {/*tag=*/ 159, offsetof(LogData, circular_recording_disabled_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::CircularRecordingDisabledWarning>::kOps},
+      {/*tag=*/ 160, offsetof(LogData, snapshot_already_running_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::SnapshotAlreadyRunningWarning>::kOps},
+      {/*tag=*/ 161, offsetof(LogData, active_project_changed_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ActiveProjectChangedInfo>::kOps},
+      {/*tag=*/ 162, offsetof(LogData, project_config_updated_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ProjectConfigUpdatedInfo>::kOps},
+      {/*tag=*/ 163, offsetof(LogData, invalid_lidar_timestamp_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::InvalidLidarTimestamp>::kOps},
+      {/*tag=*/ 164, offsetof(LogData, calibration_accumulating_points_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::CalibrationAccumulatingPointsInfo>::kOps},
+      {/*tag=*/ 165, offsetof(LogData, sparse_noise_filter_usage_non_rotational_lidars_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::SparseNoiseFilterUsageNonRotationalLidars>::kOps},
+      {/*tag=*/ 166, offsetof(LogData, file_write_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::FileWriteWarning>::kOps},
+      {/*tag=*/ 167, offsetof(LogData, license_forbidden_feature_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LicenseForbiddenFeature>::kOps},
+      {/*tag=*/ 168, offsetof(LogData, failed_to_update_configuration_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::FailedToUpdateConfiguration>::kOps},
+      {/*tag=*/ 169, offsetof(LogData, obstruction_detector_bad_reference_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ObstructionDetectorBadReferenceWarning>::kOps},
+      {/*tag=*/ 170, offsetof(LogData, project_file_invalid_permissions_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ProjectFileInvalidPermissionsError>::kOps},
+      {/*tag=*/ 171, offsetof(LogData, pipeline_scheduler_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::PipelineSchedulerError>::kOps},
+      {/*tag=*/ 172, offsetof(LogData, multi_lidar_calibration_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::MultiLidarCalibrationWarning>::kOps},
+      {/*tag=*/ 173, offsetof(LogData, multi_lidar_calibration_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::MultiLidarCalibrationError>::kOps},
+      {/*tag=*/ 174, offsetof(LogData, old_bag_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::OldBagWarning>::kOps},
+      {/*tag=*/ 175, offsetof(LogData, upgrading_bag_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::UpgradingBagInfo>::kOps},
+      {/*tag=*/ 176, offsetof(LogData, bag_calibration_save_failed_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::BagCalibrationSaveFailed>::kOps},
+      {/*tag=*/ 177, offsetof(LogData, bag_upgrade_failed_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::BagUpgradeFailed>::kOps},
+      {/*tag=*/ 178, offsetof(LogData, unknown_lidar_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::UnknownLidarError>::kOps},
+      {/*tag=*/ 179, offsetof(LogData, invalid_point_cloud_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::InvalidPointCloudWarning>::kOps},
+      {/*tag=*/ 180, offsetof(LogData, lidar_is_dropping_packets_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LidarIsDroppingPackets>::kOps},
+      {/*tag=*/ 181, offsetof(LogData, removed_invalid_lidars_from_config_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::RemovedInvalidLidarsFromConfigWarning>::kOps},
+      {/*tag=*/ 182, offsetof(LogData, calibration_map_recording_failed_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::CalibrationMapRecordingFailed>::kOps},
+      {/*tag=*/ 183, offsetof(LogData, detection_node_not_found_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::DetectionNodeNotFoundError>::kOps},
+      {/*tag=*/ 184, offsetof(LogData, created_version_backup_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::CreatedVersionBackupInfo>::kOps},
+      {/*tag=*/ 185, offsetof(LogData, ply_file_load_failed_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::PlyFileLoadFailedError>::kOps},
+      {/*tag=*/ 186, offsetof(LogData, hesai_driver_lifecycle_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::HesaiDriverLifecycle>::kOps},
+      {/*tag=*/ 187, offsetof(LogData, hesai_driver_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::HesaiDriverError>::kOps},
+      {/*tag=*/ 188, offsetof(LogData, hesai_packet_processing_failed_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::HesaiPacketProcessingFailed>::kOps},
+      {/*tag=*/ 189, offsetof(LogData, hesai_correction_file_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::HesaiCorrectionFileError>::kOps},
+      {/*tag=*/ 190, offsetof(LogData, hesai_packet_statistics_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::HesaiPacketStatistics>::kOps},
+      {/*tag=*/ 191, offsetof(LogData, ply_file_write_failed_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::PlyFileWriteFailedError>::kOps},
+      {/*tag=*/ 192, offsetof(LogData, project_save_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ProjectSaveError>::kOps},
+      {/*tag=*/ 193, offsetof(LogData, save_static_environment_success_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::SaveStaticEnvironmentSuccess>::kOps},
+      {/*tag=*/ 194, offsetof(LogData, save_static_environment_failed_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::SaveStaticEnvironmentFailed>::kOps},
+      {/*tag=*/ 195, offsetof(LogData, load_static_environment_success_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LoadStaticEnvironmentSuccess>::kOps},
+      {/*tag=*/ 196, offsetof(LogData, load_static_environment_failed_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LoadStaticEnvironmentFailed>::kOps},
+      {/*tag=*/ 197, offsetof(LogData, attempt_to_inject_invalid_lidar_id_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::AttemptToInjectInvalidLidarIdWarning>::kOps},
+      {/*tag=*/ 198, offsetof(LogData, reset_bundled_packet_due_to_unexpected_packet_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ResetBundledPacketDueToUnexpectedPacket>::kOps},
+      {/*tag=*/ 199, offsetof(LogData, packet_bundler_dropped_packets_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::PacketBundlerDroppedPacketsWarning>::kOps},
+      {/*tag=*/ 200, offsetof(LogData, packet_bundler_frame_jump_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::PacketBundlerFrameJumpWarning>::kOps},
+      {/*tag=*/ 201, offsetof(LogData, lidar_correction_loading_success_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LidarCorrectionLoadingSuccess>::kOps},
+      {/*tag=*/ 202, offsetof(LogData, lidar_correction_loading_failure_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LidarCorrectionLoadingFailure>::kOps},
+      {/*tag=*/ 203, offsetof(LogData, hesai_packet_statistics_lidar_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::HesaiPacketStatisticsLidar>::kOps},
+      {/*tag=*/ 204, offsetof(LogData, lidar_tilt_detection_aligned_to_calibration_map_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LidarTiltDetectionAlignedToCalibrationMapInfo>::kOps},
+      {/*tag=*/ 205, offsetof(LogData, lidar_tilt_detection_misaligned_to_calibration_map_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LidarTiltDetectionMisalignedToCalibrationMapWarning>::kOps},
+      {/*tag=*/ 209, offsetof(LogData, lidar_original_pose_differs_for_auto_correction_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::LidarOriginalPoseDiffersForAutoCorrectionError>::kOps},
+      {/*tag=*/ 210, offsetof(LogData, recovered_car_ids_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::RecoveredCarIdsInfo>::kOps},
+      {/*tag=*/ 211, offsetof(LogData, failed_to_recover_car_ids_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::FailedToRecoverCarIds>::kOps},
+      {/*tag=*/ 212, offsetof(LogData, failed_to_emplace_recovered_car_id_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::FailedToEmplaceRecoveredCarId>::kOps},
+      {/*tag=*/ 213, offsetof(LogData, persistent_storage_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::PersistentStorageError>::kOps},
+      {/*tag=*/ 214, offsetof(LogData, track_capacity_exceeded_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::TrackCapacityExceededWarning>::kOps},
+      {/*tag=*/ 215, offsetof(LogData, tracker_state_path_unavailable_warning_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::TrackerStatePathUnavailableWarning>::kOps},
+      {/*tag=*/ 224, offsetof(LogData, tracker_state_recovery_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::TrackerStateRecoveryError>::kOps},
+      {/*tag=*/ 225, offsetof(LogData, tracker_state_save_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::TrackerStateSaveError>::kOps},
+      {/*tag=*/ 216, offsetof(LogData, tracker_id_recovery_failed_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::TrackerIdRecoveryFailedError>::kOps},
+      {/*tag=*/ 217, offsetof(LogData, tracker_id_fast_forward_failed_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::TrackerIdFastForwardFailedError>::kOps},
+      {/*tag=*/ 218, offsetof(LogData, circular_recording_snapshot_created_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::CircularRecordingSnapshotCreated>::kOps},
+      {/*tag=*/ 219, offsetof(LogData, circular_recording_file_operation_error_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::CircularRecordingFileOperationError>::kOps},
+      {/*tag=*/ 220, offsetof(LogData, object_id_recovery_rejected_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ObjectIdRecoveryRejectedInfo>::kOps},
+      {/*tag=*/ 221, offsetof(LogData, expired_recovery_ids_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ExpiredRecoveryIdsInfo>::kOps},
+      {/*tag=*/ 222, offsetof(LogData, hesai_udp_receiver_info_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::HesaiUdpReceiverInfo>::kOps},
+      {/*tag=*/ 223, offsetof(LogData, db_commit_failed_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::DbCommitFailed>::kOps},
+      {/*tag=*/ 226, offsetof(LogData, detection_service_rpc_queue_full_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::DetectionServiceRpcQueueFull>::kOps},
+      {/*tag=*/ 227, offsetof(LogData, project_migration_failed_),
+       /*oneof_offset=*/ offsetof(LogData, data_),
+       &horus_internal::PbFieldOpsFor<logs::ProjectMigrationFailed>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LogMessage::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LogMessage, metadata_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<LogMetadata>>::kOps},
+      {/*tag=*/ 2, offsetof(LogMessage, data_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<LogData>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
 }
 
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
 }  // namespace pb
 }  // namespace sdk
 }  // namespace horus
@@ -8,6 +8,7 @@
 /// Generated by `/opt/actions-runner/_work/horus/horus/common/tools/sdk/pb.ts`.
 
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -15,8 +16,10 @@
 #include "horus/internal/attributes.h"
 #include "horus/pb/logs/logs_pb.h"
 #include "horus/pb/logs/metadata_pb.h"
+#include "horus/pb/lazy.h"
 #include "horus/pb/message.h"
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 #include "horus/strings/string_view.h"
 
 #if HORUS_SDK_USE_PB_NAMESPACE_ALIAS
@@ -76,6 +79,11 @@ class LogData final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -84,12 +92,471 @@ class LogData final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.LogData`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.LogData"; }
 
   /// The full name of the message: `horus.pb.LogData`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LogData`, e.g. to build a `PbFieldMask<LogData>`.
+  enum class Field : PbTag {
+    /// Field `generic`.
+    kGeneric = 1,
+    /// Field `oom`.
+    kOom = 2,
+    /// Field `rpc_connection_error`.
+    kRpcConnectionError = 3,
+    /// Field `invalid_project_name`.
+    kInvalidProjectName = 4,
+    /// Field `project_not_found`.
+    kProjectNotFound = 5,
+    /// Field `project_already_exists`.
+    kProjectAlreadyExists = 6,
+    /// Field `invalid_configuration`.
+    kInvalidConfiguration = 7,
+    /// Field `entity_not_found`.
+    kEntityNotFound = 8,
+    /// Field `active_project_cannot_be_deleted`.
+    kActiveProjectCannotBeDeleted = 9,
+    /// Field `rpc_disconnection_error`.
+    kRpcDisconnectionError = 10,
+    /// Field `dropped_logs`.
+    kDroppedLogs = 11,
+    /// Field `opened_project`.
+    kOpenedProject = 12,
+    /// Field `created_project`.
+    kCreatedProject = 13,
+    /// Field `config_unavailable`.
+    kConfigUnavailable = 14,
+    /// Field `invalid_request`.
+    kInvalidRequest = 15,
+    /// Field `sanity_check_error`.
+    kSanityCheckError = 16,
+    /// Field `bag_failed_to_open`.
+    kBagFailedToOpen = 17,
+    /// Field `bag_failed_to_close`.
+    kBagFailedToClose = 18,
+    /// Field `bag_conversion_failed`.
+    kBagConversionFailed = 19,
+    /// Field `bag_failed_to_write`.
+    kBagFailedToWrite = 20,
+    /// Field `calibration_error`.
+    kCalibrationError = 21,
+    /// Field `project_manager_failed_to_start_recording`.
+    kProjectManagerFailedToStartRecording = 22,
+    /// Field `project_manager_failed_to_stop_recording`.
+    kProjectManagerFailedToStopRecording = 23,
+    /// Field `service_connection_timed_out`.
+    kServiceConnectionTimedOut = 24,
+    /// Field `bag_recorder_already_running`.
+    kBagRecorderAlreadyRunning = 25,
+    /// Field `license_server_connection_error`.
+    kLicenseServerConnectionError = 26,
+    /// Field `license_error`.
+    kLicenseError = 27,
+    /// Field `license_not_found_error`.
+    kLicenseNotFoundError = 145,
+    /// Field `license_expired_error`.
+    kLicenseExpiredError = 146,
+    /// Field `license_exceeded_error`.
+    kLicenseExceededError = 147,
+    /// Field `license_host_machine_error`.
+    kLicenseHostMachineError = 28,
+    /// Field `license_privilege_error`.
+    kLicensePrivilegeError = 148,
+    /// Field `license_active_info`.
+    kLicenseActiveInfo = 149,
+    /// Field `multiple_licenses_warning`.
+    kMultipleLicensesWarning = 150,
+    /// Field `license_current_license_status_info`.
+    kLicenseCurrentLicenseStatusInfo = 29,
+    /// Field `bag_recording_stopped_info`.
+    kBagRecordingStoppedInfo = 30,
+    /// Field `bag_recording_failed_to_start`.
+    kBagRecordingFailedToStart = 31,
+    /// Field `bag_recording_started_info`.
+    kBagRecordingStartedInfo = 32,
+    /// Field `replay_restarted_info`.
+    kReplayRestartedInfo = 33,
+    /// Field `input_source_change_requested_info`.
+    kInputSourceChangeRequestedInfo = 34,
+    /// Field `input_source_switched_info`.
+    kInputSourceSwitchedInfo = 35,
+    /// Field `rpc_timeout_warning`.
+    kRpcTimeoutWarning = 36,
+    /// Field `cannot_write_log_file`.
+    kCannotWriteLogFile = 37,
+    /// Field `point_cloud_parsing_failure_warning`.
+    kPointCloudParsingFailureWarning = 38,
+    /// Field `lidar_is_dead`.
+    kLidarIsDead = 39,
+    /// Field `lidar_is_not_dead_anymore`.
+    kLidarIsNotDeadAnymore = 40,
+    /// Field `lidar_is_obstructed`.
+    kLidarIsObstructed = 41,
+    /// Field `lidar_is_not_obstructed_anymore`.
+    kLidarIsNotObstructedAnymore = 42,
+    /// Field `lidar_is_tilted`.
+    kLidarIsTilted = 43,
+    /// Field `lidar_is_not_tilted_anymore`.
+    kLidarIsNotTiltedAnymore = 44,
+    /// Field `lidar_has_been_automatically_recalibrated`.
+    kLidarHasBeenAutomaticallyRecalibrated = 45,
+    /// Field `lidar_auto_correction_failed`.
+    kLidarAutoCorrectionFailed = 207,
+    /// Field `lidar_icp_failed`.
+    kLidarIcpFailed = 208,
+    /// Field `received_first_data_for_lidar`.
+    kReceivedFirstDataForLidar = 46,
+    /// Field `termination_failure_error`.
+    kTerminationFailureError = 47,
+    /// Field `frame_processing_error`.
+    kFrameProcessingError = 48,
+    /// Field `thread_pool_unavailable_error`.
+    kThreadPoolUnavailableError = 49,
+    /// Field `invalid_argument`.
+    kInvalidArgument = 50,
+    /// Field `component_initialization_failure_fatal`.
+    kComponentInitializationFailureFatal = 51,
+    /// Field `unhandled_enum_case_error`.
+    kUnhandledEnumCaseError = 52,
+    /// Field `bag_empty_error`.
+    kBagEmptyError = 53,
+    /// Field `discarding_data_error`.
+    kDiscardingDataError = 54,
+    /// Field `discarding_data_warning`.
+    kDiscardingDataWarning = 55,
+    /// Field `nothing_to_process`.
+    kNothingToProcess = 56,
+    /// Field `invalid_component_configuration`.
+    kInvalidComponentConfiguration = 57,
+    /// Field `channel_receiver_not_found_warning`.
+    kChannelReceiverNotFoundWarning = 58,
+    /// Field `model_load_failure`.
+    kModelLoadFailure = 59,
+    /// Field `model_execution_failure_error`.
+    kModelExecutionFailureError = 60,
+    /// Field `service_ready_info`.
+    kServiceReadyInfo = 61,
+    /// Field `model_preparing_info`.
+    kModelPreparingInfo = 62,
+    /// Field `model_initialized_info`.
+    kModelInitializedInfo = 63,
+    /// Field `model_initialization_failure_warning`.
+    kModelInitializationFailureWarning = 64,
+    /// Field `ros_spinner_stopped_warning`.
+    kRosSpinnerStoppedWarning = 65,
+    /// Field `actor_system_unavailable_error`.
+    kActorSystemUnavailableError = 66,
+    /// Field `config_node_not_found_error`.
+    kConfigNodeNotFoundError = 67,
+    /// Field `bag_timestamp_out_of_order_error`.
+    kBagTimestampOutOfOrderError = 68,
+    /// Field `bag_replay_unexpected_timestamp_error`.
+    kBagReplayUnexpectedTimestampError = 69,
+    /// Field `websocket_closed_info`.
+    kWebsocketClosedInfo = 70,
+    /// Field `websocket_opened_info`.
+    kWebsocketOpenedInfo = 71,
+    /// Field `subscriber_disconnected_info`.
+    kSubscriberDisconnectedInfo = 72,
+    /// Field `thread_pool_slowing_down_warning`.
+    kThreadPoolSlowingDownWarning = 73,
+    /// Field `thread_pool_not_responding_warning`.
+    kThreadPoolNotRespondingWarning = 74,
+    /// Field `thread_pool_broken_promise_warning`.
+    kThreadPoolBrokenPromiseWarning = 75,
+    /// Field `box_fitting_points_below_base_warning`.
+    kBoxFittingPointsBelowBaseWarning = 76,
+    /// Field `failed_to_remove_stale_points_warning`.
+    kFailedToRemoveStalePointsWarning = 77,
+    /// Field `irregular_broadcasting_period_warning`.
+    kIrregularBroadcastingPeriodWarning = 78,
+    /// Field `clusterer_points_out_of_range_warning`.
+    kClustererPointsOutOfRangeWarning = 79,
+    /// Field `internal_error`.
+    kInternalError = 80,
+    /// Field `internal_fatal`.
+    kInternalFatal = 81,
+    /// Field `service_starting_info`.
+    kServiceStartingInfo = 82,
+    /// Field `config_node_not_found_fatal`.
+    kConfigNodeNotFoundFatal = 83,
+    /// Field `service_setup_error`.
+    kServiceSetupError = 84,
+    /// Field `filesystem_error`.
+    kFilesystemError = 85,
+    /// Field `invalid_preset_warning`.
+    kInvalidPresetWarning = 86,
+    /// Field `websocket_failed_clear_pending_error`.
+    kWebsocketFailedClearPendingError = 87,
+    /// Field `websocket_failed_to_stop_error`.
+    kWebsocketFailedToStopError = 88,
+    /// Field `websocket_failed_to_create_error`.
+    kWebsocketFailedToCreateError = 89,
+    /// Field `unexpected_rpc_error`.
+    kUnexpectedRpcError = 90,
+    /// Field `license_poll_failed`.
+    kLicensePollFailed = 91,
+    /// Field `license_expired_warning`.
+    kLicenseExpiredWarning = 92,
+    /// Field `license_usage_exceeded_warning`.
+    kLicenseUsageExceededWarning = 93,
+    /// Field `static_thread_pool_slow_task_warning`.
+    kStaticThreadPoolSlowTaskWarning = 94,
+    /// Field `rpc_unsupported_service_warning`.
+    kRpcUnsupportedServiceWarning = 95,
+    /// Field `websocket_handler_problem`.
+    kWebsocketHandlerProblem = 96,
+    /// Field `websocket_deserialize_error`.
+    kWebsocketDeserializeError = 97,
+    /// Field `websocket_expired_rpc_endpoint_warning`.
+    kWebsocketExpiredRpcEndpointWarning = 98,
+    /// Field `websocket_queue_overloaded_warning`.
+    kWebsocketQueueOverloadedWarning = 99,
+    /// Field `rpc_failed_to_notify_warning`.
+    kRpcFailedToNotifyWarning = 100,
+    /// Field `config_subscription_failed_warning`.
+    kConfigSubscriptionFailedWarning = 101,
+    /// Field `thread_pool_clamped_workers_warning`.
+    kThreadPoolClampedWorkersWarning = 102,
+    /// Field `stopping_horus_bag_recorder_already_stopped`.
+    kStoppingHorusBagRecorderAlreadyStopped = 103,
+    /// Field `recorder_config_update_while_running`.
+    kRecorderConfigUpdateWhileRunning = 104,
+    /// Field `clamping_data_warning`.
+    kClampingDataWarning = 105,
+    /// Field `lidar_incompatible_values`.
+    kLidarIncompatibleValues = 106,
+    /// Field `cannot_determine_container_id_error`.
+    kCannotDetermineContainerIdError = 107,
+    /// Field `started_lidar_driver`.
+    kStartedLidarDriver = 108,
+    /// Field `cannot_start_lidar_driver`.
+    kCannotStartLidarDriver = 109,
+    /// Field `stopped_lidar_driver`.
+    kStoppedLidarDriver = 110,
+    /// Field `cannot_stop_lidar_driver`.
+    kCannotStopLidarDriver = 111,
+    /// Field `restarted_lidar_driver`.
+    kRestartedLidarDriver = 112,
+    /// Field `cannot_restart_lidar_driver`.
+    kCannotRestartLidarDriver = 113,
+    /// Field `removed_unused_lidar_driver`.
+    kRemovedUnusedLidarDriver = 114,
+    /// Field `cannot_remove_unused_lidar_driver`.
+    kCannotRemoveUnusedLidarDriver = 115,
+    /// Field `lidar_driver_gc_failure`.
+    kLidarDriverGcFailure = 116,
+    /// Field `id_space_exhausted`.
+    kIdSpaceExhausted = 117,
+    /// Field `preprocessing_to_point_aggregator_points_skipped`.
+    kPreprocessingToPointAggregatorPointsSkipped = 118,
+    /// Field `min_msg_interval_less_than_threshold`.
+    kMinMsgIntervalLessThanThreshold = 119,
+    /// Field `failed_to_cleanup_ros_warning`.
+    kFailedToCleanupRosWarning = 120,
+    /// Field `rpc_disconnected_warning`.
+    kRpcDisconnectedWarning = 121,
+    /// Field `rpc_unhandled_error`.
+    kRpcUnhandledError = 122,
+    /// Field `time_diff_out_of_range_warning`.
+    kTimeDiffOutOfRangeWarning = 123,
+    /// Field `tensorrt_log`.
+    kTensorrtLog = 124,
+    /// Field `building_tensorrt_engine_info`.
+    kBuildingTensorrtEngineInfo = 125,
+    /// Field `loading_tensorrt_engine_info`.
+    kLoadingTensorrtEngineInfo = 126,
+    /// Field `calibration_map_not_found`.
+    kCalibrationMapNotFound = 127,
+    /// Field `calibration_map_not_valid`.
+    kCalibrationMapNotValid = 128,
+    /// Field `calibration_map_path_already_exists`.
+    kCalibrationMapPathAlreadyExists = 129,
+    /// Field `failed_to_save_calibration_map`.
+    kFailedToSaveCalibrationMap = 130,
+    /// Field `failed_to_remove_calibration_map`.
+    kFailedToRemoveCalibrationMap = 131,
+    /// Field `failed_to_iterate_in_directory`.
+    kFailedToIterateInDirectory = 132,
+    /// Field `map_based_calibration_without_map_loading`.
+    kMapBasedCalibrationWithoutMapLoading = 133,
+    /// Field `map_based_calibration_already_running`.
+    kMapBasedCalibrationAlreadyRunning = 134,
+    /// Field `cancel_map_based_calibration_not_running`.
+    kCancelMapBasedCalibrationNotRunning = 135,
+    /// Field `bag_stream_not_found`.
+    kBagStreamNotFound = 136,
+    /// Field `evaluation_bag_started_info`.
+    kEvaluationBagStartedInfo = 137,
+    /// Field `evaluation_bag_finished_info`.
+    kEvaluationBagFinishedInfo = 138,
+    /// Field `bag_not_found`.
+    kBagNotFound = 139,
+    /// Field `building_pipeline_info`.
+    kBuildingPipelineInfo = 140,
+    /// Field `bag_is_not_evaluation`.
+    kBagIsNotEvaluation = 141,
+    /// Field `horus_bag_running`.
+    kHorusBagRunning = 142,
+    /// Field `auto_ground_calibration_warning`.
+    kAutoGroundCalibrationWarning = 143,
+    /// Field `auto_ground_calibration_error`.
+    kAutoGroundCalibrationError = 144,
+    /// Field `object_detector_not_loaded_warning`.
+    kObjectDetectorNotLoadedWarning = 151,
+    /// Field `calibration_is_running_error`.
+    kCalibrationIsRunningError = 152,
+    /// Field `model_init_in_progress_info`.
+    kModelInitInProgressInfo = 153,
+    /// Field `rpc_timeout_with_resolution_warning`.
+    kRpcTimeoutWithResolutionWarning = 154,
+    /// Field `calibration_was_cancelled_info`.
+    kCalibrationWasCancelledInfo = 155,
+    /// Field `calibration_map_recording_failed_to_start`.
+    kCalibrationMapRecordingFailedToStart = 156,
+    /// Field `detection_pipeline_requested_reset_info`.
+    kDetectionPipelineRequestedResetInfo = 157,
+    /// Field `preprocessing_service_pipeline_unavailable`.
+    kPreprocessingServicePipelineUnavailable = 158,
+    /// Field `circular_recording_disabled_warning`.
+    kCircularRecordingDisabledWarning = 159,
+    /// Field `snapshot_already_running_warning`.
+    kSnapshotAlreadyRunningWarning = 160,
+    /// Field `active_project_changed_info`.
+    kActiveProjectChangedInfo = 161,
+    /// Field `project_config_updated_info`.
+    kProjectConfigUpdatedInfo = 162,
+    /// Field `invalid_lidar_timestamp`.
+    kInvalidLidarTimestamp = 163,
+    /// Field `calibration_accumulating_points_info`.
+    kCalibrationAccumulatingPointsInfo = 164,
+    /// Field `sparse_noise_filter_usage_non_rotational_lidars`.
+    kSparseNoiseFilterUsageNonRotationalLidars = 165,
+    /// Field `file_write_warning`.
+    kFileWriteWarning = 166,
+    /// Field `license_forbidden_feature`.
+    kLicenseForbiddenFeature = 167,
+    /// Field `failed_to_update_configuration`.
+    kFailedToUpdateConfiguration = 168,
+    /// Field `obstruction_detector_bad_reference_warning`.
+    kObstructionDetectorBadReferenceWarning = 169,
+    /// Field `project_file_invalid_permissions_error`.
+    kProjectFileInvalidPermissionsError = 170,
+    /// Field `pipeline_scheduler_error`.
+    kPipelineSchedulerError = 171,
+    /// Field `multi_lidar_calibration_warning`.
+    kMultiLidarCalibrationWarning = 172,
+    /// Field `multi_lidar_calibration_error`.
+    kMultiLidarCalibrationError = 173,
+    /// Field `old_bag_warning`.
+    kOldBagWarning = 174,
+    /// Field `upgrading_bag_info`.
+    kUpgradingBagInfo = 175,
+    /// Field `bag_calibration_save_failed`.
+    kBagCalibrationSaveFailed = 176,
+    /// Field `bag_upgrade_failed`.
+    kBagUpgradeFailed = 177,
+    /// Field `unknown_lidar_error`.
+    kUnknownLidarError = 178,
+    /// Field `invalid_point_cloud_warning`.
+    kInvalidPointCloudWarning = 179,
+    /// Field `lidar_is_dropping_packets`.
+    kLidarIsDroppingPackets = 180,
+    /// Field `removed_invalid_lidars_from_config_warning`.
+    kRemovedInvalidLidarsFromConfigWarning = 181,
+    /// Field `calibration_map_recording_failed`.
+    kCalibrationMapRecordingFailed = 182,
+    /// Field `detection_node_not_found_error`.
+    kDetectionNodeNotFoundError = 183,
+    /// Field `created_version_backup_info`.
+    kCreatedVersionBackupInfo = 184,
+    /// Field `ply_file_load_failed_error`.
+    kPlyFileLoadFailedError = 185,
+    /// Field `hesai_driver_lifecycle`.
+    kHesaiDriverLifecycle = 186,
+    /// Field `hesai_driver_error`.
+    kHesaiDriverError = 187,
+    /// Field `hesai_packet_processing_failed`.
+    kHesaiPacketProcessingFailed = 188,
+    /// Field `hesai_correction_file_error`.
+    kHesaiCorrectionFileError = 189,
+    /// Field `hesai_packet_statistics`.
+    kHesaiPacketStatistics = 190,
+    /// Field `ply_file_write_failed_error`.
+    kPlyFileWriteFailedError = 191,
+    /// Field `project_save_error`.
+    kProjectSaveError = 192,
+    /// Field `save_static_environment_success`.
+    kSaveStaticEnvironmentSuccess = 193,
+    /// Field `save_static_environment_failed`.
+    kSaveStaticEnvironmentFailed = 194,
+    /// Field `load_static_environment_success`.
+    kLoadStaticEnvironmentSuccess = 195,
+    /// Field `load_static_environment_failed`.
+    kLoadStaticEnvironmentFailed = 196,
+    /// Field `attempt_to_inject_invalid_lidar_id_warning`.
+    kAttemptToInjectInvalidLidarIdWarning = 197,
+    /// Field `reset_bundled_packet_due_to_unexpected_packet`.
+    kResetBundledPacketDueToUnexpectedPacket = 198,
+    /// Field `packet_bundler_dropped_packets_warning`.
+    kPacketBundlerDroppedPacketsWarning = 199,
+    /// Field `packet_bundler_frame_jump_warning`.
+    kPacketBundlerFrameJumpWarning = 200,
+    /// Field `lidar_correction_loading_success`.
+    kLidarCorrectionLoadingSuccess = 201,
+    /// Field `lidar_correction_loading_failure`.
+    kLidarCorrectionLoadingFailure = 202,
+    /// Field `hesai_packet_statistics_lidar`.
+    kHesaiPacketStatisticsLidar = 203,
+    /// Field `lidar_tilt_detection_aligned_to_calibration_map_info`.
+    kLidarTiltDetectionAlignedToCalibrationMapInfo = 204,
+    /// Field `lidar_tilt_detection_misaligned_to_calibration_map_warning`.
+    kLidarTiltDetectionMisalignedToCalibrationMapWarning = 205,
+    /// Field `lidar_original_pose_differs_for_auto_correction_error`.
+    kLidarOriginalPoseDiffersForAutoCorrectionError = 209,
+    /// Field `recovered_car_ids_info`.
+    kRecoveredCarIdsInfo = 210,
+    /// Field `failed_to_recover_car_ids`.
+    kFailedToRecoverCarIds = 211,
+    /// Field `failed_to_emplace_recovered_car_id`.
+    kFailedToEmplaceRecoveredCarId = 212,
+    /// Field `persistent_storage_error`.
+    kPersistentStorageError = 213,
+    /// Field `track_capacity_exceeded_warning`.
+    kTrackCapacityExceededWarning = 214,
+    /// Field `tracker_state_path_unavailable_warning`.
+    kTrackerStatePathUnavailableWarning = 215,
+    /// Field `tracker_state_recovery_error`.
+    kTrackerStateRecoveryError = 224,
+    /// Field `tracker_state_save_error`.
+    kTrackerStateSaveError = 225,
+    /// Field `tracker_id_recovery_failed_error`.
+    kTrackerIdRecoveryFailedError = 216,
+    /// Field `tracker_id_fast_forward_failed_error`.
+    kTrackerIdFastForwardFailedError = 217,
+    /// Field `circular_recording_snapshot_created`.
+    kCircularRecordingSnapshotCreated = 218,
+    /// Field `circular_recording_file_operation_error`.
+    kCircularRecordingFileOperationError = 219,
+    /// Field `object_id_recovery_rejected_info`.
+    kObjectIdRecoveryRejectedInfo = 220,
+    /// Field `expired_recovery_ids_info`.
+    kExpiredRecoveryIdsInfo = 221,
+    /// Field `hesai_udp_receiver_info`.
+    kHesaiUdpReceiverInfo = 222,
+    /// Field `db_commit_failed`.
+    kDbCommitFailed = 223,
+    /// Field `detection_service_rpc_queue_full`.
+    kDetectionServiceRpcQueueFull = 226,
+    /// Field `project_migration_failed`.
+    kProjectMigrationFailed = 227,
+  };
+
   // Field `generic` (no 1).
   // -----
 
@@ -13899,6 +14366,10 @@ class LogData final : public PbMessage {
     }
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see generic()
   logs::Generic generic_{};
@@ -14398,6 +14869,11 @@ class LogMessage final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -14406,20 +14882,35 @@ class LogMessage final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.LogMessage`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.LogMessage"; }
 
   /// The full name of the message: `horus.pb.LogMessage`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LogMessage`, e.g. to build a `PbFieldMask<LogMessage>`.
+  enum class Field : PbTag {
+    /// Field `metadata`.
+    kMetadata = 1,
+    /// Field `data`.
+    kData = 2,
+  };
+
   // Field `metadata` (no 1).
   // -----
 
   /// No documentation.
   ///
   /// Field no: 1.
-  constexpr const LogMetadata& metadata() const& noexcept HORUS_LIFETIME_BOUND {
-    return metadata_;
+  ///
+  /// If `metadata` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `metadata` was received and is not a valid message.
+  const LogMetadata& metadata() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return metadata_.Ref();
   }
 
   /// If `metadata` is set, moves it out of the message (without marking it as unset).
@@ -14427,19 +14918,23 @@ class LogMessage final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  LogMetadata metadata() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `metadata` was received and is not a valid message.
+  LogMetadata metadata() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(metadata_);
+    return std::move(metadata_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 1.
-  LogMetadata& mutable_metadata() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `metadata` was received and is not a valid message.
+  LogMetadata& mutable_metadata() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return metadata_;
+    return metadata_.Mutable();
   }
 
   /// Returns whether `metadata` (no 1) is set.
@@ -14448,13 +14943,13 @@ class LogMessage final : public PbMessage {
   /// Clears `metadata` (no 1).
   void clear_metadata() & noexcept {
     set_fields_[0] = false;
-    metadata_ = {};
+    metadata_.Clear();
   }
 
   /// Sets `metadata` (no 1) and returns `*this`.
   LogMessage& set_metadata(LogMetadata&& metadata) & noexcept {
     set_fields_[0] = true;
-    metadata_ = std::move(metadata);
+    metadata_.Set(std::move(metadata));
     return *this;
   }
   /// Sets `metadata` (no 1) and returns `*this`.
@@ -14468,8 +14963,12 @@ class LogMessage final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 2.
-  constexpr const LogData& data() const& noexcept HORUS_LIFETIME_BOUND {
-    return data_;
+  ///
+  /// If `data` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `data` was received and is not a valid message.
+  const LogData& data() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return data_.Ref();
   }
 
   /// If `data` is set, moves it out of the message (without marking it as unset).
@@ -14477,19 +14976,23 @@ class LogMessage final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  LogData data() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `data` was received and is not a valid message.
+  LogData data() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(data_);
+    return std::move(data_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 2.
-  LogData& mutable_data() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `data` was received and is not a valid message.
+  LogData& mutable_data() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return data_;
+    return data_.Mutable();
   }
 
   /// Returns whether `data` (no 2) is set.
@@ -14498,13 +15001,13 @@ class LogMessage final : public PbMessage {
   /// Clears `data` (no 2).
   void clear_data() & noexcept {
     set_fields_[1] = false;
-    data_ = {};
+    data_.Clear();
   }
 
   /// Sets `data` (no 2) and returns `*this`.
   LogMessage& set_data(LogData&& data) & noexcept {
     set_fields_[1] = true;
-    data_ = std::move(data);
+    data_.Set(std::move(data));
     return *this;
   }
   /// Sets `data` (no 2) and returns `*this`.
@@ -14512,11 +15015,15 @@ class LogMessage final : public PbMessage {
     return std::move(set_data(std::move(data)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see metadata()
-  LogMetadata metadata_{};
+  PbLazy<LogMetadata> metadata_{};
   /// @see data()
-  LogData data_{};
+  PbLazy<LogData> data_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<2> set_fields_;
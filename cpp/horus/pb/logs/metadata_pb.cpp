@@ -1,6 +1,9 @@
 #include "horus/pb/logs/metadata_pb.h"
 
+#include <cstddef>
+
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 
 namespace horus {
 namespace sdk {
@@ -12,33 +15,21 @@ LogMetadata_SourceLocation::LogMetadata_SourceLocation(const LogMetadata_SourceL
     , set_fields_{other.set_fields_} {}
 
 void LogMetadata_SourceLocation::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, file_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 2, line_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LogMetadata_SourceLocation::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LogMetadata_SourceLocation::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, file_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::uint32_t>(reader, line_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LogMetadata_SourceLocation::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LogMetadata_Duration::LogMetadata_Duration(const LogMetadata_Duration& other) noexcept(false)
@@ -46,25 +37,21 @@ LogMetadata_Duration::LogMetadata_Duration(const LogMetadata_Duration& other) no
     , set_fields_{other.set_fields_} {}
 
 void LogMetadata_Duration::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 1, ms_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LogMetadata_Duration::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LogMetadata_Duration::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint64_t>(reader, ms_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LogMetadata_Duration::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LogMetadata_Timestamp::LogMetadata_Timestamp(const LogMetadata_Timestamp& other) noexcept(false)
@@ -72,25 +59,21 @@ LogMetadata_Timestamp::LogMetadata_Timestamp(const LogMetadata_Timestamp& other)
     , set_fields_{other.set_fields_} {}
 
 void LogMetadata_Timestamp::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 1, ms_since_epoch_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LogMetadata_Timestamp::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LogMetadata_Timestamp::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint64_t>(reader, ms_since_epoch_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LogMetadata_Timestamp::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LogMetadata::LogMetadata(const LogMetadata& other) noexcept(false)
@@ -102,59 +85,91 @@ LogMetadata::LogMetadata(const LogMetadata& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void LogMetadata::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 1, ms_since_epoch_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<LogMetadata_Severity>(writer, /*tag=*/ 2, severity_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, node_id_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<CowSpan<std::uint64_t>, PbDeserFlags::kFixed>(writer, /*tag=*/ 4, encoded_stack_frames_);
-  }
-  if (set_fields_[4]) {
-    SerializeField<CowRepeated<CowBytes>>(writer, /*tag=*/ 5, stack_frames_modules_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LogMetadata::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LogMetadata::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint64_t>(reader, ms_since_epoch_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<LogMetadata_Severity>(reader, severity_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, node_id_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<CowSpan<std::uint64_t>, PbDeserFlags::kFixed>(reader, encoded_stack_frames_);
-        set_fields_[3] = true;
-        break;
-      }
-      case 5: {
-        DeserializeField<CowRepeated<CowBytes>>(reader, stack_frames_modules_);
-        set_fields_[4] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LogMetadata::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
+}
+
+// MARK: Field tables
+
+// Messages are not standard-layout since they have a vtable, so `offsetof()` is only
+// conditionally-supported on them; it is supported by all compilers targeted by the SDK.
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
+const horus_internal::PbMessageTable& LogMetadata_SourceLocation::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LogMetadata_SourceLocation, file_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(LogMetadata_SourceLocation, line_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
 }
 
+const horus_internal::PbMessageTable& LogMetadata_Duration::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LogMetadata_Duration, ms_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LogMetadata_Timestamp::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LogMetadata_Timestamp, ms_since_epoch_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LogMetadata::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LogMetadata, ms_since_epoch_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 2, offsetof(LogMetadata, severity_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<LogMetadata_Severity>::kOps},
+      {/*tag=*/ 3, offsetof(LogMetadata, node_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 4, offsetof(LogMetadata, encoded_stack_frames_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowSpan<std::uint64_t>, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 5, offsetof(LogMetadata, stack_frames_modules_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<CowBytes>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
 }  // namespace pb
 }  // namespace sdk
 }  // namespace horus
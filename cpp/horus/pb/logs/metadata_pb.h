@@ -8,6 +8,7 @@
 /// Generated by `/opt/actions-runner/_work/horus/horus/common/tools/sdk/pb.ts`.
 
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -18,6 +19,7 @@
 #include "horus/pb/cow_span.h"
 #include "horus/pb/message.h"
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 #include "horus/pb/types.h"
 #include "horus/strings/string_view.h"
 
@@ -103,6 +105,11 @@ class LogMetadata_SourceLocation final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -111,12 +118,23 @@ class LogMetadata_SourceLocation final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.LogMetadata.SourceLocation`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.LogMetadata.SourceLocation"; }
 
   /// The full name of the message: `horus.pb.LogMetadata.SourceLocation`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LogMetadata_SourceLocation`, e.g. to build a `PbFieldMask<LogMetadata_SourceLocation>`.
+  enum class Field : PbTag {
+    /// Field `file`.
+    kFile = 1,
+    /// Field `line`.
+    kLine = 2,
+  };
+
   // Field `file` (no 1).
   // -----
 
@@ -205,6 +223,10 @@ class LogMetadata_SourceLocation final : public PbMessage {
     return std::move(set_line(line));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see file()
   CowBytes file_{};
@@ -253,6 +275,11 @@ class LogMetadata_Duration final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -261,12 +288,21 @@ class LogMetadata_Duration final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.LogMetadata.Duration`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.LogMetadata.Duration"; }
 
   /// The full name of the message: `horus.pb.LogMetadata.Duration`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LogMetadata_Duration`, e.g. to build a `PbFieldMask<LogMetadata_Duration>`.
+  enum class Field : PbTag {
+    /// Field `ms`.
+    kMs = 1,
+  };
+
   // Field `ms` (no 1).
   // -----
 
@@ -305,6 +341,10 @@ class LogMetadata_Duration final : public PbMessage {
     return std::move(set_ms(ms));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see ms()
   std::uint64_t ms_{};
@@ -351,6 +391,11 @@ class LogMetadata_Timestamp final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -359,12 +404,21 @@ class LogMetadata_Timestamp final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.LogMetadata.Timestamp`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.LogMetadata.Timestamp"; }
 
   /// The full name of the message: `horus.pb.LogMetadata.Timestamp`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LogMetadata_Timestamp`, e.g. to build a `PbFieldMask<LogMetadata_Timestamp>`.
+  enum class Field : PbTag {
+    /// Field `ms_since_epoch`.
+    kMsSinceEpoch = 1,
+  };
+
   // Field `ms_since_epoch` (no 1).
   // -----
 
@@ -403,6 +457,10 @@ class LogMetadata_Timestamp final : public PbMessage {
     return std::move(set_ms_since_epoch(ms_since_epoch));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see ms_since_epoch()
   std::uint64_t ms_since_epoch_{};
@@ -457,6 +515,11 @@ class LogMetadata final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -465,12 +528,29 @@ class LogMetadata final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.LogMetadata`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.LogMetadata"; }
 
   /// The full name of the message: `horus.pb.LogMetadata`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LogMetadata`, e.g. to build a `PbFieldMask<LogMetadata>`.
+  enum class Field : PbTag {
+    /// Field `ms_since_epoch`.
+    kMsSinceEpoch = 1,
+    /// Field `severity`.
+    kSeverity = 2,
+    /// Field `node_id`.
+    kNodeId = 3,
+    /// Field `encoded_stack_frames`.
+    kEncodedStackFrames = 4,
+    /// Field `stack_frames_modules`.
+    kStackFramesModules = 5,
+  };
+
   // Field `ms_since_epoch` (no 1).
   // -----
 
@@ -715,6 +795,10 @@ class LogMetadata final : public PbMessage {
     return std::move(set_stack_frames_modules(std::move(stack_frames_modules)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see ms_since_epoch()
   std::uint64_t ms_since_epoch_{};
@@ -832,6 +916,11 @@ class PbTraits<horus::sdk::pb::LogMetadata_Severity> final {
     writer.Writer().add_enum(tag, static_cast<PbEnum>(value));
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, horus::sdk::pb::LogMetadata_Severity value) noexcept {
+    return PbTraits<PbEnum>::ByteSize(tag, static_cast<PbEnum>(value));
+  }
+
   /// Deserializes `horus::sdk::pb::LogMetadata_Severity` from `reader`.
   static horus::sdk::pb::LogMetadata_Severity Deserialize(PbReader& reader) {
     return PbEnumTraits<horus::sdk::pb::LogMetadata_Severity>::ValueOf(reader.Reader().get_enum());
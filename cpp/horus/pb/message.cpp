@@ -1,23 +1,40 @@
 #include "horus/pb/message.h"
 
+#include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 #include <vector>
 
+#include "horus/pb/segments.h"
 #include "horus/pb/serialize.h"
 
 namespace horus {
 
 std::vector<std::uint8_t> PbMessage::SerializeToBuffer() const noexcept(false) {
-  PbWriter writer;
-  SerializeTo(writer);
-  return std::move(writer).ToVector();
+  std::vector<std::uint8_t> buffer;
+  SerializeToBuffer(buffer);
+  return buffer;
 }
 
 void PbMessage::SerializeToBuffer(std::vector<std::uint8_t>& buffer) const noexcept(false) {
-  PbWriter writer{std::move(buffer)};
+  const std::size_t byte_size{ByteSizeLong()};
+  const std::size_t expected_size{buffer.size() + byte_size};
+  PbWriter writer{std::move(buffer), byte_size};
   SerializeTo(writer);
   buffer = std::move(writer).ToVector();
+  assert(buffer.size() == expected_size);
+  static_cast<void>(expected_size);
+}
+
+PbSegments PbMessage::SerializeToSegments(std::size_t min_reference_size) const noexcept(false) {
+  const std::size_t byte_size{ByteSizeLong()};
+  PbWriter writer{PbSegmentsOptions{min_reference_size}};
+  SerializeTo(writer);
+  PbSegments segments{std::move(writer).ToSegments()};
+  assert(segments.ByteSize() == byte_size);
+  static_cast<void>(byte_size);
+  return segments;
 }
 
 }  // namespace horus
@@ -5,6 +5,7 @@
 #ifndef HORUS_PB_MESSAGE_H_
 #define HORUS_PB_MESSAGE_H_
 
+#include <atomic>
 #include <bitset>
 #include <cstddef>
 #include <cstdint>
@@ -13,11 +14,55 @@
 #include <utility>
 #include <vector>
 
+#include "horus/pb/segments.h"
 #include "horus/pb/serialize.h"
 #include "horus/pb/types.h"
 #include "horus/strings/string_view.h"
 
 namespace horus {
+namespace horus_internal {
+
+/// The size of a message cached by `PbMessage::ByteSizeLong()`.
+///
+/// Copying or moving a message does not copy its cached size, which is reset instead.
+class PbCachedSize final {
+ public:
+  /// Constructs an empty cached size.
+  PbCachedSize() noexcept = default;
+
+  /// Constructs an empty cached size.
+  PbCachedSize(const PbCachedSize& /* other */) noexcept {}
+  /// Resets the cached size.
+  PbCachedSize& operator=(const PbCachedSize& /* other */) noexcept {
+    Store(0);
+    return *this;
+  }
+  /// Constructs an empty cached size.
+  PbCachedSize(PbCachedSize&& /* other */) noexcept {}
+  /// Resets the cached size.
+  PbCachedSize& operator=(PbCachedSize&& /* other */) noexcept {
+    Store(0);
+    return *this;
+  }
+
+  /// Destructor.
+  ~PbCachedSize() noexcept = default;
+
+  /// Returns the cached size, or 0 if no size was cached.
+  std::size_t Load() const noexcept { return size_.load(std::memory_order_relaxed); }
+
+  /// Caches `size`.
+  ///
+  /// Relaxed atomics are sufficient since concurrent serializations of the same message store the
+  /// same size.
+  void Store(std::size_t size) noexcept { size_.store(size, std::memory_order_relaxed); }
+
+ private:
+  /// The cached size.
+  std::atomic<std::size_t> size_{0};
+};
+
+}  // namespace horus_internal
 
 /// Base class for all Protobuf message types.
 class PbMessage {
@@ -49,14 +94,47 @@ class PbMessage {
   /// Returns whether the message is empty, i.e. none of its fields is set.
   virtual bool IsEmpty() const noexcept = 0;
 
+  /// Clears all fields of the message.
+  ///
+  /// Unlike assigning a default-initialized message, the buffers owned by the message and its
+  /// submessages (e.g. the vectors of mutated `CowSpan`s) keep their capacity, so that a cleared
+  /// message can be refilled without allocating. See `PbMessagePool`.
+  virtual void Clear() noexcept = 0;
+
+  /// Returns the number of bytes used to serialize the message with `SerializeTo()`.
+  ///
+  /// The result is cached (see `CachedByteSize()`) along with the sizes of all submessages, so
+  /// that `SerializeToBuffer()` can allocate its output once and write the length prefixes of
+  /// submessages directly.
+  virtual std::size_t ByteSizeLong() const noexcept(false) = 0;
+
+  /// Returns the size computed by the last call to `ByteSizeLong()`, or 0 if it was not called
+  /// since the message was constructed or assigned.
+  ///
+  /// Modifying the message does not invalidate this size.
+  std::size_t CachedByteSize() const noexcept { return cached_byte_size_.Load(); }
+
   /// Destroys the message.
   virtual ~PbMessage() = default;
 
   /// Serializes the message to a `std::vector<std::uint8_t>`.
+  ///
+  /// The size of the message is computed with `ByteSizeLong()` first, so the vector is allocated
+  /// exactly once.
   std::vector<std::uint8_t> SerializeToBuffer() const noexcept(false);
-  /// Serializes the message to a `std::vector<std::uint8_t>`.
+  /// Serializes the message at the end of `buffer`.
+  ///
+  /// The size of the message is computed with `ByteSizeLong()` first, so the vector is reallocated
+  /// at most once.
   void SerializeToBuffer(std::vector<std::uint8_t>& buffer) const noexcept(false);
 
+  /// Serializes the message to a list of segments, in which bytes and packed fields referring to
+  /// shared `PbView`s of at least `min_reference_size` bytes are referenced rather than copied.
+  ///
+  /// This avoids copying large payloads (e.g. point clouds) when relaying received messages.
+  PbSegments SerializeToSegments(std::size_t min_reference_size = kPbDefaultMinReferenceSize) const
+      noexcept(false);
+
  protected:
   /// Serializes a field of type `T`.
   template <class T, PbDeserFlags kFlags = PbDeserFlags::kNone>
@@ -68,6 +146,33 @@ class PbMessage {
     PbTraits<T, kFlags>::Serialize(writer, tag, value);
   }
 
+  /// Returns the number of bytes used to serialize a field of type `T`.
+  template <class T, PbDeserFlags kFlags = PbDeserFlags::kNone>
+  static std::size_t FieldByteSize(
+      PbTag tag,
+      std::conditional_t<(sizeof(T) <= sizeof(void*) * 2 && std::is_trivially_copyable<T>::value),
+                         T, const T&>
+          value) {
+    return PbTraits<T, kFlags>::ByteSize(tag, value);
+  }
+
+  /// Clears a scalar field.
+  template <class T,
+            std::enable_if_t<std::is_arithmetic<T>::value || std::is_enum<T>::value>* = nullptr>
+  static void ClearField(T& field) noexcept {
+    field = {};
+  }
+
+  /// Clears a bytes, repeated or message field, keeping the capacity of its owned buffers.
+  template <class T,
+            std::enable_if_t<!std::is_arithmetic<T>::value && !std::is_enum<T>::value>* = nullptr>
+  static void ClearField(T& field) noexcept {
+    field.Clear();
+  }
+
+  /// Caches the result of `ByteSizeLong()`.
+  void SetCachedByteSize(std::size_t size) const noexcept { cached_byte_size_.Store(size); }
+
   /// Deserializes a field of type `T` in-place.
   template <class T, PbDeserFlags kFlags = PbDeserFlags::kNone,
             decltype(PbTraits<T, kFlags>::Deserialize(std::declval<PbReader&>(),
@@ -92,6 +197,10 @@ class PbMessage {
       oneof_tag = 0;
     }
   }
+
+ private:
+  /// The size cached by `ByteSizeLong()`.
+  mutable horus_internal::PbCachedSize cached_byte_size_;
 };
 
 }  // namespace horus
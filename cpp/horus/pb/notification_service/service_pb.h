@@ -8,6 +8,7 @@
 /// Generated by `/opt/actions-runner/_work/horus/horus/common/tools/sdk/pb.ts`.
 
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -15,10 +16,12 @@
 #include "horus/internal/attributes.h"
 #include "horus/pb/cow_repeated.h"
 #include "horus/pb/logs/message_pb.h"
+#include "horus/pb/lazy.h"
 #include "horus/pb/message.h"
 #include "horus/pb/preprocessing/messages_pb.h"
 #include "horus/pb/profiling_pb.h"
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 #include "horus/strings/string_view.h"
 
 #if HORUS_SDK_USE_PB_NAMESPACE_ALIAS
@@ -78,6 +81,11 @@ class LogMessageRequest final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -86,20 +94,33 @@ class LogMessageRequest final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.LogMessageRequest`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.LogMessageRequest"; }
 
   /// The full name of the message: `horus.pb.LogMessageRequest`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LogMessageRequest`, e.g. to build a `PbFieldMask<LogMessageRequest>`.
+  enum class Field : PbTag {
+    /// Field `log_message`.
+    kLogMessage = 1,
+  };
+
   // Field `log_message` (no 1).
   // -----
 
   /// The message to log.
   ///
   /// Field no: 1.
-  constexpr const LogMessage& log_message() const& noexcept HORUS_LIFETIME_BOUND {
-    return log_message_;
+  ///
+  /// If `log_message` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `log_message` was received and is not a valid message.
+  const LogMessage& log_message() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return log_message_.Ref();
   }
 
   /// If `log_message` is set, moves it out of the message (without marking it as unset).
@@ -107,19 +128,23 @@ class LogMessageRequest final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  LogMessage log_message() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `log_message` was received and is not a valid message.
+  LogMessage log_message() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(log_message_);
+    return std::move(log_message_).Take();
   }
 
   /// The message to log.
   ///
   /// Field no: 1.
-  LogMessage& mutable_log_message() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `log_message` was received and is not a valid message.
+  LogMessage& mutable_log_message() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return log_message_;
+    return log_message_.Mutable();
   }
 
   /// Returns whether `log_message` (no 1) is set.
@@ -128,13 +153,13 @@ class LogMessageRequest final : public PbMessage {
   /// Clears `log_message` (no 1).
   void clear_log_message() & noexcept {
     set_fields_[0] = false;
-    log_message_ = {};
+    log_message_.Clear();
   }
 
   /// Sets `log_message` (no 1) and returns `*this`.
   LogMessageRequest& set_log_message(LogMessage&& log_message) & noexcept {
     set_fields_[0] = true;
-    log_message_ = std::move(log_message);
+    log_message_.Set(std::move(log_message));
     return *this;
   }
   /// Sets `log_message` (no 1) and returns `*this`.
@@ -142,9 +167,13 @@ class LogMessageRequest final : public PbMessage {
     return std::move(set_log_message(std::move(log_message)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see log_message()
-  LogMessage log_message_{};
+  PbLazy<LogMessage> log_message_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<1> set_fields_;
@@ -188,6 +217,11 @@ class LogMessageEvent final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -196,20 +230,33 @@ class LogMessageEvent final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.LogMessageEvent`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.LogMessageEvent"; }
 
   /// The full name of the message: `horus.pb.LogMessageEvent`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LogMessageEvent`, e.g. to build a `PbFieldMask<LogMessageEvent>`.
+  enum class Field : PbTag {
+    /// Field `log_message`.
+    kLogMessage = 1,
+  };
+
   // Field `log_message` (no 1).
   // -----
 
   /// The logged message.
   ///
   /// Field no: 1.
-  constexpr const LogMessage& log_message() const& noexcept HORUS_LIFETIME_BOUND {
-    return log_message_;
+  ///
+  /// If `log_message` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `log_message` was received and is not a valid message.
+  const LogMessage& log_message() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return log_message_.Ref();
   }
 
   /// If `log_message` is set, moves it out of the message (without marking it as unset).
@@ -217,19 +264,23 @@ class LogMessageEvent final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  LogMessage log_message() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `log_message` was received and is not a valid message.
+  LogMessage log_message() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(log_message_);
+    return std::move(log_message_).Take();
   }
 
   /// The logged message.
   ///
   /// Field no: 1.
-  LogMessage& mutable_log_message() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `log_message` was received and is not a valid message.
+  LogMessage& mutable_log_message() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return log_message_;
+    return log_message_.Mutable();
   }
 
   /// Returns whether `log_message` (no 1) is set.
@@ -238,13 +289,13 @@ class LogMessageEvent final : public PbMessage {
   /// Clears `log_message` (no 1).
   void clear_log_message() & noexcept {
     set_fields_[0] = false;
-    log_message_ = {};
+    log_message_.Clear();
   }
 
   /// Sets `log_message` (no 1) and returns `*this`.
   LogMessageEvent& set_log_message(LogMessage&& log_message) & noexcept {
     set_fields_[0] = true;
-    log_message_ = std::move(log_message);
+    log_message_.Set(std::move(log_message));
     return *this;
   }
   /// Sets `log_message` (no 1) and returns `*this`.
@@ -252,9 +303,13 @@ class LogMessageEvent final : public PbMessage {
     return std::move(set_log_message(std::move(log_message)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see log_message()
-  LogMessage log_message_{};
+  PbLazy<LogMessage> log_message_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<1> set_fields_;
@@ -298,6 +353,11 @@ class ProfilingInfoEvent final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -306,20 +366,33 @@ class ProfilingInfoEvent final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.ProfilingInfoEvent`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.ProfilingInfoEvent"; }
 
   /// The full name of the message: `horus.pb.ProfilingInfoEvent`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ProfilingInfoEvent`, e.g. to build a `PbFieldMask<ProfilingInfoEvent>`.
+  enum class Field : PbTag {
+    /// Field `profiling_info`.
+    kProfilingInfo = 1,
+  };
+
   // Field `profiling_info` (no 1).
   // -----
 
   /// No documentation.
   ///
   /// Field no: 1.
-  constexpr const ProfilingInfo& profiling_info() const& noexcept HORUS_LIFETIME_BOUND {
-    return profiling_info_;
+  ///
+  /// If `profiling_info` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `profiling_info` was received and is not a valid message.
+  const ProfilingInfo& profiling_info() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return profiling_info_.Ref();
   }
 
   /// If `profiling_info` is set, moves it out of the message (without marking it as unset).
@@ -327,19 +400,23 @@ class ProfilingInfoEvent final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  ProfilingInfo profiling_info() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `profiling_info` was received and is not a valid message.
+  ProfilingInfo profiling_info() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(profiling_info_);
+    return std::move(profiling_info_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 1.
-  ProfilingInfo& mutable_profiling_info() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `profiling_info` was received and is not a valid message.
+  ProfilingInfo& mutable_profiling_info() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return profiling_info_;
+    return profiling_info_.Mutable();
   }
 
   /// Returns whether `profiling_info` (no 1) is set.
@@ -348,13 +425,13 @@ class ProfilingInfoEvent final : public PbMessage {
   /// Clears `profiling_info` (no 1).
   void clear_profiling_info() & noexcept {
     set_fields_[0] = false;
-    profiling_info_ = {};
+    profiling_info_.Clear();
   }
 
   /// Sets `profiling_info` (no 1) and returns `*this`.
   ProfilingInfoEvent& set_profiling_info(ProfilingInfo&& profiling_info) & noexcept {
     set_fields_[0] = true;
-    profiling_info_ = std::move(profiling_info);
+    profiling_info_.Set(std::move(profiling_info));
     return *this;
   }
   /// Sets `profiling_info` (no 1) and returns `*this`.
@@ -362,9 +439,13 @@ class ProfilingInfoEvent final : public PbMessage {
     return std::move(set_profiling_info(std::move(profiling_info)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see profiling_info()
-  ProfilingInfo profiling_info_{};
+  PbLazy<ProfilingInfo> profiling_info_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<1> set_fields_;
@@ -408,6 +489,11 @@ class SensorInfoEvent final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -416,12 +502,21 @@ class SensorInfoEvent final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.SensorInfoEvent`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.SensorInfoEvent"; }
 
   /// The full name of the message: `horus.pb.SensorInfoEvent`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `SensorInfoEvent`, e.g. to build a `PbFieldMask<SensorInfoEvent>`.
+  enum class Field : PbTag {
+    /// Field `sensor_info`.
+    kSensorInfo = 1,
+  };
+
   // Field `sensor_info` (no 1).
   // -----
 
@@ -472,6 +567,10 @@ class SensorInfoEvent final : public PbMessage {
     return std::move(set_sensor_info(std::move(sensor_info)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see sensor_info()
   CowRepeated<SensorInfo> sensor_info_{};
@@ -1,6 +1,9 @@
 #include "horus/pb/point/point_message_pb.h"
 
+#include <cstddef>
+
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 
 namespace horus {
 namespace sdk {
@@ -14,49 +17,21 @@ PointFrame_Header::PointFrame_Header(const PointFrame_Header& other) noexcept(fa
     , set_fields_{other.set_fields_} {}
 
 void PointFrame_Header::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<AffineTransform3f>(writer, /*tag=*/ 1, calibration_transform_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_id_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<Timestamp>(writer, /*tag=*/ 4, point_cloud_creation_timestamp_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 5, static_env_learning_progress_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t PointFrame_Header::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void PointFrame_Header::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<AffineTransform3f>(reader, calibration_transform_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<Timestamp>(reader, point_cloud_creation_timestamp_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 5: {
-        DeserializeField<std::uint32_t>(reader, static_env_learning_progress_);
-        set_fields_[3] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void PointFrame_Header::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 AttributedPoints::AttributedPoints(const AttributedPoints& other) noexcept(false)
@@ -68,57 +43,21 @@ AttributedPoints::AttributedPoints(const AttributedPoints& other) noexcept(false
     , set_fields_{other.set_fields_} {}
 
 void AttributedPoints::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowSpan<float>, PbDeserFlags::kFixed>(writer, /*tag=*/ 1, flattened_points_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowSpan<std::uint32_t>, PbDeserFlags::kFixed>(writer, /*tag=*/ 2, attributes_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowSpan<std::uint32_t>, PbDeserFlags::kFixed>(writer, /*tag=*/ 3, intensities_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 5, ring_indices_);
-  }
-  if (set_fields_[4]) {
-    SerializeField<CowRepeated<Timestamp>>(writer, /*tag=*/ 6, timestamps_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t AttributedPoints::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void AttributedPoints::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowSpan<float>, PbDeserFlags::kFixed>(reader, flattened_points_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowSpan<std::uint32_t>, PbDeserFlags::kFixed>(reader, attributes_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowSpan<std::uint32_t>, PbDeserFlags::kFixed>(reader, intensities_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 5: {
-        DeserializeField<CowBytes>(reader, ring_indices_);
-        set_fields_[3] = true;
-        break;
-      }
-      case 6: {
-        DeserializeField<CowRepeated<Timestamp>>(reader, timestamps_);
-        set_fields_[4] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void AttributedPoints::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 PointFrame::PointFrame(const PointFrame& other) noexcept(false)
@@ -128,41 +67,21 @@ PointFrame::PointFrame(const PointFrame& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void PointFrame::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 1, id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<PointFrame_Header>(writer, /*tag=*/ 2, header_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<AttributedPoints>(writer, /*tag=*/ 9, points_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t PointFrame::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void PointFrame::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint32_t>(reader, id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<PointFrame_Header>(reader, header_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 9: {
-        DeserializeField<AttributedPoints>(reader, points_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void PointFrame::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ProcessedPointsEvent::ProcessedPointsEvent(const ProcessedPointsEvent& other) noexcept(false)
@@ -170,25 +89,21 @@ ProcessedPointsEvent::ProcessedPointsEvent(const ProcessedPointsEvent& other) no
     , set_fields_{other.set_fields_} {}
 
 void ProcessedPointsEvent::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<PointFrame>(writer, /*tag=*/ 1, point_frame_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ProcessedPointsEvent::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ProcessedPointsEvent::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<PointFrame>(reader, point_frame_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ProcessedPointsEvent::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 AggregatedPointEvents::AggregatedPointEvents(const AggregatedPointEvents& other) noexcept(false)
@@ -196,27 +111,113 @@ AggregatedPointEvents::AggregatedPointEvents(const AggregatedPointEvents& other)
     , set_fields_{other.set_fields_} {}
 
 void AggregatedPointEvents::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowRepeated<ProcessedPointsEvent>>(writer, /*tag=*/ 1, events_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t AggregatedPointEvents::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void AggregatedPointEvents::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowRepeated<ProcessedPointsEvent>>(reader, events_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void AggregatedPointEvents::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
+}
+
+// MARK: Field tables
+
+// Messages are not standard-layout since they have a vtable, so `offsetof()` is only
+// conditionally-supported on them; it is supported by all compilers targeted by the SDK.
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
+const horus_internal::PbMessageTable& PointFrame_Header::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(PointFrame_Header, calibration_transform_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<AffineTransform3f>>::kOps},
+      {/*tag=*/ 2, offsetof(PointFrame_Header, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 4, offsetof(PointFrame_Header, point_cloud_creation_timestamp_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Timestamp>>::kOps},
+      {/*tag=*/ 5, offsetof(PointFrame_Header, static_env_learning_progress_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& AttributedPoints::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(AttributedPoints, flattened_points_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowSpan<float>, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 2, offsetof(AttributedPoints, attributes_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowSpan<std::uint32_t>, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 3, offsetof(AttributedPoints, intensities_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowSpan<std::uint32_t>, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 5, offsetof(AttributedPoints, ring_indices_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 6, offsetof(AttributedPoints, timestamps_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<Timestamp>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& PointFrame::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(PointFrame, id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/ 2, offsetof(PointFrame, header_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<PointFrame_Header>>::kOps},
+      {/*tag=*/ 9, offsetof(PointFrame, points_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<AttributedPoints>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ProcessedPointsEvent::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ProcessedPointsEvent, point_frame_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<PointFrame>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& AggregatedPointEvents::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(AggregatedPointEvents, events_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<ProcessedPointsEvent>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
 }
 
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
 }  // namespace pb
 }  // namespace sdk
 }  // namespace horus
@@ -8,6 +8,7 @@
 /// Generated by `/opt/actions-runner/_work/horus/horus/common/tools/sdk/pb.ts`.
 
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -17,8 +18,10 @@
 #include "horus/pb/cow_bytes.h"
 #include "horus/pb/cow_repeated.h"
 #include "horus/pb/cow_span.h"
+#include "horus/pb/lazy.h"
 #include "horus/pb/message.h"
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 #include "horus/pb/types.h"
 #include "horus/strings/string_view.h"
 
@@ -119,6 +122,11 @@ class PointFrame_Header final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -127,20 +135,39 @@ class PointFrame_Header final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.PointFrame.Header`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.PointFrame.Header"; }
 
   /// The full name of the message: `horus.pb.PointFrame.Header`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `PointFrame_Header`, e.g. to build a `PbFieldMask<PointFrame_Header>`.
+  enum class Field : PbTag {
+    /// Field `calibration_transform`.
+    kCalibrationTransform = 1,
+    /// Field `lidar_id`.
+    kLidarId = 2,
+    /// Field `point_cloud_creation_timestamp`.
+    kPointCloudCreationTimestamp = 4,
+    /// Field `static_env_learning_progress`.
+    kStaticEnvLearningProgress = 5,
+  };
+
   // Field `calibration_transform` (no 1).
   // -----
 
   /// / The calibration transformation (from sensor to origin coordinates)
   ///
   /// Field no: 1.
-  constexpr const AffineTransform3f& calibration_transform() const& noexcept HORUS_LIFETIME_BOUND {
-    return calibration_transform_;
+  ///
+  /// If `calibration_transform` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `calibration_transform` was received and is not a valid message.
+  const AffineTransform3f& calibration_transform() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return calibration_transform_.Ref();
   }
 
   /// If `calibration_transform` is set, moves it out of the message (without marking it as unset).
@@ -148,19 +175,23 @@ class PointFrame_Header final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  AffineTransform3f calibration_transform() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `calibration_transform` was received and is not a valid message.
+  AffineTransform3f calibration_transform() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(calibration_transform_);
+    return std::move(calibration_transform_).Take();
   }
 
   /// / The calibration transformation (from sensor to origin coordinates)
   ///
   /// Field no: 1.
-  AffineTransform3f& mutable_calibration_transform() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `calibration_transform` was received and is not a valid message.
+  AffineTransform3f& mutable_calibration_transform() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return calibration_transform_;
+    return calibration_transform_.Mutable();
   }
 
   /// Returns whether `calibration_transform` (no 1) is set.
@@ -169,13 +200,13 @@ class PointFrame_Header final : public PbMessage {
   /// Clears `calibration_transform` (no 1).
   void clear_calibration_transform() & noexcept {
     set_fields_[0] = false;
-    calibration_transform_ = {};
+    calibration_transform_.Clear();
   }
 
   /// Sets `calibration_transform` (no 1) and returns `*this`.
   PointFrame_Header& set_calibration_transform(AffineTransform3f&& calibration_transform) & noexcept {
     set_fields_[0] = true;
-    calibration_transform_ = std::move(calibration_transform);
+    calibration_transform_.Set(std::move(calibration_transform));
     return *this;
   }
   /// Sets `calibration_transform` (no 1) and returns `*this`.
@@ -239,8 +270,12 @@ class PointFrame_Header final : public PbMessage {
   /// / The point cloud creation timestamp.
   ///
   /// Field no: 4.
-  constexpr const Timestamp& point_cloud_creation_timestamp() const& noexcept HORUS_LIFETIME_BOUND {
-    return point_cloud_creation_timestamp_;
+  ///
+  /// If `point_cloud_creation_timestamp` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `point_cloud_creation_timestamp` was received and is not a valid message.
+  const Timestamp& point_cloud_creation_timestamp() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return point_cloud_creation_timestamp_.Ref();
   }
 
   /// If `point_cloud_creation_timestamp` is set, moves it out of the message (without marking it as unset).
@@ -248,19 +283,23 @@ class PointFrame_Header final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 4.
-  Timestamp point_cloud_creation_timestamp() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `point_cloud_creation_timestamp` was received and is not a valid message.
+  Timestamp point_cloud_creation_timestamp() && noexcept(false) {
     if (!set_fields_[2]) {
       return {};
     }
-    return std::move(point_cloud_creation_timestamp_);
+    return std::move(point_cloud_creation_timestamp_).Take();
   }
 
   /// / The point cloud creation timestamp.
   ///
   /// Field no: 4.
-  Timestamp& mutable_point_cloud_creation_timestamp() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `point_cloud_creation_timestamp` was received and is not a valid message.
+  Timestamp& mutable_point_cloud_creation_timestamp() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[2] = true;
-    return point_cloud_creation_timestamp_;
+    return point_cloud_creation_timestamp_.Mutable();
   }
 
   /// Returns whether `point_cloud_creation_timestamp` (no 4) is set.
@@ -269,13 +308,13 @@ class PointFrame_Header final : public PbMessage {
   /// Clears `point_cloud_creation_timestamp` (no 4).
   void clear_point_cloud_creation_timestamp() & noexcept {
     set_fields_[2] = false;
-    point_cloud_creation_timestamp_ = {};
+    point_cloud_creation_timestamp_.Clear();
   }
 
   /// Sets `point_cloud_creation_timestamp` (no 4) and returns `*this`.
   PointFrame_Header& set_point_cloud_creation_timestamp(Timestamp&& point_cloud_creation_timestamp) & noexcept {
     set_fields_[2] = true;
-    point_cloud_creation_timestamp_ = std::move(point_cloud_creation_timestamp);
+    point_cloud_creation_timestamp_.Set(std::move(point_cloud_creation_timestamp));
     return *this;
   }
   /// Sets `point_cloud_creation_timestamp` (no 4) and returns `*this`.
@@ -321,13 +360,17 @@ class PointFrame_Header final : public PbMessage {
     return std::move(set_static_env_learning_progress(static_env_learning_progress));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see calibration_transform()
-  AffineTransform3f calibration_transform_{};
+  PbLazy<AffineTransform3f> calibration_transform_{};
   /// @see lidar_id()
   CowBytes lidar_id_{};
   /// @see point_cloud_creation_timestamp()
-  Timestamp point_cloud_creation_timestamp_{};
+  PbLazy<Timestamp> point_cloud_creation_timestamp_{};
   /// @see static_env_learning_progress()
   std::uint32_t static_env_learning_progress_{};
 
@@ -376,6 +419,11 @@ class AttributedPoints final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -384,12 +432,29 @@ class AttributedPoints final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.AttributedPoints`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.AttributedPoints"; }
 
   /// The full name of the message: `horus.pb.AttributedPoints`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `AttributedPoints`, e.g. to build a `PbFieldMask<AttributedPoints>`.
+  enum class Field : PbTag {
+    /// Field `flattened_points`.
+    kFlattenedPoints = 1,
+    /// Field `attributes`.
+    kAttributes = 2,
+    /// Field `intensities`.
+    kIntensities = 3,
+    /// Field `ring_indices`.
+    kRingIndices = 5,
+    /// Field `timestamps`.
+    kTimestamps = 6,
+  };
+
   // Field `flattened_points` (no 1).
   // -----
 
@@ -672,6 +737,10 @@ class AttributedPoints final : public PbMessage {
     return std::move(set_timestamps(std::move(timestamps)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see flattened_points()
   CowSpan<float> flattened_points_{};
@@ -732,6 +801,11 @@ class PointFrame final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -740,12 +814,25 @@ class PointFrame final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.PointFrame`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.PointFrame"; }
 
   /// The full name of the message: `horus.pb.PointFrame`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `PointFrame`, e.g. to build a `PbFieldMask<PointFrame>`.
+  enum class Field : PbTag {
+    /// Field `id`.
+    kId = 1,
+    /// Field `header`.
+    kHeader = 2,
+    /// Field `points`.
+    kPoints = 9,
+  };
+
   // Field `id` (no 1).
   // -----
 
@@ -792,8 +879,12 @@ class PointFrame final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 2.
-  constexpr const PointFrame_Header& header() const& noexcept HORUS_LIFETIME_BOUND {
-    return header_;
+  ///
+  /// If `header` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `header` was received and is not a valid message.
+  const PointFrame_Header& header() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return header_.Ref();
   }
 
   /// If `header` is set, moves it out of the message (without marking it as unset).
@@ -801,19 +892,23 @@ class PointFrame final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  PointFrame_Header header() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `header` was received and is not a valid message.
+  PointFrame_Header header() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(header_);
+    return std::move(header_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 2.
-  PointFrame_Header& mutable_header() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `header` was received and is not a valid message.
+  PointFrame_Header& mutable_header() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return header_;
+    return header_.Mutable();
   }
 
   /// Returns whether `header` (no 2) is set.
@@ -822,13 +917,13 @@ class PointFrame final : public PbMessage {
   /// Clears `header` (no 2).
   void clear_header() & noexcept {
     set_fields_[1] = false;
-    header_ = {};
+    header_.Clear();
   }
 
   /// Sets `header` (no 2) and returns `*this`.
   PointFrame& set_header(PointFrame_Header&& header) & noexcept {
     set_fields_[1] = true;
-    header_ = std::move(header);
+    header_.Set(std::move(header));
     return *this;
   }
   /// Sets `header` (no 2) and returns `*this`.
@@ -843,8 +938,12 @@ class PointFrame final : public PbMessage {
   ///  decompression/dequantization
   ///
   /// Field no: 9.
-  constexpr const AttributedPoints& points() const& noexcept HORUS_LIFETIME_BOUND {
-    return points_;
+  ///
+  /// If `points` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `points` was received and is not a valid message.
+  const AttributedPoints& points() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return points_.Ref();
   }
 
   /// If `points` is set, moves it out of the message (without marking it as unset).
@@ -852,20 +951,24 @@ class PointFrame final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 9.
-  AttributedPoints points() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `points` was received and is not a valid message.
+  AttributedPoints points() && noexcept(false) {
     if (!set_fields_[2]) {
       return {};
     }
-    return std::move(points_);
+    return std::move(points_).Take();
   }
 
   /// TODO(HRS-1898): This is kept until the frontend handles
   ///  decompression/dequantization
   ///
   /// Field no: 9.
-  AttributedPoints& mutable_points() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `points` was received and is not a valid message.
+  AttributedPoints& mutable_points() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[2] = true;
-    return points_;
+    return points_.Mutable();
   }
 
   /// Returns whether `points` (no 9) is set.
@@ -874,13 +977,13 @@ class PointFrame final : public PbMessage {
   /// Clears `points` (no 9).
   void clear_points() & noexcept {
     set_fields_[2] = false;
-    points_ = {};
+    points_.Clear();
   }
 
   /// Sets `points` (no 9) and returns `*this`.
   PointFrame& set_points(AttributedPoints&& points) & noexcept {
     set_fields_[2] = true;
-    points_ = std::move(points);
+    points_.Set(std::move(points));
     return *this;
   }
   /// Sets `points` (no 9) and returns `*this`.
@@ -888,13 +991,17 @@ class PointFrame final : public PbMessage {
     return std::move(set_points(std::move(points)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see id()
   std::uint32_t id_{};
   /// @see header()
-  PointFrame_Header header_{};
+  PbLazy<PointFrame_Header> header_{};
   /// @see points()
-  AttributedPoints points_{};
+  PbLazy<AttributedPoints> points_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<3> set_fields_;
@@ -938,6 +1045,11 @@ class ProcessedPointsEvent final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -946,20 +1058,33 @@ class ProcessedPointsEvent final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.ProcessedPointsEvent`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.ProcessedPointsEvent"; }
 
   /// The full name of the message: `horus.pb.ProcessedPointsEvent`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ProcessedPointsEvent`, e.g. to build a `PbFieldMask<ProcessedPointsEvent>`.
+  enum class Field : PbTag {
+    /// Field `point_frame`.
+    kPointFrame = 1,
+  };
+
   // Field `point_frame` (no 1).
   // -----
 
   /// No documentation.
   ///
   /// Field no: 1.
-  constexpr const PointFrame& point_frame() const& noexcept HORUS_LIFETIME_BOUND {
-    return point_frame_;
+  ///
+  /// If `point_frame` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `point_frame` was received and is not a valid message.
+  const PointFrame& point_frame() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return point_frame_.Ref();
   }
 
   /// If `point_frame` is set, moves it out of the message (without marking it as unset).
@@ -967,19 +1092,23 @@ class ProcessedPointsEvent final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  PointFrame point_frame() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `point_frame` was received and is not a valid message.
+  PointFrame point_frame() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(point_frame_);
+    return std::move(point_frame_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 1.
-  PointFrame& mutable_point_frame() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `point_frame` was received and is not a valid message.
+  PointFrame& mutable_point_frame() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return point_frame_;
+    return point_frame_.Mutable();
   }
 
   /// Returns whether `point_frame` (no 1) is set.
@@ -988,13 +1117,13 @@ class ProcessedPointsEvent final : public PbMessage {
   /// Clears `point_frame` (no 1).
   void clear_point_frame() & noexcept {
     set_fields_[0] = false;
-    point_frame_ = {};
+    point_frame_.Clear();
   }
 
   /// Sets `point_frame` (no 1) and returns `*this`.
   ProcessedPointsEvent& set_point_frame(PointFrame&& point_frame) & noexcept {
     set_fields_[0] = true;
-    point_frame_ = std::move(point_frame);
+    point_frame_.Set(std::move(point_frame));
     return *this;
   }
   /// Sets `point_frame` (no 1) and returns `*this`.
@@ -1002,9 +1131,13 @@ class ProcessedPointsEvent final : public PbMessage {
     return std::move(set_point_frame(std::move(point_frame)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see point_frame()
-  PointFrame point_frame_{};
+  PbLazy<PointFrame> point_frame_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<1> set_fields_;
@@ -1048,6 +1181,11 @@ class AggregatedPointEvents final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1056,12 +1194,21 @@ class AggregatedPointEvents final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.AggregatedPointEvents`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.AggregatedPointEvents"; }
 
   /// The full name of the message: `horus.pb.AggregatedPointEvents`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `AggregatedPointEvents`, e.g. to build a `PbFieldMask<AggregatedPointEvents>`.
+  enum class Field : PbTag {
+    /// Field `events`.
+    kEvents = 1,
+  };
+
   // Field `events` (no 1).
   // -----
 
@@ -1112,6 +1259,10 @@ class AggregatedPointEvents final : public PbMessage {
     return std::move(set_events(std::move(events)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see events()
   CowRepeated<ProcessedPointsEvent> events_{};
@@ -1257,6 +1408,11 @@ class PbTraits<horus::sdk::pb::PointAttribute> final {
     writer.Writer().add_enum(tag, static_cast<PbEnum>(value));
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, horus::sdk::pb::PointAttribute value) noexcept {
+    return PbTraits<PbEnum>::ByteSize(tag, static_cast<PbEnum>(value));
+  }
+
   /// Deserializes `horus::sdk::pb::PointAttribute` from `reader`.
   static horus::sdk::pb::PointAttribute Deserialize(PbReader& reader) {
     return PbEnumTraits<horus::sdk::pb::PointAttribute>::ValueOf(reader.Reader().get_enum());
@@ -0,0 +1,102 @@
+/// @file
+///
+/// The `PbMessagePool` class.
+
+#ifndef HORUS_PB_POOL_H_
+#define HORUS_PB_POOL_H_
+
+#include <cstddef>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "horus/pb/message.h"
+
+namespace horus {
+
+/// Default maximum number of messages kept by a `PbMessagePool`.
+constexpr std::size_t kPbDefaultMessagePoolSize{8};
+
+/// A pool of cleared messages of type `T`, which keep the capacity of the buffers they own.
+///
+/// Messages which are filled frame after frame (e.g. by `CowSpan::Vector()`, `CowBytes::String()`
+/// or `Add()`) can be `Acquire()`d from the pool and `Release()`d once processed, so that steady
+/// processing reuses the same buffers rather than allocating new ones for each frame.
+///
+/// Note that deserializing a field replaces the buffer it owns by a view of the received bytes, so
+/// the buffers of pooled messages are only reused by messages which are filled by hand. Pooling
+/// received messages saves the allocations of the fields which are then mutated, but not the
+/// allocation of the received bytes themselves. In particular, the SDK does not pool received
+/// point clouds, whose frames are views of the received bytes.
+///
+/// A `PbMessagePool` is thread-safe: messages may be acquired and released from any thread.
+template <class T>
+class PbMessagePool final {
+ public:
+  /// Constructs an empty pool which keeps up to `max_size` released messages.
+  ///
+  /// @throws std::bad_alloc If the list of released messages cannot be allocated.
+  explicit PbMessagePool(std::size_t max_size = kPbDefaultMessagePoolSize) noexcept(false)
+      : max_size_{max_size} {
+    static_assert(std::is_base_of<PbMessage, T>::value, "T must be a Protobuf message");
+    messages_.reserve(max_size);
+  }
+
+  /// Pools cannot be copied.
+  PbMessagePool(const PbMessagePool&) = delete;
+  /// Pools cannot be copied.
+  PbMessagePool& operator=(const PbMessagePool&) = delete;
+  /// Pools cannot be moved.
+  PbMessagePool(PbMessagePool&&) = delete;
+  /// Pools cannot be moved.
+  PbMessagePool& operator=(PbMessagePool&&) = delete;
+
+  /// Destroys the pool and the messages it holds.
+  ~PbMessagePool() noexcept = default;
+
+  /// Returns a previously released (and cleared) message, or a default-initialized message if the
+  /// pool is empty.
+  T Acquire() noexcept {
+    const std::lock_guard<std::mutex> lock{mutex_};
+    if (messages_.empty()) {
+      return T{};
+    }
+    T message{std::move(messages_.back())};
+    messages_.pop_back();
+    return message;
+  }
+
+  /// Clears `message` and keeps it for a later `Acquire()`, unless the pool already holds
+  /// `MaxSize()` messages, in which case `message` is destroyed.
+  void Release(T&& message) noexcept {
+    T released{std::move(message)};
+    released.Clear();
+    const std::lock_guard<std::mutex> lock{mutex_};
+    if (messages_.size() < max_size_) {
+      // Does not allocate since `messages_` reserved `max_size_` messages.
+      messages_.push_back(std::move(released));
+    }
+  }
+
+  /// Returns the number of messages currently held by the pool.
+  std::size_t Size() const noexcept {
+    const std::lock_guard<std::mutex> lock{mutex_};
+    return messages_.size();
+  }
+
+  /// Returns the maximum number of messages held by the pool.
+  constexpr std::size_t MaxSize() const noexcept { return max_size_; }
+
+ private:
+  /// @see MaxSize()
+  const std::size_t max_size_;
+  /// Protects `messages_`.
+  mutable std::mutex mutex_;
+  /// The released messages.
+  std::vector<T> messages_;
+};
+
+}  // namespace horus
+
+#endif  // HORUS_PB_POOL_H_
@@ -0,0 +1,123 @@
+#include "horus/pb/pool.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "horus/pb/buffer.h"
+#include "horus/pb/cow_bytes.h"
+#include "horus/pb/serialize.h"
+#include "horus/pb/testing/messages_pb.h"
+#include "horus/testing/allocations.h"
+
+namespace horus {
+namespace {
+
+using SubMessage = pb::TestMessage::SubMessage;
+
+/// Fills `message` as a producer of frames would, with `size` items in its repeated fields.
+void FillFrame(pb::TestMessage& message, std::size_t size) {
+  message.set_u32(static_cast<std::uint32_t>(size));
+  std::vector<float>& floats{message.mutable_rep_float().Vector()};
+  for (std::size_t i{0}; i < size; ++i) {
+    floats.push_back(static_cast<float>(i));
+  }
+  for (std::size_t i{0}; i < size; ++i) {
+    static_cast<void>(message.mutable_rep_i32().Add(static_cast<std::int32_t>(i)));
+  }
+  std::vector<std::uint8_t>& bytes{message.mutable_string().String()};
+  static_cast<void>(bytes.insert(bytes.end(), size, 'x'));
+  SubMessage& submessage{message.mutable_submessage()};
+  submessage.set_u32(1);
+  std::vector<std::uint8_t>& sub_bytes{submessage.mutable_string().String()};
+  static_cast<void>(sub_bytes.insert(sub_bytes.end(), size, 'y'));
+}
+
+TEST(PbMessage, ClearKeepsCapacity) {
+  pb::TestMessage message;
+  FillFrame(message, 100);
+  const float* const floats{message.mutable_rep_float().Vector().data()};
+
+  message.Clear();
+  EXPECT_TRUE(message.IsEmpty());
+  EXPECT_EQ(message.u32(), 0);
+  EXPECT_EQ(message.rep_float().Span().size(), 0);
+  EXPECT_EQ(message.rep_i32().size(), 0);
+  EXPECT_EQ(message.string().Str().size(), 0);
+  EXPECT_FALSE(message.has_submessage());
+  EXPECT_TRUE(message.submessage().IsEmpty());
+  EXPECT_EQ(message.SerializeToBuffer(), std::vector<std::uint8_t>{});
+
+  EXPECT_GE(message.mutable_rep_float().Vector().capacity(), 100);
+  EXPECT_EQ(message.mutable_rep_float().Vector().data(), floats);
+  EXPECT_GE(message.mutable_string().String().capacity(), 100);
+  EXPECT_GE(message.mutable_submessage().mutable_string().String().capacity(), 100);
+}
+
+TEST(PbMessage, ClearReceivedMessage) {
+  const std::vector<std::uint8_t> bytes{
+      pb::TestMessage{}
+          .set_string(CowBytes::OwnedCopy("string"))
+          .set_submessage(SubMessage{}.set_u32(2))
+          .SerializeToBuffer()};
+  PbReader reader{PbBuffer{std::vector<std::uint8_t>{bytes}}};
+  pb::TestMessage message{reader};
+
+  message.Clear();
+  EXPECT_TRUE(message.IsEmpty());
+  EXPECT_EQ(message.string().Str(), "");
+  EXPECT_EQ(message.submessage().u32(), 0);
+
+  PbReader second_reader{PbBuffer{std::vector<std::uint8_t>{bytes}}};
+  message.DeserializeFrom(second_reader);
+  EXPECT_EQ(message.string().Str(), "string");
+  EXPECT_EQ(message.submessage().u32(), 2);
+}
+
+TEST(PbMessagePool, AcquireReturnsReleasedMessages) {
+  PbMessagePool<pb::TestMessage> pool{/*max_size=*/2};
+  EXPECT_EQ(pool.Size(), 0);
+  EXPECT_TRUE(pool.Acquire().IsEmpty());
+
+  for (int i{0}; i < 3; ++i) {
+    pb::TestMessage message;
+    FillFrame(message, 10);
+    pool.Release(std::move(message));
+  }
+  // The third message is dropped.
+  EXPECT_EQ(pool.Size(), 2);
+
+  pb::TestMessage message{pool.Acquire()};
+  EXPECT_EQ(pool.Size(), 1);
+  EXPECT_TRUE(message.IsEmpty());
+  EXPECT_GE(message.mutable_rep_float().Vector().capacity(), 10);
+}
+
+TEST(PbMessagePool, SteadyStateDoesNotAllocate) {
+  constexpr std::size_t kFrameSize{1000};
+  PbMessagePool<pb::TestMessage> pool;
+
+  // Warm up the pool, whose messages then own large enough buffers.
+  for (int frame{0}; frame < 2; ++frame) {
+    pb::TestMessage message{pool.Acquire()};
+    FillFrame(message, kFrameSize);
+    pool.Release(std::move(message));
+  }
+
+  std::size_t float_count{0};
+  const AllocationCounter counter;
+  for (int frame{0}; frame < 100; ++frame) {
+    pb::TestMessage message{pool.Acquire()};
+    FillFrame(message, kFrameSize);
+    float_count += message.rep_float().Span().size();
+    pool.Release(std::move(message));
+  }
+  EXPECT_EQ(counter.Count(), 0);
+  EXPECT_EQ(float_count, 100 * kFrameSize);
+}
+
+}  // namespace
+}  // namespace horus
@@ -1,6 +1,9 @@
 #include "horus/pb/preprocessing/messages_pb.h"
 
+#include <cstddef>
+
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 
 namespace horus {
 namespace sdk {
@@ -13,41 +16,21 @@ OccupancyGrid::OccupancyGrid(const OccupancyGrid& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void OccupancyGrid::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 1, rows_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 2, cols_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowRepeated<std::uint32_t>>(writer, /*tag=*/ 3, cells_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t OccupancyGrid::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void OccupancyGrid::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint32_t>(reader, rows_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::uint32_t>(reader, cols_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowRepeated<std::uint32_t>>(reader, cells_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void OccupancyGrid::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 OccupancyGridEvent::OccupancyGridEvent(const OccupancyGridEvent& other) noexcept(false)
@@ -60,65 +43,21 @@ OccupancyGridEvent::OccupancyGridEvent(const OccupancyGridEvent& other) noexcept
     , set_fields_{other.set_fields_} {}
 
 void OccupancyGridEvent::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<OccupancyGrid>(writer, /*tag=*/ 1, grid_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<float, PbDeserFlags::kFixed>(writer, /*tag=*/ 6, resolution_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<DetectionRange>(writer, /*tag=*/ 8, detection_range_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<Timestamp>(writer, /*tag=*/ 7, timestamp_);
-  }
-  if (set_fields_[4]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 10, node_id_);
-  }
-  if (set_fields_[5]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 11, detection_range_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t OccupancyGridEvent::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void OccupancyGridEvent::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<OccupancyGrid>(reader, grid_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 6: {
-        DeserializeField<float, PbDeserFlags::kFixed>(reader, resolution_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 8: {
-        DeserializeField<DetectionRange>(reader, detection_range_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 7: {
-        DeserializeField<Timestamp>(reader, timestamp_);
-        set_fields_[3] = true;
-        break;
-      }
-      case 10: {
-        DeserializeField<CowBytes>(reader, node_id_);
-        set_fields_[4] = true;
-        break;
-      }
-      case 11: {
-        DeserializeField<CowBytes>(reader, detection_range_name_);
-        set_fields_[5] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void OccupancyGridEvent::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 OccupancyGridListEvent::OccupancyGridListEvent(const OccupancyGridListEvent& other) noexcept(false)
@@ -126,25 +65,21 @@ OccupancyGridListEvent::OccupancyGridListEvent(const OccupancyGridListEvent& oth
     , set_fields_{other.set_fields_} {}
 
 void OccupancyGridListEvent::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowRepeated<OccupancyGridEvent>>(writer, /*tag=*/ 1, occupancy_grid_events_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t OccupancyGridListEvent::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void OccupancyGridListEvent::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowRepeated<OccupancyGridEvent>>(reader, occupancy_grid_events_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void OccupancyGridListEvent::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 SensorInfo_PoseCorrection::SensorInfo_PoseCorrection(const SensorInfo_PoseCorrection& other) noexcept(false)
@@ -153,33 +88,21 @@ SensorInfo_PoseCorrection::SensorInfo_PoseCorrection(const SensorInfo_PoseCorrec
     , set_fields_{other.set_fields_} {}
 
 void SensorInfo_PoseCorrection::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<Vector3f>(writer, /*tag=*/ 1, translation_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<Quaterniond>(writer, /*tag=*/ 2, rotation_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t SensorInfo_PoseCorrection::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void SensorInfo_PoseCorrection::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<Vector3f>(reader, translation_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<Quaterniond>(reader, rotation_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void SensorInfo_PoseCorrection::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 SensorInfo::SensorInfo(const SensorInfo& other) noexcept(false)
@@ -194,83 +117,131 @@ SensorInfo::SensorInfo(const SensorInfo& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void SensorInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, lidar_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 8, lidar_name_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 2, status_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<double, PbDeserFlags::kFixed>(writer, /*tag=*/ 3, measured_frequency_);
-  }
-  if (set_fields_[4]) {
-    SerializeField<SensorInfo_PoseCorrection>(writer, /*tag=*/ 4, pose_correction_);
-  }
-  if (set_fields_[5]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 5, num_total_dropped_packets_);
-  }
-  if (set_fields_[6]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 6, num_total_expected_packets_);
-  }
-  if (set_fields_[7]) {
-    SerializeField<ReferenceAlignmentType>(writer, /*tag=*/ 7, reference_alignment_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t SensorInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void SensorInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 8: {
-        DeserializeField<CowBytes>(reader, lidar_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::uint32_t>(reader, status_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<double, PbDeserFlags::kFixed>(reader, measured_frequency_);
-        set_fields_[3] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<SensorInfo_PoseCorrection>(reader, pose_correction_);
-        set_fields_[4] = true;
-        break;
-      }
-      case 5: {
-        DeserializeField<std::uint64_t>(reader, num_total_dropped_packets_);
-        set_fields_[5] = true;
-        break;
-      }
-      case 6: {
-        DeserializeField<std::uint64_t>(reader, num_total_expected_packets_);
-        set_fields_[6] = true;
-        break;
-      }
-      case 7: {
-        DeserializeField<ReferenceAlignmentType>(reader, reference_alignment_);
-        set_fields_[7] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void SensorInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
+}
+
+// MARK: Field tables
+
+// Messages are not standard-layout since they have a vtable, so `offsetof()` is only
+// conditionally-supported on them; it is supported by all compilers targeted by the SDK.
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
+const horus_internal::PbMessageTable& OccupancyGrid::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(OccupancyGrid, rows_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/ 2, offsetof(OccupancyGrid, cols_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/ 3, offsetof(OccupancyGrid, cells_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<std::uint32_t>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& OccupancyGridEvent::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(OccupancyGridEvent, grid_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<OccupancyGrid>>::kOps},
+      {/*tag=*/ 6, offsetof(OccupancyGridEvent, resolution_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<float, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 8, offsetof(OccupancyGridEvent, detection_range_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<DetectionRange>>::kOps},
+      {/*tag=*/ 7, offsetof(OccupancyGridEvent, timestamp_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Timestamp>>::kOps},
+      {/*tag=*/ 10, offsetof(OccupancyGridEvent, node_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 11, offsetof(OccupancyGridEvent, detection_range_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& OccupancyGridListEvent::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(OccupancyGridListEvent, occupancy_grid_events_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<OccupancyGridEvent>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& SensorInfo_PoseCorrection::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(SensorInfo_PoseCorrection, translation_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Vector3f>>::kOps},
+      {/*tag=*/ 2, offsetof(SensorInfo_PoseCorrection, rotation_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Quaterniond>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& SensorInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(SensorInfo, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 8, offsetof(SensorInfo, lidar_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(SensorInfo, status_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/ 3, offsetof(SensorInfo, measured_frequency_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<double, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 4, offsetof(SensorInfo, pose_correction_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<SensorInfo_PoseCorrection>>::kOps},
+      {/*tag=*/ 5, offsetof(SensorInfo, num_total_dropped_packets_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 6, offsetof(SensorInfo, num_total_expected_packets_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 7, offsetof(SensorInfo, reference_alignment_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<ReferenceAlignmentType>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
 }
 
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
 }  // namespace pb
 }  // namespace sdk
 }  // namespace horus
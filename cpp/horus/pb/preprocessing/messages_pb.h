@@ -8,6 +8,7 @@
 /// Generated by `/opt/actions-runner/_work/horus/horus/common/tools/sdk/pb.ts`.
 
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -17,8 +18,10 @@
 #include "horus/pb/config/schema/detection_range_pb.h"
 #include "horus/pb/cow_bytes.h"
 #include "horus/pb/cow_repeated.h"
+#include "horus/pb/lazy.h"
 #include "horus/pb/message.h"
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 #include "horus/pb/types.h"
 #include "horus/strings/string_view.h"
 
@@ -149,6 +152,11 @@ class OccupancyGrid final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -157,12 +165,25 @@ class OccupancyGrid final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.OccupancyGrid`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.OccupancyGrid"; }
 
   /// The full name of the message: `horus.pb.OccupancyGrid`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `OccupancyGrid`, e.g. to build a `PbFieldMask<OccupancyGrid>`.
+  enum class Field : PbTag {
+    /// Field `rows`.
+    kRows = 1,
+    /// Field `cols`.
+    kCols = 2,
+    /// Field `cells`.
+    kCells = 3,
+  };
+
   // Field `rows` (no 1).
   // -----
 
@@ -297,6 +318,10 @@ class OccupancyGrid final : public PbMessage {
     return std::move(set_cells(std::move(cells)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see rows()
   std::uint32_t rows_{};
@@ -362,6 +387,11 @@ class OccupancyGridEvent final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -370,20 +400,43 @@ class OccupancyGridEvent final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.OccupancyGridEvent`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.OccupancyGridEvent"; }
 
   /// The full name of the message: `horus.pb.OccupancyGridEvent`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `OccupancyGridEvent`, e.g. to build a `PbFieldMask<OccupancyGridEvent>`.
+  enum class Field : PbTag {
+    /// Field `grid`.
+    kGrid = 1,
+    /// Field `resolution`.
+    kResolution = 6,
+    /// Field `detection_range`.
+    kDetectionRange = 8,
+    /// Field `timestamp`.
+    kTimestamp = 7,
+    /// Field `node_id`.
+    kNodeId = 10,
+    /// Field `detection_range_name`.
+    kDetectionRangeName = 11,
+  };
+
   // Field `grid` (no 1).
   // -----
 
   /// / The grid data.
   ///
   /// Field no: 1.
-  constexpr const OccupancyGrid& grid() const& noexcept HORUS_LIFETIME_BOUND {
-    return grid_;
+  ///
+  /// If `grid` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `grid` was received and is not a valid message.
+  const OccupancyGrid& grid() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return grid_.Ref();
   }
 
   /// If `grid` is set, moves it out of the message (without marking it as unset).
@@ -391,19 +444,23 @@ class OccupancyGridEvent final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  OccupancyGrid grid() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `grid` was received and is not a valid message.
+  OccupancyGrid grid() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(grid_);
+    return std::move(grid_).Take();
   }
 
   /// / The grid data.
   ///
   /// Field no: 1.
-  OccupancyGrid& mutable_grid() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `grid` was received and is not a valid message.
+  OccupancyGrid& mutable_grid() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return grid_;
+    return grid_.Mutable();
   }
 
   /// Returns whether `grid` (no 1) is set.
@@ -412,13 +469,13 @@ class OccupancyGridEvent final : public PbMessage {
   /// Clears `grid` (no 1).
   void clear_grid() & noexcept {
     set_fields_[0] = false;
-    grid_ = {};
+    grid_.Clear();
   }
 
   /// Sets `grid` (no 1) and returns `*this`.
   OccupancyGridEvent& set_grid(OccupancyGrid&& grid) & noexcept {
     set_fields_[0] = true;
-    grid_ = std::move(grid);
+    grid_.Set(std::move(grid));
     return *this;
   }
   /// Sets `grid` (no 1) and returns `*this`.
@@ -470,8 +527,12 @@ class OccupancyGridEvent final : public PbMessage {
   /// / The resolution of the grid.
   ///
   /// Field no: 8.
-  constexpr const DetectionRange& detection_range() const& noexcept HORUS_LIFETIME_BOUND {
-    return detection_range_;
+  ///
+  /// If `detection_range` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `detection_range` was received and is not a valid message.
+  const DetectionRange& detection_range() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return detection_range_.Ref();
   }
 
   /// If `detection_range` is set, moves it out of the message (without marking it as unset).
@@ -479,19 +540,23 @@ class OccupancyGridEvent final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 8.
-  DetectionRange detection_range() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `detection_range` was received and is not a valid message.
+  DetectionRange detection_range() && noexcept(false) {
     if (!set_fields_[2]) {
       return {};
     }
-    return std::move(detection_range_);
+    return std::move(detection_range_).Take();
   }
 
   /// / The resolution of the grid.
   ///
   /// Field no: 8.
-  DetectionRange& mutable_detection_range() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `detection_range` was received and is not a valid message.
+  DetectionRange& mutable_detection_range() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[2] = true;
-    return detection_range_;
+    return detection_range_.Mutable();
   }
 
   /// Returns whether `detection_range` (no 8) is set.
@@ -500,13 +565,13 @@ class OccupancyGridEvent final : public PbMessage {
   /// Clears `detection_range` (no 8).
   void clear_detection_range() & noexcept {
     set_fields_[2] = false;
-    detection_range_ = {};
+    detection_range_.Clear();
   }
 
   /// Sets `detection_range` (no 8) and returns `*this`.
   OccupancyGridEvent& set_detection_range(DetectionRange&& detection_range) & noexcept {
     set_fields_[2] = true;
-    detection_range_ = std::move(detection_range);
+    detection_range_.Set(std::move(detection_range));
     return *this;
   }
   /// Sets `detection_range` (no 8) and returns `*this`.
@@ -520,8 +585,12 @@ class OccupancyGridEvent final : public PbMessage {
   /// / The timestamp of the event.
   ///
   /// Field no: 7.
-  constexpr const Timestamp& timestamp() const& noexcept HORUS_LIFETIME_BOUND {
-    return timestamp_;
+  ///
+  /// If `timestamp` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `timestamp` was received and is not a valid message.
+  const Timestamp& timestamp() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return timestamp_.Ref();
   }
 
   /// If `timestamp` is set, moves it out of the message (without marking it as unset).
@@ -529,19 +598,23 @@ class OccupancyGridEvent final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 7.
-  Timestamp timestamp() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `timestamp` was received and is not a valid message.
+  Timestamp timestamp() && noexcept(false) {
     if (!set_fields_[3]) {
       return {};
     }
-    return std::move(timestamp_);
+    return std::move(timestamp_).Take();
   }
 
   /// / The timestamp of the event.
   ///
   /// Field no: 7.
-  Timestamp& mutable_timestamp() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `timestamp` was received and is not a valid message.
+  Timestamp& mutable_timestamp() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[3] = true;
-    return timestamp_;
+    return timestamp_.Mutable();
   }
 
   /// Returns whether `timestamp` (no 7) is set.
@@ -550,13 +623,13 @@ class OccupancyGridEvent final : public PbMessage {
   /// Clears `timestamp` (no 7).
   void clear_timestamp() & noexcept {
     set_fields_[3] = false;
-    timestamp_ = {};
+    timestamp_.Clear();
   }
 
   /// Sets `timestamp` (no 7) and returns `*this`.
   OccupancyGridEvent& set_timestamp(Timestamp&& timestamp) & noexcept {
     set_fields_[3] = true;
-    timestamp_ = std::move(timestamp);
+    timestamp_.Set(std::move(timestamp));
     return *this;
   }
   /// Sets `timestamp` (no 7) and returns `*this`.
@@ -664,15 +737,19 @@ class OccupancyGridEvent final : public PbMessage {
     return std::move(set_detection_range_name(std::move(detection_range_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see grid()
-  OccupancyGrid grid_{};
+  PbLazy<OccupancyGrid> grid_{};
   /// @see resolution()
   float resolution_{};
   /// @see detection_range()
-  DetectionRange detection_range_{};
+  PbLazy<DetectionRange> detection_range_{};
   /// @see timestamp()
-  Timestamp timestamp_{};
+  PbLazy<Timestamp> timestamp_{};
   /// @see node_id()
   CowBytes node_id_{};
   /// @see detection_range_name()
@@ -721,6 +798,11 @@ class OccupancyGridListEvent final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -729,12 +811,21 @@ class OccupancyGridListEvent final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.OccupancyGridListEvent`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.OccupancyGridListEvent"; }
 
   /// The full name of the message: `horus.pb.OccupancyGridListEvent`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `OccupancyGridListEvent`, e.g. to build a `PbFieldMask<OccupancyGridListEvent>`.
+  enum class Field : PbTag {
+    /// Field `occupancy_grid_events`.
+    kOccupancyGridEvents = 1,
+  };
+
   // Field `occupancy_grid_events` (no 1).
   // -----
 
@@ -785,6 +876,10 @@ class OccupancyGridListEvent final : public PbMessage {
     return std::move(set_occupancy_grid_events(std::move(occupancy_grid_events)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see occupancy_grid_events()
   CowRepeated<OccupancyGridEvent> occupancy_grid_events_{};
@@ -831,6 +926,11 @@ class SensorInfo_PoseCorrection final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -839,20 +939,35 @@ class SensorInfo_PoseCorrection final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.SensorInfo.PoseCorrection`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.SensorInfo.PoseCorrection"; }
 
   /// The full name of the message: `horus.pb.SensorInfo.PoseCorrection`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `SensorInfo_PoseCorrection`, e.g. to build a `PbFieldMask<SensorInfo_PoseCorrection>`.
+  enum class Field : PbTag {
+    /// Field `translation`.
+    kTranslation = 1,
+    /// Field `rotation`.
+    kRotation = 2,
+  };
+
   // Field `translation` (no 1).
   // -----
 
   /// No documentation.
   ///
   /// Field no: 1.
-  constexpr const Vector3f& translation() const& noexcept HORUS_LIFETIME_BOUND {
-    return translation_;
+  ///
+  /// If `translation` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `translation` was received and is not a valid message.
+  const Vector3f& translation() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return translation_.Ref();
   }
 
   /// If `translation` is set, moves it out of the message (without marking it as unset).
@@ -860,19 +975,23 @@ class SensorInfo_PoseCorrection final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  Vector3f translation() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `translation` was received and is not a valid message.
+  Vector3f translation() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(translation_);
+    return std::move(translation_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 1.
-  Vector3f& mutable_translation() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `translation` was received and is not a valid message.
+  Vector3f& mutable_translation() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return translation_;
+    return translation_.Mutable();
   }
 
   /// Returns whether `translation` (no 1) is set.
@@ -881,13 +1000,13 @@ class SensorInfo_PoseCorrection final : public PbMessage {
   /// Clears `translation` (no 1).
   void clear_translation() & noexcept {
     set_fields_[0] = false;
-    translation_ = {};
+    translation_.Clear();
   }
 
   /// Sets `translation` (no 1) and returns `*this`.
   SensorInfo_PoseCorrection& set_translation(Vector3f&& translation) & noexcept {
     set_fields_[0] = true;
-    translation_ = std::move(translation);
+    translation_.Set(std::move(translation));
     return *this;
   }
   /// Sets `translation` (no 1) and returns `*this`.
@@ -901,8 +1020,12 @@ class SensorInfo_PoseCorrection final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 2.
-  constexpr const Quaterniond& rotation() const& noexcept HORUS_LIFETIME_BOUND {
-    return rotation_;
+  ///
+  /// If `rotation` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `rotation` was received and is not a valid message.
+  const Quaterniond& rotation() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return rotation_.Ref();
   }
 
   /// If `rotation` is set, moves it out of the message (without marking it as unset).
@@ -910,19 +1033,23 @@ class SensorInfo_PoseCorrection final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  Quaterniond rotation() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `rotation` was received and is not a valid message.
+  Quaterniond rotation() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(rotation_);
+    return std::move(rotation_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 2.
-  Quaterniond& mutable_rotation() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `rotation` was received and is not a valid message.
+  Quaterniond& mutable_rotation() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return rotation_;
+    return rotation_.Mutable();
   }
 
   /// Returns whether `rotation` (no 2) is set.
@@ -931,13 +1058,13 @@ class SensorInfo_PoseCorrection final : public PbMessage {
   /// Clears `rotation` (no 2).
   void clear_rotation() & noexcept {
     set_fields_[1] = false;
-    rotation_ = {};
+    rotation_.Clear();
   }
 
   /// Sets `rotation` (no 2) and returns `*this`.
   SensorInfo_PoseCorrection& set_rotation(Quaterniond&& rotation) & noexcept {
     set_fields_[1] = true;
-    rotation_ = std::move(rotation);
+    rotation_.Set(std::move(rotation));
     return *this;
   }
   /// Sets `rotation` (no 2) and returns `*this`.
@@ -945,11 +1072,15 @@ class SensorInfo_PoseCorrection final : public PbMessage {
     return std::move(set_rotation(std::move(rotation)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see translation()
-  Vector3f translation_{};
+  PbLazy<Vector3f> translation_{};
   /// @see rotation()
-  Quaterniond rotation_{};
+  PbLazy<Quaterniond> rotation_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<2> set_fields_;
@@ -995,6 +1126,11 @@ class SensorInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1003,12 +1139,35 @@ class SensorInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.SensorInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.SensorInfo"; }
 
   /// The full name of the message: `horus.pb.SensorInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `SensorInfo`, e.g. to build a `PbFieldMask<SensorInfo>`.
+  enum class Field : PbTag {
+    /// Field `lidar_id`.
+    kLidarId = 1,
+    /// Field `lidar_name`.
+    kLidarName = 8,
+    /// Field `status`.
+    kStatus = 2,
+    /// Field `measured_frequency`.
+    kMeasuredFrequency = 3,
+    /// Field `pose_correction`.
+    kPoseCorrection = 4,
+    /// Field `num_total_dropped_packets`.
+    kNumTotalDroppedPackets = 5,
+    /// Field `num_total_expected_packets`.
+    kNumTotalExpectedPackets = 6,
+    /// Field `reference_alignment`.
+    kReferenceAlignment = 7,
+  };
+
   // Field `lidar_id` (no 1).
   // -----
 
@@ -1191,8 +1350,12 @@ class SensorInfo final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 4.
-  constexpr const SensorInfo_PoseCorrection& pose_correction() const& noexcept HORUS_LIFETIME_BOUND {
-    return pose_correction_;
+  ///
+  /// If `pose_correction` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `pose_correction` was received and is not a valid message.
+  const SensorInfo_PoseCorrection& pose_correction() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return pose_correction_.Ref();
   }
 
   /// If `pose_correction` is set, moves it out of the message (without marking it as unset).
@@ -1200,19 +1363,23 @@ class SensorInfo final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 4.
-  SensorInfo_PoseCorrection pose_correction() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `pose_correction` was received and is not a valid message.
+  SensorInfo_PoseCorrection pose_correction() && noexcept(false) {
     if (!set_fields_[4]) {
       return {};
     }
-    return std::move(pose_correction_);
+    return std::move(pose_correction_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 4.
-  SensorInfo_PoseCorrection& mutable_pose_correction() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `pose_correction` was received and is not a valid message.
+  SensorInfo_PoseCorrection& mutable_pose_correction() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[4] = true;
-    return pose_correction_;
+    return pose_correction_.Mutable();
   }
 
   /// Returns whether `pose_correction` (no 4) is set.
@@ -1221,13 +1388,13 @@ class SensorInfo final : public PbMessage {
   /// Clears `pose_correction` (no 4).
   void clear_pose_correction() & noexcept {
     set_fields_[4] = false;
-    pose_correction_ = {};
+    pose_correction_.Clear();
   }
 
   /// Sets `pose_correction` (no 4) and returns `*this`.
   SensorInfo& set_pose_correction(SensorInfo_PoseCorrection&& pose_correction) & noexcept {
     set_fields_[4] = true;
-    pose_correction_ = std::move(pose_correction);
+    pose_correction_.Set(std::move(pose_correction));
     return *this;
   }
   /// Sets `pose_correction` (no 4) and returns `*this`.
@@ -1349,6 +1516,10 @@ class SensorInfo final : public PbMessage {
     return std::move(set_reference_alignment(reference_alignment));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see lidar_id()
   CowBytes lidar_id_{};
@@ -1359,7 +1530,7 @@ class SensorInfo final : public PbMessage {
   /// @see measured_frequency()
   double measured_frequency_{};
   /// @see pose_correction()
-  SensorInfo_PoseCorrection pose_correction_{};
+  PbLazy<SensorInfo_PoseCorrection> pose_correction_{};
   /// @see num_total_dropped_packets()
   std::uint64_t num_total_dropped_packets_{};
   /// @see num_total_expected_packets()
@@ -1463,6 +1634,11 @@ class PbTraits<horus::sdk::pb::OccupancyClassification> final {
     writer.Writer().add_enum(tag, static_cast<PbEnum>(value));
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, horus::sdk::pb::OccupancyClassification value) noexcept {
+    return PbTraits<PbEnum>::ByteSize(tag, static_cast<PbEnum>(value));
+  }
+
   /// Deserializes `horus::sdk::pb::OccupancyClassification` from `reader`.
   static horus::sdk::pb::OccupancyClassification Deserialize(PbReader& reader) {
     return PbEnumTraits<horus::sdk::pb::OccupancyClassification>::ValueOf(reader.Reader().get_enum());
@@ -1598,6 +1774,11 @@ class PbTraits<horus::sdk::pb::SensorStatus> final {
     writer.Writer().add_enum(tag, static_cast<PbEnum>(value));
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, horus::sdk::pb::SensorStatus value) noexcept {
+    return PbTraits<PbEnum>::ByteSize(tag, static_cast<PbEnum>(value));
+  }
+
   /// Deserializes `horus::sdk::pb::SensorStatus` from `reader`.
   static horus::sdk::pb::SensorStatus Deserialize(PbReader& reader) {
     return PbEnumTraits<horus::sdk::pb::SensorStatus>::ValueOf(reader.Reader().get_enum());
@@ -1637,6 +1818,11 @@ class PbTraits<horus::sdk::pb::ReferenceAlignmentType> final {
     writer.Writer().add_enum(tag, static_cast<PbEnum>(value));
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, horus::sdk::pb::ReferenceAlignmentType value) noexcept {
+    return PbTraits<PbEnum>::ByteSize(tag, static_cast<PbEnum>(value));
+  }
+
   /// Deserializes `horus::sdk::pb::ReferenceAlignmentType` from `reader`.
   static horus::sdk::pb::ReferenceAlignmentType Deserialize(PbReader& reader) {
     return PbEnumTraits<horus::sdk::pb::ReferenceAlignmentType>::ValueOf(reader.Reader().get_enum());
@@ -1,6 +1,9 @@
 #include "horus/pb/profiling_pb.h"
 
+#include <cstddef>
+
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 
 namespace horus {
 namespace sdk {
@@ -12,33 +15,21 @@ ProfilingSet_ProfiledDuration_PerformanceHint::ProfilingSet_ProfiledDuration_Per
     , set_fields_{other.set_fields_} {}
 
 void ProfilingSet_ProfiledDuration_PerformanceHint::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<ProfilingSet_ProfiledDuration_PerformanceHint_ConfigParameterAction>(writer, /*tag=*/ 1, config_parameter_action_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, config_parameter_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ProfilingSet_ProfiledDuration_PerformanceHint::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ProfilingSet_ProfiledDuration_PerformanceHint::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<ProfilingSet_ProfiledDuration_PerformanceHint_ConfigParameterAction>(reader, config_parameter_action_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, config_parameter_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ProfilingSet_ProfiledDuration_PerformanceHint::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ProfilingSet_ProfiledDuration::ProfilingSet_ProfiledDuration(const ProfilingSet_ProfiledDuration& other) noexcept(false)
@@ -47,33 +38,21 @@ ProfilingSet_ProfiledDuration::ProfilingSet_ProfiledDuration(const ProfilingSet_
     , set_fields_{other.set_fields_} {}
 
 void ProfilingSet_ProfiledDuration::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<Duration>(writer, /*tag=*/ 1, duration_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowRepeated<ProfilingSet_ProfiledDuration_PerformanceHint>>(writer, /*tag=*/ 2, performance_hints_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ProfilingSet_ProfiledDuration::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ProfilingSet_ProfiledDuration::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<Duration>(reader, duration_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowRepeated<ProfilingSet_ProfiledDuration_PerformanceHint>>(reader, performance_hints_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ProfilingSet_ProfiledDuration::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ProfilingSet_ProfiledDurationMapEntry::ProfilingSet_ProfiledDurationMapEntry(const ProfilingSet_ProfiledDurationMapEntry& other) noexcept(false)
@@ -82,33 +61,21 @@ ProfilingSet_ProfiledDurationMapEntry::ProfilingSet_ProfiledDurationMapEntry(con
     , set_fields_{other.set_fields_} {}
 
 void ProfilingSet_ProfiledDurationMapEntry::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, key_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<ProfilingSet_ProfiledDuration>(writer, /*tag=*/ 2, value_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ProfilingSet_ProfiledDurationMapEntry::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ProfilingSet_ProfiledDurationMapEntry::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, key_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<ProfilingSet_ProfiledDuration>(reader, value_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ProfilingSet_ProfiledDurationMapEntry::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ProfilingSet::ProfilingSet(const ProfilingSet& other) noexcept(false)
@@ -119,49 +86,21 @@ ProfilingSet::ProfilingSet(const ProfilingSet& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void ProfilingSet::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<ProfilingSet_ProfiledService>(writer, /*tag=*/ 1, profiled_service_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowRepeated<ProfilingSet_ProfiledDurationMapEntry>>(writer, /*tag=*/ 2, processing_times_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<ResourceUsage>(writer, /*tag=*/ 4, resource_usage_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 5, node_id_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ProfilingSet::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ProfilingSet::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<ProfilingSet_ProfiledService>(reader, profiled_service_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowRepeated<ProfilingSet_ProfiledDurationMapEntry>>(reader, processing_times_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<ResourceUsage>(reader, resource_usage_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 5: {
-        DeserializeField<CowBytes>(reader, node_id_);
-        set_fields_[3] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ProfilingSet::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ServiceProfiling::ServiceProfiling(const ServiceProfiling& other) noexcept(false)
@@ -173,57 +112,21 @@ ServiceProfiling::ServiceProfiling(const ServiceProfiling& other) noexcept(false
     , set_fields_{other.set_fields_} {}
 
 void ServiceProfiling::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<ProfilingSet>(writer, /*tag=*/ 1, details_profiling_set_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<Duration>(writer, /*tag=*/ 2, total_service_latency_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<Duration>(writer, /*tag=*/ 4, idle_time_before_processing_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<Duration>(writer, /*tag=*/ 5, intra_component_idle_time_);
-  }
-  if (set_fields_[4]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 6, node_id_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ServiceProfiling::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ServiceProfiling::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<ProfilingSet>(reader, details_profiling_set_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<Duration>(reader, total_service_latency_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<Duration>(reader, idle_time_before_processing_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 5: {
-        DeserializeField<Duration>(reader, intra_component_idle_time_);
-        set_fields_[3] = true;
-        break;
-      }
-      case 6: {
-        DeserializeField<CowBytes>(reader, node_id_);
-        set_fields_[4] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ServiceProfiling::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 FrameProfiling::FrameProfiling(const FrameProfiling& other) noexcept(false)
@@ -233,41 +136,21 @@ FrameProfiling::FrameProfiling(const FrameProfiling& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void FrameProfiling::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<Duration>(writer, /*tag=*/ 1, overall_frame_latency_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<Duration>(writer, /*tag=*/ 2, frame_bundling_latency_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<Duration>(writer, /*tag=*/ 4, preprocessing_overhead_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t FrameProfiling::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void FrameProfiling::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<Duration>(reader, overall_frame_latency_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<Duration>(reader, frame_bundling_latency_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<Duration>(reader, preprocessing_overhead_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void FrameProfiling::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 BundledFrameProfilingSet::BundledFrameProfilingSet(const BundledFrameProfilingSet& other) noexcept(false)
@@ -277,41 +160,21 @@ BundledFrameProfilingSet::BundledFrameProfilingSet(const BundledFrameProfilingSe
     , set_fields_{other.set_fields_} {}
 
 void BundledFrameProfilingSet::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<Timestamp>(writer, /*tag=*/ 3, frame_timestamp_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<FrameProfiling>(writer, /*tag=*/ 4, frame_profiling_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<ServiceProfiling>(writer, /*tag=*/ 5, detection_service_profiling_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t BundledFrameProfilingSet::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void BundledFrameProfilingSet::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 3: {
-        DeserializeField<Timestamp>(reader, frame_timestamp_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<FrameProfiling>(reader, frame_profiling_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 5: {
-        DeserializeField<ServiceProfiling>(reader, detection_service_profiling_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void BundledFrameProfilingSet::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 PreprocessingFrameProfiling::PreprocessingFrameProfiling(const PreprocessingFrameProfiling& other) noexcept(false)
@@ -321,41 +184,21 @@ PreprocessingFrameProfiling::PreprocessingFrameProfiling(const PreprocessingFram
     , set_fields_{other.set_fields_} {}
 
 void PreprocessingFrameProfiling::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<Timestamp>(writer, /*tag=*/ 1, frame_timestamp_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, lidar_id_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<ServiceProfiling>(writer, /*tag=*/ 3, service_profiling_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t PreprocessingFrameProfiling::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void PreprocessingFrameProfiling::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<Timestamp>(reader, frame_timestamp_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, lidar_id_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<ServiceProfiling>(reader, service_profiling_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void PreprocessingFrameProfiling::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 DetectionMergerFrameProfiling::DetectionMergerFrameProfiling(const DetectionMergerFrameProfiling& other) noexcept(false)
@@ -364,33 +207,21 @@ DetectionMergerFrameProfiling::DetectionMergerFrameProfiling(const DetectionMerg
     , set_fields_{other.set_fields_} {}
 
 void DetectionMergerFrameProfiling::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<Duration>(writer, /*tag=*/ 1, detection_merger_overhead_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<Duration>(writer, /*tag=*/ 2, total_overall_frame_latency_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t DetectionMergerFrameProfiling::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void DetectionMergerFrameProfiling::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<Duration>(reader, detection_merger_overhead_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<Duration>(reader, total_overall_frame_latency_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void DetectionMergerFrameProfiling::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ProfilingInfo::ProfilingInfo(const ProfilingInfo& other) noexcept(false)
@@ -402,59 +233,196 @@ ProfilingInfo::ProfilingInfo(const ProfilingInfo& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void ProfilingInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<ProfilingSet>(writer, /*tag=*/ 1, general_profiling_set_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<BundledFrameProfilingSet>(writer, /*tag=*/ 2, bundled_frame_profiling_set_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<PreprocessingFrameProfiling>(writer, /*tag=*/ 3, preprocessing_frame_profiling_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<DetectionMergerFrameProfiling>(writer, /*tag=*/ 4, detection_merger_frame_profiling_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ProfilingInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ProfilingInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        clear_profiling_set();
-        profiling_set_ = ProfilingSetOneof::kGeneralProfilingSet;
-        DeserializeField<ProfilingSet>(reader, general_profiling_set_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        clear_profiling_set();
-        profiling_set_ = ProfilingSetOneof::kBundledFrameProfilingSet;
-        DeserializeField<BundledFrameProfilingSet>(reader, bundled_frame_profiling_set_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        clear_profiling_set();
-        profiling_set_ = ProfilingSetOneof::kPreprocessingFrameProfiling;
-        DeserializeField<PreprocessingFrameProfiling>(reader, preprocessing_frame_profiling_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        clear_profiling_set();
-        profiling_set_ = ProfilingSetOneof::kDetectionMergerFrameProfiling;
-        DeserializeField<DetectionMergerFrameProfiling>(reader, detection_merger_frame_profiling_);
-        set_fields_[3] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ProfilingInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
+}
+
+// MARK: Field tables
+
+// Messages are not standard-layout since they have a vtable, so `offsetof()` is only
+// conditionally-supported on them; it is supported by all compilers targeted by the SDK.
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
+const horus_internal::PbMessageTable& ProfilingSet_ProfiledDuration_PerformanceHint::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ProfilingSet_ProfiledDuration_PerformanceHint, config_parameter_action_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<ProfilingSet_ProfiledDuration_PerformanceHint_ConfigParameterAction>::kOps},
+      {/*tag=*/ 2, offsetof(ProfilingSet_ProfiledDuration_PerformanceHint, config_parameter_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ProfilingSet_ProfiledDuration::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ProfilingSet_ProfiledDuration, duration_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Duration>>::kOps},
+      {/*tag=*/ 2, offsetof(ProfilingSet_ProfiledDuration, performance_hints_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<ProfilingSet_ProfiledDuration_PerformanceHint>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ProfilingSet_ProfiledDurationMapEntry::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ProfilingSet_ProfiledDurationMapEntry, key_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(ProfilingSet_ProfiledDurationMapEntry, value_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<ProfilingSet_ProfiledDuration>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
 }
 
+const horus_internal::PbMessageTable& ProfilingSet::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ProfilingSet, profiled_service_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<ProfilingSet_ProfiledService>::kOps},
+      {/*tag=*/ 2, offsetof(ProfilingSet, processing_times_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<ProfilingSet_ProfiledDurationMapEntry>>::kOps},
+      {/*tag=*/ 4, offsetof(ProfilingSet, resource_usage_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<ResourceUsage>>::kOps},
+      {/*tag=*/ 5, offsetof(ProfilingSet, node_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ServiceProfiling::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ServiceProfiling, details_profiling_set_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<ProfilingSet>>::kOps},
+      {/*tag=*/ 2, offsetof(ServiceProfiling, total_service_latency_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Duration>>::kOps},
+      {/*tag=*/ 4, offsetof(ServiceProfiling, idle_time_before_processing_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Duration>>::kOps},
+      {/*tag=*/ 5, offsetof(ServiceProfiling, intra_component_idle_time_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Duration>>::kOps},
+      {/*tag=*/ 6, offsetof(ServiceProfiling, node_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& FrameProfiling::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(FrameProfiling, overall_frame_latency_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Duration>>::kOps},
+      {/*tag=*/ 2, offsetof(FrameProfiling, frame_bundling_latency_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Duration>>::kOps},
+      {/*tag=*/ 4, offsetof(FrameProfiling, preprocessing_overhead_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Duration>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& BundledFrameProfilingSet::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 3, offsetof(BundledFrameProfilingSet, frame_timestamp_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Timestamp>>::kOps},
+      {/*tag=*/ 4, offsetof(BundledFrameProfilingSet, frame_profiling_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<FrameProfiling>>::kOps},
+      {/*tag=*/ 5, offsetof(BundledFrameProfilingSet, detection_service_profiling_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<ServiceProfiling>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& PreprocessingFrameProfiling::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(PreprocessingFrameProfiling, frame_timestamp_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Timestamp>>::kOps},
+      {/*tag=*/ 2, offsetof(PreprocessingFrameProfiling, lidar_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(PreprocessingFrameProfiling, service_profiling_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<ServiceProfiling>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& DetectionMergerFrameProfiling::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(DetectionMergerFrameProfiling, detection_merger_overhead_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Duration>>::kOps},
+      {/*tag=*/ 2, offsetof(DetectionMergerFrameProfiling, total_overall_frame_latency_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<Duration>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ProfilingInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ProfilingInfo, general_profiling_set_),
+       /*oneof_offset=*/ offsetof(ProfilingInfo, profiling_set_),
+       &horus_internal::PbFieldOpsFor<ProfilingSet>::kOps},
+      {/*tag=*/ 2, offsetof(ProfilingInfo, bundled_frame_profiling_set_),
+       /*oneof_offset=*/ offsetof(ProfilingInfo, profiling_set_),
+       &horus_internal::PbFieldOpsFor<BundledFrameProfilingSet>::kOps},
+      {/*tag=*/ 3, offsetof(ProfilingInfo, preprocessing_frame_profiling_),
+       /*oneof_offset=*/ offsetof(ProfilingInfo, profiling_set_),
+       &horus_internal::PbFieldOpsFor<PreprocessingFrameProfiling>::kOps},
+      {/*tag=*/ 4, offsetof(ProfilingInfo, detection_merger_frame_profiling_),
+       /*oneof_offset=*/ offsetof(ProfilingInfo, profiling_set_),
+       &horus_internal::PbFieldOpsFor<DetectionMergerFrameProfiling>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
 }  // namespace pb
 }  // namespace sdk
 }  // namespace horus
@@ -8,6 +8,7 @@
 /// Generated by `/opt/actions-runner/_work/horus/horus/common/tools/sdk/pb.ts`.
 
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -16,9 +17,11 @@
 #include "horus/pb/config/metadata_pb.h"
 #include "horus/pb/cow_bytes.h"
 #include "horus/pb/cow_repeated.h"
+#include "horus/pb/lazy.h"
 #include "horus/pb/message.h"
 #include "horus/pb/resources_pb.h"
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 #include "horus/pb/types.h"
 #include "horus/strings/string_view.h"
 
@@ -121,6 +124,11 @@ class ProfilingSet_ProfiledDuration_PerformanceHint final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -129,12 +137,23 @@ class ProfilingSet_ProfiledDuration_PerformanceHint final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.ProfilingSet.ProfiledDuration.PerformanceHint`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.ProfilingSet.ProfiledDuration.PerformanceHint"; }
 
   /// The full name of the message: `horus.pb.ProfilingSet.ProfiledDuration.PerformanceHint`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ProfilingSet_ProfiledDuration_PerformanceHint`, e.g. to build a `PbFieldMask<ProfilingSet_ProfiledDuration_PerformanceHint>`.
+  enum class Field : PbTag {
+    /// Field `config_parameter_action`.
+    kConfigParameterAction = 1,
+    /// Field `config_parameter_name`.
+    kConfigParameterName = 2,
+  };
+
   // Field `config_parameter_action` (no 1).
   // -----
 
@@ -223,6 +242,10 @@ class ProfilingSet_ProfiledDuration_PerformanceHint final : public PbMessage {
     return std::move(set_config_parameter_name(std::move(config_parameter_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see config_parameter_action()
   ProfilingSet_ProfiledDuration_PerformanceHint_ConfigParameterAction config_parameter_action_{};
@@ -273,6 +296,11 @@ class ProfilingSet_ProfiledDuration final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -281,20 +309,35 @@ class ProfilingSet_ProfiledDuration final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.ProfilingSet.ProfiledDuration`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.ProfilingSet.ProfiledDuration"; }
 
   /// The full name of the message: `horus.pb.ProfilingSet.ProfiledDuration`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ProfilingSet_ProfiledDuration`, e.g. to build a `PbFieldMask<ProfilingSet_ProfiledDuration>`.
+  enum class Field : PbTag {
+    /// Field `duration`.
+    kDuration = 1,
+    /// Field `performance_hints`.
+    kPerformanceHints = 2,
+  };
+
   // Field `duration` (no 1).
   // -----
 
   /// / The duration of the profiled section.
   ///
   /// Field no: 1.
-  constexpr const Duration& duration() const& noexcept HORUS_LIFETIME_BOUND {
-    return duration_;
+  ///
+  /// If `duration` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `duration` was received and is not a valid message.
+  const Duration& duration() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return duration_.Ref();
   }
 
   /// If `duration` is set, moves it out of the message (without marking it as unset).
@@ -302,19 +345,23 @@ class ProfilingSet_ProfiledDuration final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  Duration duration() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `duration` was received and is not a valid message.
+  Duration duration() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(duration_);
+    return std::move(duration_).Take();
   }
 
   /// / The duration of the profiled section.
   ///
   /// Field no: 1.
-  Duration& mutable_duration() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `duration` was received and is not a valid message.
+  Duration& mutable_duration() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return duration_;
+    return duration_.Mutable();
   }
 
   /// Returns whether `duration` (no 1) is set.
@@ -323,13 +370,13 @@ class ProfilingSet_ProfiledDuration final : public PbMessage {
   /// Clears `duration` (no 1).
   void clear_duration() & noexcept {
     set_fields_[0] = false;
-    duration_ = {};
+    duration_.Clear();
   }
 
   /// Sets `duration` (no 1) and returns `*this`.
   ProfilingSet_ProfiledDuration& set_duration(Duration&& duration) & noexcept {
     set_fields_[0] = true;
-    duration_ = std::move(duration);
+    duration_.Set(std::move(duration));
     return *this;
   }
   /// Sets `duration` (no 1) and returns `*this`.
@@ -387,9 +434,13 @@ class ProfilingSet_ProfiledDuration final : public PbMessage {
     return std::move(set_performance_hints(std::move(performance_hints)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see duration()
-  Duration duration_{};
+  PbLazy<Duration> duration_{};
   /// @see performance_hints()
   CowRepeated<ProfilingSet_ProfiledDuration_PerformanceHint> performance_hints_{};
 
@@ -435,6 +486,11 @@ class ProfilingSet_ProfiledDurationMapEntry final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -443,12 +499,23 @@ class ProfilingSet_ProfiledDurationMapEntry final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.ProfilingSet.ProfiledDurationMapEntry`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.ProfilingSet.ProfiledDurationMapEntry"; }
 
   /// The full name of the message: `horus.pb.ProfilingSet.ProfiledDurationMapEntry`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ProfilingSet_ProfiledDurationMapEntry`, e.g. to build a `PbFieldMask<ProfilingSet_ProfiledDurationMapEntry>`.
+  enum class Field : PbTag {
+    /// Field `key`.
+    kKey = 1,
+    /// Field `value`.
+    kValue = 2,
+  };
+
   // Field `key` (no 1).
   // -----
 
@@ -505,8 +572,12 @@ class ProfilingSet_ProfiledDurationMapEntry final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 2.
-  constexpr const ProfilingSet_ProfiledDuration& value() const& noexcept HORUS_LIFETIME_BOUND {
-    return value_;
+  ///
+  /// If `value` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `value` was received and is not a valid message.
+  const ProfilingSet_ProfiledDuration& value() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return value_.Ref();
   }
 
   /// If `value` is set, moves it out of the message (without marking it as unset).
@@ -514,19 +585,23 @@ class ProfilingSet_ProfiledDurationMapEntry final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  ProfilingSet_ProfiledDuration value() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `value` was received and is not a valid message.
+  ProfilingSet_ProfiledDuration value() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(value_);
+    return std::move(value_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 2.
-  ProfilingSet_ProfiledDuration& mutable_value() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `value` was received and is not a valid message.
+  ProfilingSet_ProfiledDuration& mutable_value() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return value_;
+    return value_.Mutable();
   }
 
   /// Returns whether `value` (no 2) is set.
@@ -535,13 +610,13 @@ class ProfilingSet_ProfiledDurationMapEntry final : public PbMessage {
   /// Clears `value` (no 2).
   void clear_value() & noexcept {
     set_fields_[1] = false;
-    value_ = {};
+    value_.Clear();
   }
 
   /// Sets `value` (no 2) and returns `*this`.
   ProfilingSet_ProfiledDurationMapEntry& set_value(ProfilingSet_ProfiledDuration&& value) & noexcept {
     set_fields_[1] = true;
-    value_ = std::move(value);
+    value_.Set(std::move(value));
     return *this;
   }
   /// Sets `value` (no 2) and returns `*this`.
@@ -549,11 +624,15 @@ class ProfilingSet_ProfiledDurationMapEntry final : public PbMessage {
     return std::move(set_value(std::move(value)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see key()
   CowBytes key_{};
   /// @see value()
-  ProfilingSet_ProfiledDuration value_{};
+  PbLazy<ProfilingSet_ProfiledDuration> value_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<2> set_fields_;
@@ -603,6 +682,11 @@ class ProfilingSet final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -611,12 +695,27 @@ class ProfilingSet final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.ProfilingSet`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.ProfilingSet"; }
 
   /// The full name of the message: `horus.pb.ProfilingSet`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ProfilingSet`, e.g. to build a `PbFieldMask<ProfilingSet>`.
+  enum class Field : PbTag {
+    /// Field `profiled_service`.
+    kProfiledService = 1,
+    /// Field `processing_times`.
+    kProcessingTimes = 2,
+    /// Field `resource_usage`.
+    kResourceUsage = 4,
+    /// Field `node_id`.
+    kNodeId = 5,
+  };
+
   // Field `profiled_service` (no 1).
   // -----
 
@@ -711,8 +810,12 @@ class ProfilingSet final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 4.
-  constexpr const ResourceUsage& resource_usage() const& noexcept HORUS_LIFETIME_BOUND {
-    return resource_usage_;
+  ///
+  /// If `resource_usage` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `resource_usage` was received and is not a valid message.
+  const ResourceUsage& resource_usage() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return resource_usage_.Ref();
   }
 
   /// If `resource_usage` is set, moves it out of the message (without marking it as unset).
@@ -720,19 +823,23 @@ class ProfilingSet final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 4.
-  ResourceUsage resource_usage() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `resource_usage` was received and is not a valid message.
+  ResourceUsage resource_usage() && noexcept(false) {
     if (!set_fields_[2]) {
       return {};
     }
-    return std::move(resource_usage_);
+    return std::move(resource_usage_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 4.
-  ResourceUsage& mutable_resource_usage() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `resource_usage` was received and is not a valid message.
+  ResourceUsage& mutable_resource_usage() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[2] = true;
-    return resource_usage_;
+    return resource_usage_.Mutable();
   }
 
   /// Returns whether `resource_usage` (no 4) is set.
@@ -741,13 +848,13 @@ class ProfilingSet final : public PbMessage {
   /// Clears `resource_usage` (no 4).
   void clear_resource_usage() & noexcept {
     set_fields_[2] = false;
-    resource_usage_ = {};
+    resource_usage_.Clear();
   }
 
   /// Sets `resource_usage` (no 4) and returns `*this`.
   ProfilingSet& set_resource_usage(ResourceUsage&& resource_usage) & noexcept {
     set_fields_[2] = true;
-    resource_usage_ = std::move(resource_usage);
+    resource_usage_.Set(std::move(resource_usage));
     return *this;
   }
   /// Sets `resource_usage` (no 4) and returns `*this`.
@@ -807,13 +914,17 @@ class ProfilingSet final : public PbMessage {
     return std::move(set_node_id(std::move(node_id)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see profiled_service()
   ProfilingSet_ProfiledService profiled_service_{};
   /// @see processing_times()
   CowRepeated<ProfilingSet_ProfiledDurationMapEntry> processing_times_{};
   /// @see resource_usage()
-  ResourceUsage resource_usage_{};
+  PbLazy<ResourceUsage> resource_usage_{};
   /// @see node_id()
   CowBytes node_id_{};
 
@@ -860,6 +971,11 @@ class ServiceProfiling final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -868,20 +984,41 @@ class ServiceProfiling final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.ServiceProfiling`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.ServiceProfiling"; }
 
   /// The full name of the message: `horus.pb.ServiceProfiling`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ServiceProfiling`, e.g. to build a `PbFieldMask<ServiceProfiling>`.
+  enum class Field : PbTag {
+    /// Field `details_profiling_set`.
+    kDetailsProfilingSet = 1,
+    /// Field `total_service_latency`.
+    kTotalServiceLatency = 2,
+    /// Field `idle_time_before_processing`.
+    kIdleTimeBeforeProcessing = 4,
+    /// Field `intra_component_idle_time`.
+    kIntraComponentIdleTime = 5,
+    /// Field `node_id`.
+    kNodeId = 6,
+  };
+
   // Field `details_profiling_set` (no 1).
   // -----
 
   /// / The profiling details.
   ///
   /// Field no: 1.
-  constexpr const ProfilingSet& details_profiling_set() const& noexcept HORUS_LIFETIME_BOUND {
-    return details_profiling_set_;
+  ///
+  /// If `details_profiling_set` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `details_profiling_set` was received and is not a valid message.
+  const ProfilingSet& details_profiling_set() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return details_profiling_set_.Ref();
   }
 
   /// If `details_profiling_set` is set, moves it out of the message (without marking it as unset).
@@ -889,19 +1026,23 @@ class ServiceProfiling final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  ProfilingSet details_profiling_set() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `details_profiling_set` was received and is not a valid message.
+  ProfilingSet details_profiling_set() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(details_profiling_set_);
+    return std::move(details_profiling_set_).Take();
   }
 
   /// / The profiling details.
   ///
   /// Field no: 1.
-  ProfilingSet& mutable_details_profiling_set() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `details_profiling_set` was received and is not a valid message.
+  ProfilingSet& mutable_details_profiling_set() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return details_profiling_set_;
+    return details_profiling_set_.Mutable();
   }
 
   /// Returns whether `details_profiling_set` (no 1) is set.
@@ -910,13 +1051,13 @@ class ServiceProfiling final : public PbMessage {
   /// Clears `details_profiling_set` (no 1).
   void clear_details_profiling_set() & noexcept {
     set_fields_[0] = false;
-    details_profiling_set_ = {};
+    details_profiling_set_.Clear();
   }
 
   /// Sets `details_profiling_set` (no 1) and returns `*this`.
   ServiceProfiling& set_details_profiling_set(ProfilingSet&& details_profiling_set) & noexcept {
     set_fields_[0] = true;
-    details_profiling_set_ = std::move(details_profiling_set);
+    details_profiling_set_.Set(std::move(details_profiling_set));
     return *this;
   }
   /// Sets `details_profiling_set` (no 1) and returns `*this`.
@@ -931,8 +1072,12 @@ class ServiceProfiling final : public PbMessage {
   /// / total processing time (when the data is actually being processed)
   ///
   /// Field no: 2.
-  constexpr const Duration& total_service_latency() const& noexcept HORUS_LIFETIME_BOUND {
-    return total_service_latency_;
+  ///
+  /// If `total_service_latency` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `total_service_latency` was received and is not a valid message.
+  const Duration& total_service_latency() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return total_service_latency_.Ref();
   }
 
   /// If `total_service_latency` is set, moves it out of the message (without marking it as unset).
@@ -940,20 +1085,24 @@ class ServiceProfiling final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  Duration total_service_latency() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `total_service_latency` was received and is not a valid message.
+  Duration total_service_latency() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(total_service_latency_);
+    return std::move(total_service_latency_).Take();
   }
 
   /// / The total service latency which is a sum of the total idle time and the
   /// / total processing time (when the data is actually being processed)
   ///
   /// Field no: 2.
-  Duration& mutable_total_service_latency() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `total_service_latency` was received and is not a valid message.
+  Duration& mutable_total_service_latency() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return total_service_latency_;
+    return total_service_latency_.Mutable();
   }
 
   /// Returns whether `total_service_latency` (no 2) is set.
@@ -962,13 +1111,13 @@ class ServiceProfiling final : public PbMessage {
   /// Clears `total_service_latency` (no 2).
   void clear_total_service_latency() & noexcept {
     set_fields_[1] = false;
-    total_service_latency_ = {};
+    total_service_latency_.Clear();
   }
 
   /// Sets `total_service_latency` (no 2) and returns `*this`.
   ServiceProfiling& set_total_service_latency(Duration&& total_service_latency) & noexcept {
     set_fields_[1] = true;
-    total_service_latency_ = std::move(total_service_latency);
+    total_service_latency_.Set(std::move(total_service_latency));
     return *this;
   }
   /// Sets `total_service_latency` (no 2) and returns `*this`.
@@ -983,8 +1132,12 @@ class ServiceProfiling final : public PbMessage {
   /// / bundle time to the first processing time.
   ///
   /// Field no: 4.
-  constexpr const Duration& idle_time_before_processing() const& noexcept HORUS_LIFETIME_BOUND {
-    return idle_time_before_processing_;
+  ///
+  /// If `idle_time_before_processing` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `idle_time_before_processing` was received and is not a valid message.
+  const Duration& idle_time_before_processing() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return idle_time_before_processing_.Ref();
   }
 
   /// If `idle_time_before_processing` is set, moves it out of the message (without marking it as unset).
@@ -992,20 +1145,24 @@ class ServiceProfiling final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 4.
-  Duration idle_time_before_processing() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `idle_time_before_processing` was received and is not a valid message.
+  Duration idle_time_before_processing() && noexcept(false) {
     if (!set_fields_[2]) {
       return {};
     }
-    return std::move(idle_time_before_processing_);
+    return std::move(idle_time_before_processing_).Take();
   }
 
   /// / The idle time before the service starts processing the data, i.e. from
   /// / bundle time to the first processing time.
   ///
   /// Field no: 4.
-  Duration& mutable_idle_time_before_processing() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `idle_time_before_processing` was received and is not a valid message.
+  Duration& mutable_idle_time_before_processing() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[2] = true;
-    return idle_time_before_processing_;
+    return idle_time_before_processing_.Mutable();
   }
 
   /// Returns whether `idle_time_before_processing` (no 4) is set.
@@ -1014,13 +1171,13 @@ class ServiceProfiling final : public PbMessage {
   /// Clears `idle_time_before_processing` (no 4).
   void clear_idle_time_before_processing() & noexcept {
     set_fields_[2] = false;
-    idle_time_before_processing_ = {};
+    idle_time_before_processing_.Clear();
   }
 
   /// Sets `idle_time_before_processing` (no 4) and returns `*this`.
   ServiceProfiling& set_idle_time_before_processing(Duration&& idle_time_before_processing) & noexcept {
     set_fields_[2] = true;
-    idle_time_before_processing_ = std::move(idle_time_before_processing);
+    idle_time_before_processing_.Set(std::move(idle_time_before_processing));
     return *this;
   }
   /// Sets `idle_time_before_processing` (no 4) and returns `*this`.
@@ -1035,8 +1192,12 @@ class ServiceProfiling final : public PbMessage {
   /// / between two processing times).
   ///
   /// Field no: 5.
-  constexpr const Duration& intra_component_idle_time() const& noexcept HORUS_LIFETIME_BOUND {
-    return intra_component_idle_time_;
+  ///
+  /// If `intra_component_idle_time` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `intra_component_idle_time` was received and is not a valid message.
+  const Duration& intra_component_idle_time() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return intra_component_idle_time_.Ref();
   }
 
   /// If `intra_component_idle_time` is set, moves it out of the message (without marking it as unset).
@@ -1044,20 +1205,24 @@ class ServiceProfiling final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 5.
-  Duration intra_component_idle_time() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `intra_component_idle_time` was received and is not a valid message.
+  Duration intra_component_idle_time() && noexcept(false) {
     if (!set_fields_[3]) {
       return {};
     }
-    return std::move(intra_component_idle_time_);
+    return std::move(intra_component_idle_time_).Take();
   }
 
   /// / The intra idle time of the service (when the data is not being processed
   /// / between two processing times).
   ///
   /// Field no: 5.
-  Duration& mutable_intra_component_idle_time() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `intra_component_idle_time` was received and is not a valid message.
+  Duration& mutable_intra_component_idle_time() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[3] = true;
-    return intra_component_idle_time_;
+    return intra_component_idle_time_.Mutable();
   }
 
   /// Returns whether `intra_component_idle_time` (no 5) is set.
@@ -1066,13 +1231,13 @@ class ServiceProfiling final : public PbMessage {
   /// Clears `intra_component_idle_time` (no 5).
   void clear_intra_component_idle_time() & noexcept {
     set_fields_[3] = false;
-    intra_component_idle_time_ = {};
+    intra_component_idle_time_.Clear();
   }
 
   /// Sets `intra_component_idle_time` (no 5) and returns `*this`.
   ServiceProfiling& set_intra_component_idle_time(Duration&& intra_component_idle_time) & noexcept {
     set_fields_[3] = true;
-    intra_component_idle_time_ = std::move(intra_component_idle_time);
+    intra_component_idle_time_.Set(std::move(intra_component_idle_time));
     return *this;
   }
   /// Sets `intra_component_idle_time` (no 5) and returns `*this`.
@@ -1130,15 +1295,19 @@ class ServiceProfiling final : public PbMessage {
     return std::move(set_node_id(std::move(node_id)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see details_profiling_set()
-  ProfilingSet details_profiling_set_{};
+  PbLazy<ProfilingSet> details_profiling_set_{};
   /// @see total_service_latency()
-  Duration total_service_latency_{};
+  PbLazy<Duration> total_service_latency_{};
   /// @see idle_time_before_processing()
-  Duration idle_time_before_processing_{};
+  PbLazy<Duration> idle_time_before_processing_{};
   /// @see intra_component_idle_time()
-  Duration intra_component_idle_time_{};
+  PbLazy<Duration> intra_component_idle_time_{};
   /// @see node_id()
   CowBytes node_id_{};
 
@@ -1185,6 +1354,11 @@ class FrameProfiling final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1193,12 +1367,25 @@ class FrameProfiling final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.FrameProfiling`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.FrameProfiling"; }
 
   /// The full name of the message: `horus.pb.FrameProfiling`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `FrameProfiling`, e.g. to build a `PbFieldMask<FrameProfiling>`.
+  enum class Field : PbTag {
+    /// Field `overall_frame_latency`.
+    kOverallFrameLatency = 1,
+    /// Field `frame_bundling_latency`.
+    kFrameBundlingLatency = 2,
+    /// Field `preprocessing_overhead`.
+    kPreprocessingOverhead = 4,
+  };
+
   // Field `overall_frame_latency` (no 1).
   // -----
 
@@ -1206,8 +1393,12 @@ class FrameProfiling final : public PbMessage {
   /// / inside the frame to the publishing of the frame).
   ///
   /// Field no: 1.
-  constexpr const Duration& overall_frame_latency() const& noexcept HORUS_LIFETIME_BOUND {
-    return overall_frame_latency_;
+  ///
+  /// If `overall_frame_latency` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `overall_frame_latency` was received and is not a valid message.
+  const Duration& overall_frame_latency() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return overall_frame_latency_.Ref();
   }
 
   /// If `overall_frame_latency` is set, moves it out of the message (without marking it as unset).
@@ -1215,20 +1406,24 @@ class FrameProfiling final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  Duration overall_frame_latency() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `overall_frame_latency` was received and is not a valid message.
+  Duration overall_frame_latency() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(overall_frame_latency_);
+    return std::move(overall_frame_latency_).Take();
   }
 
   /// / The overall latency of the frame (from the earliest point cloud arrival
   /// / inside the frame to the publishing of the frame).
   ///
   /// Field no: 1.
-  Duration& mutable_overall_frame_latency() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `overall_frame_latency` was received and is not a valid message.
+  Duration& mutable_overall_frame_latency() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return overall_frame_latency_;
+    return overall_frame_latency_.Mutable();
   }
 
   /// Returns whether `overall_frame_latency` (no 1) is set.
@@ -1237,13 +1432,13 @@ class FrameProfiling final : public PbMessage {
   /// Clears `overall_frame_latency` (no 1).
   void clear_overall_frame_latency() & noexcept {
     set_fields_[0] = false;
-    overall_frame_latency_ = {};
+    overall_frame_latency_.Clear();
   }
 
   /// Sets `overall_frame_latency` (no 1) and returns `*this`.
   FrameProfiling& set_overall_frame_latency(Duration&& overall_frame_latency) & noexcept {
     set_fields_[0] = true;
-    overall_frame_latency_ = std::move(overall_frame_latency);
+    overall_frame_latency_.Set(std::move(overall_frame_latency));
     return *this;
   }
   /// Sets `overall_frame_latency` (no 1) and returns `*this`.
@@ -1261,8 +1456,12 @@ class FrameProfiling final : public PbMessage {
   /// / overhead of our pipeline for the frame.
   ///
   /// Field no: 2.
-  constexpr const Duration& frame_bundling_latency() const& noexcept HORUS_LIFETIME_BOUND {
-    return frame_bundling_latency_;
+  ///
+  /// If `frame_bundling_latency` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `frame_bundling_latency` was received and is not a valid message.
+  const Duration& frame_bundling_latency() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return frame_bundling_latency_.Ref();
   }
 
   /// If `frame_bundling_latency` is set, moves it out of the message (without marking it as unset).
@@ -1270,11 +1469,13 @@ class FrameProfiling final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  Duration frame_bundling_latency() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `frame_bundling_latency` was received and is not a valid message.
+  Duration frame_bundling_latency() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(frame_bundling_latency_);
+    return std::move(frame_bundling_latency_).Take();
   }
 
   /// / The time we spent waiting for the frame to be bundled (this is an
@@ -1284,9 +1485,11 @@ class FrameProfiling final : public PbMessage {
   /// / overhead of our pipeline for the frame.
   ///
   /// Field no: 2.
-  Duration& mutable_frame_bundling_latency() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `frame_bundling_latency` was received and is not a valid message.
+  Duration& mutable_frame_bundling_latency() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return frame_bundling_latency_;
+    return frame_bundling_latency_.Mutable();
   }
 
   /// Returns whether `frame_bundling_latency` (no 2) is set.
@@ -1295,13 +1498,13 @@ class FrameProfiling final : public PbMessage {
   /// Clears `frame_bundling_latency` (no 2).
   void clear_frame_bundling_latency() & noexcept {
     set_fields_[1] = false;
-    frame_bundling_latency_ = {};
+    frame_bundling_latency_.Clear();
   }
 
   /// Sets `frame_bundling_latency` (no 2) and returns `*this`.
   FrameProfiling& set_frame_bundling_latency(Duration&& frame_bundling_latency) & noexcept {
     set_fields_[1] = true;
-    frame_bundling_latency_ = std::move(frame_bundling_latency);
+    frame_bundling_latency_.Set(std::move(frame_bundling_latency));
     return *this;
   }
   /// Sets `frame_bundling_latency` (no 2) and returns `*this`.
@@ -1315,8 +1518,12 @@ class FrameProfiling final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 4.
-  constexpr const Duration& preprocessing_overhead() const& noexcept HORUS_LIFETIME_BOUND {
-    return preprocessing_overhead_;
+  ///
+  /// If `preprocessing_overhead` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `preprocessing_overhead` was received and is not a valid message.
+  const Duration& preprocessing_overhead() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return preprocessing_overhead_.Ref();
   }
 
   /// If `preprocessing_overhead` is set, moves it out of the message (without marking it as unset).
@@ -1324,19 +1531,23 @@ class FrameProfiling final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 4.
-  Duration preprocessing_overhead() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `preprocessing_overhead` was received and is not a valid message.
+  Duration preprocessing_overhead() && noexcept(false) {
     if (!set_fields_[2]) {
       return {};
     }
-    return std::move(preprocessing_overhead_);
+    return std::move(preprocessing_overhead_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 4.
-  Duration& mutable_preprocessing_overhead() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `preprocessing_overhead` was received and is not a valid message.
+  Duration& mutable_preprocessing_overhead() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[2] = true;
-    return preprocessing_overhead_;
+    return preprocessing_overhead_.Mutable();
   }
 
   /// Returns whether `preprocessing_overhead` (no 4) is set.
@@ -1345,13 +1556,13 @@ class FrameProfiling final : public PbMessage {
   /// Clears `preprocessing_overhead` (no 4).
   void clear_preprocessing_overhead() & noexcept {
     set_fields_[2] = false;
-    preprocessing_overhead_ = {};
+    preprocessing_overhead_.Clear();
   }
 
   /// Sets `preprocessing_overhead` (no 4) and returns `*this`.
   FrameProfiling& set_preprocessing_overhead(Duration&& preprocessing_overhead) & noexcept {
     set_fields_[2] = true;
-    preprocessing_overhead_ = std::move(preprocessing_overhead);
+    preprocessing_overhead_.Set(std::move(preprocessing_overhead));
     return *this;
   }
   /// Sets `preprocessing_overhead` (no 4) and returns `*this`.
@@ -1359,13 +1570,17 @@ class FrameProfiling final : public PbMessage {
     return std::move(set_preprocessing_overhead(std::move(preprocessing_overhead)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see overall_frame_latency()
-  Duration overall_frame_latency_{};
+  PbLazy<Duration> overall_frame_latency_{};
   /// @see frame_bundling_latency()
-  Duration frame_bundling_latency_{};
+  PbLazy<Duration> frame_bundling_latency_{};
   /// @see preprocessing_overhead()
-  Duration preprocessing_overhead_{};
+  PbLazy<Duration> preprocessing_overhead_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<3> set_fields_;
@@ -1411,6 +1626,11 @@ class BundledFrameProfilingSet final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1419,12 +1639,25 @@ class BundledFrameProfilingSet final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.BundledFrameProfilingSet`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.BundledFrameProfilingSet"; }
 
   /// The full name of the message: `horus.pb.BundledFrameProfilingSet`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `BundledFrameProfilingSet`, e.g. to build a `PbFieldMask<BundledFrameProfilingSet>`.
+  enum class Field : PbTag {
+    /// Field `frame_timestamp`.
+    kFrameTimestamp = 3,
+    /// Field `frame_profiling`.
+    kFrameProfiling = 4,
+    /// Field `detection_service_profiling`.
+    kDetectionServiceProfiling = 5,
+  };
+
   // Field `frame_timestamp` (no 3).
   // -----
 
@@ -1432,8 +1665,12 @@ class BundledFrameProfilingSet final : public PbMessage {
   /// / that the frame contains).
   ///
   /// Field no: 3.
-  constexpr const Timestamp& frame_timestamp() const& noexcept HORUS_LIFETIME_BOUND {
-    return frame_timestamp_;
+  ///
+  /// If `frame_timestamp` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `frame_timestamp` was received and is not a valid message.
+  const Timestamp& frame_timestamp() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return frame_timestamp_.Ref();
   }
 
   /// If `frame_timestamp` is set, moves it out of the message (without marking it as unset).
@@ -1441,20 +1678,24 @@ class BundledFrameProfilingSet final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 3.
-  Timestamp frame_timestamp() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `frame_timestamp` was received and is not a valid message.
+  Timestamp frame_timestamp() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(frame_timestamp_);
+    return std::move(frame_timestamp_).Take();
   }
 
   /// / The associated frame timestamp (the point cloud arrival average timestamp
   /// / that the frame contains).
   ///
   /// Field no: 3.
-  Timestamp& mutable_frame_timestamp() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `frame_timestamp` was received and is not a valid message.
+  Timestamp& mutable_frame_timestamp() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return frame_timestamp_;
+    return frame_timestamp_.Mutable();
   }
 
   /// Returns whether `frame_timestamp` (no 3) is set.
@@ -1463,13 +1704,13 @@ class BundledFrameProfilingSet final : public PbMessage {
   /// Clears `frame_timestamp` (no 3).
   void clear_frame_timestamp() & noexcept {
     set_fields_[0] = false;
-    frame_timestamp_ = {};
+    frame_timestamp_.Clear();
   }
 
   /// Sets `frame_timestamp` (no 3) and returns `*this`.
   BundledFrameProfilingSet& set_frame_timestamp(Timestamp&& frame_timestamp) & noexcept {
     set_fields_[0] = true;
-    frame_timestamp_ = std::move(frame_timestamp);
+    frame_timestamp_.Set(std::move(frame_timestamp));
     return *this;
   }
   /// Sets `frame_timestamp` (no 3) and returns `*this`.
@@ -1483,8 +1724,12 @@ class BundledFrameProfilingSet final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 4.
-  constexpr const FrameProfiling& frame_profiling() const& noexcept HORUS_LIFETIME_BOUND {
-    return frame_profiling_;
+  ///
+  /// If `frame_profiling` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `frame_profiling` was received and is not a valid message.
+  const FrameProfiling& frame_profiling() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return frame_profiling_.Ref();
   }
 
   /// If `frame_profiling` is set, moves it out of the message (without marking it as unset).
@@ -1492,19 +1737,23 @@ class BundledFrameProfilingSet final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 4.
-  FrameProfiling frame_profiling() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `frame_profiling` was received and is not a valid message.
+  FrameProfiling frame_profiling() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(frame_profiling_);
+    return std::move(frame_profiling_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 4.
-  FrameProfiling& mutable_frame_profiling() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `frame_profiling` was received and is not a valid message.
+  FrameProfiling& mutable_frame_profiling() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return frame_profiling_;
+    return frame_profiling_.Mutable();
   }
 
   /// Returns whether `frame_profiling` (no 4) is set.
@@ -1513,13 +1762,13 @@ class BundledFrameProfilingSet final : public PbMessage {
   /// Clears `frame_profiling` (no 4).
   void clear_frame_profiling() & noexcept {
     set_fields_[1] = false;
-    frame_profiling_ = {};
+    frame_profiling_.Clear();
   }
 
   /// Sets `frame_profiling` (no 4) and returns `*this`.
   BundledFrameProfilingSet& set_frame_profiling(FrameProfiling&& frame_profiling) & noexcept {
     set_fields_[1] = true;
-    frame_profiling_ = std::move(frame_profiling);
+    frame_profiling_.Set(std::move(frame_profiling));
     return *this;
   }
   /// Sets `frame_profiling` (no 4) and returns `*this`.
@@ -1533,8 +1782,12 @@ class BundledFrameProfilingSet final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 5.
-  constexpr const ServiceProfiling& detection_service_profiling() const& noexcept HORUS_LIFETIME_BOUND {
-    return detection_service_profiling_;
+  ///
+  /// If `detection_service_profiling` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `detection_service_profiling` was received and is not a valid message.
+  const ServiceProfiling& detection_service_profiling() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return detection_service_profiling_.Ref();
   }
 
   /// If `detection_service_profiling` is set, moves it out of the message (without marking it as unset).
@@ -1542,19 +1795,23 @@ class BundledFrameProfilingSet final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 5.
-  ServiceProfiling detection_service_profiling() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `detection_service_profiling` was received and is not a valid message.
+  ServiceProfiling detection_service_profiling() && noexcept(false) {
     if (!set_fields_[2]) {
       return {};
     }
-    return std::move(detection_service_profiling_);
+    return std::move(detection_service_profiling_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 5.
-  ServiceProfiling& mutable_detection_service_profiling() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `detection_service_profiling` was received and is not a valid message.
+  ServiceProfiling& mutable_detection_service_profiling() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[2] = true;
-    return detection_service_profiling_;
+    return detection_service_profiling_.Mutable();
   }
 
   /// Returns whether `detection_service_profiling` (no 5) is set.
@@ -1563,13 +1820,13 @@ class BundledFrameProfilingSet final : public PbMessage {
   /// Clears `detection_service_profiling` (no 5).
   void clear_detection_service_profiling() & noexcept {
     set_fields_[2] = false;
-    detection_service_profiling_ = {};
+    detection_service_profiling_.Clear();
   }
 
   /// Sets `detection_service_profiling` (no 5) and returns `*this`.
   BundledFrameProfilingSet& set_detection_service_profiling(ServiceProfiling&& detection_service_profiling) & noexcept {
     set_fields_[2] = true;
-    detection_service_profiling_ = std::move(detection_service_profiling);
+    detection_service_profiling_.Set(std::move(detection_service_profiling));
     return *this;
   }
   /// Sets `detection_service_profiling` (no 5) and returns `*this`.
@@ -1577,13 +1834,17 @@ class BundledFrameProfilingSet final : public PbMessage {
     return std::move(set_detection_service_profiling(std::move(detection_service_profiling)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see frame_timestamp()
-  Timestamp frame_timestamp_{};
+  PbLazy<Timestamp> frame_timestamp_{};
   /// @see frame_profiling()
-  FrameProfiling frame_profiling_{};
+  PbLazy<FrameProfiling> frame_profiling_{};
   /// @see detection_service_profiling()
-  ServiceProfiling detection_service_profiling_{};
+  PbLazy<ServiceProfiling> detection_service_profiling_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<3> set_fields_;
@@ -1629,6 +1890,11 @@ class PreprocessingFrameProfiling final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1637,20 +1903,37 @@ class PreprocessingFrameProfiling final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.PreprocessingFrameProfiling`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.PreprocessingFrameProfiling"; }
 
   /// The full name of the message: `horus.pb.PreprocessingFrameProfiling`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `PreprocessingFrameProfiling`, e.g. to build a `PbFieldMask<PreprocessingFrameProfiling>`.
+  enum class Field : PbTag {
+    /// Field `frame_timestamp`.
+    kFrameTimestamp = 1,
+    /// Field `lidar_id`.
+    kLidarId = 2,
+    /// Field `service_profiling`.
+    kServiceProfiling = 3,
+  };
+
   // Field `frame_timestamp` (no 1).
   // -----
 
   /// / The frame timestamp (average point cloud arrival timestamp).
   ///
   /// Field no: 1.
-  constexpr const Timestamp& frame_timestamp() const& noexcept HORUS_LIFETIME_BOUND {
-    return frame_timestamp_;
+  ///
+  /// If `frame_timestamp` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `frame_timestamp` was received and is not a valid message.
+  const Timestamp& frame_timestamp() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return frame_timestamp_.Ref();
   }
 
   /// If `frame_timestamp` is set, moves it out of the message (without marking it as unset).
@@ -1658,19 +1941,23 @@ class PreprocessingFrameProfiling final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  Timestamp frame_timestamp() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `frame_timestamp` was received and is not a valid message.
+  Timestamp frame_timestamp() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(frame_timestamp_);
+    return std::move(frame_timestamp_).Take();
   }
 
   /// / The frame timestamp (average point cloud arrival timestamp).
   ///
   /// Field no: 1.
-  Timestamp& mutable_frame_timestamp() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `frame_timestamp` was received and is not a valid message.
+  Timestamp& mutable_frame_timestamp() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return frame_timestamp_;
+    return frame_timestamp_.Mutable();
   }
 
   /// Returns whether `frame_timestamp` (no 1) is set.
@@ -1679,13 +1966,13 @@ class PreprocessingFrameProfiling final : public PbMessage {
   /// Clears `frame_timestamp` (no 1).
   void clear_frame_timestamp() & noexcept {
     set_fields_[0] = false;
-    frame_timestamp_ = {};
+    frame_timestamp_.Clear();
   }
 
   /// Sets `frame_timestamp` (no 1) and returns `*this`.
   PreprocessingFrameProfiling& set_frame_timestamp(Timestamp&& frame_timestamp) & noexcept {
     set_fields_[0] = true;
-    frame_timestamp_ = std::move(frame_timestamp);
+    frame_timestamp_.Set(std::move(frame_timestamp));
     return *this;
   }
   /// Sets `frame_timestamp` (no 1) and returns `*this`.
@@ -1749,8 +2036,12 @@ class PreprocessingFrameProfiling final : public PbMessage {
   /// / The preprocessing service profiling for this frame.
   ///
   /// Field no: 3.
-  constexpr const ServiceProfiling& service_profiling() const& noexcept HORUS_LIFETIME_BOUND {
-    return service_profiling_;
+  ///
+  /// If `service_profiling` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `service_profiling` was received and is not a valid message.
+  const ServiceProfiling& service_profiling() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return service_profiling_.Ref();
   }
 
   /// If `service_profiling` is set, moves it out of the message (without marking it as unset).
@@ -1758,19 +2049,23 @@ class PreprocessingFrameProfiling final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 3.
-  ServiceProfiling service_profiling() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `service_profiling` was received and is not a valid message.
+  ServiceProfiling service_profiling() && noexcept(false) {
     if (!set_fields_[2]) {
       return {};
     }
-    return std::move(service_profiling_);
+    return std::move(service_profiling_).Take();
   }
 
   /// / The preprocessing service profiling for this frame.
   ///
   /// Field no: 3.
-  ServiceProfiling& mutable_service_profiling() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `service_profiling` was received and is not a valid message.
+  ServiceProfiling& mutable_service_profiling() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[2] = true;
-    return service_profiling_;
+    return service_profiling_.Mutable();
   }
 
   /// Returns whether `service_profiling` (no 3) is set.
@@ -1779,13 +2074,13 @@ class PreprocessingFrameProfiling final : public PbMessage {
   /// Clears `service_profiling` (no 3).
   void clear_service_profiling() & noexcept {
     set_fields_[2] = false;
-    service_profiling_ = {};
+    service_profiling_.Clear();
   }
 
   /// Sets `service_profiling` (no 3) and returns `*this`.
   PreprocessingFrameProfiling& set_service_profiling(ServiceProfiling&& service_profiling) & noexcept {
     set_fields_[2] = true;
-    service_profiling_ = std::move(service_profiling);
+    service_profiling_.Set(std::move(service_profiling));
     return *this;
   }
   /// Sets `service_profiling` (no 3) and returns `*this`.
@@ -1793,13 +2088,17 @@ class PreprocessingFrameProfiling final : public PbMessage {
     return std::move(set_service_profiling(std::move(service_profiling)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see frame_timestamp()
-  Timestamp frame_timestamp_{};
+  PbLazy<Timestamp> frame_timestamp_{};
   /// @see lidar_id()
   CowBytes lidar_id_{};
   /// @see service_profiling()
-  ServiceProfiling service_profiling_{};
+  PbLazy<ServiceProfiling> service_profiling_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<3> set_fields_;
@@ -1843,6 +2142,11 @@ class DetectionMergerFrameProfiling final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1851,12 +2155,23 @@ class DetectionMergerFrameProfiling final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.DetectionMergerFrameProfiling`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.DetectionMergerFrameProfiling"; }
 
   /// The full name of the message: `horus.pb.DetectionMergerFrameProfiling`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `DetectionMergerFrameProfiling`, e.g. to build a `PbFieldMask<DetectionMergerFrameProfiling>`.
+  enum class Field : PbTag {
+    /// Field `detection_merger_overhead`.
+    kDetectionMergerOverhead = 1,
+    /// Field `total_overall_frame_latency`.
+    kTotalOverallFrameLatency = 2,
+  };
+
   // Field `detection_merger_overhead` (no 1).
   // -----
 
@@ -1865,8 +2180,12 @@ class DetectionMergerFrameProfiling final : public PbMessage {
   /// / event by the detection merger.
   ///
   /// Field no: 1.
-  constexpr const Duration& detection_merger_overhead() const& noexcept HORUS_LIFETIME_BOUND {
-    return detection_merger_overhead_;
+  ///
+  /// If `detection_merger_overhead` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `detection_merger_overhead` was received and is not a valid message.
+  const Duration& detection_merger_overhead() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return detection_merger_overhead_.Ref();
   }
 
   /// If `detection_merger_overhead` is set, moves it out of the message (without marking it as unset).
@@ -1874,11 +2193,13 @@ class DetectionMergerFrameProfiling final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  Duration detection_merger_overhead() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `detection_merger_overhead` was received and is not a valid message.
+  Duration detection_merger_overhead() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(detection_merger_overhead_);
+    return std::move(detection_merger_overhead_).Take();
   }
 
   /// / The detection merger overhead: time from the latest received detection
@@ -1886,9 +2207,11 @@ class DetectionMergerFrameProfiling final : public PbMessage {
   /// / event by the detection merger.
   ///
   /// Field no: 1.
-  Duration& mutable_detection_merger_overhead() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `detection_merger_overhead` was received and is not a valid message.
+  Duration& mutable_detection_merger_overhead() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return detection_merger_overhead_;
+    return detection_merger_overhead_.Mutable();
   }
 
   /// Returns whether `detection_merger_overhead` (no 1) is set.
@@ -1897,13 +2220,13 @@ class DetectionMergerFrameProfiling final : public PbMessage {
   /// Clears `detection_merger_overhead` (no 1).
   void clear_detection_merger_overhead() & noexcept {
     set_fields_[0] = false;
-    detection_merger_overhead_ = {};
+    detection_merger_overhead_.Clear();
   }
 
   /// Sets `detection_merger_overhead` (no 1) and returns `*this`.
   DetectionMergerFrameProfiling& set_detection_merger_overhead(Duration&& detection_merger_overhead) & noexcept {
     set_fields_[0] = true;
-    detection_merger_overhead_ = std::move(detection_merger_overhead);
+    detection_merger_overhead_.Set(std::move(detection_merger_overhead));
     return *this;
   }
   /// Sets `detection_merger_overhead` (no 1) and returns `*this`.
@@ -1919,8 +2242,12 @@ class DetectionMergerFrameProfiling final : public PbMessage {
   /// / merger overhead.
   ///
   /// Field no: 2.
-  constexpr const Duration& total_overall_frame_latency() const& noexcept HORUS_LIFETIME_BOUND {
-    return total_overall_frame_latency_;
+  ///
+  /// If `total_overall_frame_latency` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `total_overall_frame_latency` was received and is not a valid message.
+  const Duration& total_overall_frame_latency() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return total_overall_frame_latency_.Ref();
   }
 
   /// If `total_overall_frame_latency` is set, moves it out of the message (without marking it as unset).
@@ -1928,11 +2255,13 @@ class DetectionMergerFrameProfiling final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  Duration total_overall_frame_latency() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `total_overall_frame_latency` was received and is not a valid message.
+  Duration total_overall_frame_latency() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(total_overall_frame_latency_);
+    return std::move(total_overall_frame_latency_).Take();
   }
 
   /// / The total overall frame latency: the maximum overall frame latency across
@@ -1940,9 +2269,11 @@ class DetectionMergerFrameProfiling final : public PbMessage {
   /// / merger overhead.
   ///
   /// Field no: 2.
-  Duration& mutable_total_overall_frame_latency() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `total_overall_frame_latency` was received and is not a valid message.
+  Duration& mutable_total_overall_frame_latency() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return total_overall_frame_latency_;
+    return total_overall_frame_latency_.Mutable();
   }
 
   /// Returns whether `total_overall_frame_latency` (no 2) is set.
@@ -1951,13 +2282,13 @@ class DetectionMergerFrameProfiling final : public PbMessage {
   /// Clears `total_overall_frame_latency` (no 2).
   void clear_total_overall_frame_latency() & noexcept {
     set_fields_[1] = false;
-    total_overall_frame_latency_ = {};
+    total_overall_frame_latency_.Clear();
   }
 
   /// Sets `total_overall_frame_latency` (no 2) and returns `*this`.
   DetectionMergerFrameProfiling& set_total_overall_frame_latency(Duration&& total_overall_frame_latency) & noexcept {
     set_fields_[1] = true;
-    total_overall_frame_latency_ = std::move(total_overall_frame_latency);
+    total_overall_frame_latency_.Set(std::move(total_overall_frame_latency));
     return *this;
   }
   /// Sets `total_overall_frame_latency` (no 2) and returns `*this`.
@@ -1965,11 +2296,15 @@ class DetectionMergerFrameProfiling final : public PbMessage {
     return std::move(set_total_overall_frame_latency(std::move(total_overall_frame_latency)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see detection_merger_overhead()
-  Duration detection_merger_overhead_{};
+  PbLazy<Duration> detection_merger_overhead_{};
   /// @see total_overall_frame_latency()
-  Duration total_overall_frame_latency_{};
+  PbLazy<Duration> total_overall_frame_latency_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<2> set_fields_;
@@ -2014,6 +2349,11 @@ class ProfilingInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -2022,12 +2362,27 @@ class ProfilingInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.ProfilingInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.ProfilingInfo"; }
 
   /// The full name of the message: `horus.pb.ProfilingInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ProfilingInfo`, e.g. to build a `PbFieldMask<ProfilingInfo>`.
+  enum class Field : PbTag {
+    /// Field `general_profiling_set`.
+    kGeneralProfilingSet = 1,
+    /// Field `bundled_frame_profiling_set`.
+    kBundledFrameProfilingSet = 2,
+    /// Field `preprocessing_frame_profiling`.
+    kPreprocessingFrameProfiling = 3,
+    /// Field `detection_merger_frame_profiling`.
+    kDetectionMergerFrameProfiling = 4,
+  };
+
   // Field `general_profiling_set` (no 1).
   // -----
 
@@ -2297,6 +2652,10 @@ class ProfilingInfo final : public PbMessage {
     }
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see general_profiling_set()
   ProfilingSet general_profiling_set_{};
@@ -2397,6 +2756,11 @@ class PbTraits<horus::sdk::pb::ProfilingSet_ProfiledService> final {
     writer.Writer().add_enum(tag, static_cast<PbEnum>(value));
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, horus::sdk::pb::ProfilingSet_ProfiledService value) noexcept {
+    return PbTraits<PbEnum>::ByteSize(tag, static_cast<PbEnum>(value));
+  }
+
   /// Deserializes `horus::sdk::pb::ProfilingSet_ProfiledService` from `reader`.
   static horus::sdk::pb::ProfilingSet_ProfiledService Deserialize(PbReader& reader) {
     return PbEnumTraits<horus::sdk::pb::ProfilingSet_ProfiledService>::ValueOf(reader.Reader().get_enum());
@@ -2469,6 +2833,11 @@ class PbTraits<horus::sdk::pb::ProfilingSet_ProfiledDuration_PerformanceHint_Con
     writer.Writer().add_enum(tag, static_cast<PbEnum>(value));
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, horus::sdk::pb::ProfilingSet_ProfiledDuration_PerformanceHint_ConfigParameterAction value) noexcept {
+    return PbTraits<PbEnum>::ByteSize(tag, static_cast<PbEnum>(value));
+  }
+
   /// Deserializes `horus::sdk::pb::ProfilingSet_ProfiledDuration_PerformanceHint_ConfigParameterAction` from `reader`.
   static horus::sdk::pb::ProfilingSet_ProfiledDuration_PerformanceHint_ConfigParameterAction Deserialize(PbReader& reader) {
     return PbEnumTraits<horus::sdk::pb::ProfilingSet_ProfiledDuration_PerformanceHint_ConfigParameterAction>::ValueOf(reader.Reader().get_enum());
@@ -1,6 +1,9 @@
 #include "horus/pb/project_manager/service_pb.h"
 
+#include <cstddef>
+
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 
 namespace horus {
 namespace sdk {
@@ -12,27 +15,21 @@ LicenseLevel_Level1::LicenseLevel_Level1(const LicenseLevel_Level1& other) noexc
     , set_fields_{other.set_fields_} {}
 
 void LicenseLevel_Level1::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<logs::LicenseServerConnectionError>(writer, /*tag=*/ 1, license_server_unreachable_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LicenseLevel_Level1::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LicenseLevel_Level1::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        clear_reason();
-        reason_ = ReasonOneof::kLicenseServerUnreachable;
-        DeserializeField<logs::LicenseServerConnectionError>(reader, license_server_unreachable_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LicenseLevel_Level1::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LicenseLevel_Level2::LicenseLevel_Level2(const LicenseLevel_Level2& other) noexcept(false)
@@ -41,27 +38,21 @@ LicenseLevel_Level2::LicenseLevel_Level2(const LicenseLevel_Level2& other) noexc
     , set_fields_{other.set_fields_} {}
 
 void LicenseLevel_Level2::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<logs::LicenseNotFoundError>(writer, /*tag=*/ 1, license_not_found_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LicenseLevel_Level2::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LicenseLevel_Level2::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        clear_reason();
-        reason_ = ReasonOneof::kLicenseNotFound;
-        DeserializeField<logs::LicenseNotFoundError>(reader, license_not_found_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LicenseLevel_Level2::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LicenseLevel_Level3::LicenseLevel_Level3(const LicenseLevel_Level3& other) noexcept(false)
@@ -71,37 +62,21 @@ LicenseLevel_Level3::LicenseLevel_Level3(const LicenseLevel_Level3& other) noexc
     , set_fields_{other.set_fields_} {}
 
 void LicenseLevel_Level3::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<logs::LicenseExpiredError>(writer, /*tag=*/ 1, license_expired_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<logs::LicenseServerConnectionError>(writer, /*tag=*/ 2, license_server_disconnected_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LicenseLevel_Level3::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LicenseLevel_Level3::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        clear_reason();
-        reason_ = ReasonOneof::kLicenseExpired;
-        DeserializeField<logs::LicenseExpiredError>(reader, license_expired_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        clear_reason();
-        reason_ = ReasonOneof::kLicenseServerDisconnected;
-        DeserializeField<logs::LicenseServerConnectionError>(reader, license_server_disconnected_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LicenseLevel_Level3::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LicenseLevel_Level4::LicenseLevel_Level4(const LicenseLevel_Level4& other) noexcept(false)
@@ -110,27 +85,21 @@ LicenseLevel_Level4::LicenseLevel_Level4(const LicenseLevel_Level4& other) noexc
     , set_fields_{other.set_fields_} {}
 
 void LicenseLevel_Level4::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<logs::LicenseActiveInfo>(writer, /*tag=*/ 1, license_active_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LicenseLevel_Level4::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LicenseLevel_Level4::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        clear_reason();
-        reason_ = ReasonOneof::kLicenseActive;
-        DeserializeField<logs::LicenseActiveInfo>(reader, license_active_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LicenseLevel_Level4::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LicenseLevel::LicenseLevel(const LicenseLevel& other) noexcept(false)
@@ -143,65 +112,21 @@ LicenseLevel::LicenseLevel(const LicenseLevel& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void LicenseLevel::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<LicenseLevel_Level1>(writer, /*tag=*/ 10, level_1_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<LicenseLevel_Level2>(writer, /*tag=*/ 20, level_2_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<LicenseLevel_Level3>(writer, /*tag=*/ 30, level_3_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<LicenseLevel_Level4>(writer, /*tag=*/ 40, level_4_);
-  }
-  if (set_fields_[4]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 60, privilege_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LicenseLevel::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LicenseLevel::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 10: {
-        clear_level();
-        level_ = LevelOneof::kLevel1;
-        DeserializeField<LicenseLevel_Level1>(reader, level_1_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 20: {
-        clear_level();
-        level_ = LevelOneof::kLevel2;
-        DeserializeField<LicenseLevel_Level2>(reader, level_2_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 30: {
-        clear_level();
-        level_ = LevelOneof::kLevel3;
-        DeserializeField<LicenseLevel_Level3>(reader, level_3_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 40: {
-        clear_level();
-        level_ = LevelOneof::kLevel4;
-        DeserializeField<LicenseLevel_Level4>(reader, level_4_);
-        set_fields_[3] = true;
-        break;
-      }
-      case 60: {
-        DeserializeField<std::uint32_t>(reader, privilege_);
-        set_fields_[4] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LicenseLevel::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 LicenseStatus::LicenseStatus(const LicenseStatus& other) noexcept(false)
@@ -210,33 +135,21 @@ LicenseStatus::LicenseStatus(const LicenseStatus& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void LicenseStatus::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<LicenseLevel>(writer, /*tag=*/ 1, license_level_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<LicenseInfo>(writer, /*tag=*/ 2, license_info_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t LicenseStatus::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void LicenseStatus::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<LicenseLevel>(reader, license_level_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<LicenseInfo>(reader, license_info_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void LicenseStatus::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -248,41 +161,21 @@ GetHealthStatusResponse_NodeHealth::GetHealthStatusResponse_NodeHealth(const Get
     , set_fields_{other.set_fields_} {}
 
 void GetHealthStatusResponse_NodeHealth::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<GetHealthStatusResponse_NodeHealth_Service>(writer, /*tag=*/ 1, service_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, node_id_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<GetHealthStatusResponse_NodeHealth_Status>(writer, /*tag=*/ 3, node_status_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t GetHealthStatusResponse_NodeHealth::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void GetHealthStatusResponse_NodeHealth::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<GetHealthStatusResponse_NodeHealth_Service>(reader, service_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, node_id_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<GetHealthStatusResponse_NodeHealth_Status>(reader, node_status_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void GetHealthStatusResponse_NodeHealth::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 GetHealthStatusResponse_SensorHealth::GetHealthStatusResponse_SensorHealth(const GetHealthStatusResponse_SensorHealth& other) noexcept(false)
@@ -293,43 +186,21 @@ GetHealthStatusResponse_SensorHealth::GetHealthStatusResponse_SensorHealth(const
     , set_fields_{other.set_fields_} {}
 
 void GetHealthStatusResponse_SensorHealth::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, preprocessing_node_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<SensorInfo>(writer, /*tag=*/ 2, info_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<logs::ServiceConnectionTimedOut>(writer, /*tag=*/ 3, timeout_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t GetHealthStatusResponse_SensorHealth::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void GetHealthStatusResponse_SensorHealth::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, preprocessing_node_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<SensorInfo>(reader, info_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        clear_node_unreachable_error();
-        node_unreachable_error_ = NodeUnreachableErrorOneof::kTimeout;
-        DeserializeField<logs::ServiceConnectionTimedOut>(reader, timeout_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void GetHealthStatusResponse_SensorHealth::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -342,51 +213,165 @@ GetHealthStatusResponse::GetHealthStatusResponse(const GetHealthStatusResponse&
     , set_fields_{other.set_fields_} {}
 
 void GetHealthStatusResponse::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<LicenseStatus>(writer, /*tag=*/ 1, license_status_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowRepeated<GetHealthStatusResponse_SensorHealth>>(writer, /*tag=*/ 2, sensor_statuses_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowRepeated<GetHealthStatusResponse_NodeHealth>>(writer, /*tag=*/ 3, service_statuses_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<CowRepeated<GetHealthStatusResponse_NodeResources>>(writer, /*tag=*/ 4, node_resources_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t GetHealthStatusResponse::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void GetHealthStatusResponse::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<LicenseStatus>(reader, license_status_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowRepeated<GetHealthStatusResponse_SensorHealth>>(reader, sensor_statuses_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowRepeated<GetHealthStatusResponse_NodeHealth>>(reader, service_statuses_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<CowRepeated<GetHealthStatusResponse_NodeResources>>(reader, node_resources_);
-        set_fields_[3] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void GetHealthStatusResponse::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
+}
+
+// MARK: Field tables
+
+// Messages are not standard-layout since they have a vtable, so `offsetof()` is only
+// conditionally-supported on them; it is supported by all compilers targeted by the SDK.
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
+const horus_internal::PbMessageTable& LicenseLevel_Level1::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LicenseLevel_Level1, license_server_unreachable_),
+       /*oneof_offset=*/ offsetof(LicenseLevel_Level1, reason_),
+       &horus_internal::PbFieldOpsFor<logs::LicenseServerConnectionError>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LicenseLevel_Level2::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LicenseLevel_Level2, license_not_found_),
+       /*oneof_offset=*/ offsetof(LicenseLevel_Level2, reason_),
+       &horus_internal::PbFieldOpsFor<logs::LicenseNotFoundError>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LicenseLevel_Level3::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LicenseLevel_Level3, license_expired_),
+       /*oneof_offset=*/ offsetof(LicenseLevel_Level3, reason_),
+       &horus_internal::PbFieldOpsFor<logs::LicenseExpiredError>::kOps},
+      {/*tag=*/ 2, offsetof(LicenseLevel_Level3, license_server_disconnected_),
+       /*oneof_offset=*/ offsetof(LicenseLevel_Level3, reason_),
+       &horus_internal::PbFieldOpsFor<logs::LicenseServerConnectionError>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LicenseLevel_Level4::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LicenseLevel_Level4, license_active_),
+       /*oneof_offset=*/ offsetof(LicenseLevel_Level4, reason_),
+       &horus_internal::PbFieldOpsFor<logs::LicenseActiveInfo>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LicenseLevel::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 10, offsetof(LicenseLevel, level_1_),
+       /*oneof_offset=*/ offsetof(LicenseLevel, level_),
+       &horus_internal::PbFieldOpsFor<LicenseLevel_Level1>::kOps},
+      {/*tag=*/ 20, offsetof(LicenseLevel, level_2_),
+       /*oneof_offset=*/ offsetof(LicenseLevel, level_),
+       &horus_internal::PbFieldOpsFor<LicenseLevel_Level2>::kOps},
+      {/*tag=*/ 30, offsetof(LicenseLevel, level_3_),
+       /*oneof_offset=*/ offsetof(LicenseLevel, level_),
+       &horus_internal::PbFieldOpsFor<LicenseLevel_Level3>::kOps},
+      {/*tag=*/ 40, offsetof(LicenseLevel, level_4_),
+       /*oneof_offset=*/ offsetof(LicenseLevel, level_),
+       &horus_internal::PbFieldOpsFor<LicenseLevel_Level4>::kOps},
+      {/*tag=*/ 60, offsetof(LicenseLevel, privilege_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& LicenseStatus::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(LicenseStatus, license_level_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<LicenseLevel>>::kOps},
+      {/*tag=*/ 2, offsetof(LicenseStatus, license_info_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<LicenseInfo>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
 }
 
+const horus_internal::PbMessageTable& GetHealthStatusResponse_NodeHealth::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(GetHealthStatusResponse_NodeHealth, service_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<GetHealthStatusResponse_NodeHealth_Service>::kOps},
+      {/*tag=*/ 2, offsetof(GetHealthStatusResponse_NodeHealth, node_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(GetHealthStatusResponse_NodeHealth, node_status_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<GetHealthStatusResponse_NodeHealth_Status>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& GetHealthStatusResponse_SensorHealth::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(GetHealthStatusResponse_SensorHealth, preprocessing_node_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 2, offsetof(GetHealthStatusResponse_SensorHealth, info_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<SensorInfo>>::kOps},
+      {/*tag=*/ 3, offsetof(GetHealthStatusResponse_SensorHealth, timeout_),
+       /*oneof_offset=*/ offsetof(GetHealthStatusResponse_SensorHealth, node_unreachable_error_),
+       &horus_internal::PbFieldOpsFor<logs::ServiceConnectionTimedOut>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& GetHealthStatusResponse::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(GetHealthStatusResponse, license_status_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<LicenseStatus>>::kOps},
+      {/*tag=*/ 2, offsetof(GetHealthStatusResponse, sensor_statuses_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<GetHealthStatusResponse_SensorHealth>>::kOps},
+      {/*tag=*/ 3, offsetof(GetHealthStatusResponse, service_statuses_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<GetHealthStatusResponse_NodeHealth>>::kOps},
+      {/*tag=*/ 4, offsetof(GetHealthStatusResponse, node_resources_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<GetHealthStatusResponse_NodeResources>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
 }  // namespace pb
 }  // namespace sdk
 }  // namespace horus
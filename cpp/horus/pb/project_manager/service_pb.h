@@ -8,6 +8,7 @@
 /// Generated by `/opt/actions-runner/_work/horus/horus/common/tools/sdk/pb.ts`.
 
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -17,9 +18,11 @@
 #include "horus/pb/cow_repeated.h"
 #include "horus/pb/license_server/messages_pb.h"
 #include "horus/pb/logs/logs_pb.h"
+#include "horus/pb/lazy.h"
 #include "horus/pb/message.h"
 #include "horus/pb/preprocessing/messages_pb.h"
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 #include "horus/pb/types.h"
 #include "horus/strings/string_view.h"
 
@@ -154,6 +157,11 @@ class LicenseLevel_Level1 final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -162,12 +170,21 @@ class LicenseLevel_Level1 final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.LicenseLevel.Level1`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.LicenseLevel.Level1"; }
 
   /// The full name of the message: `horus.pb.LicenseLevel.Level1`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LicenseLevel_Level1`, e.g. to build a `PbFieldMask<LicenseLevel_Level1>`.
+  enum class Field : PbTag {
+    /// Field `license_server_unreachable`.
+    kLicenseServerUnreachable = 1,
+  };
+
   // Field `license_server_unreachable` (no 1).
   // -----
 
@@ -252,6 +269,10 @@ class LicenseLevel_Level1 final : public PbMessage {
     }
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see license_server_unreachable()
   logs::LicenseServerConnectionError license_server_unreachable_{};
@@ -301,6 +322,11 @@ class LicenseLevel_Level2 final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -309,12 +335,21 @@ class LicenseLevel_Level2 final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.LicenseLevel.Level2`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.LicenseLevel.Level2"; }
 
   /// The full name of the message: `horus.pb.LicenseLevel.Level2`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LicenseLevel_Level2`, e.g. to build a `PbFieldMask<LicenseLevel_Level2>`.
+  enum class Field : PbTag {
+    /// Field `license_not_found`.
+    kLicenseNotFound = 1,
+  };
+
   // Field `license_not_found` (no 1).
   // -----
 
@@ -399,6 +434,10 @@ class LicenseLevel_Level2 final : public PbMessage {
     }
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see license_not_found()
   logs::LicenseNotFoundError license_not_found_{};
@@ -448,6 +487,11 @@ class LicenseLevel_Level3 final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -456,12 +500,23 @@ class LicenseLevel_Level3 final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.LicenseLevel.Level3`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.LicenseLevel.Level3"; }
 
   /// The full name of the message: `horus.pb.LicenseLevel.Level3`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LicenseLevel_Level3`, e.g. to build a `PbFieldMask<LicenseLevel_Level3>`.
+  enum class Field : PbTag {
+    /// Field `license_expired`.
+    kLicenseExpired = 1,
+    /// Field `license_server_disconnected`.
+    kLicenseServerDisconnected = 2,
+  };
+
   // Field `license_expired` (no 1).
   // -----
 
@@ -607,6 +662,10 @@ class LicenseLevel_Level3 final : public PbMessage {
     }
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see license_expired()
   logs::LicenseExpiredError license_expired_{};
@@ -658,6 +717,11 @@ class LicenseLevel_Level4 final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -666,12 +730,21 @@ class LicenseLevel_Level4 final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.LicenseLevel.Level4`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.LicenseLevel.Level4"; }
 
   /// The full name of the message: `horus.pb.LicenseLevel.Level4`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LicenseLevel_Level4`, e.g. to build a `PbFieldMask<LicenseLevel_Level4>`.
+  enum class Field : PbTag {
+    /// Field `license_active`.
+    kLicenseActive = 1,
+  };
+
   // Field `license_active` (no 1).
   // -----
 
@@ -756,6 +829,10 @@ class LicenseLevel_Level4 final : public PbMessage {
     }
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see license_active()
   logs::LicenseActiveInfo license_active_{};
@@ -813,6 +890,11 @@ class LicenseLevel final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -821,12 +903,29 @@ class LicenseLevel final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.LicenseLevel`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.LicenseLevel"; }
 
   /// The full name of the message: `horus.pb.LicenseLevel`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LicenseLevel`, e.g. to build a `PbFieldMask<LicenseLevel>`.
+  enum class Field : PbTag {
+    /// Field `level_1`.
+    kLevel1 = 10,
+    /// Field `level_2`.
+    kLevel2 = 20,
+    /// Field `level_3`.
+    kLevel3 = 30,
+    /// Field `level_4`.
+    kLevel4 = 40,
+    /// Field `privilege`.
+    kPrivilege = 60,
+  };
+
   // Field `level_1` (no 10).
   // -----
 
@@ -1134,6 +1233,10 @@ class LicenseLevel final : public PbMessage {
     }
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see level_1()
   LicenseLevel_Level1 level_1_{};
@@ -1191,6 +1294,11 @@ class LicenseStatus final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1199,20 +1307,35 @@ class LicenseStatus final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.LicenseStatus`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.LicenseStatus"; }
 
   /// The full name of the message: `horus.pb.LicenseStatus`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `LicenseStatus`, e.g. to build a `PbFieldMask<LicenseStatus>`.
+  enum class Field : PbTag {
+    /// Field `license_level`.
+    kLicenseLevel = 1,
+    /// Field `license_info`.
+    kLicenseInfo = 2,
+  };
+
   // Field `license_level` (no 1).
   // -----
 
   /// No documentation.
   ///
   /// Field no: 1.
-  constexpr const LicenseLevel& license_level() const& noexcept HORUS_LIFETIME_BOUND {
-    return license_level_;
+  ///
+  /// If `license_level` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `license_level` was received and is not a valid message.
+  const LicenseLevel& license_level() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return license_level_.Ref();
   }
 
   /// If `license_level` is set, moves it out of the message (without marking it as unset).
@@ -1220,19 +1343,23 @@ class LicenseStatus final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  LicenseLevel license_level() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `license_level` was received and is not a valid message.
+  LicenseLevel license_level() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(license_level_);
+    return std::move(license_level_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 1.
-  LicenseLevel& mutable_license_level() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `license_level` was received and is not a valid message.
+  LicenseLevel& mutable_license_level() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return license_level_;
+    return license_level_.Mutable();
   }
 
   /// Returns whether `license_level` (no 1) is set.
@@ -1241,13 +1368,13 @@ class LicenseStatus final : public PbMessage {
   /// Clears `license_level` (no 1).
   void clear_license_level() & noexcept {
     set_fields_[0] = false;
-    license_level_ = {};
+    license_level_.Clear();
   }
 
   /// Sets `license_level` (no 1) and returns `*this`.
   LicenseStatus& set_license_level(LicenseLevel&& license_level) & noexcept {
     set_fields_[0] = true;
-    license_level_ = std::move(license_level);
+    license_level_.Set(std::move(license_level));
     return *this;
   }
   /// Sets `license_level` (no 1) and returns `*this`.
@@ -1261,8 +1388,12 @@ class LicenseStatus final : public PbMessage {
   /// If level is inferior to 3, this field is unset
   ///
   /// Field no: 2.
-  constexpr const LicenseInfo& license_info() const& noexcept HORUS_LIFETIME_BOUND {
-    return license_info_;
+  ///
+  /// If `license_info` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `license_info` was received and is not a valid message.
+  const LicenseInfo& license_info() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return license_info_.Ref();
   }
 
   /// If `license_info` is set, moves it out of the message (without marking it as unset).
@@ -1270,19 +1401,23 @@ class LicenseStatus final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  LicenseInfo license_info() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `license_info` was received and is not a valid message.
+  LicenseInfo license_info() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(license_info_);
+    return std::move(license_info_).Take();
   }
 
   /// If level is inferior to 3, this field is unset
   ///
   /// Field no: 2.
-  LicenseInfo& mutable_license_info() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `license_info` was received and is not a valid message.
+  LicenseInfo& mutable_license_info() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return license_info_;
+    return license_info_.Mutable();
   }
 
   /// Returns whether `license_info` (no 2) is set.
@@ -1291,13 +1426,13 @@ class LicenseStatus final : public PbMessage {
   /// Clears `license_info` (no 2).
   void clear_license_info() & noexcept {
     set_fields_[1] = false;
-    license_info_ = {};
+    license_info_.Clear();
   }
 
   /// Sets `license_info` (no 2) and returns `*this`.
   LicenseStatus& set_license_info(LicenseInfo&& license_info) & noexcept {
     set_fields_[1] = true;
-    license_info_ = std::move(license_info);
+    license_info_.Set(std::move(license_info));
     return *this;
   }
   /// Sets `license_info` (no 2) and returns `*this`.
@@ -1305,11 +1440,15 @@ class LicenseStatus final : public PbMessage {
     return std::move(set_license_info(std::move(license_info)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see license_level()
-  LicenseLevel license_level_{};
+  PbLazy<LicenseLevel> license_level_{};
   /// @see license_info()
-  LicenseInfo license_info_{};
+  PbLazy<LicenseInfo> license_info_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<2> set_fields_;
@@ -1355,6 +1494,9 @@ class GetHealthStatusRequest final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1365,6 +1507,9 @@ class GetHealthStatusRequest final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.GetHealthStatusRequest`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.GetHealthStatusRequest"; }
 
@@ -1419,6 +1564,11 @@ class GetHealthStatusResponse_NodeHealth final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1427,12 +1577,25 @@ class GetHealthStatusResponse_NodeHealth final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.GetHealthStatusResponse.NodeHealth`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.GetHealthStatusResponse.NodeHealth"; }
 
   /// The full name of the message: `horus.pb.GetHealthStatusResponse.NodeHealth`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `GetHealthStatusResponse_NodeHealth`, e.g. to build a `PbFieldMask<GetHealthStatusResponse_NodeHealth>`.
+  enum class Field : PbTag {
+    /// Field `service`.
+    kService = 1,
+    /// Field `node_id`.
+    kNodeId = 2,
+    /// Field `node_status`.
+    kNodeStatus = 3,
+  };
+
   // Field `service` (no 1).
   // -----
 
@@ -1559,6 +1722,10 @@ class GetHealthStatusResponse_NodeHealth final : public PbMessage {
     return std::move(set_node_status(node_status));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see service()
   GetHealthStatusResponse_NodeHealth_Service service_{};
@@ -1609,6 +1776,11 @@ class GetHealthStatusResponse_SensorHealth final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1617,12 +1789,25 @@ class GetHealthStatusResponse_SensorHealth final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.GetHealthStatusResponse.SensorHealth`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.GetHealthStatusResponse.SensorHealth"; }
 
   /// The full name of the message: `horus.pb.GetHealthStatusResponse.SensorHealth`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `GetHealthStatusResponse_SensorHealth`, e.g. to build a `PbFieldMask<GetHealthStatusResponse_SensorHealth>`.
+  enum class Field : PbTag {
+    /// Field `preprocessing_node_id`.
+    kPreprocessingNodeId = 1,
+    /// Field `info`.
+    kInfo = 2,
+    /// Field `timeout`.
+    kTimeout = 3,
+  };
+
   // Field `preprocessing_node_id` (no 1).
   // -----
 
@@ -1679,8 +1864,12 @@ class GetHealthStatusResponse_SensorHealth final : public PbMessage {
   /// Info of the sensor
   ///
   /// Field no: 2.
-  constexpr const SensorInfo& info() const& noexcept HORUS_LIFETIME_BOUND {
-    return info_;
+  ///
+  /// If `info` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `info` was received and is not a valid message.
+  const SensorInfo& info() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return info_.Ref();
   }
 
   /// If `info` is set, moves it out of the message (without marking it as unset).
@@ -1688,19 +1877,23 @@ class GetHealthStatusResponse_SensorHealth final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  SensorInfo info() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `info` was received and is not a valid message.
+  SensorInfo info() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(info_);
+    return std::move(info_).Take();
   }
 
   /// Info of the sensor
   ///
   /// Field no: 2.
-  SensorInfo& mutable_info() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `info` was received and is not a valid message.
+  SensorInfo& mutable_info() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return info_;
+    return info_.Mutable();
   }
 
   /// Returns whether `info` (no 2) is set.
@@ -1709,13 +1902,13 @@ class GetHealthStatusResponse_SensorHealth final : public PbMessage {
   /// Clears `info` (no 2).
   void clear_info() & noexcept {
     set_fields_[1] = false;
-    info_ = {};
+    info_.Clear();
   }
 
   /// Sets `info` (no 2) and returns `*this`.
   GetHealthStatusResponse_SensorHealth& set_info(SensorInfo&& info) & noexcept {
     set_fields_[1] = true;
-    info_ = std::move(info);
+    info_.Set(std::move(info));
     return *this;
   }
   /// Sets `info` (no 2) and returns `*this`.
@@ -1807,11 +2000,15 @@ class GetHealthStatusResponse_SensorHealth final : public PbMessage {
     }
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see preprocessing_node_id()
   CowBytes preprocessing_node_id_{};
   /// @see info()
-  SensorInfo info_{};
+  PbLazy<SensorInfo> info_{};
   /// @see timeout()
   logs::ServiceConnectionTimedOut timeout_{};
 
@@ -1863,6 +2060,9 @@ class GetHealthStatusResponse_NodeResources final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1873,6 +2073,9 @@ class GetHealthStatusResponse_NodeResources final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.GetHealthStatusResponse.NodeResources`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.GetHealthStatusResponse.NodeResources"; }
 
@@ -1933,6 +2136,11 @@ class GetHealthStatusResponse final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1941,20 +2149,39 @@ class GetHealthStatusResponse final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.GetHealthStatusResponse`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.GetHealthStatusResponse"; }
 
   /// The full name of the message: `horus.pb.GetHealthStatusResponse`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `GetHealthStatusResponse`, e.g. to build a `PbFieldMask<GetHealthStatusResponse>`.
+  enum class Field : PbTag {
+    /// Field `license_status`.
+    kLicenseStatus = 1,
+    /// Field `sensor_statuses`.
+    kSensorStatuses = 2,
+    /// Field `service_statuses`.
+    kServiceStatuses = 3,
+    /// Field `node_resources`.
+    kNodeResources = 4,
+  };
+
   // Field `license_status` (no 1).
   // -----
 
   /// No documentation.
   ///
   /// Field no: 1.
-  constexpr const LicenseStatus& license_status() const& noexcept HORUS_LIFETIME_BOUND {
-    return license_status_;
+  ///
+  /// If `license_status` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `license_status` was received and is not a valid message.
+  const LicenseStatus& license_status() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return license_status_.Ref();
   }
 
   /// If `license_status` is set, moves it out of the message (without marking it as unset).
@@ -1962,19 +2189,23 @@ class GetHealthStatusResponse final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  LicenseStatus license_status() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `license_status` was received and is not a valid message.
+  LicenseStatus license_status() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(license_status_);
+    return std::move(license_status_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 1.
-  LicenseStatus& mutable_license_status() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `license_status` was received and is not a valid message.
+  LicenseStatus& mutable_license_status() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return license_status_;
+    return license_status_.Mutable();
   }
 
   /// Returns whether `license_status` (no 1) is set.
@@ -1983,13 +2214,13 @@ class GetHealthStatusResponse final : public PbMessage {
   /// Clears `license_status` (no 1).
   void clear_license_status() & noexcept {
     set_fields_[0] = false;
-    license_status_ = {};
+    license_status_.Clear();
   }
 
   /// Sets `license_status` (no 1) and returns `*this`.
   GetHealthStatusResponse& set_license_status(LicenseStatus&& license_status) & noexcept {
     set_fields_[0] = true;
-    license_status_ = std::move(license_status);
+    license_status_.Set(std::move(license_status));
     return *this;
   }
   /// Sets `license_status` (no 1) and returns `*this`.
@@ -2155,9 +2386,13 @@ class GetHealthStatusResponse final : public PbMessage {
     return std::move(set_node_resources(std::move(node_resources)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see license_status()
-  LicenseStatus license_status_{};
+  PbLazy<LicenseStatus> license_status_{};
   /// @see sensor_statuses()
   CowRepeated<GetHealthStatusResponse_SensorHealth> sensor_statuses_{};
   /// @see service_statuses()
@@ -2270,6 +2505,11 @@ class PbTraits<horus::sdk::pb::LicensePrivilege> final {
     writer.Writer().add_enum(tag, static_cast<PbEnum>(value));
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, horus::sdk::pb::LicensePrivilege value) noexcept {
+    return PbTraits<PbEnum>::ByteSize(tag, static_cast<PbEnum>(value));
+  }
+
   /// Deserializes `horus::sdk::pb::LicensePrivilege` from `reader`.
   static horus::sdk::pb::LicensePrivilege Deserialize(PbReader& reader) {
     return PbEnumTraits<horus::sdk::pb::LicensePrivilege>::ValueOf(reader.Reader().get_enum());
@@ -2378,6 +2618,11 @@ class PbTraits<horus::sdk::pb::GetHealthStatusResponse_NodeHealth_Service> final
     writer.Writer().add_enum(tag, static_cast<PbEnum>(value));
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, horus::sdk::pb::GetHealthStatusResponse_NodeHealth_Service value) noexcept {
+    return PbTraits<PbEnum>::ByteSize(tag, static_cast<PbEnum>(value));
+  }
+
   /// Deserializes `horus::sdk::pb::GetHealthStatusResponse_NodeHealth_Service` from `reader`.
   static horus::sdk::pb::GetHealthStatusResponse_NodeHealth_Service Deserialize(PbReader& reader) {
     return PbEnumTraits<horus::sdk::pb::GetHealthStatusResponse_NodeHealth_Service>::ValueOf(reader.Reader().get_enum());
@@ -2450,6 +2695,11 @@ class PbTraits<horus::sdk::pb::GetHealthStatusResponse_NodeHealth_Status> final
     writer.Writer().add_enum(tag, static_cast<PbEnum>(value));
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, horus::sdk::pb::GetHealthStatusResponse_NodeHealth_Status value) noexcept {
+    return PbTraits<PbEnum>::ByteSize(tag, static_cast<PbEnum>(value));
+  }
+
   /// Deserializes `horus::sdk::pb::GetHealthStatusResponse_NodeHealth_Status` from `reader`.
   static horus::sdk::pb::GetHealthStatusResponse_NodeHealth_Status Deserialize(PbReader& reader) {
     return PbEnumTraits<horus::sdk::pb::GetHealthStatusResponse_NodeHealth_Status>::ValueOf(reader.Reader().get_enum());
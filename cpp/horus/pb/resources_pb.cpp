@@ -1,6 +1,9 @@
 #include "horus/pb/resources_pb.h"
 
+#include <cstddef>
+
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 
 namespace horus {
 namespace sdk {
@@ -12,33 +15,21 @@ GpuProcessInfo::GpuProcessInfo(const GpuProcessInfo& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void GpuProcessInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 1, pid_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 2, gpu_memory_usage_bytes_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t GpuProcessInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void GpuProcessInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint32_t>(reader, pid_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::uint64_t>(reader, gpu_memory_usage_bytes_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void GpuProcessInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 GpuInfo::GpuInfo(const GpuInfo& other) noexcept(false)
@@ -52,73 +43,21 @@ GpuInfo::GpuInfo(const GpuInfo& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void GpuInfo::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 1, gpu_id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, gpu_name_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 3, temperature_celsius_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 4, utilization_percentage_);
-  }
-  if (set_fields_[4]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 5, memory_used_bytes_);
-  }
-  if (set_fields_[5]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 6, memory_total_bytes_);
-  }
-  if (set_fields_[6]) {
-    SerializeField<CowRepeated<GpuProcessInfo>>(writer, /*tag=*/ 7, running_processes_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t GpuInfo::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void GpuInfo::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint32_t>(reader, gpu_id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, gpu_name_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<std::uint32_t>(reader, temperature_celsius_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<std::uint32_t>(reader, utilization_percentage_);
-        set_fields_[3] = true;
-        break;
-      }
-      case 5: {
-        DeserializeField<std::uint64_t>(reader, memory_used_bytes_);
-        set_fields_[4] = true;
-        break;
-      }
-      case 6: {
-        DeserializeField<std::uint64_t>(reader, memory_total_bytes_);
-        set_fields_[5] = true;
-        break;
-      }
-      case 7: {
-        DeserializeField<CowRepeated<GpuProcessInfo>>(reader, running_processes_);
-        set_fields_[6] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void GpuInfo::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 CpuAndMemoryUsage::CpuAndMemoryUsage(const CpuAndMemoryUsage& other) noexcept(false)
@@ -127,33 +66,21 @@ CpuAndMemoryUsage::CpuAndMemoryUsage(const CpuAndMemoryUsage& other) noexcept(fa
     , set_fields_{other.set_fields_} {}
 
 void CpuAndMemoryUsage::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 1, cpu_usage_percentage_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 2, memory_usage_bytes_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t CpuAndMemoryUsage::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void CpuAndMemoryUsage::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint32_t>(reader, cpu_usage_percentage_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::uint64_t>(reader, memory_usage_bytes_);
-        set_fields_[1] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void CpuAndMemoryUsage::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 ResourceUsage::ResourceUsage(const ResourceUsage& other) noexcept(false)
@@ -164,51 +91,109 @@ ResourceUsage::ResourceUsage(const ResourceUsage& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void ResourceUsage::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CpuAndMemoryUsage>(writer, /*tag=*/ 1, process_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CpuAndMemoryUsage>(writer, /*tag=*/ 2, host_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowRepeated<GpuInfo>>(writer, /*tag=*/ 3, gpus_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 4, cpu_cores_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t ResourceUsage::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void ResourceUsage::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CpuAndMemoryUsage>(reader, process_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CpuAndMemoryUsage>(reader, host_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowRepeated<GpuInfo>>(reader, gpus_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<std::uint32_t>(reader, cpu_cores_);
-        set_fields_[3] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void ResourceUsage::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
+}
+
+// MARK: Field tables
+
+// Messages are not standard-layout since they have a vtable, so `offsetof()` is only
+// conditionally-supported on them; it is supported by all compilers targeted by the SDK.
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
+const horus_internal::PbMessageTable& GpuProcessInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(GpuProcessInfo, pid_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/ 2, offsetof(GpuProcessInfo, gpu_memory_usage_bytes_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
 }
 
+const horus_internal::PbMessageTable& GpuInfo::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(GpuInfo, gpu_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/ 2, offsetof(GpuInfo, gpu_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(GpuInfo, temperature_celsius_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/ 4, offsetof(GpuInfo, utilization_percentage_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/ 5, offsetof(GpuInfo, memory_used_bytes_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 6, offsetof(GpuInfo, memory_total_bytes_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 7, offsetof(GpuInfo, running_processes_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<GpuProcessInfo>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& CpuAndMemoryUsage::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(CpuAndMemoryUsage, cpu_usage_percentage_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/ 2, offsetof(CpuAndMemoryUsage, memory_usage_bytes_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& ResourceUsage::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(ResourceUsage, process_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<CpuAndMemoryUsage>>::kOps},
+      {/*tag=*/ 2, offsetof(ResourceUsage, host_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<CpuAndMemoryUsage>>::kOps},
+      {/*tag=*/ 3, offsetof(ResourceUsage, gpus_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<GpuInfo>>::kOps},
+      {/*tag=*/ 4, offsetof(ResourceUsage, cpu_cores_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
 }  // namespace pb
 }  // namespace sdk
 }  // namespace horus
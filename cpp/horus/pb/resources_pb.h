@@ -8,6 +8,7 @@
 /// Generated by `/opt/actions-runner/_work/horus/horus/common/tools/sdk/pb.ts`.
 
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -15,8 +16,10 @@
 #include "horus/internal/attributes.h"
 #include "horus/pb/cow_bytes.h"
 #include "horus/pb/cow_repeated.h"
+#include "horus/pb/lazy.h"
 #include "horus/pb/message.h"
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 #include "horus/strings/string_view.h"
 
 #if HORUS_SDK_USE_PB_NAMESPACE_ALIAS
@@ -76,6 +79,11 @@ class GpuProcessInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -84,12 +92,23 @@ class GpuProcessInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.GpuProcessInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.GpuProcessInfo"; }
 
   /// The full name of the message: `horus.pb.GpuProcessInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `GpuProcessInfo`, e.g. to build a `PbFieldMask<GpuProcessInfo>`.
+  enum class Field : PbTag {
+    /// Field `pid`.
+    kPid = 1,
+    /// Field `gpu_memory_usage_bytes`.
+    kGpuMemoryUsageBytes = 2,
+  };
+
   // Field `pid` (no 1).
   // -----
 
@@ -166,6 +185,10 @@ class GpuProcessInfo final : public PbMessage {
     return std::move(set_gpu_memory_usage_bytes(gpu_memory_usage_bytes));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see pid()
   std::uint32_t pid_{};
@@ -214,6 +237,11 @@ class GpuInfo final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -222,12 +250,33 @@ class GpuInfo final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.GpuInfo`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.GpuInfo"; }
 
   /// The full name of the message: `horus.pb.GpuInfo`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `GpuInfo`, e.g. to build a `PbFieldMask<GpuInfo>`.
+  enum class Field : PbTag {
+    /// Field `gpu_id`.
+    kGpuId = 1,
+    /// Field `gpu_name`.
+    kGpuName = 2,
+    /// Field `temperature_celsius`.
+    kTemperatureCelsius = 3,
+    /// Field `utilization_percentage`.
+    kUtilizationPercentage = 4,
+    /// Field `memory_used_bytes`.
+    kMemoryUsedBytes = 5,
+    /// Field `memory_total_bytes`.
+    kMemoryTotalBytes = 6,
+    /// Field `running_processes`.
+    kRunningProcesses = 7,
+  };
+
   // Field `gpu_id` (no 1).
   // -----
 
@@ -518,6 +567,10 @@ class GpuInfo final : public PbMessage {
     return std::move(set_running_processes(std::move(running_processes)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see gpu_id()
   std::uint32_t gpu_id_{};
@@ -576,6 +629,11 @@ class CpuAndMemoryUsage final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -584,12 +642,23 @@ class CpuAndMemoryUsage final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.CpuAndMemoryUsage`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.CpuAndMemoryUsage"; }
 
   /// The full name of the message: `horus.pb.CpuAndMemoryUsage`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `CpuAndMemoryUsage`, e.g. to build a `PbFieldMask<CpuAndMemoryUsage>`.
+  enum class Field : PbTag {
+    /// Field `cpu_usage_percentage`.
+    kCpuUsagePercentage = 1,
+    /// Field `memory_usage_bytes`.
+    kMemoryUsageBytes = 2,
+  };
+
   // Field `cpu_usage_percentage` (no 1).
   // -----
 
@@ -670,6 +739,10 @@ class CpuAndMemoryUsage final : public PbMessage {
     return std::move(set_memory_usage_bytes(memory_usage_bytes));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see cpu_usage_percentage()
   std::uint32_t cpu_usage_percentage_{};
@@ -718,6 +791,11 @@ class ResourceUsage final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -726,20 +804,39 @@ class ResourceUsage final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.ResourceUsage`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.ResourceUsage"; }
 
   /// The full name of the message: `horus.pb.ResourceUsage`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `ResourceUsage`, e.g. to build a `PbFieldMask<ResourceUsage>`.
+  enum class Field : PbTag {
+    /// Field `process`.
+    kProcess = 1,
+    /// Field `host`.
+    kHost = 2,
+    /// Field `gpus`.
+    kGpus = 3,
+    /// Field `cpu_cores`.
+    kCpuCores = 4,
+  };
+
   // Field `process` (no 1).
   // -----
 
   /// No documentation.
   ///
   /// Field no: 1.
-  constexpr const CpuAndMemoryUsage& process() const& noexcept HORUS_LIFETIME_BOUND {
-    return process_;
+  ///
+  /// If `process` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `process` was received and is not a valid message.
+  const CpuAndMemoryUsage& process() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return process_.Ref();
   }
 
   /// If `process` is set, moves it out of the message (without marking it as unset).
@@ -747,19 +844,23 @@ class ResourceUsage final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  CpuAndMemoryUsage process() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `process` was received and is not a valid message.
+  CpuAndMemoryUsage process() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(process_);
+    return std::move(process_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 1.
-  CpuAndMemoryUsage& mutable_process() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `process` was received and is not a valid message.
+  CpuAndMemoryUsage& mutable_process() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return process_;
+    return process_.Mutable();
   }
 
   /// Returns whether `process` (no 1) is set.
@@ -768,13 +869,13 @@ class ResourceUsage final : public PbMessage {
   /// Clears `process` (no 1).
   void clear_process() & noexcept {
     set_fields_[0] = false;
-    process_ = {};
+    process_.Clear();
   }
 
   /// Sets `process` (no 1) and returns `*this`.
   ResourceUsage& set_process(CpuAndMemoryUsage&& process) & noexcept {
     set_fields_[0] = true;
-    process_ = std::move(process);
+    process_.Set(std::move(process));
     return *this;
   }
   /// Sets `process` (no 1) and returns `*this`.
@@ -788,8 +889,12 @@ class ResourceUsage final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 2.
-  constexpr const CpuAndMemoryUsage& host() const& noexcept HORUS_LIFETIME_BOUND {
-    return host_;
+  ///
+  /// If `host` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `host` was received and is not a valid message.
+  const CpuAndMemoryUsage& host() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return host_.Ref();
   }
 
   /// If `host` is set, moves it out of the message (without marking it as unset).
@@ -797,19 +902,23 @@ class ResourceUsage final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 2.
-  CpuAndMemoryUsage host() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `host` was received and is not a valid message.
+  CpuAndMemoryUsage host() && noexcept(false) {
     if (!set_fields_[1]) {
       return {};
     }
-    return std::move(host_);
+    return std::move(host_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 2.
-  CpuAndMemoryUsage& mutable_host() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `host` was received and is not a valid message.
+  CpuAndMemoryUsage& mutable_host() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[1] = true;
-    return host_;
+    return host_.Mutable();
   }
 
   /// Returns whether `host` (no 2) is set.
@@ -818,13 +927,13 @@ class ResourceUsage final : public PbMessage {
   /// Clears `host` (no 2).
   void clear_host() & noexcept {
     set_fields_[1] = false;
-    host_ = {};
+    host_.Clear();
   }
 
   /// Sets `host` (no 2) and returns `*this`.
   ResourceUsage& set_host(CpuAndMemoryUsage&& host) & noexcept {
     set_fields_[1] = true;
-    host_ = std::move(host);
+    host_.Set(std::move(host));
     return *this;
   }
   /// Sets `host` (no 2) and returns `*this`.
@@ -922,11 +1031,15 @@ class ResourceUsage final : public PbMessage {
     return std::move(set_cpu_cores(cpu_cores));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see process()
-  CpuAndMemoryUsage process_{};
+  PbLazy<CpuAndMemoryUsage> process_{};
   /// @see host()
-  CpuAndMemoryUsage host_{};
+  PbLazy<CpuAndMemoryUsage> host_{};
   /// @see gpus()
   CowRepeated<GpuInfo> gpus_{};
   /// @see cpu_cores()
@@ -1,6 +1,9 @@
 #include "horus/pb/rpc/message_pb.h"
 
+#include <cstddef>
+
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 
 namespace horus {
 namespace sdk {
@@ -17,75 +20,64 @@ RpcMessage::RpcMessage(const RpcMessage& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void RpcMessage::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<RpcMessage_Version>(writer, /*tag=*/ 1, version_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 2, service_id_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, message_bytes_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 4, request_id_);
-  }
-  if (set_fields_[4]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 5, method_id_);
-  }
-  if (set_fields_[5]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 6, error_);
-  }
-  if (set_fields_[6]) {
-    SerializeField<bool>(writer, /*tag=*/ 7, cancel_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t RpcMessage::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void RpcMessage::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<RpcMessage_Version>(reader, version_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::uint32_t>(reader, service_id_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, message_bytes_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<std::uint32_t>(reader, request_id_);
-        set_fields_[3] = true;
-        break;
-      }
-      case 5: {
-        DeserializeField<std::uint32_t>(reader, method_id_);
-        set_fields_[4] = true;
-        break;
-      }
-      case 6: {
-        DeserializeField<CowBytes>(reader, error_);
-        set_fields_[5] = true;
-        break;
-      }
-      case 7: {
-        DeserializeField<bool>(reader, cancel_);
-        set_fields_[6] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void RpcMessage::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
+// MARK: Field tables
+
+// Messages are not standard-layout since they have a vtable, so `offsetof()` is only
+// conditionally-supported on them; it is supported by all compilers targeted by the SDK.
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
+const horus_internal::PbMessageTable& RpcMessage::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(RpcMessage, version_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<RpcMessage_Version>::kOps},
+      {/*tag=*/ 2, offsetof(RpcMessage, service_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/ 3, offsetof(RpcMessage, message_bytes_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 4, offsetof(RpcMessage, request_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/ 5, offsetof(RpcMessage, method_id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/ 6, offsetof(RpcMessage, error_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 7, offsetof(RpcMessage, cancel_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<bool>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
 }  // namespace pb
 }  // namespace sdk
 }  // namespace horus
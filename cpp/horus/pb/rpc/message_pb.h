@@ -8,6 +8,7 @@
 /// Generated by `/opt/actions-runner/_work/horus/horus/common/tools/sdk/pb.ts`.
 
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -16,6 +17,7 @@
 #include "horus/pb/cow_bytes.h"
 #include "horus/pb/message.h"
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 #include "horus/pb/types.h"
 #include "horus/strings/string_view.h"
 
@@ -91,6 +93,11 @@ class RpcMessage final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -99,12 +106,33 @@ class RpcMessage final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.RpcMessage`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.RpcMessage"; }
 
   /// The full name of the message: `horus.pb.RpcMessage`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `RpcMessage`, e.g. to build a `PbFieldMask<RpcMessage>`.
+  enum class Field : PbTag {
+    /// Field `version`.
+    kVersion = 1,
+    /// Field `service_id`.
+    kServiceId = 2,
+    /// Field `message_bytes`.
+    kMessageBytes = 3,
+    /// Field `request_id`.
+    kRequestId = 4,
+    /// Field `method_id`.
+    kMethodId = 5,
+    /// Field `error`.
+    kError = 6,
+    /// Field `cancel`.
+    kCancel = 7,
+  };
+
   // Field `version` (no 1).
   // -----
 
@@ -439,6 +467,10 @@ class RpcMessage final : public PbMessage {
     return std::move(set_cancel(cancel));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see version()
   RpcMessage_Version version_{};
@@ -524,6 +556,11 @@ class PbTraits<horus::sdk::pb::RpcMessage_Version> final {
     writer.Writer().add_enum(tag, static_cast<PbEnum>(value));
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, horus::sdk::pb::RpcMessage_Version value) noexcept {
+    return PbTraits<PbEnum>::ByteSize(tag, static_cast<PbEnum>(value));
+  }
+
   /// Deserializes `horus::sdk::pb::RpcMessage_Version` from `reader`.
   static horus::sdk::pb::RpcMessage_Version Deserialize(PbReader& reader) {
     return PbEnumTraits<horus::sdk::pb::RpcMessage_Version>::ValueOf(reader.Reader().get_enum());
@@ -1,6 +1,9 @@
 #include "horus/pb/rpc_pb.h"
 
+#include <cstddef>
+
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 
 namespace horus {
 namespace sdk {
@@ -15,41 +18,21 @@ RpcServiceOptions::RpcServiceOptions(const RpcServiceOptions& other) noexcept(fa
     , set_fields_{other.set_fields_} {}
 
 void RpcServiceOptions::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 1, id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, description_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowRepeated<std::uint32_t>>(writer, /*tag=*/ 3, reserved_ids_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t RpcServiceOptions::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void RpcServiceOptions::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint32_t>(reader, id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, description_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowRepeated<std::uint32_t>>(reader, reserved_ids_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void RpcServiceOptions::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 RpcMethodOptions_SubscribeMethod::RpcMethodOptions_SubscribeMethod(const RpcMethodOptions_SubscribeMethod& other) noexcept(false)
@@ -57,25 +40,21 @@ RpcMethodOptions_SubscribeMethod::RpcMethodOptions_SubscribeMethod(const RpcMeth
     , set_fields_{other.set_fields_} {}
 
 void RpcMethodOptions_SubscribeMethod::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, subscriber_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t RpcMethodOptions_SubscribeMethod::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void RpcMethodOptions_SubscribeMethod::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, subscriber_name_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void RpcMethodOptions_SubscribeMethod::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 RpcMethodOptions_UnsubscribeMethod::RpcMethodOptions_UnsubscribeMethod(const RpcMethodOptions_UnsubscribeMethod& other) noexcept(false)
@@ -83,25 +62,21 @@ RpcMethodOptions_UnsubscribeMethod::RpcMethodOptions_UnsubscribeMethod(const Rpc
     , set_fields_{other.set_fields_} {}
 
 void RpcMethodOptions_UnsubscribeMethod::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 1, subscriber_name_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t RpcMethodOptions_UnsubscribeMethod::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void RpcMethodOptions_UnsubscribeMethod::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<CowBytes>(reader, subscriber_name_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void RpcMethodOptions_UnsubscribeMethod::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 RpcMethodOptions::RpcMethodOptions(const RpcMethodOptions& other) noexcept(false)
@@ -113,53 +88,21 @@ RpcMethodOptions::RpcMethodOptions(const RpcMethodOptions& other) noexcept(false
     , set_fields_{other.set_fields_} {}
 
 void RpcMethodOptions::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 1, id_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 2, description_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<RpcMethodOptions_SubscribeMethod>(writer, /*tag=*/ 3, subscribe_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<RpcMethodOptions_UnsubscribeMethod>(writer, /*tag=*/ 4, unsubscribe_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t RpcMethodOptions::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void RpcMethodOptions::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint32_t>(reader, id_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<CowBytes>(reader, description_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        clear_type();
-        type_ = TypeOneof::kSubscribe;
-        DeserializeField<RpcMethodOptions_SubscribeMethod>(reader, subscribe_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        clear_type();
-        type_ = TypeOneof::kUnsubscribe;
-        DeserializeField<RpcMethodOptions_UnsubscribeMethod>(reader, unsubscribe_);
-        set_fields_[3] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void RpcMethodOptions::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -170,27 +113,21 @@ DefaultSubscribeResponse::DefaultSubscribeResponse(const DefaultSubscribeRespons
     , set_fields_{other.set_fields_} {}
 
 void DefaultSubscribeResponse::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<logs::RpcConnectionError>(writer, /*tag=*/ 1, connection_error_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t DefaultSubscribeResponse::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void DefaultSubscribeResponse::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        clear_error();
-        error_ = ErrorOneof::kConnectionError;
-        DeserializeField<logs::RpcConnectionError>(reader, connection_error_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void DefaultSubscribeResponse::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 
@@ -201,29 +138,111 @@ DefaultUnsubscribeResponse::DefaultUnsubscribeResponse(const DefaultUnsubscribeR
     , set_fields_{other.set_fields_} {}
 
 void DefaultUnsubscribeResponse::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<logs::RpcDisconnectionError>(writer, /*tag=*/ 1, disconnection_error_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t DefaultUnsubscribeResponse::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void DefaultUnsubscribeResponse::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        clear_error();
-        error_ = ErrorOneof::kDisconnectionError;
-        DeserializeField<logs::RpcDisconnectionError>(reader, disconnection_error_);
-        set_fields_[0] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void DefaultUnsubscribeResponse::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
+}
+
+// MARK: Field tables
+
+// Messages are not standard-layout since they have a vtable, so `offsetof()` is only
+// conditionally-supported on them; it is supported by all compilers targeted by the SDK.
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
+const horus_internal::PbMessageTable& RpcServiceOptions::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(RpcServiceOptions, id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/ 2, offsetof(RpcServiceOptions, description_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(RpcServiceOptions, reserved_ids_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<std::uint32_t>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& RpcMethodOptions_SubscribeMethod::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(RpcMethodOptions_SubscribeMethod, subscriber_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
 }
 
+const horus_internal::PbMessageTable& RpcMethodOptions_UnsubscribeMethod::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(RpcMethodOptions_UnsubscribeMethod, subscriber_name_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& RpcMethodOptions::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(RpcMethodOptions, id_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/ 2, offsetof(RpcMethodOptions, description_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 3, offsetof(RpcMethodOptions, subscribe_),
+       /*oneof_offset=*/ offsetof(RpcMethodOptions, type_),
+       &horus_internal::PbFieldOpsFor<RpcMethodOptions_SubscribeMethod>::kOps},
+      {/*tag=*/ 4, offsetof(RpcMethodOptions, unsubscribe_),
+       /*oneof_offset=*/ offsetof(RpcMethodOptions, type_),
+       &horus_internal::PbFieldOpsFor<RpcMethodOptions_UnsubscribeMethod>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& DefaultSubscribeResponse::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(DefaultSubscribeResponse, connection_error_),
+       /*oneof_offset=*/ offsetof(DefaultSubscribeResponse, error_),
+       &horus_internal::PbFieldOpsFor<logs::RpcConnectionError>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& DefaultUnsubscribeResponse::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(DefaultUnsubscribeResponse, disconnection_error_),
+       /*oneof_offset=*/ offsetof(DefaultUnsubscribeResponse, error_),
+       &horus_internal::PbFieldOpsFor<logs::RpcDisconnectionError>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
 }  // namespace pb
 }  // namespace sdk
 }  // namespace horus
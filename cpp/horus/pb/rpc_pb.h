@@ -8,6 +8,7 @@
 /// Generated by `/opt/actions-runner/_work/horus/horus/common/tools/sdk/pb.ts`.
 
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -18,6 +19,7 @@
 #include "horus/pb/logs/logs_pb.h"
 #include "horus/pb/message.h"
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 #include "horus/strings/string_view.h"
 
 #if HORUS_SDK_USE_PB_NAMESPACE_ALIAS
@@ -85,6 +87,9 @@ class NoResponse final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -95,6 +100,9 @@ class NoResponse final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.NoResponse`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.NoResponse"; }
 
@@ -145,6 +153,11 @@ class RpcServiceOptions final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -153,12 +166,25 @@ class RpcServiceOptions final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.RpcServiceOptions`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.RpcServiceOptions"; }
 
   /// The full name of the message: `horus.pb.RpcServiceOptions`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `RpcServiceOptions`, e.g. to build a `PbFieldMask<RpcServiceOptions>`.
+  enum class Field : PbTag {
+    /// Field `id`.
+    kId = 1,
+    /// Field `description`.
+    kDescription = 2,
+    /// Field `reserved_ids`.
+    kReservedIds = 3,
+  };
+
   // Field `id` (no 1).
   // -----
 
@@ -313,6 +339,10 @@ class RpcServiceOptions final : public PbMessage {
     return std::move(set_reserved_ids(std::move(reserved_ids)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see id()
   std::uint32_t id_{};
@@ -363,6 +393,11 @@ class RpcMethodOptions_SubscribeMethod final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -371,12 +406,21 @@ class RpcMethodOptions_SubscribeMethod final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.RpcMethodOptions.SubscribeMethod`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.RpcMethodOptions.SubscribeMethod"; }
 
   /// The full name of the message: `horus.pb.RpcMethodOptions.SubscribeMethod`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `RpcMethodOptions_SubscribeMethod`, e.g. to build a `PbFieldMask<RpcMethodOptions_SubscribeMethod>`.
+  enum class Field : PbTag {
+    /// Field `subscriber_name`.
+    kSubscriberName = 1,
+  };
+
   // Field `subscriber_name` (no 1).
   // -----
 
@@ -427,6 +471,10 @@ class RpcMethodOptions_SubscribeMethod final : public PbMessage {
     return std::move(set_subscriber_name(std::move(subscriber_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see subscriber_name()
   CowBytes subscriber_name_{};
@@ -473,6 +521,11 @@ class RpcMethodOptions_UnsubscribeMethod final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -481,12 +534,21 @@ class RpcMethodOptions_UnsubscribeMethod final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.RpcMethodOptions.UnsubscribeMethod`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.RpcMethodOptions.UnsubscribeMethod"; }
 
   /// The full name of the message: `horus.pb.RpcMethodOptions.UnsubscribeMethod`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `RpcMethodOptions_UnsubscribeMethod`, e.g. to build a `PbFieldMask<RpcMethodOptions_UnsubscribeMethod>`.
+  enum class Field : PbTag {
+    /// Field `subscriber_name`.
+    kSubscriberName = 1,
+  };
+
   // Field `subscriber_name` (no 1).
   // -----
 
@@ -537,6 +599,10 @@ class RpcMethodOptions_UnsubscribeMethod final : public PbMessage {
     return std::move(set_subscriber_name(std::move(subscriber_name)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see subscriber_name()
   CowBytes subscriber_name_{};
@@ -587,6 +653,11 @@ class RpcMethodOptions final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -595,12 +666,27 @@ class RpcMethodOptions final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.RpcMethodOptions`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.RpcMethodOptions"; }
 
   /// The full name of the message: `horus.pb.RpcMethodOptions`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `RpcMethodOptions`, e.g. to build a `PbFieldMask<RpcMethodOptions>`.
+  enum class Field : PbTag {
+    /// Field `id`.
+    kId = 1,
+    /// Field `description`.
+    kDescription = 2,
+    /// Field `subscribe`.
+    kSubscribe = 3,
+    /// Field `unsubscribe`.
+    kUnsubscribe = 4,
+  };
+
   // Field `id` (no 1).
   // -----
 
@@ -846,6 +932,10 @@ class RpcMethodOptions final : public PbMessage {
     }
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see id()
   std::uint32_t id_{};
@@ -903,6 +993,9 @@ class DefaultSubscribeRequest final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -913,6 +1006,9 @@ class DefaultSubscribeRequest final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.DefaultSubscribeRequest`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.DefaultSubscribeRequest"; }
 
@@ -963,6 +1059,11 @@ class DefaultSubscribeResponse final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -971,12 +1072,21 @@ class DefaultSubscribeResponse final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.DefaultSubscribeResponse`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.DefaultSubscribeResponse"; }
 
   /// The full name of the message: `horus.pb.DefaultSubscribeResponse`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `DefaultSubscribeResponse`, e.g. to build a `PbFieldMask<DefaultSubscribeResponse>`.
+  enum class Field : PbTag {
+    /// Field `connection_error`.
+    kConnectionError = 1,
+  };
+
   // Field `connection_error` (no 1).
   // -----
 
@@ -1061,6 +1171,10 @@ class DefaultSubscribeResponse final : public PbMessage {
     }
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see connection_error()
   logs::RpcConnectionError connection_error_{};
@@ -1112,6 +1226,9 @@ class DefaultUnsubscribeRequest final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1122,6 +1239,9 @@ class DefaultUnsubscribeRequest final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.DefaultUnsubscribeRequest`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.DefaultUnsubscribeRequest"; }
 
@@ -1172,6 +1292,11 @@ class DefaultUnsubscribeResponse final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -1180,12 +1305,21 @@ class DefaultUnsubscribeResponse final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.DefaultUnsubscribeResponse`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.DefaultUnsubscribeResponse"; }
 
   /// The full name of the message: `horus.pb.DefaultUnsubscribeResponse`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `DefaultUnsubscribeResponse`, e.g. to build a `PbFieldMask<DefaultUnsubscribeResponse>`.
+  enum class Field : PbTag {
+    /// Field `disconnection_error`.
+    kDisconnectionError = 1,
+  };
+
   // Field `disconnection_error` (no 1).
   // -----
 
@@ -1270,6 +1404,10 @@ class DefaultUnsubscribeResponse final : public PbMessage {
     }
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see disconnection_error()
   logs::RpcDisconnectionError disconnection_error_{};
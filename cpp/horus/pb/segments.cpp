@@ -0,0 +1,76 @@
+#include "horus/pb/segments.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <protozero/types.hpp>
+#include <utility>
+#include <vector>
+
+#include "horus/pb/buffer.h"
+#include "horus/pb/types.h"
+#include "horus/strings/string_view.h"
+
+namespace horus {
+namespace {
+
+/// Appends the varint encoding of `value` to `out`.
+void AppendVarint(std::vector<std::uint8_t>& out, std::uint64_t value) noexcept(false) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<std::uint8_t>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<std::uint8_t>(value));
+}
+
+}  // namespace
+
+std::size_t PbSegments::ByteSize() const noexcept {
+  std::size_t size{bytes_.size()};
+  for (const Reference& reference : references_) {
+    size += reference.view.Size();
+  }
+  return size;
+}
+
+std::size_t PbSegments::SegmentCount() const noexcept {
+  std::size_t count{0};
+  ForEachSegment([&count](StringView /* segment */) noexcept { ++count; });
+  return count;
+}
+
+std::vector<StringView> PbSegments::Segments() const noexcept(false) {
+  std::vector<StringView> segments;
+  segments.reserve(references_.size() * 2 + 1);
+  ForEachSegment([&segments](StringView segment) { segments.push_back(segment); });
+  return segments;
+}
+
+std::vector<std::uint8_t> PbSegments::Gather() const& noexcept(false) {
+  std::vector<std::uint8_t> result;
+  result.reserve(ByteSize());
+  ForEachSegment([&result](StringView segment) {
+    static_cast<void>(result.insert(result.end(), segment.begin(), segment.end()));
+  });
+  return result;
+}
+
+std::vector<std::uint8_t> PbSegments::Gather() && noexcept(false) {
+  if (references_.empty()) {
+    return std::move(bytes_);
+  }
+  return Gather();
+}
+
+void PbSegments::AppendLengthDelimited(PbTag tag, const PbSegments& payload) noexcept(false) {
+  AppendVarint(bytes_, protozero::tag_and_type(tag, protozero::pbf_wire_type::length_delimited));
+  AppendVarint(bytes_, payload.ByteSize());
+
+  const std::size_t base_offset{bytes_.size()};
+  static_cast<void>(bytes_.insert(bytes_.end(), payload.bytes_.begin(), payload.bytes_.end()));
+  references_.reserve(references_.size() + payload.references_.size());
+  for (const Reference& reference : payload.references_) {
+    references_.push_back(Reference{base_offset + reference.offset, reference.view});
+  }
+}
+
+}  // namespace horus
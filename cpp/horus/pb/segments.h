@@ -0,0 +1,115 @@
+/// @file
+///
+/// The `PbSegments` class.
+
+#ifndef HORUS_PB_SEGMENTS_H_
+#define HORUS_PB_SEGMENTS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "horus/pb/buffer.h"
+#include "horus/pb/types.h"
+#include "horus/pointer/cast.h"
+#include "horus/strings/string_view.h"
+
+namespace horus {
+
+/// Default minimum size of the `PbView`s referenced (rather than copied) by `PbSegments`.
+///
+/// Below this size, the cost of copying a field is lower than the cost of sending an additional
+/// segment.
+constexpr std::size_t kPbDefaultMinReferenceSize{1024};
+
+/// Options of a `PbWriter` which writes `PbSegments`.
+struct PbSegmentsOptions {
+  /// The minimum size of the shared `PbView`s which are referenced rather than copied.
+  std::size_t min_reference_size{kPbDefaultMinReferenceSize};
+};
+
+/// A serialized Protobuf message split into a list of segments (akin to `iovec`s), some of which
+/// are owned bytes (tags, lengths and small fields) while others reference the shared `PbBuffer`s
+/// of large bytes and packed fields.
+///
+/// Referenced `PbBuffer`s are kept alive by the `PbSegments`, so they can outlive the message they
+/// were serialized from.
+class PbSegments final {
+ public:
+  /// A `PbView` inserted into the owned bytes.
+  struct Reference {
+    /// The offset in the owned bytes at which `view` is inserted.
+    std::size_t offset;
+    /// The referenced bytes.
+    PbView view;
+  };
+
+  /// Constructs an empty list of segments.
+  PbSegments() noexcept = default;
+
+  /// Constructs a list of segments from owned `bytes` into which `references` are inserted, in
+  /// order of increasing `Reference::offset`.
+  PbSegments(std::vector<std::uint8_t>&& bytes, std::vector<Reference>&& references) noexcept
+      : bytes_{std::move(bytes)}, references_{std::move(references)} {}
+
+  /// Returns the total number of bytes in all segments.
+  std::size_t ByteSize() const noexcept;
+
+  /// Returns the number of non-empty segments.
+  std::size_t SegmentCount() const noexcept;
+
+  /// Returns the number of bytes owned by the segments, i.e. which were copied during
+  /// serialization.
+  std::size_t OwnedByteSize() const noexcept { return bytes_.size(); }
+
+  /// Calls `f(StringView)` with each non-empty segment, in order.
+  template <class F>
+  void ForEachSegment(F&& f) const;
+
+  /// Returns the list of non-empty segments, which remain valid as long as `*this` is not modified.
+  std::vector<StringView> Segments() const noexcept(false);
+
+  /// Returns the concatenation of all segments.
+  ///
+  /// @throws std::bad_alloc If the result cannot be allocated.
+  std::vector<std::uint8_t> Gather() const& noexcept(false);
+
+  /// Returns the concatenation of all segments, avoiding a copy if no `PbView` is referenced.
+  ///
+  /// @throws std::bad_alloc If the result cannot be allocated.
+  std::vector<std::uint8_t> Gather() && noexcept(false);
+
+  /// Appends a length-delimited field with the given `tag` whose contents are `payload`.
+  ///
+  /// @throws std::bad_alloc If the segments cannot be reallocated.
+  void AppendLengthDelimited(PbTag tag, const PbSegments& payload) noexcept(false);
+
+ private:
+  /// The owned bytes.
+  std::vector<std::uint8_t> bytes_;
+  /// The `PbView`s inserted into `bytes_`.
+  std::vector<Reference> references_;
+};
+
+template <class F>
+void PbSegments::ForEachSegment(F&& f) const {
+  const StringView bytes{SafePointerCast<char>(bytes_.data()), bytes_.size()};
+  std::size_t offset{0};
+  for (const Reference& reference : references_) {
+    if (reference.offset > offset) {
+      f(bytes.substr(offset, reference.offset - offset));
+    }
+    if (reference.view.Size() > 0) {
+      f(reference.view.Str());
+    }
+    offset = reference.offset;
+  }
+  if (bytes.size() > offset) {
+    f(bytes.substr(offset));
+  }
+}
+
+}  // namespace horus
+
+#endif  // HORUS_PB_SEGMENTS_H_
@@ -0,0 +1,113 @@
+#include "horus/pb/segments.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "horus/pb/buffer.h"
+#include "horus/pb/cow_bytes.h"
+#include "horus/pb/cow_repeated.h"
+#include "horus/pb/cow_span.h"
+#include "horus/pb/serialize.h"
+#include "horus/pb/testing/messages_pb.h"
+#include "horus/pointer/cast.h"
+#include "horus/strings/string_view.h"
+
+namespace horus {
+namespace {
+
+using ::testing::SizeIs;
+
+/// Returns a `TestMessage` with large bytes and packed fields.
+pb::TestMessage MakeLargeMessage(StringView long_string) {
+  std::vector<float> floats(1000);
+  for (std::size_t i{0}; i < floats.size(); ++i) {
+    floats[i] = static_cast<float>(i) * 0.5F;
+  }
+  return pb::TestMessage{}
+      .set_i32(-3)
+      .set_string(CowBytes::OwnedCopy(long_string))
+      .set_submessage(pb::TestMessage::SubMessage{}.set_string(CowBytes::OwnedCopy(long_string)))
+      .set_rep_float(CowSpan<float>{std::move(floats)})
+      .set_rep_submessage(CowRepeated<pb::TestMessage::SubMessage>{}.Add(
+          pb::TestMessage::SubMessage{}.set_string(CowBytes::OwnedCopy("small"))));
+}
+
+TEST(PbSegments, OwnedFieldsAreCopied) {
+  const std::string long_string(2000, 'x');
+  const pb::TestMessage message{MakeLargeMessage(long_string)};
+  const std::vector<std::uint8_t> expected{message.SerializeToBuffer()};
+
+  const PbSegments segments{message.SerializeToSegments()};
+  EXPECT_EQ(segments.ByteSize(), expected.size());
+  EXPECT_EQ(segments.OwnedByteSize(), expected.size());
+  EXPECT_EQ(segments.SegmentCount(), 1);
+  EXPECT_EQ(segments.Gather(), expected);
+}
+
+TEST(PbSegments, SharedViewsAreReferenced) {
+  const std::string long_string(2000, 'x');
+  const std::vector<std::uint8_t> expected{MakeLargeMessage(long_string).SerializeToBuffer()};
+
+  PbReader reader{PbBuffer{std::vector<std::uint8_t>{expected}}};
+  const pb::TestMessage received{reader};
+  const PbSegments segments{received.SerializeToSegments()};
+
+  // `string`, `submessage` (which was never decoded) and `rep_float` are referenced; the small
+  // string is copied.
+  const std::size_t submessage_size{
+      pb::TestMessage::SubMessage{}.set_string(CowBytes::OwnedCopy(long_string)).ByteSizeLong()};
+  EXPECT_EQ(segments.ByteSize(), expected.size());
+  EXPECT_EQ(segments.OwnedByteSize(),
+            expected.size() - 2000 - submessage_size - 1000 * sizeof(float));
+  EXPECT_THAT(segments.Segments(), SizeIs(segments.SegmentCount()));
+  EXPECT_EQ(segments.SegmentCount(), 7);  // 3 references surrounded by 4 owned segments.
+  EXPECT_EQ(segments.Gather(), expected);
+
+  // Referenced buffers are kept alive by the segments.
+  std::vector<std::uint8_t> gathered;
+  {
+    PbReader other_reader{PbBuffer{std::vector<std::uint8_t>{expected}}};
+    gathered = pb::TestMessage{other_reader}.SerializeToSegments().Gather();
+  }
+  EXPECT_EQ(gathered, expected);
+
+  // Nothing is referenced below the threshold.
+  EXPECT_EQ(received.SerializeToSegments(/*min_reference_size=*/1 << 20).SegmentCount(), 1);
+}
+
+TEST(PbSegments, BorrowedViewsAreCopied) {
+  const std::string long_string(2000, 'x');
+  const pb::TestMessage message{pb::TestMessage{}.set_string(CowBytes::Borrowed(long_string))};
+
+  const PbSegments segments{message.SerializeToSegments(/*min_reference_size=*/1)};
+  EXPECT_EQ(segments.SegmentCount(), 1);
+  EXPECT_EQ(segments.Gather(), message.SerializeToBuffer());
+}
+
+TEST(PbSegments, AppendLengthDelimited) {
+  const std::string long_string(2000, 'x');
+  const std::vector<std::uint8_t> inner{MakeLargeMessage(long_string).SerializeToBuffer()};
+  PbReader reader{PbBuffer{std::vector<std::uint8_t>{inner}}};
+  const pb::TestMessage received{reader};
+
+  const pb::TestMessage::SubMessage outer{pb::TestMessage::SubMessage{}.set_u32(7)};
+  PbSegments segments{outer.SerializeToSegments()};
+  segments.AppendLengthDelimited(/*tag=*/1, received.SerializeToSegments());
+
+  PbWriter writer;
+  outer.SerializeTo(writer);
+  writer.Writer().add_bytes(1, SafePointerCast<char>(inner.data()), inner.size());
+  const std::vector<std::uint8_t> expected{std::move(writer).ToVector()};
+
+  EXPECT_EQ(segments.ByteSize(), expected.size());
+  EXPECT_EQ(std::move(segments).Gather(), expected);
+}
+
+}  // namespace
+}  // namespace horus
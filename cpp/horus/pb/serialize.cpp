@@ -8,10 +8,21 @@
 #include <protozero/varint.hpp>
 
 #include "horus/pb/buffer.h"
+#include "horus/pb/segments.h"
 #include "horus/pb/types.h"
 
 namespace horus {
 
+bool PbWriter::TryAddReference(PbTag tag, const PbView& view) noexcept(false) {
+  if (min_reference_size_ == 0 || view.Size() < min_reference_size_ ||
+      !view.Buffer().IsShared()) {
+    return false;
+  }
+  writer_.add_length_varint(tag, static_cast<protozero::pbf_length_type>(view.Size()));
+  references_.push_back(PbSegments::Reference{buffer_.size(), view});
+  return true;
+}
+
 PbView PbReader::ViewIncludingTag(PbTag tag, protozero::data_view view) const noexcept {
   // To get to the view, we first read `tag_and_type` and `view.size()`, both of which are
   // varints.
@@ -23,6 +34,7 @@ PbView PbReader::ViewIncludingTag(PbTag tag, protozero::data_view view) const no
 
   PbView result{buffer_.View(static_cast<std::size_t>(view.data() - buffer_.Str().data()) - skipped,
                              view.size() + skipped)};
+  result.validated_ = validated_;
 
   // Checks that the given `view` points to a length-delimited field with the given `tag` and
   // `view_len`.
@@ -20,7 +20,9 @@
 
 #include "horus/attributes.h"
 #include "horus/pb/buffer.h"
+#include "horus/pb/field_mask.h"
 #include "horus/pb/pbf_buffer_specialization.h"  // IWYU pragma: keep
+#include "horus/pb/segments.h"
 #include "horus/pb/types.h"
 #include "horus/pointer/arithmetic.h"
 
@@ -28,6 +30,31 @@ namespace horus {
 
 class PbMessage;
 
+namespace horus_internal {
+
+/// Returns the number of bytes used to encode `value` as a varint.
+constexpr std::size_t PbVarintSize(std::uint64_t value) noexcept {
+  std::size_t size{1};
+  while (value >= 0x80) {
+    value >>= 7;
+    ++size;
+  }
+  return size;
+}
+
+/// Returns the number of bytes used to encode the key of a field with the given `tag`.
+constexpr std::size_t PbTagSize(PbTag tag) noexcept {
+  return PbVarintSize(static_cast<std::uint64_t>(tag) << 3);
+}
+
+/// Returns the number of bytes used to encode a length-delimited field with the given `tag` and
+/// `length`.
+constexpr std::size_t PbLengthDelimitedSize(PbTag tag, std::size_t length) noexcept {
+  return PbTagSize(tag) + PbVarintSize(length) + length;
+}
+
+}  // namespace horus_internal
+
 /// Helper class used to deserialize Protobuf messages from a `PbBuffer`.
 class PbReader final {
  public:
@@ -36,7 +63,7 @@ class PbReader final {
       : buffer_{std::move(buffer)}, reader_{buffer_.Str().data(), buffer_.Str().size()} {}
 
   /// Constructs a `PbReader` which deserializes from `view`.
-  explicit PbReader(PbView&& view) noexcept : buffer_{}, reader_{} {
+  explicit PbReader(PbView&& view) noexcept : buffer_{}, reader_{}, validated_{view.IsValidated()} {
     std::size_t const offset{view.Offset()};
     std::size_t const size{view.Size()};
     buffer_ = std::move(view).Buffer();  // NOLINT(*-prefer-member-initializer): cannot due to move
@@ -45,7 +72,9 @@ class PbReader final {
 
   /// Constructs a `PbReader` which deserializes a submessage of `parent`.
   PbReader(PbReader& parent, PbTag /* tag */) noexcept
-      : buffer_{parent.buffer_}, reader_{parent.reader_.get_message()} {}
+      : buffer_{parent.buffer_},
+        reader_{parent.reader_.get_message()},
+        validated_{parent.validated_} {}
 
   // We disallow copies and moves since `reader_` refers to `buffer_`.
 
@@ -71,6 +100,37 @@ class PbReader final {
   /// for documentation.
   constexpr protozero::pbf_reader& Reader() noexcept { return reader_; }
 
+  /// Returns whether the message being read comes from a view checked by `PbView::Validate()`.
+  constexpr bool IsValidated() const noexcept { return validated_; }
+
+  /// Skips the fields of the message being read which are skipped by `mask`, which must outlive
+  /// this reader, when they are reached with `NextField()`. Submessages are not affected.
+  template <class T>
+  void SetFieldMask(const PbFieldMask<T>& mask HORUS_LIFETIME_BOUND) noexcept {
+    SetSkippedTags(mask.SkippedTags());
+  }
+
+  /// Same as `SetFieldMask()`, but given the untyped `SkippedTags()` of a `PbFieldMask`.
+  void SetSkippedTags(
+      const horus_internal::PbSkippedTags& skipped_tags HORUS_LIFETIME_BOUND) noexcept {
+    skipped_tags_ = skipped_tags.IsEmpty() ? nullptr : &skipped_tags;
+  }
+
+  /// Moves to the next field of the message which is not skipped by the mask given to
+  /// `SetFieldMask()`, skipping the others. Returns false at the end of the message.
+  bool NextField() noexcept(false) {
+    if (skipped_tags_ == nullptr) {
+      return reader_.next();
+    }
+    while (reader_.next()) {
+      if (!skipped_tags_->Contains(reader_.tag())) {
+        return true;
+      }
+      reader_.skip();
+    }
+    return false;
+  }
+
   /// Returns a `PbView` which wraps the entire view.
   PbView View() const noexcept {
     return buffer_.View(static_cast<std::size_t>(reader_.data().data() - buffer_.Str().data()),
@@ -82,6 +142,17 @@ class PbReader final {
     return buffer_.View(static_cast<std::size_t>(view.data() - buffer_.Str().data()), view.size());
   }
 
+  /// Returns a `PbView` which wraps the value of the current field, represented by `view`, and
+  /// which is validated if the message being read is.
+  ///
+  /// Unlike `View()`, this must not be used for bytes fields, whose contents are not checked by
+  /// `PbView::Validate()`.
+  PbView FieldView(protozero::data_view view) const noexcept {
+    PbView result{View(view)};
+    result.validated_ = validated_;
+    return result;
+  }
+
   /// Returns a `PbView` which wraps the given tag followed by the bytes, string or message
   /// represented by `view`.
   PbView ViewIncludingTag(PbTag tag, protozero::data_view view) const noexcept;
@@ -96,6 +167,10 @@ class PbReader final {
  private:
   PbBuffer buffer_;
   protozero::pbf_reader reader_;
+  /// The tags skipped by `NextField()`, or null if no field is skipped.
+  const horus_internal::PbSkippedTags* skipped_tags_{nullptr};
+  /// @see IsValidated()
+  bool validated_{false};
 };
 
 /// Helper class used to serialize Protobuf messages to a `PbBuffer`.
@@ -117,6 +192,29 @@ class PbWriter final {
     buffer_.reserve(initial_capacity);
   }
 
+  /// Constructs a `PbWriter` which will append `byte_size` bytes to the given `output`, `byte_size`
+  /// being the sum of `PbMessage::ByteSizeLong()` of the messages which will be written.
+  ///
+  /// Since the sizes of all submessages are then cached, they are written with their length prefix
+  /// directly rather than with a placeholder which is shrunk (moving the submessage) once the
+  /// submessage was written.
+  PbWriter(Buffer&& output, std::size_t byte_size) noexcept(false)
+      : buffer_{std::move(output)}, writer_{buffer_}, uses_cached_sizes_{true} {
+    buffer_.reserve(buffer_.size() + byte_size);
+  }
+
+  /// Constructs a `PbWriter` whose output is obtained with `ToSegments()`, and in which bytes and
+  /// packed fields which refer to shared `PbView`s of at least `options.min_reference_size` bytes
+  /// are referenced rather than copied.
+  ///
+  /// As with `PbWriter(Buffer&&, std::size_t)`, the sizes of the written messages must have been
+  /// computed by `PbMessage::ByteSizeLong()` so that no written bytes are moved afterwards.
+  explicit PbWriter(const PbSegmentsOptions& options) noexcept
+      : writer_{buffer_},
+        uses_cached_sizes_{true},
+        // Empty views are always copied since they are written as an empty field.
+        min_reference_size_{options.min_reference_size == 0 ? 1 : options.min_reference_size} {}
+
   /// Constructs a `PbWriter` used to encode a submessage in `parent`.
   PbWriter(PbWriter& parent, PbTag tag) noexcept : writer_{parent.writer_, tag} {}
 
@@ -141,17 +239,41 @@ class PbWriter final {
   /// for documentation.
   constexpr PbfWriter& Writer() & noexcept HORUS_LIFETIME_BOUND { return writer_; }
 
+  /// Returns whether the sizes of the messages written to this writer were computed by
+  /// `PbMessage::ByteSizeLong()`, and can therefore be obtained with `PbMessage::CachedByteSize()`.
+  constexpr bool UsesCachedSizes() const noexcept { return uses_cached_sizes_; }
+
+  /// Writes a length-delimited field with the given `tag` whose contents are `view`, referencing
+  /// `view` rather than copying it if this writer was constructed with
+  /// `PbWriter(const PbSegmentsOptions&)`, `view` is large enough and its buffer is shared.
+  ///
+  /// Returns false (writing nothing) if `view` cannot be referenced, in which case the caller
+  /// should write it as usual.
+  bool TryAddReference(PbTag tag, const PbView& view) noexcept(false);
+
   /// Returns the resulting string.
   Buffer ToVector() && noexcept { return std::move(buffer_); }
 
   /// Returns the resulting buffer as a `PbBuffer`.
   PbBuffer ToBuffer() && noexcept(false) { return PbBuffer{std::move(buffer_)}; }
 
+  /// Returns the resulting segments, which include the views added with `TryAddReference()`.
+  PbSegments ToSegments() && noexcept {
+    return PbSegments{std::move(buffer_), std::move(references_)};
+  }
+
  private:
   /// The output string buffer.
   Buffer buffer_;
   /// The output `pbf_writer`.
   PbfWriter writer_;
+  /// Whether the sizes of messages were cached by `PbMessage::ByteSizeLong()`.
+  bool uses_cached_sizes_{false};
+  /// The minimum size of the views referenced by `TryAddReference()`, or 0 if views are never
+  /// referenced.
+  std::size_t min_reference_size_{0};
+  /// The views referenced by `TryAddReference()`.
+  std::vector<PbSegments::Reference> references_;
 };
 
 /// Compile-time flags for Protobuf deserialization.
@@ -174,12 +296,31 @@ class PbTraits final {
       // protozero does not write anything for empty messages, but if `Serialize()` was called our
       // caller definitely wants something written, so we'll write an empty message manually.
       writer.Writer().add_message(tag, "", 0);
+    } else if (writer.UsesCachedSizes()) {
+      std::size_t size{message.CachedByteSize()};
+      if (size == 0) {
+        // The size was not cached, e.g. because `message` was deserialized on the fly from a
+        // `PbView` when iterating over a `CowRepeated`.
+        size = message.ByteSizeLong();
+      }
+      writer.Writer().add_length_varint(tag, static_cast<protozero::pbf_length_type>(size));
+      message.SerializeTo(writer);
     } else {
       PbWriter for_message{writer, tag};
       message.SerializeTo(for_message);
     }
   }
 
+  /// Returns the number of bytes used to serialize `message`, caching its size.
+  static std::size_t ByteSize(PbTag tag, const T& message) {
+    static_assert(std::is_base_of<PbMessage, T>::value, "PbTraits<T> is not defined for T");
+
+    if (message.IsEmpty()) {
+      return horus_internal::PbLengthDelimitedSize(tag, 0);
+    }
+    return horus_internal::PbLengthDelimitedSize(tag, message.ByteSizeLong());
+  }
+
   /// Deserializes a `T` from `reader`.
   static void Deserialize(PbReader& reader, T& message) {
     static_assert(std::is_base_of<PbMessage, T>::value, "PbTraits<T> is not defined for T");
@@ -197,6 +338,11 @@ class PbTraits<std::uint32_t> final {
     writer.Writer().add_uint32(tag, value);
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, std::uint32_t value) noexcept {
+    return horus_internal::PbTagSize(tag) + horus_internal::PbVarintSize(value);
+  }
+
   /// Deserializes a `std::uint32_t` from `reader`.
   static std::uint32_t Deserialize(PbReader& reader) { return reader.Reader().get_uint32(); }
 };
@@ -209,6 +355,11 @@ class PbTraits<std::uint32_t, PbDeserFlags::kFixed> final {
     writer.Writer().add_fixed32(tag, value);
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, std::uint32_t /* value */) noexcept {
+    return horus_internal::PbTagSize(tag) + sizeof(std::uint32_t);
+  }
+
   /// Deserializes a `std::uint32_t` from `reader`.
   static std::uint32_t Deserialize(PbReader& reader) { return reader.Reader().get_fixed32(); }
 };
@@ -221,6 +372,13 @@ class PbTraits<std::int32_t> final {
     writer.Writer().add_int32(tag, value);
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, std::int32_t value) noexcept {
+    // Negative values are sign-extended to 64 bits, and therefore always use 10 bytes.
+    return horus_internal::PbTagSize(tag) +
+           horus_internal::PbVarintSize(static_cast<std::uint64_t>(value));
+  }
+
   /// Deserializes a `std::int32_t` from `reader`.
   static std::int32_t Deserialize(PbReader& reader) { return reader.Reader().get_int32(); }
 };
@@ -233,6 +391,11 @@ class PbTraits<std::int32_t, PbDeserFlags::kFixed> final {
     writer.Writer().add_sfixed32(tag, value);
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, std::int32_t /* value */) noexcept {
+    return horus_internal::PbTagSize(tag) + sizeof(std::int32_t);
+  }
+
   /// Deserializes a `std::int32_t` from `reader`.
   static std::int32_t Deserialize(PbReader& reader) { return reader.Reader().get_sfixed32(); }
 };
@@ -245,6 +408,11 @@ class PbTraits<std::uint64_t> final {
     writer.Writer().add_uint64(tag, value);
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, std::uint64_t value) noexcept {
+    return horus_internal::PbTagSize(tag) + horus_internal::PbVarintSize(value);
+  }
+
   /// Deserializes a `std::uint64_t` from `reader`.
   static std::uint64_t Deserialize(PbReader& reader) { return reader.Reader().get_uint64(); }
 };
@@ -257,6 +425,11 @@ class PbTraits<std::uint64_t, PbDeserFlags::kFixed> final {
     writer.Writer().add_fixed64(tag, value);
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, std::uint64_t /* value */) noexcept {
+    return horus_internal::PbTagSize(tag) + sizeof(std::uint64_t);
+  }
+
   /// Deserializes a `std::uint64_t` from `reader`.
   static std::uint64_t Deserialize(PbReader& reader) { return reader.Reader().get_fixed64(); }
 };
@@ -269,6 +442,13 @@ class PbTraits<std::int64_t> final {
     writer.Writer().add_int64(tag, value);
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, std::int64_t value) noexcept {
+    // Negative values are sign-extended to 64 bits, and therefore always use 10 bytes.
+    return horus_internal::PbTagSize(tag) +
+           horus_internal::PbVarintSize(static_cast<std::uint64_t>(value));
+  }
+
   /// Deserializes a `std::int64_t` from `reader`.
   static std::int64_t Deserialize(PbReader& reader) { return reader.Reader().get_int64(); }
 };
@@ -281,6 +461,11 @@ class PbTraits<std::int64_t, PbDeserFlags::kFixed> final {
     writer.Writer().add_sfixed64(tag, value);
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, std::int64_t /* value */) noexcept {
+    return horus_internal::PbTagSize(tag) + sizeof(std::int64_t);
+  }
+
   /// Deserializes a `std::int64_t` from `reader`.
   static std::int64_t Deserialize(PbReader& reader) { return reader.Reader().get_sfixed64(); }
 };
@@ -293,6 +478,11 @@ class PbTraits<bool> final {
     writer.Writer().add_bool(tag, value);
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, bool /* value */) noexcept {
+    return horus_internal::PbTagSize(tag) + 1;
+  }
+
   /// Deserializes a `bool` from `reader`.
   static bool Deserialize(PbReader& reader) { return reader.Reader().get_bool(); }
 };
@@ -305,6 +495,11 @@ class PbTraits<float, PbDeserFlags::kFixed> final {
     writer.Writer().add_float(tag, value);
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, float /* value */) noexcept {
+    return horus_internal::PbTagSize(tag) + sizeof(float);
+  }
+
   /// Deserializes a `float` from `reader`.
   static float Deserialize(PbReader& reader) { return reader.Reader().get_float(); }
 };
@@ -317,6 +512,11 @@ class PbTraits<double, PbDeserFlags::kFixed> final {
     writer.Writer().add_double(tag, value);
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, double /* value */) noexcept {
+    return horus_internal::PbTagSize(tag) + sizeof(double);
+  }
+
   /// Deserializes a `double` from `reader`.
   static double Deserialize(PbReader& reader) { return reader.Reader().get_double(); }
 };
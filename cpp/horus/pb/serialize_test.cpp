@@ -193,5 +193,49 @@ TEST(Serialize, AllFields) {
       });
 }
 
+/// Serializes `message` to a growing buffer, without computing its size first.
+std::vector<std::uint8_t> SerializeWithoutByteSize(const pb::TestMessage& message) {
+  PbWriter writer;
+  message.SerializeTo(writer);
+  return std::move(writer).ToVector();
+}
+
+TEST(Serialize, ByteSizeLong) {
+  const std::string long_string(300, 'x');
+  pb::TestMessage message;
+  message.set_i32(-3)
+      .set_string(CowBytes::Borrowed(long_string))
+      .set_submessage(
+          pb::TestMessage::SubMessage{}.set_i32(-42).set_string(CowBytes::Borrowed(long_string)))
+      .set_oneof_submessage(pb::TestMessage::SubMessage{})
+      .set_rep_i32(CowRepeated<std::int32_t>{-2, 3, 300})
+      .set_rep_bool(CowRepeated<bool>{})
+      .set_rep_submessage(CowRepeated<pb::TestMessage::SubMessage>{}
+                              .Add(pb::TestMessage::SubMessage{}.set_u32(1 << 20))
+                              .Add());
+
+  const std::vector<std::uint8_t> expected{SerializeWithoutByteSize(message)};
+  EXPECT_EQ(message.CachedByteSize(), 0);
+  EXPECT_EQ(message.ByteSizeLong(), expected.size());
+  EXPECT_EQ(message.CachedByteSize(), expected.size());
+  EXPECT_EQ(message.SerializeToBuffer(), expected);
+
+  // Serializing a message which references a `PbView` computes the sizes of its repeated
+  // submessages on the fly.
+  PbReader reader{PbBuffer{std::vector<std::uint8_t>{expected}}};
+  const pb::TestMessage deserialized{reader};
+  EXPECT_EQ(deserialized.SerializeToBuffer(), expected);
+
+  // Serializing to a non-empty buffer appends to it.
+  std::vector<std::uint8_t> buffer{1, 2, 3};
+  message.SerializeToBuffer(buffer);
+  EXPECT_EQ(buffer.size(), 3 + expected.size());
+  EXPECT_EQ(std::vector<std::uint8_t>(buffer.begin() + 3, buffer.end()), expected);
+
+  // Copies do not share the cached size.
+  const pb::TestMessage copy{message};
+  EXPECT_EQ(copy.CachedByteSize(), 0);
+}
+
 }  // namespace
 }  // namespace horus
@@ -8,13 +8,16 @@
 /// Generated by `/opt/actions-runner/_work/horus/horus/common/tools/sdk/pb.ts`.
 
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
 #include "horus/attributes.h"
 #include "horus/internal/attributes.h"
+#include "horus/pb/lazy.h"
 #include "horus/pb/message.h"
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 #include "horus/pb/status_service/messages_pb.h"
 #include "horus/strings/string_view.h"
 
@@ -75,6 +78,9 @@ class GetVersionRequest final : public PbMessage {
     static_cast<void>(writer);
   }
 
+  /// Returns the number of bytes used to serialize the message, which has no fields.
+  std::size_t ByteSizeLong() const noexcept(false) final { return 0; }
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -85,6 +91,9 @@ class GetVersionRequest final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears the message, which has no fields.
+  void Clear() noexcept final {}
+
   /// The full name of the message: `horus.pb.GetVersionRequest`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.GetVersionRequest"; }
 
@@ -135,6 +144,11 @@ class GetVersionResponse final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -143,20 +157,33 @@ class GetVersionResponse final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.GetVersionResponse`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.GetVersionResponse"; }
 
   /// The full name of the message: `horus.pb.GetVersionResponse`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `GetVersionResponse`, e.g. to build a `PbFieldMask<GetVersionResponse>`.
+  enum class Field : PbTag {
+    /// Field `version`.
+    kVersion = 1,
+  };
+
   // Field `version` (no 1).
   // -----
 
   /// No documentation.
   ///
   /// Field no: 1.
-  constexpr const Version& version() const& noexcept HORUS_LIFETIME_BOUND {
-    return version_;
+  ///
+  /// If `version` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `version` was received and is not a valid message.
+  const Version& version() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return version_.Ref();
   }
 
   /// If `version` is set, moves it out of the message (without marking it as unset).
@@ -164,19 +191,23 @@ class GetVersionResponse final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 1.
-  Version version() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `version` was received and is not a valid message.
+  Version version() && noexcept(false) {
     if (!set_fields_[0]) {
       return {};
     }
-    return std::move(version_);
+    return std::move(version_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 1.
-  Version& mutable_version() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `version` was received and is not a valid message.
+  Version& mutable_version() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[0] = true;
-    return version_;
+    return version_.Mutable();
   }
 
   /// Returns whether `version` (no 1) is set.
@@ -185,13 +216,13 @@ class GetVersionResponse final : public PbMessage {
   /// Clears `version` (no 1).
   void clear_version() & noexcept {
     set_fields_[0] = false;
-    version_ = {};
+    version_.Clear();
   }
 
   /// Sets `version` (no 1) and returns `*this`.
   GetVersionResponse& set_version(Version&& version) & noexcept {
     set_fields_[0] = true;
-    version_ = std::move(version);
+    version_.Set(std::move(version));
     return *this;
   }
   /// Sets `version` (no 1) and returns `*this`.
@@ -199,9 +230,13 @@ class GetVersionResponse final : public PbMessage {
     return std::move(set_version(std::move(version)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see version()
-  Version version_{};
+  PbLazy<Version> version_{};
 
   /// The set of fields that have been given an explicit value.
   std::bitset<1> set_fields_;
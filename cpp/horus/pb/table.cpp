@@ -0,0 +1,130 @@
+#include "horus/pb/table.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <protozero/types.hpp>
+
+#include "horus/pb/types.h"
+#include "horus/pointer/arithmetic.h"
+#include "horus/strings/string_view.h"
+
+namespace horus {
+namespace horus_internal {
+
+namespace {
+
+/// Largest valid field number.
+constexpr std::uint64_t kMaxTag{(std::uint64_t{1} << 29U) - 1};
+/// First field number reserved by the Protobuf implementation.
+constexpr std::uint64_t kFirstReservedTag{19000};
+/// Last field number reserved by the Protobuf implementation.
+constexpr std::uint64_t kLastReservedTag{19999};
+
+/// Reads the varint at `pos` into `value` and advances `pos` past it. Returns false if the varint
+/// is truncated by `end` or longer than 10 bytes.
+inline bool ReadVarint(const char*& pos, const char* end, std::uint64_t& value) noexcept {
+  // Most varints in messages (keys, lengths, small values) fit in a single byte.
+  if (pos != end && (static_cast<std::uint8_t>(*pos) & 0x80U) == 0) {
+    value = static_cast<std::uint8_t>(*pos);
+    pos = PointerAdd(pos, 1);
+    return true;
+  }
+  value = 0;
+  for (unsigned shift{0}; shift < 70 && pos != end; shift += 7) {
+    const std::uint64_t byte{static_cast<std::uint8_t>(*pos)};
+    pos = PointerAdd(pos, 1);
+    value |= (byte & 0x7FU) << shift;
+    if ((byte & 0x80U) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+constexpr std::size_t PbMessageTable::kNotFound;
+
+std::size_t PbMessageTable::FindSlow(PbTag tag) const noexcept {
+  const std::size_t numbered_index{static_cast<std::size_t>(tag) - 1};
+  if (tag != 0 && numbered_index < size_ && (*this)[numbered_index].tag == tag) {
+    return numbered_index;
+  }
+  for (std::size_t i{0}; i < size_; ++i) {
+    if ((*this)[i].tag == tag) {
+      return i;
+    }
+  }
+  return kNotFound;
+}
+
+bool PbTableValidate(const PbMessageTable& table, StringView data, std::size_t depth) noexcept {
+  if (depth > kPbMaxValidationDepth) {
+    return false;
+  }
+  const char* pos{data.data()};
+  const char* const end{PointerAdd(data.data(), data.size())};
+  std::size_t hint{0};
+  while (pos != end) {
+    std::uint64_t key{0};
+    if (!ReadVarint(pos, end, key)) {
+      return false;
+    }
+    const std::uint64_t tag{key >> 3U};
+    // Tags rejected by protozero.
+    if (tag == 0 || tag > kMaxTag || (tag >= kFirstReservedTag && tag <= kLastReservedTag)) {
+      return false;
+    }
+    const auto wire_type{static_cast<protozero::pbf_wire_type>(key & 0x07U)};
+    const std::size_t index{table.Find(static_cast<PbTag>(tag), hint)};
+    const PbFieldOps* const ops{index == PbMessageTable::kNotFound ? nullptr : table[index].ops};
+    if (ops != nullptr && wire_type != ops->wire_type) {
+      return false;
+    }
+
+    switch (wire_type) {
+      case protozero::pbf_wire_type::varint: {
+        std::uint64_t value{0};
+        if (!ReadVarint(pos, end, value)) {
+          return false;
+        }
+        break;
+      }
+      case protozero::pbf_wire_type::fixed64:
+      case protozero::pbf_wire_type::fixed32: {
+        const std::size_t size{wire_type == protozero::pbf_wire_type::fixed64
+                                   ? sizeof(std::uint64_t)
+                                   : sizeof(std::uint32_t)};
+        if (PointerDist(pos, end) < size) {
+          return false;
+        }
+        pos = PointerAdd(pos, size);
+        break;
+      }
+      case protozero::pbf_wire_type::length_delimited: {
+        std::uint64_t size{0};
+        if (!ReadVarint(pos, end, size) || PointerDist(pos, end) < size) {
+          return false;
+        }
+        const StringView value{pos, static_cast<std::size_t>(size)};
+        if (ops != nullptr && !ops->validate(value, depth)) {
+          return false;
+        }
+        pos = PointerAdd(pos, value.size());
+        break;
+      }
+      case protozero::pbf_wire_type::unknown:
+      default: {
+        // Groups are not supported.
+        return false;
+      }
+    }
+    if (ops != nullptr) {
+      hint = index + 1;
+    }
+  }
+  return true;
+}
+
+}  // namespace horus_internal
+}  // namespace horus
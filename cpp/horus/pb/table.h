@@ -0,0 +1,412 @@
+/// @file
+///
+/// The table-driven engine used by generated messages to (de)serialize, clear and validate their
+/// fields.
+
+#ifndef HORUS_PB_TABLE_H_
+#define HORUS_PB_TABLE_H_
+
+#include <bitset>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <protozero/types.hpp>
+#include <type_traits>
+#include <utility>
+
+#include "horus/internal/type_traits.h"
+#include "horus/pb/cow_bytes.h"
+#include "horus/pb/cow_repeated.h"
+#include "horus/pb/cow_span.h"
+#include "horus/pb/lazy.h"
+#include "horus/pb/serialize.h"
+#include "horus/pb/types.h"
+#include "horus/pb/varint.h"
+#include "horus/pointer/arithmetic.h"
+#include "horus/strings/string_view.h"
+
+namespace horus {
+namespace horus_internal {
+
+/// The functions which (de)serialize and clear fields of a given type, shared by all the fields of
+/// this type in all generated messages.
+struct PbFieldOps final {
+  /// Serializes the field at `field` into `writer`.
+  void (*serialize)(PbWriter& writer, PbTag tag, const void* field);
+  /// Returns the number of bytes used to serialize the field at `field`.
+  std::size_t (*byte_size)(PbTag tag, const void* field);
+  /// Deserializes the field at `field` from `reader`.
+  void (*deserialize)(PbReader& reader, void* field);
+  /// Clears the field at `field`, keeping the capacity of its owned buffers.
+  void (*clear)(void* field);
+  /// The wire type of the field.
+  protozero::pbf_wire_type wire_type;
+  /// Returns whether `value`, the value of a length-delimited field nested `depth` messages deep,
+  /// is valid.
+  bool (*validate)(StringView value, std::size_t depth);
+};
+
+class PbMessageTable;
+
+/// Maximum nesting depth of the messages checked by `PbTableValidate()`.
+constexpr std::size_t kPbMaxValidationDepth{100};
+
+/// Returns whether `data` is a valid serialized message described by `table`, nested `depth`
+/// messages deep.
+///
+/// Fields of the message must have the wire type of their `PbFieldOps`, and the values of
+/// length-delimited fields are checked recursively. Unknown fields are skipped.
+bool PbTableValidate(const PbMessageTable& table, StringView data, std::size_t depth) noexcept;
+
+/// Returns the table of message `T`, or an empty table if `T` has no fields.
+template <class T, class Enable = void>
+class PbTableOf final {
+ public:
+  /// Returns an empty table.
+  static const PbMessageTable& Get() noexcept;
+};
+
+/// Returns the table of message `T`.
+template <class T>
+class PbTableOf<T, VoidT<decltype(T::Table())>> final {
+ public:
+  /// Returns `T::Table()`.
+  static const PbMessageTable& Get() noexcept { return T::Table(); }
+};
+
+/// Defines the wire type of fields of type `T`, (de)serialized with `PbTraits<T, kFlags>`, and how
+/// their values are validated. By default, `T` is a message.
+template <class T, PbDeserFlags kFlags = PbDeserFlags::kNone, class Enable = void>
+class PbFieldValidator final {
+ public:
+  /// The wire type of the field.
+  static constexpr protozero::pbf_wire_type kWireType{protozero::pbf_wire_type::length_delimited};
+
+  /// Returns whether `value` is a valid serialized `T`.
+  static bool Validate(StringView value, std::size_t depth) noexcept {
+    return PbTableValidate(PbTableOf<T>::Get(), value, depth + 1);
+  }
+};
+
+/// Scalars are varints, unless they are fixed-size.
+template <class T, PbDeserFlags kFlags>
+class PbFieldValidator<T, kFlags,
+                       std::enable_if_t<std::is_arithmetic<T>::value || std::is_enum<T>::value>>
+    final {
+ public:
+  /// The wire type of the field.
+  static constexpr protozero::pbf_wire_type kWireType{
+      kFlags == PbDeserFlags::kNone ? protozero::pbf_wire_type::varint
+      : sizeof(T) == sizeof(std::uint32_t) ? protozero::pbf_wire_type::fixed32
+                                           : protozero::pbf_wire_type::fixed64};
+
+  /// Never called, since scalars are not length-delimited.
+  static bool Validate(StringView /* value */, std::size_t /* depth */) noexcept { return true; }
+};
+
+/// Bytes and strings may hold anything.
+template <>
+class PbFieldValidator<CowBytes> final {
+ public:
+  /// The wire type of the field.
+  static constexpr protozero::pbf_wire_type kWireType{protozero::pbf_wire_type::length_delimited};
+
+  /// Returns true.
+  static bool Validate(StringView /* value */, std::size_t /* depth */) noexcept { return true; }
+};
+
+/// Packed fixed-size scalars must fill their value.
+template <class T>
+class PbFieldValidator<CowSpan<T>, PbDeserFlags::kFixed> final {
+ public:
+  /// The wire type of the field.
+  static constexpr protozero::pbf_wire_type kWireType{protozero::pbf_wire_type::length_delimited};
+
+  /// Returns whether `value` holds a whole number of `T`s.
+  static bool Validate(StringView value, std::size_t /* depth */) noexcept {
+    return value.size() % sizeof(T) == 0;
+  }
+};
+
+/// Packed varints must be complete.
+template <class T>
+class PbFieldValidator<CowRepeated<T, /*kPacked=*/true>> final {
+ public:
+  /// The wire type of the field.
+  static constexpr protozero::pbf_wire_type kWireType{protozero::pbf_wire_type::length_delimited};
+
+  /// Returns whether `value` holds valid varints.
+  static bool Validate(StringView value, std::size_t /* depth */) noexcept {
+    return ValidateVarints(value);
+  }
+};
+
+/// Non-packed repeated fields are validated item by item.
+template <class T>
+class PbFieldValidator<CowRepeated<T, /*kPacked=*/false>> final {
+ public:
+  /// The wire type of the field.
+  static constexpr protozero::pbf_wire_type kWireType{PbFieldValidator<T>::kWireType};
+
+  /// Returns whether `value` is a valid item.
+  static bool Validate(StringView value, std::size_t depth) noexcept {
+    return PbFieldValidator<T>::Validate(value, depth);
+  }
+};
+
+/// Lazy submessages are validated eagerly, so that they can be decoded without checks.
+template <class T>
+class PbFieldValidator<PbLazy<T>> final {
+ public:
+  /// The wire type of the field.
+  static constexpr protozero::pbf_wire_type kWireType{protozero::pbf_wire_type::length_delimited};
+
+  /// Returns whether `value` is a valid serialized `T`.
+  static bool Validate(StringView value, std::size_t depth) noexcept {
+    return PbFieldValidator<T>::Validate(value, depth);
+  }
+};
+
+/// Defines the `PbFieldOps` of fields of type `T`, (de)serialized with `PbTraits<T, kFlags>`.
+template <class T, PbDeserFlags kFlags = PbDeserFlags::kNone>
+class PbFieldOpsFor final {
+ public:
+  /// Serializes the `T` at `field` into `writer`.
+  static void Serialize(PbWriter& writer, PbTag tag, const void* field) {
+    PbTraits<T, kFlags>::Serialize(writer, tag, *static_cast<const T*>(field));
+  }
+
+  /// Returns the number of bytes used to serialize the `T` at `field`.
+  static std::size_t ByteSize(PbTag tag, const void* field) {
+    return PbTraits<T, kFlags>::ByteSize(tag, *static_cast<const T*>(field));
+  }
+
+  /// Deserializes the `T` at `field` from `reader`.
+  static void Deserialize(PbReader& reader, void* field) {
+    DeserializeInto(reader, *static_cast<T*>(field));
+  }
+
+  /// Clears the `T` at `field`.
+  static void Clear(void* field) { ClearValue(*static_cast<T*>(field)); }
+
+  /// The operations on fields of type `T`.
+  static constexpr PbFieldOps kOps{&Serialize,
+                                   &ByteSize,
+                                   &Deserialize,
+                                   &Clear,
+                                   PbFieldValidator<T, kFlags>::kWireType,
+                                   &PbFieldValidator<T, kFlags>::Validate};
+
+ private:
+  /// Deserializes `value` in-place.
+  template <class U, decltype(PbTraits<U, kFlags>::Deserialize(std::declval<PbReader&>(),
+                                                               std::declval<U&>()))* = nullptr>
+  static void DeserializeInto(PbReader& reader, U& value) {
+    PbTraits<U, kFlags>::Deserialize(reader, value);
+  }
+
+  /// Deserializes a value and assigns it to `value`.
+  template <class U,
+            decltype(PbTraits<U, kFlags>::Deserialize(std::declval<PbReader&>()))* = nullptr>
+  static void DeserializeInto(PbReader& reader, U& value) {
+    value = PbTraits<U, kFlags>::Deserialize(reader);
+  }
+
+  /// Clears a scalar value.
+  template <class U,
+            std::enable_if_t<std::is_arithmetic<U>::value || std::is_enum<U>::value>* = nullptr>
+  static void ClearValue(U& value) noexcept {
+    value = {};
+  }
+
+  /// Clears a bytes, repeated or message value, keeping the capacity of its owned buffers.
+  template <class U,
+            std::enable_if_t<!std::is_arithmetic<U>::value && !std::is_enum<U>::value>* = nullptr>
+  static void ClearValue(U& value) noexcept {
+    value.Clear();
+  }
+};
+
+template <class T, PbDeserFlags kFlags>
+constexpr PbFieldOps PbFieldOpsFor<T, kFlags>::kOps;
+
+/// Describes a field of a generated message.
+struct PbFieldDescriptor final {
+  /// The field number.
+  PbTag tag;
+  /// The offset of the field in the message.
+  std::uint32_t offset;
+  /// The offset of the case of the oneof containing the field (a `std::uint32_t` enum whose values
+  /// are field numbers), or 0 if the field is not part of a oneof.
+  std::uint32_t oneof_offset;
+  /// The operations on the field.
+  const PbFieldOps* ops;
+};
+
+/// Describes the fields of a generated message, in the order of their bits in its `set_fields_`.
+///
+/// Tables are generated as `constexpr` arrays, so that the code (de)serializing messages is shared
+/// by all messages rather than generated for each of them.
+class PbMessageTable final {
+ public:
+  /// Returned by `Find()` if there is no field with the given number.
+  static constexpr std::size_t kNotFound{~std::size_t{0}};
+
+  /// Constructs a table which describes no fields, i.e. the table of a message without fields.
+  constexpr PbMessageTable() noexcept : fields_{nullptr}, size_{0} {}
+
+  /// Constructs a table which describes `fields`.
+  template <std::size_t N>
+  constexpr explicit PbMessageTable(const PbFieldDescriptor (&fields)[N]) noexcept  // NOLINT(*-c-arrays)
+      : fields_{fields}, size_{N} {}
+
+  /// Returns the number of fields.
+  constexpr std::size_t Size() const noexcept { return size_; }
+
+  /// Returns the descriptor of the field at `index`, which must be less than `Size()`.
+  constexpr const PbFieldDescriptor& operator[](std::size_t index) const noexcept {
+    return *PointerAdd(fields_, index);
+  }
+
+  /// Returns the index of the field numbered `tag`, or `kNotFound`.
+  ///
+  /// Since fields are usually serialized in order, `hint` (the index following the last field
+  /// found) is tried first, then the index which the field would have if fields were numbered
+  /// from 1, and finally all fields.
+  std::size_t Find(PbTag tag, std::size_t hint) const noexcept {
+    if (hint < size_ && (*this)[hint].tag == tag) {
+      return hint;
+    }
+    return FindSlow(tag);
+  }
+
+ private:
+  /// Returns the index of the field numbered `tag` when it does not follow the previous field.
+  std::size_t FindSlow(PbTag tag) const noexcept;
+
+  /// The descriptors of the fields.
+  const PbFieldDescriptor* fields_;
+  /// The number of fields.
+  std::size_t size_;
+};
+
+// static
+template <class T, class Enable>
+const PbMessageTable& PbTableOf<T, Enable>::Get() noexcept {
+  static constexpr PbMessageTable kEmpty{};
+  return kEmpty;
+}
+
+/// Returns a pointer to the field at `offset` in `message`.
+inline void* PbFieldAt(void* message, std::uint32_t offset) noexcept {
+  return PointerAdd(static_cast<char*>(message), offset);
+}
+
+/// Returns a pointer to the field at `offset` in `message`.
+inline const void* PbFieldAt(const void* message, std::uint32_t offset) noexcept {
+  return PointerAdd(static_cast<const char*>(message), offset);
+}
+
+/// Serializes the fields of `message` set in `set_fields` into `writer`.
+template <std::size_t N>
+void PbTableSerialize(const PbMessageTable& table, const void* message,
+                      const std::bitset<N>& set_fields, PbWriter& writer) noexcept(false) {
+  assert(table.Size() == N);
+  for (std::size_t i{0}; i < N; ++i) {
+    if (set_fields[i]) {
+      const PbFieldDescriptor& field{table[i]};
+      field.ops->serialize(writer, field.tag, PbFieldAt(message, field.offset));
+    }
+  }
+}
+
+/// Returns the number of bytes used to serialize the fields of `message` set in `set_fields`.
+template <std::size_t N>
+std::size_t PbTableByteSize(const PbMessageTable& table, const void* message,
+                            const std::bitset<N>& set_fields) noexcept(false) {
+  assert(table.Size() == N);
+  std::size_t size{0};
+  for (std::size_t i{0}; i < N; ++i) {
+    if (set_fields[i]) {
+      const PbFieldDescriptor& field{table[i]};
+      size += field.ops->byte_size(field.tag, PbFieldAt(message, field.offset));
+    }
+  }
+  return size;
+}
+
+/// Clears the field of the oneof of `field` which is currently set in `message`, if any, and sets
+/// the case of the oneof to `field`.
+template <std::size_t N>
+void PbTableSwitchOneof(const PbMessageTable& table, void* message, std::bitset<N>& set_fields,
+                        const PbFieldDescriptor& field) noexcept {
+  void* const oneof_case{PbFieldAt(message, field.oneof_offset)};
+  std::uint32_t current_tag{0};
+  static_cast<void>(std::memcpy(&current_tag, oneof_case, sizeof(current_tag)));
+  if (current_tag != 0) {
+    const std::size_t current{table.Find(current_tag, 0)};
+    if (current != PbMessageTable::kNotFound) {
+      table[current].ops->clear(PbFieldAt(message, table[current].offset));
+      set_fields[current] = false;
+    }
+  }
+  const std::uint32_t tag{field.tag};
+  static_cast<void>(std::memcpy(oneof_case, &tag, sizeof(tag)));
+}
+
+/// Deserializes the fields of `message` from `reader`, marking them as set in `set_fields`.
+template <std::size_t N>
+void PbTableDeserialize(const PbMessageTable& table, void* message, std::bitset<N>& set_fields,
+                        PbReader& reader) noexcept(false) {
+  assert(table.Size() == N);
+  std::size_t hint{0};
+  while (reader.NextField()) {
+    const std::size_t index{table.Find(reader.Reader().tag(), hint)};
+    if (index == PbMessageTable::kNotFound) {
+      reader.Reader().skip();
+      continue;
+    }
+    const PbFieldDescriptor& field{table[index]};
+    if (field.oneof_offset != 0) {
+      PbTableSwitchOneof(table, message, set_fields, field);
+    }
+    field.ops->deserialize(reader, PbFieldAt(message, field.offset));
+    set_fields[index] = true;
+    hint = index + 1;
+  }
+}
+
+/// Clears all the fields of `message`, keeping the capacity of their owned buffers.
+///
+/// Fields which are not set already hold their default value, so only set fields are cleared.
+template <std::size_t N>
+void PbTableClear(const PbMessageTable& table, void* message, std::bitset<N>& set_fields) noexcept {
+  assert(table.Size() == N);
+  if (set_fields.none()) {
+    return;
+  }
+  constexpr std::uint32_t kNotSet{0};
+  for (std::size_t i{0}; i < N; ++i) {
+    if (!set_fields[i]) {
+      continue;
+    }
+    const PbFieldDescriptor& field{table[i]};
+    field.ops->clear(PbFieldAt(message, field.offset));
+    if (field.oneof_offset != 0) {
+      static_cast<void>(
+          std::memcpy(PbFieldAt(message, field.oneof_offset), &kNotSet, sizeof(kNotSet)));
+    }
+  }
+  set_fields.reset();
+}
+
+template <class T>
+bool PbValidate(StringView data) noexcept {
+  return PbTableValidate(PbTableOf<T>::Get(), data, /*depth=*/0);
+}
+
+}  // namespace horus_internal
+}  // namespace horus
+
+#endif  // HORUS_PB_TABLE_H_
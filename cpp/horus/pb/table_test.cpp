@@ -0,0 +1,239 @@
+#include "horus/pb/table.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "horus/pb/buffer.h"
+#include "horus/pb/cow_bytes.h"
+#include "horus/pb/cow_repeated.h"
+#include "horus/pb/serialize.h"
+#include "horus/pb/testing/messages_pb.h"
+#include "horus/pb/types.h"
+#include "horus/pointer/cast.h"
+
+namespace horus {
+namespace {
+
+using horus_internal::PbFieldDescriptor;
+using horus_internal::PbFieldOpsFor;
+using horus_internal::PbMessageTable;
+using SubMessage = pb::TestMessage::SubMessage;
+
+/// Deserializes a `pb::TestMessage` from the bytes written by `writer`.
+pb::TestMessage Deserialize(PbWriter&& writer) {
+  PbReader reader{PbBuffer{std::move(writer).ToVector()}};
+  return pb::TestMessage{reader};
+}
+
+TEST(PbMessageTable, Find) {
+  static constexpr PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/1, /*offset=*/8, /*oneof_offset=*/0, &PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/3, /*offset=*/12, /*oneof_offset=*/0, &PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/10, /*offset=*/16, /*oneof_offset=*/0, &PbFieldOpsFor<std::uint32_t>::kOps},
+  };
+  static constexpr PbMessageTable kTable{kFields};
+
+  EXPECT_EQ(kTable.Size(), 3);
+  EXPECT_EQ(kTable.Find(1, 0), 0);
+  EXPECT_EQ(kTable.Find(3, 1), 1);
+  EXPECT_EQ(kTable.Find(10, 2), 2);
+  // Out of order.
+  EXPECT_EQ(kTable.Find(1, 2), 0);
+  EXPECT_EQ(kTable.Find(10, 0), 2);
+  EXPECT_EQ(kTable.Find(3, 3), 1);
+  // Unknown.
+  EXPECT_EQ(kTable.Find(0, 0), PbMessageTable::kNotFound);
+  EXPECT_EQ(kTable.Find(2, 1), PbMessageTable::kNotFound);
+  EXPECT_EQ(kTable.Find(11, 3), PbMessageTable::kNotFound);
+}
+
+TEST(PbMessageTable, DeserializeOutOfOrderAndUnknownFields) {
+  PbWriter writer;
+  writer.Writer().add_string(8, "string");
+  writer.Writer().add_uint64(100, 42);
+  writer.Writer().add_uint32(5, 7);
+  writer.Writer().add_string(101, "unknown");
+  writer.Writer().add_int32(3, -1);
+  const pb::TestMessage message{Deserialize(std::move(writer))};
+
+  EXPECT_EQ(message.string().Str(), "string");
+  EXPECT_EQ(message.u32(), 7);
+  EXPECT_EQ(message.i32(), -1);
+  EXPECT_FALSE(message.has_u64());
+  EXPECT_EQ(message.SerializeToBuffer(),
+            pb::TestMessage{}
+                .set_i32(-1)
+                .set_u32(7)
+                .set_string(CowBytes::OwnedCopy("string"))
+                .SerializeToBuffer());
+}
+
+TEST(PbMessageTable, DeserializeOneof) {
+  PbWriter writer;
+  writer.Writer().add_string(18, "string");
+  writer.Writer().add_uint32(15, 3);
+  const pb::TestMessage message{Deserialize(std::move(writer))};
+
+  EXPECT_EQ(message.test_oneof_case(), pb::TestMessage::TestOneofOneof::kOneofU32);
+  EXPECT_EQ(message.oneof_u32(), 3);
+  EXPECT_FALSE(message.has_oneof_string());
+  EXPECT_EQ(message.oneof_string().Str(), "");
+}
+
+TEST(PbMessageTable, DeserializeRepeatedOneofSubmessage) {
+  const std::vector<std::uint8_t> first{SubMessage{}.set_u32(1).SerializeToBuffer()};
+  const std::vector<std::uint8_t> second{SubMessage{}.set_i32(2).SerializeToBuffer()};
+  PbWriter writer;
+  writer.Writer().add_bytes(19, SafePointerCast<char>(first.data()), first.size());
+  writer.Writer().add_bytes(19, SafePointerCast<char>(second.data()), second.size());
+  const pb::TestMessage message{Deserialize(std::move(writer))};
+
+  // Like other oneof fields, the last submessage replaces the previous one.
+  EXPECT_EQ(message.test_oneof_case(), pb::TestMessage::TestOneofOneof::kOneofSubmessage);
+  EXPECT_FALSE(message.oneof_submessage().has_u32());
+  EXPECT_EQ(message.oneof_submessage().i32(), 2);
+}
+
+TEST(PbMessageTable, ClearOneof) {
+  pb::TestMessage message{pb::TestMessage{}.set_u32(1).set_oneof_bool(true)};
+  message.Clear();
+
+  EXPECT_TRUE(message.IsEmpty());
+  EXPECT_EQ(message.test_oneof_case(), pb::TestMessage::TestOneofOneof::kNotSet);
+  EXPECT_FALSE(message.oneof_bool());
+
+  message.set_oneof_i64(5);
+  EXPECT_EQ(message.SerializeToBuffer(), pb::TestMessage{}.set_oneof_i64(5).SerializeToBuffer());
+}
+
+/// Returns a view of the bytes written by `writer`.
+PbView ViewOf(PbWriter&& writer) { return PbView{PbBuffer{std::move(writer).ToVector()}}; }
+
+TEST(PbValidate, AcceptsValidMessages) {
+  PbView view{PbBuffer{
+      pb::TestMessage{}
+          .set_u32(1)
+          .set_float(2.F)
+          .set_string(CowBytes::OwnedCopy("string"))
+          .set_submessage(SubMessage{}.set_i32(-3))
+          .set_rep_float({4.F, 5.F})
+          .set_rep_i64({-6, 7})
+          .set_rep_submessage(CowRepeated<SubMessage>{}.Add(SubMessage{}.set_u32(8)))
+          .SerializeToBuffer()}};
+  EXPECT_FALSE(view.IsValidated());
+  EXPECT_TRUE(view.Validate<pb::TestMessage>());
+  EXPECT_TRUE(view.IsValidated());
+  // Subviews may delimit anything, so they are not validated.
+  EXPECT_FALSE(view.View(0, 1).IsValidated());
+
+  PbReader reader{std::move(view)};
+  EXPECT_TRUE(reader.IsValidated());
+  const pb::TestMessage message{reader};
+  EXPECT_EQ(message.u32(), 1);
+  EXPECT_EQ(message.float_(), 2.F);
+  EXPECT_EQ(message.submessage().i32(), -3);
+  ASSERT_NE(message.rep_float().TryView(), nullptr);
+  EXPECT_TRUE(message.rep_float().TryView()->IsValidated());
+  EXPECT_EQ(std::vector<float>(message.rep_float().begin(), message.rep_float().end()),
+            (std::vector<float>{4.F, 5.F}));
+  std::vector<std::int64_t> rep_i64;
+  for (const std::int64_t value : message.rep_i64()) {
+    rep_i64.push_back(value);
+  }
+  EXPECT_EQ(rep_i64, (std::vector<std::int64_t>{-6, 7}));
+  EXPECT_EQ(message.rep_submessage()[0].Ref().u32(), 8);
+  // Strings are not checked, so their views are not validated.
+  ASSERT_NE(message.string().TryView(), nullptr);
+  EXPECT_FALSE(message.string().TryView()->IsValidated());
+}
+
+TEST(PbValidate, IndexesValidatedRepeatedFields) {
+  const std::vector<std::uint8_t> first{SubMessage{}.set_u32(1).SerializeToBuffer()};
+  const std::vector<std::uint8_t> second{SubMessage{}.set_u32(300).SerializeToBuffer()};
+  PbWriter writer;
+  writer.Writer().add_bytes(29, SafePointerCast<char>(first.data()), first.size());
+  writer.Writer().add_uint64(6, 1000);
+  writer.Writer().add_bytes(29, SafePointerCast<char>(second.data()), second.size());
+  writer.Writer().add_fixed64(100, 1);
+  writer.Writer().add_fixed32(101, 1);
+  writer.Writer().add_bytes(29, nullptr, 0);
+  PbView view{ViewOf(std::move(writer))};
+  ASSERT_TRUE(view.Validate<pb::TestMessage>());
+
+  PbReader reader{std::move(view)};
+  const pb::TestMessage message{reader};
+  ASSERT_EQ(message.rep_submessage().size(), 3);
+  EXPECT_EQ(message.rep_submessage()[0].Ref().u32(), 1);
+  EXPECT_EQ(message.rep_submessage()[1].Ref().u32(), 300);
+  EXPECT_TRUE(message.rep_submessage()[2].Ref().IsEmpty());
+  EXPECT_EQ(message.u64(), 1000);
+}
+
+TEST(PbValidate, SkipsUnknownFields) {
+  PbWriter writer;
+  writer.Writer().add_fixed64(100, 1);
+  writer.Writer().add_string(101, "unknown");
+  writer.Writer().add_uint32(5, 2);
+  PbView view{ViewOf(std::move(writer))};
+  EXPECT_TRUE(view.Validate<pb::TestMessage>());
+}
+
+TEST(PbValidate, RejectsInvalidData) {
+  const auto is_valid = [](PbWriter&& writer) {
+    return ViewOf(std::move(writer)).Validate<pb::TestMessage>();
+  };
+
+  // Truncated message.
+  const std::vector<std::uint8_t> bytes{pb::TestMessage{}.set_u64(1000).SerializeToBuffer()};
+  PbView truncated{PbBuffer{std::vector<std::uint8_t>{bytes.begin(), bytes.end() - 1}}};
+  EXPECT_FALSE(truncated.Validate<pb::TestMessage>());
+  EXPECT_FALSE(truncated.IsValidated());
+
+  // Wrong wire type.
+  PbWriter fixed_u32;
+  fixed_u32.Writer().add_fixed32(5, 1);
+  EXPECT_FALSE(is_valid(std::move(fixed_u32)));
+  PbWriter varint_float;
+  varint_float.Writer().add_uint32(1, 1);
+  EXPECT_FALSE(is_valid(std::move(varint_float)));
+
+  // Packed floats which do not fill their value.
+  PbWriter partial_floats;
+  partial_floats.Writer().add_string(21, "abc");
+  EXPECT_FALSE(is_valid(std::move(partial_floats)));
+
+  // Truncated packed varint.
+  PbWriter truncated_varints;
+  truncated_varints.Writer().add_string(23, "\x01\x80");
+  EXPECT_FALSE(is_valid(std::move(truncated_varints)));
+
+  // Invalid submessages, including repeated ones.
+  PbWriter lazy_submessage;
+  lazy_submessage.Writer().add_string(9, "\x08");
+  EXPECT_FALSE(is_valid(std::move(lazy_submessage)));
+  PbWriter repeated_submessage;
+  repeated_submessage.Writer().add_string(29, "\x08\x01");
+  repeated_submessage.Writer().add_string(29, "\x1A\x05");
+  EXPECT_FALSE(is_valid(std::move(repeated_submessage)));
+}
+
+TEST(PbValidate, UnvalidatedViewsAreChecked) {
+  PbReader reader{PbBuffer{
+      pb::TestMessage{}.set_rep_float({1.F}).set_rep_u32({1, 300}).SerializeToBuffer()}};
+  EXPECT_FALSE(reader.IsValidated());
+  const pb::TestMessage message{reader};
+
+  ASSERT_NE(message.rep_float().TryView(), nullptr);
+  EXPECT_FALSE(message.rep_float().TryView()->IsValidated());
+  std::vector<std::uint32_t> rep_u32;
+  for (const std::uint32_t value : message.rep_u32()) {
+    rep_u32.push_back(value);
+  }
+  EXPECT_EQ(rep_u32, (std::vector<std::uint32_t>{1, 300}));
+}
+
+}  // namespace
+}  // namespace horus
@@ -1,6 +1,9 @@
 #include "horus/pb/testing/messages_pb.h"
 
+#include <cstddef>
+
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 
 namespace horus {
 namespace sdk {
@@ -13,41 +16,21 @@ TestMessage_SubMessage::TestMessage_SubMessage(const TestMessage_SubMessage& oth
     , set_fields_{other.set_fields_} {}
 
 void TestMessage_SubMessage::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 1, u32_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<std::int32_t>(writer, /*tag=*/ 2, i32_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 3, string_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t TestMessage_SubMessage::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void TestMessage_SubMessage::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<std::uint32_t>(reader, u32_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<std::int32_t>(reader, i32_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<CowBytes>(reader, string_);
-        set_fields_[2] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void TestMessage_SubMessage::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
 }
 
 TestMessage::TestMessage(const TestMessage& other) noexcept(false)
@@ -86,287 +69,152 @@ TestMessage::TestMessage(const TestMessage& other) noexcept(false)
     , set_fields_{other.set_fields_} {}
 
 void TestMessage::SerializeTo(PbWriter& writer) const noexcept(false) {
-  if (set_fields_[0]) {
-    SerializeField<float, PbDeserFlags::kFixed>(writer, /*tag=*/ 1, floatf_);
-  }
-  if (set_fields_[1]) {
-    SerializeField<double, PbDeserFlags::kFixed>(writer, /*tag=*/ 2, doublef_);
-  }
-  if (set_fields_[2]) {
-    SerializeField<std::int32_t>(writer, /*tag=*/ 3, i32_);
-  }
-  if (set_fields_[3]) {
-    SerializeField<std::int64_t>(writer, /*tag=*/ 4, i64_);
-  }
-  if (set_fields_[4]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 5, u32_);
-  }
-  if (set_fields_[5]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 6, u64_);
-  }
-  if (set_fields_[6]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 7, bytes_);
-  }
-  if (set_fields_[7]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 8, string_);
-  }
-  if (set_fields_[8]) {
-    SerializeField<TestMessage_SubMessage>(writer, /*tag=*/ 9, submessage_);
-  }
-  if (set_fields_[9]) {
-    SerializeField<bool>(writer, /*tag=*/ 10, boolf_);
-  }
-  if (set_fields_[10]) {
-    SerializeField<float, PbDeserFlags::kFixed>(writer, /*tag=*/ 11, oneof_float_);
-  }
-  if (set_fields_[11]) {
-    SerializeField<double, PbDeserFlags::kFixed>(writer, /*tag=*/ 12, oneof_double_);
-  }
-  if (set_fields_[12]) {
-    SerializeField<std::int32_t>(writer, /*tag=*/ 13, oneof_i32_);
-  }
-  if (set_fields_[13]) {
-    SerializeField<std::int64_t>(writer, /*tag=*/ 14, oneof_i64_);
-  }
-  if (set_fields_[14]) {
-    SerializeField<std::uint32_t>(writer, /*tag=*/ 15, oneof_u32_);
-  }
-  if (set_fields_[15]) {
-    SerializeField<std::uint64_t>(writer, /*tag=*/ 16, oneof_u64_);
-  }
-  if (set_fields_[16]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 17, oneof_bytes_);
-  }
-  if (set_fields_[17]) {
-    SerializeField<CowBytes>(writer, /*tag=*/ 18, oneof_string_);
-  }
-  if (set_fields_[18]) {
-    SerializeField<TestMessage_SubMessage>(writer, /*tag=*/ 19, oneof_submessage_);
-  }
-  if (set_fields_[19]) {
-    SerializeField<bool>(writer, /*tag=*/ 20, oneof_bool_);
-  }
-  if (set_fields_[20]) {
-    SerializeField<CowSpan<float>, PbDeserFlags::kFixed>(writer, /*tag=*/ 21, rep_float_);
-  }
-  if (set_fields_[21]) {
-    SerializeField<CowSpan<double>, PbDeserFlags::kFixed>(writer, /*tag=*/ 22, rep_double_);
-  }
-  if (set_fields_[22]) {
-    SerializeField<CowRepeated<std::int32_t>>(writer, /*tag=*/ 23, rep_i32_);
-  }
-  if (set_fields_[23]) {
-    SerializeField<CowRepeated<std::int64_t>>(writer, /*tag=*/ 24, rep_i64_);
-  }
-  if (set_fields_[24]) {
-    SerializeField<CowRepeated<std::uint32_t>>(writer, /*tag=*/ 25, rep_u32_);
-  }
-  if (set_fields_[25]) {
-    SerializeField<CowRepeated<std::uint64_t>>(writer, /*tag=*/ 26, rep_u64_);
-  }
-  if (set_fields_[26]) {
-    SerializeField<CowRepeated<CowBytes>>(writer, /*tag=*/ 27, rep_bytes_);
-  }
-  if (set_fields_[27]) {
-    SerializeField<CowRepeated<CowBytes>>(writer, /*tag=*/ 28, rep_string_);
-  }
-  if (set_fields_[28]) {
-    SerializeField<CowRepeated<TestMessage_SubMessage>>(writer, /*tag=*/ 29, rep_submessage_);
-  }
-  if (set_fields_[29]) {
-    SerializeField<CowRepeated<bool>>(writer, /*tag=*/ 30, rep_bool_);
-  }
-  if (set_fields_[30]) {
-    SerializeField<CowRepeated<TestEnum>>(writer, /*tag=*/ 31, rep_enum_);
-  }
+  horus_internal::PbTableSerialize(Table(), this, set_fields_, writer);
+}
+
+std::size_t TestMessage::ByteSizeLong() const noexcept(false) {
+  const std::size_t size{horus_internal::PbTableByteSize(Table(), this, set_fields_)};
+  SetCachedByteSize(size);
+  return size;
 }
 
 void TestMessage::DeserializeFrom(PbReader& reader) noexcept(false) {
-  while (reader.Reader().next()) {
-    switch (reader.Reader().tag()) {
-      case 1: {
-        DeserializeField<float, PbDeserFlags::kFixed>(reader, floatf_);
-        set_fields_[0] = true;
-        break;
-      }
-      case 2: {
-        DeserializeField<double, PbDeserFlags::kFixed>(reader, doublef_);
-        set_fields_[1] = true;
-        break;
-      }
-      case 3: {
-        DeserializeField<std::int32_t>(reader, i32_);
-        set_fields_[2] = true;
-        break;
-      }
-      case 4: {
-        DeserializeField<std::int64_t>(reader, i64_);
-        set_fields_[3] = true;
-        break;
-      }
-      case 5: {
-        DeserializeField<std::uint32_t>(reader, u32_);
-        set_fields_[4] = true;
-        break;
-      }
-      case 6: {
-        DeserializeField<std::uint64_t>(reader, u64_);
-        set_fields_[5] = true;
-        break;
-      }
-      case 7: {
-        DeserializeField<CowBytes>(reader, bytes_);
-        set_fields_[6] = true;
-        break;
-      }
-      case 8: {
-        DeserializeField<CowBytes>(reader, string_);
-        set_fields_[7] = true;
-        break;
-      }
-      case 9: {
-        DeserializeField<TestMessage_SubMessage>(reader, submessage_);
-        set_fields_[8] = true;
-        break;
-      }
-      case 10: {
-        DeserializeField<bool>(reader, boolf_);
-        set_fields_[9] = true;
-        break;
-      }
-      case 11: {
-        clear_test_oneof();
-        test_oneof_ = TestOneofOneof::kOneofFloat;
-        DeserializeField<float, PbDeserFlags::kFixed>(reader, oneof_float_);
-        set_fields_[10] = true;
-        break;
-      }
-      case 12: {
-        clear_test_oneof();
-        test_oneof_ = TestOneofOneof::kOneofDouble;
-        DeserializeField<double, PbDeserFlags::kFixed>(reader, oneof_double_);
-        set_fields_[11] = true;
-        break;
-      }
-      case 13: {
-        clear_test_oneof();
-        test_oneof_ = TestOneofOneof::kOneofI32;
-        DeserializeField<std::int32_t>(reader, oneof_i32_);
-        set_fields_[12] = true;
-        break;
-      }
-      case 14: {
-        clear_test_oneof();
-        test_oneof_ = TestOneofOneof::kOneofI64;
-        DeserializeField<std::int64_t>(reader, oneof_i64_);
-        set_fields_[13] = true;
-        break;
-      }
-      case 15: {
-        clear_test_oneof();
-        test_oneof_ = TestOneofOneof::kOneofU32;
-        DeserializeField<std::uint32_t>(reader, oneof_u32_);
-        set_fields_[14] = true;
-        break;
-      }
-      case 16: {
-        clear_test_oneof();
-        test_oneof_ = TestOneofOneof::kOneofU64;
-        DeserializeField<std::uint64_t>(reader, oneof_u64_);
-        set_fields_[15] = true;
-        break;
-      }
-      case 17: {
-        clear_test_oneof();
-        test_oneof_ = TestOneofOneof::kOneofBytes;
-        DeserializeField<CowBytes>(reader, oneof_bytes_);
-        set_fields_[16] = true;
-        break;
-      }
-      case 18: {
-        clear_test_oneof();
-        test_oneof_ = TestOneofOneof::kOneofString;
-        DeserializeField<CowBytes>(reader, oneof_string_);
-        set_fields_[17] = true;
-        break;
-      }
-      case 19: {
-        clear_test_oneof();
-        test_oneof_ = TestOneofOneof::kOneofSubmessage;
-        DeserializeField<TestMessage_SubMessage>(reader, oneof_submessage_);
-        set_fields_[18] = true;
-        break;
-      }
-      case 20: {
-        clear_test_oneof();
-        test_oneof_ = TestOneofOneof::kOneofBool;
-        DeserializeField<bool>(reader, oneof_bool_);
-        set_fields_[19] = true;
-        break;
-      }
-      case 21: {
-        DeserializeField<CowSpan<float>, PbDeserFlags::kFixed>(reader, rep_float_);
-        set_fields_[20] = true;
-        break;
-      }
-      case 22: {
-        DeserializeField<CowSpan<double>, PbDeserFlags::kFixed>(reader, rep_double_);
-        set_fields_[21] = true;
-        break;
-      }
-      case 23: {
-        DeserializeField<CowRepeated<std::int32_t>>(reader, rep_i32_);
-        set_fields_[22] = true;
-        break;
-      }
-      case 24: {
-        DeserializeField<CowRepeated<std::int64_t>>(reader, rep_i64_);
-        set_fields_[23] = true;
-        break;
-      }
-      case 25: {
-        DeserializeField<CowRepeated<std::uint32_t>>(reader, rep_u32_);
-        set_fields_[24] = true;
-        break;
-      }
-      case 26: {
-        DeserializeField<CowRepeated<std::uint64_t>>(reader, rep_u64_);
-        set_fields_[25] = true;
-        break;
-      }
-      case 27: {
-        DeserializeField<CowRepeated<CowBytes>>(reader, rep_bytes_);
-        set_fields_[26] = true;
-        break;
-      }
-      case 28: {
-        DeserializeField<CowRepeated<CowBytes>>(reader, rep_string_);
-        set_fields_[27] = true;
-        break;
-      }
-      case 29: {
-        DeserializeField<CowRepeated<TestMessage_SubMessage>>(reader, rep_submessage_);
-        set_fields_[28] = true;
-        break;
-      }
-      case 30: {
-        DeserializeField<CowRepeated<bool>>(reader, rep_bool_);
-        set_fields_[29] = true;
-        break;
-      }
-      case 31: {
-        DeserializeField<CowRepeated<TestEnum>>(reader, rep_enum_);
-        set_fields_[30] = true;
-        break;
-      }
-      default: {
-        reader.Reader().skip();
-        break;
-      }
-    }
-  }
+  horus_internal::PbTableDeserialize(Table(), this, set_fields_, reader);
+}
+
+void TestMessage::Clear() noexcept {
+  horus_internal::PbTableClear(Table(), this, set_fields_);
+}
+
+// MARK: Field tables
+
+// Messages are not standard-layout since they have a vtable, so `offsetof()` is only
+// conditionally-supported on them; it is supported by all compilers targeted by the SDK.
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
+const horus_internal::PbMessageTable& TestMessage_SubMessage::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(TestMessage_SubMessage, u32_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/ 2, offsetof(TestMessage_SubMessage, i32_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::int32_t>::kOps},
+      {/*tag=*/ 3, offsetof(TestMessage_SubMessage, string_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
+}
+
+const horus_internal::PbMessageTable& TestMessage::Table() noexcept {
+  static constexpr horus_internal::PbFieldDescriptor kFields[]{  // NOLINT(*-c-arrays)
+      {/*tag=*/ 1, offsetof(TestMessage, floatf_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<float, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 2, offsetof(TestMessage, doublef_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<double, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 3, offsetof(TestMessage, i32_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::int32_t>::kOps},
+      {/*tag=*/ 4, offsetof(TestMessage, i64_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::int64_t>::kOps},
+      {/*tag=*/ 5, offsetof(TestMessage, u32_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/ 6, offsetof(TestMessage, u64_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 7, offsetof(TestMessage, bytes_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 8, offsetof(TestMessage, string_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 9, offsetof(TestMessage, submessage_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<PbLazy<TestMessage_SubMessage>>::kOps},
+      {/*tag=*/ 10, offsetof(TestMessage, boolf_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<bool>::kOps},
+      {/*tag=*/ 11, offsetof(TestMessage, oneof_float_),
+       /*oneof_offset=*/ offsetof(TestMessage, test_oneof_),
+       &horus_internal::PbFieldOpsFor<float, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 12, offsetof(TestMessage, oneof_double_),
+       /*oneof_offset=*/ offsetof(TestMessage, test_oneof_),
+       &horus_internal::PbFieldOpsFor<double, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 13, offsetof(TestMessage, oneof_i32_),
+       /*oneof_offset=*/ offsetof(TestMessage, test_oneof_),
+       &horus_internal::PbFieldOpsFor<std::int32_t>::kOps},
+      {/*tag=*/ 14, offsetof(TestMessage, oneof_i64_),
+       /*oneof_offset=*/ offsetof(TestMessage, test_oneof_),
+       &horus_internal::PbFieldOpsFor<std::int64_t>::kOps},
+      {/*tag=*/ 15, offsetof(TestMessage, oneof_u32_),
+       /*oneof_offset=*/ offsetof(TestMessage, test_oneof_),
+       &horus_internal::PbFieldOpsFor<std::uint32_t>::kOps},
+      {/*tag=*/ 16, offsetof(TestMessage, oneof_u64_),
+       /*oneof_offset=*/ offsetof(TestMessage, test_oneof_),
+       &horus_internal::PbFieldOpsFor<std::uint64_t>::kOps},
+      {/*tag=*/ 17, offsetof(TestMessage, oneof_bytes_),
+       /*oneof_offset=*/ offsetof(TestMessage, test_oneof_),
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 18, offsetof(TestMessage, oneof_string_),
+       /*oneof_offset=*/ offsetof(TestMessage, test_oneof_),
+       &horus_internal::PbFieldOpsFor<CowBytes>::kOps},
+      {/*tag=*/ 19, offsetof(TestMessage, oneof_submessage_),
+       /*oneof_offset=*/ offsetof(TestMessage, test_oneof_),
+       &horus_internal::PbFieldOpsFor<TestMessage_SubMessage>::kOps},
+      {/*tag=*/ 20, offsetof(TestMessage, oneof_bool_),
+       /*oneof_offset=*/ offsetof(TestMessage, test_oneof_),
+       &horus_internal::PbFieldOpsFor<bool>::kOps},
+      {/*tag=*/ 21, offsetof(TestMessage, rep_float_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowSpan<float>, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 22, offsetof(TestMessage, rep_double_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowSpan<double>, PbDeserFlags::kFixed>::kOps},
+      {/*tag=*/ 23, offsetof(TestMessage, rep_i32_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<std::int32_t>>::kOps},
+      {/*tag=*/ 24, offsetof(TestMessage, rep_i64_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<std::int64_t>>::kOps},
+      {/*tag=*/ 25, offsetof(TestMessage, rep_u32_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<std::uint32_t>>::kOps},
+      {/*tag=*/ 26, offsetof(TestMessage, rep_u64_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<std::uint64_t>>::kOps},
+      {/*tag=*/ 27, offsetof(TestMessage, rep_bytes_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<CowBytes>>::kOps},
+      {/*tag=*/ 28, offsetof(TestMessage, rep_string_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<CowBytes>>::kOps},
+      {/*tag=*/ 29, offsetof(TestMessage, rep_submessage_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<TestMessage_SubMessage>>::kOps},
+      {/*tag=*/ 30, offsetof(TestMessage, rep_bool_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<bool>>::kOps},
+      {/*tag=*/ 31, offsetof(TestMessage, rep_enum_),
+       /*oneof_offset=*/ 0,
+       &horus_internal::PbFieldOpsFor<CowRepeated<TestEnum>>::kOps},
+  };
+  static constexpr horus_internal::PbMessageTable kTable{kFields};
+  return kTable;
 }
 
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
 }  // namespace pb
 }  // namespace sdk
 }  // namespace horus
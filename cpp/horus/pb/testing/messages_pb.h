@@ -8,6 +8,7 @@
 /// Generated by `/opt/actions-runner/_work/horus/horus/common/tools/sdk/pb.ts`.
 
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -16,8 +17,10 @@
 #include "horus/pb/cow_bytes.h"
 #include "horus/pb/cow_repeated.h"
 #include "horus/pb/cow_span.h"
+#include "horus/pb/lazy.h"
 #include "horus/pb/message.h"
 #include "horus/pb/serialize.h"
+#include "horus/pb/table.h"
 #include "horus/pb/types.h"
 #include "horus/strings/string_view.h"
 
@@ -93,6 +96,11 @@ class TestMessage_SubMessage final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -101,12 +109,25 @@ class TestMessage_SubMessage final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.TestMessage.SubMessage`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.TestMessage.SubMessage"; }
 
   /// The full name of the message: `horus.pb.TestMessage.SubMessage`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `TestMessage_SubMessage`, e.g. to build a `PbFieldMask<TestMessage_SubMessage>`.
+  enum class Field : PbTag {
+    /// Field `u32`.
+    kU32 = 1,
+    /// Field `i32`.
+    kI32 = 2,
+    /// Field `string`.
+    kString = 3,
+  };
+
   // Field `u32` (no 1).
   // -----
 
@@ -233,6 +254,10 @@ class TestMessage_SubMessage final : public PbMessage {
     return std::move(set_string(std::move(string)));
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see u32()
   std::uint32_t u32_{};
@@ -285,6 +310,11 @@ class TestMessage final : public PbMessage {
   /// @throws std::bad_alloc If the resulting buffer failed to allocate.
   void SerializeTo(PbWriter& writer) const noexcept(false) final;
 
+  /// Returns the number of bytes used to serialize the message, and caches it.
+  ///
+  /// @throws std::bad_alloc If a repeated field had to be indexed and the allocation failed.
+  std::size_t ByteSizeLong() const noexcept(false) final;
+
   /// Deserializes the message from `reader`.
   ///
   /// @throws InvalidProtobufMessage If the `reader` contains an invalid Protobuf message.
@@ -293,12 +323,81 @@ class TestMessage final : public PbMessage {
   /// Returns whether the message is empty.
   bool IsEmpty() const noexcept final { return set_fields_.none(); }
 
+  /// Clears all fields, keeping the capacity of owned buffers.
+  void Clear() noexcept final;
+
   /// The full name of the message: `horus.pb.TestMessage`.
   static constexpr StringView TypeName() noexcept { return "horus.pb.TestMessage"; }
 
   /// The full name of the message: `horus.pb.TestMessage`.
   StringView MessageTypeName() const noexcept final { return TypeName(); }
 
+  /// The numbers of the fields of `TestMessage`, e.g. to build a `PbFieldMask<TestMessage>`.
+  enum class Field : PbTag {
+    /// Field `float`.
+    kFloat = 1,
+    /// Field `double`.
+    kDouble = 2,
+    /// Field `i32`.
+    kI32 = 3,
+    /// Field `i64`.
+    kI64 = 4,
+    /// Field `u32`.
+    kU32 = 5,
+    /// Field `u64`.
+    kU64 = 6,
+    /// Field `bytes`.
+    kBytes = 7,
+    /// Field `string`.
+    kString = 8,
+    /// Field `submessage`.
+    kSubmessage = 9,
+    /// Field `bool`.
+    kBool = 10,
+    /// Field `oneof_float`.
+    kOneofFloat = 11,
+    /// Field `oneof_double`.
+    kOneofDouble = 12,
+    /// Field `oneof_i32`.
+    kOneofI32 = 13,
+    /// Field `oneof_i64`.
+    kOneofI64 = 14,
+    /// Field `oneof_u32`.
+    kOneofU32 = 15,
+    /// Field `oneof_u64`.
+    kOneofU64 = 16,
+    /// Field `oneof_bytes`.
+    kOneofBytes = 17,
+    /// Field `oneof_string`.
+    kOneofString = 18,
+    /// Field `oneof_submessage`.
+    kOneofSubmessage = 19,
+    /// Field `oneof_bool`.
+    kOneofBool = 20,
+    /// Field `rep_float`.
+    kRepFloat = 21,
+    /// Field `rep_double`.
+    kRepDouble = 22,
+    /// Field `rep_i32`.
+    kRepI32 = 23,
+    /// Field `rep_i64`.
+    kRepI64 = 24,
+    /// Field `rep_u32`.
+    kRepU32 = 25,
+    /// Field `rep_u64`.
+    kRepU64 = 26,
+    /// Field `rep_bytes`.
+    kRepBytes = 27,
+    /// Field `rep_string`.
+    kRepString = 28,
+    /// Field `rep_submessage`.
+    kRepSubmessage = 29,
+    /// Field `rep_bool`.
+    kRepBool = 30,
+    /// Field `rep_enum`.
+    kRepEnum = 31,
+  };
+
   // Field `float` (no 1).
   // -----
 
@@ -633,8 +732,12 @@ class TestMessage final : public PbMessage {
   /// No documentation.
   ///
   /// Field no: 9.
-  constexpr const TestMessage_SubMessage& submessage() const& noexcept HORUS_LIFETIME_BOUND {
-    return submessage_;
+  ///
+  /// If `submessage` was received, it is decoded on first access.
+  ///
+  /// @throws InvalidProtobufMessage If `submessage` was received and is not a valid message.
+  const TestMessage_SubMessage& submessage() const& noexcept(false) HORUS_LIFETIME_BOUND {
+    return submessage_.Ref();
   }
 
   /// If `submessage` is set, moves it out of the message (without marking it as unset).
@@ -642,19 +745,23 @@ class TestMessage final : public PbMessage {
   /// Otherwise, returns a default-initialized value.
   ///
   /// Field no: 9.
-  TestMessage_SubMessage submessage() && noexcept {
+  ///
+  /// @throws InvalidProtobufMessage If `submessage` was received and is not a valid message.
+  TestMessage_SubMessage submessage() && noexcept(false) {
     if (!set_fields_[8]) {
       return {};
     }
-    return std::move(submessage_);
+    return std::move(submessage_).Take();
   }
 
   /// No documentation.
   ///
   /// Field no: 9.
-  TestMessage_SubMessage& mutable_submessage() & noexcept HORUS_LIFETIME_BOUND {
+  ///
+  /// @throws InvalidProtobufMessage If `submessage` was received and is not a valid message.
+  TestMessage_SubMessage& mutable_submessage() & noexcept(false) HORUS_LIFETIME_BOUND {
     set_fields_[8] = true;
-    return submessage_;
+    return submessage_.Mutable();
   }
 
   /// Returns whether `submessage` (no 9) is set.
@@ -663,13 +770,13 @@ class TestMessage final : public PbMessage {
   /// Clears `submessage` (no 9).
   void clear_submessage() & noexcept {
     set_fields_[8] = false;
-    submessage_ = {};
+    submessage_.Clear();
   }
 
   /// Sets `submessage` (no 9) and returns `*this`.
   TestMessage& set_submessage(TestMessage_SubMessage&& submessage) & noexcept {
     set_fields_[8] = true;
-    submessage_ = std::move(submessage);
+    submessage_.Set(std::move(submessage));
     return *this;
   }
   /// Sets `submessage` (no 9) and returns `*this`.
@@ -1814,6 +1921,10 @@ class TestMessage final : public PbMessage {
     }
   }
 
+  /// (Internal use only) Returns the table describing the fields of the message, in the order of
+  /// their bits in `set_fields_`.
+  static const horus_internal::PbMessageTable& Table() noexcept;
+
  private:
   /// @see float()
   float floatf_{};
@@ -1832,7 +1943,7 @@ class TestMessage final : public PbMessage {
   /// @see string()
   CowBytes string_{};
   /// @see submessage()
-  TestMessage_SubMessage submessage_{};
+  PbLazy<TestMessage_SubMessage> submessage_{};
   /// @see bool()
   bool boolf_{};
   /// @see oneof_float()
@@ -1959,6 +2070,11 @@ class PbTraits<horus::sdk::pb::TestEnum> final {
     writer.Writer().add_enum(tag, static_cast<PbEnum>(value));
   }
 
+  /// Returns the number of bytes used to serialize `value`.
+  static constexpr std::size_t ByteSize(PbTag tag, horus::sdk::pb::TestEnum value) noexcept {
+    return PbTraits<PbEnum>::ByteSize(tag, static_cast<PbEnum>(value));
+  }
+
   /// Deserializes `horus::sdk::pb::TestEnum` from `reader`.
   static horus::sdk::pb::TestEnum Deserialize(PbReader& reader) {
     return PbEnumTraits<horus::sdk::pb::TestEnum>::ValueOf(reader.Reader().get_enum());
@@ -118,6 +118,9 @@ class UnalignedSpan final {
   /// Returns whether `size() == 0`.
   constexpr bool empty() const noexcept { return size() == 0; }
 
+  /// Returns a pointer to the (possibly unaligned) bytes of the first item of the span.
+  constexpr const char* bytes() const noexcept { return begin_; }
+
   /// Returns a copy of the value at the given index.
   T operator[](std::size_t index) const noexcept {
     assert(index < size());
@@ -0,0 +1,347 @@
+#include "horus/pb/varint.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "horus/strings/string_view.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define HORUS_PB_VARINT_X86 1
+#include <immintrin.h>
+#else
+#define HORUS_PB_VARINT_X86 0
+#endif
+
+namespace horus {
+namespace horus_internal {
+namespace {
+
+/// Bit set in all bytes of a varint but its last.
+constexpr std::uint8_t kContinuationBit{0x80};
+
+/// Maximum number of bytes of a varint.
+constexpr std::size_t kMaxVarintLength{10};
+
+/// Returns the byte at `index` in `data`.
+inline std::uint8_t ByteAt(StringView data, std::size_t index) noexcept {
+  return static_cast<std::uint8_t>(data[index]);
+}
+
+/// Decodes the varint starting at `pos` in `data` into `value`, and moves `pos` after it. Returns
+/// false if the varint is truncated.
+template <class U>
+inline bool DecodeOne(StringView data, std::size_t& pos, U& value) noexcept {
+  std::uint64_t result{0};
+  unsigned shift{0};
+  while (pos < data.size()) {
+    const std::uint8_t byte{ByteAt(data, pos)};
+    ++pos;
+    if (shift < 64) {
+      result |= static_cast<std::uint64_t>(byte & 0x7FU) << shift;
+    }
+    if ((byte & kContinuationBit) == 0) {
+      value = static_cast<U>(result);
+      return true;
+    }
+    shift += 7;
+  }
+  return false;
+}
+
+/// Decodes varints starting at `pos` in `data` into `out` (starting at `count`), until `data` or
+/// `capacity` is exhausted. Returns the new value of `count`.
+template <class U>
+std::size_t DecodeScalar(StringView data, std::size_t pos, U* out, std::size_t count,
+                         std::size_t capacity) noexcept {
+  while (count < capacity && DecodeOne(data, pos, out[count])) {  // NOLINT(*-pointer-arithmetic)
+    ++count;
+  }
+  return count;
+}
+
+/// Portable implementation of `CountVarints()`.
+std::size_t CountScalar(StringView data) noexcept {
+  std::size_t count{0};
+  for (const char c : data) {
+    count += (static_cast<std::uint8_t>(c) & kContinuationBit) == 0 ? 1 : 0;
+  }
+  return count;
+}
+
+#if HORUS_PB_VARINT_X86
+
+/// Returns the number of set bits in `mask`.
+inline std::size_t PopCount(std::uint32_t mask) noexcept {
+  return static_cast<std::size_t>(__builtin_popcount(mask));
+}
+
+/// Decodes `ends` varints starting at `pos` into `out` (starting at `count`), which is the number
+/// of varints ending in the current chunk. If no varint ends in the chunk, decodes the varint
+/// starting at `pos` anyway. Returns false if the last varint is truncated.
+template <class U>
+inline bool DecodeChunkScalar(StringView data, std::size_t& pos, std::size_t ends, U* out,
+                              std::size_t& count) noexcept {
+  if (ends == 0) {
+    ends = 1;
+  }
+  for (std::size_t i{0}; i < ends; ++i, ++count) {
+    if (!DecodeOne(data, pos, out[count])) {  // NOLINT(*-pointer-arithmetic)
+      return false;
+    }
+  }
+  return true;
+}
+
+/// Stores the 16 bytes of `chunk` as 16 32-bit integers in `out`.
+__attribute__((target("sse4.1"))) inline void Widen16(__m128i chunk, std::uint32_t* out) noexcept {
+  // NOLINTBEGIN(*-reinterpret-cast,*-pointer-arithmetic)
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_cvtepu8_epi32(chunk));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4),
+                   _mm_cvtepu8_epi32(_mm_srli_si128(chunk, 4)));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8),
+                   _mm_cvtepu8_epi32(_mm_srli_si128(chunk, 8)));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 12),
+                   _mm_cvtepu8_epi32(_mm_srli_si128(chunk, 12)));
+  // NOLINTEND(*-reinterpret-cast,*-pointer-arithmetic)
+}
+
+/// Stores the 16 bytes of `chunk` as 16 64-bit integers in `out`.
+__attribute__((target("sse4.1"))) inline void Widen16(__m128i chunk, std::uint64_t* out) noexcept {
+  // NOLINTBEGIN(*-reinterpret-cast,*-pointer-arithmetic)
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_cvtepu8_epi64(chunk));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2),
+                   _mm_cvtepu8_epi64(_mm_srli_si128(chunk, 2)));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4),
+                   _mm_cvtepu8_epi64(_mm_srli_si128(chunk, 4)));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 6),
+                   _mm_cvtepu8_epi64(_mm_srli_si128(chunk, 6)));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8),
+                   _mm_cvtepu8_epi64(_mm_srli_si128(chunk, 8)));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 10),
+                   _mm_cvtepu8_epi64(_mm_srli_si128(chunk, 10)));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 12),
+                   _mm_cvtepu8_epi64(_mm_srli_si128(chunk, 12)));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 14),
+                   _mm_cvtepu8_epi64(_mm_srli_si128(chunk, 14)));
+  // NOLINTEND(*-reinterpret-cast,*-pointer-arithmetic)
+}
+
+/// Loads the 16 bytes at `pos` in `data`.
+__attribute__((target("sse4.1"))) inline __m128i Load16(StringView data, std::size_t pos) noexcept {
+  // NOLINTNEXTLINE(*-reinterpret-cast,*-pointer-arithmetic)
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data.data() + pos));
+}
+
+/// Implementation of `DecodeVarints()` using SSE4.1.
+///
+/// Chunks of 16 single-byte varints (the common case for small values, booleans and enums) are
+/// widened at once. Other chunks are decoded one varint at a time.
+template <class U>
+__attribute__((target("sse4.1"))) std::size_t DecodeSse41(StringView data, U* out,
+                                                          std::size_t capacity) noexcept {
+  constexpr std::size_t kChunkSize{16};
+  std::size_t pos{0};
+  std::size_t count{0};
+  while (data.size() - pos >= kChunkSize && capacity - count >= kChunkSize) {
+    const __m128i chunk{Load16(data, pos)};
+    const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(chunk));
+    if (mask == 0) {
+      Widen16(chunk, out + count);  // NOLINT(*-pointer-arithmetic)
+      pos += kChunkSize;
+      count += kChunkSize;
+    } else if (!DecodeChunkScalar(data, pos, PopCount(~mask & 0xFFFFU), out, count)) {
+      return count;
+    }
+  }
+  return DecodeScalar(data, pos, out, count, capacity);
+}
+
+/// Implementation of `CountVarints()` using SSE4.1.
+// NOLINTNEXTLINE(*-exception-escape): substr() won't fail since `pos <= data.size()`
+__attribute__((target("sse4.1"))) std::size_t CountSse41(StringView data) noexcept {
+  constexpr std::size_t kChunkSize{16};
+  std::size_t pos{0};
+  std::size_t count{0};
+  for (; data.size() - pos >= kChunkSize; pos += kChunkSize) {
+    const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(Load16(data, pos)));
+    count += PopCount(~mask & 0xFFFFU);
+  }
+  return count + CountScalar(data.substr(pos));
+}
+
+/// Loads the 32 bytes at `pos` in `data`.
+__attribute__((target("avx2"))) inline __m256i Load32(StringView data, std::size_t pos) noexcept {
+  // NOLINTNEXTLINE(*-reinterpret-cast,*-pointer-arithmetic)
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data.data() + pos));
+}
+
+/// Stores the 32 bytes of `chunk` as 32 32-bit integers in `out`.
+__attribute__((target("avx2"))) inline void Widen32(__m256i chunk, std::uint32_t* out) noexcept {
+  const __m128i low{_mm256_castsi256_si128(chunk)};
+  const __m128i high{_mm256_extracti128_si256(chunk, 1)};
+  // NOLINTBEGIN(*-reinterpret-cast,*-pointer-arithmetic)
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_cvtepu8_epi32(low));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_cvtepu8_epi32(_mm_srli_si128(low, 8)));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16), _mm256_cvtepu8_epi32(high));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_cvtepu8_epi32(_mm_srli_si128(high, 8)));
+  // NOLINTEND(*-reinterpret-cast,*-pointer-arithmetic)
+}
+
+/// Stores the 32 bytes of `chunk` as 32 64-bit integers in `out`.
+__attribute__((target("avx2"))) inline void Widen32(__m256i chunk, std::uint64_t* out) noexcept {
+  const __m128i low{_mm256_castsi256_si128(chunk)};
+  const __m128i high{_mm256_extracti128_si256(chunk, 1)};
+  // NOLINTBEGIN(*-reinterpret-cast,*-pointer-arithmetic)
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_cvtepu8_epi64(low));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 4),
+                      _mm256_cvtepu8_epi64(_mm_srli_si128(low, 4)));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_cvtepu8_epi64(_mm_srli_si128(low, 8)));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 12),
+                      _mm256_cvtepu8_epi64(_mm_srli_si128(low, 12)));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16), _mm256_cvtepu8_epi64(high));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 20),
+                      _mm256_cvtepu8_epi64(_mm_srli_si128(high, 4)));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_cvtepu8_epi64(_mm_srli_si128(high, 8)));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 28),
+                      _mm256_cvtepu8_epi64(_mm_srli_si128(high, 12)));
+  // NOLINTEND(*-reinterpret-cast,*-pointer-arithmetic)
+}
+
+/// Implementation of `DecodeVarints()` using AVX2; see `DecodeSse41()`.
+template <class U>
+__attribute__((target("avx2"))) std::size_t DecodeAvx2(StringView data, U* out,
+                                                       std::size_t capacity) noexcept {
+  constexpr std::size_t kChunkSize{32};
+  std::size_t pos{0};
+  std::size_t count{0};
+  while (data.size() - pos >= kChunkSize && capacity - count >= kChunkSize) {
+    const __m256i chunk{Load32(data, pos)};
+    const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(chunk));
+    if (mask == 0) {
+      Widen32(chunk, out + count);  // NOLINT(*-pointer-arithmetic)
+      pos += kChunkSize;
+      count += kChunkSize;
+    } else if (!DecodeChunkScalar(data, pos, PopCount(~mask), out, count)) {
+      return count;
+    }
+  }
+  return DecodeScalar(data, pos, out, count, capacity);
+}
+
+/// Implementation of `CountVarints()` using AVX2.
+// NOLINTNEXTLINE(*-exception-escape): substr() won't fail since `pos <= data.size()`
+__attribute__((target("avx2"))) std::size_t CountAvx2(StringView data) noexcept {
+  constexpr std::size_t kChunkSize{32};
+  std::size_t pos{0};
+  std::size_t count{0};
+  for (; data.size() - pos >= kChunkSize; pos += kChunkSize) {
+    count += PopCount(~static_cast<std::uint32_t>(_mm256_movemask_epi8(Load32(data, pos))));
+  }
+  return count + CountScalar(data.substr(pos));
+}
+
+#endif  // HORUS_PB_VARINT_X86
+
+/// Detects the fastest `VarintDecoder` supported by this CPU.
+VarintDecoder DetectVarintDecoder() noexcept {
+  if (IsVarintDecoderSupported(VarintDecoder::kAvx2)) {
+    return VarintDecoder::kAvx2;
+  }
+  if (IsVarintDecoderSupported(VarintDecoder::kSse41)) {
+    return VarintDecoder::kSse41;
+  }
+  return VarintDecoder::kScalar;
+}
+
+/// Implementation of the `DecodeVarints()` overloads.
+template <class U>
+std::size_t DecodeWith(VarintDecoder decoder, StringView data, U* out,
+                       std::size_t capacity) noexcept {
+  switch (decoder) {
+    case VarintDecoder::kScalar:
+      break;
+    case VarintDecoder::kSse41:
+#if HORUS_PB_VARINT_X86
+      return DecodeSse41(data, out, capacity);
+#else
+      break;
+#endif
+    case VarintDecoder::kAvx2:
+#if HORUS_PB_VARINT_X86
+      return DecodeAvx2(data, out, capacity);
+#else
+      break;
+#endif
+  }
+  return DecodeScalar(data, 0, out, 0, capacity);
+}
+
+}  // namespace
+
+bool IsVarintDecoderSupported(VarintDecoder decoder) noexcept {
+  switch (decoder) {
+    case VarintDecoder::kScalar:
+      return true;
+    case VarintDecoder::kSse41:
+#if HORUS_PB_VARINT_X86
+      return __builtin_cpu_supports("sse4.1") != 0;
+#else
+      return false;
+#endif
+    case VarintDecoder::kAvx2:
+#if HORUS_PB_VARINT_X86
+      return __builtin_cpu_supports("avx2") != 0;
+#else
+      return false;
+#endif
+  }
+  return false;
+}
+
+VarintDecoder BestVarintDecoder() noexcept {
+  static const VarintDecoder decoder{DetectVarintDecoder()};
+  return decoder;
+}
+
+std::size_t CountVarints(StringView data) noexcept {
+#if HORUS_PB_VARINT_X86
+  switch (BestVarintDecoder()) {
+    case VarintDecoder::kScalar:
+      break;
+    case VarintDecoder::kSse41:
+      return CountSse41(data);
+    case VarintDecoder::kAvx2:
+      return CountAvx2(data);
+  }
+#endif
+  return CountScalar(data);
+}
+
+bool ValidateVarints(StringView data) noexcept {
+  std::size_t continuation_count{0};
+  for (const char c : data) {
+    if ((static_cast<std::uint8_t>(c) & kContinuationBit) == 0) {
+      continuation_count = 0;
+    } else if (++continuation_count == kMaxVarintLength) {
+      return false;
+    }
+  }
+  return continuation_count == 0;
+}
+
+std::size_t DecodeVarints(VarintDecoder decoder, StringView data, std::uint32_t* out,
+                          std::size_t capacity) noexcept {
+  return DecodeWith(decoder, data, out, capacity);
+}
+
+std::size_t DecodeVarints(VarintDecoder decoder, StringView data, std::uint64_t* out,
+                          std::size_t capacity) noexcept {
+  return DecodeWith(decoder, data, out, capacity);
+}
+
+}  // namespace horus_internal
+}  // namespace horus
@@ -0,0 +1,207 @@
+/// @file
+///
+/// Bulk decoding of packed varints.
+
+#ifndef HORUS_PB_VARINT_H_
+#define HORUS_PB_VARINT_H_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#include "horus/pointer/arithmetic.h"
+#include "horus/strings/string_view.h"
+
+namespace horus {
+namespace horus_internal {
+
+/// An implementation of `DecodeVarints()`.
+enum class VarintDecoder : std::uint8_t {
+  /// Portable implementation.
+  kScalar,
+  /// Implementation using SSE4.1 instructions, processing 16 bytes at a time.
+  kSse41,
+  /// Implementation using AVX2 instructions, processing 32 bytes at a time.
+  kAvx2,
+};
+
+/// Returns whether `decoder` can be used on this CPU.
+bool IsVarintDecoderSupported(VarintDecoder decoder) noexcept;
+
+/// Returns the fastest `VarintDecoder` supported by this CPU, detected once.
+VarintDecoder BestVarintDecoder() noexcept;
+
+/// Returns the number of varints in `data`, i.e. the number of bytes which end a varint.
+///
+/// A truncated varint at the end of `data` is not counted.
+std::size_t CountVarints(StringView data) noexcept;
+
+/// Returns whether `data` only contains complete varints of at most 10 bytes, i.e. whether it is a
+/// valid packed varint field which can be iterated with `UncheckedVarintIterator`.
+bool ValidateVarints(StringView data) noexcept;
+
+/// Decodes up to `capacity` varints from `data` into `out` using `decoder`, which must be
+/// supported. Returns the number of decoded varints.
+///
+/// Varints whose values do not fit in 32 bits are truncated, which matches protobuf semantics for
+/// `int32` and `uint32` fields. A truncated varint at the end of `data` is ignored.
+std::size_t DecodeVarints(VarintDecoder decoder, StringView data, std::uint32_t* out,
+                          std::size_t capacity) noexcept;
+
+/// @copydoc DecodeVarints(VarintDecoder, StringView, std::uint32_t*, std::size_t)
+std::size_t DecodeVarints(VarintDecoder decoder, StringView data, std::uint64_t* out,
+                          std::size_t capacity) noexcept;
+
+/// Decodes up to `capacity` packed varints from `data` into `out` with the `BestVarintDecoder()`,
+/// converting them to `T` (an integer, `bool` or enum type). Returns the number of decoded values.
+template <class T>
+std::size_t DecodePackedVarints(StringView data, T* out, std::size_t capacity) noexcept;
+
+// MARK: Template definitions
+
+namespace varint_internal {
+
+/// Unsigned integer type into which varints of type `T` are decoded.
+template <class T>
+using DecodedT = std::conditional_t<sizeof(T) <= sizeof(std::uint32_t), std::uint32_t,
+                                    std::uint64_t>;
+
+/// Converts a decoded varint to `T`.
+template <class T>
+constexpr T ConvertVarint(DecodedT<T> value) noexcept {
+  return static_cast<T>(static_cast<std::make_signed_t<DecodedT<T>>>(value));
+}
+
+/// Converts a decoded varint to `bool`.
+template <>
+constexpr bool ConvertVarint<bool>(std::uint32_t value) noexcept {
+  return value != 0;
+}
+
+/// Decodes varints directly into `out`, which is possible for integers of the decoded size since
+/// signed and unsigned variants of the same integer may alias each other.
+template <class T, std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+                                    sizeof(T) == sizeof(DecodedT<T>)>* = nullptr>
+std::size_t DecodeInto(StringView data, T* out, std::size_t capacity) noexcept {
+  // NOLINTNEXTLINE(*-reinterpret-cast): signed/unsigned variants of an integer may alias
+  return DecodeVarints(BestVarintDecoder(), data, reinterpret_cast<DecodedT<T>*>(out), capacity);
+}
+
+/// Decodes varints into a temporary buffer, then converts them to `T`.
+// NOLINTNEXTLINE(*-exception-escape): substr() won't fail since `chunk_end <= data.size()`
+template <class T, std::enable_if_t<!std::is_integral<T>::value || std::is_same<T, bool>::value ||
+                                    sizeof(T) != sizeof(DecodedT<T>)>* = nullptr>
+std::size_t DecodeInto(StringView data, T* out, std::size_t capacity) noexcept {
+  constexpr std::size_t kChunkSize{256};
+  std::array<DecodedT<T>, kChunkSize> chunk;  // NOLINT(*-member-init): written before read
+  const VarintDecoder decoder{BestVarintDecoder()};
+  std::size_t count{0};
+  while (count < capacity && !data.empty()) {
+    const std::size_t to_decode{std::min(kChunkSize, capacity - count)};
+    // Find the end of the `to_decode`-th varint so that the next chunk starts after it.
+    std::size_t chunk_end{0};
+    for (std::size_t varints{0}; chunk_end < data.size() && varints < to_decode; ++chunk_end) {
+      if ((static_cast<std::uint8_t>(data[chunk_end]) & 0x80U) == 0) {
+        ++varints;
+      }
+    }
+    const std::size_t decoded{
+        DecodeVarints(decoder, data.substr(0, chunk_end), chunk.data(), to_decode)};
+    for (std::size_t i{0}; i < decoded; ++i) {
+      out[count + i] = ConvertVarint<T>(chunk[i]);  // NOLINT(*-pointer-arithmetic)
+    }
+    count += decoded;
+    if (decoded == 0) {
+      break;
+    }
+    data = data.substr(chunk_end);
+  }
+  return count;
+}
+
+}  // namespace varint_internal
+
+/// Decodes the varint at `pos`, which must be complete (e.g. checked with `ValidateVarints()`),
+/// and advances `pos` past it.
+inline std::uint64_t DecodeUncheckedVarint(const char*& pos) noexcept {
+  std::uint64_t value{0};
+  for (unsigned shift{0};; shift += 7) {
+    const std::uint64_t byte{static_cast<std::uint8_t>(*pos)};
+    pos = PointerAdd(pos, 1);
+    value |= (byte & 0x7FU) << shift;
+    if ((byte & 0x80U) == 0) {
+      return value;
+    }
+  }
+}
+
+/// An iterator over packed varints converted to `T`, which decodes them without bounds checks since
+/// they were checked with `ValidateVarints()`.
+template <class T>
+class UncheckedVarintIterator final {
+ public:
+  /// Iterator category.
+  using iterator_category = std::forward_iterator_tag;
+  /// Iterator difference type.
+  using difference_type = std::ptrdiff_t;
+  /// Iterator value type.
+  using value_type = T;
+  /// Iterator reference type; values are decoded on access, so they are returned by value.
+  using reference = T;
+  /// Iterator pointer type; unsupported.
+  using pointer = void;
+
+  /// Constructs an iterator which points to `pos`, the start of a varint or the end of data
+  /// validated by `ValidateVarints()`.
+  explicit UncheckedVarintIterator(const char* pos) noexcept : pos_{pos} {}
+
+  /// Returns the current value.
+  T operator*() const noexcept {
+    const char* pos{pos_};
+    return varint_internal::ConvertVarint<T>(
+        static_cast<varint_internal::DecodedT<T>>(DecodeUncheckedVarint(pos)));
+  }
+
+  /// Advances to the next value (`++it`).
+  UncheckedVarintIterator& operator++() noexcept {
+    while ((static_cast<std::uint8_t>(*pos_) & 0x80U) != 0) {
+      pos_ = PointerAdd(pos_, 1);
+    }
+    pos_ = PointerAdd(pos_, 1);
+    return *this;
+  }
+
+  /// Returns whether `lhs` and `rhs` are equal.
+  friend bool operator==(UncheckedVarintIterator lhs, UncheckedVarintIterator rhs) noexcept {
+    return lhs.pos_ == rhs.pos_;
+  }
+
+  /// Returns whether `lhs` and `rhs` are not equal.
+  friend bool operator!=(UncheckedVarintIterator lhs, UncheckedVarintIterator rhs) noexcept {
+    return lhs.pos_ != rhs.pos_;
+  }
+
+  /// Returns the number of values between `rhs` and `lhs`, which must not point before `rhs`.
+  friend difference_type operator-(UncheckedVarintIterator lhs,
+                                   UncheckedVarintIterator rhs) noexcept {
+    return static_cast<difference_type>(
+        CountVarints(StringView{rhs.pos_, PointerDist(rhs.pos_, lhs.pos_)}));
+  }
+
+ private:
+  /// The start of the current varint.
+  const char* pos_;
+};
+
+template <class T>
+std::size_t DecodePackedVarints(StringView data, T* out, std::size_t capacity) noexcept {
+  return varint_internal::DecodeInto(data, out, capacity);
+}
+
+}  // namespace horus_internal
+}  // namespace horus
+
+#endif  // HORUS_PB_VARINT_H_
@@ -0,0 +1,170 @@
+#include "horus/pb/varint.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "horus/pointer/arithmetic.h"
+#include "horus/strings/string_view.h"
+
+namespace horus {
+namespace horus_internal {
+namespace {
+
+using ::testing::ElementsAre;
+
+/// Appends the varint encoding of `value` to `out`.
+void AppendVarint(std::string& out, std::uint64_t value) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<char>(value));
+}
+
+/// Returns the encoding of `count` random varints, most of which fit in a single byte.
+std::string RandomVarints(std::size_t count, std::vector<std::uint64_t>& values) {
+  std::mt19937_64 random{count};
+  std::string out;
+  for (std::size_t i{0}; i < count; ++i) {
+    std::uint64_t value{random()};
+    switch (random() % 8) {
+      case 0:
+        break;  // Full 64-bit value.
+      case 1:
+        value &= 0xFFFF;
+        break;
+      default:
+        value &= 0x7F;
+        break;
+    }
+    values.push_back(value);
+    AppendVarint(out, value);
+  }
+  return out;
+}
+
+/// Returns all the supported `VarintDecoder`s.
+std::vector<VarintDecoder> SupportedDecoders() {
+  std::vector<VarintDecoder> decoders;
+  for (const VarintDecoder decoder :
+       {VarintDecoder::kScalar, VarintDecoder::kSse41, VarintDecoder::kAvx2}) {
+    if (IsVarintDecoderSupported(decoder)) {
+      decoders.push_back(decoder);
+    }
+  }
+  return decoders;
+}
+
+TEST(Varint, Count) {
+  std::vector<std::uint64_t> values;
+  const std::string data{RandomVarints(1000, values)};
+  EXPECT_EQ(CountVarints(data), 1000);
+  EXPECT_EQ(CountVarints(StringView{data}.substr(0, data.size() - 1)), 999);
+  EXPECT_EQ(CountVarints(""), 0);
+}
+
+TEST(Varint, AllDecodersMatch) {
+  for (const std::size_t count : {0, 1, 15, 16, 17, 31, 32, 33, 100, 1000}) {
+    std::vector<std::uint64_t> values;
+    const std::string data{RandomVarints(count, values)};
+    std::vector<std::uint32_t> values32;
+    for (const std::uint64_t value : values) {
+      values32.push_back(static_cast<std::uint32_t>(value));
+    }
+
+    for (const VarintDecoder decoder : SupportedDecoders()) {
+      std::vector<std::uint64_t> out64(count);
+      EXPECT_EQ(DecodeVarints(decoder, data, out64.data(), out64.size()), count);
+      EXPECT_EQ(out64, values);
+
+      std::vector<std::uint32_t> out32(count);
+      EXPECT_EQ(DecodeVarints(decoder, data, out32.data(), out32.size()), count);
+      EXPECT_EQ(out32, values32);
+    }
+  }
+}
+
+TEST(Varint, RespectsCapacity) {
+  const std::string data(100, '\x01');
+  for (const VarintDecoder decoder : SupportedDecoders()) {
+    std::vector<std::uint32_t> out(40, 0);
+    EXPECT_EQ(DecodeVarints(decoder, data, out.data(), 33), 33);
+    EXPECT_EQ(out[32], 1);
+    EXPECT_EQ(out[33], 0);
+  }
+}
+
+TEST(Varint, IgnoresTruncatedVarint) {
+  std::string data(40, '\x02');
+  data.push_back('\x80');
+  for (const VarintDecoder decoder : SupportedDecoders()) {
+    std::vector<std::uint64_t> out(64);
+    EXPECT_EQ(DecodeVarints(decoder, data, out.data(), out.size()), 40);
+  }
+}
+
+TEST(Varint, DecodePackedConvertsValues) {
+  enum class Color : std::int32_t { kRed = 0, kGreen = 1, kBlue = 2 };
+
+  std::string data;
+  AppendVarint(data, 2);
+  AppendVarint(data, 0);
+  AppendVarint(data, static_cast<std::uint64_t>(std::int64_t{-1}));
+
+  std::vector<std::int32_t> ints(3);
+  EXPECT_EQ(DecodePackedVarints(data, ints.data(), ints.size()), 3);
+  EXPECT_THAT(ints, ElementsAre(2, 0, -1));
+
+  std::vector<std::int64_t> longs(3);
+  EXPECT_EQ(DecodePackedVarints(data, longs.data(), longs.size()), 3);
+  EXPECT_THAT(longs, ElementsAre(2, 0, -1));
+
+  bool bools[3]{};  // NOLINT(*-avoid-c-arrays)
+  EXPECT_EQ(DecodePackedVarints(data, bools, 3), 3);
+  EXPECT_THAT(bools, ElementsAre(true, false, true));
+
+  std::vector<Color> colors(2);
+  EXPECT_EQ(DecodePackedVarints(data, colors.data(), colors.size()), 2);
+  EXPECT_THAT(colors, ElementsAre(Color::kBlue, Color::kRed));
+}
+
+TEST(Varint, Validate) {
+  std::vector<std::uint64_t> values;
+  EXPECT_TRUE(ValidateVarints(RandomVarints(1000, values)));
+  EXPECT_TRUE(ValidateVarints(""));
+  // Truncated.
+  EXPECT_FALSE(ValidateVarints("\x02\x80"));
+  // Too long.
+  EXPECT_TRUE(ValidateVarints(std::string(9, '\x80') + '\x01'));
+  EXPECT_FALSE(ValidateVarints(std::string(10, '\x80') + '\x01'));
+}
+
+TEST(Varint, UncheckedIteratorMatchesDecoding) {
+  std::vector<std::uint64_t> values;
+  const std::string data{RandomVarints(1000, values)};
+  ASSERT_TRUE(ValidateVarints(data));
+
+  const UncheckedVarintIterator<std::uint64_t> begin{data.data()};
+  const UncheckedVarintIterator<std::uint64_t> end{PointerAdd(data.data(), data.size())};
+  EXPECT_EQ(end - begin, 1000);
+  EXPECT_EQ(std::vector<std::uint64_t>(begin, end), values);
+
+  std::string signed_data;
+  AppendVarint(signed_data, static_cast<std::uint64_t>(std::int64_t{-1}));
+  AppendVarint(signed_data, 3);
+  UncheckedVarintIterator<std::int32_t> it{signed_data.data()};
+  EXPECT_EQ(*it, -1);
+  EXPECT_EQ(*++it, 3);
+  EXPECT_EQ(++it, UncheckedVarintIterator<std::int32_t>{
+                      PointerAdd(signed_data.data(), signed_data.size())});
+}
+
+}  // namespace
+}  // namespace horus_internal
+}  // namespace horus
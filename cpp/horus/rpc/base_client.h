@@ -11,6 +11,7 @@
 
 #include "horus/future/any.h"
 #include "horus/future/map.h"
+#include "horus/pb/buffer.h"
 #include "horus/pb/cow_bytes.h"
 #include "horus/pb/message.h"
 #include "horus/pb/rpc/message_pb.h"
@@ -57,13 +58,20 @@ class RpcBaseClient {
 
   /// Sends the given `request` to the underlying endpoint as a call to the specified method,
   /// returning a future which will complete with the response.
+  ///
+  /// The future fails with `InvalidDataError` if the response is not a valid `Response`.
   template <class Response>
   AnyFuture<Response> InvokeRpc(std::uint16_t method_id, const PbMessage& request,
                                 const RpcOptions& options) {
-    return Map(endpoint_->SendWithResponse(MakeRequestMessage(method_id, request), options),
+    return Map(endpoint_->SendSegmentsWithResponse(MakeRequestMessage(method_id),
+                                                   request.SerializeToSegments(), options),
                [](sdk::pb::RpcMessage&& message) -> Response {
                  sdk::pb::RpcMessage owned_message{std::move(message)};
-                 PbReader reader{std::move(owned_message.mutable_message_bytes()).View()};
+                 PbView view{std::move(owned_message.mutable_message_bytes()).View()};
+                 if (!view.Validate<Response>()) {
+                   throw InvalidDataError{view.Str()};
+                 }
+                 PbReader reader{std::move(view)};
                  return Response{reader};
                });
   }
@@ -72,12 +80,15 @@ class RpcBaseClient {
   /// returning a future which will complete when the message has been sent.
   AnyFuture<void> InvokeOneWayRpc(std::uint16_t method_id, const PbMessage& request,
                                   const RpcOptions& options) {
-    return endpoint_->Send(MakeRequestMessage(method_id, request), options);
+    return endpoint_->SendSegments(MakeRequestMessage(method_id), request.SerializeToSegments(),
+                                   options);
   }
 
  private:
-  /// Constructs a `RpcMessage` which can be given to `Invoke*Rpc()`.
-  sdk::pb::RpcMessage MakeRequestMessage(std::uint16_t method_id, const PbMessage& request) const;
+  /// Constructs a `RpcMessage` which can be given to `Invoke*Rpc()`, without its `message_bytes`
+  /// which are given separately to `RpcEndpoint::SendSegments*()` so that large fields of the
+  /// request are not copied.
+  sdk::pb::RpcMessage MakeRequestMessage(std::uint16_t method_id) const;
 
   /// The endpoint to communicate with.
   std::shared_ptr<RpcEndpoint> endpoint_;
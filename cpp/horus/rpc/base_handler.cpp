@@ -1,7 +1,11 @@
 #include "horus/rpc/base_handler.h"
 
 #include <cstddef>
+#include <memory>
+#include <utility>
 
+#include "horus/pb/field_mask.h"
+#include "horus/pb/serialize.h"
 #include "horus/strings/string_view.h"
 
 namespace horus {
@@ -14,5 +18,25 @@ StringView RpcBaseHandler::ServiceName() const noexcept {
                                            : service_full_name.substr(separator_pos + 1);
 }
 
+const void* RpcBaseHandler::FindRequestPool(StringView request_type_name) const noexcept {
+  for (const std::pair<StringView, std::shared_ptr<const void>>& entry : request_pools_) {
+    if (entry.first == request_type_name) {
+      return entry.second.get();
+    }
+  }
+  return nullptr;
+}
+
+void RpcBaseHandler::ApplyRequestFieldMask(PbReader& reader,
+                                           StringView request_type_name) const noexcept {
+  for (const std::pair<StringView, std::shared_ptr<const PbSkippedTags>>& entry :
+       request_field_masks_) {
+    if (entry.first == request_type_name) {
+      reader.SetSkippedTags(*entry.second);
+      return;
+    }
+  }
+}
+
 }  // namespace horus_internal
 }  // namespace horus
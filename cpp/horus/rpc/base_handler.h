@@ -6,16 +6,21 @@
 #define HORUS_RPC_BASE_HANDLER_H_
 
 #include <cstdint>
+#include <memory>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "horus/future/any.h"
 #include "horus/future/future.h"
 #include "horus/future/map.h"
 #include "horus/future/resolved.h"
 #include "horus/internal/type_traits.h"
+#include "horus/pb/buffer.h"
 #include "horus/pb/cow_bytes.h"
+#include "horus/pb/field_mask.h"
+#include "horus/pb/pool.h"
 #include "horus/pb/rpc/message_pb.h"
 #include "horus/pb/serialize.h"
 #include "horus/rpc/endpoint.h"
@@ -62,6 +67,44 @@ class RpcBaseHandler {
   virtual AnyFuture<sdk::pb::RpcMessage> Handle(const RpcContext& context,
                                                 sdk::pb::RpcMessage&& request) noexcept(false) = 0;
 
+  /// Deserializes the received requests of type `T` without the fields skipped by `*mask`.
+  ///
+  /// `*mask` is read whenever such a request is received, so it may be updated later from the
+  /// thread which handles requests.
+  ///
+  /// @throws std::bad_alloc If the mask cannot be registered.
+  template <class T>
+  void SetRequestFieldMask(std::shared_ptr<const PbFieldMask<T>> mask) noexcept(false) {
+    std::shared_ptr<const PbSkippedTags> skipped_tags{mask, &mask->SkippedTags()};
+    for (std::pair<StringView, std::shared_ptr<const PbSkippedTags>>& entry :
+         request_field_masks_) {
+      if (entry.first == T::TypeName()) {
+        entry.second = std::move(skipped_tags);
+        return;
+      }
+    }
+    request_field_masks_.emplace_back(T::TypeName(), std::move(skipped_tags));
+  }
+
+  /// Deserializes the received requests of type `T` into messages acquired from `**pool`, if
+  /// non-null, so that the functions handling them may release them to `**pool` once done.
+  ///
+  /// `*pool` is read whenever such a request is received, so it may be updated later from the
+  /// thread which handles requests.
+  ///
+  /// @throws std::bad_alloc If the pool cannot be registered.
+  template <class T>
+  void SetRequestPool(std::shared_ptr<const std::shared_ptr<PbMessagePool<T>>> pool) noexcept(
+      false) {
+    for (std::pair<StringView, std::shared_ptr<const void>>& entry : request_pools_) {
+      if (entry.first == T::TypeName()) {
+        entry.second = std::move(pool);
+        return;
+      }
+    }
+    request_pools_.emplace_back(T::TypeName(), std::move(pool));
+  }
+
  protected:
   /// Movable.
   RpcBaseHandler(RpcBaseHandler&&) = default;
@@ -69,31 +112,81 @@ class RpcBaseHandler {
   RpcBaseHandler& operator=(RpcBaseHandler&&) = default;
 
   /// Calls `handle` with the request stored in `request_message`.
+  ///
+  /// @throws InvalidDataError If the request is not a valid `Request`.
   template <class Self, class Request>
   AnyFuture<sdk::pb::RpcMessage> DoDispatch(
       AnyFuture<void> (Self::*handle)(const RpcContext&, Request&&), const RpcContext& context,
       const sdk::pb::RpcMessage& request_message) noexcept(false) {
-    PbReader reader{request_message.message_bytes().View()};
-    return Map((static_cast<Self*>(this)->*handle)(context, Request{reader}),
+    PbReader reader{ValidatedRequestView<Request>(request_message)};
+    ApplyRequestFieldMask(reader, Request::TypeName());
+    Request request{AcquireRequest<Request>()};
+    request.DeserializeFrom(reader);
+    return Map((static_cast<Self*>(this)->*handle)(context, std::move(request)),
                []() noexcept -> sdk::pb::RpcMessage { return {}; });
   }
 
   /// Calls `handle` with the request stored in `request_message` and returns a response message.
+  ///
+  /// @throws InvalidDataError If the request is not a valid `Request`.
   template <class Self, class Request, class Response>
   AnyFuture<sdk::pb::RpcMessage> DoDispatch(
       AnyFuture<Response> (Self::*handle)(const RpcContext&, Request&&), const RpcContext& context,
       const sdk::pb::RpcMessage& request_message) noexcept(false) {
-    PbReader reader{request_message.message_bytes().View()};
+    PbReader reader{ValidatedRequestView<Request>(request_message)};
+    ApplyRequestFieldMask(reader, Request::TypeName());
     sdk::pb::RpcMessage response_message{sdk::pb::RpcMessage{}
                                              .set_version(sdk::pb::RpcMessage::Version::kOne)
                                              .set_request_id(request_message.request_id())};
-    return Map((static_cast<Self*>(this)->*handle)(context, Request{reader}),
+    Request request{AcquireRequest<Request>()};
+    request.DeserializeFrom(reader);
+    return Map((static_cast<Self*>(this)->*handle)(context, std::move(request)),
                [inner_response_message{std::move(response_message)}](
                    const Response& response) mutable -> sdk::pb::RpcMessage {
                  inner_response_message.set_message_bytes(CowBytes{response.SerializeToBuffer()});
                  return std::move(inner_response_message);
                });
   }
+
+ private:
+  /// Returns the view of the request stored in `request_message`, checked once with
+  /// `PbView::Validate()` so that it is then decoded without further checks.
+  ///
+  /// @throws InvalidDataError If the request is not a valid `Request`.
+  template <class Request>
+  static PbView ValidatedRequestView(const sdk::pb::RpcMessage& request_message) noexcept(false) {
+    PbView view{request_message.message_bytes().View()};
+    if (!view.Validate<Request>()) {
+      throw InvalidDataError{view.Str()};
+    }
+    return view;
+  }
+
+  /// Returns a message acquired from the pool given to `SetRequestPool()` for requests of type
+  /// `T`, or a default-initialized message if there is no such pool.
+  template <class T>
+  T AcquireRequest() const noexcept {
+    const void* const pool{FindRequestPool(T::TypeName())};
+    if (pool == nullptr) {
+      return T{};
+    }
+    const std::shared_ptr<PbMessagePool<T>>& typed_pool{
+        *static_cast<const std::shared_ptr<PbMessagePool<T>>*>(pool)};
+    return typed_pool == nullptr ? T{} : typed_pool->Acquire();
+  }
+
+  /// Returns the pool given to `SetRequestPool()` for requests named `request_type_name` (as a
+  /// pointer to a `std::shared_ptr<PbMessagePool<T>>`), or null if there is none.
+  const void* FindRequestPool(StringView request_type_name) const noexcept;
+
+  /// Applies the mask given to `SetRequestFieldMask()` for requests named `request_type_name`, if
+  /// any, to `reader`.
+  void ApplyRequestFieldMask(PbReader& reader, StringView request_type_name) const noexcept;
+
+  /// The masks given to `SetRequestFieldMask()`, keyed by the name of the request type.
+  std::vector<std::pair<StringView, std::shared_ptr<const PbSkippedTags>>> request_field_masks_;
+  /// The pools given to `SetRequestPool()`, keyed by the name of the request type.
+  std::vector<std::pair<StringView, std::shared_ptr<const void>>> request_pools_;
 };
 
 /// Invokes `invocable(args...)`, returning its result as a `AnyFuture<R>`.
@@ -10,7 +10,9 @@
 
 #include "horus/future/any.h"
 #include "horus/future/resolved.h"
+#include "horus/pb/cow_bytes.h"
 #include "horus/pb/rpc/message_pb.h"
+#include "horus/pb/segments.h"
 #include "horus/strings/string_view.h"
 
 namespace horus {
@@ -115,6 +117,20 @@ std::string MakeInvalidDataErrorString(StringView invalid_message_bytes) noexcep
 InvalidDataError::InvalidDataError(StringView invalid_message_bytes)
     : std::runtime_error{MakeInvalidDataErrorString(invalid_message_bytes)} {}
 
+AnyFuture<void> RpcEndpoint::SendSegments(sdk::pb::RpcMessage&& message,
+                                          PbSegments&& message_bytes,
+                                          const RpcOptions& options) noexcept(false) {
+  message.set_message_bytes(CowBytes{std::move(message_bytes).Gather()});
+  return Send(std::move(message), options);
+}
+
+AnyFuture<sdk::pb::RpcMessage> RpcEndpoint::SendSegmentsWithResponse(
+    sdk::pb::RpcMessage&& message, PbSegments&& message_bytes,
+    const RpcOptions& options) noexcept(false) {
+  message.set_message_bytes(CowBytes{std::move(message_bytes).Gather()});
+  return SendWithResponse(std::move(message), options);
+}
+
 MessageHandler NoMessageHandler() noexcept {
   return +[](const RpcContext& /* context */,
              sdk::pb::RpcMessage&& message) -> AnyFuture<sdk::pb::RpcMessage> {
@@ -17,6 +17,7 @@
 #include "horus/functional/move_only_function.h"
 #include "horus/future/any.h"
 #include "horus/pb/rpc/message_pb.h"
+#include "horus/pb/segments.h"
 #include "horus/pointer/unsafe_cast.h"
 #include "horus/rpc/retry_policy.h"
 #include "horus/strings/string_view.h"
@@ -143,6 +144,31 @@ class RpcEndpoint {
   virtual AnyFuture<sdk::pb::RpcMessage> SendWithResponse(
       sdk::pb::RpcMessage&& message, const RpcOptions& options) noexcept(false) = 0;
 
+  /// Same as `Send()`, but with the `message_bytes` of the `message` given as `PbSegments` (see
+  /// `PbMessage::SerializeToSegments()`), which may reference large buffers rather than copy them.
+  ///
+  /// The default implementation gathers `message_bytes` into `message.message_bytes()`; endpoints
+  /// may instead only gather them when writing to their transport.
+  ///
+  /// @throws std::exception Any exception encountered while sending the `message`.
+  /// @throws std::bad_alloc If the resulting future cannot be allocated.
+  /// @throws RpcEndpointDisconnectedError Exception thrown when the endpoint is no longer connected
+  /// to its target.
+  virtual AnyFuture<void> SendSegments(sdk::pb::RpcMessage&& message, PbSegments&& message_bytes,
+                                       const RpcOptions& options) noexcept(false);
+
+  /// Same as `SendWithResponse()`, but with the `message_bytes` of the `message` given as
+  /// `PbSegments`. See `SendSegments()`.
+  ///
+  /// @throws std::exception Any exception encountered while sending the `message` or receiving its
+  /// response.
+  /// @throws std::bad_alloc If the resulting future cannot be allocated.
+  /// @throws RpcEndpointDisconnectedError Exception thrown when the endpoint is no longer connected
+  /// to its target.
+  virtual AnyFuture<sdk::pb::RpcMessage> SendSegmentsWithResponse(
+      sdk::pb::RpcMessage&& message, PbSegments&& message_bytes,
+      const RpcOptions& options) noexcept(false);
+
   /// Sets the function to call when the lifecycle of the endpoint changes.
   ///
   /// The reference to the `receiver` must outlive the `RpcEndpoint`.
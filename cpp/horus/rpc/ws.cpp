@@ -8,6 +8,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <bitset>
 #include <cassert>
 #include <chrono>
@@ -43,6 +44,8 @@
 #include "horus/pb/buffer.h"
 #include "horus/pb/cow_bytes.h"
 #include "horus/pb/rpc/message_pb.h"
+#include "horus/pb/segments.h"
+#include "horus/pb/types.h"
 #include "horus/pb/serialize.h"
 #include "horus/rpc/endpoint.h"
 #include "horus/rpc/retry_policy.h"
@@ -64,6 +67,34 @@ std::string AddressPortPairToUrl(StringView address, std::uint16_t port) {
 
 namespace {
 
+/// Tag of `RpcMessage.message_bytes`.
+constexpr PbTag kRpcMessageBytesTag{3};
+
+/// Total number of bytes copied by `AdoptFramePayload()`. See `WebSocketBytesCopiedOnReceive()`.
+std::atomic<std::uint64_t> bytes_copied_on_receive{0};
+
+/// Takes ownership of the payload of a received `message` without copying it, and returns it as a
+/// `PbBuffer`.
+///
+/// `ix::WebSocketMessage::str` is a `const std::string&`, but it refers to a string which the
+/// transport allocated for this message only (the unmasked frame payload, or the concatenation of
+/// its fragments) and discards once the message callback returns, so we can safely move out of it.
+/// The only exception is the buffer used for decompression, which is reused across messages, but
+/// we disable per-message deflate in `Initialize()`.
+PbBuffer AdoptFramePayload(const ix::WebSocketMessage& message) noexcept(false) {
+  // NOLINTNEXTLINE(*-const-cast): see above.
+  std::string& payload{const_cast<std::string&>(message.str)};
+  const char* const payload_data{payload.data()};
+  std::size_t const payload_size{payload.size()};
+
+  PbBuffer buffer{std::move(payload)};
+  if (buffer.Str().data() != payload_data) {
+    // Short strings are stored inline in `std::string`, and are therefore copied when moved.
+    static_cast<void>(bytes_copied_on_receive.fetch_add(payload_size, std::memory_order_relaxed));
+  }
+  return buffer;
+}
+
 /// Implementation of an `RpcEndpoint` which sends and receives data through WebSockets.
 class WebSocketRpcEndpoint final : public RpcEndpoint {
  public:
@@ -106,13 +137,29 @@ class WebSocketRpcEndpoint final : public RpcEndpoint {
 
   /// @copydoc RpcEndpoint::Send()
   AnyFuture<void> Send(pb::RpcMessage&& message, const RpcOptions& options) noexcept(false) final {
-    return SendImpl<void>(std::move(message), options);
+    return SendImpl<void>(std::move(message), OneOf<void, PbSegments>{InPlaceType<void>},
+                          options);
   }
 
   /// @copydoc RpcEndpoint::SendWithResponse()
   AnyFuture<pb::RpcMessage> SendWithResponse(pb::RpcMessage&& message,
                                              const RpcOptions& options) noexcept(false) final {
-    return SendImpl<pb::RpcMessage>(std::move(message), options);
+    return SendImpl<pb::RpcMessage>(std::move(message),
+                                    OneOf<void, PbSegments>{InPlaceType<void>}, options);
+  }
+
+  /// @copydoc RpcEndpoint::SendSegments()
+  AnyFuture<void> SendSegments(pb::RpcMessage&& message, PbSegments&& message_bytes,
+                               const RpcOptions& options) noexcept(false) final {
+    return SendImpl<void>(std::move(message), std::move(message_bytes), options);
+  }
+
+  /// @copydoc RpcEndpoint::SendSegmentsWithResponse()
+  AnyFuture<pb::RpcMessage> SendSegmentsWithResponse(pb::RpcMessage&& message,
+                                                     PbSegments&& message_bytes,
+                                                     const RpcOptions& options) noexcept(false)
+      final {
+    return SendImpl<pb::RpcMessage>(std::move(message), std::move(message_bytes), options);
   }
 
   /// @copydoc RpcEndpoint::SetLifecycleEventCallback()
@@ -139,6 +186,10 @@ class WebSocketRpcEndpoint final : public RpcEndpoint {
     ///
     /// If this is `Continuation<void>`, this is a one-way RPC. Otherwise, this is a two-way RPC.
     OneOf<void, Continuation<void>, Continuation<pb::RpcMessage>> continuation;
+
+    /// The `message_bytes` of `message`, if they were given separately to `SendSegments()` or
+    /// `SendSegmentsWithResponse()`. They are only gathered when writing to the `websocket_`.
+    OneOf<void, PbSegments> message_bytes{InPlaceType<void>};
   };
 
   /// A pending response to receive.
@@ -188,10 +239,11 @@ class WebSocketRpcEndpoint final : public RpcEndpoint {
   static void HandleRequestMessage(std::shared_ptr<WebSocketRpcEndpoint>&& self,
                                    pb::RpcMessage&& request_message);
 
-  /// Common implementation of `Send()` and `SendWithResponse()`.
+  /// Common implementation of `Send()`, `SendWithResponse()`, `SendSegments()` and
+  /// `SendSegmentsWithResponse()`.
   template <class T>
-  AnyFuture<T> SendImpl(pb::RpcMessage&& message, const RpcOptions& options) noexcept(false)
-      HORUS_SDK_EXCLUDES(send_mtx_);
+  AnyFuture<T> SendImpl(pb::RpcMessage&& message, OneOf<void, PbSegments>&& message_bytes,
+                        const RpcOptions& options) noexcept(false) HORUS_SDK_EXCLUDES(send_mtx_);
 
   /// Cancels all pending continuations due to a disconnection.
   void CancelPending() noexcept HORUS_SDK_EXCLUDES(send_mtx_);
@@ -327,11 +379,15 @@ void WebSocketRpcEndpoint::Initialize(std::shared_ptr<WebSocketRpcEndpoint> self
           return;
         }
 
-        // Deserialize message.
+        // Validate and deserialize message. The resulting `rpc_message` (and any view within it)
+        // refers directly to the received frame.
         pb::RpcMessage rpc_message;
         try {
-          PbBuffer buffer{std::string{message->str}};
-          PbReader reader{PbView{std::move(buffer)}};
+          PbView frame{AdoptFramePayload(*message)};
+          if (!frame.Validate<pb::RpcMessage>()) {
+            throw InvalidDataError{frame.Str()};
+          }
+          PbReader reader{std::move(frame)};
           rpc_message.DeserializeFrom(reader);
         } catch (...) {
           DeliverEvent(std::move(self), ErrorEvent{std::current_exception()});
@@ -503,6 +559,7 @@ void WebSocketRpcEndpoint::HandleRequestMessage(std::shared_ptr<WebSocketRpcEndp
 
 template <class T>
 AnyFuture<T> WebSocketRpcEndpoint::SendImpl(pb::RpcMessage&& message,
+                                            OneOf<void, PbSegments>&& message_bytes,
                                             const RpcOptions& options) noexcept(false) {
   RpcRetryPolicy::DeadlineClock::time_point const deadline{options.retry_policy.deadline};
 
@@ -524,7 +581,8 @@ AnyFuture<T> WebSocketRpcEndpoint::SendImpl(pb::RpcMessage&& message,
   auto future_and_continuation = FromContinuation<T>();
 
   send_queue_.push_back(PendingRequest{std::move(message), options.retry_policy,
-                                       std::move(future_and_continuation.second)});
+                                       std::move(future_and_continuation.second),
+                                       std::move(message_bytes)});
   send_cv_.notify_one();
 
   if (options.retry_policy.deadline == RpcRetryPolicy::DeadlineClock::time_point::max()) {
@@ -637,7 +695,13 @@ void WebSocketRpcEndpoint::RunSendThread() noexcept {
         continue;
       }
       try {
-        data = to_send.message.SerializeToBuffer();
+        // IXWebSocket needs a contiguous payload, so segments referencing large `PbView`s are
+        // gathered here, once, rather than when building the `RpcMessage`.
+        PbSegments segments{to_send.message.SerializeToSegments()};
+        if (const PbSegments* const message_bytes{to_send.message_bytes.TryAs<PbSegments>()}) {
+          segments.AppendLengthDelimited(kRpcMessageBytesTag, *message_bytes);
+        }
+        data = std::move(segments).Gather();
         break;
       } catch (const std::bad_alloc& e) {
         if (!keep_retrying()) {
@@ -770,6 +834,10 @@ class WebSocketConnectLifecycleCallback final {
 
 }  // namespace
 
+std::uint64_t WebSocketBytesCopiedOnReceive() noexcept {
+  return bytes_copied_on_receive.load(std::memory_order_relaxed);
+}
+
 std::shared_ptr<RpcEndpoint> WebSocketConnect(horus_internal::EventLoop& event_loop,
                                               std::string&& url,
                                               MessageHandler&& message_handler) noexcept(false) {
@@ -23,6 +23,12 @@ std::string AddressPortPairToUrl(StringView address, std::uint16_t port);
 
 }  // namespace horus_internal
 
+/// Returns the total number of bytes copied when receiving WebSocket messages in this process.
+///
+/// Received frames are normally adopted by the deserialized messages with no copy, so this only
+/// grows when receiving messages small enough to be stored inline in a `std::string`.
+std::uint64_t WebSocketBytesCopiedOnReceive() noexcept;
+
 /// Returns an `RpcEndpoint` which connects via WebSocket to the given URL.
 std::shared_ptr<RpcEndpoint> WebSocketConnect(horus_internal::EventLoop& event_loop,
                                               std::string&& url,
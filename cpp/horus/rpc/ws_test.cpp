@@ -5,7 +5,10 @@
 #include <ixwebsocket/IXWebSocketMessage.h>
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "horus/future/any.h"
@@ -127,5 +130,60 @@ TEST(WebSockets, Rpc) {
   EXPECT_TRUE(received_log);
 }
 
+TEST(WebSockets, LargeMessagesAreNotCopiedOnReceive) {
+  constexpr std::size_t kMessageSize{1 << 20};
+  const std::string large_message(kMessageSize, 'x');
+
+  // Server-side NotificationService handler which immediately notifies the client.
+  // -----
+
+  auto notification_service = pb::CreateFunctionalNotificationService().SubscribeWith(
+      [&large_message](const RpcContext& context, const pb::DefaultSubscribeRequest&)
+          -> AnyFuture<pb::DefaultSubscribeResponse> {
+        return MapTo(pb::NotificationListenerServiceClient{context.Endpoint()}.NotifyLogMessage(
+                         pb::LogMessageEvent{}.set_log_message(pb::LogMessage{}.set_data(
+                             pb::LogData{}.set_generic(pb::logs::Generic{}.set_message(
+                                 CowBytes::Borrowed(StringView{large_message}))))),
+                         RetryServerClientDefault()),
+                     pb::DefaultSubscribeResponse{});
+      });
+  const WebSocketServer server{HandleMessagesWith(notification_service)};
+
+  // Client-side NotificationListenerService handler
+  // -----
+
+  auto future_and_continuation = FromContinuation<void>();
+  const std::uint64_t bytes_copied_before{WebSocketBytesCopiedOnReceive()};
+  std::uint64_t bytes_copied_after{0};
+
+  MessageHandler message_handler{
+      CreateClientHandler(pb::CreateFunctionalNotificationListenerService().NotifyLogMessageWith(
+          [continuation{std::move(future_and_continuation.second)}, &large_message,
+           &bytes_copied_after](const pb::LogMessageEvent& event) mutable {
+            EXPECT_EQ(event.log_message().data().generic().message().Str(), large_message);
+            bytes_copied_after = WebSocketBytesCopiedOnReceive();
+            static_cast<void>(continuation.ContinueWith());
+          }))};
+
+  // Client-side NotificationService client
+  // ----
+
+  TestOnlyExecute(
+      ConnectedWebSocket("127.0.0.1", server.Port(), std::move(message_handler)) |
+      Then([message_received{std::move(future_and_continuation.first)}](
+               std::shared_ptr<RpcEndpoint>&& endpoint) mutable -> auto {
+        pb::NotificationServiceClient client{std::move(endpoint)};
+        return Join(MapTo(client.Subscribe({}, RetryClientDefault()), 0),
+                    MapTo(std::move(message_received), 0)) |
+               MapToVoid() | Then([client]() mutable -> auto {
+                 return Attach(client.Unsubscribe({}, RetryClientDefault()), client);
+               });
+      }));
+
+  // Small messages (e.g. the subscription response) may be copied, but the notification may not.
+  ASSERT_GE(bytes_copied_after, bytes_copied_before);
+  EXPECT_LT(bytes_copied_after - bytes_copied_before, kMessageSize);
+}
+
 }  // namespace
 }  // namespace horus
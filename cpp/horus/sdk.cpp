@@ -3,32 +3,41 @@
 #include <atomic>
 #include <cassert>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "horus/event_loop/event_loop.h"
 #include "horus/functional/move_only_function.h"
 #include "horus/future/any.h"
 #include "horus/future/attach.h"
 #include "horus/future/channel.h"
+#include "horus/future/from_poll.h"
 #include "horus/future/future.h"
 #include "horus/future/loop.h"
 #include "horus/future/map.h"
 #include "horus/future/map_to.h"
+#include "horus/future/poll.h"
 #include "horus/future/rejected.h"
 #include "horus/future/resolved.h"
 #include "horus/future/then.h"
 #include "horus/future/try.h"
+#include "horus/future/work.h"
 #include "horus/logs/format.h"  // IWYU pragma: keep
 #include "horus/pb/cow.h"
 #include "horus/pb/detection_merger/service_client.h"
 #include "horus/pb/detection_merger/service_handler.h"
 #include "horus/pb/detection_service/detection_pb.h"
+#include "horus/pb/field_mask.h"
+#include "horus/pb/pool.h"
 #include "horus/pb/logs/message_pb.h"
 #include "horus/pb/notification_service/service_client.h"
 #include "horus/pb/notification_service/service_handler.h"
@@ -48,27 +57,54 @@
 #include "horus/rpc/endpoint.h"
 #include "horus/rpc/retry_policy.h"
 #include "horus/rpc/ws.h"
+#include "horus/sdk/delivery.h"
 #include "horus/sdk/health.h"
+#include "horus/sdk/internal/callback_executor.h"
+#include "horus/sdk/internal/conflating_queue.h"
+#include "horus/sdk/internal/event_sinks.h"
+#include "horus/sdk/internal/single_flight.h"
+#include "horus/sdk/internal/task_batch.h"
 #include "horus/sdk/logs.h"
+#include "horus/sdk/merged_point_cloud.h"
 #include "horus/sdk/objects.h"
+#include "horus/sdk/options.h"
 #include "horus/sdk/point_clouds.h"
 #include "horus/sdk/profiling.h"
 #include "horus/sdk/sensor.h"
 #include "horus/sdk/version.h"
 #include "horus/sdk/zone_events.h"
 #include "horus/strings/logging.h"
+#include "horus/strings/str_cat.h"
 #include "horus/types/in_place.h"
 #include "horus/types/one_of.h"
 
 namespace horus {
+namespace {
+
+/// The number of tasks which can be queued for the event loop without blocking, which is also the
+/// largest number of tasks it processes per iteration.
+constexpr std::size_t kTaskChannelCapacity{64};
+
+}  // namespace
 
-Sdk::Sdk(const ServiceResolutionMap& services) noexcept(false)
+Sdk::Sdk(const ServiceResolutionMap& services, const sdk::SdkOptions& options) noexcept(false)
     : service_map_{services},
-      task_channel_{/*capacity=*/64},
-      event_loop_thread_{&Sdk::RunEventLoop, std::move(task_channel_.GetReceiver())} {}
+      callback_executor_{options.callback_worker_count == 0
+                             ? nullptr
+                             : std::make_unique<horus_internal::CallbackExecutor>(
+                                   options.callback_worker_count)},
+      task_channel_{kTaskChannelCapacity, ChannelKind::kLockFree},
+      event_loop_counters_{std::make_unique<EventLoopCounters>()},
+      event_loop_thread_{&Sdk::RunEventLoop, std::move(task_channel_.GetReceiver()),
+                         std::ref(*event_loop_counters_)} {}
 
 Sdk::~Sdk() noexcept {
   try {
+    // Close pooled connections from the event loop, which they need when destroyed.
+    task_channel_.GetSender().SendOrWait([this]() -> AnyFuture<void> {
+      unary_connections_.clear();
+      return ResolvedFuture<void>{};
+    });
     // Send a null function to indicate we're shutting down.
     task_channel_.GetSender().SendOrWait(nullptr);
   } catch (const ChannelClosedError&) {
@@ -135,176 +171,667 @@ T Extract(Owner&& owner, T& (Owner::*property)() &) {
   return result;
 }
 
+/// Sinks of the events broadcast by the notification service.
+struct NotificationEventSinks final : public horus_internal::SubscriberEventSinks {
+  /// The client used to subscribe to the service.
+  using Client = pb::NotificationServiceClient;
+
+  /// Handlers of `NotifyLogMessage()`.
+  horus_internal::EventSinks<pb::LogMessageEvent> log_messages;
+  /// Handlers of `NotifyProfilingInfo()`.
+  horus_internal::EventSinks<pb::ProfilingInfoEvent> profiling_infos;
+  /// Handlers of `NotifySensorInfo()`.
+  horus_internal::EventSinks<pb::SensorInfoEvent> sensor_infos;
+
+  /// @copydoc horus_internal::SubscriberEventSinks::Remove()
+  void Remove(std::uint64_t subscription_id) noexcept final {
+    log_messages.Remove(subscription_id);
+    profiling_infos.Remove(subscription_id);
+    sensor_infos.Remove(subscription_id);
+  }
+
+  /// Returns the listener which dispatches received events to `sinks`.
+  static auto CreateListener(const std::shared_ptr<NotificationEventSinks>& sinks) noexcept {
+    return pb::CreateFunctionalNotificationListenerService()
+        .NotifyLogMessageWith([sinks](pb::LogMessageEvent&& event) -> AnyFuture<void> {
+          return sinks->log_messages.Dispatch(std::move(event));
+        })
+        .NotifyProfilingInfoWith([sinks](pb::ProfilingInfoEvent&& event) -> AnyFuture<void> {
+          return sinks->profiling_infos.Dispatch(std::move(event));
+        })
+        .NotifySensorInfoWith([sinks](pb::SensorInfoEvent&& event) -> AnyFuture<void> {
+          return sinks->sensor_infos.Dispatch(std::move(event));
+        });
+  }
+};
+
+/// Sinks of the events broadcast by the detection merger.
+struct DetectionMergerEventSinks final : public horus_internal::SubscriberEventSinks {
+  /// The client used to subscribe to the service.
+  using Client = pb::DetectionMergerServiceClient;
+
+  /// Handlers of `BroadcastDetection()`.
+  horus_internal::EventSinks<pb::DetectionEvent> detections;
+  /// Handlers of `BroadcastZoneEvents()`.
+  horus_internal::EventSinks<pb::ZoneEventList> zone_events;
+
+  /// @copydoc horus_internal::SubscriberEventSinks::Remove()
+  void Remove(std::uint64_t subscription_id) noexcept final {
+    detections.Remove(subscription_id);
+    zone_events.Remove(subscription_id);
+  }
+
+  /// Returns the listener which dispatches received events to `sinks`.
+  ///
+  /// Received `DetectionEvent`s are deserialized without the fields skipped by all `detections`,
+  /// into messages acquired from the `detections.MessagePool()`.
+  ///
+  /// @throws std::bad_alloc If the field mask or pool cannot be registered.
+  static auto CreateListener(const std::shared_ptr<DetectionMergerEventSinks>& sinks) noexcept(
+      false) {
+    auto listener =
+        pb::CreateFunctionalDetectionMergerSubscriberService()
+            .BroadcastDetectionWith([sinks](pb::DetectionEvent&& event) -> AnyFuture<void> {
+              return sinks->detections.Dispatch(std::move(event));
+            })
+            .BroadcastZoneEventsWith([sinks](pb::ZoneEventList&& event) -> AnyFuture<void> {
+              return sinks->zone_events.Dispatch(std::move(event));
+            });
+    listener.SetRequestFieldMask(std::shared_ptr<const PbFieldMask<pb::DetectionEvent>>{
+        sinks, &sinks->detections.FieldMask()});
+    using DetectionPool = std::shared_ptr<PbMessagePool<pb::DetectionEvent>>;
+    listener.SetRequestPool(
+        std::shared_ptr<const DetectionPool>{sinks, &sinks->detections.MessagePool()});
+    return listener;
+  }
+};
+
+/// Sinks of the events broadcast by the point aggregator.
+struct PointAggregatorEventSinks final : public horus_internal::SubscriberEventSinks {
+  /// The client used to subscribe to the service.
+  using Client = pb::PointAggregatorServiceClient;
+
+  /// Handlers of `BroadcastProcessedPoints()`.
+  horus_internal::EventSinks<pb::AggregatedPointEvents> point_clouds;
+  /// Handlers of `BroadcastOccupancyGridList()`.
+  horus_internal::EventSinks<pb::OccupancyGridListEvent> occupancy_grids;
+
+  /// @copydoc horus_internal::SubscriberEventSinks::Remove()
+  void Remove(std::uint64_t subscription_id) noexcept final {
+    point_clouds.Remove(subscription_id);
+    occupancy_grids.Remove(subscription_id);
+  }
+
+  /// Returns the listener which dispatches received events to `sinks`.
+  static auto CreateListener(const std::shared_ptr<PointAggregatorEventSinks>& sinks) noexcept {
+    return pb::CreateFunctionalPointAggregatorSubscriberService()
+        .BroadcastProcessedPointsWith(
+            [sinks](pb::AggregatedPointEvents&& event) -> AnyFuture<void> {
+              return sinks->point_clouds.Dispatch(std::move(event));
+            })
+        .BroadcastOccupancyGridListWith(
+            [sinks](pb::OccupancyGridListEvent&& event) -> AnyFuture<void> {
+              return sinks->occupancy_grids.Dispatch(std::move(event));
+            });
+  }
+};
+
 }  // namespace
 
-template <class Client, class Subscriber, class SubscriptionRequest>
-SdkFuture<SdkSubscription> Sdk::CreateSubscription(const ServiceResolutionMap::Entry& target,
-                                                   Subscriber&& subscriber,
-                                                   SubscriptionRequest&& request) noexcept(false) {
+class Sdk::SharedConnection final : public std::enable_shared_from_this<SharedConnection> {
+ public:
+  /// The function called once connected to subscribe to the service.
+  using Subscribe = MoveOnlyFunction<AnyFuture<void>(const std::shared_ptr<RpcEndpoint>&)>;
+
+  /// Constructs the connection, whose events are dispatched to `sinks`.
+  SharedConnection(Sdk& sdk, std::shared_ptr<RpcEndpoint>&& endpoint,
+                   std::shared_ptr<horus_internal::SubscriberEventSinks>&& sinks,
+                   Subscribe&& subscribe) noexcept
+      : sdk_{sdk},
+        endpoint_{std::move(endpoint)},
+        sinks_{std::move(sinks)},
+        subscribe_{std::move(subscribe)} {
+    assert(endpoint_ != nullptr);
+    assert(sinks_ != nullptr);
+
+    // This code is executing immediately after creating the WebSocket and lifecycle events are
+    // dispatched on the event loop so we don't need to worry about possible race conditions, where
+    // `ConnectedEvent` would have been received before calling `SetLifecycleEventCallback()`.
+    endpoint_->SetLifecycleEventCallback<SharedConnection, &SharedConnection::HandleEvent>(*this);
+  }
+
+  /// Cannot copy.
+  SharedConnection(const SharedConnection&) = delete;
+  /// Cannot copy.
+  SharedConnection& operator=(const SharedConnection&) = delete;
+  /// Cannot move.
+  SharedConnection(SharedConnection&&) = delete;
+  /// Cannot move.
+  SharedConnection& operator=(SharedConnection&&) = delete;
+
+  /// Destroys the connection. Called from the event loop once the last subscription is gone.
+  ~SharedConnection() noexcept { endpoint_->ClearLifecycleEventCallback(); }
+
+  /// @see Subscription::CurrentStatus()
+  Subscription::Status CurrentStatus() const noexcept {
+    return status_.load(std::memory_order_relaxed);
+  }
+
+  /// Returns the sinks of the connection, which must be of type `Sinks`.
+  template <class Sinks>
+  Sinks& EventSinksAs() noexcept {
+    return static_cast<Sinks&>(*sinks_);
+  }
+
+  /// Returns a new identifier with which a subscription can add sinks.
+  std::uint64_t NewSubscriptionId() noexcept { return next_subscription_id_++; }
+
+  /// Removes the sinks added for `subscription_id`.
+  void RemoveSinks(std::uint64_t subscription_id) noexcept { sinks_->Remove(subscription_id); }
+
+ private:
+  /// Handles a connection lifecycle event.
+  void HandleEvent(RpcEndpoint::LifecycleEvent&& event) noexcept;
+
+  /// A reference to the SDK.
+  Sdk& sdk_;
+  /// The endpoint which subscribes to the event stream.
+  std::shared_ptr<RpcEndpoint> endpoint_;
+  /// The (non-null) sinks to which received events are dispatched.
+  std::shared_ptr<horus_internal::SubscriberEventSinks> sinks_;
+  /// The function to call when we are connected and able to subscribe.
+  Subscribe subscribe_;
+  /// @see Subscription::CurrentStatus()
+  std::atomic<Subscription::Status> status_{Subscription::Status::kConnecting};
+  /// @see NewSubscriptionId()
+  std::uint64_t next_subscription_id_{0};
+};
+
+class Sdk::UnaryConnection final : public std::enable_shared_from_this<UnaryConnection> {
+ public:
+  /// Constructs a connection which is not connected yet.
+  UnaryConnection() noexcept = default;
+
+  /// Cannot copy.
+  UnaryConnection(const UnaryConnection&) = delete;
+  /// Cannot copy.
+  UnaryConnection& operator=(const UnaryConnection&) = delete;
+  /// Cannot move.
+  UnaryConnection(UnaryConnection&&) = delete;
+  /// Cannot move.
+  UnaryConnection& operator=(UnaryConnection&&) = delete;
+
+  /// Destroys the connection.
+  ~UnaryConnection() noexcept {
+    if (endpoint_ != nullptr) {
+      endpoint_->ClearLifecycleEventCallback();
+    }
+  }
+
+  /// Returns a future which resolves with the endpoint of the connection, connecting to `target`
+  /// if the connection was never established or broke since.
+  AnyFuture<std::shared_ptr<RpcEndpoint>> Get(const ServiceResolutionMap::Entry& target) noexcept(
+      false) {
+    if (endpoint_ != nullptr && !broken_) {
+      return ResolveWith(std::shared_ptr<RpcEndpoint>{endpoint_});
+    }
+    return connecting_.Run([self{shared_from_this()}, target]() mutable {
+      return ConnectedWebSocket(target.host, target.port, CreateClientHandler()) |
+             Map([self1{std::move(self)}](
+                     std::shared_ptr<RpcEndpoint>&& endpoint) -> std::shared_ptr<RpcEndpoint> {
+               self1->Replace(std::shared_ptr<RpcEndpoint>{endpoint});
+               return std::move(endpoint);
+             });
+    });
+  }
+
+ private:
+  /// Replaces the endpoint of the connection with the newly connected `endpoint`.
+  void Replace(std::shared_ptr<RpcEndpoint>&& endpoint) noexcept {
+    if (endpoint_ != nullptr) {
+      endpoint_->ClearLifecycleEventCallback();
+    }
+    endpoint_ = std::move(endpoint);
+    broken_ = false;
+    endpoint_->SetLifecycleEventCallback<UnaryConnection, &UnaryConnection::HandleEvent>(*this);
+  }
+
+  /// Handles a lifecycle event of `endpoint_`.
+  void HandleEvent(RpcEndpoint::LifecycleEvent&& event) noexcept {
+    switch (event.Tag()) {
+      case OneOfTagFor<RpcEndpoint::LifecycleEvent, RpcEndpoint::ConnectedEvent>(): {
+        broken_ = false;
+        break;
+      }
+      case OneOfTagFor<RpcEndpoint::LifecycleEvent, RpcEndpoint::DisconnectedEvent>():
+      case OneOfTagFor<RpcEndpoint::LifecycleEvent, RpcEndpoint::ShutdownEvent>(): {
+        // Reconnect on the next call rather than waiting for the endpoint to reconnect by itself.
+        broken_ = true;
+        break;
+      }
+      case OneOfTagFor<RpcEndpoint::LifecycleEvent, RpcEndpoint::ErrorEvent>():
+        break;
+      default: {
+        assert(false);
+        break;
+      }
+    }
+    static_cast<void>(RpcEndpoint::LifecycleEvent{std::move(event)});
+  }
+
+  /// The endpoint of the connection; null until the first connection is established.
+  std::shared_ptr<RpcEndpoint> endpoint_;
+  /// Whether `endpoint_` disconnected since it was last connected.
+  bool broken_{false};
+  /// The connection attempt in flight.
+  horus_internal::SingleFlight<std::shared_ptr<RpcEndpoint>> connecting_;
+};
+
+template <class T>
+AnyFuture<void> Sdk::DeliverUserEvent(const CallbackStrand& strand,
+                                      const std::shared_ptr<sdk::EventRing<T>>& ring,
+                                      const std::function<void(T&&)>& callback,
+                                      T&& event) noexcept(false) {
+  if (ring != nullptr) {
+    // Deliver directly from the event loop; if the ring is full, the event is dropped.
+    static_cast<void>(ring->TryPush(std::move(event)));
+    return ResolvedFuture<void>{};
+  }
+  MoveOnlyFunction<void(T&&)> move_only_callback{
+      std::function<void(T&&)>{callback}};  // Copy `callback` into a `MoveOnlyFunction`.
+  return InvokeUserCallbackWithinEventLoop(strand, std::move(move_only_callback),
+                                           std::move(event));
+}
+
+template <class T>
+struct Sdk::QueueConsumer final {
+  /// The strand on which `callback` runs; null without a `callback_executor_`.
+  CallbackStrand strand;
+  /// The queue whose values are given to `callback`.
+  std::shared_ptr<horus_internal::ConflatingQueue<T>> queue;
+  /// The user callback.
+  std::function<void(T&&)> callback;
+
+  /// Calls `callback` with the next value popped from `queue`, if any. Returns `false` if `queue`
+  /// was empty, in which case it is now idle.
+  bool DeliverNextValue() const noexcept(false) {
+    OneOf<T, void> value{queue->Pop()};
+    T* const maybe_value{value.template TryAs<T>()};
+    if (maybe_value == nullptr) {
+      return false;
+    }
+    callback(std::move(*maybe_value));
+    return true;
+  }
+};
+
+template <class T>
+AnyFuture<void> Sdk::InvokeUserCallbackUntilEmpty(
+    const CallbackStrand& strand, const std::shared_ptr<horus_internal::ConflatingQueue<T>>& queue,
+    const std::function<void(T&&)>& callback) noexcept(false) {
+  return ScheduleNextUserCallback(
+      std::make_shared<const QueueConsumer<T>>(QueueConsumer<T>{strand, queue, callback}));
+}
+
+template <class T>
+AnyFuture<void> Sdk::ScheduleNextUserCallback(
+    std::shared_ptr<const QueueConsumer<T>>&& consumer) noexcept(false) {
+  // Each task delivers a single value and schedules the next one only once it is done, so that a
+  // slow callback gives a turn to the other tasks between values rather than delivering values
+  // until its queue is empty.
+  if (callback_executor_ != nullptr) {
+    const CallbackStrand& strand{consumer->strand};
+    callback_executor_->Post(strand, [this, consumer1{std::move(consumer)}]() mutable {
+      if (consumer1->DeliverNextValue()) {
+        // Tasks posted to a strand run in order, so the next value is delivered after this one.
+        static_cast<void>(ScheduleNextUserCallback(std::move(consumer1)));
+      }
+    });
+    return ResolvedFuture<void>{};
+  }
+  return task_channel_.GetSender().Send(
+      [this, consumer1{std::move(consumer)}]() -> AnyFuture<void> {
+        return DeferWork([consumer2{consumer1}](std::atomic<bool>& cancelled) -> bool {
+                 return !cancelled.load() && consumer2->DeliverNextValue();
+               }) |
+               Then([this, consumer2{consumer1}](bool delivered) mutable -> AnyFuture<void> {
+                 if (!delivered) {
+                   return ResolvedFuture<void>{};  // Queue is now idle.
+                 }
+                 // The next task is sent in the background, since the event loop only receives
+                 // tasks from `task_channel_` once this one completes.
+                 return FromPoll([next{ScheduleNextUserCallback(std::move(consumer2))}](
+                                     PollContext& context) mutable -> PollResult<void> {
+                   context.Loop().SpawnFuture(std::move(next));
+                   return ReadyResult<void>();
+                 });
+               });
+      });
+}
+
+template <class Sinks>
+AnyFuture<std::shared_ptr<Sdk::SharedConnection>> Sdk::GetSharedConnection(
+    const ServiceResolutionMap::Entry& target) noexcept(false) {
+  using Client = typename Sinks::Client;
+
+  std::string key{StrCat(Client{nullptr}.ServiceName(), "@", target.host, ":", target.port)};
+  std::shared_ptr<SharedConnection> connection{shared_connections_[key].lock()};
+  if (connection != nullptr) {
+    return ResolveWith(std::move(connection));
+  }
+
+  // `ConnectingWebSocket()` resolves as soon as it is polled, so the new connection is registered
+  // before any other task running on the event loop can look it up.
+  std::shared_ptr<Sinks> sinks{std::make_shared<Sinks>()};
+  return ConnectingWebSocket(target.host, target.port,
+                             CreateClientHandler(Sinks::CreateListener(sinks))) |
+         Map([this, target, key{std::move(key)}, sinks](
+                 std::shared_ptr<RpcEndpoint>&& endpoint) -> std::shared_ptr<SharedConnection> {
+           std::shared_ptr<SharedConnection> new_connection{std::make_shared<SharedConnection>(
+               *this, std::move(endpoint), std::shared_ptr<Sinks>{sinks},
+               [target](const std::shared_ptr<RpcEndpoint>& event_endpoint) -> AnyFuture<void> {
+                 // The client doesn't hold any state so we can just recreate it every time.
+                 static_assert(sizeof(Client) == sizeof(horus_internal::RpcBaseClient),
+                               "subscriber client should not hold any state");
+                 Client client{event_endpoint};
+                 Log("connected to ", client.ServiceName(), " via ", target.host, ":",
+                     target.port);
+                 return MapToVoid(
+                     client.Subscribe(pb::DefaultSubscribeRequest{}, RetryClientDefault()));
+               })};
+           shared_connections_[key] = new_connection;
+           return new_connection;
+         });
+}
+
+template <class Sinks, class T>
+SdkFuture<SdkSubscription> Sdk::CreateSubscription(
+    const ServiceResolutionMap::Entry& target, horus_internal::EventSinks<T> Sinks::*sinks,
+    typename horus_internal::EventSinks<T>::Sink&& sink,
+    SharedCounter dropped_event_count, PbFieldMask<T>&& field_mask,
+    std::shared_ptr<PbMessagePool<T>> message_pool) noexcept(false) {
   return CreateFuture(
-      ConnectingWebSocket(target.host, target.port,
-                          CreateClientHandler(std::forward<Subscriber>(subscriber))) |
-      Map([this, request2{std::forward<SubscriptionRequest>(request)},
-           target](std::shared_ptr<RpcEndpoint>&& endpoint) mutable -> Subscription {
-        return Subscription{
-            *this, std::move(endpoint),
-            [request3{std::move(request2)},
-             target](const std::shared_ptr<RpcEndpoint>& event_endpoint) -> AnyFuture<void> {
-              // The client doesn't hold any state so we can just recreate it every time.
-              static_assert(sizeof(Client) == sizeof(horus_internal::RpcBaseClient),
-                            "subscriber client should not hold any state");
-              Client client{event_endpoint};
-              Log("connected to ", client.ServiceName(), " via ", target.host, ":", target.port);
-              return MapToVoid(client.Subscribe(request3, RetryClientDefault()));
-            }};
+      ResolvedFuture<void>{} |
+      Then([this, target]() -> AnyFuture<std::shared_ptr<SharedConnection>> {
+        return GetSharedConnection<Sinks>(target);
+      }) |
+      Map([this, sinks, sink1{std::move(sink)},
+           dropped_event_count1{std::move(dropped_event_count)},
+           field_mask1{std::move(field_mask)}, message_pool1{std::move(message_pool)}](
+              std::shared_ptr<SharedConnection>&& connection) mutable -> Subscription {
+        const std::uint64_t subscription_id{connection->NewSubscriptionId()};
+        (connection->EventSinksAs<Sinks>().*sinks)
+            .Add(subscription_id, std::move(sink1), std::move(field_mask1),
+                 std::move(message_pool1));
+        return Subscription{*this, std::move(connection), subscription_id,
+                            std::move(dropped_event_count1)};
       }));
 }
 
 SdkFuture<SdkSubscription> Sdk::SubscribeToLogs(sdk::LogSubscriptionRequest&& request) {
-  auto listener = pb::CreateFunctionalNotificationListenerService().NotifyLogMessageWith(
-      [this, user_callback{std::move(request).on_log_message}](
-          pb::LogMessageEvent&& event) -> ChannelSendFuture<Task> {
-        MoveOnlyFunction<void(pb::LogMessage&&)> move_only_user_callback{
-            std::function<void(pb::LogMessage&&)>{
-                user_callback}};  // Copy `user_callback` into a `MoveOnlyFunction`.
-        return InvokeUserCallbackWithinEventLoop(
-            std::move(move_only_user_callback),
+  SharedCounter dropped_event_count{DroppedEventCounter(request.event_ring)};
+  return CreateSubscription(
+      service_map_.notification, &NotificationEventSinks::log_messages,
+      [this, strand{CreateCallbackStrand()}, ring{request.event_ring},
+       user_callback{std::move(request).on_log_message}](
+          pb::LogMessageEvent&& event) -> AnyFuture<void> {
+        return DeliverUserEvent(
+            strand, ring, user_callback,
             Extract(std::move(event), &pb::LogMessageEvent::mutable_log_message));
-      });
-  return CreateSubscription<pb::NotificationServiceClient>(
-      service_map_.notification, std::move(listener), pb::DefaultSubscribeRequest{});
+      },
+      std::move(dropped_event_count));
 }
 
 SdkFuture<SdkSubscription> Sdk::SubscribeToProfiling(sdk::ProfilingSubscriptionRequest&& request) {
-  auto listener = pb::CreateFunctionalNotificationListenerService().NotifyProfilingInfoWith(
-      [this, user_callback{std::move(request).on_profiling_info}](
-          pb::ProfilingInfoEvent&& event) -> ChannelSendFuture<Task> {
-        MoveOnlyFunction<void(pb::ProfilingInfo&&)> move_only_user_callback{
-            std::function<void(pb::ProfilingInfo&&)>{
-                user_callback}};  // Copy `user_callback` into a `MoveOnlyFunction`.
-        return InvokeUserCallbackWithinEventLoop(
-            std::move(move_only_user_callback),
+  SharedCounter dropped_event_count{DroppedEventCounter(request.event_ring)};
+  return CreateSubscription(
+      service_map_.notification, &NotificationEventSinks::profiling_infos,
+      [this, strand{CreateCallbackStrand()}, ring{request.event_ring},
+       user_callback{std::move(request).on_profiling_info}](
+          pb::ProfilingInfoEvent&& event) -> AnyFuture<void> {
+        return DeliverUserEvent(
+            strand, ring, user_callback,
             Extract(std::move(event), &pb::ProfilingInfoEvent::mutable_profiling_info));
-      });
-  return CreateSubscription<pb::NotificationServiceClient>(
-      service_map_.notification, std::move(listener), pb::DefaultSubscribeRequest{});
+      },
+      std::move(dropped_event_count));
 }
 
 SdkFuture<SdkSubscription> Sdk::SubscribeToObjects(sdk::ObjectSubscriptionRequest&& request) {
-  auto listener = pb::CreateFunctionalDetectionMergerSubscriberService().BroadcastDetectionWith(
-      [this, user_callback{std::move(request).on_detection_results}](
-          pb::DetectionEvent&& event) -> ChannelSendFuture<Task> {
-        MoveOnlyFunction<void(pb::DetectionEvent&&)> move_only_user_callback{
-            std::function<void(pb::DetectionEvent&&)>{
-                user_callback}};  // Copy `user_callback` into a `MoveOnlyFunction`.
-        return InvokeUserCallbackWithinEventLoop(std::move(move_only_user_callback),
-                                                 std::move(event));
-      });
-  return CreateSubscription<pb::DetectionMergerServiceClient>(
-      service_map_.detection_merger, std::move(listener), pb::DefaultSubscribeRequest{});
+  SharedCounter dropped_event_count{DroppedEventCounter(request.event_ring)};
+  return CreateSubscription(
+      service_map_.detection_merger, &DetectionMergerEventSinks::detections,
+      [this, strand{CreateCallbackStrand()}, ring{request.event_ring},
+       user_callback{std::move(request).on_detection_results}](
+          pb::DetectionEvent&& event) -> AnyFuture<void> {
+        return DeliverUserEvent(strand, ring, user_callback, std::move(event));
+      },
+      std::move(dropped_event_count), std::move(request.field_mask),
+      std::move(request.message_pool));
 }
 
 SdkFuture<SdkSubscription> Sdk::SubscribeToZoneEvents(sdk::ZoneEventSubscriptionRequest&& request) {
-  auto listener = pb::CreateFunctionalDetectionMergerSubscriberService().BroadcastZoneEventsWith(
-      [this, user_callback{std::move(request).on_zone_events}](
-          pb::ZoneEventList&& event) -> ChannelSendFuture<Task> {
-        MoveOnlyFunction<void(pb::ZoneEventList&&)> move_only_user_callback{
-            std::function<void(pb::ZoneEventList&&)>{
-                user_callback}};  // Copy `user_callback` into a `MoveOnlyFunction`.
-        return InvokeUserCallbackWithinEventLoop(std::move(move_only_user_callback),
-                                                 std::move(event));
-      });
-  return CreateSubscription<pb::DetectionMergerServiceClient>(
-      service_map_.detection_merger, std::move(listener), pb::DefaultSubscribeRequest{});
+  SharedCounter dropped_event_count{DroppedEventCounter(request.event_ring)};
+  return CreateSubscription(
+      service_map_.detection_merger, &DetectionMergerEventSinks::zone_events,
+      [this, strand{CreateCallbackStrand()}, ring{request.event_ring},
+       user_callback{std::move(request).on_zone_events}](
+          pb::ZoneEventList&& event) -> AnyFuture<void> {
+        return DeliverUserEvent(strand, ring, user_callback, std::move(event));
+      },
+      std::move(dropped_event_count));
 }
 
 SdkFuture<SdkSubscription> Sdk::SubscribeToOccupancyGrid(
     sdk::OccupancyGridSubscriptionRequest&& request) {
-  auto listener =
-      pb::CreateFunctionalPointAggregatorSubscriberService().BroadcastOccupancyGridListWith(
-          [this, user_callback{std::move(request).on_occupancy_grid}](
-              pb::OccupancyGridListEvent&& event) -> ChannelSendFuture<Task> {
-            MoveOnlyFunction<void(pb::OccupancyGridListEvent&&)> move_only_user_callback{
-                std::function<void(pb::OccupancyGridListEvent&&)>{
-                    user_callback}};  // Copy `user_callback` into a `MoveOnlyFunction`.
-            return InvokeUserCallbackWithinEventLoop(std::move(move_only_user_callback),
-                                                     std::move(event));
-          });
-  return CreateSubscription<pb::PointAggregatorServiceClient>(
-      service_map_.point_aggregator, std::move(listener), pb::DefaultSubscribeRequest{});
+  if (request.event_ring == nullptr && request.delivery_policy != sdk::DeliveryPolicy::kBlock) {
+    using Queue = horus_internal::ConflatingQueue<pb::OccupancyGridListEvent>;
+    std::shared_ptr<Queue> queue{
+        std::make_shared<Queue>(request.delivery_policy, request.max_pending_occupancy_grids)};
+    SharedCounter dropped_event_count{queue, &queue->DroppedCount()};
+    return CreateSubscription(
+        service_map_.point_aggregator, &PointAggregatorEventSinks::occupancy_grids,
+        [this, strand{CreateCallbackStrand()}, queue,
+         user_callback{std::move(request).on_occupancy_grid}](
+            pb::OccupancyGridListEvent&& event) -> AnyFuture<void> {
+          // Occupancy grid lists cover all detection ranges, so they all come from a single
+          // source.
+          if (!queue->Push(std::string{}, std::move(event))) {
+            return ResolvedFuture<void>{};  // Already being consumed.
+          }
+          return InvokeUserCallbackUntilEmpty(strand, queue, user_callback);
+        },
+        std::move(dropped_event_count));
+  }
+
+  SharedCounter dropped_event_count{DroppedEventCounter(request.event_ring)};
+  return CreateSubscription(
+      service_map_.point_aggregator, &PointAggregatorEventSinks::occupancy_grids,
+      [this, strand{CreateCallbackStrand()}, ring{request.event_ring},
+       user_callback{std::move(request).on_occupancy_grid}](
+          pb::OccupancyGridListEvent&& event) -> AnyFuture<void> {
+        return DeliverUserEvent(strand, ring, user_callback, std::move(event));
+      },
+      std::move(dropped_event_count));
 }
 
 SdkFuture<SdkSubscription> Sdk::SubscribeToPointClouds(
     sdk::PointCloudSubscriptionRequest&& request) {
-  auto listener =
-      pb::CreateFunctionalPointAggregatorSubscriberService().BroadcastProcessedPointsWith(
-          [this, user_callback{std::move(request).on_point_cloud}](
-              pb::AggregatedPointEvents&& aggregated_events) -> ChannelSendFuture<Task> {
+  if (request.on_merged_point_cloud != nullptr) {
+    // Frames are merged on the callback strand rather than on the event loop, into a single cloud
+    // (and with threads) reused from batch to batch since the strand delivers one batch at a time.
+    // The function is shared by the tasks delivering each batch rather than copied for each of
+    // them, and `deliver` only copies the pointer to it.
+    using MergeAndDeliver = std::function<void(pb::AggregatedPointEvents&&)>;
+    std::shared_ptr<const MergeAndDeliver> merge_and_deliver{std::make_shared<MergeAndDeliver>(
+        [cloud{std::make_shared<sdk::MergedPointCloud>()},
+         thread_count{request.merge_thread_count},
+         user_callback{std::move(request).on_merged_point_cloud}](
+            pb::AggregatedPointEvents&& aggregated_events) {
+          cloud->Assign(aggregated_events, thread_count);
+          static_cast<void>(pb::AggregatedPointEvents{std::move(aggregated_events)});
+          user_callback(*cloud);
+        })};
+    MergeAndDeliver deliver{[merge_and_deliver](pb::AggregatedPointEvents&& aggregated_events) {
+      (*merge_and_deliver)(std::move(aggregated_events));
+    }};
+
+    if (request.delivery_policy == sdk::DeliveryPolicy::kBlock) {
+      return CreateSubscription(
+          service_map_.point_aggregator, &PointAggregatorEventSinks::point_clouds,
+          [this, strand{CreateCallbackStrand()}, deliver{std::move(deliver)}](
+              pb::AggregatedPointEvents&& aggregated_events) -> AnyFuture<void> {
             MoveOnlyFunction<void(pb::AggregatedPointEvents&&)> move_only_callback{
-                [callback{user_callback}](pb::AggregatedPointEvents&& events) {
-                  for (const Cow<pb::ProcessedPointsEvent>& event : events.events()) {
-                    // Shallow-copy point frame.
-                    callback(pb::PointFrame{event.Ref().point_frame()});
-                  }
-                  static_cast<void>(pb::AggregatedPointEvents{std::move(events)});
-                }};
-            return InvokeUserCallbackWithinEventLoop(std::move(move_only_callback),
+                MergeAndDeliver{deliver}};
+            return InvokeUserCallbackWithinEventLoop(strand, std::move(move_only_callback),
                                                      std::move(aggregated_events));
           });
-  return CreateSubscription<pb::PointAggregatorServiceClient>(
-      service_map_.point_aggregator, std::move(listener), pb::DefaultSubscribeRequest{});
+    }
+
+    using Queue = horus_internal::ConflatingQueue<pb::AggregatedPointEvents>;
+    std::shared_ptr<Queue> queue{
+        std::make_shared<Queue>(request.delivery_policy, request.max_pending_point_clouds)};
+    SharedCounter dropped_event_count{queue, &queue->DroppedCount()};
+    return CreateSubscription(
+        service_map_.point_aggregator, &PointAggregatorEventSinks::point_clouds,
+        [this, strand{CreateCallbackStrand()}, queue, deliver{std::move(deliver)}](
+            pb::AggregatedPointEvents&& aggregated_events) -> AnyFuture<void> {
+          // All batches share the same key, so `kKeepLatest` only keeps the latest batch.
+          if (!queue->Push(std::string{}, std::move(aggregated_events))) {
+            return ResolvedFuture<void>{};  // Already being consumed.
+          }
+          return InvokeUserCallbackUntilEmpty(strand, queue, deliver);
+        },
+        std::move(dropped_event_count));
+  }
+
+  if (request.event_ring != nullptr) {
+    SharedCounter dropped_event_count{DroppedEventCounter(request.event_ring)};
+    return CreateSubscription(
+        service_map_.point_aggregator, &PointAggregatorEventSinks::point_clouds,
+        [ring{std::move(request).event_ring}](
+            pb::AggregatedPointEvents&& aggregated_events) -> AnyFuture<void> {
+          for (const Cow<pb::ProcessedPointsEvent>& event : aggregated_events.events()) {
+            // Shallow-copy point frame.
+            static_cast<void>(ring->TryPush(pb::PointFrame{event.Ref().point_frame()}));
+          }
+          static_cast<void>(pb::AggregatedPointEvents{std::move(aggregated_events)});
+          return ResolvedFuture<void>{};
+        },
+        std::move(dropped_event_count));
+  }
+
+  if (request.delivery_policy != sdk::DeliveryPolicy::kBlock) {
+    using Queue = horus_internal::ConflatingQueue<pb::PointFrame>;
+    std::shared_ptr<Queue> queue{
+        std::make_shared<Queue>(request.delivery_policy, request.max_pending_point_clouds)};
+    SharedCounter dropped_event_count{queue, &queue->DroppedCount()};
+    return CreateSubscription(
+        service_map_.point_aggregator, &PointAggregatorEventSinks::point_clouds,
+        [this, strand{CreateCallbackStrand()}, queue,
+         user_callback{std::move(request).on_point_cloud}](
+            pb::AggregatedPointEvents&& aggregated_events) -> AnyFuture<void> {
+          bool idle{false};
+          for (const Cow<pb::ProcessedPointsEvent>& event : aggregated_events.events()) {
+            const pb::PointFrame& point_frame{event.Ref().point_frame()};
+            // Shallow-copy point frame.
+            if (queue->Push(std::string{point_frame.header().lidar_id().Str()},
+                            pb::PointFrame{point_frame})) {
+              idle = true;
+            }
+          }
+          static_cast<void>(pb::AggregatedPointEvents{std::move(aggregated_events)});
+          if (!idle) {
+            return ResolvedFuture<void>{};  // Already being consumed.
+          }
+          return InvokeUserCallbackUntilEmpty(strand, queue, user_callback);
+        },
+        std::move(dropped_event_count));
+  }
+
+  return CreateSubscription(
+      service_map_.point_aggregator, &PointAggregatorEventSinks::point_clouds,
+      [this, strand{CreateCallbackStrand()}, user_callback{std::move(request).on_point_cloud}](
+          pb::AggregatedPointEvents&& aggregated_events) -> AnyFuture<void> {
+        MoveOnlyFunction<void(pb::AggregatedPointEvents&&)> move_only_callback{
+            [callback{user_callback}](pb::AggregatedPointEvents&& events) {
+              for (const Cow<pb::ProcessedPointsEvent>& event : events.events()) {
+                // Shallow-copy point frame.
+                callback(pb::PointFrame{event.Ref().point_frame()});
+              }
+              static_cast<void>(pb::AggregatedPointEvents{std::move(events)});
+            }};
+        return InvokeUserCallbackWithinEventLoop(strand, std::move(move_only_callback),
+                                                 std::move(aggregated_events));
+      });
 }
 
 SdkFuture<SdkSubscription> Sdk::SubscribeToSensorInfo(
     sdk::SensorInfoSubscriptionRequest&& request) {
-  auto listener = pb::CreateFunctionalNotificationListenerService().NotifySensorInfoWith(
-      [this, user_callback{std::move(request).on_sensor_info_event}](
-          pb::SensorInfoEvent&& event) -> ChannelSendFuture<Task> {
-        MoveOnlyFunction<void(pb::SensorInfoEvent&&)> move_only_user_callback{
-            std::function<void(pb::SensorInfoEvent&&)>{
-                user_callback}};  // Copy `user_callback` into a `MoveOnlyFunction`.
-        return InvokeUserCallbackWithinEventLoop(std::move(move_only_user_callback),
-                                                 std::move(event));
-      });
-  return CreateSubscription<pb::NotificationServiceClient>(
-      service_map_.notification, std::move(listener), pb::DefaultSubscribeRequest{});
+  SharedCounter dropped_event_count{DroppedEventCounter(request.event_ring)};
+  return CreateSubscription(
+      service_map_.notification, &NotificationEventSinks::sensor_infos,
+      [this, strand{CreateCallbackStrand()}, ring{request.event_ring},
+       user_callback{std::move(request).on_sensor_info_event}](
+          pb::SensorInfoEvent&& event) -> AnyFuture<void> {
+        return DeliverUserEvent(strand, ring, user_callback, std::move(event));
+      },
+      std::move(dropped_event_count));
+}
+
+AnyFuture<std::shared_ptr<RpcEndpoint>> Sdk::GetUnaryConnection(
+    const ServiceResolutionMap::Entry& target) noexcept(false) {
+  std::shared_ptr<UnaryConnection>& connection{
+      unary_connections_[StrCat(target.host, ":", target.port)]};
+  if (connection == nullptr) {
+    connection = std::make_shared<UnaryConnection>();
+  }
+  return connection->Get(target);
 }
 
 Sdk::Future<sdk::HealthStatus> Sdk::GetHealthStatus(sdk::GetHealthStatusRequest&& request) {
   // clang tidy triggers an error because request is trivially copyable
   static_cast<void>(
       sdk::GetHealthStatusRequest{std::move(request)});  // NOLINT (hicpp-move-const-arg)
-  return CreateFuture(ConnectedWebSocket(service_map_.project_manager.host,
-                                         service_map_.project_manager.port, CreateClientHandler()) |
-                      Then([](std::shared_ptr<RpcEndpoint>&& endpoint)
-                               -> AnyFuture<sdk::pb::GetHealthStatusResponse> {
-                        constexpr std::chrono::milliseconds kTimeout{500};
-                        sdk::pb::ProjectManagerServiceClient client{endpoint};
-                        return client.GetHealthStatus(sdk::pb::GetHealthStatusRequest{},
-                                                      RetryClientDefault().WithTimeout(kTimeout)) |
-                               Attach(std::move(endpoint));
-                      }) |
-                      // clang-tidy wants us to move rpc_response, which would have no effect,
-                      // since it is trivially copyable
-                      // NOLINTNEXTLINE(*-not-moved)
-                      Map([](sdk::pb::GetHealthStatusResponse&& rpc_response) -> sdk::HealthStatus {
-                        return sdk::HealthStatus{rpc_response};
-                      }));
+  return CreateFuture(
+      ResolvedFuture<void>{} |
+      Then([this]() -> AnyFuture<sdk::pb::GetHealthStatusResponse> {
+        return health_status_requests_.Run([this]() -> AnyFuture<sdk::pb::GetHealthStatusResponse> {
+          return GetUnaryConnection(service_map_.project_manager) |
+                 Then([](std::shared_ptr<RpcEndpoint>&& endpoint)
+                          -> AnyFuture<sdk::pb::GetHealthStatusResponse> {
+                   constexpr std::chrono::milliseconds kTimeout{500};
+                   sdk::pb::ProjectManagerServiceClient client{endpoint};
+                   return client.GetHealthStatus(sdk::pb::GetHealthStatusRequest{},
+                                                 RetryClientDefault().WithTimeout(kTimeout)) |
+                          Attach(std::move(endpoint));
+                 });
+        });
+      }) |
+      // clang-tidy wants us to move rpc_response, which would have no effect,
+      // since it is trivially copyable
+      // NOLINTNEXTLINE(*-not-moved)
+      Map([](sdk::pb::GetHealthStatusResponse&& rpc_response) -> sdk::HealthStatus {
+        return sdk::HealthStatus{rpc_response};
+      }));
 }
 
 Sdk::Future<sdk::Version> Sdk::GetVersion(sdk::GetVersionRequest&& request) {
   // clang tidy triggers an error because request is trivially copyable
   static_cast<void>(sdk::GetVersionRequest{std::move(request)});  // NOLINT (hicpp-move-const-arg)
   return CreateFuture(
-      ConnectedWebSocket(service_map_.project_manager.host, service_map_.project_manager.port,
-                         CreateClientHandler()) |
-      Then([](std::shared_ptr<RpcEndpoint>&& endpoint) -> AnyFuture<pb::GetVersionResponse> {
-        constexpr std::chrono::milliseconds kTimeout{500};
-        sdk::pb::StatusServiceClient client{endpoint};
-        return client.GetVersion(
-                   sdk::pb::GetVersionRequest{},
-                   RetryClientDefault().WithTimeout(std::chrono::milliseconds{kTimeout})) |
-               Attach(std::move(endpoint));
+      ResolvedFuture<void>{} |
+      Then([this]() -> AnyFuture<pb::GetVersionResponse> {
+        return version_requests_.Run([this]() -> AnyFuture<pb::GetVersionResponse> {
+          return GetUnaryConnection(service_map_.project_manager) |
+                 Then([](std::shared_ptr<RpcEndpoint>&& endpoint)
+                          -> AnyFuture<pb::GetVersionResponse> {
+                   constexpr std::chrono::milliseconds kTimeout{500};
+                   sdk::pb::StatusServiceClient client{endpoint};
+                   return client.GetVersion(sdk::pb::GetVersionRequest{},
+                                            RetryClientDefault().WithTimeout(kTimeout)) |
+                          Attach(std::move(endpoint));
+                 });
+        });
       }) |
       // clang-tidy wants us to move rpc_response, which would have no effect,
       // since it is trivially copyable
@@ -315,20 +842,32 @@ Sdk::Future<sdk::Version> Sdk::GetVersion(sdk::GetVersionRequest&& request) {
 }
 
 // static
-void Sdk::RunEventLoop(ChannelReceiver<Task>&& task_receiver) noexcept {
+void Sdk::RunEventLoop(ChannelReceiver<Task>&& task_receiver,
+                       EventLoopCounters& counters) noexcept {
   horus_internal::EventLoop event_loop;
   for (;;) {
     try {
-      auto event_loop_future = Loop([tasks{std::move(task_receiver)}]() mutable -> auto {
-        return tasks.Receive() | Then([](Task&& task_rvalue) -> AnyFuture<LoopResult<void>> {
-                 Task task{std::move(task_rvalue)};
-                 if (task == nullptr) {
-                   // Empty task received? Shutting down.
-                   return ResolveWith(LoopResult<void>{InPlaceType<void>});
+      // Each iteration drains all the queued tasks into `batch` (whose storage is reused across
+      // iterations) and runs them in order, without going back to the channel in between.
+      auto event_loop_future = Loop([tasks{std::move(task_receiver)}, batch = std::vector<Task>{},
+                                     &counters]() mutable -> auto {
+        return tasks.ReceiveMany(kTaskChannelCapacity, std::move(batch)) |
+               Then([&batch, &counters](std::vector<Task>&& received) -> auto {
+                 batch = std::move(received);
+                 const std::uint64_t task_count{batch.size()};
+                 counters.iteration_count.fetch_add(1, std::memory_order_relaxed);
+                 counters.task_count.fetch_add(task_count, std::memory_order_relaxed);
+                 // Only the event loop writes to the counters, so this needs no compare-exchange.
+                 std::atomic<std::uint64_t>& max_task_count{counters.max_tasks_per_iteration};
+                 if (task_count > max_task_count.load(std::memory_order_relaxed)) {
+                   max_task_count.store(task_count, std::memory_order_relaxed);
                  }
-                 return task() | MapTo(LoopResult<void>{InPlaceType<LoopContinue>}) |
-                        Catch([](const std::exception& exn) -> LoopResult<void> {
-                          Log("error handling SDK task: ", exn.what());
+                 return horus_internal::TaskBatchFuture<Task>{batch} |
+                        Map([&batch](bool shutting_down) -> LoopResult<void> {
+                          batch.clear();
+                          if (shutting_down) {
+                            return LoopResult<void>{InPlaceType<void>};
+                          }
                           return LoopResult<void>{InPlaceType<LoopContinue>};
                         });
                });
@@ -341,25 +880,41 @@ void Sdk::RunEventLoop(ChannelReceiver<Task>&& task_receiver) noexcept {
   }
 }
 
-Sdk::Subscription::Subscription(Sdk& sdk, std::shared_ptr<RpcEndpoint>&& subscriber,
-                                Subscribe&& subscribe) noexcept(false)
-    : state_{std::make_shared<State>(sdk, std::move(subscriber), std::move(subscribe))} {}
+Sdk::EventLoopStats Sdk::GetEventLoopStats() const noexcept {
+  EventLoopStats stats;
+  stats.iteration_count = event_loop_counters_->iteration_count.load(std::memory_order_relaxed);
+  stats.task_count = event_loop_counters_->task_count.load(std::memory_order_relaxed);
+  stats.max_tasks_per_iteration =
+      event_loop_counters_->max_tasks_per_iteration.load(std::memory_order_relaxed);
+  return stats;
+}
 
-Sdk::Subscription::State::State(Sdk& sdk, std::shared_ptr<RpcEndpoint>&& subscriber,
-                                Subscribe&& subscribe) noexcept
-    : sdk_{sdk}, subscriber_{std::move(subscriber)}, subscribe_{std::move(subscribe)} {
-  assert(subscriber_ != nullptr);
+Sdk::Subscription::Subscription(Sdk& sdk, std::shared_ptr<SharedConnection>&& connection,
+                                std::uint64_t subscription_id,
+                                SharedCounter&& dropped_event_count) noexcept(false)
+    : state_{std::make_shared<State>(sdk, std::move(connection), subscription_id,
+                                     std::move(dropped_event_count))} {}
 
-  // This code is executing immediately after creating the WebSocket and lifecycle events are
-  // dispatched on the event loop so we don't need to worry about possible race conditions, where
-  // `ConnectedEvent` would have been received before calling `SetLifecycleEventCallback()`.
-  subscriber_->SetLifecycleEventCallback<State, &State::HandleEvent>(*this);
+Sdk::Subscription::State::State(Sdk& sdk, std::shared_ptr<SharedConnection>&& connection,
+                                std::uint64_t subscription_id,
+                                SharedCounter&& dropped_event_count) noexcept
+    : sdk_{sdk},
+      connection_{std::move(connection)},
+      subscription_id_{subscription_id},
+      dropped_event_count_{std::move(dropped_event_count)} {
+  assert(connection_ != nullptr);
+}
+
+Sdk::Subscription::Status Sdk::Subscription::State::CurrentStatus() const noexcept {
+  return connection_->CurrentStatus();
 }
 
 void Sdk::Subscription::State::Shutdown() noexcept {
   try {
     sdk_.task_channel_.GetSender().SendOrWait([state{shared_from_this()}]() -> AnyFuture<void> {
-      state->subscriber_->ClearLifecycleEventCallback();
+      // If this was the last subscription using the connection, the connection will be closed
+      // when `state` is destroyed.
+      state->connection_->RemoveSinks(state->subscription_id_);
       return ResolvedFuture<void>{};
     });
   } catch (const ChannelClosedError&) {  // NOLINT(*-empty-catch)
@@ -367,8 +922,8 @@ void Sdk::Subscription::State::Shutdown() noexcept {
   }
 }
 
-void Sdk::Subscription::State::HandleEvent(RpcEndpoint::LifecycleEvent&& event) noexcept {
-  std::shared_ptr<State> shared{nullptr};
+void Sdk::SharedConnection::HandleEvent(RpcEndpoint::LifecycleEvent&& event) noexcept {
+  std::shared_ptr<SharedConnection> shared{nullptr};
   try {
     shared = shared_from_this();
   } catch (const std::bad_weak_ptr&) {
@@ -377,17 +932,20 @@ void Sdk::Subscription::State::HandleEvent(RpcEndpoint::LifecycleEvent&& event)
   }
   switch (event.Tag()) {
     case OneOfTagFor<RpcEndpoint::LifecycleEvent, RpcEndpoint::ConnectedEvent>(): {
-      status_.store(Status::kConnected, std::memory_order_relaxed);
+      status_.store(Subscription::Status::kConnected, std::memory_order_relaxed);
       try {
-        sdk_.task_channel_.GetSender().SendOrWait([state{std::move(shared)}]() -> AnyFuture<void> {
-          return Map(
-              state->subscribe_(state->subscriber_), [weak_state{std::weak_ptr<State>{state}}]() {
-                const std::shared_ptr<State> locked_state{weak_state.lock()};
-                if (locked_state != nullptr) {
-                  locked_state->status_.store(Status::kSubscribed, std::memory_order_relaxed);
-                }
-              });
-        });
+        sdk_.task_channel_.GetSender().SendOrWait(
+            [connection{std::move(shared)}]() -> AnyFuture<void> {
+              return Map(connection->subscribe_(connection->endpoint_),
+                         [weak_connection{std::weak_ptr<SharedConnection>{connection}}]() {
+                           const std::shared_ptr<SharedConnection> locked_connection{
+                               weak_connection.lock()};
+                           if (locked_connection != nullptr) {
+                             locked_connection->status_.store(Subscription::Status::kSubscribed,
+                                                              std::memory_order_relaxed);
+                           }
+                         });
+            });
       } catch (const ChannelClosedError&) {
         // This isn't a big deal, but it's not supposed to happen so we only do something about it
         // when assertions are enabled.
@@ -397,7 +955,7 @@ void Sdk::Subscription::State::HandleEvent(RpcEndpoint::LifecycleEvent&& event)
     }
     case OneOfTagFor<RpcEndpoint::LifecycleEvent, RpcEndpoint::DisconnectedEvent>(): {
       // We always reconnect.
-      status_.store(Status::kConnecting, std::memory_order_relaxed);
+      status_.store(Subscription::Status::kConnecting, std::memory_order_relaxed);
       break;
     }
     case OneOfTagFor<RpcEndpoint::LifecycleEvent, RpcEndpoint::ErrorEvent>(): {
@@ -409,7 +967,7 @@ void Sdk::Subscription::State::HandleEvent(RpcEndpoint::LifecycleEvent&& event)
         Log("error occurred in SDK subscription: <unknown>");
       }
       // We always reconnect.
-      status_.store(Status::kConnecting, std::memory_order_relaxed);
+      status_.store(Subscription::Status::kConnecting, std::memory_order_relaxed);
       break;
     }
     case OneOfTagFor<RpcEndpoint::LifecycleEvent, RpcEndpoint::ShutdownEvent>():
@@ -8,10 +8,14 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <thread>
 #include <type_traits>
 #include <utility>
@@ -20,14 +24,24 @@
 #include "horus/functional/move_only_function.h"
 #include "horus/future/any.h"
 #include "horus/future/channel.h"
+#include "horus/future/from_continuation.h"
 #include "horus/future/future.h"
 #include "horus/future/map_to.h"
+#include "horus/future/resolved.h"
 #include "horus/future/work.h"
+#include "horus/pb/field_mask.h"
+#include "horus/pb/pool.h"
 #include "horus/rpc/endpoint.h"
 #include "horus/rpc/services.h"
+#include "horus/sdk/event_ring.h"
 #include "horus/sdk/health.h"
+#include "horus/sdk/internal/callback_executor.h"
+#include "horus/sdk/internal/conflating_queue.h"
+#include "horus/sdk/internal/event_sinks.h"
+#include "horus/sdk/internal/single_flight.h"
 #include "horus/sdk/logs.h"
 #include "horus/sdk/objects.h"
+#include "horus/sdk/options.h"
 #include "horus/sdk/point_clouds.h"
 #include "horus/sdk/profiling.h"
 #include "horus/sdk/sensor.h"
@@ -35,6 +49,7 @@
 #include "horus/sdk/zone_events.h"
 #include "horus/types/in_place.h"
 #include "horus/types/one_of.h"
+#include "horus/types/scope_guard.h"
 
 namespace horus {
 
@@ -60,13 +75,28 @@ class Sdk final {
   /// A subscription to some stream of events.
   class Subscription;
 
+  /// Statistics about the tasks processed by the event loop of the SDK, which may be used to tune
+  /// it (e.g. its `sdk::SdkOptions`).
+  struct EventLoopStats {
+    /// The number of times the event loop woke up to process tasks.
+    std::uint64_t iteration_count{0};
+    /// The number of tasks processed by the event loop.
+    std::uint64_t task_count{0};
+    /// The largest number of tasks processed in a single iteration.
+    std::uint64_t max_tasks_per_iteration{0};
+  };
+
   /// Constructs the SDK.
   ///
   /// The SDK will spawn a thread to communicate with Horus services.
   ///
   /// @throws std::bad_alloc If the event-loop cannot be allocated.
-  /// @throws std::system_error If the event-loop thread cannot be spawned.
-  explicit Sdk(const ServiceResolutionMap& services) noexcept(false);
+  /// @throws std::system_error If the event-loop thread (or a callback thread) cannot be spawned.
+  Sdk(const ServiceResolutionMap& services, const sdk::SdkOptions& options) noexcept(false);
+
+  /// Same as `Sdk()`, using the default `SdkOptions`.
+  explicit Sdk(const ServiceResolutionMap& services) noexcept(false)
+      : Sdk{services, sdk::SdkOptions{}} {}
 
   /// Same as `Sdk()`, connecting to services hosted on localhost on their default ports.
   Sdk() noexcept(false) : Sdk{ServiceResolutionMap{}} {}
@@ -98,9 +128,15 @@ class Sdk final {
   Future<Subscription> SubscribeToZoneEvents(sdk::ZoneEventSubscriptionRequest&& request);
 
   /// Subscribes to receive occupancy grid information.
+  ///
+  /// @throws std::invalid_argument If `request.max_pending_occupancy_grids` is zero with
+  /// `DeliveryPolicy::kDropOldest`.
   Future<Subscription> SubscribeToOccupancyGrid(sdk::OccupancyGridSubscriptionRequest&& request);
 
   /// Subscribes to receive point clouds.
+  ///
+  /// @throws std::invalid_argument If `request.max_pending_point_clouds` is zero with
+  /// `DeliveryPolicy::kDropOldest`.
   Future<Subscription> SubscribeToPointClouds(sdk::PointCloudSubscriptionRequest&& request);
 
   /// Subscribes to receive sensor information.
@@ -108,6 +144,9 @@ class Sdk final {
 
   /// Fetches the health status from the project manager.
   ///
+  /// The connection to the project manager is kept open between calls, and concurrent calls share
+  /// a single request.
+  ///
   /// The following exception can be thrown by the function or by its returned future.
   /// - `RpcEndpointDisconnectedError` if the project manager service could not be reached.
   /// - `CancellationError` if the request to the project manager service times out (2 seconds).
@@ -116,19 +155,66 @@ class Sdk final {
   Future<sdk::HealthStatus> GetHealthStatus(sdk::GetHealthStatusRequest&& request);
 
   /// Fetches horus current software version.
+  ///
+  /// As with `GetHealthStatus()`, the connection is kept open and concurrent calls share a single
+  /// request.
   Future<sdk::Version> GetVersion(sdk::GetVersionRequest&& request);
 
+  /// Returns statistics about the tasks processed so far by the event loop.
+  ///
+  /// The event loop drains all the tasks queued when it wakes up, and runs them one after the
+  /// other. A low `task_count` per `iteration_count` means that the loop mostly idles between
+  /// tasks.
+  EventLoopStats GetEventLoopStats() const noexcept;
+
  private:
   /// A task to perform on the event loop.
   using Task = MoveOnlyFunction<AnyFuture<void>()>;
 
+  /// Counters updated by the event loop, read by `GetEventLoopStats()`.
+  struct EventLoopCounters {
+    /// @see EventLoopStats::iteration_count
+    std::atomic<std::uint64_t> iteration_count{0};
+    /// @see EventLoopStats::task_count
+    std::atomic<std::uint64_t> task_count{0};
+    /// @see EventLoopStats::max_tasks_per_iteration
+    std::atomic<std::uint64_t> max_tasks_per_iteration{0};
+  };
+
+  /// A counter shared between a `Subscription` and the handler of its events.
+  using SharedCounter = std::shared_ptr<const std::atomic<std::uint64_t>>;
+
   /// State held by a `Future` and shared with the `Sdk`.
   template <class T>
   struct FutureState;
 
-  /// Schedules for the user `callback` to run on the thread pool with the given argument.
+  /// A connection to a subscriber service, shared by all the subscriptions to this service.
+  class SharedConnection;
+
+  /// A connection kept open for unary RPCs, which is replaced when it breaks.
+  class UnaryConnection;
+
+  /// The strand on which callbacks of a subscription run; null if there is no
+  /// `callback_executor_`.
+  using CallbackStrand = std::shared_ptr<horus_internal::CallbackExecutor::Strand>;
+
+  /// Returns a new `CallbackStrand`, or null if there is no `callback_executor_`.
+  ///
+  /// @throws std::bad_alloc If the strand cannot be allocated.
+  CallbackStrand CreateCallbackStrand() const noexcept(false) {
+    return callback_executor_ == nullptr ? nullptr : callback_executor_->CreateStrand();
+  }
+
+  /// Schedules for the user `callback` to run on the thread pool (or on the `callback_executor_` if
+  /// any) with the given argument.
   template <class Arg>
   void InvokeUserCallback(MoveOnlyFunction<void(Arg)>&& callback, std::decay_t<Arg> arg) {
+    if (callback_executor_ != nullptr) {
+      callback_executor_->Post([callback1{std::move(callback)}, arg1{std::move(arg)}]() mutable {
+        callback1(std::move(arg1));
+      });
+      return;
+    }
     task_channel_.GetSender().SendOrWait(
         [callback1{std::move(callback)}, arg1{std::move(arg)}]() mutable -> auto {
           return MapToVoid(DeferWork([callback2{std::move(callback1)}, arg2{std::move(arg1)}](
@@ -141,10 +227,35 @@ class Sdk final {
         });
   }
 
-  /// Schedules for the user `callback` to run on the thread pool with the given argument.
+  /// Schedules for the user `callback` to run on the thread pool with the given argument. If there
+  /// is a `callback_executor_`, the callback runs after all callbacks previously scheduled on
+  /// `strand` instead.
+  ///
+  /// The returned future completes once the callback is scheduled. With a `callback_executor_`,
+  /// once `kMaxPendingCallbacks` callbacks wait on `strand`, it only completes once the callback
+  /// has run, so that the event loop waits for a slow callback to catch up.
   template <class Arg>
-  ChannelSendFuture<Task> InvokeUserCallbackWithinEventLoop(MoveOnlyFunction<void(Arg)>&& callback,
-                                                            std::decay_t<Arg> arg) {
+  AnyFuture<void> InvokeUserCallbackWithinEventLoop(const CallbackStrand& strand,
+                                                    MoveOnlyFunction<void(Arg)>&& callback,
+                                                    std::decay_t<Arg> arg) {
+    if (callback_executor_ != nullptr) {
+      AnyFuture<void> result{ResolvedFuture<void>{}};
+      Continuation<void> continuation;  // Considered cancelled unless paired with `result`.
+      if (horus_internal::CallbackExecutor::PendingTaskCount(*strand) >= kMaxPendingCallbacks) {
+        std::pair<FromContinuationFuture<void>, Continuation<void>> future_and_continuation{
+            FromContinuation<void>()};
+        result = std::move(future_and_continuation.first);
+        continuation = std::move(future_and_continuation.second);
+      }
+      callback_executor_->Post(strand, [callback1{std::move(callback)}, arg1{std::move(arg)},
+                                        continuation1{std::move(continuation)}]() mutable {
+        // Resume the event loop even if the callback throws (the executor logs the error).
+        const auto resume =
+            Defer([&continuation1]() noexcept { static_cast<void>(continuation1.ContinueWith()); });
+        callback1(std::move(arg1));
+      });
+      return result;
+    }
     return task_channel_.GetSender().Send(
         [callback1{std::move(callback)}, arg1{std::move(arg)}]() mutable -> auto {
           return MapToVoid(DeferWork([callback2{std::move(callback1)}, arg2{std::move(arg1)}](
@@ -163,23 +274,108 @@ class Sdk final {
   template <class F>
   Future<FutureResult<F>> CreateFuture(F&& future) noexcept(false);
 
-  /// Constructs and returns a `Future` which completes with a `Subscription` to `target`.
-  /// `Subscriber` must be an RPC subscriber service handler, and `subscribe()` will be called on
-  /// connection to subscribe to the `target`.
+  /// Pushes `event` to `ring` if it is non-null. Otherwise, schedules for the user `callback` to
+  /// run with `event` as in `InvokeUserCallbackWithinEventLoop()`.
+  template <class T>
+  AnyFuture<void> DeliverUserEvent(const CallbackStrand& strand,
+                                   const std::shared_ptr<sdk::EventRing<T>>& ring,
+                                   const std::function<void(T&&)>& callback,
+                                   T&& event) noexcept(false);
+
+  /// Returns a `SharedCounter` for the events dropped by `ring`, or null if `ring` is null.
+  template <class T>
+  static SharedCounter DroppedEventCounter(
+      const std::shared_ptr<sdk::EventRing<T>>& ring) noexcept {
+    return ring == nullptr ? nullptr : SharedCounter{ring, &ring->DroppedCounter()};
+  }
+
+  /// Schedules for the user `callback` to be called with each value popped from `queue` until it is
+  /// empty, one value per task on `strand` (or on the event loop). Must be called when
+  /// `ConflatingQueue::Push()` returns `true`.
+  template <class T>
+  AnyFuture<void> InvokeUserCallbackUntilEmpty(
+      const CallbackStrand& strand,
+      const std::shared_ptr<horus_internal::ConflatingQueue<T>>& queue,
+      const std::function<void(T&&)>& callback) noexcept(false);
+
+  /// The state shared by the tasks scheduled by `InvokeUserCallbackUntilEmpty()`.
+  template <class T>
+  struct QueueConsumer;
+
+  /// Schedules a task delivering the next value of the queue of `consumer`, which then schedules
+  /// the task delivering the value after it until the queue is empty.
+  template <class T>
+  AnyFuture<void> ScheduleNextUserCallback(
+      std::shared_ptr<const QueueConsumer<T>>&& consumer) noexcept(false);
+
+  /// Returns the `SharedConnection` to `target` whose events are dispatched to `Sinks` (defined in
+  /// `sdk.cpp`), connecting to `target` if there is no such connection yet. Must be called from
+  /// the event loop.
   ///
-  /// @throws std::bad_alloc If the `Future` or `Subscription` cannot be allocated.
-  template <class Client, class Subscriber, class SubscriptionRequest>
-  Future<Subscription> CreateSubscription(const ServiceResolutionMap::Entry& target,
-                                          Subscriber&& subscriber,
-                                          SubscriptionRequest&& request) noexcept(false);
+  /// @throws std::bad_alloc If the connection cannot be allocated.
+  template <class Sinks>
+  AnyFuture<std::shared_ptr<SharedConnection>> GetSharedConnection(
+      const ServiceResolutionMap::Entry& target) noexcept(false);
 
-  /// Function executing in the `event_loop_thread_`.
-  static void RunEventLoop(ChannelReceiver<Task>&& task_receiver) noexcept;
+  /// Returns a future which resolves with an endpoint connected to `target` for unary RPCs,
+  /// reusing the connection of previous RPCs unless it broke. Must be called from the event loop.
+  ///
+  /// @throws std::bad_alloc If the connection cannot be allocated.
+  AnyFuture<std::shared_ptr<RpcEndpoint>> GetUnaryConnection(
+      const ServiceResolutionMap::Entry& target) noexcept(false);
+
+  /// Constructs and returns a `Future` which completes with a `Subscription` to `target`, whose
+  /// events are passed to `sink`.
+  ///
+  /// All subscriptions to `target` share a single connection, and `sink` is added to the `sinks`
+  /// of this connection. The connection is opened by the first such subscription, and closed once
+  /// all of them are destroyed.
+  ///
+  /// `dropped_event_count`, if non-null, is returned by `Subscription::DroppedEventCount()`.
+  ///
+  /// The fields skipped by `field_mask` are not deserialized if all other subscriptions sharing
+  /// the connection also skip them.
+  ///
+  /// Received events are acquired from `message_pool` if non-null, and `sink` may release them to
+  /// it once done with them.
+  ///
+  /// @throws std::bad_alloc If the `Future` or `Subscription` cannot be allocated.
+  template <class Sinks, class T>
+  Future<Subscription> CreateSubscription(
+      const ServiceResolutionMap::Entry& target, horus_internal::EventSinks<T> Sinks::*sinks,
+      typename horus_internal::EventSinks<T>::Sink&& sink,
+      SharedCounter dropped_event_count = nullptr, PbFieldMask<T>&& field_mask = {},
+      std::shared_ptr<PbMessagePool<T>> message_pool = nullptr) noexcept(false);
+
+  /// Function executing in the `event_loop_thread_`, which updates `counters` as it processes
+  /// tasks.
+  static void RunEventLoop(ChannelReceiver<Task>&& task_receiver,
+                           EventLoopCounters& counters) noexcept;
+
+  /// The number of callbacks which may wait on a `CallbackStrand` before the event loop waits for
+  /// them to run (see `InvokeUserCallbackWithinEventLoop()`), like the capacity of `task_channel_`
+  /// without a `callback_executor_`.
+  static constexpr std::size_t kMaxPendingCallbacks{64};
 
   /// The map used to resolve service hosts and ports.
   ServiceResolutionMap service_map_;
+  /// The executor on which user callbacks run; if null, they run on the libuv thread pool.
+  std::unique_ptr<horus_internal::CallbackExecutor> callback_executor_;
+  /// The connections shared by subscriptions, indexed by service and address. Only accessed from
+  /// the event loop.
+  std::map<std::string, std::weak_ptr<SharedConnection>> shared_connections_;
+  /// The connections kept open for unary RPCs, indexed by address. Only accessed from the event
+  /// loop.
+  std::map<std::string, std::shared_ptr<UnaryConnection>> unary_connections_;
+  /// The `GetHealthStatus()` request in flight. Only accessed from the event loop.
+  horus_internal::SingleFlight<sdk::pb::GetHealthStatusResponse> health_status_requests_;
+  /// The `GetVersion()` request in flight. Only accessed from the event loop.
+  horus_internal::SingleFlight<sdk::pb::GetVersionResponse> version_requests_;
   /// A channel used to send tasks to perform on the event loop.
   Channel<Task> task_channel_;
+  /// The counters updated by the event loop; never null. Allocated separately so that the `Sdk`
+  /// stays movable.
+  std::unique_ptr<EventLoopCounters> event_loop_counters_;
   /// The thread which runs the event loop.
   std::thread event_loop_thread_;
 };
@@ -342,9 +538,6 @@ void Sdk::Future<T>::OnCompletion(F&& on_completion, E&& on_error) {
 
 /// A subscription to a stream of events made from the `Sdk`.
 class HORUS_NO_DISCARD Sdk::Subscription final {
-  /// The type of the `subscribe` function.
-  using Subscribe = MoveOnlyFunction<AnyFuture<void>(const std::shared_ptr<RpcEndpoint>&)>;
-
  public:
   /// The status of the subscription.
   enum class Status : std::uint8_t {
@@ -356,9 +549,11 @@ class HORUS_NO_DISCARD Sdk::Subscription final {
     kSubscribed = 3,
   };
 
-  /// (Internal use only) Constructs a subscription.
-  explicit Subscription(Sdk& sdk, std::shared_ptr<RpcEndpoint>&& subscriber,
-                        Subscribe&& subscribe) noexcept(false);
+  /// (Internal use only) Constructs a subscription, whose events are received on `connection` by
+  /// the sinks added for `subscription_id`.
+  explicit Subscription(Sdk& sdk, std::shared_ptr<SharedConnection>&& connection,
+                        std::uint64_t subscription_id,
+                        SharedCounter&& dropped_event_count) noexcept(false);
 
   /// Non-copyable.
   Subscription(const Subscription&) = delete;
@@ -382,13 +577,18 @@ class HORUS_NO_DISCARD Sdk::Subscription final {
   /// is thread-safe).
   Status CurrentStatus() const noexcept { return state_->CurrentStatus(); }
 
+  /// The number of events dropped (rather than delivered to the callback) due to the
+  /// `sdk::DeliveryPolicy` of the subscription. Always 0 for subscriptions which never drop events.
+  std::uint64_t DroppedEventCount() const noexcept { return state_->DroppedEventCount(); }
+
  private:
   /// The state held by the subscription and stored in a `std::shared_ptr` (since it is
   /// immovable).
   class State final : public std::enable_shared_from_this<State> {
    public:
     /// Constructs the state.
-    State(Sdk& sdk, std::shared_ptr<RpcEndpoint>&& subscriber, Subscribe&& subscribe) noexcept;
+    State(Sdk& sdk, std::shared_ptr<SharedConnection>&& connection, std::uint64_t subscription_id,
+          SharedCounter&& dropped_event_count) noexcept;
 
     /// Cannot copy/move.
     State(const State&) = delete;
@@ -402,11 +602,15 @@ class HORUS_NO_DISCARD Sdk::Subscription final {
     /// Destructor.
     ~State() noexcept = default;
 
-    /// Handles a subscription lifecycle event.
-    void HandleEvent(RpcEndpoint::LifecycleEvent&& event) noexcept;
-
     /// @see Subscription::CurrentStatus()
-    Status CurrentStatus() const noexcept { return status_.load(std::memory_order_relaxed); }
+    Status CurrentStatus() const noexcept;
+
+    /// @see Subscription::DroppedEventCount()
+    std::uint64_t DroppedEventCount() const noexcept {
+      return dropped_event_count_ == nullptr
+                 ? 0
+                 : dropped_event_count_->load(std::memory_order_relaxed);
+    }
 
     /// Starts destroying the state. Called by `~Subscription()`.
     void Shutdown() noexcept;
@@ -415,15 +619,16 @@ class HORUS_NO_DISCARD Sdk::Subscription final {
     /// A reference to the SDK.
     Sdk& sdk_;
 
-    /// The endpoint which subscribes to the event stream; when destroyed, this will shut down
-    /// the connection and therefore unsubscribe.
-    std::shared_ptr<RpcEndpoint> subscriber_;
+    /// The (non-null) connection which receives the events of the subscription; when the last
+    /// subscription using it is destroyed, this will shut down the connection and therefore
+    /// unsubscribe.
+    std::shared_ptr<SharedConnection> connection_;
 
-    /// The function to call when we are connected and able to subscribe.
-    Subscribe subscribe_;
+    /// The identifier of the sinks added to `connection_` for this subscription.
+    std::uint64_t subscription_id_;
 
-    /// @see Subscription::CurrentStatus()
-    std::atomic<Status> status_{Status::kConnecting};
+    /// @see Subscription::DroppedEventCount(); null if the subscription never drops events.
+    SharedCounter dropped_event_count_;
   };
 
   /// The (non-null) state of the subscription. We use a `std::shared_ptr` since we pass a
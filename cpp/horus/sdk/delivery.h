@@ -0,0 +1,30 @@
+/// @file
+///
+/// Types describing how subscription events are delivered.
+
+#ifndef HORUS_SDK_DELIVERY_H_
+#define HORUS_SDK_DELIVERY_H_
+
+#include <cstdint>
+
+namespace horus {
+namespace sdk {
+
+/// How the events of a subscription are delivered when its callback cannot keep up with them.
+enum class DeliveryPolicy : std::uint8_t {
+  /// Every event is delivered. When the callback falls behind (i.e. a bounded number of events wait
+  /// for it, with or without `SdkOptions::callback_worker_count`), the SDK waits for it to catch up
+  /// before handling further messages, which may delay other subscriptions.
+  kBlock = 0,
+  /// A bounded number of events wait for delivery; when a new event arrives and the bound is
+  /// reached, the oldest waiting event is dropped.
+  kDropOldest = 1,
+  /// Only the latest waiting event of each source is kept; a new event replaces the waiting event
+  /// of the same source in place.
+  kKeepLatest = 2,
+};
+
+}  // namespace sdk
+}  // namespace horus
+
+#endif  // HORUS_SDK_DELIVERY_H_
@@ -0,0 +1,184 @@
+/// @file
+///
+/// The `EventRing` class.
+
+#ifndef HORUS_SDK_EVENT_RING_H_
+#define HORUS_SDK_EVENT_RING_H_
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "horus/types/in_place.h"
+#include "horus/types/one_of.h"
+#include "horus/types/span.h"
+
+namespace horus {
+namespace sdk {
+
+/// A bounded queue of events received by a subscription, which can be polled by the user instead
+/// of having the SDK invoke a callback on a worker thread.
+///
+/// Events are pushed by the SDK directly from its event loop thread, and must be popped by a
+/// single user thread (e.g. a control loop). Pushing and popping never take a lock, unless the
+/// consumer is blocked in `PopFor()`.
+///
+/// When the ring is full, new events are dropped and counted by `DroppedCount()` (and by
+/// `Sdk::Subscription::DroppedEventCount()`).
+///
+/// `T` must be default-constructible and move-assignable.
+template <class T>
+class EventRing final {
+ public:
+  /// Constructs a ring which can hold at least `capacity` (> 0) events.
+  ///
+  /// @throws std::bad_alloc If the ring cannot be allocated.
+  explicit EventRing(std::size_t capacity) noexcept(false)
+      : mask_{RoundUpToPowerOfTwo(capacity) - 1}, slots_{std::make_unique<T[]>(mask_ + 1)} {
+    assert(capacity > 0);
+  }
+
+  /// Cannot copy.
+  EventRing(const EventRing&) = delete;
+  /// Cannot copy.
+  EventRing& operator=(const EventRing&) = delete;
+  /// Cannot move, since the SDK refers to the ring.
+  EventRing(EventRing&&) = delete;
+  /// Cannot move, since the SDK refers to the ring.
+  EventRing& operator=(EventRing&&) = delete;
+
+  /// Destroys the ring and the events it holds.
+  ~EventRing() noexcept = default;
+
+  /// Returns the maximum number of events held by the ring.
+  std::size_t Capacity() const noexcept { return mask_ + 1; }
+
+  /// Returns the number of events dropped because the ring was full.
+  std::uint64_t DroppedCount() const noexcept {
+    return dropped_count_.load(std::memory_order_relaxed);
+  }
+
+  /// Removes and returns the oldest event, or returns `void` if the ring is empty.
+  OneOf<T, void> TryPop() noexcept(false);
+
+  /// Same as `TryPop()`, but waits up to `timeout` for an event if the ring is empty.
+  OneOf<T, void> PopFor(std::chrono::milliseconds timeout) noexcept(false);
+
+  /// Moves up to `output.size()` of the oldest events to `output`, and returns their count.
+  std::size_t DrainInto(Span<T> output) noexcept(false);
+
+  /// (Internal use only) Returns the counter behind `DroppedCount()`.
+  const std::atomic<std::uint64_t>& DroppedCounter() const noexcept { return dropped_count_; }
+
+  /// (Internal use only) Pushes `value` to the ring, or drops it if the ring is full. Returns
+  /// whether the value was pushed.
+  ///
+  /// Must only be called by a single (producer) thread.
+  bool TryPush(T&& value) noexcept(false);
+
+ private:
+  /// Returns the smallest power of two greater than or equal to `value`.
+  static constexpr std::size_t RoundUpToPowerOfTwo(std::size_t value) noexcept {
+    std::size_t result{1};
+    while (result < value) {
+      result <<= 1U;
+    }
+    return result;
+  }
+
+  /// Returns whether the ring is empty from the point of view of the consumer.
+  bool IsEmpty() const noexcept {
+    return head_.load(std::memory_order_relaxed) == tail_.load(std::memory_order_seq_cst);
+  }
+
+  /// Mask applied to indices to obtain slot offsets (`Capacity() - 1`).
+  const std::size_t mask_;
+  /// The slots holding the events.
+  const std::unique_ptr<T[]> slots_;
+
+  /// The index of the next event to pop. Only written by the consumer.
+  std::atomic<std::size_t> head_{0};
+  /// Keeps `head_` and `tail_` on different cache lines.
+  std::uint8_t head_padding_[64]{};  // NOLINT(*-avoid-c-arrays)
+  /// The index of the next event to push. Only written by the producer.
+  std::atomic<std::size_t> tail_{0};
+  /// Keeps `tail_` and the fields below on different cache lines.
+  std::uint8_t tail_padding_[64]{};  // NOLINT(*-avoid-c-arrays)
+
+  /// Whether the consumer is blocked in `PopFor()`.
+  std::atomic<bool> consumer_waiting_{false};
+  /// Mutex used with `pushed_cv_`.
+  std::mutex mutex_;
+  /// Condition variable notified when an event is pushed while the consumer is waiting.
+  std::condition_variable pushed_cv_;
+
+  /// @see DroppedCount()
+  std::atomic<std::uint64_t> dropped_count_{0};
+};
+
+template <class T>
+OneOf<T, void> EventRing<T>::TryPop() noexcept(false) {
+  const std::size_t head{head_.load(std::memory_order_relaxed)};
+  if (head == tail_.load(std::memory_order_acquire)) {
+    return OneOf<T, void>{InPlaceType<void>};
+  }
+  OneOf<T, void> result{InPlaceType<T>, std::move(slots_[head & mask_])};
+  head_.store(head + 1, std::memory_order_release);
+  return result;
+}
+
+template <class T>
+OneOf<T, void> EventRing<T>::PopFor(std::chrono::milliseconds timeout) noexcept(false) {
+  OneOf<T, void> result{TryPop()};
+  if (result.template Is<T>()) {
+    return result;
+  }
+  {
+    std::unique_lock<std::mutex> lock{mutex_};
+    // Sequentially consistent store followed by a sequentially consistent load in `IsEmpty()`; the
+    // producer does the opposite in `TryPush()`, so at least one of us sees the other's store.
+    consumer_waiting_.store(true, std::memory_order_seq_cst);
+    static_cast<void>(pushed_cv_.wait_for(lock, timeout, [this]() noexcept { return !IsEmpty(); }));
+    consumer_waiting_.store(false, std::memory_order_relaxed);
+  }
+  return TryPop();
+}
+
+template <class T>
+std::size_t EventRing<T>::DrainInto(Span<T> output) noexcept(false) {
+  const std::size_t head{head_.load(std::memory_order_relaxed)};
+  const std::size_t available{tail_.load(std::memory_order_acquire) - head};
+  const std::size_t count{available < output.size() ? available : output.size()};
+  for (std::size_t i{0}; i < count; ++i) {
+    output[i] = std::move(slots_[(head + i) & mask_]);
+  }
+  head_.store(head + count, std::memory_order_release);
+  return count;
+}
+
+template <class T>
+bool EventRing<T>::TryPush(T&& value) noexcept(false) {
+  const std::size_t tail{tail_.load(std::memory_order_relaxed)};
+  if (tail - head_.load(std::memory_order_acquire) > mask_) {
+    static_cast<void>(dropped_count_.fetch_add(1, std::memory_order_relaxed));
+    return false;
+  }
+  slots_[tail & mask_] = std::move(value);
+  tail_.store(tail + 1, std::memory_order_seq_cst);
+  if (consumer_waiting_.load(std::memory_order_seq_cst)) {
+    const std::unique_lock<std::mutex> lock{mutex_};
+    pushed_cv_.notify_one();
+  }
+  return true;
+}
+
+}  // namespace sdk
+}  // namespace horus
+
+#endif  // HORUS_SDK_EVENT_RING_H_
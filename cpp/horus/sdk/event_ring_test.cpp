@@ -0,0 +1,70 @@
+#include "horus/sdk/event_ring.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#include "horus/types/one_of.h"
+#include "horus/types/span.h"
+
+namespace horus {
+namespace sdk {
+namespace {
+
+TEST(EventRing, PushPop) {
+  EventRing<std::int32_t> ring{/*capacity=*/3};
+  ASSERT_EQ(ring.Capacity(), 4);
+
+  EXPECT_TRUE(ring.TryPop().Is<void>());
+  for (std::int32_t i{0}; i < 5; ++i) {
+    EXPECT_EQ(ring.TryPush(std::int32_t{i}), i < 4);
+  }
+  EXPECT_EQ(ring.DroppedCount(), 1);
+
+  EXPECT_EQ(ring.TryPop().As<std::int32_t>(), 0);
+
+  std::array<std::int32_t, 8> output{};
+  ASSERT_EQ(ring.DrainInto(Span<std::int32_t>{output}.first(2)), 2);
+  EXPECT_EQ(output[0], 1);
+  EXPECT_EQ(output[1], 2);
+  ASSERT_EQ(ring.DrainInto(output), 1);
+  EXPECT_EQ(output[0], 3);
+  EXPECT_EQ(ring.DrainInto(output), 0);
+}
+
+TEST(EventRing, PopForTimesOut) {
+  EventRing<std::int32_t> ring{/*capacity=*/1};
+  EXPECT_TRUE(ring.PopFor(std::chrono::milliseconds{1}).Is<void>());
+}
+
+TEST(EventRing, ConcurrentProducerAndConsumer) {
+  constexpr std::int32_t kEventCount{100000};
+
+  EventRing<std::int32_t> ring{/*capacity=*/64};
+  std::thread producer{[&ring]() {
+    for (std::int32_t i{0}; i < kEventCount;) {
+      if (ring.TryPush(std::int32_t{i})) {
+        ++i;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }};
+
+  std::int32_t expected{0};
+  while (expected < kEventCount) {
+    OneOf<std::int32_t, void> value{ring.PopFor(std::chrono::seconds{1})};
+    ASSERT_TRUE(value.Is<std::int32_t>());
+    ASSERT_EQ(value.As<std::int32_t>(), expected);
+    ++expected;
+  }
+  producer.join();
+}
+
+}  // namespace
+}  // namespace sdk
+}  // namespace horus
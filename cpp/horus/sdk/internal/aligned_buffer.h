@@ -0,0 +1,96 @@
+/// @file
+///
+/// The `AlignedBuffer` class.
+
+#ifndef HORUS_SDK_INTERNAL_ALIGNED_BUFFER_H_
+#define HORUS_SDK_INTERNAL_ALIGNED_BUFFER_H_
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace horus {
+namespace horus_internal {
+
+/// A buffer of trivial values whose first value is aligned to a given (over-)alignment, e.g. the
+/// size of a cache line or of a SIMD register.
+///
+/// Resizing the buffer reuses its storage when it is large enough, so that a buffer filled frame
+/// after frame only allocates until it reaches the size of the largest frame.
+template <class T>
+class AlignedBuffer final {
+  static_assert(std::is_trivial<T>::value, "T must be trivial");
+
+ public:
+  /// Constructs an empty buffer.
+  AlignedBuffer() noexcept = default;
+
+  /// Buffers cannot be copied.
+  AlignedBuffer(const AlignedBuffer&) = delete;
+  /// Buffers cannot be copied.
+  AlignedBuffer& operator=(const AlignedBuffer&) = delete;
+
+  /// Move constructor. `other` is left empty.
+  AlignedBuffer(AlignedBuffer&& other) noexcept
+      : storage_{std::move(other.storage_)},
+        data_{std::exchange(other.data_, nullptr)},
+        size_{std::exchange(other.size_, 0)} {
+    other.storage_.clear();
+  }
+
+  /// Move assignment operator. `other` is left empty.
+  AlignedBuffer& operator=(AlignedBuffer&& other) noexcept {
+    storage_ = std::move(other.storage_);
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    other.storage_.clear();
+    return *this;
+  }
+
+  /// Destroys the buffer.
+  ~AlignedBuffer() noexcept = default;
+
+  /// Resizes the buffer to `size` values whose first value is aligned to `alignment` bytes, and
+  /// returns a pointer to the first value. The values are left unspecified.
+  ///
+  /// `alignment` must be a power of two multiple of `sizeof(T)`.
+  ///
+  /// @throws std::bad_alloc If the buffer must grow and memory cannot be allocated.
+  T* Resize(std::size_t size, std::size_t alignment) noexcept(false) {
+    assert(alignment != 0 && (alignment & (alignment - 1)) == 0 && alignment % sizeof(T) == 0);
+    const std::size_t storage_size{size + alignment / sizeof(T)};
+    if (storage_.size() < storage_size) {
+      storage_.resize(storage_size);
+    }
+    void* data{storage_.data()};
+    std::size_t space{storage_.size() * sizeof(T)};
+    data_ = static_cast<T*>(std::align(alignment, size * sizeof(T), data, space));
+    assert(data_ != nullptr);
+    size_ = size;
+    return data_;
+  }
+
+  /// Returns a pointer to the first value, or null if the buffer was never resized.
+  T* data() noexcept { return data_; }
+  /// Returns a pointer to the first value, or null if the buffer was never resized.
+  const T* data() const noexcept { return data_; }
+
+  /// Returns the number of values in the buffer.
+  std::size_t size() const noexcept { return size_; }
+
+ private:
+  /// The storage of the buffer, which is over-allocated by `alignment / sizeof(T)` values.
+  std::vector<T> storage_;
+  /// Aligned pointer to the first value in `storage_`.
+  T* data_{nullptr};
+  /// @see size()
+  std::size_t size_{0};
+};
+
+}  // namespace horus_internal
+}  // namespace horus
+
+#endif  // HORUS_SDK_INTERNAL_ALIGNED_BUFFER_H_
@@ -0,0 +1,59 @@
+#include "horus/sdk/internal/aligned_buffer.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace horus {
+namespace horus_internal {
+namespace {
+
+/// Returns whether `ptr` is aligned to `alignment` bytes.
+bool IsAligned(const void* ptr, std::size_t alignment) {
+  // NOLINTNEXTLINE(*-reinterpret-cast): only inspects the address
+  return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+TEST(AlignedBuffer, ResizeAligns) {
+  AlignedBuffer<float> buffer;
+  EXPECT_EQ(buffer.data(), nullptr);
+  EXPECT_EQ(buffer.size(), 0);
+
+  for (const std::size_t size : {1, 3, 16, 100, 1000}) {
+    float* const data{buffer.Resize(size, /*alignment=*/64)};
+    EXPECT_EQ(data, buffer.data());
+    EXPECT_EQ(buffer.size(), size);
+    EXPECT_TRUE(IsAligned(data, 64));
+    for (std::size_t i{0}; i < size; ++i) {
+      data[i] = static_cast<float>(i);  // NOLINT(*-pointer-arithmetic)
+    }
+  }
+}
+
+TEST(AlignedBuffer, ResizeReusesStorage) {
+  AlignedBuffer<std::uint16_t> buffer;
+  const std::uint16_t* const data{buffer.Resize(1000, /*alignment=*/32)};
+  EXPECT_EQ(buffer.Resize(10, /*alignment=*/32), data);
+  EXPECT_EQ(buffer.Resize(1000, /*alignment=*/32), data);
+}
+
+TEST(AlignedBuffer, MoveKeepsStorage) {
+  AlignedBuffer<float> buffer;
+  const float* const data{buffer.Resize(100, /*alignment=*/64)};
+
+  AlignedBuffer<float> moved{std::move(buffer)};
+  EXPECT_EQ(moved.data(), data);
+  EXPECT_EQ(moved.size(), 100);
+  EXPECT_EQ(buffer.data(), nullptr);  // NOLINT(bugprone-use-after-move)
+  EXPECT_EQ(buffer.size(), 0);        // NOLINT(bugprone-use-after-move)
+
+  buffer = std::move(moved);
+  EXPECT_EQ(buffer.data(), data);
+  EXPECT_TRUE(IsAligned(buffer.Resize(50, /*alignment=*/64), 64));
+}
+
+}  // namespace
+}  // namespace horus_internal
+}  // namespace horus
@@ -0,0 +1,202 @@
+#include "horus/sdk/internal/callback_executor.h"
+
+#include <cassert>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+
+#include "horus/strings/logging.h"
+
+namespace horus {
+namespace horus_internal {
+namespace {
+
+/// The executor and index of the worker running on the current thread, if any.
+struct CurrentWorker {
+  /// The executor which owns the worker, or null if the current thread is not a worker thread.
+  const CallbackExecutor* executor;
+  /// The index of the worker in its executor.
+  std::size_t index;
+};
+
+/// @see CurrentWorker
+thread_local CurrentWorker current_worker{nullptr, 0};
+
+}  // namespace
+
+CallbackExecutor::CallbackExecutor(std::size_t worker_count) noexcept(false) {
+  assert(worker_count > 0);
+
+  workers_.reserve(worker_count);
+  for (std::size_t i{0}; i < worker_count; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  try {
+    for (std::size_t i{0}; i < worker_count; ++i) {
+      workers_[i]->thread = std::thread{&CallbackExecutor::Run, this, i};
+    }
+  } catch (...) {
+    Stop();
+    throw;
+  }
+}
+
+CallbackExecutor::~CallbackExecutor() noexcept { Stop(); }
+
+std::shared_ptr<CallbackExecutor::Strand> CallbackExecutor::CreateStrand() const noexcept(false) {
+  return std::make_shared<Strand>();
+}
+
+std::size_t CallbackExecutor::PendingTaskCount(Strand& strand) noexcept {
+  const std::unique_lock<std::mutex> lock{strand.mutex_};
+  return strand.tasks_.size();
+}
+
+void CallbackExecutor::Post(const std::shared_ptr<Strand>& strand, Task&& task) noexcept(false) {
+  assert(strand != nullptr);
+  Strand& target{*strand};
+  {
+    const std::unique_lock<std::mutex> lock{target.mutex_};
+    target.tasks_.push_back(std::move(task));
+    if (target.scheduled_) {
+      // The strand will pick up the task once it's done with the previous ones.
+      return;
+    }
+    target.scheduled_ = true;
+  }
+  try {
+    Schedule(std::shared_ptr<Strand>{strand});
+  } catch (const std::bad_alloc&) {
+    // The task is still queued and will run on the next successful call to `Post()`.
+    const std::unique_lock<std::mutex> lock{target.mutex_};
+    target.scheduled_ = false;
+    throw;
+  }
+}
+
+void CallbackExecutor::Schedule(std::shared_ptr<Strand>&& strand) noexcept(false) {
+  {
+    // Push the strand and count it under the same lock, so that a worker woken up by the count
+    // always finds the strand in a queue rather than spinning until it gets there.
+    const std::unique_lock<std::mutex> lock{mutex_};
+    std::size_t index{0};
+    if (current_worker.executor == this) {
+      // Keep strands scheduled by a worker local to that worker.
+      index = current_worker.index;
+    } else {
+      index = next_worker_;
+      next_worker_ = (next_worker_ + 1) % workers_.size();
+    }
+    Worker& worker{*workers_[index]};
+    {
+      const std::unique_lock<std::mutex> worker_lock{worker.mutex};
+      worker.ready.push_back(std::move(strand));
+    }
+    ++ready_count_;
+  }
+  ready_cv_.notify_one();
+}
+
+std::shared_ptr<CallbackExecutor::Strand> CallbackExecutor::PopOrSteal(std::size_t index) noexcept {
+  const std::size_t worker_count{workers_.size()};
+  for (std::size_t i{0}; i < worker_count; ++i) {
+    Worker& worker{*workers_[(index + i) % worker_count]};
+    std::shared_ptr<Strand> strand{nullptr};
+    {
+      const std::unique_lock<std::mutex> lock{worker.mutex};
+      if (worker.ready.empty()) {
+        continue;
+      }
+      if (i == 0) {
+        // Own queue: take the strand which has been waiting the longest.
+        strand = std::move(worker.ready.front());
+        worker.ready.pop_front();
+      } else {
+        // Other queue: steal from the back to avoid contending with its owner.
+        strand = std::move(worker.ready.back());
+        worker.ready.pop_back();
+      }
+    }
+    const std::unique_lock<std::mutex> lock{mutex_};
+    --ready_count_;
+    return strand;
+  }
+  return nullptr;
+}
+
+void CallbackExecutor::RunStrand(std::shared_ptr<Strand>&& strand) noexcept {
+  Strand& target{*strand};
+  for (std::size_t i{0}; i < kMaxTasksPerTurn; ++i) {
+    Task task{nullptr};
+    {
+      const std::unique_lock<std::mutex> lock{target.mutex_};
+      if (target.tasks_.empty()) {
+        target.scheduled_ = false;
+        return;
+      }
+      task = std::move(target.tasks_.front());
+      target.tasks_.pop_front();
+    }
+    try {
+      task();
+    } catch (const std::exception& e) {
+      Log("error in SDK callback: ", e.what());
+    } catch (...) {
+      Log("error in SDK callback: <unknown>");
+    }
+  }
+
+  {
+    const std::unique_lock<std::mutex> lock{target.mutex_};
+    if (target.tasks_.empty()) {
+      target.scheduled_ = false;
+      return;
+    }
+  }
+  // More tasks are pending; requeue the strand behind other strands to be fair.
+  try {
+    Schedule(std::move(strand));
+  } catch (const std::bad_alloc&) {
+    // The pending tasks will run on the next successful call to `Post()`.
+    const std::unique_lock<std::mutex> lock{target.mutex_};
+    target.scheduled_ = false;
+  }
+}
+
+void CallbackExecutor::Run(std::size_t index) noexcept {
+  current_worker = CurrentWorker{this, index};
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> lock{mutex_};
+      ready_cv_.wait(lock, [this]() noexcept { return stopping_ || ready_count_ > 0; });
+      if (stopping_) {
+        break;
+      }
+    }
+    std::shared_ptr<Strand> strand{PopOrSteal(index)};
+    if (strand != nullptr) {
+      RunStrand(std::move(strand));
+    }
+  }
+  current_worker = CurrentWorker{nullptr, 0};
+}
+
+void CallbackExecutor::Stop() noexcept {
+  {
+    const std::unique_lock<std::mutex> lock{mutex_};
+    stopping_ = true;
+  }
+  ready_cv_.notify_all();
+  for (const std::unique_ptr<Worker>& worker : workers_) {
+    if (worker->thread.joinable()) {
+      worker->thread.join();
+    }
+  }
+}
+
+}  // namespace horus_internal
+}  // namespace horus
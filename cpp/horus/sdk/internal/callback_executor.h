@@ -0,0 +1,155 @@
+/// @file
+///
+/// The `CallbackExecutor` class.
+
+#ifndef HORUS_SDK_INTERNAL_CALLBACK_EXECUTOR_H_
+#define HORUS_SDK_INTERNAL_CALLBACK_EXECUTOR_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "horus/functional/move_only_function.h"
+
+namespace horus {
+namespace horus_internal {
+
+/// A pool of dedicated threads which execute user callbacks.
+///
+/// Tasks are posted to `Strand`s. Tasks posted to the same `Strand` run sequentially, in the order
+/// in which they were posted, while tasks posted to different `Strand`s may run in parallel.
+///
+/// Each worker thread has its own queue of strands ready to run; a worker whose queue is empty
+/// steals strands from the back of the queues of other workers.
+class CallbackExecutor final {
+ public:
+  /// A sequence of tasks which must run one after the other.
+  class Strand;
+
+  /// A task to execute.
+  using Task = MoveOnlyFunction<void()>;
+
+  /// Constructs the executor and spawns `worker_count` (> 0) worker threads.
+  ///
+  /// @throws std::bad_alloc If the workers cannot be allocated.
+  /// @throws std::system_error If a worker thread cannot be spawned.
+  explicit CallbackExecutor(std::size_t worker_count) noexcept(false);
+
+  /// Cannot copy.
+  CallbackExecutor(const CallbackExecutor&) = delete;
+  /// Cannot copy.
+  CallbackExecutor& operator=(const CallbackExecutor&) = delete;
+  /// Cannot move, since workers refer to the executor.
+  CallbackExecutor(CallbackExecutor&&) = delete;
+  /// Cannot move, since workers refer to the executor.
+  CallbackExecutor& operator=(CallbackExecutor&&) = delete;
+
+  /// Destroys the executor, waiting for running tasks to complete. Tasks which did not start yet
+  /// are discarded.
+  ~CallbackExecutor() noexcept;
+
+  /// Returns a new `Strand`.
+  ///
+  /// @throws std::bad_alloc If the strand cannot be allocated.
+  std::shared_ptr<Strand> CreateStrand() const noexcept(false);
+
+  /// Schedules `task` to run after all tasks previously posted to `strand`.
+  ///
+  /// @throws std::bad_alloc If the task cannot be enqueued.
+  void Post(const std::shared_ptr<Strand>& strand, Task&& task) noexcept(false);
+
+  /// Returns the number of tasks posted to `strand` which did not start yet.
+  static std::size_t PendingTaskCount(Strand& strand) noexcept;
+
+  /// Schedules `task` to run with no ordering guarantee.
+  ///
+  /// @throws std::bad_alloc If the task cannot be enqueued.
+  void Post(Task&& task) noexcept(false) { Post(CreateStrand(), std::move(task)); }
+
+  /// Returns the number of worker threads.
+  std::size_t WorkerCount() const noexcept { return workers_.size(); }
+
+ private:
+  /// A worker thread and its queue of strands ready to run.
+  struct Worker {
+    /// Mutex which guards `ready`.
+    std::mutex mutex;
+    /// Strands which have pending tasks and are not running.
+    std::deque<std::shared_ptr<Strand>> ready;
+    /// The thread running `Run()`.
+    std::thread thread;
+  };
+
+  /// Maximum number of tasks of a single strand executed before other strands get a chance to run.
+  static constexpr std::size_t kMaxTasksPerTurn{16};
+
+  /// Enqueues `strand`, which must not be running nor queued, on a worker.
+  void Schedule(std::shared_ptr<Strand>&& strand) noexcept(false);
+
+  /// Dequeues a strand from the queue of worker `index`, or steals one from another worker.
+  /// Returns null if all queues are empty.
+  std::shared_ptr<Strand> PopOrSteal(std::size_t index) noexcept;
+
+  /// Runs up to `kMaxTasksPerTurn` tasks of `strand`, rescheduling it if it has more tasks.
+  void RunStrand(std::shared_ptr<Strand>&& strand) noexcept;
+
+  /// Function executing in worker thread `index`.
+  void Run(std::size_t index) noexcept;
+
+  /// Stops and joins all running workers.
+  void Stop() noexcept;
+
+  /// The workers.
+  std::vector<std::unique_ptr<Worker>> workers_;
+
+  /// Mutex which guards `ready_count_` and `stopping_`. It is locked before `Worker::mutex` when
+  /// both are locked.
+  std::mutex mutex_;
+  /// Condition variable notified when a strand is scheduled, or when the executor is stopping.
+  std::condition_variable ready_cv_;
+  /// The number of strands scheduled in all `Worker::ready` queues. This is incremented _after_
+  /// pushing a strand to a queue (under the same lock of `mutex_`), and decremented _after_
+  /// popping it, so it never exceeds the number of queued strands for longer than a pop.
+  std::size_t ready_count_{0};
+  /// Whether the executor is being destroyed.
+  bool stopping_{false};
+  /// The worker on which the next strand scheduled from outside of the executor will be queued.
+  std::size_t next_worker_{0};
+};
+
+class CallbackExecutor::Strand final {
+ public:
+  /// Constructs an empty strand.
+  Strand() noexcept = default;
+
+  /// Cannot copy.
+  Strand(const Strand&) = delete;
+  /// Cannot copy.
+  Strand& operator=(const Strand&) = delete;
+  /// Cannot move.
+  Strand(Strand&&) = delete;
+  /// Cannot move.
+  Strand& operator=(Strand&&) = delete;
+
+  /// Destroys the strand and its pending tasks.
+  ~Strand() noexcept = default;
+
+ private:
+  friend class CallbackExecutor;
+
+  /// Mutex which guards `tasks_` and `scheduled_`.
+  std::mutex mutex_;
+  /// Tasks to run, in order.
+  std::deque<Task> tasks_;
+  /// Whether the strand is queued in a `Worker` or running.
+  bool scheduled_{false};
+};
+
+}  // namespace horus_internal
+}  // namespace horus
+
+#endif  // HORUS_SDK_INTERNAL_CALLBACK_EXECUTOR_H_
@@ -0,0 +1,96 @@
+#include "horus/sdk/internal/callback_executor.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace horus {
+namespace horus_internal {
+namespace {
+
+constexpr std::chrono::seconds kTimeout{5};
+
+TEST(CallbackExecutor, TasksOfStrandRunInOrder) {
+  constexpr std::size_t kTaskCount{1000};
+
+  CallbackExecutor executor{/*worker_count=*/4};
+  const std::shared_ptr<CallbackExecutor::Strand> strand{executor.CreateStrand()};
+  std::vector<std::size_t> order;
+  std::promise<void> done;
+
+  for (std::size_t i{0}; i < kTaskCount; ++i) {
+    executor.Post(strand, [i, &order, &done]() {
+      order.push_back(i);
+      if (order.size() == kTaskCount) {
+        done.set_value();
+      }
+    });
+  }
+
+  ASSERT_EQ(done.get_future().wait_for(kTimeout), std::future_status::ready);
+  for (std::size_t i{0}; i < kTaskCount; ++i) {
+    EXPECT_EQ(order[i], i);
+  }
+}
+
+TEST(CallbackExecutor, SlowStrandDoesNotBlockOtherStrands) {
+  CallbackExecutor executor{/*worker_count=*/2};
+  const std::shared_ptr<CallbackExecutor::Strand> slow_strand{executor.CreateStrand()};
+  const std::shared_ptr<CallbackExecutor::Strand> fast_strand{executor.CreateStrand()};
+
+  std::promise<void> unblock_slow;
+  std::shared_future<void> slow_unblocked{unblock_slow.get_future().share()};
+  std::promise<void> slow_done;
+
+  // Block `slow_strand` until a task of `fast_strand` runs.
+  executor.Post(slow_strand, [slow_unblocked]() { slow_unblocked.wait(); });
+  executor.Post(slow_strand, [&slow_done]() { slow_done.set_value(); });
+  executor.Post(fast_strand, [&unblock_slow]() { unblock_slow.set_value(); });
+
+  EXPECT_EQ(slow_done.get_future().wait_for(kTimeout), std::future_status::ready);
+}
+
+TEST(CallbackExecutor, PendingTaskCount) {
+  CallbackExecutor executor{/*worker_count=*/1};
+  const std::shared_ptr<CallbackExecutor::Strand> strand{executor.CreateStrand()};
+  EXPECT_EQ(CallbackExecutor::PendingTaskCount(*strand), 0);
+
+  std::promise<void> started;
+  std::promise<void> unblock;
+  std::shared_future<void> unblocked{unblock.get_future().share()};
+  std::promise<void> done;
+  executor.Post(strand, [&started, unblocked]() {
+    started.set_value();
+    unblocked.wait();
+  });
+  ASSERT_EQ(started.get_future().wait_for(kTimeout), std::future_status::ready);
+  executor.Post(strand, []() {});
+  executor.Post(strand, [&done]() { done.set_value(); });
+  EXPECT_EQ(CallbackExecutor::PendingTaskCount(*strand), 2);
+
+  unblock.set_value();
+  ASSERT_EQ(done.get_future().wait_for(kTimeout), std::future_status::ready);
+  EXPECT_EQ(CallbackExecutor::PendingTaskCount(*strand), 0);
+}
+
+TEST(CallbackExecutor, UnorderedTasksRun) {
+  constexpr std::size_t kTaskCount{100};
+
+  CallbackExecutor executor{/*worker_count=*/3};
+  std::vector<std::promise<void>> promises(kTaskCount);
+
+  for (std::promise<void>& promise : promises) {
+    executor.Post([&promise]() { promise.set_value(); });
+  }
+  for (std::promise<void>& promise : promises) {
+    EXPECT_EQ(promise.get_future().wait_for(kTimeout), std::future_status::ready);
+  }
+}
+
+}  // namespace
+}  // namespace horus_internal
+}  // namespace horus
@@ -0,0 +1,41 @@
+#include "horus/sdk/internal/compress_tables.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace horus {
+namespace horus_internal {
+namespace {
+
+/// Computes the `CompressTables`.
+CompressTables MakeCompressTables() noexcept {
+  CompressTables tables{};
+  for (std::size_t mask{0}; mask < tables.lanes8.size(); ++mask) {
+    std::size_t count{0};
+    for (std::size_t lane{0}; lane < 8; ++lane) {
+      if ((mask >> lane & 1) != 0) {
+        tables.lanes8[mask][count] = static_cast<std::uint32_t>(lane);
+        tables.bytes8[mask][count * 2] = static_cast<std::uint8_t>(lane * 2);
+        tables.bytes8[mask][count * 2 + 1] = static_cast<std::uint8_t>(lane * 2 + 1);
+        if (mask < tables.bytes4.size()) {
+          for (std::size_t byte{0}; byte < 4; ++byte) {
+            tables.bytes4[mask][count * 4 + byte] = static_cast<std::uint8_t>(lane * 4 + byte);
+          }
+        }
+        ++count;
+      }
+    }
+    tables.counts[mask] = static_cast<std::uint8_t>(count);
+  }
+  return tables;
+}
+
+}  // namespace
+
+const CompressTables& GetCompressTables() noexcept {
+  static const CompressTables tables{MakeCompressTables()};
+  return tables;
+}
+
+}  // namespace horus_internal
+}  // namespace horus
@@ -0,0 +1,36 @@
+/// @file
+///
+/// The `CompressTables` struct.
+
+#ifndef HORUS_SDK_INTERNAL_COMPRESS_TABLES_H_
+#define HORUS_SDK_INTERNAL_COMPRESS_TABLES_H_
+
+#include <array>
+#include <cstdint>
+
+namespace horus {
+namespace horus_internal {
+
+/// Lookup tables used by SIMD kernels to compact the lanes of a vector selected by a bitmask (as
+/// the AVX-512 `compress` instructions do), so that the selected values can be stored contiguously.
+///
+/// For a mask whose bit `i` is set iff lane `i` is selected, the selected lanes are moved first, in
+/// order. The remaining lanes are unspecified.
+struct CompressTables {
+  /// For each 8-bit mask, the lanes to pass to `_mm256_permutevar8x32_ps()`.
+  alignas(32) std::array<std::array<std::uint32_t, 8>, 256> lanes8;
+  /// For each 4-bit mask, the bytes of 32-bit lanes to pass to `_mm_shuffle_epi8()`.
+  alignas(16) std::array<std::array<std::uint8_t, 16>, 16> bytes4;
+  /// For each 8-bit mask, the bytes of 16-bit lanes to pass to `_mm_shuffle_epi8()`.
+  alignas(16) std::array<std::array<std::uint8_t, 16>, 256> bytes8;
+  /// For each 8-bit mask, the number of set bits.
+  std::array<std::uint8_t, 256> counts;
+};
+
+/// Returns the `CompressTables`, computed once.
+const CompressTables& GetCompressTables() noexcept;
+
+}  // namespace horus_internal
+}  // namespace horus
+
+#endif  // HORUS_SDK_INTERNAL_COMPRESS_TABLES_H_
@@ -0,0 +1,136 @@
+/// @file
+///
+/// The `ConflatingQueue` class.
+
+#ifndef HORUS_SDK_INTERNAL_CONFLATING_QUEUE_H_
+#define HORUS_SDK_INTERNAL_CONFLATING_QUEUE_H_
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "horus/sdk/delivery.h"
+#include "horus/types/in_place.h"
+#include "horus/types/one_of.h"
+
+namespace horus {
+namespace horus_internal {
+
+/// A queue of events waiting to be delivered to a user callback, which drops events according to
+/// a `sdk::DeliveryPolicy` instead of growing.
+///
+/// The queue is _idle_ until a value is pushed. At this point, `Push()` returns `true` and the
+/// caller must schedule a consumer which calls `Pop()` until it returns `void`, at which point the
+/// queue becomes idle again.
+template <class T>
+class ConflatingQueue final {
+ public:
+  /// Constructs an idle queue.
+  ///
+  /// With `kDropOldest`, up to `capacity` values are kept. With `kKeepLatest`, one value is kept
+  /// per source key and `capacity` is ignored. `kBlock` is not supported.
+  ///
+  /// @throws std::invalid_argument If `policy` is `kDropOldest` and `capacity` is zero.
+  ConflatingQueue(sdk::DeliveryPolicy policy, std::size_t capacity) noexcept(false)
+      : policy_{policy}, capacity_{capacity} {
+    assert(policy != sdk::DeliveryPolicy::kBlock);
+    if (policy == sdk::DeliveryPolicy::kDropOldest && capacity == 0) {
+      throw std::invalid_argument{"the capacity of a drop-oldest queue must be positive"};
+    }
+  }
+
+  /// Adds `value` emitted by the source identified by `key` to the queue, dropping a previous
+  /// value if necessary.
+  ///
+  /// Returns `true` if the queue was idle, in which case the caller must schedule a consumer.
+  ///
+  /// @throws std::bad_alloc If the value cannot be enqueued.
+  bool Push(std::string&& key, T&& value) noexcept(false);
+
+  /// Removes and returns the oldest value of the queue, or returns `void` and marks the queue as
+  /// idle if it is empty.
+  OneOf<T, void> Pop() noexcept(false);
+
+  /// Returns the number of values dropped since the queue was constructed.
+  const std::atomic<std::uint64_t>& DroppedCount() const noexcept { return dropped_count_; }
+
+ private:
+  /// A value in the queue.
+  struct Entry {
+    /// The key of the source of the value.
+    std::string key;
+    /// The value.
+    T value;
+  };
+
+  /// The policy used to drop values.
+  const sdk::DeliveryPolicy policy_;
+  /// The capacity of the queue with `kDropOldest`.
+  const std::size_t capacity_;
+
+  /// Mutex which guards `entries_` and `consuming_`.
+  std::mutex mutex_;
+  /// The values in the queue, oldest first.
+  std::deque<Entry> entries_;
+  /// Whether a consumer has been scheduled (i.e. the queue is not idle).
+  bool consuming_{false};
+
+  /// @see DroppedCount()
+  std::atomic<std::uint64_t> dropped_count_{0};
+};
+
+template <class T>
+bool ConflatingQueue<T>::Push(std::string&& key, T&& value) noexcept(false) {
+  const std::unique_lock<std::mutex> lock{mutex_};
+  bool dropped{false};
+  if (policy_ == sdk::DeliveryPolicy::kKeepLatest) {
+    // There are only a handful of sources, so a linear search beats a map.
+    for (Entry& entry : entries_) {
+      if (entry.key == key) {
+        entry.value = std::move(value);
+        dropped = true;
+        break;
+      }
+    }
+    if (!dropped) {
+      entries_.push_back(Entry{std::move(key), std::move(value)});
+    }
+  } else {
+    if (entries_.size() == capacity_) {
+      entries_.pop_front();
+      dropped = true;
+    }
+    entries_.push_back(Entry{std::move(key), std::move(value)});
+  }
+  if (dropped) {
+    static_cast<void>(dropped_count_.fetch_add(1, std::memory_order_relaxed));
+  }
+  if (consuming_) {
+    return false;
+  }
+  consuming_ = true;
+  return true;
+}
+
+template <class T>
+OneOf<T, void> ConflatingQueue<T>::Pop() noexcept(false) {
+  const std::unique_lock<std::mutex> lock{mutex_};
+  if (entries_.empty()) {
+    consuming_ = false;
+    return OneOf<T, void>{InPlaceType<void>};
+  }
+  OneOf<T, void> result{InPlaceType<T>, std::move(entries_.front().value)};
+  entries_.pop_front();
+  return result;
+}
+
+}  // namespace horus_internal
+}  // namespace horus
+
+#endif  // HORUS_SDK_INTERNAL_CONFLATING_QUEUE_H_
@@ -0,0 +1,79 @@
+#include "horus/sdk/internal/conflating_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "horus/sdk/delivery.h"
+#include "horus/types/one_of.h"
+
+namespace horus {
+namespace horus_internal {
+namespace {
+
+/// Pops all values from `queue`.
+std::vector<std::int32_t> PopAll(ConflatingQueue<std::int32_t>& queue) {
+  std::vector<std::int32_t> values;
+  for (;;) {
+    OneOf<std::int32_t, void> value{queue.Pop()};
+    if (value.Is<void>()) {
+      return values;
+    }
+    values.push_back(value.As<std::int32_t>());
+  }
+}
+
+TEST(ConflatingQueue, PushReturnsWhetherIdle) {
+  ConflatingQueue<std::int32_t> queue{sdk::DeliveryPolicy::kDropOldest, /*capacity=*/4};
+
+  EXPECT_TRUE(queue.Push("a", 1));
+  EXPECT_FALSE(queue.Push("a", 2));
+  EXPECT_EQ(PopAll(queue), (std::vector<std::int32_t>{1, 2}));
+
+  // Queue is idle again after `Pop()` returned `void`.
+  EXPECT_TRUE(queue.Push("a", 3));
+  EXPECT_EQ(PopAll(queue), (std::vector<std::int32_t>{3}));
+  EXPECT_EQ(queue.DroppedCount().load(), 0);
+}
+
+TEST(ConflatingQueue, DropOldest) {
+  ConflatingQueue<std::int32_t> queue{sdk::DeliveryPolicy::kDropOldest, /*capacity=*/2};
+
+  EXPECT_TRUE(queue.Push("a", 1));
+  EXPECT_FALSE(queue.Push("b", 2));
+  EXPECT_FALSE(queue.Push("a", 3));
+  EXPECT_FALSE(queue.Push("b", 4));
+
+  EXPECT_EQ(PopAll(queue), (std::vector<std::int32_t>{3, 4}));
+  EXPECT_EQ(queue.DroppedCount().load(), 2);
+}
+
+TEST(ConflatingQueue, ZeroCapacity) {
+  EXPECT_THROW(ConflatingQueue<std::int32_t>(sdk::DeliveryPolicy::kDropOldest, /*capacity=*/0),
+               std::invalid_argument);
+
+  // The capacity is not used with `kKeepLatest`.
+  ConflatingQueue<std::int32_t> queue{sdk::DeliveryPolicy::kKeepLatest, /*capacity=*/0};
+  EXPECT_TRUE(queue.Push("a", 1));
+  EXPECT_EQ(PopAll(queue), (std::vector<std::int32_t>{1}));
+}
+
+TEST(ConflatingQueue, KeepLatest) {
+  ConflatingQueue<std::int32_t> queue{sdk::DeliveryPolicy::kKeepLatest, /*capacity=*/1};
+
+  EXPECT_TRUE(queue.Push("a", 1));
+  EXPECT_FALSE(queue.Push("b", 2));
+  EXPECT_FALSE(queue.Push("a", 3));
+  EXPECT_FALSE(queue.Push("c", 4));
+  EXPECT_FALSE(queue.Push("b", 5));
+
+  // Values are replaced in place, so sources keep their order.
+  EXPECT_EQ(PopAll(queue), (std::vector<std::int32_t>{3, 5, 4}));
+  EXPECT_EQ(queue.DroppedCount().load(), 2);
+}
+
+}  // namespace
+}  // namespace horus_internal
+}  // namespace horus
@@ -0,0 +1,198 @@
+/// @file
+///
+/// The `EventSinks` class.
+
+#ifndef HORUS_SDK_INTERNAL_EVENT_SINKS_H_
+#define HORUS_SDK_INTERNAL_EVENT_SINKS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "horus/functional/move_only_function.h"
+#include "horus/future/any.h"
+#include "horus/future/resolved.h"
+#include "horus/future/then.h"
+#include "horus/pb/field_mask.h"
+#include "horus/pb/pool.h"
+
+namespace horus {
+namespace horus_internal {
+
+/// Base class of the sets of `EventSinks` of a connection shared by several subscriptions.
+class SubscriberEventSinks {
+ public:
+  /// Cannot copy.
+  SubscriberEventSinks(const SubscriberEventSinks&) = delete;
+  /// Cannot copy.
+  SubscriberEventSinks& operator=(const SubscriberEventSinks&) = delete;
+  /// Cannot move.
+  SubscriberEventSinks(SubscriberEventSinks&&) = delete;
+  /// Cannot move.
+  SubscriberEventSinks& operator=(SubscriberEventSinks&&) = delete;
+
+  /// Virtual destructor for inheritance.
+  virtual ~SubscriberEventSinks() = default;
+
+  /// Unregisters all the sinks added for the subscription `subscription_id`.
+  virtual void Remove(std::uint64_t subscription_id) noexcept = 0;
+
+ protected:
+  /// Default constructor.
+  SubscriberEventSinks() noexcept = default;
+};
+
+/// The functions handling events of type `T` received on a connection shared by several
+/// subscriptions, keyed by the identifier of the subscription which registered them.
+///
+/// Not thread-safe: the SDK only uses sinks from its event loop.
+template <class T>
+class EventSinks final {
+ public:
+  /// A function which handles an event, returning a future which resolves once the event has been
+  /// accepted.
+  using Sink = MoveOnlyFunction<AnyFuture<void>(T&&)>;
+
+  /// Constructs an empty set of sinks.
+  EventSinks() noexcept = default;
+
+  /// Cannot copy.
+  EventSinks(const EventSinks&) = delete;
+  /// Cannot copy.
+  EventSinks& operator=(const EventSinks&) = delete;
+  /// Move constructor.
+  EventSinks(EventSinks&&) noexcept = default;
+  /// Move assignment operator.
+  EventSinks& operator=(EventSinks&&) noexcept = default;
+
+  /// Destroys the sinks.
+  ~EventSinks() noexcept = default;
+
+  /// Registers `sink` for the subscription `subscription_id`. `sink` does not read the fields
+  /// skipped by `field_mask`, and releases the events it is done with to `message_pool` if
+  /// non-null.
+  ///
+  /// @throws std::bad_alloc If the sink cannot be registered.
+  void Add(std::uint64_t subscription_id, Sink&& sink, PbFieldMask<T>&& field_mask = {},
+           std::shared_ptr<PbMessagePool<T>> message_pool = nullptr) noexcept(false) {
+    sinks_.push_back(Entry{subscription_id, std::move(sink), std::move(field_mask),
+                           std::move(message_pool)});
+    UpdateFieldMask();
+    UpdateMessagePool();
+  }
+
+  /// Unregisters the sinks added for the subscription `subscription_id`.
+  void Remove(std::uint64_t subscription_id) noexcept {
+    std::size_t kept{0};
+    for (std::size_t i{0}; i < sinks_.size(); ++i) {
+      if (sinks_[i].subscription_id != subscription_id) {
+        if (kept != i) {
+          sinks_[kept] = std::move(sinks_[i]);
+        }
+        ++kept;
+      }
+    }
+    while (sinks_.size() > kept) {
+      sinks_.pop_back();
+    }
+    UpdateFieldMask();
+    UpdateMessagePool();
+  }
+
+  /// Returns the number of registered sinks.
+  std::size_t Size() const noexcept { return sinks_.size(); }
+
+  /// Returns the mask of the fields which no registered sink reads, and which therefore do not need
+  /// to be deserialized.
+  constexpr const PbFieldMask<T>& FieldMask() const noexcept { return field_mask_; }
+
+  /// Returns the pool from which received events should be acquired, i.e. the pool of the first
+  /// registered sink which has one, or null.
+  constexpr const std::shared_ptr<PbMessagePool<T>>& MessagePool() const noexcept {
+    return message_pool_;
+  }
+
+  /// Passes `event` to all registered sinks, returning a future which resolves once all of them
+  /// accepted it.
+  ///
+  /// The event is only parsed once; all sinks but the last receive a (shallow) copy of it, which
+  /// is not acquired from `MessagePool()`.
+  ///
+  /// @throws std::exception Any exception thrown by a sink.
+  AnyFuture<void> Dispatch(T&& event) noexcept(false);
+
+ private:
+  /// A registered sink.
+  struct Entry {
+    /// The identifier of the subscription which registered the sink.
+    std::uint64_t subscription_id;
+    /// The sink.
+    Sink sink;
+    /// The fields which the sink does not read.
+    PbFieldMask<T> field_mask;
+    /// The pool to which the sink releases events, or null.
+    std::shared_ptr<PbMessagePool<T>> message_pool;
+  };
+
+  /// Recomputes `field_mask_` from the masks of the registered sinks.
+  void UpdateFieldMask() noexcept {
+    try {
+      PbFieldMask<T> field_mask{sinks_.empty() ? PbFieldMask<T>{} : sinks_.front().field_mask};
+      for (std::size_t i{1}; i < sinks_.size(); ++i) {
+        field_mask = field_mask.Union(sinks_[i].field_mask);
+      }
+      field_mask_ = std::move(field_mask);
+    } catch (const std::bad_alloc&) {
+      // Deserializing all fields is always correct.
+      field_mask_ = PbFieldMask<T>{};
+    }
+  }
+
+  /// Recomputes `message_pool_` from the pools of the registered sinks.
+  void UpdateMessagePool() noexcept {
+    for (const Entry& entry : sinks_) {
+      if (entry.message_pool != nullptr) {
+        message_pool_ = entry.message_pool;
+        return;
+      }
+    }
+    message_pool_ = nullptr;
+  }
+
+  /// The registered sinks, in registration order.
+  std::vector<Entry> sinks_;
+  /// @see FieldMask()
+  PbFieldMask<T> field_mask_;
+  /// @see MessagePool()
+  std::shared_ptr<PbMessagePool<T>> message_pool_;
+};
+
+template <class T>
+AnyFuture<void> EventSinks<T>::Dispatch(T&& event) noexcept(false) {
+  T owned_event{std::move(event)};
+  if (sinks_.empty()) {
+    return ResolvedFuture<void>{};
+  }
+  const std::size_t last{sinks_.size() - 1};
+  AnyFuture<void> result{ResolvedFuture<void>{}};
+  for (std::size_t i{0}; i < last; ++i) {
+    // Sinks only return futures to apply back-pressure, so we wait for them in turn.
+    result = std::move(result) | Then([accepted{sinks_[i].sink(T{owned_event})}]() mutable {
+               return std::move(accepted);
+             });
+  }
+  AnyFuture<void> last_accepted{sinks_[last].sink(std::move(owned_event))};
+  if (last == 0) {
+    return last_accepted;
+  }
+  return std::move(result) |
+         Then([accepted{std::move(last_accepted)}]() mutable { return std::move(accepted); });
+}
+
+}  // namespace horus_internal
+}  // namespace horus
+
+#endif  // HORUS_SDK_INTERNAL_EVENT_SINKS_H_
@@ -0,0 +1,97 @@
+#include "horus/sdk/internal/event_sinks.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "horus/future/any.h"
+#include "horus/future/resolved.h"
+#include "horus/pb/field_mask.h"
+#include "horus/pb/pool.h"
+#include "horus/pb/testing/messages_pb.h"
+#include "horus/testing/event_loop.h"
+
+namespace horus {
+namespace horus_internal {
+namespace {
+
+TEST(EventSinks, DispatchesToAllSinksInOrder) {
+  EventSinks<std::int32_t> sinks;
+  std::vector<std::int32_t> received;
+  for (std::uint64_t subscription_id{0}; subscription_id < 3; ++subscription_id) {
+    sinks.Add(subscription_id, [&received, subscription_id](std::int32_t&& event) {
+      received.push_back(event * 10 + static_cast<std::int32_t>(subscription_id));
+      return AnyFuture<void>{ResolvedFuture<void>{}};
+    });
+  }
+  ASSERT_EQ(sinks.Size(), 3);
+
+  TestOnlyExecute(sinks.Dispatch(1));
+  EXPECT_EQ(received, (std::vector<std::int32_t>{10, 11, 12}));
+
+  sinks.Remove(1);
+  ASSERT_EQ(sinks.Size(), 2);
+  received.clear();
+  TestOnlyExecute(sinks.Dispatch(2));
+  EXPECT_EQ(received, (std::vector<std::int32_t>{20, 22}));
+}
+
+TEST(EventSinks, DispatchWithoutSinks) {
+  EventSinks<std::int32_t> sinks;
+  TestOnlyExecute(sinks.Dispatch(1));
+  EXPECT_EQ(sinks.Size(), 0);
+}
+
+TEST(EventSinks, FieldMaskOnlySkipsFieldsSkippedByAllSinks) {
+  EventSinks<std::int32_t> sinks;
+  const auto sink = []() {
+    return [](std::int32_t&& /* event */) { return AnyFuture<void>{ResolvedFuture<void>{}}; };
+  };
+  EXPECT_TRUE(sinks.FieldMask().KeepsAll());
+
+  sinks.Add(0, sink(), PbFieldMask<std::int32_t>{}.Skip(1).Skip(2));
+  EXPECT_TRUE(sinks.FieldMask().IsSkipped(1));
+  EXPECT_TRUE(sinks.FieldMask().IsSkipped(2));
+
+  sinks.Add(1, sink(), PbFieldMask<std::int32_t>{}.Skip(2).Skip(3));
+  EXPECT_FALSE(sinks.FieldMask().IsSkipped(1));
+  EXPECT_TRUE(sinks.FieldMask().IsSkipped(2));
+  EXPECT_FALSE(sinks.FieldMask().IsSkipped(3));
+
+  sinks.Add(2, sink());
+  EXPECT_TRUE(sinks.FieldMask().KeepsAll());
+
+  sinks.Remove(2);
+  sinks.Remove(0);
+  EXPECT_TRUE(sinks.FieldMask().IsSkipped(3));
+  sinks.Remove(1);
+  EXPECT_TRUE(sinks.FieldMask().KeepsAll());
+}
+
+TEST(EventSinks, MessagePoolIsThePoolOfTheFirstSinkWithOne) {
+  EventSinks<pb::TestMessage> sinks;
+  const auto sink = []() {
+    return [](pb::TestMessage&& /* event */) { return AnyFuture<void>{ResolvedFuture<void>{}}; };
+  };
+  const std::shared_ptr<PbMessagePool<pb::TestMessage>> first_pool{
+      std::make_shared<PbMessagePool<pb::TestMessage>>()};
+  const std::shared_ptr<PbMessagePool<pb::TestMessage>> second_pool{
+      std::make_shared<PbMessagePool<pb::TestMessage>>()};
+
+  sinks.Add(0, sink());
+  EXPECT_EQ(sinks.MessagePool(), nullptr);
+  sinks.Add(1, sink(), {}, first_pool);
+  sinks.Add(2, sink(), {}, second_pool);
+  EXPECT_EQ(sinks.MessagePool(), first_pool);
+
+  sinks.Remove(1);
+  EXPECT_EQ(sinks.MessagePool(), second_pool);
+  sinks.Remove(2);
+  EXPECT_EQ(sinks.MessagePool(), nullptr);
+}
+
+}  // namespace
+}  // namespace horus_internal
+}  // namespace horus
@@ -0,0 +1,98 @@
+#include "horus/sdk/internal/parallel_for.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace horus {
+namespace horus_internal {
+
+WorkerThreads::~WorkerThreads() noexcept {
+  {
+    const std::lock_guard<std::mutex> lock{mutex_};
+    stopping_ = true;
+  }
+  loop_started_.notify_all();
+  for (std::thread& thread : threads_) {
+    thread.join();
+  }
+}
+
+std::size_t WorkerThreads::ThreadCount() const noexcept {
+  const std::lock_guard<std::mutex> lock{mutex_};
+  return threads_.size();
+}
+
+void WorkerThreads::Run(std::size_t count, std::size_t thread_count, Call call,
+                        const void* function) noexcept(false) {
+  assert(thread_count > 1);
+  {
+    const std::lock_guard<std::mutex> lock{mutex_};
+    if (errors_.size() < thread_count) {
+      errors_.resize(thread_count);
+    }
+    threads_.reserve(thread_count - 1);
+    while (threads_.size() < thread_count - 1) {
+      // New threads wait for the next loop.
+      threads_.emplace_back(&WorkerThreads::ThreadMain, this, threads_.size() + 1, loop_ + 1);
+    }
+    count_ = count;
+    thread_count_ = thread_count;
+    call_ = call;
+    function_ = function;
+    // All threads take part in the loop (threads beyond `thread_count_` have nothing to do), so
+    // that each of them sees every loop.
+    running_ = threads_.size();
+    ++loop_;
+  }
+  loop_started_.notify_all();
+
+  RunWorker(0);
+
+  std::unique_lock<std::mutex> lock{mutex_};
+  worker_done_.wait(lock, [this]() { return running_ == 0; });
+  std::exception_ptr error{nullptr};
+  for (std::size_t worker{0}; worker < thread_count; ++worker) {
+    if (error == nullptr) {
+      error = errors_[worker];
+    }
+    errors_[worker] = nullptr;
+  }
+  if (error != nullptr) {
+    std::rethrow_exception(error);
+  }
+}
+
+void WorkerThreads::RunWorker(std::size_t worker) noexcept {
+  try {
+    for (std::size_t i{worker}; i < count_; i += thread_count_) {
+      call_(function_, worker, i);
+    }
+  } catch (...) {
+    errors_[worker] = std::current_exception();
+  }
+}
+
+void WorkerThreads::ThreadMain(std::size_t worker, std::uint64_t loop) noexcept {
+  std::unique_lock<std::mutex> lock{mutex_};
+  for (;; ++loop) {
+    loop_started_.wait(lock, [this, loop]() { return stopping_ || loop_ >= loop; });
+    if (stopping_) {
+      return;
+    }
+    if (worker < thread_count_) {
+      lock.unlock();
+      RunWorker(worker);
+      lock.lock();
+    }
+    if (--running_ == 0) {
+      worker_done_.notify_one();
+    }
+  }
+}
+
+}  // namespace horus_internal
+}  // namespace horus
@@ -0,0 +1,176 @@
+/// @file
+///
+/// The `ParallelFor()` function and the `WorkerThreads` class.
+
+#ifndef HORUS_SDK_INTERNAL_PARALLEL_FOR_H_
+#define HORUS_SDK_INTERNAL_PARALLEL_FOR_H_
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace horus {
+namespace horus_internal {
+
+/// Calls `function(worker, i)` for each `i` in `[0, count)`, distributing the calls over (at most)
+/// `thread_count` threads including the calling thread. `worker` is the index of the thread in
+/// `[0, thread_count)`, e.g. to select per-thread buffers; thread `worker` handles the indices `i`
+/// such that `i % thread_count == worker`, in increasing order.
+///
+/// Returns the number of threads used, which is `thread_count` clamped to `[1, count]` (and 1 if
+/// `count` is zero).
+///
+/// Threads are started for each call; `WorkerThreads::ParallelFor()` reuses them instead.
+///
+/// @throws std::system_error If a thread cannot be started.
+/// @throws ... The first exception (in order of workers) thrown by `function`, once all threads
+/// stopped. A worker stops at its first exception.
+template <class Function>
+std::size_t ParallelFor(std::size_t count, std::size_t thread_count,
+                        const Function& function) noexcept(false) {
+  thread_count = std::max<std::size_t>(1, std::min(thread_count, count));
+  if (thread_count == 1) {
+    for (std::size_t i{0}; i < count; ++i) {
+      function(0, i);
+    }
+    return 1;
+  }
+
+  std::vector<std::exception_ptr> errors(thread_count);
+  const auto run = [count, thread_count, &function, &errors](std::size_t worker) {
+    try {
+      for (std::size_t i{worker}; i < count; i += thread_count) {
+        function(worker, i);
+      }
+    } catch (...) {
+      errors[worker] = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(thread_count - 1);
+  try {
+    for (std::size_t worker{1}; worker < thread_count; ++worker) {
+      threads.emplace_back(run, worker);
+    }
+  } catch (...) {
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+    throw;
+  }
+  run(0);
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  for (const std::exception_ptr& error : errors) {
+    if (error != nullptr) {
+      std::rethrow_exception(error);
+    }
+  }
+  return thread_count;
+}
+
+/// Threads which run `ParallelFor()` loops, started on first use and reused from loop to loop, so
+/// that a loop run over and over (e.g. for each frame of a lidar) neither starts threads nor
+/// allocates once the threads were started.
+///
+/// Loops must be run from one thread at a time.
+class WorkerThreads final {
+ public:
+  /// Constructs an object without threads.
+  WorkerThreads() noexcept = default;
+
+  /// Cannot copy.
+  WorkerThreads(const WorkerThreads&) = delete;
+  /// Cannot copy.
+  WorkerThreads& operator=(const WorkerThreads&) = delete;
+  /// Cannot move, since threads refer to the object.
+  WorkerThreads(WorkerThreads&&) = delete;
+  /// Cannot move, since threads refer to the object.
+  WorkerThreads& operator=(WorkerThreads&&) = delete;
+
+  /// Stops and joins the threads.
+  ~WorkerThreads() noexcept;
+
+  /// Same as `horus_internal::ParallelFor()`, but runs `function` on the threads of this object
+  /// (starting the missing ones) rather than on new threads.
+  ///
+  /// @throws std::bad_alloc If the threads cannot be allocated.
+  /// @throws std::system_error If a thread cannot be started.
+  /// @throws ... The first exception (in order of workers) thrown by `function`.
+  template <class Function>
+  std::size_t ParallelFor(std::size_t count, std::size_t thread_count,
+                          const Function& function) noexcept(false) {
+    thread_count = std::max<std::size_t>(1, std::min(thread_count, count));
+    if (thread_count == 1) {
+      for (std::size_t i{0}; i < count; ++i) {
+        function(0, i);
+      }
+      return 1;
+    }
+    Run(count, thread_count,
+        [](const void* erased_function, std::size_t worker, std::size_t i) {
+          (*static_cast<const Function*>(erased_function))(worker, i);
+        },
+        &function);
+    return thread_count;
+  }
+
+  /// Returns the number of threads started, not including the threads calling `ParallelFor()`.
+  std::size_t ThreadCount() const noexcept;
+
+ private:
+  /// A type-erased `function` given to `ParallelFor()`.
+  using Call = void (*)(const void* function, std::size_t worker, std::size_t i);
+
+  /// Runs `call(function, worker, i)` for each `i` in `[0, count)` over `thread_count` (> 1)
+  /// threads including the calling thread.
+  ///
+  /// @throws std::bad_alloc If the threads cannot be allocated.
+  /// @throws std::system_error If a thread cannot be started.
+  /// @throws ... The first exception (in order of workers) thrown by `call`.
+  void Run(std::size_t count, std::size_t thread_count, Call call,
+           const void* function) noexcept(false);
+
+  /// Runs the part of the current loop of the given worker, storing its exception if any.
+  void RunWorker(std::size_t worker) noexcept;
+
+  /// The function of the thread of the given worker (> 0), which starts with the loop `loop`.
+  void ThreadMain(std::size_t worker, std::uint64_t loop) noexcept;
+
+  /// Guards the fields below.
+  mutable std::mutex mutex_;
+  /// Notified when a loop starts or the threads must stop.
+  std::condition_variable loop_started_;
+  /// Notified when a thread completed its part of the loop.
+  std::condition_variable worker_done_;
+  /// The threads of workers 1 and up.
+  std::vector<std::thread> threads_;
+  /// The exception thrown by each worker (including worker 0) in the current loop, if any.
+  std::vector<std::exception_ptr> errors_;
+  /// The number of loops started, used by threads to notice a new loop.
+  std::uint64_t loop_{0};
+  /// The number of threads which did not complete their part of the current loop.
+  std::size_t running_{0};
+  /// Whether the threads must stop.
+  bool stopping_{false};
+  /// The number of indices of the current loop.
+  std::size_t count_{0};
+  /// The number of threads (including the calling thread) of the current loop.
+  std::size_t thread_count_{0};
+  /// The function of the current loop.
+  Call call_{nullptr};
+  /// The argument of `call_`.
+  const void* function_{nullptr};
+};
+
+}  // namespace horus_internal
+}  // namespace horus
+
+#endif  // HORUS_SDK_INTERNAL_PARALLEL_FOR_H_
@@ -0,0 +1,101 @@
+#include "horus/sdk/internal/parallel_for.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "horus/testing/allocations.h"
+
+namespace horus {
+namespace horus_internal {
+namespace {
+
+TEST(ParallelFor, CallsEachIndexOnce) {
+  for (const std::size_t thread_count : {0, 1, 2, 3, 16}) {
+    SCOPED_TRACE(testing::Message() << thread_count << " threads");
+    std::vector<std::size_t> workers(10, thread_count + 100);
+    const std::size_t used{ParallelFor(workers.size(), thread_count,
+                                       [&workers](std::size_t worker, std::size_t i) {
+                                         workers[i] = worker;
+                                       })};
+    EXPECT_EQ(used, thread_count == 0 ? 1 : thread_count > 10 ? 10 : thread_count);
+    for (std::size_t i{0}; i < workers.size(); ++i) {
+      EXPECT_EQ(workers[i], i % used) << i;
+    }
+  }
+  EXPECT_EQ(ParallelFor(0, 4, [](std::size_t /*worker*/, std::size_t /*i*/) { FAIL(); }), 1);
+}
+
+TEST(ParallelFor, RethrowsErrors) {
+  std::vector<std::int32_t> done(6);
+  EXPECT_THROW(ParallelFor(done.size(), 2,
+                           [&done](std::size_t /*worker*/, std::size_t i) {
+                             if (i == 3) {
+                               throw std::runtime_error{"failed"};
+                             }
+                             done[i] = 1;
+                           }),
+               std::runtime_error);
+  // Worker 0 completes, worker 1 stops at its first error.
+  EXPECT_EQ(done, (std::vector<std::int32_t>{1, 1, 1, 0, 1, 0}));
+}
+
+TEST(WorkerThreads, ReusesThreads) {
+  WorkerThreads threads;
+  EXPECT_EQ(threads.ThreadCount(), 0);
+  std::vector<std::size_t> workers(10);
+  for (const std::size_t thread_count : {1, 3, 2, 16, 4}) {
+    SCOPED_TRACE(testing::Message() << thread_count << " threads");
+    std::fill(workers.begin(), workers.end(), thread_count + 100);
+    const std::size_t used{threads.ParallelFor(workers.size(), thread_count,
+                                               [&workers](std::size_t worker, std::size_t i) {
+                                                 workers[i] = worker;
+                                               })};
+    EXPECT_EQ(used, thread_count > 10 ? 10 : thread_count);
+    for (std::size_t i{0}; i < workers.size(); ++i) {
+      EXPECT_EQ(workers[i], i % used) << i;
+    }
+  }
+  // Threads are only started when more are needed.
+  EXPECT_EQ(threads.ThreadCount(), 9);
+}
+
+TEST(WorkerThreads, DoesNotAllocateOnceStarted) {
+  WorkerThreads threads;
+  std::vector<std::uint64_t> sums(4);
+  const auto sum = [&sums](std::size_t worker, std::size_t i) { sums[worker] += i; };
+  static_cast<void>(threads.ParallelFor(1000, sums.size(), sum));
+
+  const std::size_t allocation_count{ProcessAllocationCount()};
+  for (std::int32_t loop{0}; loop < 100; ++loop) {
+    static_cast<void>(threads.ParallelFor(1000, sums.size(), sum));
+  }
+  EXPECT_EQ(ProcessAllocationCount(), allocation_count);
+  EXPECT_EQ(sums[0] + sums[1] + sums[2] + sums[3], 101 * 999 * 1000 / 2);
+}
+
+TEST(WorkerThreads, RethrowsErrors) {
+  WorkerThreads threads;
+  for (std::int32_t loop{0}; loop < 2; ++loop) {
+    std::vector<std::int32_t> done(6);
+    EXPECT_THROW(threads.ParallelFor(done.size(), 2,
+                                     [&done](std::size_t /*worker*/, std::size_t i) {
+                                       if (i == 3) {
+                                         throw std::runtime_error{"failed"};
+                                       }
+                                       done[i] = 1;
+                                     }),
+                 std::runtime_error);
+    EXPECT_EQ(done, (std::vector<std::int32_t>{1, 1, 1, 0, 1, 0}));
+  }
+  // Errors are not reported again by the next loop.
+  EXPECT_EQ(threads.ParallelFor(4, 2, [](std::size_t /*worker*/, std::size_t /*i*/) {}), 2);
+}
+
+}  // namespace
+}  // namespace horus_internal
+}  // namespace horus
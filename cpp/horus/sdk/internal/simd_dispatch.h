@@ -0,0 +1,61 @@
+/// @file
+///
+/// Helpers shared by the point cloud kernels to select an instruction set.
+
+#ifndef HORUS_SDK_INTERNAL_SIMD_DISPATCH_H_
+#define HORUS_SDK_INTERNAL_SIMD_DISPATCH_H_
+
+#include <cstddef>
+
+#include "horus/sdk/simd.h"
+
+/// Whether the SSE4.1 and AVX2 kernels are compiled, i.e. whether we're compiling for x86-64 with a
+/// compiler supporting `__attribute__((target(...)))`.
+#if defined(__x86_64__) && defined(__GNUC__)
+#define HORUS_SDK_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define HORUS_SDK_SIMD_X86 0
+#endif
+
+namespace horus {
+namespace horus_internal {
+
+/// Returns the result of `sse41()` or `avx2()` depending on `level`, or zero for
+/// `SimdLevel::kScalar`. Use `HORUS_SDK_SIMD_DISPATCH()` rather than calling it directly.
+template <class Sse41, class Avx2>
+std::size_t SimdDispatch(sdk::SimdLevel level, const Sse41& sse41, const Avx2& avx2) noexcept {
+  switch (level) {
+    case sdk::SimdLevel::kScalar:
+      return 0;
+    case sdk::SimdLevel::kSse41:
+      return sse41();
+    case sdk::SimdLevel::kAvx2:
+      return avx2();
+  }
+  return 0;
+}
+
+}  // namespace horus_internal
+}  // namespace horus
+
+/// Evaluates `sse41_call` or `avx2_call` depending on the `SimdLevel` `level`, to the number of
+/// values processed by the SIMD kernel. Evaluates to zero for `SimdLevel::kScalar` and when the
+/// SIMD kernels are not compiled, so that the scalar kernel processes the remaining values.
+///
+/// Example:
+///
+///  const std::size_t done{HORUS_SDK_SIMD_DISPATCH(level, KernelSse41(input, size),
+///                                                 KernelAvx2(input, size))};
+///  KernelScalar(input, done, size);
+#if HORUS_SDK_SIMD_X86
+#define HORUS_SDK_SIMD_DISPATCH(level, sse41_call, avx2_call)          \
+  ::horus::horus_internal::SimdDispatch(                               \
+      (level), [&]() noexcept -> std::size_t { return (sse41_call); }, \
+      [&]() noexcept -> std::size_t { return (avx2_call); })
+#else
+#define HORUS_SDK_SIMD_DISPATCH(level, sse41_call, avx2_call) \
+  (static_cast<void>(level), std::size_t{0})
+#endif
+
+#endif  // HORUS_SDK_INTERNAL_SIMD_DISPATCH_H_
@@ -0,0 +1,110 @@
+/// @file
+///
+/// The `SingleFlight` class.
+
+#ifndef HORUS_SDK_INTERNAL_SINGLE_FLIGHT_H_
+#define HORUS_SDK_INTERNAL_SINGLE_FLIGHT_H_
+
+#include <exception>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "horus/future/any.h"
+#include "horus/future/from_continuation.h"
+#include "horus/future/map.h"
+#include "horus/future/try.h"
+
+namespace horus {
+namespace horus_internal {
+
+/// Coalesces concurrent executions of an operation which produces a `T`: while an execution is in
+/// flight, other callers wait for its result instead of starting another execution.
+///
+/// Not thread-safe: the SDK only uses it from its event loop. `T` must be copyable.
+template <class T>
+class SingleFlight final {
+ public:
+  /// Constructs a `SingleFlight` with no execution in flight.
+  SingleFlight() noexcept = default;
+
+  /// Cannot copy.
+  SingleFlight(const SingleFlight&) = delete;
+  /// Cannot copy.
+  SingleFlight& operator=(const SingleFlight&) = delete;
+  /// Move constructor.
+  SingleFlight(SingleFlight&&) noexcept = default;
+  /// Move assignment operator.
+  SingleFlight& operator=(SingleFlight&&) noexcept = default;
+
+  /// Destroys the `SingleFlight`. Executions in flight are not cancelled.
+  ~SingleFlight() noexcept = default;
+
+  /// Returns a future which resolves with the result of the execution in flight. If there is none,
+  /// the future returned by `start()` becomes the execution in flight.
+  ///
+  /// If the execution in flight is cancelled, the futures waiting for it throw
+  /// `BrokenContinuationError`.
+  ///
+  /// @throws std::bad_alloc If the future cannot be allocated.
+  template <class Start>
+  AnyFuture<T> Run(Start&& start) noexcept(false);
+
+  /// Returns whether an execution is in flight.
+  bool IsInFlight() const noexcept {
+    const std::shared_ptr<Flight> flight{current_.lock()};
+    return flight != nullptr && !flight->done;
+  }
+
+ private:
+  /// An execution in flight, owned by the future of the execution.
+  struct Flight {
+    /// The continuations of the futures waiting for the result of the execution, which receive a
+    /// shared result since completing a continuation must not throw.
+    std::vector<Continuation<std::shared_ptr<const T>>> waiters;
+    /// Whether the execution completed.
+    bool done{false};
+  };
+
+  /// The execution in flight, if any.
+  std::weak_ptr<Flight> current_;
+};
+
+template <class T>
+template <class Start>
+AnyFuture<T> SingleFlight<T>::Run(Start&& start) noexcept(false) {
+  const std::shared_ptr<Flight> current{current_.lock()};
+  if (current != nullptr && !current->done) {
+    auto future_and_continuation = FromContinuation<std::shared_ptr<const T>>();
+    current->waiters.emplace_back(std::move(future_and_continuation.second));
+    return std::move(future_and_continuation.first) |
+           Map([](std::shared_ptr<const T>&& value) -> T { return T{*value}; });
+  }
+
+  std::shared_ptr<Flight> flight{std::make_shared<Flight>()};
+  current_ = flight;
+  return std::forward<Start>(start)() | Map([flight](T&& value) -> T {
+           flight->done = true;
+           if (!flight->waiters.empty()) {
+             const std::shared_ptr<const T> shared_value{std::make_shared<const T>(value)};
+             for (Continuation<std::shared_ptr<const T>>& waiter : flight->waiters) {
+               static_cast<void>(waiter.ContinueWith(shared_value));
+             }
+           }
+           flight->waiters.clear();
+           return std::move(value);
+         }) |
+         Catch([flight](const std::exception_ptr& exception) -> T {
+           flight->done = true;
+           for (Continuation<std::shared_ptr<const T>>& waiter : flight->waiters) {
+             static_cast<void>(waiter.FailWith(exception));
+           }
+           flight->waiters.clear();
+           std::rethrow_exception(exception);
+         });
+}
+
+}  // namespace horus_internal
+}  // namespace horus
+
+#endif  // HORUS_SDK_INTERNAL_SINGLE_FLIGHT_H_
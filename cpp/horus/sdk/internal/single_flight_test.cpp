@@ -0,0 +1,67 @@
+#include "horus/sdk/internal/single_flight.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "horus/future/any.h"
+#include "horus/future/from_continuation.h"
+#include "horus/future/join.h"
+#include "horus/future/resolved.h"
+#include "horus/testing/event_loop.h"
+
+namespace horus {
+namespace horus_internal {
+namespace {
+
+TEST(SingleFlight, CoalescesConcurrentRuns) {
+  SingleFlight<std::int32_t> single_flight;
+  std::int32_t start_count{0};
+  auto future_and_continuation = FromContinuation<std::int32_t>();
+  const auto start = [&start_count, &future_and_continuation]() -> AnyFuture<std::int32_t> {
+    ++start_count;
+    return std::move(future_and_continuation.first);
+  };
+
+  AnyFuture<std::int32_t> first{single_flight.Run(start)};
+  AnyFuture<std::int32_t> second{single_flight.Run(start)};
+  EXPECT_EQ(start_count, 1);
+  EXPECT_TRUE(single_flight.IsInFlight());
+
+  ASSERT_TRUE(future_and_continuation.second.ContinueWith(42));
+  EXPECT_EQ(TestOnlyExecute(Join(std::move(first), std::move(second))), std::make_tuple(42, 42));
+  EXPECT_FALSE(single_flight.IsInFlight());
+
+  // The execution completed, so the next run starts a new one.
+  const auto start_again = [&start_count]() -> AnyFuture<std::int32_t> {
+    ++start_count;
+    return ResolveWith(std::int32_t{1});
+  };
+  EXPECT_EQ(TestOnlyExecute(single_flight.Run(start_again)), 1);
+  EXPECT_EQ(start_count, 2);
+}
+
+TEST(SingleFlight, PropagatesErrors) {
+  SingleFlight<std::int32_t> single_flight;
+  auto future_and_continuation = FromContinuation<std::int32_t>();
+
+  AnyFuture<std::int32_t> first{single_flight.Run(
+      [&future_and_continuation]() -> AnyFuture<std::int32_t> {
+        return std::move(future_and_continuation.first);
+      })};
+  AnyFuture<std::int32_t> second{single_flight.Run([]() -> AnyFuture<std::int32_t> {
+    ADD_FAILURE() << "only one execution should start";
+    return ResolveWith(std::int32_t{0});
+  })};
+
+  ASSERT_TRUE(future_and_continuation.second.FailWith(std::runtime_error{"failed"}));
+  EXPECT_THROW(TestOnlyExecute(std::move(first)), std::runtime_error);
+  EXPECT_THROW(TestOnlyExecute(std::move(second)), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace horus_internal
+}  // namespace horus
@@ -0,0 +1,118 @@
+/// @file
+///
+/// The `TaskBatchFuture` class.
+
+#ifndef HORUS_SDK_INTERNAL_TASK_BATCH_H_
+#define HORUS_SDK_INTERNAL_TASK_BATCH_H_
+
+#include <cstddef>
+#include <exception>
+#include <utility>
+
+#include "horus/future/future.h"
+#include "horus/future/info.h"
+#include "horus/future/owner.h"
+#include "horus/future/poll.h"
+#include "horus/strings/logging.h"
+#include "horus/types/in_place.h"
+#include "horus/types/one_of.h"
+#include "horus/types/span.h"
+
+namespace horus {
+namespace horus_internal {
+
+/// Future which runs a batch of tasks one after the other. Each task is a function returning a
+/// future, and is only called once the future of the previous task completed.
+///
+/// Errors of tasks are logged rather than propagated. A null task stops the batch: the future then
+/// completes with `true` without running the following tasks. Otherwise, it completes with `false`
+/// once all tasks completed.
+///
+/// The future of each task is fully destroyed (including its event loop handles) before the next
+/// task starts.
+template <class Task>
+class TaskBatchFuture final : public Future<bool> {
+ public:
+  /// The future returned by a `Task`.
+  using TaskFuture = decltype(std::declval<Task&>()());
+
+  /// The owner of the future of the running task.
+  using TaskFutureOwner = FutureOwner<TaskFuture>;
+
+  /// Constructs the future. `tasks` must outlive it.
+  explicit TaskBatchFuture(Span<Task> tasks, const FutureInfo& info = CurrentFutureInfo()) noexcept
+      : tasks_{tasks}, info_{info} {}
+
+  /// Not copyable.
+  TaskBatchFuture(const TaskBatchFuture&) = delete;
+  /// Not copyable.
+  TaskBatchFuture& operator=(const TaskBatchFuture&) = delete;
+  /// Move constructor; this may not be called after polling the future for the first time.
+  TaskBatchFuture(TaskBatchFuture&&) noexcept = default;
+  /// Not move-assignable.
+  TaskBatchFuture& operator=(TaskBatchFuture&&) = delete;
+
+  /// Destroys the future, cancelling the running task (if any).
+  ~TaskBatchFuture() noexcept final = default;
+
+  /// Polls the running task until it completes, then starts the next one.
+  PollResult<bool> UnsafePoll(PollContext& context) final;
+
+ private:
+  /// The tasks to run.
+  Span<Task> tasks_;
+  /// The index in `tasks_` of the next task to run.
+  std::size_t next_task_{0};
+  /// The future of the running task, if any. It is kept until its destruction completes.
+  OneOf<TaskFutureOwner, void> running_{InPlaceType<void>};
+  /// Future information.
+  FutureInfo info_;
+};
+
+template <class Task>
+PollResult<bool> TaskBatchFuture<Task>::UnsafePoll(PollContext& context) {
+  const PollContext::Trace trace{context, "TaskBatch", info_};
+
+  for (;;) {
+    TaskFutureOwner* running{running_.template TryAs<TaskFutureOwner>()};
+    if (running != nullptr && running->DidStartDestruction()) {
+      if (!running->PollDestroy(context.Waker())) {
+        // The future of the previous task is still being destroyed; resume when woken up.
+        return PendingResult<bool>();
+      }
+      running_.template Emplace<void>();
+      running = nullptr;
+    }
+    if (running == nullptr) {
+      if (next_task_ == tasks_.size()) {
+        return ReadyResult<bool>(false);
+      }
+      Task& task{tasks_[next_task_]};
+      ++next_task_;
+      if (task == nullptr) {
+        // Empty task received? Shutting down.
+        return ReadyResult<bool>(true);
+      }
+      try {
+        running = &running_.template Emplace<TaskFutureOwner>(task());
+      } catch (const std::exception& exn) {
+        Log("error handling SDK task: ", exn.what());
+        continue;
+      }
+    }
+    try {
+      if (running->PollFuture(context).template Is<Pending>()) {
+        return PendingResult<bool>();
+      }
+    } catch (const std::exception& exn) {
+      Log("error handling SDK task: ", exn.what());
+    }
+    // The task completed (or failed); start destroying its future.
+    static_cast<void>(running->PollDestroy(context.Waker()));
+  }
+}
+
+}  // namespace horus_internal
+}  // namespace horus
+
+#endif  // HORUS_SDK_INTERNAL_TASK_BATCH_H_
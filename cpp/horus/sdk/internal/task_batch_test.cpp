@@ -0,0 +1,100 @@
+#include "horus/sdk/internal/task_batch.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "horus/functional/move_only_function.h"
+#include "horus/future/any.h"
+#include "horus/future/cancel.h"
+#include "horus/future/map.h"
+#include "horus/future/rejected.h"
+#include "horus/future/resolved.h"
+#include "horus/future/time.h"
+#include "horus/testing/event_loop.h"
+
+namespace horus {
+namespace horus_internal {
+namespace {
+
+using Task = MoveOnlyFunction<AnyFuture<void>()>;
+
+TEST(TaskBatch, RunsTasksOneAfterTheOther) {
+  std::vector<std::int32_t> events;
+  std::vector<Task> tasks;
+  tasks.emplace_back([&events]() -> AnyFuture<void> {
+    events.push_back(1);
+    return Map(CompleteIn(std::chrono::milliseconds{2}), [&events]() { events.push_back(10); });
+  });
+  tasks.emplace_back([&events]() -> AnyFuture<void> {
+    events.push_back(2);
+    return ResolvedFuture<void>{};
+  });
+
+  // The second task only starts once the future of the first one completes.
+  EXPECT_FALSE(TestOnlyExecute(TaskBatchFuture<Task>{tasks}));
+  EXPECT_EQ(events, (std::vector<std::int32_t>{1, 10, 2}));
+}
+
+TEST(TaskBatch, ContinuesAfterErrors) {
+  std::vector<std::int32_t> started;
+  std::vector<Task> tasks;
+  tasks.emplace_back([&started]() -> AnyFuture<void> {
+    started.push_back(1);
+    throw std::runtime_error{"cannot start"};
+  });
+  tasks.emplace_back([&started]() -> AnyFuture<void> {
+    started.push_back(2);
+    return RejectedFuture<void>{std::runtime_error{"failed"}};
+  });
+  tasks.emplace_back([&started]() -> AnyFuture<void> {
+    started.push_back(3);
+    return ResolvedFuture<void>{};
+  });
+
+  EXPECT_FALSE(TestOnlyExecute(TaskBatchFuture<Task>{tasks}));
+  EXPECT_EQ(started, (std::vector<std::int32_t>{1, 2, 3}));
+}
+
+TEST(TaskBatch, DestroysFailedTasksWithPendingTimers) {
+  std::vector<std::int32_t> started;
+  std::vector<Task> tasks;
+  tasks.emplace_back([&started]() -> AnyFuture<void> {
+    started.push_back(1);
+    // The task fails while the timer of its timeout is still running.
+    return CancelIn(std::chrono::hours{1}, Map(CompleteIn(std::chrono::milliseconds{2}), []() {
+                      throw std::runtime_error{"failed"};
+                    }));
+  });
+  tasks.emplace_back([&started]() -> AnyFuture<void> {
+    started.push_back(2);
+    return ResolvedFuture<void>{};
+  });
+
+  EXPECT_FALSE(TestOnlyExecute(TaskBatchFuture<Task>{tasks}));
+  EXPECT_EQ(started, (std::vector<std::int32_t>{1, 2}));
+}
+
+TEST(TaskBatch, StopsAtNullTask) {
+  std::vector<std::int32_t> started;
+  std::vector<Task> tasks;
+  tasks.emplace_back([&started]() -> AnyFuture<void> {
+    started.push_back(1);
+    return ResolvedFuture<void>{};
+  });
+  tasks.emplace_back(nullptr);
+  tasks.emplace_back([&started]() -> AnyFuture<void> {
+    started.push_back(3);
+    return ResolvedFuture<void>{};
+  });
+
+  EXPECT_TRUE(TestOnlyExecute(TaskBatchFuture<Task>{tasks}));
+  EXPECT_EQ(started, (std::vector<std::int32_t>{1}));
+}
+
+}  // namespace
+}  // namespace horus_internal
+}  // namespace horus
@@ -8,10 +8,12 @@
 #include <chrono>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <string>
 
 #include "horus/pb/logs/message_pb.h"
 #include "horus/pb/logs/metadata_pb.h"
+#include "horus/sdk/event_ring.h"
 
 namespace horus {
 namespace sdk {
@@ -48,6 +50,10 @@ struct Log {
 struct LogSubscriptionRequest {
   /// Function to call when a log message is received.
   std::function<void(pb::LogMessage&&)> on_log_message;
+
+  /// If non-null, received log messages are pushed to this ring to be polled by the user instead of
+  /// being passed to `on_log_message`.
+  std::shared_ptr<EventRing<pb::LogMessage>> event_ring{nullptr};
 };
 
 }  // namespace sdk
@@ -0,0 +1,128 @@
+#include "horus/sdk/merged_point_cloud.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "horus/attributes.h"
+#include "horus/pb/cow.h"
+#include "horus/pb/point/point_message_pb.h"
+#include "horus/pointer/arithmetic.h"
+#include "horus/sdk/internal/parallel_for.h"
+#include "horus/sdk/point_cloud_view.h"
+#include "horus/sdk/point_transform.h"
+#include "horus/sdk/simd.h"
+#include "horus/strings/string_view.h"
+#include "horus/types/span.h"
+
+namespace horus {
+namespace sdk {
+namespace {
+
+/// Copies `values` to `out`, or fills `out` with `size` zeros if `values` is empty.
+void CopyOrZero(Span<const std::uint16_t> values, std::uint16_t* out, std::size_t size) noexcept {
+  if (values.empty()) {
+    std::fill_n(out, size, std::uint16_t{0});
+  } else {
+    std::copy(values.begin(), values.end(), out);
+  }
+}
+
+}  // namespace
+
+void MergedPointCloud::Assign(Span<const pb::PointFrame* const> frames, std::size_t thread_count,
+                              SimdLevel level) {
+  // Lay out the frames one after the other before transforming any of them.
+  if (segments_.size() < frames.size()) {
+    segments_.resize(frames.size());
+  }
+  segment_count_ = frames.size();
+  size_ = 0;
+  for (std::size_t i{0}; i < frames.size(); ++i) {
+    const pb::PointFrame& frame{*frames[i]};
+    MergedPointCloudSegment& segment{segments_[i]};
+    const StringView lidar_id{frame.header().lidar_id().Str()};
+    segment.lidar_id.assign(lidar_id.data(), lidar_id.size());
+    segment.offset = size_;
+    segment.size = frame.points().flattened_points().Span().size() / 3;
+    size_ += segment.size;
+  }
+  padded_size_ = PaddedPointCount(size_);
+
+  float* const x{coordinates_.Resize(3 * padded_size_, kPointCloudAlignment)};
+  float* const y{PointerAdd(x, padded_size_)};
+  float* const z{PointerAdd(y, padded_size_)};
+  for (float* const axis : {x, y, z}) {
+    std::fill(PointerAdd(axis, size_), PointerAdd(axis, padded_size_), 0.F);
+  }
+  std::uint16_t* const attributes{attributes_.Resize(size_, kPointCloudAlignment)};
+  std::uint16_t* const intensities{intensities_.Resize(size_, kPointCloudAlignment)};
+
+  const std::size_t worker_count{std::max<std::size_t>(1, std::min(thread_count, frames.size()))};
+  if (views_.size() < worker_count) {
+    views_.resize(worker_count);
+  }
+  try {
+    if (worker_count > 1 && workers_ == nullptr) {
+      workers_ = std::make_unique<horus_internal::WorkerThreads>();
+    }
+    const auto merge = [&](std::size_t worker, std::size_t i) {
+      const pb::PointFrame& frame{*frames[i]};
+      const MergedPointCloudSegment& segment{segments_[i]};
+      PointCloudView& view{views_[worker]};
+      view.Assign(frame, level);
+      TransformPoints(PointTransform::FromFrame(frame), view,
+                      {PointerAdd(x, segment.offset), segment.size},
+                      {PointerAdd(y, segment.offset), segment.size},
+                      {PointerAdd(z, segment.offset), segment.size}, level);
+      CopyOrZero(view.attributes(), PointerAdd(attributes, segment.offset), segment.size);
+      CopyOrZero(view.intensities(), PointerAdd(intensities, segment.offset), segment.size);
+      view.Clear();
+    };
+    if (worker_count == 1) {
+      for (std::size_t i{0}; i < frames.size(); ++i) {
+        merge(0, i);
+      }
+    } else {
+      static_cast<void>(workers_->ParallelFor(frames.size(), worker_count, merge));
+    }
+  } catch (...) {
+    Clear();
+    throw;
+  }
+}
+
+void MergedPointCloud::Assign(const pb::AggregatedPointEvents& events, std::size_t thread_count,
+                              SimdLevel level) {
+  // Received events are decoded on iteration, so they are kept alive while frames are merged.
+  decoded_events_.clear();
+  for (Cow<pb::ProcessedPointsEvent> event : events.events()) {
+    decoded_events_.push_back(std::move(event));
+  }
+  frames_.clear();
+  for (const Cow<pb::ProcessedPointsEvent>& event : decoded_events_) {
+    frames_.push_back(&event.Ref().point_frame());
+  }
+  try {
+    Assign(frames_, thread_count, level);
+  } catch (...) {
+    frames_.clear();
+    decoded_events_.clear();
+    throw;
+  }
+  frames_.clear();
+  decoded_events_.clear();
+}
+
+void MergedPointCloud::Clear() noexcept {
+  size_ = 0;
+  padded_size_ = 0;
+  segment_count_ = 0;
+}
+
+}  // namespace sdk
+}  // namespace horus
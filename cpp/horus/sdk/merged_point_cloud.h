@@ -0,0 +1,158 @@
+/// @file
+///
+/// The `MergedPointCloud` class.
+
+#ifndef HORUS_SDK_MERGED_POINT_CLOUD_H_
+#define HORUS_SDK_MERGED_POINT_CLOUD_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "horus/attributes.h"
+#include "horus/pb/cow.h"
+#include "horus/pb/point/point_message_pb.h"
+#include "horus/pointer/arithmetic.h"
+#include "horus/sdk/internal/aligned_buffer.h"
+#include "horus/sdk/internal/parallel_for.h"
+#include "horus/sdk/point_cloud_view.h"
+#include "horus/sdk/simd.h"
+#include "horus/types/span.h"
+
+namespace horus {
+namespace sdk {
+
+/// The range of points of a `MergedPointCloud` which come from the frame of a lidar.
+struct MergedPointCloudSegment final {
+  /// The `lidar_id` of the frame.
+  std::string lidar_id;
+  /// The index in the merged cloud of the first point of the frame.
+  std::size_t offset{0};
+  /// The number of points of the frame.
+  std::size_t size{0};
+};
+
+/// The points of several `pb::PointFrame`s (e.g. the frames of all lidars in an
+/// `AggregatedPointEvents` batch), transformed to world coordinates by their
+/// `calibration_transform` and stored one frame after the other in a single structure-of-arrays
+/// cloud.
+///
+/// The number of points of each frame is known from the size of its coordinates, so the buffers of
+/// the cloud are sized once for the whole batch and each frame is transformed with SIMD
+/// instructions directly into its own segment of the buffers; frames can therefore be processed by
+/// several threads without synchronization. The coordinates have the same alignment and padding as
+/// in `PointCloudView`.
+///
+/// A `MergedPointCloud` owns its values, and reuses its buffers and threads when assigned new
+/// frames: once it has seen the largest batch, assigning frames from a span does not allocate.
+class MergedPointCloud final {
+ public:
+  /// Constructs an empty cloud.
+  MergedPointCloud() noexcept = default;
+
+  /// Clouds cannot be copied.
+  MergedPointCloud(const MergedPointCloud&) = delete;
+  /// Clouds cannot be copied.
+  MergedPointCloud& operator=(const MergedPointCloud&) = delete;
+  /// Move constructor.
+  MergedPointCloud(MergedPointCloud&&) noexcept = default;
+  /// Move assignment operator.
+  MergedPointCloud& operator=(MergedPointCloud&&) noexcept = default;
+
+  /// Destroys the cloud.
+  ~MergedPointCloud() noexcept = default;
+
+  /// Replaces the contents of the cloud by the transformed points of `frames`, in order, using
+  /// `thread_count` threads (including the calling thread) and the given instruction set (which
+  /// must be supported by the CPU).
+  ///
+  /// Points of frames without attributes (resp. intensities) have the attributes `kAttributeNone`
+  /// (resp. an intensity of zero).
+  ///
+  /// @throws std::invalid_argument If the `calibration_transform` of a frame is invalid.
+  /// @throws std::bad_alloc If the buffers of the cloud cannot be allocated.
+  /// @throws std::system_error If a thread cannot be started.
+  void Assign(Span<const pb::PointFrame* const> frames, std::size_t thread_count = 1,
+              SimdLevel level = BestSimdLevel()) noexcept(false);
+
+  /// Replaces the contents of the cloud by the transformed points of the frames of `events`.
+  ///
+  /// @see Assign()
+  void Assign(const pb::AggregatedPointEvents& events, std::size_t thread_count = 1,
+              SimdLevel level = BestSimdLevel()) noexcept(false);
+
+  /// Empties the cloud, keeping its buffers.
+  void Clear() noexcept;
+
+  /// Returns the number of points.
+  std::size_t size() const noexcept { return size_; }
+  /// Returns whether `size() == 0`.
+  bool empty() const noexcept { return size_ == 0; }
+
+  /// Returns `size()` rounded up to a multiple of `kPointCloudAlignment / sizeof(float)`.
+  ///
+  /// `x()`, `y()` and `z()` may be read up to `PaddedSize()` values; the padding values are zero.
+  std::size_t PaddedSize() const noexcept { return padded_size_; }
+
+  /// Returns the x world coordinates of the points, aligned to `kPointCloudAlignment`.
+  Span<const float> x() const noexcept HORUS_LIFETIME_BOUND { return Coordinates(0); }
+  /// Returns the y world coordinates of the points, aligned to `kPointCloudAlignment`.
+  Span<const float> y() const noexcept HORUS_LIFETIME_BOUND { return Coordinates(1); }
+  /// Returns the z world coordinates of the points, aligned to `kPointCloudAlignment`.
+  Span<const float> z() const noexcept HORUS_LIFETIME_BOUND { return Coordinates(2); }
+
+  /// Returns the `pb::PointAttribute` flags of the points.
+  Span<const std::uint16_t> attributes() const noexcept HORUS_LIFETIME_BOUND {
+    return {attributes_.data(), size_};
+  }
+
+  /// Returns the intensities of the points.
+  Span<const std::uint16_t> intensities() const noexcept HORUS_LIFETIME_BOUND {
+    return {intensities_.data(), size_};
+  }
+
+  /// Returns the segment of each merged frame, in the order of the frames.
+  Span<const MergedPointCloudSegment> segments() const noexcept HORUS_LIFETIME_BOUND {
+    return {segments_.data(), segment_count_};
+  }
+
+ private:
+  /// Returns the coordinates of the points on the given axis (0 for x, 1 for y and 2 for z).
+  Span<const float> Coordinates(std::size_t axis) const noexcept {
+    if (size_ == 0) {
+      return {};
+    }
+    return {PointerAdd(coordinates_.data(), axis * padded_size_), size_};
+  }
+
+  /// Number of points.
+  std::size_t size_{0};
+  /// @see PaddedSize()
+  std::size_t padded_size_{0};
+  /// The x, y and z coordinates of the points, each padded to `padded_size_` values.
+  horus_internal::AlignedBuffer<float> coordinates_;
+  /// @see attributes()
+  horus_internal::AlignedBuffer<std::uint16_t> attributes_;
+  /// @see intensities()
+  horus_internal::AlignedBuffer<std::uint16_t> intensities_;
+  /// The segments of the frames; only the first `segment_count_` are used, so that the strings of
+  /// the others keep their capacity.
+  std::vector<MergedPointCloudSegment> segments_;
+  /// Number of merged frames.
+  std::size_t segment_count_{0};
+  /// The view of the frame being merged by each thread.
+  std::vector<PointCloudView> views_;
+  /// The threads merging frames along with the calling thread, started on first use.
+  std::unique_ptr<horus_internal::WorkerThreads> workers_;
+  /// The decoded events of the batch being merged by `Assign(const pb::AggregatedPointEvents&)`.
+  std::vector<Cow<pb::ProcessedPointsEvent>> decoded_events_;
+  /// The frames of the batch being merged by `Assign(const pb::AggregatedPointEvents&)`.
+  std::vector<const pb::PointFrame*> frames_;
+};
+
+}  // namespace sdk
+}  // namespace horus
+
+#endif  // HORUS_SDK_MERGED_POINT_CLOUD_H_
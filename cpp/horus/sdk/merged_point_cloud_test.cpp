@@ -0,0 +1,167 @@
+#include "horus/sdk/merged_point_cloud.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "horus/pb/buffer.h"
+#include "horus/pb/config/metadata_pb.h"
+#include "horus/pb/cow_bytes.h"
+#include "horus/pb/point/point_message_pb.h"
+#include "horus/pb/serialize.h"
+#include "horus/sdk/simd.h"
+#include "horus/testing/allocations.h"
+#include "horus/testing/point_clouds.h"
+
+namespace horus {
+namespace sdk {
+namespace {
+
+/// Returns a frame of lidar `lidar_id` with `size` points, translated by `(1, 2, 3)` if
+/// `translate`, and with attributes and intensities if `attributed`.
+pb::PointFrame MakeFrame(CowBytes&& lidar_id, std::size_t size, bool translate, bool attributed) {
+  pb::PointFrame frame{MakePointFrame(
+      size,
+      [](std::size_t i) {
+        const float value{static_cast<float>(i)};
+        return TestPoint{value, value * 0.5F, -value, 0, 4, static_cast<std::uint16_t>(i)};
+      },
+      attributed ? kTestPointAttributes | kTestPointIntensities : kTestPointCoordinates)};
+  frame.mutable_header().set_lidar_id(std::move(lidar_id));
+  if (translate) {
+    pb::AffineTransform3f transform;
+    transform.mutable_data().Vector() = {1.F, 0.F, 0.F, 0.F, 1.F, 0.F,
+                                         0.F, 0.F, 1.F, 1.F, 2.F, 3.F};
+    frame.mutable_header().set_calibration_transform(std::move(transform));
+  }
+  return frame;
+}
+
+/// Returns the received (i.e. serialized then parsed) events of three frames: "a" with 10 points,
+/// attributes and intensities, "b" without points, and "c" with 37 points translated by
+/// `(1, 2, 3)`.
+pb::AggregatedPointEvents MakeEvents() {
+  std::vector<pb::PointFrame> frames;
+  frames.push_back(MakeFrame("a", 10, false, true));
+  frames.push_back(MakeFrame("b", 0, false, false));
+  frames.push_back(MakeFrame("c", 37, true, false));
+  pb::AggregatedPointEvents events;
+  for (pb::PointFrame& frame : frames) {
+    events.mutable_events().Vector().push_back(
+        pb::ProcessedPointsEvent{}.set_point_frame(std::move(frame)));
+  }
+  PbReader reader{PbBuffer{events.SerializeToBuffer()}};
+  return pb::AggregatedPointEvents{reader};
+}
+
+TEST(MergedPointCloud, Empty) {
+  const MergedPointCloud cloud;
+  EXPECT_TRUE(cloud.empty());
+  EXPECT_EQ(cloud.PaddedSize(), 0);
+  EXPECT_TRUE(cloud.x().empty());
+  EXPECT_TRUE(cloud.attributes().empty());
+  EXPECT_TRUE(cloud.segments().empty());
+}
+
+TEST(MergedPointCloud, MergesFrames) {
+  const pb::AggregatedPointEvents events{MakeEvents()};
+  for (const SimdLevel level : SupportedSimdLevels()) {
+    for (const std::size_t thread_count : {1, 2, 3, 8}) {
+      SCOPED_TRACE(testing::Message()
+                   << "level " << static_cast<int>(level) << ", " << thread_count << " threads");
+      MergedPointCloud cloud;
+      cloud.Assign(events, thread_count, level);
+      ASSERT_EQ(cloud.size(), 47);
+      ASSERT_EQ(cloud.segments().size(), 3);
+      EXPECT_EQ(cloud.segments()[0].lidar_id, "a");
+      EXPECT_EQ(cloud.segments()[0].offset, 0);
+      EXPECT_EQ(cloud.segments()[0].size, 10);
+      EXPECT_EQ(cloud.segments()[1].lidar_id, "b");
+      EXPECT_EQ(cloud.segments()[1].offset, 10);
+      EXPECT_EQ(cloud.segments()[1].size, 0);
+      EXPECT_EQ(cloud.segments()[2].lidar_id, "c");
+      EXPECT_EQ(cloud.segments()[2].offset, 10);
+      EXPECT_EQ(cloud.segments()[2].size, 37);
+
+      for (std::size_t i{0}; i < 10; ++i) {
+        EXPECT_EQ(cloud.x()[i], static_cast<float>(i)) << i;
+        EXPECT_EQ(cloud.y()[i], static_cast<float>(i) * 0.5F) << i;
+        EXPECT_EQ(cloud.z()[i], -static_cast<float>(i)) << i;
+        EXPECT_EQ(cloud.attributes()[i], 4) << i;
+        EXPECT_EQ(cloud.intensities()[i], i) << i;
+      }
+      for (std::size_t i{0}; i < 37; ++i) {
+        EXPECT_EQ(cloud.x()[10 + i], static_cast<float>(i) + 1.F) << i;
+        EXPECT_EQ(cloud.y()[10 + i], static_cast<float>(i) * 0.5F + 2.F) << i;
+        EXPECT_EQ(cloud.z()[10 + i], -static_cast<float>(i) + 3.F) << i;
+        EXPECT_EQ(cloud.attributes()[10 + i], 0) << i;
+        EXPECT_EQ(cloud.intensities()[10 + i], 0) << i;
+      }
+
+      EXPECT_EQ(cloud.PaddedSize(), 48);
+      EXPECT_EQ(cloud.z().data()[47], 0.F);  // NOLINT(*-pointer-arithmetic)
+    }
+  }
+}
+
+TEST(MergedPointCloud, InvalidTransform) {
+  pb::PointFrame frame{MakeFrame("a", 4, false, false)};
+  pb::AffineTransform3f invalid;
+  invalid.mutable_data().Vector() = {1.F, 2.F, 3.F};
+  frame.mutable_header().set_calibration_transform(std::move(invalid));
+  const std::vector<const pb::PointFrame*> frames{&frame};
+
+  MergedPointCloud cloud;
+  cloud.Assign(MakeEvents());
+  EXPECT_THROW(cloud.Assign(frames), std::invalid_argument);
+  EXPECT_TRUE(cloud.empty());
+  EXPECT_TRUE(cloud.segments().empty());
+}
+
+TEST(MergedPointCloud, AssignReusesBuffers) {
+  const pb::AggregatedPointEvents events{MakeEvents()};
+  MergedPointCloud cloud;
+  cloud.Assign(events, 2);
+  const float* const x{cloud.x().data()};
+
+  cloud.Clear();
+  EXPECT_TRUE(cloud.empty());
+  EXPECT_TRUE(cloud.x().empty());
+  EXPECT_TRUE(cloud.segments().empty());
+
+  cloud.Assign(events, 2);
+  EXPECT_EQ(cloud.size(), 47);
+  EXPECT_EQ(cloud.x().data(), x);
+  EXPECT_EQ(cloud.segments()[2].lidar_id, "c");
+}
+
+TEST(MergedPointCloud, DoesNotAllocateOnceWarm) {
+  std::vector<pb::PointFrame> frames;
+  for (std::size_t i{0}; i < 6; ++i) {
+    frames.push_back(MakeFrame("lidar", 100 + i, i % 2 == 0, i % 3 == 0));
+  }
+  std::vector<const pb::PointFrame*> frame_pointers;
+  for (const pb::PointFrame& frame : frames) {
+    frame_pointers.push_back(&frame);
+  }
+  for (const std::size_t thread_count : {1, 3}) {
+    SCOPED_TRACE(testing::Message() << thread_count << " threads");
+    MergedPointCloud cloud;
+    cloud.Assign(frame_pointers, thread_count);
+
+    const std::size_t allocation_count{ProcessAllocationCount()};
+    for (std::int32_t batch{0}; batch < 10; ++batch) {
+      cloud.Assign(frame_pointers, thread_count);
+    }
+    EXPECT_EQ(ProcessAllocationCount(), allocation_count);
+    EXPECT_EQ(cloud.size(), 615);
+  }
+}
+
+}  // namespace
+}  // namespace sdk
+}  // namespace horus
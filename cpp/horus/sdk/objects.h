@@ -6,8 +6,12 @@
 #define HORUS_SDK_OBJECTS_H_
 
 #include <functional>
+#include <memory>
 
 #include "horus/pb/detection_service/detection_pb.h"
+#include "horus/pb/field_mask.h"
+#include "horus/pb/pool.h"
+#include "horus/sdk/event_ring.h"
 
 namespace horus {
 namespace sdk {
@@ -16,6 +20,29 @@ namespace sdk {
 struct ObjectSubscriptionRequest {
   /// Function to call when an object is detected.
   std::function<void(pb::DetectionEvent&&)> on_detection_results;
+
+  /// If non-null, received detection results are pushed to this ring to be polled by the user
+  /// instead of being passed to `on_detection_results`.
+  std::shared_ptr<EventRing<pb::DetectionEvent>> event_ring{nullptr};
+
+  /// The fields of the received `DetectionEvent`s which are not read, and may therefore be skipped
+  /// during deserialization to save time and memory, e.g.
+  /// `PbFieldMask<pb::DetectionEvent>{}.Skip(pb::DetectionEvent::Field::kLabeledPointClouds)`.
+  ///
+  /// Skipped fields may still be set if another subscription to the same service reads them.
+  PbFieldMask<pb::DetectionEvent> field_mask{};
+
+  /// If non-null, received `DetectionEvent`s are deserialized into messages acquired from this
+  /// pool, and `on_detection_results` (or the consumer of `event_ring`) may hand them back with
+  /// `message_pool->Release(std::move(event))` once done with them. The callback may also acquire
+  /// the messages it builds (e.g. filtered events) from the same pool, so that the buffers of the
+  /// fields it fills are reused from event to event.
+  ///
+  /// This does not make receiving events allocation-free: received fields refer to the received
+  /// bytes, which are allocated for each event, rather than to the buffers of the pooled message,
+  /// and each additional subscription to the same service receives a copy of the event which is
+  /// not acquired from the pool.
+  std::shared_ptr<PbMessagePool<pb::DetectionEvent>> message_pool{nullptr};
 };
 
 }  // namespace sdk
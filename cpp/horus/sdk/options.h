@@ -0,0 +1,31 @@
+/// @file
+///
+/// Options used to configure the `Sdk`.
+
+#ifndef HORUS_SDK_OPTIONS_H_
+#define HORUS_SDK_OPTIONS_H_
+
+#include <cstddef>
+
+namespace horus {
+namespace sdk {
+
+/// Options given to the `Sdk` constructor.
+struct SdkOptions {
+  /// Number of dedicated threads on which user callbacks (subscription callbacks and
+  /// `Sdk::Future::OnCompletion()` callbacks) execute.
+  ///
+  /// When non-zero, the callbacks of a single subscription run one after the other in the order in
+  /// which their events were received, while callbacks of different subscriptions run in parallel.
+  /// A slow callback therefore only delays later events of its own subscription, until too many of
+  /// them wait with `DeliveryPolicy::kBlock` and the SDK waits for the callback to catch up.
+  ///
+  /// When zero (the default), callbacks run on the shared libuv thread pool one at a time, and
+  /// each callback must complete before the SDK processes the next event.
+  std::size_t callback_worker_count{0};
+};
+
+}  // namespace sdk
+}  // namespace horus
+
+#endif  // HORUS_SDK_OPTIONS_H_
@@ -0,0 +1,55 @@
+/// @file
+///
+/// The `PointAttributeFilter` struct.
+
+#ifndef HORUS_SDK_POINT_ATTRIBUTE_FILTER_H_
+#define HORUS_SDK_POINT_ATTRIBUTE_FILTER_H_
+
+#include <cstdint>
+
+#include "horus/pb/point/point_message_pb.h"
+
+namespace horus {
+namespace sdk {
+
+/// Selects points by their `pb::PointAttribute` flags, e.g. to drop ground and noise points.
+///
+/// A default-constructed filter keeps all points. Flags are added with `Include()` and `Exclude()`:
+///
+/// ```cpp
+/// const PointAttributeFilter filter{PointAttributeFilter{}
+///                                       .Exclude(pb::PointAttribute::kGround)
+///                                       .Exclude(pb::PointAttribute::kSparseNoise)};
+/// ```
+struct PointAttributeFilter {
+  /// If non-zero, only points with at least one of these flags are kept.
+  std::uint16_t include_mask{0};
+  /// Points with any of these flags are dropped.
+  std::uint16_t exclude_mask{0};
+
+  /// Keeps only points with `attribute` (or another included attribute).
+  constexpr PointAttributeFilter& Include(pb::PointAttribute attribute) noexcept {
+    include_mask = static_cast<std::uint16_t>(include_mask | static_cast<std::uint16_t>(attribute));
+    return *this;
+  }
+
+  /// Drops points with `attribute`.
+  constexpr PointAttributeFilter& Exclude(pb::PointAttribute attribute) noexcept {
+    exclude_mask = static_cast<std::uint16_t>(exclude_mask | static_cast<std::uint16_t>(attribute));
+    return *this;
+  }
+
+  /// Returns whether a point with the given `pb::PointAttribute` flags is kept.
+  constexpr bool Keeps(std::uint16_t attributes) const noexcept {
+    return (attributes & exclude_mask) == 0 &&
+           (include_mask == 0 || (attributes & include_mask) != 0);
+  }
+
+  /// Returns whether all points are kept.
+  constexpr bool KeepsAll() const noexcept { return include_mask == 0 && exclude_mask == 0; }
+};
+
+}  // namespace sdk
+}  // namespace horus
+
+#endif  // HORUS_SDK_POINT_ATTRIBUTE_FILTER_H_
@@ -0,0 +1,186 @@
+#include "horus/sdk/point_cloud_view.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+
+#include "horus/pb/unaligned_span.h"
+#include "horus/pointer/arithmetic.h"
+#include "horus/pointer/unsafe_cast.h"
+#include "horus/sdk/internal/aligned_buffer.h"
+#include "horus/sdk/internal/simd_dispatch.h"
+#include "horus/sdk/simd.h"
+#include "horus/strings/string_view.h"
+#include "horus/types/span.h"
+
+namespace horus {
+namespace sdk {
+namespace {
+
+/// Whether the platform we're compiling for uses little-endian byte order.
+constexpr bool kIsLittleEndian{BYTE_ORDER == LITTLE_ENDIAN};
+
+/// De-interleaves the points `[begin, end)` of `xyz` into `x`, `y` and `z`.
+void DeinterleaveScalar(const char* xyz, std::size_t begin, std::size_t end, float* x, float* y,
+                        float* z) noexcept {
+  for (std::size_t i{begin}; i < end; ++i) {
+    float point[3];
+    static_cast<void>(std::memcpy(point, PointerAdd(xyz, i * sizeof(point)), sizeof(point)));
+    *PointerAdd(x, i) = point[0];
+    *PointerAdd(y, i) = point[1];
+    *PointerAdd(z, i) = point[2];
+  }
+}
+
+#if HORUS_SDK_SIMD_X86
+
+// NOLINTBEGIN(*-reinterpret-cast,*-pointer-arithmetic)
+
+/// De-interleaves the first `size` points of `xyz` into `x`, `y` and `z` (which must be aligned to
+/// 16 bytes) 4 points at a time. Returns the number of de-interleaved points.
+///
+/// Each iteration loads 3 vectors `a = [x0 y0 z0 x1]`, `b = [y1 z1 x2 y2]` and `c = [z2 x3 y3 z3]`,
+/// blends the coordinates of each axis into one vector and shuffles them back in order.
+__attribute__((target("sse4.1"))) std::size_t DeinterleaveSse41(const char* xyz, std::size_t size,
+                                                                 float* x, float* y,
+                                                                 float* z) noexcept {
+  const float* const input{reinterpret_cast<const float*>(xyz)};
+  std::size_t i{0};
+  for (; i + 4 <= size; i += 4) {
+    const __m128 a{_mm_loadu_ps(input + 3 * i)};
+    const __m128 b{_mm_loadu_ps(input + 3 * i + 4)};
+    const __m128 c{_mm_loadu_ps(input + 3 * i + 8)};
+    // [x0 x3 x2 x1], [y1 y0 y3 y2] and [z2 z1 z0 z3].
+    const __m128 xs{_mm_blend_ps(_mm_blend_ps(a, b, 0x4), c, 0x2)};
+    const __m128 ys{_mm_blend_ps(_mm_blend_ps(a, b, 0x9), c, 0x4)};
+    const __m128 zs{_mm_blend_ps(_mm_blend_ps(a, b, 0x2), c, 0x9)};
+    _mm_store_ps(x + i, _mm_shuffle_ps(xs, xs, _MM_SHUFFLE(1, 2, 3, 0)));
+    _mm_store_ps(y + i, _mm_shuffle_ps(ys, ys, _MM_SHUFFLE(2, 3, 0, 1)));
+    _mm_store_ps(z + i, _mm_shuffle_ps(zs, zs, _MM_SHUFFLE(3, 0, 1, 2)));
+  }
+  return i;
+}
+
+/// De-interleaves the first `size` points of `xyz` into `x`, `y` and `z` (which must be aligned to
+/// 32 bytes) 8 points at a time. Returns the number of de-interleaved points.
+///
+/// Each 128-bit lane holds 4 points as in `DeinterleaveSse41()`: the low lanes hold points 0-3 and
+/// the high lanes points 4-7.
+__attribute__((target("avx2"))) std::size_t DeinterleaveAvx2(const char* xyz, std::size_t size,
+                                                              float* x, float* y,
+                                                              float* z) noexcept {
+  const float* const input{reinterpret_cast<const float*>(xyz)};
+  std::size_t i{0};
+  for (; i + 8 <= size; i += 8) {
+    const float* const points{input + 3 * i};
+    const __m256 a{_mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(points)),
+                                        _mm_loadu_ps(points + 12), 1)};
+    const __m256 b{_mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(points + 4)),
+                                        _mm_loadu_ps(points + 16), 1)};
+    const __m256 c{_mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(points + 8)),
+                                        _mm_loadu_ps(points + 20), 1)};
+    const __m256 xs{_mm256_blend_ps(_mm256_blend_ps(a, b, 0x44), c, 0x22)};
+    const __m256 ys{_mm256_blend_ps(_mm256_blend_ps(a, b, 0x99), c, 0x44)};
+    const __m256 zs{_mm256_blend_ps(_mm256_blend_ps(a, b, 0x22), c, 0x99)};
+    _mm256_store_ps(x + i, _mm256_permute_ps(xs, _MM_SHUFFLE(1, 2, 3, 0)));
+    _mm256_store_ps(y + i, _mm256_permute_ps(ys, _MM_SHUFFLE(2, 3, 0, 1)));
+    _mm256_store_ps(z + i, _mm256_permute_ps(zs, _MM_SHUFFLE(3, 0, 1, 2)));
+  }
+  return i;
+}
+
+// NOLINTEND(*-reinterpret-cast,*-pointer-arithmetic)
+
+#endif  // HORUS_SDK_SIMD_X86
+
+/// De-interleaves the first `size` points of `xyz` into `x`, `y` and `z` using `level`.
+void Deinterleave(SimdLevel level, const char* xyz, std::size_t size, float* x, float* y,
+                  float* z) noexcept {
+  const std::size_t done{HORUS_SDK_SIMD_DISPATCH(level, DeinterleaveSse41(xyz, size, x, y, z),
+                                                 DeinterleaveAvx2(xyz, size, x, y, z))};
+  DeinterleaveScalar(xyz, done, size, x, y, z);
+}
+
+/// Returns the first `size` little-endian `uint16` values packed in `bytes`, referring to `bytes`
+/// when possible and copying them into `buffer` otherwise. Returns an empty span if `bytes` holds
+/// fewer than `size` values.
+///
+/// Note that the `uint16` values packed in `fixed32` words (with the even value in the low half)
+/// are laid out the same way, since words are encoded in little-endian byte order.
+Span<const std::uint16_t> UnpackUint16(StringView bytes, std::size_t size,
+                                       horus_internal::AlignedBuffer<std::uint16_t>& buffer) {
+  if (size == 0 || bytes.size() < size * sizeof(std::uint16_t)) {
+    return {};
+  }
+  // NOLINTNEXTLINE(*-reinterpret-cast): only inspects the address
+  const bool is_aligned{reinterpret_cast<std::uintptr_t>(bytes.data()) % alignof(std::uint16_t) ==
+                        0};
+  if (kIsLittleEndian && is_aligned) {
+    return {UnsafePointerCast<const std::uint16_t>(bytes.data()), size};
+  }
+  std::uint16_t* const values{buffer.Resize(size, kPointCloudAlignment)};
+  if (kIsLittleEndian) {
+    static_cast<void>(std::memcpy(values, bytes.data(), size * sizeof(std::uint16_t)));
+    return {values, size};
+  }
+  for (std::size_t i{0}; i < size; ++i) {
+    const auto low = static_cast<std::uint8_t>(bytes[2 * i]);
+    const auto high = static_cast<std::uint8_t>(bytes[2 * i + 1]);
+    *PointerAdd(values, i) = static_cast<std::uint16_t>(low | high << 8);
+  }
+  return {values, size};
+}
+
+/// Returns the bytes of `words`.
+StringView BytesOf(UnalignedSpan<std::uint32_t> words) noexcept {
+  return {words.bytes(), words.size() * sizeof(std::uint32_t)};
+}
+
+}  // namespace
+
+void PointCloudView::Assign(const pb::AttributedPoints& points, SimdLevel level) {
+  const UnalignedSpan<float> xyz{points.flattened_points().Span()};
+  size_ = xyz.size() / 3;
+  padded_size_ = PaddedPointCount(size_);
+
+  float* const x{coordinates_.Resize(3 * padded_size_, kPointCloudAlignment)};
+  float* const y{PointerAdd(x, padded_size_)};
+  float* const z{PointerAdd(y, padded_size_)};
+  Deinterleave(level, xyz.bytes(), size_, x, y, z);
+  for (float* const axis : {x, y, z}) {
+    std::fill(PointerAdd(axis, size_), PointerAdd(axis, padded_size_), 0.0F);
+  }
+
+  attributes_ = UnpackUint16(BytesOf(points.attributes().Span()), size_, attributes_buffer_);
+  intensities_ = UnpackUint16(BytesOf(points.intensities().Span()), size_, intensities_buffer_);
+  ring_indices_ = UnpackUint16(points.ring_indices().Str(), size_, ring_indices_buffer_);
+  points_ = &points;
+}
+
+void PointCloudView::Clear() noexcept {
+  size_ = 0;
+  padded_size_ = 0;
+  attributes_ = {};
+  intensities_ = {};
+  ring_indices_ = {};
+  points_ = nullptr;
+}
+
+Span<const float> PointCloudView::Coordinates(std::size_t axis) const noexcept {
+  if (size_ == 0) {
+    return {};
+  }
+  return {PointerAdd(coordinates_.data(), axis * padded_size_), size_};
+}
+
+Span<float> PointCloudView::MutableCoordinates(std::size_t axis) noexcept {
+  if (size_ == 0) {
+    return {};
+  }
+  return {PointerAdd(coordinates_.data(), axis * padded_size_), size_};
+}
+
+}  // namespace sdk
+}  // namespace horus
@@ -0,0 +1,181 @@
+/// @file
+///
+/// The `PointCloudView` class.
+
+#ifndef HORUS_SDK_POINT_CLOUD_VIEW_H_
+#define HORUS_SDK_POINT_CLOUD_VIEW_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "horus/attributes.h"
+#include "horus/pb/point/point_message_pb.h"
+#include "horus/sdk/internal/aligned_buffer.h"
+#include "horus/sdk/simd.h"
+#include "horus/types/span.h"
+
+namespace horus {
+namespace sdk {
+
+/// Alignment (in bytes) of the arrays exposed by `PointCloudView`.
+constexpr std::size_t kPointCloudAlignment{64};
+
+/// Returns `size` rounded up to a multiple of `kPointCloudAlignment / sizeof(float)`, i.e. the
+/// number of values (padding included) of the coordinate arrays of a cloud of `size` points.
+constexpr std::size_t PaddedPointCount(std::size_t size) noexcept {
+  constexpr std::size_t kFloatsPerAlignment{kPointCloudAlignment / sizeof(float)};
+  return (size + kFloatsPerAlignment - 1) / kFloatsPerAlignment * kFloatsPerAlignment;
+}
+
+/// A structure-of-arrays view of the points of a `pb::PointFrame`, for kernels which process
+/// coordinates with SIMD instructions.
+///
+/// The interleaved `flattened_points` of a frame are generally unaligned in the received bytes, so
+/// `UnalignedSpan<float>` has to read them one at a time. `PointCloudView` de-interleaves them in a
+/// single SIMD pass into separate `x()`, `y()` and `z()` arrays which are aligned to
+/// `kPointCloudAlignment` and zero-padded to `PaddedSize()`, so that kernels can process them with
+/// aligned loads and without a scalar tail.
+///
+/// The packed `uint16` `attributes()`, `intensities()` and `ring_indices()` of the frame are
+/// exposed without copy when the received bytes happen to be suitably aligned, and are copied
+/// otherwise.
+///
+/// A `PointCloudView` reuses its buffers when assigned a new frame, so processing a stream of
+/// frames only allocates until the view reaches the size of the largest frame.
+class PointCloudView final {
+ public:
+  /// Constructs an empty view.
+  PointCloudView() noexcept = default;
+
+  /// Constructs a view of the points of `frame` using the given instruction set, which must be
+  /// supported by the CPU.
+  ///
+  /// @throws std::bad_alloc If the buffers of the view cannot be allocated.
+  explicit PointCloudView(const pb::PointFrame& frame HORUS_LIFETIME_BOUND,
+                          SimdLevel level = BestSimdLevel()) noexcept(false) {
+    Assign(frame, level);
+  }
+
+  /// Constructs a view of `points` using the given instruction set, which must be supported by the
+  /// CPU.
+  ///
+  /// @throws std::bad_alloc If the buffers of the view cannot be allocated.
+  explicit PointCloudView(const pb::AttributedPoints& points HORUS_LIFETIME_BOUND,
+                          SimdLevel level = BestSimdLevel()) noexcept(false) {
+    Assign(points, level);
+  }
+
+  /// Views cannot be copied.
+  PointCloudView(const PointCloudView&) = delete;
+  /// Views cannot be copied.
+  PointCloudView& operator=(const PointCloudView&) = delete;
+  /// Move constructor.
+  PointCloudView(PointCloudView&&) noexcept = default;
+  /// Move assignment operator.
+  PointCloudView& operator=(PointCloudView&&) noexcept = default;
+
+  /// Destroys the view.
+  ~PointCloudView() noexcept = default;
+
+  /// Replaces the contents of the view by the points of `frame`, reusing the buffers of the view.
+  ///
+  /// `frame` must outlive the view (or the next call to `Assign()` or `Clear()`), since
+  /// `attributes()`, `intensities()` and `ring_indices()` may refer to its bytes.
+  ///
+  /// @throws std::bad_alloc If the buffers of the view cannot be allocated.
+  void Assign(const pb::PointFrame& frame HORUS_LIFETIME_BOUND,
+              SimdLevel level = BestSimdLevel()) noexcept(false) {
+    Assign(frame.points(), level);
+  }
+
+  /// Replaces the contents of the view by `points`, reusing the buffers of the view.
+  ///
+  /// `points` must outlive the view (or the next call to `Assign()` or `Clear()`), since
+  /// `attributes()`, `intensities()` and `ring_indices()` may refer to its bytes.
+  ///
+  /// @throws std::bad_alloc If the buffers of the view cannot be allocated.
+  void Assign(const pb::AttributedPoints& points HORUS_LIFETIME_BOUND,
+              SimdLevel level = BestSimdLevel()) noexcept(false);
+
+  /// Empties the view, keeping its buffers.
+  void Clear() noexcept;
+
+  /// Returns the number of points.
+  std::size_t size() const noexcept { return size_; }
+  /// Returns whether `size() == 0`.
+  bool empty() const noexcept { return size_ == 0; }
+
+  /// Returns `size()` rounded up to a multiple of `kPointCloudAlignment / sizeof(float)`.
+  ///
+  /// `x()`, `y()` and `z()` may be read up to `PaddedSize()` values; the padding values are zero.
+  std::size_t PaddedSize() const noexcept { return padded_size_; }
+
+  /// Returns the x coordinates of the points, aligned to `kPointCloudAlignment`.
+  Span<const float> x() const noexcept HORUS_LIFETIME_BOUND { return Coordinates(0); }
+  /// Returns the y coordinates of the points, aligned to `kPointCloudAlignment`.
+  Span<const float> y() const noexcept HORUS_LIFETIME_BOUND { return Coordinates(1); }
+  /// Returns the z coordinates of the points, aligned to `kPointCloudAlignment`.
+  Span<const float> z() const noexcept HORUS_LIFETIME_BOUND { return Coordinates(2); }
+
+  /// Returns the x coordinates of the points, which may be modified (e.g. by
+  /// `TransformPointsInPlace()`).
+  Span<float> mutable_x() noexcept HORUS_LIFETIME_BOUND { return MutableCoordinates(0); }
+  /// Returns the y coordinates of the points, which may be modified.
+  Span<float> mutable_y() noexcept HORUS_LIFETIME_BOUND { return MutableCoordinates(1); }
+  /// Returns the z coordinates of the points, which may be modified.
+  Span<float> mutable_z() noexcept HORUS_LIFETIME_BOUND { return MutableCoordinates(2); }
+
+  /// Returns the `pb::PointAttribute` flags of the points, or an empty span if the frame does not
+  /// have an attribute for each point.
+  Span<const std::uint16_t> attributes() const noexcept HORUS_LIFETIME_BOUND {
+    return attributes_;
+  }
+
+  /// Returns the intensities of the points, or an empty span if the frame does not have an
+  /// intensity for each point.
+  Span<const std::uint16_t> intensities() const noexcept HORUS_LIFETIME_BOUND {
+    return intensities_;
+  }
+
+  /// Returns the ring indices of the points, or an empty span if the frame does not have a ring
+  /// index for each point.
+  Span<const std::uint16_t> ring_indices() const noexcept HORUS_LIFETIME_BOUND {
+    return ring_indices_;
+  }
+
+  /// Returns the points passed to the last call to `Assign()`, e.g. to access fields which are not
+  /// exposed by the view, or null if the view was never assigned or was cleared.
+  const pb::AttributedPoints* points() const noexcept { return points_; }
+
+ private:
+  /// Returns the coordinates of the points on the given axis (0 for x, 1 for y and 2 for z).
+  Span<const float> Coordinates(std::size_t axis) const noexcept;
+  /// Returns the mutable coordinates of the points on the given axis.
+  Span<float> MutableCoordinates(std::size_t axis) noexcept;
+
+  /// Number of points.
+  std::size_t size_{0};
+  /// @see PaddedSize()
+  std::size_t padded_size_{0};
+  /// The x, y and z coordinates of the points, each padded to `padded_size_` values.
+  horus_internal::AlignedBuffer<float> coordinates_;
+  /// Buffer holding a copy of the attributes when they cannot be referenced in place.
+  horus_internal::AlignedBuffer<std::uint16_t> attributes_buffer_;
+  /// Buffer holding a copy of the intensities when they cannot be referenced in place.
+  horus_internal::AlignedBuffer<std::uint16_t> intensities_buffer_;
+  /// Buffer holding a copy of the ring indices when they cannot be referenced in place.
+  horus_internal::AlignedBuffer<std::uint16_t> ring_indices_buffer_;
+  /// @see attributes()
+  Span<const std::uint16_t> attributes_;
+  /// @see intensities()
+  Span<const std::uint16_t> intensities_;
+  /// @see ring_indices()
+  Span<const std::uint16_t> ring_indices_;
+  /// @see points()
+  const pb::AttributedPoints* points_{nullptr};
+};
+
+}  // namespace sdk
+}  // namespace horus
+
+#endif  // HORUS_SDK_POINT_CLOUD_VIEW_H_
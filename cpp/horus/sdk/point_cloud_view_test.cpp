@@ -0,0 +1,175 @@
+#include "horus/sdk/point_cloud_view.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "horus/pb/buffer.h"
+#include "horus/pb/point/point_message_pb.h"
+#include "horus/pb/serialize.h"
+#include "horus/sdk/simd.h"
+#include "horus/testing/point_clouds.h"
+#include "horus/types/span.h"
+
+namespace horus {
+namespace sdk {
+namespace {
+
+/// Returns a frame with `size` points whose coordinates, attributes, intensities and ring indices
+/// are derived from their index.
+pb::PointFrame MakeFrame(std::size_t size) {
+  return MakePointFrame(
+      size,
+      [](std::size_t i) {
+        const float value{static_cast<float>(i)};
+        return TestPoint{value,
+                         value + 0.25F,
+                         -value,
+                         static_cast<std::uint16_t>(i % 64),
+                         static_cast<std::uint16_t>(i % 512),
+                         static_cast<std::uint16_t>(i)};
+      },
+      kTestPointRingIndices | kTestPointAttributes | kTestPointIntensities);
+}
+
+/// Returns the given frame after serializing and deserializing it, so that its fields refer to
+/// (unaligned) received bytes.
+pb::PointFrame Received(const pb::PointFrame& frame) {
+  PbReader reader{PbBuffer{frame.SerializeToBuffer()}};
+  return pb::PointFrame{reader};
+}
+
+/// Returns whether `ptr` is aligned to `alignment` bytes.
+bool IsAligned(const void* ptr, std::size_t alignment) {
+  // NOLINTNEXTLINE(*-reinterpret-cast): only inspects the address
+  return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+/// Expects `view` to hold the points of `MakeFrame(size)`.
+void ExpectFramePoints(const PointCloudView& view, std::size_t size) {
+  ASSERT_EQ(view.size(), size);
+  ASSERT_EQ(view.PaddedSize() % 16, 0);
+  ASSERT_GE(view.PaddedSize(), size);
+  ASSERT_LT(view.PaddedSize(), size + 16);
+  ASSERT_EQ(view.attributes().size(), size);
+  ASSERT_EQ(view.intensities().size(), size);
+  ASSERT_EQ(view.ring_indices().size(), size);
+
+  const Span<const float> x{view.x()};
+  const Span<const float> y{view.y()};
+  const Span<const float> z{view.z()};
+  EXPECT_TRUE(IsAligned(x.data(), kPointCloudAlignment));
+  EXPECT_TRUE(IsAligned(y.data(), kPointCloudAlignment));
+  EXPECT_TRUE(IsAligned(z.data(), kPointCloudAlignment));
+  for (std::size_t i{0}; i < size; ++i) {
+    EXPECT_EQ(x[i], static_cast<float>(i)) << i;
+    EXPECT_EQ(y[i], static_cast<float>(i) + 0.25F) << i;
+    EXPECT_EQ(z[i], -static_cast<float>(i)) << i;
+    EXPECT_EQ(view.attributes()[i], i % 512) << i;
+    EXPECT_EQ(view.intensities()[i], i) << i;
+    EXPECT_EQ(view.ring_indices()[i], i % 64) << i;
+  }
+  for (std::size_t i{size}; i < view.PaddedSize(); ++i) {
+    // NOLINTBEGIN(*-pointer-arithmetic)
+    EXPECT_EQ(x.data()[i], 0.0F) << i;
+    EXPECT_EQ(y.data()[i], 0.0F) << i;
+    EXPECT_EQ(z.data()[i], 0.0F) << i;
+    // NOLINTEND(*-pointer-arithmetic)
+  }
+}
+
+TEST(PointCloudView, Empty) {
+  const PointCloudView view;
+  EXPECT_TRUE(view.empty());
+  EXPECT_EQ(view.PaddedSize(), 0);
+  EXPECT_TRUE(view.x().empty());
+  EXPECT_TRUE(view.attributes().empty());
+
+  const pb::PointFrame frame;
+  const PointCloudView frame_view{frame};
+  EXPECT_TRUE(frame_view.empty());
+  EXPECT_TRUE(frame_view.z().empty());
+  EXPECT_TRUE(frame_view.intensities().empty());
+}
+
+TEST(PointCloudView, AllLevelsDeinterleave) {
+  for (const SimdLevel level : SupportedSimdLevels()) {
+    for (const std::size_t size : {1, 3, 4, 7, 8, 9, 16, 17, 31, 100, 1001}) {
+      SCOPED_TRACE(testing::Message() << "level " << static_cast<int>(level) << ", size " << size);
+      const pb::PointFrame frame{MakeFrame(size)};
+      ExpectFramePoints(PointCloudView{frame, level}, size);
+
+      const pb::PointFrame received{Received(frame)};
+      ExpectFramePoints(PointCloudView{received, level}, size);
+    }
+  }
+}
+
+TEST(PointCloudView, AttributesAreReferencedWhenAligned) {
+  // Frames of different sizes shift the offsets of the attributes in the received bytes.
+  bool referenced{false};
+  bool copied{false};
+  for (std::size_t size{1}; size < 300; size += 37) {
+    const pb::PointFrame received{Received(MakeFrame(size))};
+    const PointCloudView view{received};
+    const char* const bytes{received.points().attributes().Span().bytes()};
+    if (IsAligned(bytes, alignof(std::uint16_t))) {
+      EXPECT_EQ(static_cast<const void*>(view.attributes().data()), bytes);
+      referenced = true;
+    } else {
+      EXPECT_TRUE(IsAligned(view.attributes().data(), kPointCloudAlignment));
+      copied = true;
+    }
+    EXPECT_EQ(view.attributes()[size - 1], (size - 1) % 512);
+  }
+  EXPECT_TRUE(referenced);
+  EXPECT_TRUE(copied);
+}
+
+TEST(PointCloudView, MissingAttributes) {
+  pb::PointFrame frame{MakeFrame(10)};
+  frame.mutable_points().mutable_attributes().Vector().resize(4);
+  frame.mutable_points().clear_intensities();
+  frame.mutable_points().mutable_ring_indices().String().resize(19);
+
+  const PointCloudView view{frame};
+  EXPECT_EQ(view.size(), 10);
+  EXPECT_TRUE(view.attributes().empty());
+  EXPECT_TRUE(view.intensities().empty());
+  EXPECT_TRUE(view.ring_indices().empty());
+}
+
+TEST(PointCloudView, AssignReusesBuffers) {
+  const pb::PointFrame first{MakeFrame(1000)};
+  PointCloudView view{first};
+  const float* const x{view.x().data()};
+
+  const pb::PointFrame small{MakeFrame(10)};
+  view.Assign(small);
+  ExpectFramePoints(view, 10);
+  EXPECT_EQ(view.x().data(), x);
+
+  EXPECT_EQ(view.points(), &small.points());
+
+  view.Clear();
+  EXPECT_TRUE(view.empty());
+  EXPECT_EQ(view.points(), nullptr);
+  EXPECT_TRUE(view.x().empty());
+  EXPECT_TRUE(view.attributes().empty());
+
+  const pb::PointFrame large{MakeFrame(1000)};
+  view.Assign(large);
+  ExpectFramePoints(view, 1000);
+  EXPECT_EQ(view.x().data(), x);
+
+  const PointCloudView moved{std::move(view)};
+  ExpectFramePoints(moved, 1000);
+  EXPECT_EQ(moved.x().data(), x);
+}
+
+}  // namespace
+}  // namespace sdk
+}  // namespace horus
@@ -5,9 +5,14 @@
 #ifndef HORUS_SDK_POINT_CLOUDS_H_
 #define HORUS_SDK_POINT_CLOUDS_H_
 
+#include <cstddef>
 #include <functional>
+#include <memory>
 
 #include "horus/pb/point/point_message_pb.h"
+#include "horus/sdk/delivery.h"
+#include "horus/sdk/event_ring.h"
+#include "horus/sdk/merged_point_cloud.h"
 
 namespace horus {
 namespace sdk {
@@ -16,6 +21,34 @@ namespace sdk {
 struct PointCloudSubscriptionRequest {
   /// Function to call when a point cloud is received.
   std::function<void(pb::PointFrame&&)> on_point_cloud;
+
+  /// If non-null, received point clouds are pushed to this ring to be polled by the user instead of
+  /// being passed to `on_point_cloud`. `delivery_policy` is then ignored.
+  std::shared_ptr<EventRing<pb::PointFrame>> event_ring{nullptr};
+
+  /// How point clouds are delivered when `on_point_cloud` cannot keep up with them. With
+  /// `DeliveryPolicy::kKeepLatest`, the latest point cloud of each lidar is kept.
+  ///
+  /// Dropped point clouds are counted by `Sdk::Subscription::DroppedEventCount()`.
+  DeliveryPolicy delivery_policy{DeliveryPolicy::kBlock};
+
+  /// The maximum number of point clouds waiting for delivery with `DeliveryPolicy::kDropOldest`,
+  /// which must be positive.
+  std::size_t max_pending_point_clouds{4};
+
+  /// If set, point clouds are delivered merged instead of being passed to `on_point_cloud`: the
+  /// frames of all lidars received together are transformed to world coordinates and passed to
+  /// this function as a single `MergedPointCloud`, whose segments give the points of each lidar.
+  ///
+  /// The cloud is reused for the next batch once the function returns, so its contents must be
+  /// copied to be kept. `event_ring` is then ignored, and `delivery_policy` applies to whole
+  /// batches (with `DeliveryPolicy::kKeepLatest`, only the latest batch is kept).
+  std::function<void(const MergedPointCloud&)> on_merged_point_cloud;
+
+  /// The number of threads transforming frames in parallel for `on_merged_point_cloud`, including
+  /// the thread calling it. The threads are started for the first batch and reused for the next
+  /// ones, like the buffers of the cloud; receiving and dispatching each batch still allocates.
+  std::size_t merge_thread_count{1};
 };
 
 }  // namespace sdk
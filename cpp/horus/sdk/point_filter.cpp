@@ -0,0 +1,443 @@
+#include "horus/sdk/point_filter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+
+#include "horus/pb/cow.h"
+#include "horus/pb/point/point_message_pb.h"
+#include "horus/pointer/arithmetic.h"
+#include "horus/sdk/internal/compress_tables.h"
+#include "horus/sdk/internal/simd_dispatch.h"
+#include "horus/sdk/point_attribute_filter.h"
+#include "horus/sdk/point_cloud_view.h"
+#include "horus/sdk/simd.h"
+#include "horus/types/span.h"
+
+namespace horus {
+namespace sdk {
+namespace {
+
+/// The values of the points read by a filter kernel. Optional values may be null.
+struct FilterInput {
+  /// The x coordinates.
+  const float* x;
+  /// The y coordinates.
+  const float* y;
+  /// The z coordinates.
+  const float* z;
+  /// The attributes.
+  const std::uint16_t* attributes;
+  /// The intensities (optional).
+  const std::uint16_t* intensities;
+  /// The ring indices (optional).
+  const std::uint16_t* ring_indices;
+};
+
+/// The values of the kept points written by a filter kernel. Optional values are null iff they are
+/// null in `FilterInput`.
+struct FilterOutput {
+  /// The x coordinates.
+  float* x;
+  /// The y coordinates.
+  float* y;
+  /// The z coordinates.
+  float* z;
+  /// The indices of the kept points.
+  std::uint32_t* indices;
+  /// The attributes.
+  std::uint16_t* attributes;
+  /// The intensities (optional).
+  std::uint16_t* intensities;
+  /// The ring indices (optional).
+  std::uint16_t* ring_indices;
+};
+
+/// Copies the points `[begin, end)` of `input` kept by `filter` to `output` starting at `written`.
+/// Returns the new number of written points.
+std::size_t FilterScalar(const FilterInput& input, const PointAttributeFilter& filter,
+                         std::size_t begin, std::size_t end, const FilterOutput& output,
+                         std::size_t written) noexcept {
+  for (std::size_t i{begin}; i < end; ++i) {
+    const std::uint16_t attributes{*PointerAdd(input.attributes, i)};
+    if (!filter.Keeps(attributes)) {
+      continue;
+    }
+    *PointerAdd(output.x, written) = *PointerAdd(input.x, i);
+    *PointerAdd(output.y, written) = *PointerAdd(input.y, i);
+    *PointerAdd(output.z, written) = *PointerAdd(input.z, i);
+    *PointerAdd(output.indices, written) = static_cast<std::uint32_t>(i);
+    *PointerAdd(output.attributes, written) = attributes;
+    if (input.intensities != nullptr) {
+      *PointerAdd(output.intensities, written) = *PointerAdd(input.intensities, i);
+    }
+    if (input.ring_indices != nullptr) {
+      *PointerAdd(output.ring_indices, written) = *PointerAdd(input.ring_indices, i);
+    }
+    ++written;
+  }
+  return written;
+}
+
+/// Returns the number of points `[begin, end)` of `attributes` kept by `filter`.
+std::size_t CountScalar(const std::uint16_t* attributes, const PointAttributeFilter& filter,
+                        std::size_t begin, std::size_t end) noexcept {
+  std::size_t count{0};
+  for (std::size_t i{begin}; i < end; ++i) {
+    count += filter.Keeps(*PointerAdd(attributes, i)) ? 1 : 0;
+  }
+  return count;
+}
+
+#if HORUS_SDK_SIMD_X86
+
+// NOLINTBEGIN(*-reinterpret-cast,*-pointer-arithmetic)
+
+/// The masks of a `PointAttributeFilter` broadcast to the 16-bit lanes of SSE4.1 vectors.
+struct Sse41Masks {
+  /// All zeros.
+  __m128i zero;
+  /// `PointAttributeFilter::exclude_mask`.
+  __m128i exclude;
+  /// `PointAttributeFilter::include_mask`.
+  __m128i include;
+  /// All ones iff points must have an included attribute.
+  __m128i include_active;
+};
+
+/// The masks of a `PointAttributeFilter` broadcast to the 16-bit lanes of AVX2 vectors.
+struct Avx2Masks {
+  /// All zeros.
+  __m256i zero;
+  /// `PointAttributeFilter::exclude_mask`.
+  __m256i exclude;
+  /// `PointAttributeFilter::include_mask`.
+  __m256i include;
+  /// All ones iff points must have an included attribute.
+  __m256i include_active;
+};
+
+/// Returns the `Sse41Masks` of `filter`.
+__attribute__((target("sse4.1"))) inline Sse41Masks MasksSse41(
+    const PointAttributeFilter& filter) noexcept {
+  return {_mm_setzero_si128(), _mm_set1_epi16(static_cast<std::int16_t>(filter.exclude_mask)),
+          _mm_set1_epi16(static_cast<std::int16_t>(filter.include_mask)),
+          _mm_set1_epi16(static_cast<std::int16_t>(filter.include_mask == 0 ? 0 : -1))};
+}
+
+/// Returns all ones in the 16-bit lanes of `attributes` which are kept by the filter of `masks`.
+__attribute__((target("sse4.1"))) inline __m128i KeepSse41(__m128i attributes,
+                                                           const Sse41Masks& masks) {
+  const __m128i not_included{_mm_and_si128(
+      _mm_cmpeq_epi16(_mm_and_si128(attributes, masks.include), masks.zero), masks.include_active)};
+  return _mm_andnot_si128(not_included,
+                          _mm_cmpeq_epi16(_mm_and_si128(attributes, masks.exclude), masks.zero));
+}
+
+/// Returns the `Avx2Masks` of `filter`.
+__attribute__((target("avx2"))) inline Avx2Masks MasksAvx2(
+    const PointAttributeFilter& filter) noexcept {
+  return {_mm256_setzero_si256(),
+          _mm256_set1_epi16(static_cast<std::int16_t>(filter.exclude_mask)),
+          _mm256_set1_epi16(static_cast<std::int16_t>(filter.include_mask)),
+          _mm256_set1_epi16(static_cast<std::int16_t>(filter.include_mask == 0 ? 0 : -1))};
+}
+
+/// Returns all ones in the 16-bit lanes of `attributes` which are kept by the filter of `masks`.
+__attribute__((target("avx2"))) inline __m256i KeepAvx2(__m256i attributes,
+                                                        const Avx2Masks& masks) {
+  const __m256i not_included{
+      _mm256_and_si256(_mm256_cmpeq_epi16(_mm256_and_si256(attributes, masks.include), masks.zero),
+                       masks.include_active)};
+  return _mm256_andnot_si256(
+      not_included, _mm256_cmpeq_epi16(_mm256_and_si256(attributes, masks.exclude), masks.zero));
+}
+
+/// Copies the points of `input` kept by `filter` to the beginning of `output`, 4 points at a time.
+/// Returns the number of processed points, and sets `written` to the number of written points.
+///
+/// All 4 lanes are stored at `output + written` before advancing `written` by the number of kept
+/// points, which never writes past the processed points.
+__attribute__((target("sse4.1"))) std::size_t FilterSse41(const FilterInput& input,
+                                                           const PointAttributeFilter& filter,
+                                                           std::size_t size,
+                                                           const FilterOutput& output,
+                                                           std::size_t& written) noexcept {
+  const horus_internal::CompressTables& tables{horus_internal::GetCompressTables()};
+  const Sse41Masks masks{MasksSse41(filter)};
+  const __m128i lane_indices{_mm_setr_epi32(0, 1, 2, 3)};
+  std::size_t out{0};
+  std::size_t i{0};
+  for (; i + 4 <= size; i += 4) {
+    const __m128i attributes{
+        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input.attributes + i))};
+    const __m128i keep{KeepSse41(attributes, masks)};
+    // Only the 4 lower lanes of `attributes` were loaded.
+    const auto mask =
+        static_cast<std::size_t>(_mm_movemask_epi8(_mm_packs_epi16(keep, masks.zero)) & 0xF);
+    const __m128i lanes32{
+        _mm_load_si128(reinterpret_cast<const __m128i*>(tables.bytes4[mask].data()))};
+    const __m128i lanes16{
+        _mm_load_si128(reinterpret_cast<const __m128i*>(tables.bytes8[mask].data()))};
+
+    for (std::size_t axis{0}; axis < 3; ++axis) {
+      const float* const in{axis == 0 ? input.x : axis == 1 ? input.y : input.z};
+      float* const out_axis{axis == 0 ? output.x : axis == 1 ? output.y : output.z};
+      _mm_storeu_si128(
+          reinterpret_cast<__m128i*>(out_axis + out),
+          _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)), lanes32));
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output.indices + out),
+                     _mm_shuffle_epi8(_mm_add_epi32(_mm_set1_epi32(static_cast<std::int32_t>(i)),
+                                                    lane_indices),
+                                      lanes32));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(output.attributes + out),
+                     _mm_shuffle_epi8(attributes, lanes16));
+    if (input.intensities != nullptr) {
+      _mm_storel_epi64(
+          reinterpret_cast<__m128i*>(output.intensities + out),
+          _mm_shuffle_epi8(
+              _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input.intensities + i)), lanes16));
+    }
+    if (input.ring_indices != nullptr) {
+      _mm_storel_epi64(
+          reinterpret_cast<__m128i*>(output.ring_indices + out),
+          _mm_shuffle_epi8(
+              _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input.ring_indices + i)), lanes16));
+    }
+    out += tables.counts[mask];
+  }
+  written = out;
+  return i;
+}
+
+/// Copies the points of `input` kept by `filter` to the beginning of `output`, 8 points at a time.
+/// Returns the number of processed points, and sets `written` to the number of written points.
+///
+/// See `FilterSse41()`.
+__attribute__((target("avx2"))) std::size_t FilterAvx2(const FilterInput& input,
+                                                        const PointAttributeFilter& filter,
+                                                        std::size_t size,
+                                                        const FilterOutput& output,
+                                                        std::size_t& written) noexcept {
+  const horus_internal::CompressTables& tables{horus_internal::GetCompressTables()};
+  const Sse41Masks masks{MasksSse41(filter)};
+  const __m256i lane_indices{_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)};
+  std::size_t out{0};
+  std::size_t i{0};
+  for (; i + 8 <= size; i += 8) {
+    const __m128i attributes{
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(input.attributes + i))};
+    const __m128i keep{KeepSse41(attributes, masks)};
+    const auto mask =
+        static_cast<std::size_t>(_mm_movemask_epi8(_mm_packs_epi16(keep, masks.zero)));
+    const __m256i lanes32{
+        _mm256_load_si256(reinterpret_cast<const __m256i*>(tables.lanes8[mask].data()))};
+    const __m128i lanes16{
+        _mm_load_si128(reinterpret_cast<const __m128i*>(tables.bytes8[mask].data()))};
+
+    for (std::size_t axis{0}; axis < 3; ++axis) {
+      const float* const in{axis == 0 ? input.x : axis == 1 ? input.y : input.z};
+      float* const out_axis{axis == 0 ? output.x : axis == 1 ? output.y : output.z};
+      _mm256_storeu_ps(out_axis + out, _mm256_permutevar8x32_ps(_mm256_loadu_ps(in + i), lanes32));
+    }
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(output.indices + out),
+        _mm256_permutevar8x32_epi32(
+            _mm256_add_epi32(_mm256_set1_epi32(static_cast<std::int32_t>(i)), lane_indices),
+            lanes32));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output.attributes + out),
+                     _mm_shuffle_epi8(attributes, lanes16));
+    if (input.intensities != nullptr) {
+      _mm_storeu_si128(
+          reinterpret_cast<__m128i*>(output.intensities + out),
+          _mm_shuffle_epi8(
+              _mm_loadu_si128(reinterpret_cast<const __m128i*>(input.intensities + i)), lanes16));
+    }
+    if (input.ring_indices != nullptr) {
+      _mm_storeu_si128(
+          reinterpret_cast<__m128i*>(output.ring_indices + out),
+          _mm_shuffle_epi8(
+              _mm_loadu_si128(reinterpret_cast<const __m128i*>(input.ring_indices + i)), lanes16));
+    }
+    out += tables.counts[mask];
+  }
+  written = out;
+  return i;
+}
+
+/// Counts the points of `attributes` kept by `filter`, 8 points at a time. Returns the number of
+/// processed points, and sets `count` to the number of kept points.
+__attribute__((target("sse4.1"))) std::size_t CountSse41(const std::uint16_t* attributes,
+                                                          const PointAttributeFilter& filter,
+                                                          std::size_t size,
+                                                          std::size_t& count) noexcept {
+  const Sse41Masks masks{MasksSse41(filter)};
+  const __m128i ones{_mm_set1_epi16(1)};
+  // Kept lanes are -1, so subtracting the sums of pairs of lanes counts them.
+  __m128i counts{_mm_setzero_si128()};
+  std::size_t i{0};
+  for (; i + 8 <= size; i += 8) {
+    const __m128i keep{
+        KeepSse41(_mm_loadu_si128(reinterpret_cast<const __m128i*>(attributes + i)), masks)};
+    counts = _mm_sub_epi32(counts, _mm_madd_epi16(keep, ones));
+  }
+  counts = _mm_add_epi32(counts, _mm_shuffle_epi32(counts, _MM_SHUFFLE(1, 0, 3, 2)));
+  counts = _mm_add_epi32(counts, _mm_shuffle_epi32(counts, _MM_SHUFFLE(2, 3, 0, 1)));
+  count = static_cast<std::uint32_t>(_mm_cvtsi128_si32(counts));
+  return i;
+}
+
+/// Counts the points of `attributes` kept by `filter`, 16 points at a time. Returns the number of
+/// processed points, and sets `count` to the number of kept points.
+__attribute__((target("avx2"))) std::size_t CountAvx2(const std::uint16_t* attributes,
+                                                       const PointAttributeFilter& filter,
+                                                       std::size_t size,
+                                                       std::size_t& count) noexcept {
+  const Avx2Masks masks{MasksAvx2(filter)};
+  const __m256i ones{_mm256_set1_epi16(1)};
+  // See `CountSse41()`.
+  __m256i counts{_mm256_setzero_si256()};
+  std::size_t i{0};
+  for (; i + 16 <= size; i += 16) {
+    const __m256i keep{
+        KeepAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(attributes + i)), masks)};
+    counts = _mm256_sub_epi32(counts, _mm256_madd_epi16(keep, ones));
+  }
+  __m128i sums{
+      _mm_add_epi32(_mm256_castsi256_si128(counts), _mm256_extracti128_si256(counts, 1))};
+  sums = _mm_add_epi32(sums, _mm_shuffle_epi32(sums, _MM_SHUFFLE(1, 0, 3, 2)));
+  sums = _mm_add_epi32(sums, _mm_shuffle_epi32(sums, _MM_SHUFFLE(2, 3, 0, 1)));
+  count = static_cast<std::uint32_t>(_mm_cvtsi128_si32(sums));
+  return i;
+}
+
+// NOLINTEND(*-reinterpret-cast,*-pointer-arithmetic)
+
+#endif  // HORUS_SDK_SIMD_X86
+
+/// Returns the pointer to the values of `buffer` resized to `size` values if `values` is not empty,
+/// or empties `buffer` and returns null otherwise.
+template <class T>
+T* ResizeOptional(horus_internal::AlignedBuffer<T>& buffer, Span<const T> values,
+                  std::size_t size) {
+  if (values.empty()) {
+    static_cast<void>(buffer.Resize(0, kPointCloudAlignment));
+    return nullptr;
+  }
+  return buffer.Resize(size, kPointCloudAlignment);
+}
+
+/// Returns the number of nanoseconds between the epoch and `timestamp`.
+std::int64_t ToNanoseconds(const pb::Timestamp& timestamp) noexcept {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::seconds{timestamp.seconds()} +
+             std::chrono::nanoseconds{timestamp.nanos()})
+      .count();
+}
+
+}  // namespace
+
+void FilteredPointCloud::Assign(const PointCloudView& view, const PointAttributeFilter& filter,
+                                SimdLevel level) {
+  const std::size_t view_size{view.size()};
+  const Span<const std::uint16_t> view_attributes{view.attributes()};
+  const bool keeps_all{view_attributes.empty() ? filter.Keeps(0) : filter.KeepsAll()};
+  const bool keeps_none{view_attributes.empty() && !keeps_all};
+  const std::size_t capacity{keeps_none ? 0 : view_size};
+
+  stride_ = PaddedPointCount(capacity);
+  float* const x{coordinates_.Resize(3 * stride_, kPointCloudAlignment)};
+  const FilterOutput output{
+      x,
+      PointerAdd(x, stride_),
+      PointerAdd(x, 2 * stride_),
+      indices_.Resize(capacity, kPointCloudAlignment),
+      ResizeOptional(attributes_, view_attributes, capacity),
+      ResizeOptional(intensities_, view.intensities(), capacity),
+      ResizeOptional(ring_indices_, view.ring_indices(), capacity),
+  };
+
+  std::size_t written{0};
+  if (keeps_all) {
+    // Copy all points without looking at their attributes.
+    for (const std::size_t axis : {0, 1, 2}) {
+      const Span<const float> in{axis == 0 ? view.x() : axis == 1 ? view.y() : view.z()};
+      std::copy(in.begin(), in.end(), PointerAdd(x, axis * stride_));
+    }
+    for (std::size_t i{0}; i < capacity; ++i) {
+      *PointerAdd(output.indices, i) = static_cast<std::uint32_t>(i);
+    }
+    std::copy(view_attributes.begin(), view_attributes.end(), output.attributes);
+    std::copy(view.intensities().begin(), view.intensities().end(), output.intensities);
+    std::copy(view.ring_indices().begin(), view.ring_indices().end(), output.ring_indices);
+    written = capacity;
+  } else if (!keeps_none) {
+    const FilterInput input{
+        view.x().data(),
+        view.y().data(),
+        view.z().data(),
+        view_attributes.data(),
+        view.intensities().empty() ? nullptr : view.intensities().data(),
+        view.ring_indices().empty() ? nullptr : view.ring_indices().data(),
+    };
+    const std::size_t done{
+        HORUS_SDK_SIMD_DISPATCH(level, FilterSse41(input, filter, view_size, output, written),
+                                FilterAvx2(input, filter, view_size, output, written))};
+    written = FilterScalar(input, filter, done, view_size, output, written);
+  }
+
+  size_ = written;
+  padded_size_ = PaddedPointCount(written);
+  for (std::size_t axis{0}; axis < 3; ++axis) {
+    float* const coordinates{PointerAdd(x, axis * stride_)};
+    std::fill(PointerAdd(coordinates, size_), PointerAdd(coordinates, padded_size_), 0.0F);
+  }
+
+  // Timestamps are messages which cannot be compacted with SIMD instructions, so they are decoded
+  // one by one, and only for the kept points.
+  const pb::AttributedPoints* const points{view.points()};
+  if (points == nullptr || size_ == 0 || points->timestamps().size() != view_size) {
+    static_cast<void>(timestamps_.Resize(0, kPointCloudAlignment));
+    return;
+  }
+  std::int64_t* const timestamps{timestamps_.Resize(size_, kPointCloudAlignment)};
+  std::size_t index{0};
+  std::size_t kept{0};
+  for (const Cow<pb::Timestamp>& timestamp : points->timestamps()) {
+    if (index == *PointerAdd(indices_.data(), kept)) {
+      *PointerAdd(timestamps, kept) = ToNanoseconds(timestamp.Ref());
+      if (++kept == size_) {
+        break;
+      }
+    }
+    ++index;
+  }
+}
+
+void FilteredPointCloud::Clear() noexcept {
+  size_ = 0;
+  padded_size_ = 0;
+}
+
+std::size_t CountPoints(const PointCloudView& view, const PointAttributeFilter& filter,
+                        SimdLevel level) noexcept {
+  const Span<const std::uint16_t> attributes{view.attributes()};
+  if (attributes.empty()) {
+    return filter.Keeps(0) ? view.size() : 0;
+  }
+  if (filter.KeepsAll()) {
+    return view.size();
+  }
+  std::size_t count{0};
+  const std::size_t done{HORUS_SDK_SIMD_DISPATCH(
+      level, CountSse41(attributes.data(), filter, attributes.size(), count),
+      CountAvx2(attributes.data(), filter, attributes.size(), count))};
+  return count + CountScalar(attributes.data(), filter, done, attributes.size());
+}
+
+}  // namespace sdk
+}  // namespace horus
@@ -0,0 +1,164 @@
+/// @file
+///
+/// The `FilteredPointCloud` class and the `CountPoints()` function.
+
+#ifndef HORUS_SDK_POINT_FILTER_H_
+#define HORUS_SDK_POINT_FILTER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "horus/attributes.h"
+#include "horus/pointer/arithmetic.h"
+#include "horus/sdk/internal/aligned_buffer.h"
+#include "horus/sdk/point_attribute_filter.h"
+#include "horus/sdk/point_cloud_view.h"
+#include "horus/sdk/simd.h"
+#include "horus/types/span.h"
+
+namespace horus {
+namespace sdk {
+
+/// The points of a `PointCloudView` kept by a `PointAttributeFilter`, e.g. all points which are
+/// neither ground nor noise.
+///
+/// The kept points are compacted with SIMD instructions, keeping their coordinates, attributes,
+/// intensities, ring indices and timestamps in sync. The coordinates have the same alignment and
+/// padding as in `PointCloudView`.
+///
+/// A `FilteredPointCloud` owns its values, and reuses its buffers when assigned new points.
+class FilteredPointCloud final {
+ public:
+  /// Constructs an empty cloud.
+  FilteredPointCloud() noexcept = default;
+
+  /// Constructs the cloud of the points of `view` kept by `filter`, using the given instruction set
+  /// (which must be supported by the CPU).
+  ///
+  /// @throws std::bad_alloc If the buffers of the cloud cannot be allocated.
+  FilteredPointCloud(const PointCloudView& view, const PointAttributeFilter& filter,
+                     SimdLevel level = BestSimdLevel()) noexcept(false) {
+    Assign(view, filter, level);
+  }
+
+  /// Clouds cannot be copied.
+  FilteredPointCloud(const FilteredPointCloud&) = delete;
+  /// Clouds cannot be copied.
+  FilteredPointCloud& operator=(const FilteredPointCloud&) = delete;
+  /// Move constructor.
+  FilteredPointCloud(FilteredPointCloud&&) noexcept = default;
+  /// Move assignment operator.
+  FilteredPointCloud& operator=(FilteredPointCloud&&) noexcept = default;
+
+  /// Destroys the cloud.
+  ~FilteredPointCloud() noexcept = default;
+
+  /// Replaces the contents of the cloud by the points of `view` kept by `filter`, reusing the
+  /// buffers of the cloud.
+  ///
+  /// If `view` has no attributes, the attributes of all its points are `kAttributeNone`.
+  ///
+  /// @throws std::bad_alloc If the buffers of the cloud cannot be allocated.
+  void Assign(const PointCloudView& view, const PointAttributeFilter& filter,
+              SimdLevel level = BestSimdLevel()) noexcept(false);
+
+  /// Empties the cloud, keeping its buffers.
+  void Clear() noexcept;
+
+  /// Returns the number of points.
+  std::size_t size() const noexcept { return size_; }
+  /// Returns whether `size() == 0`.
+  bool empty() const noexcept { return size_ == 0; }
+
+  /// Returns `size()` rounded up to a multiple of `kPointCloudAlignment / sizeof(float)`.
+  ///
+  /// `x()`, `y()` and `z()` may be read up to `PaddedSize()` values; the padding values are zero.
+  std::size_t PaddedSize() const noexcept { return padded_size_; }
+
+  /// Returns the x coordinates of the points, aligned to `kPointCloudAlignment`.
+  Span<const float> x() const noexcept HORUS_LIFETIME_BOUND { return Coordinates(0); }
+  /// Returns the y coordinates of the points, aligned to `kPointCloudAlignment`.
+  Span<const float> y() const noexcept HORUS_LIFETIME_BOUND { return Coordinates(1); }
+  /// Returns the z coordinates of the points, aligned to `kPointCloudAlignment`.
+  Span<const float> z() const noexcept HORUS_LIFETIME_BOUND { return Coordinates(2); }
+
+  /// Returns the indices of the points in the filtered `PointCloudView`.
+  Span<const std::uint32_t> indices() const noexcept HORUS_LIFETIME_BOUND {
+    return {indices_.data(), size_};
+  }
+
+  /// Returns the `pb::PointAttribute` flags of the points, or an empty span if the filtered view
+  /// had no attributes.
+  Span<const std::uint16_t> attributes() const noexcept HORUS_LIFETIME_BOUND {
+    return OptionalValues(attributes_);
+  }
+
+  /// Returns the intensities of the points, or an empty span if the filtered view had no
+  /// intensities.
+  Span<const std::uint16_t> intensities() const noexcept HORUS_LIFETIME_BOUND {
+    return OptionalValues(intensities_);
+  }
+
+  /// Returns the ring indices of the points, or an empty span if the filtered view had no ring
+  /// indices.
+  Span<const std::uint16_t> ring_indices() const noexcept HORUS_LIFETIME_BOUND {
+    return OptionalValues(ring_indices_);
+  }
+
+  /// Returns the timestamps of the points in nanoseconds since the epoch, or an empty span if the
+  /// filtered frame did not have a timestamp for each point.
+  Span<const std::int64_t> timestamps() const noexcept HORUS_LIFETIME_BOUND {
+    return OptionalValues(timestamps_);
+  }
+
+ private:
+  /// Returns the coordinates of the points on the given axis (0 for x, 1 for y and 2 for z).
+  Span<const float> Coordinates(std::size_t axis) const noexcept {
+    if (size_ == 0) {
+      return {};
+    }
+    return {PointerAdd(coordinates_.data(), axis * stride_), size_};
+  }
+
+  /// Returns the first `size()` values of `buffer`, or an empty span if `buffer` is empty (i.e. the
+  /// values are not available).
+  template <class T>
+  Span<const T> OptionalValues(const horus_internal::AlignedBuffer<T>& buffer) const noexcept {
+    if (buffer.size() == 0) {
+      return {};
+    }
+    return {buffer.data(), size_};
+  }
+
+  /// Number of points.
+  std::size_t size_{0};
+  /// @see PaddedSize()
+  std::size_t padded_size_{0};
+  /// Distance between the first x, y and z coordinates in `coordinates_`, which is at least
+  /// `padded_size_`.
+  std::size_t stride_{0};
+  /// The x, y and z coordinates of the points, `stride_` values apart.
+  horus_internal::AlignedBuffer<float> coordinates_;
+  /// @see indices()
+  horus_internal::AlignedBuffer<std::uint32_t> indices_;
+  /// @see attributes()
+  horus_internal::AlignedBuffer<std::uint16_t> attributes_;
+  /// @see intensities()
+  horus_internal::AlignedBuffer<std::uint16_t> intensities_;
+  /// @see ring_indices()
+  horus_internal::AlignedBuffer<std::uint16_t> ring_indices_;
+  /// @see timestamps()
+  horus_internal::AlignedBuffer<std::int64_t> timestamps_;
+};
+
+/// Returns the number of points of `view` kept by `filter`, without copying them (e.g. for
+/// statistics).
+///
+/// If `view` has no attributes, the attributes of all its points are `kAttributeNone`.
+std::size_t CountPoints(const PointCloudView& view, const PointAttributeFilter& filter,
+                        SimdLevel level = BestSimdLevel()) noexcept;
+
+}  // namespace sdk
+}  // namespace horus
+
+#endif  // HORUS_SDK_POINT_FILTER_H_
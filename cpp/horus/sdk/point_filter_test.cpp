@@ -0,0 +1,158 @@
+#include "horus/sdk/point_filter.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "horus/pb/config/metadata_pb.h"
+#include "horus/pb/point/point_message_pb.h"
+#include "horus/sdk/point_attribute_filter.h"
+#include "horus/sdk/point_cloud_view.h"
+#include "horus/sdk/simd.h"
+#include "horus/testing/point_clouds.h"
+
+namespace horus {
+namespace sdk {
+namespace {
+
+/// Returns the attributes of point `i` in frames returned by `MakeFrame()`.
+std::uint16_t AttributesOf(std::size_t i) { return static_cast<std::uint16_t>(i * 5 % 8); }
+
+/// Returns a frame with `size` points with attributes (see `AttributesOf()`), intensities, ring
+/// indices and timestamps.
+pb::PointFrame MakeFrame(std::size_t size) {
+  return MakePointFrame(
+      size,
+      [](std::size_t i) {
+        return TestPoint{static_cast<float>(i) * 0.5F,
+                         static_cast<float>(i % 7) - 3.F,
+                         static_cast<float>(i % 11) * 0.25F,
+                         static_cast<std::uint16_t>(i % 128),
+                         AttributesOf(i),
+                         static_cast<std::uint16_t>(i % 1000),
+                         static_cast<std::int64_t>(i / 3 * 1000000000 + i % 3 * 1000)};
+      },
+      kTestPointRingIndices | kTestPointAttributes | kTestPointIntensities |
+          kTestPointTimestamps);
+}
+
+/// Returns the filters to test.
+std::vector<PointAttributeFilter> Filters() {
+  return {
+      PointAttributeFilter{},
+      PointAttributeFilter{}.Exclude(pb::PointAttribute::kGround),
+      PointAttributeFilter{}.Include(pb::PointAttribute::kOutOfRange),
+      PointAttributeFilter{}
+          .Include(pb::PointAttribute::kOutOfRange)
+          .Include(pb::PointAttribute::kLowIntensity)
+          .Exclude(pb::PointAttribute::kGround),
+      PointAttributeFilter{}.Exclude(pb::PointAttribute::kSparseNoise),
+  };
+}
+
+TEST(FilteredPointCloud, Empty) {
+  const FilteredPointCloud cloud;
+  EXPECT_TRUE(cloud.empty());
+  EXPECT_EQ(cloud.PaddedSize(), 0);
+  EXPECT_TRUE(cloud.x().empty());
+  EXPECT_TRUE(cloud.indices().empty());
+  EXPECT_TRUE(cloud.attributes().empty());
+  EXPECT_TRUE(cloud.timestamps().empty());
+}
+
+TEST(FilteredPointCloud, AllLevelsFilter) {
+  for (const SimdLevel level : SupportedSimdLevels()) {
+    for (const std::size_t size : {0, 1, 4, 7, 8, 13, 16, 100, 1001}) {
+      const pb::PointFrame frame{MakeFrame(size)};
+      const PointCloudView view{frame};
+      for (const PointAttributeFilter& filter : Filters()) {
+        SCOPED_TRACE(testing::Message()
+                     << "level " << static_cast<int>(level) << ", size " << size << ", filter "
+                     << filter.include_mask << "/" << filter.exclude_mask);
+        const FilteredPointCloud cloud{view, filter, level};
+
+        std::vector<std::uint32_t> expected;
+        for (std::size_t i{0}; i < size; ++i) {
+          if (filter.Keeps(AttributesOf(i))) {
+            expected.push_back(static_cast<std::uint32_t>(i));
+          }
+        }
+        EXPECT_EQ(CountPoints(view, filter, level), expected.size());
+        ASSERT_EQ(cloud.size(), expected.size());
+        ASSERT_EQ(cloud.indices().size(), expected.size());
+        ASSERT_EQ(cloud.attributes().size(), expected.size());
+        ASSERT_EQ(cloud.intensities().size(), expected.size());
+        ASSERT_EQ(cloud.ring_indices().size(), expected.size());
+        ASSERT_EQ(cloud.timestamps().size(), expected.size());
+        for (std::size_t k{0}; k < expected.size(); ++k) {
+          const std::uint32_t i{expected[k]};
+          EXPECT_EQ(cloud.indices()[k], i) << k;
+          EXPECT_EQ(cloud.x()[k], view.x()[i]) << k;
+          EXPECT_EQ(cloud.y()[k], view.y()[i]) << k;
+          EXPECT_EQ(cloud.z()[k], view.z()[i]) << k;
+          EXPECT_EQ(cloud.attributes()[k], AttributesOf(i)) << k;
+          EXPECT_EQ(cloud.intensities()[k], i % 1000) << k;
+          EXPECT_EQ(cloud.ring_indices()[k], i % 128) << k;
+          EXPECT_EQ(cloud.timestamps()[k], std::int64_t{i / 3} * 1000000000 + i % 3 * 1000) << k;
+        }
+
+        EXPECT_EQ(cloud.PaddedSize() % (kPointCloudAlignment / sizeof(float)), 0);
+        for (std::size_t k{cloud.size()}; k < cloud.PaddedSize(); ++k) {
+          EXPECT_EQ(cloud.z().data()[k], 0.F) << k;  // NOLINT(*-pointer-arithmetic)
+        }
+      }
+    }
+  }
+}
+
+TEST(FilteredPointCloud, MissingValues) {
+  pb::PointFrame frame{MakeFrame(10)};
+  frame.mutable_points().clear_attributes();
+  frame.mutable_points().clear_intensities();
+  frame.mutable_points().clear_timestamps();
+  const PointCloudView view{frame};
+
+  const FilteredPointCloud kept{view,
+                                PointAttributeFilter{}.Exclude(pb::PointAttribute::kGround)};
+  EXPECT_EQ(kept.size(), 10);
+  EXPECT_EQ(kept.indices()[9], 9);
+  EXPECT_EQ(kept.x()[9], view.x()[9]);
+  EXPECT_EQ(kept.ring_indices()[9], 9);
+  EXPECT_TRUE(kept.attributes().empty());
+  EXPECT_TRUE(kept.intensities().empty());
+  EXPECT_TRUE(kept.timestamps().empty());
+  EXPECT_EQ(CountPoints(view, PointAttributeFilter{}.Exclude(pb::PointAttribute::kGround)), 10);
+
+  const FilteredPointCloud dropped{view,
+                                   PointAttributeFilter{}.Include(pb::PointAttribute::kGround)};
+  EXPECT_TRUE(dropped.empty());
+  EXPECT_TRUE(dropped.x().empty());
+  EXPECT_EQ(CountPoints(view, PointAttributeFilter{}.Include(pb::PointAttribute::kGround)), 0);
+}
+
+TEST(FilteredPointCloud, AssignReusesBuffers) {
+  const pb::PointFrame frame{MakeFrame(100)};
+  const PointCloudView view{frame};
+  const PointAttributeFilter filter{PointAttributeFilter{}.Exclude(pb::PointAttribute::kGround)};
+  FilteredPointCloud cloud{view, filter};
+  const float* const x{cloud.x().data()};
+  const std::size_t size{cloud.size()};
+
+  cloud.Clear();
+  EXPECT_TRUE(cloud.empty());
+  EXPECT_TRUE(cloud.x().empty());
+
+  cloud.Assign(view, filter);
+  EXPECT_EQ(cloud.size(), size);
+  EXPECT_EQ(cloud.x().data(), x);
+
+  cloud.Assign(PointCloudView{}, filter);
+  EXPECT_TRUE(cloud.empty());
+  EXPECT_TRUE(cloud.timestamps().empty());
+}
+
+}  // namespace
+}  // namespace sdk
+}  // namespace horus
@@ -0,0 +1,331 @@
+#include "horus/sdk/point_transform.h"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include "horus/pb/config/metadata_pb.h"
+#include "horus/pb/unaligned_span.h"
+#include "horus/pointer/arithmetic.h"
+#include "horus/sdk/internal/compress_tables.h"
+#include "horus/sdk/internal/simd_dispatch.h"
+#include "horus/sdk/point_attribute_filter.h"
+#include "horus/sdk/point_cloud_view.h"
+#include "horus/sdk/simd.h"
+#include "horus/types/span.h"
+
+namespace horus {
+namespace sdk {
+namespace {
+
+/// The row-major 3x4 matrix of a `PointTransform`.
+using TransformMatrix = std::array<float, PointTransform::kMatrixSize>;
+
+/// Pointers to the coordinates read by a kernel.
+struct InputPoints {
+  /// The x coordinates.
+  const float* x;
+  /// The y coordinates.
+  const float* y;
+  /// The z coordinates.
+  const float* z;
+};
+
+/// Pointers to the coordinates written by a kernel, which may be the same as its `InputPoints`.
+struct OutputPoints {
+  /// The x coordinates.
+  float* x;
+  /// The y coordinates.
+  float* y;
+  /// The z coordinates.
+  float* z;
+};
+
+/// Transforms the points `[begin, end)` of `input` into `output`.
+void TransformScalar(const TransformMatrix& matrix, InputPoints input, std::size_t begin,
+                     std::size_t end, OutputPoints output) noexcept {
+  // See `TransformSse41()`.
+  const TransformMatrix m{matrix};
+  for (std::size_t i{begin}; i < end; ++i) {
+    const float x{*PointerAdd(input.x, i)};
+    const float y{*PointerAdd(input.y, i)};
+    const float z{*PointerAdd(input.z, i)};
+    *PointerAdd(output.x, i) = m[0] * x + m[1] * y + m[2] * z + m[3];
+    *PointerAdd(output.y, i) = m[4] * x + m[5] * y + m[6] * z + m[7];
+    *PointerAdd(output.z, i) = m[8] * x + m[9] * y + m[10] * z + m[11];
+  }
+}
+
+/// Transforms the points `[begin, end)` of `input` whose `attributes` are kept by `filter` and
+/// compacts them into `output` starting at `written`. Returns the new number of written points.
+std::size_t TransformFilterScalar(const TransformMatrix& matrix, InputPoints input,
+                                  const std::uint16_t* attributes,
+                                  const PointAttributeFilter& filter, std::size_t begin,
+                                  std::size_t end, OutputPoints output,
+                                  std::size_t written) noexcept {
+  // See `TransformSse41()`.
+  const TransformMatrix m{matrix};
+  for (std::size_t i{begin}; i < end; ++i) {
+    if (!filter.Keeps(*PointerAdd(attributes, i))) {
+      continue;
+    }
+    const float x{*PointerAdd(input.x, i)};
+    const float y{*PointerAdd(input.y, i)};
+    const float z{*PointerAdd(input.z, i)};
+    *PointerAdd(output.x, written) = m[0] * x + m[1] * y + m[2] * z + m[3];
+    *PointerAdd(output.y, written) = m[4] * x + m[5] * y + m[6] * z + m[7];
+    *PointerAdd(output.z, written) = m[8] * x + m[9] * y + m[10] * z + m[11];
+    ++written;
+  }
+  return written;
+}
+
+#if HORUS_SDK_SIMD_X86
+
+// NOLINTBEGIN(*-reinterpret-cast,*-pointer-arithmetic)
+
+/// Returns the coordinates on axis `row` of 4 points transformed by `m`, computed in the same order
+/// as `TransformScalar()`.
+__attribute__((target("sse4.1"))) inline __m128 TransformRowSse41(const TransformMatrix& m,
+                                                                  std::size_t row, __m128 x,
+                                                                  __m128 y, __m128 z) noexcept {
+  const float* const r{&m[4 * row]};
+  return _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(r[0]), x),
+                                          _mm_mul_ps(_mm_set1_ps(r[1]), y)),
+                               _mm_mul_ps(_mm_set1_ps(r[2]), z)),
+                    _mm_set1_ps(r[3]));
+}
+
+/// Returns the coordinates on axis `row` of 8 points transformed by `m`, computed in the same order
+/// as `TransformScalar()`.
+__attribute__((target("avx2"))) inline __m256 TransformRowAvx2(const TransformMatrix& m,
+                                                               std::size_t row, __m256 x, __m256 y,
+                                                               __m256 z) noexcept {
+  const float* const r{&m[4 * row]};
+  return _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(r[0]), x),
+                                                   _mm256_mul_ps(_mm256_set1_ps(r[1]), y)),
+                                     _mm256_mul_ps(_mm256_set1_ps(r[2]), z)),
+                       _mm256_set1_ps(r[3]));
+}
+
+/// Transforms the points of `input` into `output` 4 points at a time. Returns the number of
+/// transformed points.
+__attribute__((target("sse4.1"))) std::size_t TransformSse41(const TransformMatrix& matrix,
+                                                              InputPoints input, std::size_t size,
+                                                              OutputPoints output) noexcept {
+  // Copied since `output` may alias `matrix`, which would otherwise be reloaded after each store.
+  const TransformMatrix m{matrix};
+  std::size_t i{0};
+  for (; i + 4 <= size; i += 4) {
+    const __m128 x{_mm_loadu_ps(input.x + i)};
+    const __m128 y{_mm_loadu_ps(input.y + i)};
+    const __m128 z{_mm_loadu_ps(input.z + i)};
+    for (std::size_t row{0}; row < 3; ++row) {
+      const __m128 value{TransformRowSse41(m, row, x, y, z)};
+      float* const out{row == 0 ? output.x : row == 1 ? output.y : output.z};
+      _mm_storeu_ps(out + i, value);
+    }
+  }
+  return i;
+}
+
+/// Transforms the points of `input` into `output` 8 points at a time. Returns the number of
+/// transformed points.
+__attribute__((target("avx2"))) std::size_t TransformAvx2(const TransformMatrix& matrix,
+                                                           InputPoints input, std::size_t size,
+                                                           OutputPoints output) noexcept {
+  // See `TransformSse41()`.
+  const TransformMatrix m{matrix};
+  std::size_t i{0};
+  for (; i + 8 <= size; i += 8) {
+    const __m256 x{_mm256_loadu_ps(input.x + i)};
+    const __m256 y{_mm256_loadu_ps(input.y + i)};
+    const __m256 z{_mm256_loadu_ps(input.z + i)};
+    for (std::size_t row{0}; row < 3; ++row) {
+      const __m256 value{TransformRowAvx2(m, row, x, y, z)};
+      float* const out{row == 0 ? output.x : row == 1 ? output.y : output.z};
+      _mm256_storeu_ps(out + i, value);
+    }
+  }
+  return i;
+}
+
+/// Transforms the points of `input` whose `attributes` are kept by `filter` and compacts them at
+/// the beginning of `output`, 4 points at a time. Returns the number of processed points, and
+/// increments `written` by the number of written points.
+///
+/// All 4 lanes are stored at `output + written` before advancing `written` by the number of kept
+/// points, which never writes past the processed points.
+__attribute__((target("sse4.1"))) std::size_t TransformFilterSse41(
+    const TransformMatrix& matrix, InputPoints input, const std::uint16_t* attributes,
+    const PointAttributeFilter& filter, std::size_t size, OutputPoints output,
+    std::size_t& written) noexcept {
+  // See `TransformSse41()`.
+  const TransformMatrix m{matrix};
+  const horus_internal::CompressTables& tables{horus_internal::GetCompressTables()};
+  const __m128i zero{_mm_setzero_si128()};
+  const __m128i exclude{_mm_set1_epi32(filter.exclude_mask)};
+  const __m128i include{_mm_set1_epi32(filter.include_mask)};
+  // All ones iff points must have an included attribute.
+  const __m128i include_active{_mm_set1_epi32(filter.include_mask == 0 ? 0 : -1)};
+  std::size_t out{written};
+  std::size_t i{0};
+  for (; i + 4 <= size; i += 4) {
+    const __m128i attrs{
+        _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(attributes + i)))};
+    const __m128i not_included{
+        _mm_and_si128(_mm_cmpeq_epi32(_mm_and_si128(attrs, include), zero), include_active)};
+    const __m128i keep{
+        _mm_andnot_si128(not_included, _mm_cmpeq_epi32(_mm_and_si128(attrs, exclude), zero))};
+    const auto mask = static_cast<std::size_t>(_mm_movemask_ps(_mm_castsi128_ps(keep)));
+    const __m128i lanes{
+        _mm_load_si128(reinterpret_cast<const __m128i*>(tables.bytes4[mask].data()))};
+
+    const __m128 x{_mm_loadu_ps(input.x + i)};
+    const __m128 y{_mm_loadu_ps(input.y + i)};
+    const __m128 z{_mm_loadu_ps(input.z + i)};
+    for (std::size_t row{0}; row < 3; ++row) {
+      const __m128 value{TransformRowSse41(m, row, x, y, z)};
+      float* const out_axis{row == 0 ? output.x : row == 1 ? output.y : output.z};
+      _mm_storeu_ps(out_axis + out,
+                    _mm_castsi128_ps(_mm_shuffle_epi8(_mm_castps_si128(value), lanes)));
+    }
+    out += tables.counts[mask];
+  }
+  written = out;
+  return i;
+}
+
+/// Transforms the points of `input` whose `attributes` are kept by `filter` and compacts them at
+/// the beginning of `output`, 8 points at a time. Returns the number of processed points, and
+/// increments `written` by the number of written points.
+///
+/// See `TransformFilterSse41()`.
+__attribute__((target("avx2"))) std::size_t TransformFilterAvx2(
+    const TransformMatrix& matrix, InputPoints input, const std::uint16_t* attributes,
+    const PointAttributeFilter& filter, std::size_t size, OutputPoints output,
+    std::size_t& written) noexcept {
+  // See `TransformSse41()`.
+  const TransformMatrix m{matrix};
+  const horus_internal::CompressTables& tables{horus_internal::GetCompressTables()};
+  const __m256i zero{_mm256_setzero_si256()};
+  const __m256i exclude{_mm256_set1_epi32(filter.exclude_mask)};
+  const __m256i include{_mm256_set1_epi32(filter.include_mask)};
+  // All ones iff points must have an included attribute.
+  const __m256i include_active{_mm256_set1_epi32(filter.include_mask == 0 ? 0 : -1)};
+  std::size_t out{written};
+  std::size_t i{0};
+  for (; i + 8 <= size; i += 8) {
+    const __m256i attrs{
+        _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(attributes + i)))};
+    const __m256i not_included{_mm256_and_si256(
+        _mm256_cmpeq_epi32(_mm256_and_si256(attrs, include), zero), include_active)};
+    const __m256i keep{_mm256_andnot_si256(
+        not_included, _mm256_cmpeq_epi32(_mm256_and_si256(attrs, exclude), zero))};
+    const auto mask = static_cast<std::size_t>(_mm256_movemask_ps(_mm256_castsi256_ps(keep)));
+    const __m256i lanes{
+        _mm256_load_si256(reinterpret_cast<const __m256i*>(tables.lanes8[mask].data()))};
+
+    const __m256 x{_mm256_loadu_ps(input.x + i)};
+    const __m256 y{_mm256_loadu_ps(input.y + i)};
+    const __m256 z{_mm256_loadu_ps(input.z + i)};
+    for (std::size_t row{0}; row < 3; ++row) {
+      const __m256 value{TransformRowAvx2(m, row, x, y, z)};
+      float* const out_axis{row == 0 ? output.x : row == 1 ? output.y : output.z};
+      _mm256_storeu_ps(out_axis + out, _mm256_permutevar8x32_ps(value, lanes));
+    }
+    out += tables.counts[mask];
+  }
+  written = out;
+  return i;
+}
+
+// NOLINTEND(*-reinterpret-cast,*-pointer-arithmetic)
+
+#endif  // HORUS_SDK_SIMD_X86
+
+/// Transforms the first `size` points of `input` into `output` using `level`.
+void Transform(SimdLevel level, const TransformMatrix& m, InputPoints input, std::size_t size,
+               OutputPoints output) noexcept {
+  const std::size_t done{HORUS_SDK_SIMD_DISPATCH(level, TransformSse41(m, input, size, output),
+                                                 TransformAvx2(m, input, size, output))};
+  TransformScalar(m, input, done, size, output);
+}
+
+/// Returns the pointers to the coordinates of `view`.
+InputPoints InputPointsOf(const PointCloudView& view) noexcept {
+  return {view.x().data(), view.y().data(), view.z().data()};
+}
+
+}  // namespace
+
+PointTransform PointTransform::FromProto(const pb::AffineTransform3f& transform) {
+  const UnalignedSpan<float> data{transform.data().Span()};
+  // Eigen matrices are column-major, so the value at (row, column) is at `row + column * rows`.
+  std::size_t rows{0};
+  switch (data.size()) {
+    case 0:
+      return PointTransform{};
+    case 12:
+      rows = 3;
+      break;
+    case 16:
+      rows = 4;
+      break;
+    default:
+      throw std::invalid_argument{"invalid affine transform with " + std::to_string(data.size()) +
+                                  " values, expected 12 or 16"};
+  }
+  TransformMatrix matrix{};
+  for (std::size_t row{0}; row < 3; ++row) {
+    for (std::size_t column{0}; column < 4; ++column) {
+      matrix[row * 4 + column] = data[row + column * rows];
+    }
+  }
+  return PointTransform{matrix};
+}
+
+void TransformPointsInPlace(const PointTransform& transform, PointCloudView& view,
+                            SimdLevel level) noexcept {
+  Transform(level, transform.Matrix(), InputPointsOf(view), view.size(),
+            OutputPoints{view.mutable_x().data(), view.mutable_y().data(),
+                         view.mutable_z().data()});
+}
+
+void TransformPoints(const PointTransform& transform, const PointCloudView& view, Span<float> x,
+                     Span<float> y, Span<float> z, SimdLevel level) noexcept {
+  assert(x.size() >= view.size() && y.size() >= view.size() && z.size() >= view.size());
+  Transform(level, transform.Matrix(), InputPointsOf(view), view.size(),
+            OutputPoints{x.data(), y.data(), z.data()});
+}
+
+std::size_t TransformPoints(const PointTransform& transform, const PointCloudView& view,
+                            const PointAttributeFilter& filter, Span<float> x, Span<float> y,
+                            Span<float> z, SimdLevel level) noexcept {
+  assert(x.size() >= view.size() && y.size() >= view.size() && z.size() >= view.size());
+  const Span<const std::uint16_t> attributes{view.attributes()};
+  if (filter.KeepsAll() || (attributes.empty() && filter.Keeps(0))) {
+    TransformPoints(transform, view, x, y, z, level);
+    return view.size();
+  }
+  if (attributes.empty()) {
+    return 0;
+  }
+
+  const TransformMatrix& m{transform.Matrix()};
+  const InputPoints input{InputPointsOf(view)};
+  const OutputPoints output{x.data(), y.data(), z.data()};
+  std::size_t written{0};
+  const std::size_t done{HORUS_SDK_SIMD_DISPATCH(
+      level,
+      TransformFilterSse41(m, input, attributes.data(), filter, view.size(), output, written),
+      TransformFilterAvx2(m, input, attributes.data(), filter, view.size(), output, written))};
+  return TransformFilterScalar(m, input, attributes.data(), filter, done, view.size(), output,
+                               written);
+}
+
+}  // namespace sdk
+}  // namespace horus
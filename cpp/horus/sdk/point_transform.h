@@ -0,0 +1,81 @@
+/// @file
+///
+/// The `PointTransform` class and the kernels applying it to point clouds.
+
+#ifndef HORUS_SDK_POINT_TRANSFORM_H_
+#define HORUS_SDK_POINT_TRANSFORM_H_
+
+#include <array>
+#include <cstddef>
+
+#include "horus/pb/config/metadata_pb.h"
+#include "horus/pb/point/point_message_pb.h"
+#include "horus/sdk/point_attribute_filter.h"
+#include "horus/sdk/point_cloud_view.h"
+#include "horus/sdk/simd.h"
+#include "horus/types/span.h"
+
+namespace horus {
+namespace sdk {
+
+/// An affine transform of 3D points, e.g. the `calibration_transform` of a `pb::PointFrame` which
+/// maps the points of a lidar to world coordinates.
+class PointTransform final {
+ public:
+  /// Number of values in the matrix of the transform.
+  static constexpr std::size_t kMatrixSize{12};
+
+  /// Constructs the identity transform.
+  constexpr PointTransform() noexcept
+      : matrix_{{1.F, 0.F, 0.F, 0.F, 0.F, 1.F, 0.F, 0.F, 0.F, 0.F, 1.F, 0.F}} {}
+
+  /// Constructs a transform from a row-major 3x4 matrix `[R | t]`, which maps `p` to `R * p + t`.
+  explicit constexpr PointTransform(const std::array<float, kMatrixSize>& matrix) noexcept
+      : matrix_{matrix} {}
+
+  /// Returns the transform described by `transform`.
+  ///
+  /// `transform.data()` is expected to hold the values of an Eigen `Affine3f` (a column-major 4x4
+  /// matrix) or `AffineCompact3f` (a column-major 3x4 matrix). An empty `transform` is the
+  /// identity.
+  ///
+  /// @throws std::invalid_argument If `transform` holds another number of values.
+  static PointTransform FromProto(const pb::AffineTransform3f& transform) noexcept(false);
+
+  /// Returns the `calibration_transform` of `frame`.
+  ///
+  /// @throws std::invalid_argument If the transform is invalid (see `FromProto()`).
+  static PointTransform FromFrame(const pb::PointFrame& frame) noexcept(false) {
+    return FromProto(frame.header().calibration_transform());
+  }
+
+  /// Returns the row-major 3x4 matrix `[R | t]` of the transform.
+  constexpr const std::array<float, kMatrixSize>& Matrix() const noexcept { return matrix_; }
+
+ private:
+  /// @see Matrix()
+  std::array<float, kMatrixSize> matrix_;
+};
+
+/// Applies `transform` to the points of `view`, modifying its coordinates.
+void TransformPointsInPlace(const PointTransform& transform, PointCloudView& view,
+                            SimdLevel level = BestSimdLevel()) noexcept;
+
+/// Writes the coordinates of the points of `view` transformed by `transform` to `x`, `y` and `z`,
+/// which must hold at least `view.size()` values.
+void TransformPoints(const PointTransform& transform, const PointCloudView& view, Span<float> x,
+                     Span<float> y, Span<float> z, SimdLevel level = BestSimdLevel()) noexcept;
+
+/// Writes the coordinates of the points of `view` kept by `filter` and transformed by `transform`
+/// to the beginning of `x`, `y` and `z`, which must hold at least `view.size()` values. Returns the
+/// number of written points.
+///
+/// If `view` has no attributes, the attributes of all its points are `kAttributeNone`.
+std::size_t TransformPoints(const PointTransform& transform, const PointCloudView& view,
+                            const PointAttributeFilter& filter, Span<float> x, Span<float> y,
+                            Span<float> z, SimdLevel level = BestSimdLevel()) noexcept;
+
+}  // namespace sdk
+}  // namespace horus
+
+#endif  // HORUS_SDK_POINT_TRANSFORM_H_
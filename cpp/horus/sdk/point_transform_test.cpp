@@ -0,0 +1,162 @@
+#include "horus/sdk/point_transform.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "horus/pb/config/metadata_pb.h"
+#include "horus/pb/point/point_message_pb.h"
+#include "horus/sdk/point_attribute_filter.h"
+#include "horus/sdk/point_cloud_view.h"
+#include "horus/sdk/simd.h"
+#include "horus/testing/point_clouds.h"
+
+namespace horus {
+namespace sdk {
+namespace {
+
+/// A rotation of 90 degrees around z followed by a translation of (1, 2, 3).
+constexpr std::array<float, 12> kMatrix{
+    {0.F, -1.F, 0.F, 1.F, 1.F, 0.F, 0.F, 2.F, 0.F, 0.F, 1.F, 3.F}};
+
+/// Returns a frame with `size` points whose attribute is `i % 8` for point `i`.
+pb::PointFrame MakeFrame(std::size_t size) {
+  return MakePointFrame(
+      size,
+      [](std::size_t i) {
+        TestPoint point;
+        point.x = static_cast<float>(i) * 0.5F;
+        point.y = static_cast<float>(i % 7) - 3.F;
+        point.z = static_cast<float>(i % 11) * 0.25F;
+        point.attributes = static_cast<std::uint16_t>(i % 8);
+        return point;
+      },
+      kTestPointAttributes);
+}
+
+/// Expects the point at `index` in `x`, `y` and `z` to be the point at `source_index` in `view`
+/// transformed by `kMatrix`.
+void ExpectTransformed(const PointCloudView& view, std::size_t source_index,
+                       const std::vector<float>& x, const std::vector<float>& y,
+                       const std::vector<float>& z, std::size_t index) {
+  EXPECT_FLOAT_EQ(x[index], 1.F - view.y()[source_index]) << index;
+  EXPECT_FLOAT_EQ(y[index], 2.F + view.x()[source_index]) << index;
+  EXPECT_FLOAT_EQ(z[index], 3.F + view.z()[source_index]) << index;
+}
+
+TEST(PointTransform, FromProto) {
+  EXPECT_EQ(PointTransform::FromProto(pb::AffineTransform3f{}).Matrix(), PointTransform{}.Matrix());
+
+  // Column-major 4x4 matrix, as stored by `Eigen::Affine3f`.
+  pb::AffineTransform3f affine;
+  affine.mutable_data().Vector() = {0.F, 1.F, 0.F, 0.F, -1.F, 0.F, 0.F, 0.F,
+                                    0.F, 0.F, 1.F, 0.F, 1.F,  2.F, 3.F, 1.F};
+  EXPECT_EQ(PointTransform::FromProto(affine).Matrix(), kMatrix);
+
+  // Column-major 3x4 matrix, as stored by `Eigen::AffineCompact3f`.
+  pb::AffineTransform3f compact;
+  compact.mutable_data().Vector() = {0.F, 1.F, 0.F, -1.F, 0.F, 0.F, 0.F, 0.F, 1.F, 1.F, 2.F, 3.F};
+  EXPECT_EQ(PointTransform::FromProto(compact).Matrix(), kMatrix);
+
+  pb::AffineTransform3f invalid;
+  invalid.mutable_data().Vector() = {1.F, 2.F, 3.F};
+  EXPECT_THROW(static_cast<void>(PointTransform::FromProto(invalid)), std::invalid_argument);
+
+  pb::PointFrame frame;
+  frame.mutable_header().set_calibration_transform(std::move(affine));
+  EXPECT_EQ(PointTransform::FromFrame(frame).Matrix(), kMatrix);
+}
+
+TEST(PointTransform, AllLevelsTransform) {
+  const PointTransform transform{kMatrix};
+  for (const SimdLevel level : SupportedSimdLevels()) {
+    for (const std::size_t size : {0, 1, 4, 7, 8, 15, 100, 1001}) {
+      SCOPED_TRACE(testing::Message() << "level " << static_cast<int>(level) << ", size " << size);
+      const pb::PointFrame frame{MakeFrame(size)};
+      const PointCloudView view{frame};
+      std::vector<float> x(size);
+      std::vector<float> y(size);
+      std::vector<float> z(size);
+      TransformPoints(transform, view, x, y, z, level);
+      for (std::size_t i{0}; i < size; ++i) {
+        ExpectTransformed(view, i, x, y, z, i);
+      }
+
+      PointCloudView in_place{frame};
+      TransformPointsInPlace(transform, in_place, level);
+      for (std::size_t i{0}; i < size; ++i) {
+        EXPECT_EQ(in_place.x()[i], x[i]) << i;
+        EXPECT_EQ(in_place.y()[i], y[i]) << i;
+        EXPECT_EQ(in_place.z()[i], z[i]) << i;
+      }
+      for (std::size_t i{size}; i < in_place.PaddedSize(); ++i) {
+        EXPECT_EQ(in_place.x().data()[i], 0.F) << i;  // NOLINT(*-pointer-arithmetic)
+      }
+    }
+  }
+}
+
+TEST(PointTransform, AllLevelsTransformAndFilter) {
+  const PointTransform transform{kMatrix};
+  const std::vector<PointAttributeFilter> filters{
+      PointAttributeFilter{},
+      PointAttributeFilter{}.Exclude(pb::PointAttribute::kGround),
+      PointAttributeFilter{}.Include(pb::PointAttribute::kOutOfRange),
+      PointAttributeFilter{}
+          .Include(pb::PointAttribute::kOutOfRange)
+          .Include(pb::PointAttribute::kLowIntensity)
+          .Exclude(pb::PointAttribute::kGround),
+      PointAttributeFilter{}.Exclude(pb::PointAttribute::kSparseNoise),
+  };
+  for (const SimdLevel level : SupportedSimdLevels()) {
+    for (const std::size_t size : {1, 5, 8, 13, 100, 1001}) {
+      for (const PointAttributeFilter& filter : filters) {
+        SCOPED_TRACE(testing::Message()
+                     << "level " << static_cast<int>(level) << ", size " << size << ", filter "
+                     << filter.include_mask << "/" << filter.exclude_mask);
+        const pb::PointFrame frame{MakeFrame(size)};
+        const PointCloudView view{frame};
+        std::vector<float> x(size);
+        std::vector<float> y(size);
+        std::vector<float> z(size);
+        const std::size_t written{TransformPoints(transform, view, filter, x, y, z, level)};
+
+        std::size_t expected{0};
+        for (std::size_t i{0}; i < size; ++i) {
+          if (filter.Keeps(static_cast<std::uint16_t>(i % 8))) {
+            ASSERT_LT(expected, written);
+            ExpectTransformed(view, i, x, y, z, expected);
+            ++expected;
+          }
+        }
+        EXPECT_EQ(written, expected);
+      }
+    }
+  }
+}
+
+TEST(PointTransform, FilterWithoutAttributes) {
+  pb::PointFrame frame{MakeFrame(10)};
+  frame.mutable_points().clear_attributes();
+  const PointCloudView view{frame};
+  std::vector<float> x(10);
+  std::vector<float> y(10);
+  std::vector<float> z(10);
+
+  EXPECT_EQ(TransformPoints(PointTransform{}, view,
+                            PointAttributeFilter{}.Exclude(pb::PointAttribute::kGround), x, y, z),
+            10);
+  EXPECT_EQ(x[9], view.x()[9]);
+  EXPECT_EQ(TransformPoints(PointTransform{}, view,
+                            PointAttributeFilter{}.Include(pb::PointAttribute::kGround), x, y, z),
+            0);
+}
+
+}  // namespace
+}  // namespace sdk
+}  // namespace horus
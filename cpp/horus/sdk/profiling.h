@@ -14,6 +14,7 @@
 
 #include "horus/attributes.h"
 #include "horus/pb/profiling_pb.h"
+#include "horus/sdk/event_ring.h"
 #include "horus/types/one_of.h"
 
 namespace horus {
@@ -264,6 +265,10 @@ class ProfilingInfo final {
 struct ProfilingSubscriptionRequest {
   /// Function to call when profiling information is received.
   std::function<void(pb::ProfilingInfo&&)> on_profiling_info;
+
+  /// If non-null, received profiling information is pushed to this ring to be polled by the user
+  /// instead of being passed to `on_profiling_info`.
+  std::shared_ptr<EventRing<pb::ProfilingInfo>> event_ring{nullptr};
 };
 
 }  // namespace sdk
@@ -0,0 +1,271 @@
+#include "horus/sdk/ring_point_cloud.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+
+#include "horus/pointer/arithmetic.h"
+#include "horus/sdk/internal/simd_dispatch.h"
+#include "horus/sdk/point_cloud_view.h"
+#include "horus/sdk/simd.h"
+#include "horus/types/span.h"
+
+namespace horus {
+namespace sdk {
+namespace {
+
+/// Pi, as a float.
+constexpr float kPi{3.14159265F};
+/// Pi / 2, as a float.
+constexpr float kHalfPi{1.57079633F};
+
+/// Coefficients of the odd minimax polynomial approximating `atan(a)` for `a` in `[0, 1]`, within
+/// 1e-5 radians.
+constexpr float kAtan1{0.99997726F};
+/// @see kAtan1
+constexpr float kAtan3{-0.33262347F};
+/// @see kAtan1
+constexpr float kAtan5{0.19354346F};
+/// @see kAtan1
+constexpr float kAtan7{-0.11643287F};
+/// @see kAtan1
+constexpr float kAtan9{0.05265332F};
+/// @see kAtan1
+constexpr float kAtan11{-0.01172120F};
+
+/// Lower bound of the denominator of the ratio given to the polynomial, so that the ratio of the
+/// coordinates of the origin is zero rather than NaN.
+constexpr float kMinDenominator{std::numeric_limits<float>::min()};
+
+/// Pointers to the arrays read and written when computing ranges and azimuths.
+struct PolarPoints {
+  /// The x coordinates.
+  const float* x;
+  /// The y coordinates.
+  const float* y;
+  /// The z coordinates.
+  const float* z;
+  /// The computed ranges.
+  float* ranges;
+  /// The computed azimuths.
+  float* azimuths;
+};
+
+/// Computes the ranges and azimuths of the points `[begin, end)` of `points`.
+///
+/// Each SIMD kernel performs the same operations in the same order, so that all instruction sets
+/// compute the same values.
+void PolarScalar(PolarPoints points, std::size_t begin, std::size_t end) noexcept {
+  for (std::size_t i{begin}; i < end; ++i) {
+    const float x{*PointerAdd(points.x, i)};
+    const float y{*PointerAdd(points.y, i)};
+    const float z{*PointerAdd(points.z, i)};
+    *PointerAdd(points.ranges, i) = std::sqrt(x * x + y * y + z * z);
+
+    // atan2(y, x) is computed from atan(min / max) of the absolute coordinates in [0, pi / 4],
+    // then moved to the octant of the point.
+    const float ax{std::fabs(x)};
+    const float ay{std::fabs(y)};
+    const float a{std::min(ay, ax) / std::max(kMinDenominator, std::max(ay, ax))};
+    const float s{a * a};
+    float r{(((((kAtan11 * s + kAtan9) * s + kAtan7) * s + kAtan5) * s + kAtan3) * s + kAtan1) *
+            a};
+    if (ay > ax) {
+      r = kHalfPi - r;
+    }
+    if (x < 0.F) {
+      r = kPi - r;
+    }
+    *PointerAdd(points.azimuths, i) = std::copysign(r, y);
+  }
+}
+
+#if HORUS_SDK_SIMD_X86
+
+// NOLINTBEGIN(*-reinterpret-cast,*-pointer-arithmetic)
+
+/// Computes the ranges and azimuths of the first `size` points of `points` 4 points at a time.
+/// Returns the number of processed points.
+__attribute__((target("sse4.1"))) std::size_t PolarSse41(PolarPoints points,
+                                                          std::size_t size) noexcept {
+  // See `PolarScalar()`.
+  const __m128 sign{_mm_set1_ps(-0.F)};
+  const __m128 zero{_mm_setzero_ps()};
+  const __m128 min_denominator{_mm_set1_ps(kMinDenominator)};
+  std::size_t i{0};
+  for (; i + 4 <= size; i += 4) {
+    const __m128 x{_mm_loadu_ps(points.x + i)};
+    const __m128 y{_mm_loadu_ps(points.y + i)};
+    const __m128 z{_mm_loadu_ps(points.z + i)};
+    _mm_storeu_ps(points.ranges + i,
+                  _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)),
+                                         _mm_mul_ps(z, z))));
+
+    const __m128 ax{_mm_andnot_ps(sign, x)};
+    const __m128 ay{_mm_andnot_ps(sign, y)};
+    const __m128 a{_mm_div_ps(_mm_min_ps(ay, ax), _mm_max_ps(min_denominator, _mm_max_ps(ay, ax)))};
+    const __m128 s{_mm_mul_ps(a, a)};
+    __m128 r{_mm_add_ps(_mm_mul_ps(_mm_set1_ps(kAtan11), s), _mm_set1_ps(kAtan9))};
+    for (const float coefficient : {kAtan7, kAtan5, kAtan3, kAtan1}) {
+      r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(coefficient));
+    }
+    r = _mm_mul_ps(r, a);
+    r = _mm_blendv_ps(r, _mm_sub_ps(_mm_set1_ps(kHalfPi), r), _mm_cmpgt_ps(ay, ax));
+    r = _mm_blendv_ps(r, _mm_sub_ps(_mm_set1_ps(kPi), r), _mm_cmplt_ps(x, zero));
+    _mm_storeu_ps(points.azimuths + i, _mm_xor_ps(r, _mm_and_ps(sign, y)));
+  }
+  return i;
+}
+
+/// Computes the ranges and azimuths of the first `size` points of `points` 8 points at a time.
+/// Returns the number of processed points.
+__attribute__((target("avx2"))) std::size_t PolarAvx2(PolarPoints points,
+                                                       std::size_t size) noexcept {
+  // See `PolarScalar()`.
+  const __m256 sign{_mm256_set1_ps(-0.F)};
+  const __m256 zero{_mm256_setzero_ps()};
+  const __m256 min_denominator{_mm256_set1_ps(kMinDenominator)};
+  std::size_t i{0};
+  for (; i + 8 <= size; i += 8) {
+    const __m256 x{_mm256_loadu_ps(points.x + i)};
+    const __m256 y{_mm256_loadu_ps(points.y + i)};
+    const __m256 z{_mm256_loadu_ps(points.z + i)};
+    _mm256_storeu_ps(
+        points.ranges + i,
+        _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)),
+                                     _mm256_mul_ps(z, z))));
+
+    const __m256 ax{_mm256_andnot_ps(sign, x)};
+    const __m256 ay{_mm256_andnot_ps(sign, y)};
+    const __m256 a{_mm256_div_ps(_mm256_min_ps(ay, ax),
+                                 _mm256_max_ps(min_denominator, _mm256_max_ps(ay, ax)))};
+    const __m256 s{_mm256_mul_ps(a, a)};
+    __m256 r{_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(kAtan11), s), _mm256_set1_ps(kAtan9))};
+    for (const float coefficient : {kAtan7, kAtan5, kAtan3, kAtan1}) {
+      r = _mm256_add_ps(_mm256_mul_ps(r, s), _mm256_set1_ps(coefficient));
+    }
+    r = _mm256_mul_ps(r, a);
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(kHalfPi), r),
+                         _mm256_cmp_ps(ay, ax, _CMP_GT_OQ));
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(kPi), r),
+                         _mm256_cmp_ps(x, zero, _CMP_LT_OQ));
+    _mm256_storeu_ps(points.azimuths + i, _mm256_xor_ps(r, _mm256_and_ps(sign, y)));
+  }
+  return i;
+}
+
+// NOLINTEND(*-reinterpret-cast,*-pointer-arithmetic)
+
+#endif  // HORUS_SDK_SIMD_X86
+
+/// Computes the ranges and azimuths of the first `size` points of `points` using `level`.
+void Polar(SimdLevel level, PolarPoints points, std::size_t size) noexcept {
+  const std::size_t done{
+      HORUS_SDK_SIMD_DISPATCH(level, PolarSse41(points, size), PolarAvx2(points, size))};
+  PolarScalar(points, done, size);
+}
+
+}  // namespace
+
+constexpr std::uint32_t RingPointCloud::kNoPoint;
+constexpr std::size_t RingPointCloud::kMaxRingCount;
+
+void RingPointCloud::Assign(const PointCloudView& view, std::size_t azimuth_bins,
+                            SimdLevel level) {
+  Clear();
+  const Span<const std::uint16_t> rings{view.ring_indices()};
+  if (!view.empty() && rings.empty()) {
+    throw std::invalid_argument{"cannot organize points without ring indices"};
+  }
+  const std::size_t ring_count{
+      rings.empty() ? 0 : std::size_t{*std::max_element(rings.begin(), rings.end())} + 1};
+  if (ring_count > kMaxRingCount) {
+    // Ring indices come from the network: a corrupt index would otherwise make the range image
+    // huge.
+    throw std::invalid_argument{"ring index out of range"};
+  }
+  size_ = view.size();
+  padded_size_ = view.PaddedSize();
+  azimuth_bins_ = azimuth_bins;
+  if (size_ == 0) {
+    return;
+  }
+
+  // Count the points of each ring, then place each point after the previous points of its ring.
+  ring_count_ = ring_count;
+  ring_offsets_size_ = ring_count_ + 1;
+  ring_offsets_.assign(ring_offsets_size_, 0);
+  for (const std::uint16_t ring : rings) {
+    ++ring_offsets_[std::size_t{ring} + 1];
+  }
+  for (std::size_t ring{0}; ring < ring_count_; ++ring) {
+    ring_offsets_[ring + 1] += ring_offsets_[ring];
+  }
+  ring_cursors_.assign(ring_offsets_.begin(), ring_offsets_.end() - 1);
+
+  float* const x{values_.Resize(5 * padded_size_, kPointCloudAlignment)};
+  float* const y{PointerAdd(x, padded_size_)};
+  float* const z{PointerAdd(y, padded_size_)};
+  std::uint32_t* const indices{indices_.Resize(size_, kPointCloudAlignment)};
+  const float* const view_x{view.x().data()};
+  const float* const view_y{view.y().data()};
+  const float* const view_z{view.z().data()};
+  for (std::size_t i{0}; i < size_; ++i) {
+    const std::size_t out{ring_cursors_[rings[i]]++};
+    *PointerAdd(x, out) = *PointerAdd(view_x, i);
+    *PointerAdd(y, out) = *PointerAdd(view_y, i);
+    *PointerAdd(z, out) = *PointerAdd(view_z, i);
+    *PointerAdd(indices, out) = static_cast<std::uint32_t>(i);
+  }
+  for (float* const axis : {x, y, z}) {
+    std::fill(PointerAdd(axis, size_), PointerAdd(axis, padded_size_), 0.F);
+  }
+
+  // The padding is zero, so the kernels process it as well (and write zero ranges and azimuths).
+  float* const ranges{PointerAdd(z, padded_size_)};
+  float* const azimuths{PointerAdd(ranges, padded_size_)};
+  Polar(level, PolarPoints{x, y, z, ranges, azimuths}, padded_size_);
+
+  if (azimuth_bins_ == 0) {
+    return;
+  }
+  range_image_size_ = ring_count_ * azimuth_bins_;
+  float* const image{range_image_.Resize(range_image_size_, kPointCloudAlignment)};
+  std::uint32_t* const image_points{
+      range_image_points_.Resize(range_image_size_, kPointCloudAlignment)};
+  std::fill_n(image, range_image_size_, 0.F);
+  std::fill_n(image_points, range_image_size_, kNoPoint);
+  const float columns_per_radian{static_cast<float>(azimuth_bins_) / (2.F * kPi)};
+  for (std::size_t ring{0}; ring < ring_count_; ++ring) {
+    float* const row{PointerAdd(image, ring * azimuth_bins_)};
+    std::uint32_t* const row_points{PointerAdd(image_points, ring * azimuth_bins_)};
+    for (std::size_t i{ring_offsets_[ring]}; i < ring_offsets_[ring + 1]; ++i) {
+      const float range{*PointerAdd(ranges, i)};
+      const float column{(*PointerAdd(azimuths, i) + kPi) * columns_per_radian};
+      if (!(range > 0.F) || !std::isfinite(range) || !(column >= 0.F)) {
+        continue;  // Invalid point.
+      }
+      const std::size_t cell{std::min(static_cast<std::size_t>(column), azimuth_bins_ - 1)};
+      if (*PointerAdd(row_points, cell) == kNoPoint || range < *PointerAdd(row, cell)) {
+        *PointerAdd(row, cell) = range;
+        *PointerAdd(row_points, cell) = static_cast<std::uint32_t>(i);
+      }
+    }
+  }
+}
+
+void RingPointCloud::Clear() noexcept {
+  size_ = 0;
+  padded_size_ = 0;
+  ring_count_ = 0;
+  ring_offsets_size_ = 0;
+  azimuth_bins_ = 0;
+  range_image_size_ = 0;
+}
+
+}  // namespace sdk
+}  // namespace horus
@@ -0,0 +1,177 @@
+/// @file
+///
+/// The `RingPointCloud` class.
+
+#ifndef HORUS_SDK_RING_POINT_CLOUD_H_
+#define HORUS_SDK_RING_POINT_CLOUD_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "horus/attributes.h"
+#include "horus/pointer/arithmetic.h"
+#include "horus/sdk/internal/aligned_buffer.h"
+#include "horus/sdk/point_cloud_view.h"
+#include "horus/sdk/simd.h"
+#include "horus/types/span.h"
+
+namespace horus {
+namespace sdk {
+
+/// The points of a `PointCloudView` organized by lidar ring (i.e. scanline), and optionally binned
+/// by azimuth into a range image.
+///
+/// The points are grouped by their `ring_indices()` with a stable counting sort, so that the points
+/// of each ring are contiguous and remain in frame (i.e. firing) order. Their coordinates, ranges
+/// and azimuths are stored in structure-of-arrays buffers aligned and padded as in
+/// `PointCloudView`, the ranges and azimuths being computed with SIMD instructions.
+///
+/// The range image has a row per ring and `azimuth_bins` columns covering `[-pi, pi)` radians of
+/// azimuth (counter-clockwise from the x axis of the lidar). Each cell refers to the nearest point
+/// of its ring in its azimuth range.
+///
+/// A `RingPointCloud` owns its values, and reuses its buffers when assigned new points.
+class RingPointCloud final {
+ public:
+  /// Value of `range_image_points()` for cells without points.
+  static constexpr std::uint32_t kNoPoint{~std::uint32_t{0}};
+  /// The maximum number of rings of a cloud, well above the number of rings of any lidar.
+  static constexpr std::size_t kMaxRingCount{1024};
+
+  /// Constructs an empty cloud.
+  RingPointCloud() noexcept = default;
+
+  /// Constructs the cloud of the points of `view` (see `Assign()`).
+  ///
+  /// @throws std::invalid_argument If `view` has points but no ring indices, or a ring index is
+  /// not less than `kMaxRingCount`.
+  /// @throws std::bad_alloc If the buffers of the cloud cannot be allocated.
+  explicit RingPointCloud(const PointCloudView& view, std::size_t azimuth_bins = 0,
+                          SimdLevel level = BestSimdLevel()) noexcept(false) {
+    Assign(view, azimuth_bins, level);
+  }
+
+  /// Clouds cannot be copied.
+  RingPointCloud(const RingPointCloud&) = delete;
+  /// Clouds cannot be copied.
+  RingPointCloud& operator=(const RingPointCloud&) = delete;
+  /// Move constructor.
+  RingPointCloud(RingPointCloud&&) noexcept = default;
+  /// Move assignment operator.
+  RingPointCloud& operator=(RingPointCloud&&) noexcept = default;
+
+  /// Destroys the cloud.
+  ~RingPointCloud() noexcept = default;
+
+  /// Replaces the contents of the cloud by the points of `view` organized by ring, reusing the
+  /// buffers of the cloud. If `azimuth_bins` is not zero, also builds a range image with that many
+  /// columns. Ranges and azimuths are computed with the given instruction set, which must be
+  /// supported by the CPU.
+  ///
+  /// The coordinates of `view` are expected to be in the frame of the lidar, i.e. not transformed
+  /// by its `calibration_transform`.
+  ///
+  /// @throws std::invalid_argument If `view` has points but no ring indices, or a ring index is
+  /// not less than `kMaxRingCount`.
+  /// @throws std::bad_alloc If the buffers of the cloud cannot be allocated.
+  void Assign(const PointCloudView& view, std::size_t azimuth_bins = 0,
+              SimdLevel level = BestSimdLevel()) noexcept(false);
+
+  /// Empties the cloud, keeping its buffers.
+  void Clear() noexcept;
+
+  /// Returns the number of points.
+  std::size_t size() const noexcept { return size_; }
+  /// Returns whether `size() == 0`.
+  bool empty() const noexcept { return size_ == 0; }
+
+  /// Returns `size()` rounded up to a multiple of `kPointCloudAlignment / sizeof(float)`.
+  ///
+  /// `x()`, `y()`, `z()`, `ranges()` and `azimuths()` may be read up to `PaddedSize()` values; the
+  /// padding values are zero.
+  std::size_t PaddedSize() const noexcept { return padded_size_; }
+
+  /// Returns the number of rings, i.e. the largest ring index plus one (or zero if empty).
+  std::size_t ring_count() const noexcept { return ring_count_; }
+
+  /// Returns the index of the first point of each ring, followed by `size()`: the points of ring
+  /// `r` are `[ring_offsets()[r], ring_offsets()[r + 1])`. Empty if the cloud is empty.
+  Span<const std::uint32_t> ring_offsets() const noexcept HORUS_LIFETIME_BOUND {
+    return {ring_offsets_.data(), ring_offsets_size_};
+  }
+
+  /// Returns the index in the view of each point.
+  Span<const std::uint32_t> indices() const noexcept HORUS_LIFETIME_BOUND {
+    return {indices_.data(), size_};
+  }
+
+  /// Returns the x coordinates of the points, aligned to `kPointCloudAlignment`.
+  Span<const float> x() const noexcept HORUS_LIFETIME_BOUND { return Values(0); }
+  /// Returns the y coordinates of the points, aligned to `kPointCloudAlignment`.
+  Span<const float> y() const noexcept HORUS_LIFETIME_BOUND { return Values(1); }
+  /// Returns the z coordinates of the points, aligned to `kPointCloudAlignment`.
+  Span<const float> z() const noexcept HORUS_LIFETIME_BOUND { return Values(2); }
+  /// Returns the distance of the points to the lidar, aligned to `kPointCloudAlignment`.
+  Span<const float> ranges() const noexcept HORUS_LIFETIME_BOUND { return Values(3); }
+
+  /// Returns the azimuth of the points in `[-pi, pi]` radians, counter-clockwise from the x axis,
+  /// aligned to `kPointCloudAlignment`.
+  ///
+  /// Azimuths are approximated within 1e-5 radians.
+  Span<const float> azimuths() const noexcept HORUS_LIFETIME_BOUND { return Values(4); }
+
+  /// Returns the number of columns of the range image, or zero if it was not built.
+  std::size_t azimuth_bins() const noexcept { return azimuth_bins_; }
+
+  /// Returns the row-major range image of `ring_count()` rows and `azimuth_bins()` columns: the
+  /// range of the point of each cell, or zero for cells without points.
+  Span<const float> range_image() const noexcept HORUS_LIFETIME_BOUND {
+    return {range_image_.data(), range_image_size_};
+  }
+
+  /// Returns the index (in this cloud) of the point of each cell of `range_image()`, or `kNoPoint`.
+  Span<const std::uint32_t> range_image_points() const noexcept HORUS_LIFETIME_BOUND {
+    return {range_image_points_.data(), range_image_size_};
+  }
+
+ private:
+  /// Returns the values of the given array (0 to 2 for x to z, 3 for ranges and 4 for azimuths).
+  Span<const float> Values(std::size_t array) const noexcept {
+    if (size_ == 0) {
+      return {};
+    }
+    return {PointerAdd(values_.data(), array * padded_size_), size_};
+  }
+
+  /// Number of points.
+  std::size_t size_{0};
+  /// @see PaddedSize()
+  std::size_t padded_size_{0};
+  /// @see ring_count()
+  std::size_t ring_count_{0};
+  /// Number of values in `ring_offsets()`.
+  std::size_t ring_offsets_size_{0};
+  /// @see azimuth_bins()
+  std::size_t azimuth_bins_{0};
+  /// Number of cells in the range image.
+  std::size_t range_image_size_{0};
+  /// The x, y and z coordinates, ranges and azimuths of the points, each padded to `padded_size_`
+  /// values.
+  horus_internal::AlignedBuffer<float> values_;
+  /// @see indices()
+  horus_internal::AlignedBuffer<std::uint32_t> indices_;
+  /// @see ring_offsets()
+  std::vector<std::uint32_t> ring_offsets_;
+  /// The index of the next point of each ring while sorting points.
+  std::vector<std::uint32_t> ring_cursors_;
+  /// @see range_image()
+  horus_internal::AlignedBuffer<float> range_image_;
+  /// @see range_image_points()
+  horus_internal::AlignedBuffer<std::uint32_t> range_image_points_;
+};
+
+}  // namespace sdk
+}  // namespace horus
+
+#endif  // HORUS_SDK_RING_POINT_CLOUD_H_
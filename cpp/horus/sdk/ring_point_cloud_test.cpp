@@ -0,0 +1,195 @@
+#include "horus/sdk/ring_point_cloud.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "horus/pb/point/point_message_pb.h"
+#include "horus/sdk/point_cloud_view.h"
+#include "horus/sdk/simd.h"
+#include "horus/testing/point_clouds.h"
+
+namespace horus {
+namespace sdk {
+namespace {
+
+/// Returns a frame with the given points and their ring indices.
+pb::PointFrame MakeFrame(const std::vector<TestPoint>& test_points) {
+  return MakePointFrame(test_points, kTestPointRingIndices);
+}
+
+/// Returns points on 16 rings, with 360 points per ring going around the lidar.
+std::vector<TestPoint> MakeScan() {
+  std::vector<TestPoint> points;
+  for (std::size_t step{0}; step < 360; ++step) {
+    const double azimuth{static_cast<double>(step) * 3.14159265358979 / 180. + 0.001};
+    for (std::uint16_t ring{0}; ring < 16; ++ring) {
+      const double range{10. + ring + static_cast<double>(step % 7)};
+      points.push_back({static_cast<float>(range * std::cos(azimuth)),
+                        static_cast<float>(range * std::sin(azimuth)),
+                        static_cast<float>(ring) - 8.F, ring});
+    }
+  }
+  return points;
+}
+
+TEST(RingPointCloud, Empty) {
+  RingPointCloud cloud;
+  EXPECT_TRUE(cloud.empty());
+  EXPECT_EQ(cloud.ring_count(), 0);
+  EXPECT_TRUE(cloud.ring_offsets().empty());
+  EXPECT_TRUE(cloud.x().empty());
+  EXPECT_TRUE(cloud.range_image().empty());
+
+  cloud.Assign(PointCloudView{}, /*azimuth_bins=*/16);
+  EXPECT_TRUE(cloud.empty());
+  EXPECT_TRUE(cloud.range_image().empty());
+}
+
+TEST(RingPointCloud, GroupsPointsByRing) {
+  const pb::PointFrame frame{MakeFrame({
+      {1.F, 0.F, 0.F, 2},
+      {2.F, 0.F, 0.F, 0},
+      {3.F, 0.F, 0.F, 2},
+      {4.F, 0.F, 0.F, 3},
+      {5.F, 0.F, 0.F, 0},
+  })};
+  const RingPointCloud cloud{PointCloudView{frame}};
+  ASSERT_EQ(cloud.size(), 5);
+  EXPECT_EQ(cloud.ring_count(), 4);
+  EXPECT_EQ(std::vector<std::uint32_t>(cloud.ring_offsets().begin(), cloud.ring_offsets().end()),
+            (std::vector<std::uint32_t>{0, 2, 2, 4, 5}));
+  EXPECT_EQ(std::vector<std::uint32_t>(cloud.indices().begin(), cloud.indices().end()),
+            (std::vector<std::uint32_t>{1, 4, 0, 2, 3}));
+  EXPECT_EQ(std::vector<float>(cloud.x().begin(), cloud.x().end()),
+            (std::vector<float>{2.F, 5.F, 1.F, 3.F, 4.F}));
+  EXPECT_EQ(cloud.ranges()[4], 4.F);
+  EXPECT_EQ(cloud.azimuths()[4], 0.F);
+  EXPECT_EQ(cloud.azimuth_bins(), 0);
+  EXPECT_TRUE(cloud.range_image().empty());
+  for (std::size_t i{cloud.size()}; i < cloud.PaddedSize(); ++i) {
+    EXPECT_EQ(cloud.azimuths().data()[i], 0.F) << i;  // NOLINT(*-pointer-arithmetic)
+  }
+}
+
+TEST(RingPointCloud, AllLevelsComputeSameRangesAndAzimuths) {
+  std::vector<TestPoint> points{MakeScan()};
+  points.push_back({0.F, 0.F, 0.F, 1});
+  points.push_back({-1.F, 0.F, 0.F, 1});
+  points.push_back({-1.F, -0.F, 0.F, 1});
+  points.push_back({0.F, -2.F, 0.F, 1});
+  points.push_back({1e-20F, 1e15F, 0.F, 1});
+  const pb::PointFrame frame{MakeFrame(points)};
+  const PointCloudView view{frame};
+
+  const RingPointCloud expected{view, 0, SimdLevel::kScalar};
+  for (std::size_t i{0}; i < expected.size(); ++i) {
+    const std::uint32_t point{expected.indices()[i]};
+    const float x{view.x()[point]};
+    const float y{view.y()[point]};
+    const float z{view.z()[point]};
+    EXPECT_NEAR(expected.ranges()[i], std::sqrt(x * x + y * y + z * z), 1e-5) << i;
+    EXPECT_NEAR(expected.azimuths()[i], std::atan2(y, x), 1e-5) << i;
+  }
+
+  for (const SimdLevel level : SupportedSimdLevels()) {
+    SCOPED_TRACE(testing::Message() << "level " << static_cast<int>(level));
+    const RingPointCloud cloud{view, 0, level};
+    ASSERT_EQ(cloud.size(), expected.size());
+    for (std::size_t i{0}; i < cloud.size(); ++i) {
+      EXPECT_EQ(cloud.ranges()[i], expected.ranges()[i]) << i;
+      EXPECT_EQ(cloud.azimuths()[i], expected.azimuths()[i]) << i;
+    }
+  }
+}
+
+TEST(RingPointCloud, RangeImage) {
+  std::vector<TestPoint> points{MakeScan()};
+  points.push_back({std::numeric_limits<float>::quiet_NaN(), 0.F, 0.F, 3});
+  points.push_back({0.F, 0.F, 0.F, 3});
+  const pb::PointFrame frame{MakeFrame(points)};
+  const RingPointCloud cloud{PointCloudView{frame}, /*azimuth_bins=*/90};
+  ASSERT_EQ(cloud.ring_count(), 16);
+  EXPECT_EQ(cloud.azimuth_bins(), 90);
+  ASSERT_EQ(cloud.range_image().size(), 16 * 90);
+  ASSERT_EQ(cloud.range_image_points().size(), 16 * 90);
+
+  // Each cell covers 4 degrees, i.e. 4 points, and keeps the nearest one.
+  for (std::size_t ring{0}; ring < 16; ++ring) {
+    for (std::size_t column{0}; column < 90; ++column) {
+      const std::size_t cell{ring * 90 + column};
+      const std::uint32_t point{cloud.range_image_points()[cell]};
+      ASSERT_NE(point, RingPointCloud::kNoPoint) << cell;
+      EXPECT_GE(point, cloud.ring_offsets()[ring]) << cell;
+      EXPECT_LT(point, cloud.ring_offsets()[ring + 1]) << cell;
+      EXPECT_EQ(cloud.range_image()[cell], cloud.ranges()[point]) << cell;
+      float nearest{std::numeric_limits<float>::infinity()};
+      const std::size_t first_step{(column * 4 + 180) % 360};
+      for (std::size_t step{first_step}; step < first_step + 4; ++step) {
+        nearest = std::fmin(nearest, 10.F + static_cast<float>(ring + step % 7));
+      }
+      EXPECT_NEAR(cloud.range_image()[cell], std::hypot(nearest, static_cast<float>(ring) - 8.F),
+                  1e-4)
+          << cell;
+    }
+  }
+
+  // An azimuth of pi is in the last column.
+  const pb::PointFrame sparse_frame{MakeFrame({{-1.F, 0.F, 0.F, 1}})};
+  const RingPointCloud sparse{PointCloudView{sparse_frame}, 4};
+  EXPECT_EQ(std::vector<std::uint32_t>(sparse.range_image_points().begin(),
+                                       sparse.range_image_points().end()),
+            (std::vector<std::uint32_t>{RingPointCloud::kNoPoint, RingPointCloud::kNoPoint,
+                                        RingPointCloud::kNoPoint, RingPointCloud::kNoPoint,
+                                        RingPointCloud::kNoPoint, RingPointCloud::kNoPoint,
+                                        RingPointCloud::kNoPoint, 0}));
+  EXPECT_EQ(sparse.range_image()[7], 1.F);
+}
+
+TEST(RingPointCloud, MissingRingIndices) {
+  pb::PointFrame frame{MakeFrame({{1.F, 0.F, 0.F, 0}})};
+  RingPointCloud cloud{PointCloudView{frame}};
+  EXPECT_EQ(cloud.size(), 1);
+  frame.mutable_points().clear_ring_indices();
+  EXPECT_THROW(cloud.Assign(PointCloudView{frame}), std::invalid_argument);
+  EXPECT_TRUE(cloud.empty());
+}
+
+TEST(RingPointCloud, RingIndexOutOfRange) {
+  const std::uint16_t last_ring{RingPointCloud::kMaxRingCount - 1};
+  const pb::PointFrame frame{MakeFrame({{1.F, 0.F, 0.F, 0}, {2.F, 0.F, 0.F, last_ring}})};
+  RingPointCloud cloud{PointCloudView{frame}, 3600};
+  EXPECT_EQ(cloud.ring_count(), RingPointCloud::kMaxRingCount);
+
+  const pb::PointFrame corrupt{MakeFrame({{1.F, 0.F, 0.F, 0}, {2.F, 0.F, 0.F, 65535}})};
+  EXPECT_THROW(cloud.Assign(PointCloudView{corrupt}, 3600), std::invalid_argument);
+  EXPECT_TRUE(cloud.empty());
+  EXPECT_EQ(cloud.ring_count(), 0);
+}
+
+TEST(RingPointCloud, AssignReusesBuffers) {
+  const pb::PointFrame frame{MakeFrame(MakeScan())};
+  const PointCloudView view{frame};
+  RingPointCloud cloud{view, 90};
+  const float* const x{cloud.x().data()};
+  const float* const image{cloud.range_image().data()};
+
+  cloud.Clear();
+  EXPECT_TRUE(cloud.empty());
+  EXPECT_TRUE(cloud.ring_offsets().empty());
+  EXPECT_TRUE(cloud.range_image().empty());
+
+  cloud.Assign(view, 90);
+  EXPECT_EQ(cloud.size(), 16 * 360);
+  EXPECT_EQ(cloud.x().data(), x);
+  EXPECT_EQ(cloud.range_image().data(), image);
+}
+
+}  // namespace
+}  // namespace sdk
+}  // namespace horus
@@ -5,9 +5,15 @@
 #ifndef HORUS_SDK_SENSOR_H_
 #define HORUS_SDK_SENSOR_H_
 
+#include <cstddef>
+#include <functional>
+#include <memory>
+
 #include "horus/pb/notification_service/service_pb.h"
 #include "horus/pb/point_aggregator/point_aggregator_service_pb.h"
 #include "horus/pb/preprocessing/messages_pb.h"
+#include "horus/sdk/delivery.h"
+#include "horus/sdk/event_ring.h"
 
 namespace horus {
 namespace sdk {
@@ -16,12 +22,30 @@ namespace sdk {
 struct SensorInfoSubscriptionRequest {
   /// Function to call when sensor information is received.
   std::function<void(pb::SensorInfoEvent&&)> on_sensor_info_event;
+
+  /// If non-null, received sensor information events are pushed to this ring to be polled by the
+  /// user instead of being passed to `on_sensor_info_event`.
+  std::shared_ptr<EventRing<pb::SensorInfoEvent>> event_ring{nullptr};
 };
 
 /// A request to subscribe to global sensor occupancy grid information events.
 struct OccupancyGridSubscriptionRequest {
   /// Function to call when occupancy grid information is received.
   std::function<void(pb::OccupancyGridListEvent&&)> on_occupancy_grid;
+
+  /// If non-null, received occupancy grids are pushed to this ring to be polled by the user instead
+  /// of being passed to `on_occupancy_grid`. `delivery_policy` is then ignored.
+  std::shared_ptr<EventRing<pb::OccupancyGridListEvent>> event_ring{nullptr};
+
+  /// How occupancy grids are delivered when `on_occupancy_grid` cannot keep up with them. With
+  /// `DeliveryPolicy::kKeepLatest`, only the latest occupancy grid list is kept.
+  ///
+  /// Dropped occupancy grids are counted by `Sdk::Subscription::DroppedEventCount()`.
+  DeliveryPolicy delivery_policy{DeliveryPolicy::kBlock};
+
+  /// The maximum number of occupancy grids waiting for delivery with `DeliveryPolicy::kDropOldest`,
+  /// which must be positive.
+  std::size_t max_pending_occupancy_grids{4};
 };
 
 }  // namespace sdk
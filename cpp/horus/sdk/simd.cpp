@@ -0,0 +1,48 @@
+#include "horus/sdk/simd.h"
+
+#include "horus/sdk/internal/simd_dispatch.h"
+
+namespace horus {
+namespace sdk {
+namespace {
+
+/// Returns the fastest `SimdLevel` supported by this CPU.
+SimdLevel DetectSimdLevel() noexcept {
+  if (IsSimdLevelSupported(SimdLevel::kAvx2)) {
+    return SimdLevel::kAvx2;
+  }
+  if (IsSimdLevelSupported(SimdLevel::kSse41)) {
+    return SimdLevel::kSse41;
+  }
+  return SimdLevel::kScalar;
+}
+
+}  // namespace
+
+bool IsSimdLevelSupported(SimdLevel level) noexcept {
+  switch (level) {
+    case SimdLevel::kScalar:
+      return true;
+    case SimdLevel::kSse41:
+#if HORUS_SDK_SIMD_X86
+      return __builtin_cpu_supports("sse4.1") != 0;
+#else
+      return false;
+#endif
+    case SimdLevel::kAvx2:
+#if HORUS_SDK_SIMD_X86
+      return __builtin_cpu_supports("avx2") != 0;
+#else
+      return false;
+#endif
+  }
+  return false;
+}
+
+SimdLevel BestSimdLevel() noexcept {
+  static const SimdLevel level{DetectSimdLevel()};
+  return level;
+}
+
+}  // namespace sdk
+}  // namespace horus
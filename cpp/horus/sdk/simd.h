@@ -0,0 +1,35 @@
+/// @file
+///
+/// Selection of the instruction sets used by the point cloud kernels of the SDK.
+
+#ifndef HORUS_SDK_SIMD_H_
+#define HORUS_SDK_SIMD_H_
+
+#include <cstdint>
+
+namespace horus {
+namespace sdk {
+
+/// An instruction set used by the point cloud kernels (e.g. `PointCloudView`).
+///
+/// Kernels are compiled for all levels and pick one at runtime, so that the SDK does not have to be
+/// built for a specific CPU.
+enum class SimdLevel : std::uint8_t {
+  /// Portable implementation.
+  kScalar,
+  /// Implementation using SSE4.1 instructions, processing 4 floats at a time.
+  kSse41,
+  /// Implementation using AVX2 instructions, processing 8 floats at a time.
+  kAvx2,
+};
+
+/// Returns whether `level` can be used on this CPU.
+bool IsSimdLevelSupported(SimdLevel level) noexcept;
+
+/// Returns the fastest `SimdLevel` supported by this CPU, detected once.
+SimdLevel BestSimdLevel() noexcept;
+
+}  // namespace sdk
+}  // namespace horus
+
+#endif  // HORUS_SDK_SIMD_H_
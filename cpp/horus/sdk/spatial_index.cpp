@@ -0,0 +1,384 @@
+#include "horus/sdk/spatial_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "horus/pb/detection_service/detection_pb.h"
+#include "horus/sdk/internal/parallel_for.h"
+#include "horus/sdk/point_cloud_view.h"
+#include "horus/types/span.h"
+
+namespace horus {
+namespace sdk {
+namespace {
+
+/// The cell of points which are not indexed.
+constexpr std::uint32_t kNoCell{~std::uint32_t{0}};
+
+/// The minimum number of points handled by each thread while building an index; smaller clouds are
+/// indexed by fewer threads.
+constexpr std::size_t kMinPointsPerThread{16384};
+
+/// The maximum number of cells per point, beyond which the cell size is doubled.
+constexpr double kMaxCellsPerPoint{4.};
+
+/// The number of cells which are always allowed, so that small clouds keep the requested cell size.
+constexpr double kMinMaxCells{1024.};
+
+/// The maximum number of cells of any grid.
+constexpr double kMaxCells{1 << 30};
+
+/// Returns whether the coordinates are finite.
+bool IsFinite(float x, float y, float z) noexcept {
+  return std::isfinite(x) && std::isfinite(y) && std::isfinite(z);
+}
+
+/// Returns `value` truncated to an integer in `[0, count)`, or zero if `value` is NaN.
+std::size_t ClampToCell(float value, std::size_t count) noexcept {
+  if (!(value > 0.F)) {
+    return 0;
+  }
+  const float last{static_cast<float>(count - 1)};
+  if (value >= last) {
+    return count - 1;
+  }
+  return std::min(static_cast<std::size_t>(value), count - 1);
+}
+
+}  // namespace
+
+OrientedBox OrientedBox::FromProto(const pb::BoundingBox& box) {
+  const pb::Vector3f& base{box.base()};
+  const pb::Vector3f& size{box.size()};
+  OrientedBox result;
+  result.center_x = base.x();
+  result.center_y = base.y();
+  result.center_z = base.z() + size.z() * 0.5F;
+  result.half_length = size.x() * 0.5F;
+  result.half_width = size.y() * 0.5F;
+  result.half_height = size.z() * 0.5F;
+  result.yaw = box.yaw();
+  return result;
+}
+
+void SpatialIndex::Assign(const PointCloudView& view, float cell_size, std::size_t thread_count) {
+  Clear();
+  if (!(cell_size > 0.F) || !std::isfinite(cell_size)) {
+    throw std::invalid_argument{"spatial index cell size must be positive and finite"};
+  }
+  const std::size_t point_count{view.size()};
+  if (point_count == 0) {
+    return;
+  }
+  const Span<const float> view_x{view.x()};
+  const Span<const float> view_y{view.y()};
+  const Span<const float> view_z{view.z()};
+
+  // Each thread handles a contiguous chunk of points, so that the points of each cell remain in
+  // the order of the view whatever the number of threads.
+  thread_count = std::max<std::size_t>(
+      1, std::min(thread_count, point_count / kMinPointsPerThread));
+  const auto chunk_begin = [point_count, thread_count](std::size_t thread) {
+    return point_count * thread / thread_count;
+  };
+  if (thread_count > 1 && workers_ == nullptr) {
+    workers_ = std::make_unique<horus_internal::WorkerThreads>();
+  }
+  // Calls `function(worker, thread)` for each thread, on the threads of `workers_`.
+  const auto for_each_thread = [this, thread_count](const auto& function) {
+    if (thread_count == 1) {
+      function(0, 0);
+    } else {
+      static_cast<void>(workers_->ParallelFor(thread_count, thread_count, function));
+    }
+  };
+
+  // 1. Find the bounds of the finite points.
+  thread_bounds_.resize(4 * thread_count);
+  point_cells_.resize(point_count);
+  for_each_thread([&](std::size_t /*worker*/, std::size_t thread) {
+    float min_x{std::numeric_limits<float>::infinity()};
+    float min_y{min_x};
+    float max_x{-min_x};
+    float max_y{-min_x};
+    for (std::size_t i{chunk_begin(thread)}; i < chunk_begin(thread + 1); ++i) {
+      if (IsFinite(view_x[i], view_y[i], view_z[i])) {
+        min_x = std::min(min_x, view_x[i]);
+        min_y = std::min(min_y, view_y[i]);
+        max_x = std::max(max_x, view_x[i]);
+        max_y = std::max(max_y, view_y[i]);
+        point_cells_[i] = 0;
+      } else {
+        point_cells_[i] = kNoCell;
+      }
+    }
+    float* const bounds{&thread_bounds_[4 * thread]};
+    bounds[0] = min_x;
+    bounds[1] = min_y;
+    bounds[2] = max_x;
+    bounds[3] = max_y;
+  });
+  float min_x{std::numeric_limits<float>::infinity()};
+  float min_y{min_x};
+  float max_x{-min_x};
+  float max_y{-min_x};
+  for (std::size_t thread{0}; thread < thread_count; ++thread) {
+    min_x = std::min(min_x, thread_bounds_[4 * thread]);
+    min_y = std::min(min_y, thread_bounds_[4 * thread + 1]);
+    max_x = std::max(max_x, thread_bounds_[4 * thread + 2]);
+    max_y = std::max(max_y, thread_bounds_[4 * thread + 3]);
+  }
+  if (!(min_x <= max_x)) {
+    return;  // No finite points.
+  }
+
+  // 2. Lay out the grid, doubling the cell size until there are few enough cells.
+  const double extent_x{static_cast<double>(max_x) - static_cast<double>(min_x)};
+  const double extent_y{static_cast<double>(max_y) - static_cast<double>(min_y)};
+  const double max_cells{std::min(
+      kMaxCells, std::max(kMinMaxCells, kMaxCellsPerPoint * static_cast<double>(point_count)))};
+  double grid_cell_size{cell_size};
+  double columns{std::floor(extent_x / grid_cell_size) + 1.};
+  double rows{std::floor(extent_y / grid_cell_size) + 1.};
+  while (columns * rows > max_cells) {
+    grid_cell_size *= 2.;
+    columns = std::floor(extent_x / grid_cell_size) + 1.;
+    rows = std::floor(extent_y / grid_cell_size) + 1.;
+  }
+  cell_size_ = static_cast<float>(grid_cell_size);
+  inverse_cell_size_ = static_cast<float>(1. / grid_cell_size);
+  min_x_ = min_x;
+  min_y_ = min_y;
+  columns_ = static_cast<std::size_t>(columns);
+  rows_ = static_cast<std::size_t>(rows);
+  const std::size_t cell_count{columns_ * rows_};
+
+  // 3. Count the points of each cell for each thread.
+  thread_cell_counts_.assign(thread_count * cell_count, 0);
+  for_each_thread([&](std::size_t /*worker*/, std::size_t thread) {
+    std::uint32_t* const counts{&thread_cell_counts_[thread * cell_count]};
+    for (std::size_t i{chunk_begin(thread)}; i < chunk_begin(thread + 1); ++i) {
+      if (point_cells_[i] != kNoCell) {
+        const std::size_t cell{RowOf(view_y[i]) * columns_ + ColumnOf(view_x[i])};
+        point_cells_[i] = static_cast<std::uint32_t>(cell);
+        ++counts[cell];
+      }
+    }
+  });
+
+  // 4. Turn the counts into the index of the first point of each cell for each thread.
+  cell_offsets_.resize(cell_count + 1);
+  std::uint32_t offset{0};
+  for (std::size_t cell{0}; cell < cell_count; ++cell) {
+    cell_offsets_[cell] = offset;
+    for (std::size_t thread{0}; thread < thread_count; ++thread) {
+      std::uint32_t& count{thread_cell_counts_[thread * cell_count + cell]};
+      const std::uint32_t next_offset{offset + count};
+      count = offset;
+      offset = next_offset;
+    }
+  }
+  cell_offsets_[cell_count] = offset;
+
+  // 5. Scatter the points to their cells. The index is left empty if this fails, rather than
+  // sized but partially filled.
+  try {
+    x_.resize(offset);
+    y_.resize(offset);
+    z_.resize(offset);
+    indices_.resize(offset);
+    for_each_thread([&](std::size_t /*worker*/, std::size_t thread) {
+      std::uint32_t* const cursors{&thread_cell_counts_[thread * cell_count]};
+      for (std::size_t i{chunk_begin(thread)}; i < chunk_begin(thread + 1); ++i) {
+        const std::uint32_t cell{point_cells_[i]};
+        if (cell != kNoCell) {
+          const std::uint32_t position{cursors[cell]++};
+          x_[position] = view_x[i];
+          y_[position] = view_y[i];
+          z_[position] = view_z[i];
+          indices_[position] = static_cast<std::uint32_t>(i);
+        }
+      }
+    });
+  } catch (...) {
+    Clear();
+    throw;
+  }
+}
+
+void SpatialIndex::Clear() noexcept {
+  cell_size_ = 0.F;
+  inverse_cell_size_ = 0.F;
+  min_x_ = 0.F;
+  min_y_ = 0.F;
+  columns_ = 0;
+  rows_ = 0;
+  cell_offsets_.clear();
+  x_.clear();
+  y_.clear();
+  z_.clear();
+  indices_.clear();
+}
+
+std::size_t SpatialIndex::ColumnOf(float x) const noexcept {
+  return ClampToCell((x - min_x_) * inverse_cell_size_, columns_);
+}
+
+std::size_t SpatialIndex::RowOf(float y) const noexcept {
+  return ClampToCell((y - min_y_) * inverse_cell_size_, rows_);
+}
+
+template <class Function>
+void SpatialIndex::ForEachPointIn(float min_x, float min_y, float max_x, float max_y,
+                                  const Function& function) const {
+  // Also rejects NaNs, and areas which do not overlap the grid.
+  if (empty() || !(min_x <= max_x) || !(min_y <= max_y) || max_x < min_x_ || max_y < min_y_ ||
+      min_x > min_x_ + static_cast<float>(columns_) * cell_size_ ||
+      min_y > min_y_ + static_cast<float>(rows_) * cell_size_) {
+    return;
+  }
+  const std::size_t first_column{ColumnOf(min_x)};
+  const std::size_t last_column{ColumnOf(max_x)};
+  const std::size_t last_row{RowOf(max_y)};
+  // The cells of a row are contiguous, and so are their points.
+  for (std::size_t row{RowOf(min_y)}; row <= last_row; ++row) {
+    const std::uint32_t end{cell_offsets_[row * columns_ + last_column + 1]};
+    for (std::uint32_t i{cell_offsets_[row * columns_ + first_column]}; i < end; ++i) {
+      function(i);
+    }
+  }
+}
+
+void SpatialIndex::RadiusSearch(float x, float y, float z, float radius,
+                                std::vector<std::uint32_t>& indices) const {
+  indices.clear();
+  if (!(radius >= 0.F)) {
+    return;
+  }
+  const float squared_radius{radius * radius};
+  ForEachPointIn(x - radius, y - radius, x + radius, y + radius, [&](std::uint32_t i) {
+    const float dx{x_[i] - x};
+    const float dy{y_[i] - y};
+    const float dz{z_[i] - z};
+    if (dx * dx + dy * dy + dz * dz <= squared_radius) {
+      indices.push_back(indices_[i]);
+    }
+  });
+}
+
+void SpatialIndex::NearestNeighbors(float x, float y, float z, std::size_t k,
+                                    std::vector<PointNeighbor>& neighbors) const {
+  neighbors.clear();
+  if (k == 0 || empty() || !IsFinite(x, y, z)) {
+    return;
+  }
+  k = std::min(k, size());
+
+  // `neighbors` is a max-heap of the nearest points found so far.
+  const auto nearer = [](const PointNeighbor& lhs, const PointNeighbor& rhs) {
+    return lhs.squared_distance < rhs.squared_distance;
+  };
+  const auto visit_cells = [&](std::size_t row, std::size_t first_column,
+                               std::size_t last_column) {
+    const std::uint32_t end{cell_offsets_[row * columns_ + last_column + 1]};
+    for (std::uint32_t i{cell_offsets_[row * columns_ + first_column]}; i < end; ++i) {
+      const float dx{x_[i] - x};
+      const float dy{y_[i] - y};
+      const float dz{z_[i] - z};
+      const float squared_distance{dx * dx + dy * dy + dz * dz};
+      if (neighbors.size() < k) {
+        neighbors.push_back({indices_[i], squared_distance});
+        std::push_heap(neighbors.begin(), neighbors.end(), nearer);
+      } else if (squared_distance < neighbors.front().squared_distance) {
+        std::pop_heap(neighbors.begin(), neighbors.end(), nearer);
+        neighbors.back() = {indices_[i], squared_distance};
+        std::push_heap(neighbors.begin(), neighbors.end(), nearer);
+      }
+    }
+  };
+
+  // Visit the square rings of cells around the cell nearest to the query point, until the points
+  // which were not visited are all farther than the `k` nearest points found so far.
+  const std::ptrdiff_t column_count{static_cast<std::ptrdiff_t>(columns_)};
+  const std::ptrdiff_t row_count{static_cast<std::ptrdiff_t>(rows_)};
+  const std::ptrdiff_t column{static_cast<std::ptrdiff_t>(ColumnOf(x))};
+  const std::ptrdiff_t row{static_cast<std::ptrdiff_t>(RowOf(y))};
+  // Cell borders are only known up to rounding errors, which this slack accounts for.
+  const float slack{cell_size_ * 1e-3F};
+  for (std::ptrdiff_t ring{0};; ++ring) {
+    const std::ptrdiff_t first_column{std::max<std::ptrdiff_t>(column - ring, 0)};
+    const std::ptrdiff_t last_column{std::min(column + ring, column_count - 1)};
+    const std::ptrdiff_t first_row{std::max<std::ptrdiff_t>(row - ring, 0)};
+    const std::ptrdiff_t last_row{std::min(row + ring, row_count - 1)};
+    for (std::ptrdiff_t ring_row{first_row}; ring_row <= last_row; ++ring_row) {
+      const auto row_index = static_cast<std::size_t>(ring_row);
+      if (ring_row == row - ring || ring_row == row + ring) {
+        visit_cells(row_index, static_cast<std::size_t>(first_column),
+                    static_cast<std::size_t>(last_column));
+        continue;
+      }
+      if (column - ring >= 0) {
+        visit_cells(row_index, static_cast<std::size_t>(column - ring),
+                    static_cast<std::size_t>(column - ring));
+      }
+      if (column + ring < column_count) {
+        visit_cells(row_index, static_cast<std::size_t>(column + ring),
+                    static_cast<std::size_t>(column + ring));
+      }
+    }
+
+    // Points which were not visited are beyond a side of the visited cells which is not a side of
+    // the grid.
+    float bound{std::numeric_limits<float>::infinity()};
+    if (first_column > 0) {
+      bound = std::min(bound, x - (min_x_ + static_cast<float>(first_column) * cell_size_));
+    }
+    if (last_column < column_count - 1) {
+      bound = std::min(bound, min_x_ + static_cast<float>(last_column + 1) * cell_size_ - x);
+    }
+    if (first_row > 0) {
+      bound = std::min(bound, y - (min_y_ + static_cast<float>(first_row) * cell_size_));
+    }
+    if (last_row < row_count - 1) {
+      bound = std::min(bound, min_y_ + static_cast<float>(last_row + 1) * cell_size_ - y);
+    }
+    if (std::isinf(bound)) {
+      break;  // All cells were visited.
+    }
+    bound = std::max(bound - slack, 0.F);
+    if (neighbors.size() == k && bound * bound >= neighbors.front().squared_distance) {
+      break;
+    }
+  }
+  std::sort_heap(neighbors.begin(), neighbors.end(), nearer);
+}
+
+void SpatialIndex::BoxSearch(const OrientedBox& box, std::vector<std::uint32_t>& indices) const {
+  indices.clear();
+  const float cos_yaw{std::cos(box.yaw)};
+  const float sin_yaw{std::sin(box.yaw)};
+  // The half extents of the axis-aligned bounding box of the rotated box.
+  const float extent_x{std::abs(cos_yaw) * box.half_length + std::abs(sin_yaw) * box.half_width};
+  const float extent_y{std::abs(sin_yaw) * box.half_length + std::abs(cos_yaw) * box.half_width};
+  ForEachPointIn(box.center_x - extent_x, box.center_y - extent_y, box.center_x + extent_x,
+                 box.center_y + extent_y, [&](std::uint32_t i) {
+                   const float dx{x_[i] - box.center_x};
+                   const float dy{y_[i] - box.center_y};
+                   // The coordinates of the point along and across the heading of the box.
+                   const float along{cos_yaw * dx + sin_yaw * dy};
+                   const float across{cos_yaw * dy - sin_yaw * dx};
+                   if (std::abs(along) <= box.half_length && std::abs(across) <= box.half_width &&
+                       std::abs(z_[i] - box.center_z) <= box.half_height) {
+                     indices.push_back(indices_[i]);
+                   }
+                 });
+}
+
+}  // namespace sdk
+}  // namespace horus
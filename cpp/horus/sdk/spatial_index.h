@@ -0,0 +1,190 @@
+/// @file
+///
+/// The `SpatialIndex` class.
+
+#ifndef HORUS_SDK_SPATIAL_INDEX_H_
+#define HORUS_SDK_SPATIAL_INDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "horus/pb/detection_service/detection_pb.h"
+#include "horus/sdk/internal/parallel_for.h"
+#include "horus/sdk/point_cloud_view.h"
+
+namespace horus {
+namespace sdk {
+
+/// A box rotated around the vertical (z) axis, e.g. the bounding box of a detected object.
+struct OrientedBox final {
+  /// The x coordinate of the center of the box.
+  float center_x{0.F};
+  /// The y coordinate of the center of the box.
+  float center_y{0.F};
+  /// The z coordinate of the center of the box.
+  float center_z{0.F};
+  /// Half the extent of the box along its heading, i.e. the x axis rotated by `yaw`.
+  float half_length{0.F};
+  /// Half the extent of the box across its heading, i.e. the y axis rotated by `yaw`.
+  float half_width{0.F};
+  /// Half the vertical extent of the box.
+  float half_height{0.F};
+  /// The heading of the box in radians, counter-clockwise from the x axis.
+  float yaw{0.F};
+
+  /// Returns the box described by `box`, whose `base` is the center of its bottom face and whose
+  /// `size` holds its extents along its heading, across its heading and vertically.
+  static OrientedBox FromProto(const pb::BoundingBox& box) noexcept(false);
+};
+
+/// A point found by `SpatialIndex::NearestNeighbors()`.
+struct PointNeighbor final {
+  /// The index of the point in the indexed `PointCloudView`.
+  std::uint32_t index{0};
+  /// The squared distance from the point to the query point.
+  float squared_distance{0.F};
+};
+
+/// A spatial index of the points of a `PointCloudView`, answering radius, nearest neighbors and
+/// oriented box queries without scanning the whole cloud.
+///
+/// Points are bucketed into a uniform grid of square cells on the x-y plane (lidar points spread
+/// over the ground much more than vertically), with a counting sort: building the index takes
+/// `O(n)` time and can be split over several threads, and the points of each grid row are stored
+/// contiguously in structure-of-arrays buffers, so a query scans a few contiguous ranges of
+/// points. Points with a non-finite coordinate are not indexed.
+///
+/// The number of cells is kept proportional to the number of points by growing the cell size of
+/// sparse clouds (see `cell_size()`).
+///
+/// A `SpatialIndex` copies the coordinates it needs, so the view may be destroyed once the index
+/// is built. It reuses its buffers and threads when assigned new points, e.g. for each frame of a
+/// lidar. Const member functions may be called concurrently.
+class SpatialIndex final {
+ public:
+  /// Constructs an empty index.
+  SpatialIndex() noexcept = default;
+
+  /// Constructs the index of the points of `view` (see `Assign()`).
+  ///
+  /// @throws std::invalid_argument If `cell_size` is not positive and finite.
+  /// @throws std::bad_alloc If the buffers of the index cannot be allocated.
+  /// @throws std::system_error If a thread cannot be started.
+  explicit SpatialIndex(const PointCloudView& view, float cell_size = 1.F,
+                        std::size_t thread_count = 1) noexcept(false) {
+    Assign(view, cell_size, thread_count);
+  }
+
+  /// Indices cannot be copied.
+  SpatialIndex(const SpatialIndex&) = delete;
+  /// Indices cannot be copied.
+  SpatialIndex& operator=(const SpatialIndex&) = delete;
+  /// Move constructor.
+  SpatialIndex(SpatialIndex&&) noexcept = default;
+  /// Move assignment operator.
+  SpatialIndex& operator=(SpatialIndex&&) noexcept = default;
+
+  /// Destroys the index.
+  ~SpatialIndex() noexcept = default;
+
+  /// Replaces the contents of the index by the points of `view`, reusing the buffers of the index,
+  /// using cells of (at least) `cell_size` meters and `thread_count` threads (including the
+  /// calling thread).
+  ///
+  /// Queries are fastest when cells hold a few points each; the default of one meter suits a
+  /// lidar frame.
+  ///
+  /// @throws std::invalid_argument If `cell_size` is not positive and finite.
+  /// @throws std::bad_alloc If the buffers of the index cannot be allocated.
+  /// @throws std::system_error If a thread cannot be started.
+  void Assign(const PointCloudView& view, float cell_size = 1.F,
+              std::size_t thread_count = 1) noexcept(false);
+
+  /// Empties the index, keeping its buffers.
+  void Clear() noexcept;
+
+  /// Returns the number of indexed points.
+  std::size_t size() const noexcept { return x_.size(); }
+  /// Returns whether `size() == 0`.
+  bool empty() const noexcept { return x_.empty(); }
+
+  /// Returns the size of the cells in meters, which is the `cell_size` given to `Assign()` doubled
+  /// as many times as needed to bound the number of cells (or zero if empty).
+  float cell_size() const noexcept { return cell_size_; }
+
+  /// Returns the number of columns (along x) of the grid.
+  std::size_t columns() const noexcept { return columns_; }
+  /// Returns the number of rows (along y) of the grid.
+  std::size_t rows() const noexcept { return rows_; }
+
+  /// Replaces `indices` by the indices (in the view) of the points within `radius` of
+  /// `(x, y, z)`, in no particular order.
+  ///
+  /// @throws std::bad_alloc If `indices` cannot grow.
+  void RadiusSearch(float x, float y, float z, float radius,
+                    std::vector<std::uint32_t>& indices) const noexcept(false);
+
+  /// Replaces `neighbors` by the `k` points nearest to `(x, y, z)` (or all points if there are
+  /// fewer), sorted by increasing distance. Finds no points if `(x, y, z)` is not finite.
+  ///
+  /// @throws std::bad_alloc If `neighbors` cannot grow.
+  void NearestNeighbors(float x, float y, float z, std::size_t k,
+                        std::vector<PointNeighbor>& neighbors) const noexcept(false);
+
+  /// Replaces `indices` by the indices (in the view) of the points inside `box` (including its
+  /// faces), in no particular order.
+  ///
+  /// @throws std::bad_alloc If `indices` cannot grow.
+  void BoxSearch(const OrientedBox& box, std::vector<std::uint32_t>& indices) const noexcept(false);
+
+ private:
+  /// Returns the column of the cell of the given x coordinate, clamped to the grid.
+  std::size_t ColumnOf(float x) const noexcept;
+  /// Returns the row of the cell of the given y coordinate, clamped to the grid.
+  std::size_t RowOf(float y) const noexcept;
+
+  /// Calls `function(i)` for the index `i` (in the sorted buffers) of each point in the cells
+  /// overlapping `[min_x, max_x] x [min_y, max_y]`.
+  template <class Function>
+  void ForEachPointIn(float min_x, float min_y, float max_x, float max_y,
+                      const Function& function) const;
+
+  /// @see cell_size()
+  float cell_size_{0.F};
+  /// The inverse of `cell_size_`.
+  float inverse_cell_size_{0.F};
+  /// The x coordinate of the left side of the grid.
+  float min_x_{0.F};
+  /// The y coordinate of the bottom side of the grid.
+  float min_y_{0.F};
+  /// @see columns()
+  std::size_t columns_{0};
+  /// @see rows()
+  std::size_t rows_{0};
+  /// The index of the first point of each cell (in row-major order), followed by `size()`.
+  std::vector<std::uint32_t> cell_offsets_;
+  /// The x coordinates of the points, sorted by cell.
+  std::vector<float> x_;
+  /// The y coordinates of the points, sorted by cell.
+  std::vector<float> y_;
+  /// The z coordinates of the points, sorted by cell.
+  std::vector<float> z_;
+  /// The index in the view of the points, sorted by cell.
+  std::vector<std::uint32_t> indices_;
+  /// The cell of each point of the view (or `kNoCell` if not indexed) while building the index.
+  std::vector<std::uint32_t> point_cells_;
+  /// The number of points (then the index of the next point) of each cell for each thread while
+  /// building the index, thread after thread.
+  std::vector<std::uint32_t> thread_cell_counts_;
+  /// The bounds of the points handled by each thread while building the index.
+  std::vector<float> thread_bounds_;
+  /// The threads building the index along with the calling thread, started on first use.
+  std::unique_ptr<horus_internal::WorkerThreads> workers_;
+};
+
+}  // namespace sdk
+}  // namespace horus
+
+#endif  // HORUS_SDK_SPATIAL_INDEX_H_
@@ -0,0 +1,265 @@
+#include "horus/sdk/spatial_index.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "horus/pb/config/metadata_pb.h"
+#include "horus/pb/detection_service/detection_pb.h"
+#include "horus/pb/point/point_message_pb.h"
+#include "horus/sdk/point_cloud_view.h"
+#include "horus/testing/allocations.h"
+#include "horus/testing/point_clouds.h"
+
+namespace horus {
+namespace sdk {
+namespace {
+
+/// Returns a frame with `size` pseudo-random points in a 100 x 60 x 4 meters volume, plus a point
+/// with a NaN coordinate.
+pb::PointFrame MakeFrame(std::size_t size) {
+  std::uint32_t state{12345};
+  const auto next = [&state](float scale) {
+    state = state * 1664525U + 1013904223U;
+    return static_cast<float>(state >> 8) / static_cast<float>(1U << 24) * scale;
+  };
+  return MakePointFrame(
+      size + 1,
+      [&](std::size_t i) {
+        TestPoint point;
+        if (i == size) {
+          point.x = std::numeric_limits<float>::quiet_NaN();
+        } else {
+          point.x = next(100.F) - 50.F;
+          point.y = next(60.F) - 10.F;
+          point.z = next(4.F) - 2.F;
+        }
+        return point;
+      },
+      kTestPointCoordinates);
+}
+
+/// Returns the squared distance from point `i` of `view` to `(x, y, z)`.
+float SquaredDistance(const PointCloudView& view, std::size_t i, float x, float y, float z) {
+  const float dx{view.x()[i] - x};
+  const float dy{view.y()[i] - y};
+  const float dz{view.z()[i] - z};
+  return dx * dx + dy * dy + dz * dz;
+}
+
+/// Returns `indices` sorted.
+std::vector<std::uint32_t> Sorted(std::vector<std::uint32_t> indices) {
+  std::sort(indices.begin(), indices.end());
+  return indices;
+}
+
+/// The query points of the tests, some of them outside the cloud.
+constexpr float kQueries[][3]{{0.F, 0.F, 0.F},     {-50.F, -10.F, 2.F}, {49.F, 49.F, -1.F},
+                              {12.3F, 4.5F, 0.5F}, {-80.F, 20.F, 0.F},  {0.F, 200.F, 30.F}};
+
+TEST(SpatialIndex, Empty) {
+  SpatialIndex index;
+  EXPECT_TRUE(index.empty());
+  std::vector<std::uint32_t> indices{1, 2};
+  index.RadiusSearch(0.F, 0.F, 0.F, 10.F, indices);
+  EXPECT_TRUE(indices.empty());
+  std::vector<PointNeighbor> neighbors{{}};
+  index.NearestNeighbors(0.F, 0.F, 0.F, 3, neighbors);
+  EXPECT_TRUE(neighbors.empty());
+
+  index.Assign(PointCloudView{});
+  EXPECT_TRUE(index.empty());
+  EXPECT_EQ(index.cell_size(), 0.F);
+
+  const pb::PointFrame frame{MakeFrame(0)};
+  index.Assign(PointCloudView{frame});
+  EXPECT_TRUE(index.empty());
+}
+
+TEST(SpatialIndex, RadiusSearch) {
+  const pb::PointFrame frame{MakeFrame(20000)};
+  const PointCloudView view{frame};
+  const SpatialIndex index{view};
+  EXPECT_EQ(index.size(), 20000);
+  EXPECT_EQ(index.cell_size(), 1.F);
+  EXPECT_EQ(index.columns(), 100);
+  EXPECT_EQ(index.rows(), 60);
+
+  std::vector<std::uint32_t> indices;
+  for (const auto& query : kQueries) {
+    for (const float radius : {0.F, 0.5F, 2.F, 7.5F, 1000.F}) {
+      SCOPED_TRACE(testing::Message() << query[0] << ", " << query[1] << ", " << query[2]
+                                      << ", radius " << radius);
+      std::vector<std::uint32_t> expected;
+      for (std::uint32_t i{0}; i < view.size(); ++i) {
+        if (SquaredDistance(view, i, query[0], query[1], query[2]) <= radius * radius) {
+          expected.push_back(i);
+        }
+      }
+      index.RadiusSearch(query[0], query[1], query[2], radius, indices);
+      EXPECT_EQ(Sorted(indices), expected);
+    }
+  }
+
+  index.RadiusSearch(0.F, 0.F, 0.F, -1.F, indices);
+  EXPECT_TRUE(indices.empty());
+  index.RadiusSearch(std::numeric_limits<float>::quiet_NaN(), 0.F, 0.F, 1.F, indices);
+  EXPECT_TRUE(indices.empty());
+}
+
+TEST(SpatialIndex, NearestNeighbors) {
+  const pb::PointFrame frame{MakeFrame(5000)};
+  const PointCloudView view{frame};
+  const SpatialIndex index{view, 0.5F};
+
+  std::vector<PointNeighbor> neighbors;
+  for (const auto& query : kQueries) {
+    std::vector<float> distances;
+    for (std::size_t i{0}; i < 5000; ++i) {
+      distances.push_back(SquaredDistance(view, i, query[0], query[1], query[2]));
+    }
+    std::sort(distances.begin(), distances.end());
+    for (const std::size_t k : {1, 8, 100}) {
+      SCOPED_TRACE(testing::Message()
+                   << query[0] << ", " << query[1] << ", " << query[2] << ", k " << k);
+      index.NearestNeighbors(query[0], query[1], query[2], k, neighbors);
+      ASSERT_EQ(neighbors.size(), k);
+      for (std::size_t i{0}; i < k; ++i) {
+        EXPECT_EQ(neighbors[i].squared_distance, distances[i]) << i;
+        EXPECT_EQ(neighbors[i].squared_distance,
+                  SquaredDistance(view, neighbors[i].index, query[0], query[1], query[2]))
+            << i;
+      }
+    }
+  }
+
+  index.NearestNeighbors(0.F, 0.F, 0.F, 10000, neighbors);
+  EXPECT_EQ(neighbors.size(), 5000);
+  index.NearestNeighbors(0.F, std::numeric_limits<float>::infinity(), 0.F, 1, neighbors);
+  EXPECT_TRUE(neighbors.empty());
+}
+
+TEST(SpatialIndex, BoxSearch) {
+  const pb::PointFrame frame{MakeFrame(20000)};
+  const PointCloudView view{frame};
+  const SpatialIndex index{view};
+
+  pb::BoundingBox bounding_box;
+  bounding_box.mutable_base().set_x(10.F).set_y(5.F).set_z(-1.F);
+  bounding_box.mutable_size().set_x(8.F).set_y(3.F).set_z(2.F);
+  bounding_box.set_yaw(0.7F);
+  const OrientedBox box{OrientedBox::FromProto(bounding_box)};
+  EXPECT_EQ(box.center_z, 0.F);
+  EXPECT_EQ(box.half_length, 4.F);
+  EXPECT_EQ(box.half_width, 1.5F);
+  EXPECT_EQ(box.half_height, 1.F);
+
+  std::vector<std::uint32_t> expected;
+  for (std::uint32_t i{0}; i < view.size(); ++i) {
+    const float dx{view.x()[i] - 10.F};
+    const float dy{view.y()[i] - 5.F};
+    const float along{std::cos(0.7F) * dx + std::sin(0.7F) * dy};
+    const float across{std::cos(0.7F) * dy - std::sin(0.7F) * dx};
+    if (std::abs(along) <= 4.F && std::abs(across) <= 1.5F && std::abs(view.z()[i]) <= 1.F) {
+      expected.push_back(i);
+    }
+  }
+  ASSERT_FALSE(expected.empty());
+  std::vector<std::uint32_t> indices;
+  index.BoxSearch(box, indices);
+  EXPECT_EQ(Sorted(indices), expected);
+
+  OrientedBox far_box{box};
+  far_box.center_x = 500.F;
+  index.BoxSearch(far_box, indices);
+  EXPECT_TRUE(indices.empty());
+}
+
+TEST(SpatialIndex, AllThreadCountsBuildSameIndex) {
+  const pb::PointFrame frame{MakeFrame(100000)};
+  const PointCloudView view{frame};
+  const SpatialIndex expected{view};
+  std::vector<std::uint32_t> expected_indices;
+  expected.RadiusSearch(1.F, 2.F, 0.F, 3.F, expected_indices);
+  for (const std::size_t thread_count : {2, 3, 8}) {
+    SCOPED_TRACE(testing::Message() << thread_count << " threads");
+    const SpatialIndex index{view, 1.F, thread_count};
+    std::vector<std::uint32_t> indices;
+    index.RadiusSearch(1.F, 2.F, 0.F, 3.F, indices);
+    EXPECT_EQ(indices, expected_indices);
+  }
+}
+
+TEST(SpatialIndex, GrowsCellsOfSparseClouds) {
+  pb::PointFrame frame;
+  frame.mutable_points().mutable_flattened_points().Vector() = {-1e6F, -1e6F, 0.F, 1e6F,
+                                                                1e6F,  0.F,   0.F, 0.F, 0.F};
+  const PointCloudView view{frame};
+  const SpatialIndex index{view, 0.1F};
+  EXPECT_EQ(index.size(), 3);
+  EXPECT_GT(index.cell_size(), 0.1F);
+  EXPECT_LE(index.columns() * index.rows(), 1024);
+
+  std::vector<PointNeighbor> neighbors;
+  index.NearestNeighbors(9e5F, 9e5F, 0.F, 2, neighbors);
+  ASSERT_EQ(neighbors.size(), 2);
+  EXPECT_EQ(neighbors[0].index, 1);
+  EXPECT_EQ(neighbors[1].index, 2);
+}
+
+TEST(SpatialIndex, InvalidCellSize) {
+  const pb::PointFrame frame{MakeFrame(10)};
+  SpatialIndex index{PointCloudView{frame}};
+  EXPECT_EQ(index.size(), 10);
+  for (const float cell_size : {0.F, -1.F, std::numeric_limits<float>::infinity(),
+                                std::numeric_limits<float>::quiet_NaN()}) {
+    EXPECT_THROW(index.Assign(PointCloudView{frame}, cell_size), std::invalid_argument);
+    EXPECT_TRUE(index.empty());
+  }
+}
+
+TEST(SpatialIndex, ClearAndMove) {
+  const pb::PointFrame frame{MakeFrame(1000)};
+  const PointCloudView view{frame};
+  SpatialIndex index{view};
+  SpatialIndex moved{std::move(index)};
+  EXPECT_EQ(moved.size(), 1000);
+
+  moved.Clear();
+  EXPECT_TRUE(moved.empty());
+  std::vector<std::uint32_t> indices;
+  moved.RadiusSearch(0.F, 0.F, 0.F, 1000.F, indices);
+  EXPECT_TRUE(indices.empty());
+
+  moved.Assign(view);
+  moved.RadiusSearch(0.F, 0.F, 0.F, 1000.F, indices);
+  EXPECT_EQ(indices.size(), 1000);
+}
+
+TEST(SpatialIndex, DoesNotAllocateOnceWarm) {
+  const pb::PointFrame frame{MakeFrame(100000)};
+  const PointCloudView view{frame};
+  for (const std::size_t thread_count : {1, 3}) {
+    SCOPED_TRACE(testing::Message() << thread_count << " threads");
+    SpatialIndex index;
+    index.Assign(view, 1.F, thread_count);
+
+    const std::size_t allocation_count{ProcessAllocationCount()};
+    for (std::int32_t frame_index{0}; frame_index < 10; ++frame_index) {
+      index.Assign(view, 1.F, thread_count);
+    }
+    EXPECT_EQ(ProcessAllocationCount(), allocation_count);
+    EXPECT_EQ(index.size(), 100000);
+  }
+}
+
+}  // namespace
+}  // namespace sdk
+}  // namespace horus
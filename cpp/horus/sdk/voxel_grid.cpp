@@ -0,0 +1,433 @@
+#include "horus/sdk/voxel_grid.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "horus/pb/cow.h"
+#include "horus/pb/point/point_message_pb.h"
+#include "horus/pointer/arithmetic.h"
+#include "horus/sdk/internal/parallel_for.h"
+#include "horus/sdk/internal/simd_dispatch.h"
+#include "horus/sdk/point_attribute_filter.h"
+#include "horus/sdk/point_cloud_view.h"
+#include "horus/sdk/simd.h"
+#include "horus/types/span.h"
+
+namespace horus {
+namespace sdk {
+namespace {
+
+/// The key of points which are out of the grid (or not finite). Voxel keys only use 63 bits, so
+/// they never collide with it.
+constexpr std::uint64_t kInvalidKey{~std::uint64_t{0}};
+
+/// The key of empty slots in the hash table.
+constexpr std::uint64_t kEmptySlot{~std::uint64_t{0}};
+
+/// Number of bits of each voxel coordinate in a voxel key.
+constexpr std::uint32_t kVoxelCoordinateBits{21};
+
+/// Voxel coordinates must be in `[-kVoxelBias, kVoxelBias)`, and are stored biased by `kVoxelBias`
+/// in voxel keys.
+constexpr std::int32_t kVoxelBias{1 << (kVoxelCoordinateBits - 1)};
+
+/// `kVoxelBias` as a float.
+constexpr float kVoxelRange{static_cast<float>(kVoxelBias)};
+
+/// Minimum number of slots in the hash table.
+constexpr std::size_t kMinSlotCount{64};
+
+/// Multiplier of the Fibonacci hash of voxel keys.
+constexpr std::uint64_t kHashMultiplier{0x9E3779B97F4A7C15};
+
+/// Returns the number of slots of a hash table holding `size` voxels: a power of two, with a load
+/// factor of at most 1/2.
+std::size_t SlotCountFor(std::size_t size) noexcept {
+  std::size_t count{kMinSlotCount};
+  while (count < 2 * size) {
+    count *= 2;
+  }
+  return count;
+}
+
+/// Resizes `vector` to at least `size` values, without shrinking it.
+template <class T>
+T* GrowVector(std::vector<T>& vector, std::size_t size) {
+  if (vector.size() < size) {
+    vector.resize(size);
+  }
+  return vector.data();
+}
+
+/// Returns the slot of the hash table of `key` (and `attributes` if `split`).
+std::size_t HashSlot(std::uint64_t key, std::uint16_t attributes, bool split,
+                     std::uint32_t shift) noexcept {
+  const std::uint64_t hashed{split ? key ^ std::uint64_t{attributes} << 48 : key};
+  return static_cast<std::size_t>((hashed * kHashMultiplier) >> shift);
+}
+
+/// The hash table of a `VoxelGrid`.
+struct SlotTable {
+  /// The voxel keys of the slots, or `kEmptySlot`.
+  std::uint64_t* keys;
+  /// The attributes of the voxels in the slots.
+  std::uint16_t* attributes;
+  /// The index of the voxels in the slots.
+  std::uint32_t* voxels;
+  /// The number of slots minus one.
+  std::size_t mask;
+  /// Number of bits to shift hashes right by to get a slot index.
+  std::uint32_t shift;
+};
+
+/// Returns the `SlotTable` of the given slots.
+SlotTable MakeSlotTable(std::vector<std::uint64_t>& keys, std::vector<std::uint16_t>& attributes,
+                        std::vector<std::uint32_t>& voxels, std::size_t mask,
+                        std::uint32_t shift) noexcept {
+  return {keys.data(), attributes.data(), voxels.data(), mask, shift};
+}
+
+/// Returns the index of the voxel with the given key (and attributes if `split`) in `table`,
+/// inserting it with index `new_voxel` if it is not found.
+inline std::uint32_t FindOrInsertVoxel(const SlotTable& table, std::uint64_t key,
+                                       std::uint16_t attributes, bool split,
+                                       std::uint32_t new_voxel) noexcept {
+  for (std::size_t slot{HashSlot(key, attributes, split, table.shift)};;
+       slot = (slot + 1) & table.mask) {
+    const std::uint64_t slot_key{*PointerAdd(table.keys, slot)};
+    if (slot_key == kEmptySlot) {
+      *PointerAdd(table.keys, slot) = key;
+      *PointerAdd(table.attributes, slot) = attributes;
+      *PointerAdd(table.voxels, slot) = new_voxel;
+      return new_voxel;
+    }
+    if (slot_key == key && (!split || *PointerAdd(table.attributes, slot) == attributes)) {
+      return *PointerAdd(table.voxels, slot);
+    }
+  }
+}
+
+/// The coordinates of the points whose voxel keys are computed.
+struct KeyInput {
+  /// The x coordinates.
+  const float* x;
+  /// The y coordinates.
+  const float* y;
+  /// The z coordinates.
+  const float* z;
+  /// The inverse of the size of the voxels.
+  float inverse_leaf_size;
+};
+
+/// Writes the voxel keys of the points `[begin, end)` of `input` to `keys`.
+void ComputeKeysScalar(const KeyInput& input, std::size_t begin, std::size_t end,
+                       std::uint64_t* keys) noexcept {
+  for (std::size_t i{begin}; i < end; ++i) {
+    std::uint64_t key{0};
+    for (const float* const coordinates : {input.x, input.y, input.z}) {
+      const float scaled{*PointerAdd(coordinates, i) * input.inverse_leaf_size};
+      if (!(scaled >= -kVoxelRange && scaled < kVoxelRange)) {
+        key = kInvalidKey;
+        break;
+      }
+      // Truncate, then round towards negative infinity; `std::floor()` is a function call without
+      // SSE4.1.
+      auto voxel = static_cast<std::int32_t>(scaled);
+      voxel -= static_cast<float>(voxel) > scaled ? 1 : 0;
+      key = key << kVoxelCoordinateBits | static_cast<std::uint64_t>(voxel + kVoxelBias);
+    }
+    *PointerAdd(keys, i) = key;
+  }
+}
+
+#if HORUS_SDK_SIMD_X86
+
+// NOLINTBEGIN(*-reinterpret-cast,*-pointer-arithmetic)
+
+/// Returns the biased voxel coordinates of `values`, clearing the lanes of `valid` whose values are
+/// out of the grid.
+__attribute__((target("sse4.1"))) inline __m128i VoxelCoordinatesSse41(__m128 values,
+                                                                        __m128 inverse_leaf_size,
+                                                                        __m128i& valid) noexcept {
+  const __m128 scaled{_mm_mul_ps(values, inverse_leaf_size)};
+  valid = _mm_and_si128(
+      valid, _mm_castps_si128(_mm_and_ps(_mm_cmpge_ps(scaled, _mm_set1_ps(-kVoxelRange)),
+                                         _mm_cmplt_ps(scaled, _mm_set1_ps(kVoxelRange)))));
+  return _mm_add_epi32(_mm_cvttps_epi32(_mm_floor_ps(scaled)), _mm_set1_epi32(kVoxelBias));
+}
+
+/// Returns the voxel keys of the 2 low lanes of the given biased voxel coordinates.
+__attribute__((target("sse4.1"))) inline __m128i VoxelKeysSse41(__m128i x, __m128i y, __m128i z,
+                                                                 __m128i invalid) noexcept {
+  const __m128i keys{
+      _mm_or_si128(_mm_or_si128(_mm_slli_epi64(_mm_cvtepu32_epi64(x), 2 * kVoxelCoordinateBits),
+                                _mm_slli_epi64(_mm_cvtepu32_epi64(y), kVoxelCoordinateBits)),
+                   _mm_cvtepu32_epi64(z))};
+  return _mm_or_si128(keys, _mm_cvtepi32_epi64(invalid));
+}
+
+/// Writes the voxel keys of the points of `input` to `keys`, 4 points at a time. Returns the number
+/// of processed points.
+__attribute__((target("sse4.1"))) std::size_t ComputeKeysSse41(const KeyInput& input,
+                                                                std::size_t size,
+                                                                std::uint64_t* keys) noexcept {
+  const __m128 inverse_leaf_size{_mm_set1_ps(input.inverse_leaf_size)};
+  std::size_t i{0};
+  for (; i + 4 <= size; i += 4) {
+    __m128i valid{_mm_set1_epi32(-1)};
+    const __m128i x{VoxelCoordinatesSse41(_mm_loadu_ps(input.x + i), inverse_leaf_size, valid)};
+    const __m128i y{VoxelCoordinatesSse41(_mm_loadu_ps(input.y + i), inverse_leaf_size, valid)};
+    const __m128i z{VoxelCoordinatesSse41(_mm_loadu_ps(input.z + i), inverse_leaf_size, valid)};
+    const __m128i invalid{_mm_cmpeq_epi32(valid, _mm_setzero_si128())};
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(keys + i), VoxelKeysSse41(x, y, z, invalid));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(keys + i + 2),
+                     VoxelKeysSse41(_mm_srli_si128(x, 8), _mm_srli_si128(y, 8),
+                                    _mm_srli_si128(z, 8), _mm_srli_si128(invalid, 8)));
+  }
+  return i;
+}
+
+/// Returns the biased voxel coordinates of `values`, clearing the lanes of `valid` whose values are
+/// out of the grid.
+__attribute__((target("avx2"))) inline __m256i VoxelCoordinatesAvx2(__m256 values,
+                                                                     __m256 inverse_leaf_size,
+                                                                     __m256i& valid) noexcept {
+  const __m256 scaled{_mm256_mul_ps(values, inverse_leaf_size)};
+  valid = _mm256_and_si256(
+      valid, _mm256_castps_si256(
+                 _mm256_and_ps(_mm256_cmp_ps(scaled, _mm256_set1_ps(-kVoxelRange), _CMP_GE_OQ),
+                               _mm256_cmp_ps(scaled, _mm256_set1_ps(kVoxelRange), _CMP_LT_OQ))));
+  return _mm256_add_epi32(_mm256_cvttps_epi32(_mm256_floor_ps(scaled)),
+                          _mm256_set1_epi32(kVoxelBias));
+}
+
+/// Returns the voxel keys of the given biased voxel coordinates.
+__attribute__((target("avx2"))) inline __m256i VoxelKeysAvx2(__m128i x, __m128i y, __m128i z,
+                                                              __m128i invalid) noexcept {
+  const __m256i keys{_mm256_or_si256(
+      _mm256_or_si256(_mm256_slli_epi64(_mm256_cvtepu32_epi64(x), 2 * kVoxelCoordinateBits),
+                      _mm256_slli_epi64(_mm256_cvtepu32_epi64(y), kVoxelCoordinateBits)),
+      _mm256_cvtepu32_epi64(z))};
+  return _mm256_or_si256(keys, _mm256_cvtepi32_epi64(invalid));
+}
+
+/// Writes the voxel keys of the points of `input` to `keys`, 8 points at a time. Returns the number
+/// of processed points.
+__attribute__((target("avx2"))) std::size_t ComputeKeysAvx2(const KeyInput& input,
+                                                             std::size_t size,
+                                                             std::uint64_t* keys) noexcept {
+  const __m256 inverse_leaf_size{_mm256_set1_ps(input.inverse_leaf_size)};
+  std::size_t i{0};
+  for (; i + 8 <= size; i += 8) {
+    __m256i valid{_mm256_set1_epi32(-1)};
+    const __m256i x{
+        VoxelCoordinatesAvx2(_mm256_loadu_ps(input.x + i), inverse_leaf_size, valid)};
+    const __m256i y{
+        VoxelCoordinatesAvx2(_mm256_loadu_ps(input.y + i), inverse_leaf_size, valid)};
+    const __m256i z{
+        VoxelCoordinatesAvx2(_mm256_loadu_ps(input.z + i), inverse_leaf_size, valid)};
+    const __m256i invalid{_mm256_cmpeq_epi32(valid, _mm256_setzero_si256())};
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(keys + i),
+                        VoxelKeysAvx2(_mm256_castsi256_si128(x), _mm256_castsi256_si128(y),
+                                      _mm256_castsi256_si128(z),
+                                      _mm256_castsi256_si128(invalid)));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(keys + i + 4),
+                        VoxelKeysAvx2(_mm256_extracti128_si256(x, 1),
+                                      _mm256_extracti128_si256(y, 1),
+                                      _mm256_extracti128_si256(z, 1),
+                                      _mm256_extracti128_si256(invalid, 1)));
+  }
+  return i;
+}
+
+// NOLINTEND(*-reinterpret-cast,*-pointer-arithmetic)
+
+#endif  // HORUS_SDK_SIMD_X86
+
+/// Writes the voxel keys of the `size` points of `input` to `keys`.
+void ComputeKeys(const KeyInput& input, std::size_t size, std::uint64_t* keys,
+                 SimdLevel level) noexcept {
+  const std::size_t done{HORUS_SDK_SIMD_DISPATCH(level, ComputeKeysSse41(input, size, keys),
+                                                 ComputeKeysAvx2(input, size, keys))};
+  ComputeKeysScalar(input, done, size, keys);
+}
+
+}  // namespace
+
+void VoxelGrid::Assign(const pb::AttributedPoints& points, const VoxelGridOptions& options,
+                       SimdLevel level) {
+  // Copy the options, since they could otherwise alias the buffers written below.
+  const float leaf_size{options.leaf_size};
+  const PointAttributeFilter filter{options.filter};
+  const bool centroid{options.voxel_point == VoxelPoint::kCentroid};
+  const bool split{options.split_by_attributes};
+  if (!(leaf_size > 0.F)) {
+    throw std::invalid_argument{"voxel leaf size must be positive"};
+  }
+
+  const std::size_t previous_size{size_};
+  size_ = 0;
+  view_.Assign(points, level);
+  const std::size_t point_count{view_.size()};
+  const Span<const std::uint16_t> point_attributes{view_.attributes()};
+  const Span<const std::uint16_t> point_intensities{view_.intensities()};
+  has_intensities_ = !point_intensities.empty();
+
+  std::uint64_t* const keys{GrowVector(point_keys_, point_count)};
+  ComputeKeys({view_.x().data(), view_.y().data(), view_.z().data(), 1.F / leaf_size},
+              point_count, keys, level);
+
+  ResetSlots(SlotCountFor(std::min(previous_size, point_count)));
+  SlotTable table{
+      MakeSlotTable(slot_keys_, slot_attributes_, slot_voxels_, slot_mask_, slot_shift_)};
+  float* const x{GrowVector(x_, point_count)};
+  float* const y{GrowVector(y_, point_count)};
+  float* const z{GrowVector(z_, point_count)};
+  std::uint16_t* const attributes{GrowVector(attributes_, point_count)};
+  std::uint16_t* const intensities{GrowVector(intensities_, has_intensities_ ? point_count : 0)};
+  std::uint32_t* const intensity_sums{
+      GrowVector(intensity_sums_, has_intensities_ && centroid ? point_count : 0)};
+  std::uint32_t* const point_counts{GrowVector(point_counts_, point_count)};
+  std::uint64_t* const voxel_keys{GrowVector(voxel_keys_, point_count)};
+
+  const float* const xs{view_.x().data()};
+  const float* const ys{view_.y().data()};
+  const float* const zs{view_.z().data()};
+  for (std::size_t i{0}; i < point_count; ++i) {
+    const std::uint64_t key{*PointerAdd(keys, i)};
+    if (key == kInvalidKey) {
+      continue;
+    }
+    const std::uint16_t point_attribute{point_attributes.empty() ? std::uint16_t{0}
+                                                                 : point_attributes[i]};
+    if (!filter.Keeps(point_attribute)) {
+      continue;
+    }
+    if (2 * (size_ + 1) > table.mask + 1) {
+      GrowSlots(split);
+      table = MakeSlotTable(slot_keys_, slot_attributes_, slot_voxels_, slot_mask_, slot_shift_);
+    }
+    const std::uint32_t voxel{FindOrInsertVoxel(table, key, point_attribute, split,
+                                                static_cast<std::uint32_t>(size_))};
+    const std::uint16_t intensity{has_intensities_ ? point_intensities[i] : std::uint16_t{0}};
+
+    if (voxel == size_) {
+      ++size_;
+      *PointerAdd(voxel_keys, voxel) = key;
+      *PointerAdd(x, voxel) = *PointerAdd(xs, i);
+      *PointerAdd(y, voxel) = *PointerAdd(ys, i);
+      *PointerAdd(z, voxel) = *PointerAdd(zs, i);
+      *PointerAdd(attributes, voxel) = point_attribute;
+      *PointerAdd(point_counts, voxel) = 1;
+      if (has_intensities_) {
+        *PointerAdd(intensities, voxel) = intensity;
+        if (centroid) {
+          *PointerAdd(intensity_sums, voxel) = intensity;
+        }
+      }
+      continue;
+    }
+    ++*PointerAdd(point_counts, voxel);
+    if (centroid) {
+      *PointerAdd(x, voxel) += *PointerAdd(xs, i);
+      *PointerAdd(y, voxel) += *PointerAdd(ys, i);
+      *PointerAdd(z, voxel) += *PointerAdd(zs, i);
+      *PointerAdd(attributes, voxel) |= point_attribute;
+      if (has_intensities_) {
+        *PointerAdd(intensity_sums, voxel) += intensity;
+      }
+    }
+  }
+
+  if (centroid) {
+    for (std::size_t voxel{0}; voxel < size_; ++voxel) {
+      const std::uint32_t count{*PointerAdd(point_counts, voxel)};
+      if (count == 1) {
+        continue;
+      }
+      const float scale{1.F / static_cast<float>(count)};
+      *PointerAdd(x, voxel) *= scale;
+      *PointerAdd(y, voxel) *= scale;
+      *PointerAdd(z, voxel) *= scale;
+      if (has_intensities_) {
+        *PointerAdd(intensities, voxel) =
+            static_cast<std::uint16_t>((*PointerAdd(intensity_sums, voxel) + count / 2) / count);
+      }
+    }
+  }
+}
+
+void VoxelGrid::ResetSlots(std::size_t slot_count) {
+  slot_mask_ = slot_count - 1;
+  slot_shift_ = 64;
+  for (std::size_t count{slot_count}; count > 1; count /= 2) {
+    --slot_shift_;
+  }
+  std::fill_n(GrowVector(slot_keys_, slot_count), slot_count, kEmptySlot);
+  static_cast<void>(GrowVector(slot_attributes_, slot_count));
+  static_cast<void>(GrowVector(slot_voxels_, slot_count));
+}
+
+void VoxelGrid::GrowSlots(bool split) {
+  ResetSlots(2 * (slot_mask_ + 1));
+  const SlotTable table{
+      MakeSlotTable(slot_keys_, slot_attributes_, slot_voxels_, slot_mask_, slot_shift_)};
+  for (std::size_t voxel{0}; voxel < size_; ++voxel) {
+    static_cast<void>(FindOrInsertVoxel(table, voxel_keys_[voxel], attributes_[voxel], split,
+                                        static_cast<std::uint32_t>(voxel)));
+  }
+}
+
+void VoxelGridBatch::Assign(Span<const pb::PointFrame* const> frames,
+                            const VoxelGridOptions& options, std::size_t thread_count) {
+  grid_count_ = 0;
+  if (grids_.size() < frames.size()) {
+    grids_.resize(frames.size());
+  }
+  const std::size_t worker_count{std::max<std::size_t>(1, std::min(thread_count, frames.size()))};
+  if (worker_count > 1 && workers_ == nullptr) {
+    workers_ = std::make_unique<horus_internal::WorkerThreads>();
+  }
+  const auto downsample = [this, frames, &options](std::size_t /*worker*/, std::size_t i) {
+    grids_[i].Assign(*frames[i], options);
+  };
+  if (worker_count == 1) {
+    for (std::size_t i{0}; i < frames.size(); ++i) {
+      downsample(0, i);
+    }
+  } else {
+    static_cast<void>(workers_->ParallelFor(frames.size(), worker_count, downsample));
+  }
+  grid_count_ = frames.size();
+}
+
+void VoxelGridBatch::Assign(const pb::AggregatedPointEvents& events,
+                            const VoxelGridOptions& options, std::size_t thread_count) {
+  // Received events are decoded on iteration, so they are kept alive while frames are downsampled.
+  decoded_events_.clear();
+  for (Cow<pb::ProcessedPointsEvent> event : events.events()) {
+    decoded_events_.push_back(std::move(event));
+  }
+  frames_.clear();
+  for (const Cow<pb::ProcessedPointsEvent>& event : decoded_events_) {
+    frames_.push_back(&event.Ref().point_frame());
+  }
+  try {
+    Assign(frames_, options, thread_count);
+  } catch (...) {
+    frames_.clear();
+    decoded_events_.clear();
+    throw;
+  }
+  frames_.clear();
+  decoded_events_.clear();
+}
+
+}  // namespace sdk
+}  // namespace horus
@@ -0,0 +1,241 @@
+/// @file
+///
+/// The `VoxelGrid` and `VoxelGridBatch` classes.
+
+#ifndef HORUS_SDK_VOXEL_GRID_H_
+#define HORUS_SDK_VOXEL_GRID_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "horus/attributes.h"
+#include "horus/pb/cow.h"
+#include "horus/pb/point/point_message_pb.h"
+#include "horus/sdk/internal/parallel_for.h"
+#include "horus/sdk/point_attribute_filter.h"
+#include "horus/sdk/point_cloud_view.h"
+#include "horus/sdk/simd.h"
+#include "horus/types/span.h"
+
+namespace horus {
+namespace sdk {
+
+/// The point kept for each voxel by a `VoxelGrid`.
+enum class VoxelPoint : std::uint8_t {
+  /// The centroid of the points in the voxel. Its intensity is the mean of their intensities, and
+  /// its attributes are the union of their attributes.
+  kCentroid,
+  /// The first point (in frame order) in the voxel, with its intensity and attributes.
+  kFirst,
+};
+
+/// Options of a `VoxelGrid`.
+struct VoxelGridOptions {
+  /// The edge length of the voxels, in meters. Must be positive.
+  ///
+  /// Points further than 2^20 voxels from the origin on any axis are dropped.
+  float leaf_size{0.1F};
+
+  /// The point kept for each voxel.
+  VoxelPoint voxel_point{VoxelPoint::kCentroid};
+
+  /// Points which are not kept by this filter are dropped before being binned.
+  PointAttributeFilter filter{};
+
+  /// If true, points with different attributes are binned separately, e.g. so that ground and
+  /// obstacle points in the same voxel remain distinct.
+  bool split_by_attributes{false};
+};
+
+/// Downsamples point clouds by keeping one point per occupied voxel of a regular grid.
+///
+/// The voxel keys of the points are computed with SIMD instructions over the structure-of-arrays
+/// `PointCloudView` of the frame, then the points are binned in a single pass with an
+/// open-addressing hash table keyed by voxel. The table is sized after the number of voxels of the
+/// previous frame, so that it stays small enough to remain in cache. Voxels are output in the order
+/// of their first point.
+///
+/// A `VoxelGrid` reuses its buffers when assigned new points, so a grid per lidar (or per thread)
+/// does not allocate once it has seen the largest frame.
+class VoxelGrid final {
+ public:
+  /// Constructs an empty grid.
+  VoxelGrid() noexcept = default;
+
+  /// Grids cannot be copied.
+  VoxelGrid(const VoxelGrid&) = delete;
+  /// Grids cannot be copied.
+  VoxelGrid& operator=(const VoxelGrid&) = delete;
+  /// Move constructor.
+  VoxelGrid(VoxelGrid&&) noexcept = default;
+  /// Move assignment operator.
+  VoxelGrid& operator=(VoxelGrid&&) noexcept = default;
+
+  /// Destroys the grid.
+  ~VoxelGrid() noexcept = default;
+
+  /// Replaces the contents of the grid by the downsampled `points`, using the given instruction set
+  /// (which must be supported by the CPU).
+  ///
+  /// @throws std::invalid_argument If `options.leaf_size` is not positive.
+  /// @throws std::bad_alloc If the buffers of the grid cannot be allocated.
+  void Assign(const pb::AttributedPoints& points, const VoxelGridOptions& options,
+              SimdLevel level = BestSimdLevel()) noexcept(false);
+
+  /// Replaces the contents of the grid by the downsampled points of `frame`, using the given
+  /// instruction set (which must be supported by the CPU).
+  ///
+  /// @throws std::invalid_argument If `options.leaf_size` is not positive.
+  /// @throws std::bad_alloc If the buffers of the grid cannot be allocated.
+  void Assign(const pb::PointFrame& frame, const VoxelGridOptions& options,
+              SimdLevel level = BestSimdLevel()) noexcept(false) {
+    Assign(frame.points(), options, level);
+  }
+
+  /// Empties the grid, keeping its buffers.
+  void Clear() noexcept { size_ = 0; }
+
+  /// Returns the number of occupied voxels, i.e. the number of downsampled points.
+  std::size_t size() const noexcept { return size_; }
+  /// Returns whether `size() == 0`.
+  bool empty() const noexcept { return size_ == 0; }
+
+  /// Returns the x coordinates of the downsampled points.
+  Span<const float> x() const noexcept HORUS_LIFETIME_BOUND { return {x_.data(), size_}; }
+  /// Returns the y coordinates of the downsampled points.
+  Span<const float> y() const noexcept HORUS_LIFETIME_BOUND { return {y_.data(), size_}; }
+  /// Returns the z coordinates of the downsampled points.
+  Span<const float> z() const noexcept HORUS_LIFETIME_BOUND { return {z_.data(), size_}; }
+
+  /// Returns the `pb::PointAttribute` flags of the downsampled points.
+  Span<const std::uint16_t> attributes() const noexcept HORUS_LIFETIME_BOUND {
+    return {attributes_.data(), size_};
+  }
+
+  /// Returns the intensities of the downsampled points, or an empty span if the points had no
+  /// intensities.
+  Span<const std::uint16_t> intensities() const noexcept HORUS_LIFETIME_BOUND {
+    if (!has_intensities_) {
+      return {};
+    }
+    return {intensities_.data(), size_};
+  }
+
+  /// Returns the number of input points in the voxel of each downsampled point.
+  Span<const std::uint32_t> point_counts() const noexcept HORUS_LIFETIME_BOUND {
+    return {point_counts_.data(), size_};
+  }
+
+ private:
+  /// Empties the hash table, resizing it to `slot_count` slots (a power of two).
+  void ResetSlots(std::size_t slot_count) noexcept(false);
+
+  /// Doubles the number of slots of the hash table, and inserts the current voxels in it again.
+  void GrowSlots(bool split) noexcept(false);
+
+  /// The structure-of-arrays points being downsampled.
+  PointCloudView view_;
+  /// The voxel key of each point being downsampled, or `kInvalidKey` for points out of the grid.
+  std::vector<std::uint64_t> point_keys_;
+
+  /// The voxel keys of the slots of the hash table, or `kEmptySlot`. The number of slots is a power
+  /// of two, and may be smaller than the size of the vectors.
+  std::vector<std::uint64_t> slot_keys_;
+  /// The attributes of the voxels in the slots of the hash table, when splitting by attributes.
+  std::vector<std::uint16_t> slot_attributes_;
+  /// The index of the voxels in the slots of the hash table.
+  std::vector<std::uint32_t> slot_voxels_;
+  /// The number of slots of the hash table minus one.
+  std::size_t slot_mask_{0};
+  /// Number of bits to shift hashes right by to get a slot index.
+  std::uint32_t slot_shift_{64};
+
+  /// Number of occupied voxels.
+  std::size_t size_{0};
+  /// Whether `intensities()` is available.
+  bool has_intensities_{false};
+  /// @see x()
+  std::vector<float> x_;
+  /// @see y()
+  std::vector<float> y_;
+  /// @see z()
+  std::vector<float> z_;
+  /// @see attributes()
+  std::vector<std::uint16_t> attributes_;
+  /// @see intensities()
+  std::vector<std::uint16_t> intensities_;
+  /// Sum of the intensities of the points of each voxel, for `VoxelPoint::kCentroid`.
+  std::vector<std::uint32_t> intensity_sums_;
+  /// @see point_counts()
+  std::vector<std::uint32_t> point_counts_;
+  /// The key of each voxel.
+  std::vector<std::uint64_t> voxel_keys_;
+};
+
+/// The `VoxelGrid`s of a batch of point frames (e.g. the frames of all lidars in an
+/// `AggregatedPointEvents` batch), downsampled by several threads.
+///
+/// A `VoxelGridBatch` reuses its grids and threads when assigned new frames: once it has seen the
+/// largest batch, downsampling frames from a span neither starts threads nor allocates.
+class VoxelGridBatch final {
+ public:
+  /// Constructs an empty batch.
+  VoxelGridBatch() noexcept = default;
+
+  /// Batches cannot be copied.
+  VoxelGridBatch(const VoxelGridBatch&) = delete;
+  /// Batches cannot be copied.
+  VoxelGridBatch& operator=(const VoxelGridBatch&) = delete;
+  /// Move constructor.
+  VoxelGridBatch(VoxelGridBatch&&) noexcept = default;
+  /// Move assignment operator.
+  VoxelGridBatch& operator=(VoxelGridBatch&&) noexcept = default;
+
+  /// Destroys the batch.
+  ~VoxelGridBatch() noexcept = default;
+
+  /// Downsamples `frames` with `options`, storing the points of `frames[i]` in `grids()[i]`.
+  ///
+  /// The frames are distributed over `thread_count` threads, including the calling thread.
+  ///
+  /// @throws std::invalid_argument If `options.leaf_size` is not positive.
+  /// @throws std::bad_alloc If the buffers of the grids cannot be allocated.
+  /// @throws std::system_error If a thread cannot be started.
+  void Assign(Span<const pb::PointFrame* const> frames, const VoxelGridOptions& options,
+              std::size_t thread_count = 1) noexcept(false);
+
+  /// Downsamples the frames of `events` with `options`.
+  ///
+  /// @see Assign()
+  void Assign(const pb::AggregatedPointEvents& events, const VoxelGridOptions& options,
+              std::size_t thread_count = 1) noexcept(false);
+
+  /// Empties the batch, keeping its grids.
+  void Clear() noexcept { grid_count_ = 0; }
+
+  /// Returns the grid of each downsampled frame, in the order of the frames.
+  Span<const VoxelGrid> grids() const noexcept HORUS_LIFETIME_BOUND {
+    return {grids_.data(), grid_count_};
+  }
+
+ private:
+  /// The grids of the frames; only the first `grid_count_` are used, so that the others keep their
+  /// buffers.
+  std::vector<VoxelGrid> grids_;
+  /// Number of downsampled frames.
+  std::size_t grid_count_{0};
+  /// The threads downsampling frames along with the calling thread, started on first use.
+  std::unique_ptr<horus_internal::WorkerThreads> workers_;
+  /// The decoded events of the batch being downsampled by
+  /// `Assign(const pb::AggregatedPointEvents&)`.
+  std::vector<Cow<pb::ProcessedPointsEvent>> decoded_events_;
+  /// The frames of the batch being downsampled by `Assign(const pb::AggregatedPointEvents&)`.
+  std::vector<const pb::PointFrame*> frames_;
+};
+
+}  // namespace sdk
+}  // namespace horus
+
+#endif  // HORUS_SDK_VOXEL_GRID_H_
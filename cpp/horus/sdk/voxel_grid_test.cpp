@@ -0,0 +1,269 @@
+#include "horus/sdk/voxel_grid.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "horus/pb/buffer.h"
+#include "horus/pb/point/point_message_pb.h"
+#include "horus/pb/serialize.h"
+#include "horus/sdk/point_attribute_filter.h"
+#include "horus/sdk/simd.h"
+#include "horus/testing/allocations.h"
+#include "horus/testing/point_clouds.h"
+#include "horus/types/span.h"
+
+namespace horus {
+namespace sdk {
+namespace {
+
+/// A point given to `MakePoints()`.
+struct TestPoint {
+  /// The coordinates of the point.
+  std::array<float, 3> xyz;
+  /// The attributes of the point.
+  std::uint16_t attributes;
+  /// The intensity of the point.
+  std::uint16_t intensity;
+};
+
+/// Returns the `AttributedPoints` with the given points.
+pb::AttributedPoints MakePoints(const std::vector<TestPoint>& test_points) {
+  pb::AttributedPoints points;
+  std::vector<float>& xyz{points.mutable_flattened_points().Vector()};
+  std::vector<std::uint32_t>& attributes{points.mutable_attributes().Vector()};
+  std::vector<std::uint32_t>& intensities{points.mutable_intensities().Vector()};
+  for (std::size_t i{0}; i < test_points.size(); ++i) {
+    const TestPoint& point{test_points[i]};
+    xyz.insert(xyz.end(), point.xyz.begin(), point.xyz.end());
+    if (i % 2 == 0) {
+      attributes.push_back(point.attributes);
+      intensities.push_back(point.intensity);
+    } else {
+      attributes.back() |= static_cast<std::uint32_t>(point.attributes) << 16;
+      intensities.back() |= static_cast<std::uint32_t>(point.intensity) << 16;
+    }
+  }
+  return points;
+}
+
+/// Points in two voxels of size 1.
+const std::vector<TestPoint> kPoints{
+    {{{0.25F, 0.25F, 0.25F}}, 0, 10},
+    {{{-0.5F, 0.5F, 0.5F}}, 2, 20},
+    {{{0.75F, 0.75F, 0.75F}}, 4, 21},
+    {{{-0.25F, 0.25F, 0.75F}}, 0, 40},
+    {{{0.5F, 0.5F, 0.5F}}, 2, 30},
+};
+
+TEST(VoxelGrid, Centroid) {
+  VoxelGrid grid;
+  grid.Assign(MakePoints(kPoints), VoxelGridOptions{1.F});
+  ASSERT_EQ(grid.size(), 2);
+  EXPECT_FLOAT_EQ(grid.x()[0], 0.5F);
+  EXPECT_FLOAT_EQ(grid.y()[0], 0.5F);
+  EXPECT_FLOAT_EQ(grid.z()[0], 0.5F);
+  EXPECT_EQ(grid.attributes()[0], 6);
+  EXPECT_EQ(grid.intensities()[0], 20);
+  EXPECT_EQ(grid.point_counts()[0], 3);
+  EXPECT_FLOAT_EQ(grid.x()[1], -0.375F);
+  EXPECT_FLOAT_EQ(grid.y()[1], 0.375F);
+  EXPECT_FLOAT_EQ(grid.z()[1], 0.625F);
+  EXPECT_EQ(grid.attributes()[1], 2);
+  EXPECT_EQ(grid.intensities()[1], 30);
+  EXPECT_EQ(grid.point_counts()[1], 2);
+}
+
+TEST(VoxelGrid, FirstPoint) {
+  VoxelGrid grid;
+  grid.Assign(MakePoints(kPoints), VoxelGridOptions{1.F, VoxelPoint::kFirst});
+  ASSERT_EQ(grid.size(), 2);
+  EXPECT_EQ(grid.x()[0], 0.25F);
+  EXPECT_EQ(grid.attributes()[0], 0);
+  EXPECT_EQ(grid.intensities()[0], 10);
+  EXPECT_EQ(grid.point_counts()[0], 3);
+  EXPECT_EQ(grid.x()[1], -0.5F);
+  EXPECT_EQ(grid.attributes()[1], 2);
+  EXPECT_EQ(grid.intensities()[1], 20);
+}
+
+TEST(VoxelGrid, Attributes) {
+  VoxelGrid grid;
+  VoxelGridOptions options{1.F, VoxelPoint::kFirst};
+  options.filter.Exclude(pb::PointAttribute::kGround);
+  grid.Assign(MakePoints(kPoints), options);
+  ASSERT_EQ(grid.size(), 2);
+  EXPECT_EQ(grid.point_counts()[0], 2);
+  EXPECT_EQ(grid.point_counts()[1], 1);
+  EXPECT_EQ(grid.x()[1], -0.25F);
+
+  options.filter = PointAttributeFilter{};
+  options.split_by_attributes = true;
+  grid.Assign(MakePoints(kPoints), options);
+  ASSERT_EQ(grid.size(), 5);
+  options.split_by_attributes = false;
+  grid.Assign(MakePoints(kPoints), options);
+  EXPECT_EQ(grid.size(), 2);
+
+  pb::AttributedPoints points{MakePoints(kPoints)};
+  points.clear_attributes();
+  points.clear_intensities();
+  grid.Assign(points, options);
+  ASSERT_EQ(grid.size(), 2);
+  EXPECT_EQ(grid.attributes()[0], 0);
+  EXPECT_TRUE(grid.intensities().empty());
+}
+
+TEST(VoxelGrid, InvalidPoints) {
+  VoxelGrid grid;
+  EXPECT_THROW(grid.Assign(MakePoints(kPoints), VoxelGridOptions{0.F}), std::invalid_argument);
+  EXPECT_THROW(grid.Assign(MakePoints(kPoints),
+                           VoxelGridOptions{std::numeric_limits<float>::quiet_NaN()}),
+               std::invalid_argument);
+
+  grid.Assign(MakePoints({
+                  {{{std::numeric_limits<float>::quiet_NaN(), 0.F, 0.F}}, 0, 0},
+                  {{{0.F, std::numeric_limits<float>::infinity(), 0.F}}, 0, 0},
+                  {{{0.F, 0.F, 1e9F}}, 0, 0},
+                  {{{0.F, 0.F, -1e5F}}, 0, 0},
+              }),
+              VoxelGridOptions{0.1F});
+  ASSERT_EQ(grid.size(), 1);
+  EXPECT_EQ(grid.z()[0], -1e5F);
+}
+
+TEST(VoxelGrid, AllLevelsBinSamePoints) {
+  std::vector<TestPoint> test_points;
+  for (std::size_t i{0}; i < 1001; ++i) {
+    const auto value = static_cast<float>(i * 7919 % 2001) * 0.01F - 10.F;
+    test_points.push_back({{{value, -value * 0.5F, static_cast<float>(i % 13) - 6.5F}}, 0, 0});
+  }
+  test_points[5].xyz[1] = std::numeric_limits<float>::quiet_NaN();
+  test_points[17].xyz[2] = -std::numeric_limits<float>::infinity();
+  test_points[42].xyz[0] = 1e9F;
+  const pb::AttributedPoints points{MakePoints(test_points)};
+
+  VoxelGrid expected;
+  expected.Assign(points, VoxelGridOptions{0.3F}, SimdLevel::kScalar);
+  EXPECT_GT(expected.size(), 100);
+  std::uint32_t total{0};
+  for (const std::uint32_t count : expected.point_counts()) {
+    total += count;
+  }
+  EXPECT_EQ(total, 998);
+
+  for (const SimdLevel level : SupportedSimdLevels()) {
+    SCOPED_TRACE(testing::Message() << "level " << static_cast<int>(level));
+    VoxelGrid grid;
+    grid.Assign(points, VoxelGridOptions{0.3F}, level);
+    ASSERT_EQ(grid.size(), expected.size());
+    for (std::size_t i{0}; i < grid.size(); ++i) {
+      EXPECT_EQ(grid.x()[i], expected.x()[i]) << i;
+      EXPECT_EQ(grid.y()[i], expected.y()[i]) << i;
+      EXPECT_EQ(grid.z()[i], expected.z()[i]) << i;
+      EXPECT_EQ(grid.point_counts()[i], expected.point_counts()[i]) << i;
+    }
+  }
+}
+
+TEST(VoxelGrid, AssignReusesBuffers) {
+  std::vector<TestPoint> many_points;
+  for (std::size_t i{0}; i < 1000; ++i) {
+    many_points.push_back({{{static_cast<float>(i % 100) * 0.1F, static_cast<float>(i % 7), 0.F}},
+                           static_cast<std::uint16_t>(i % 3),
+                           0});
+  }
+  const pb::AttributedPoints points{MakePoints(many_points)};
+  VoxelGrid grid;
+  grid.Assign(points, VoxelGridOptions{0.2F});
+  const std::size_t size{grid.size()};
+  const float* const x{grid.x().data()};
+  std::uint32_t total{0};
+  for (const std::uint32_t count : grid.point_counts()) {
+    total += count;
+  }
+  EXPECT_EQ(total, 1000);
+
+  grid.Clear();
+  EXPECT_TRUE(grid.empty());
+  grid.Assign(points, VoxelGridOptions{0.2F});
+  EXPECT_EQ(grid.size(), size);
+  EXPECT_EQ(grid.x().data(), x);
+}
+
+TEST(VoxelGridBatch, DownsamplesEachFrame) {
+  pb::AggregatedPointEvents events;
+  for (std::size_t frame{0}; frame < 5; ++frame) {
+    std::vector<TestPoint> frame_points;
+    for (std::size_t i{0}; i < 100 * frame; ++i) {
+      frame_points.push_back(
+          {{{static_cast<float>(i) * 0.25F, static_cast<float>(frame), 0.F}}, 0, 0});
+    }
+    pb::PointFrame point_frame;
+    point_frame.set_points(MakePoints(frame_points));
+    events.mutable_events().Vector().push_back(
+        pb::ProcessedPointsEvent{}.set_point_frame(std::move(point_frame)));
+  }
+  PbReader reader{PbBuffer{events.SerializeToBuffer()}};
+  const pb::AggregatedPointEvents received{reader};
+
+  for (const std::size_t thread_count : {1, 2, 3, 8}) {
+    SCOPED_TRACE(testing::Message() << thread_count << " threads");
+    VoxelGridBatch batch;
+    batch.Assign(received, VoxelGridOptions{1.F}, thread_count);
+    ASSERT_EQ(batch.grids().size(), 5);
+    for (std::size_t frame{0}; frame < 5; ++frame) {
+      EXPECT_EQ(batch.grids()[frame].size(), 25 * frame) << frame;
+      if (frame > 0) {
+        EXPECT_EQ(batch.grids()[frame].y()[0], static_cast<float>(frame)) << frame;
+      }
+    }
+  }
+
+  VoxelGridBatch batch;
+  batch.Assign(received, VoxelGridOptions{1.F});
+  EXPECT_THROW(batch.Assign(received, VoxelGridOptions{0.F}), std::invalid_argument);
+  EXPECT_TRUE(batch.grids().empty());
+  batch.Assign(received, VoxelGridOptions{1.F});
+  batch.Clear();
+  EXPECT_TRUE(batch.grids().empty());
+}
+
+TEST(VoxelGridBatch, DoesNotAllocateOnceWarm) {
+  std::vector<pb::PointFrame> frames;
+  for (std::size_t frame{0}; frame < 6; ++frame) {
+    std::vector<TestPoint> frame_points;
+    for (std::size_t i{0}; i < 100 + 10 * frame; ++i) {
+      frame_points.push_back({{{static_cast<float>(i) * 0.25F, 0.F, 0.F}}, 0, 0});
+    }
+    frames.emplace_back();
+    frames.back().set_points(MakePoints(frame_points));
+  }
+  std::vector<const pb::PointFrame*> frame_pointers;
+  for (const pb::PointFrame& frame : frames) {
+    frame_pointers.push_back(&frame);
+  }
+  for (const std::size_t thread_count : {1, 3}) {
+    SCOPED_TRACE(testing::Message() << thread_count << " threads");
+    VoxelGridBatch batch;
+    batch.Assign(frame_pointers, VoxelGridOptions{1.F}, thread_count);
+
+    const std::size_t allocation_count{ProcessAllocationCount()};
+    for (std::int32_t iteration{0}; iteration < 10; ++iteration) {
+      batch.Assign(frame_pointers, VoxelGridOptions{1.F}, thread_count);
+    }
+    EXPECT_EQ(ProcessAllocationCount(), allocation_count);
+    ASSERT_EQ(batch.grids().size(), 6);
+    EXPECT_EQ(batch.grids()[5].size(), 38);
+  }
+}
+
+}  // namespace
+}  // namespace sdk
+}  // namespace horus
@@ -6,8 +6,10 @@
 #define HORUS_SDK_ZONE_EVENTS_H_
 
 #include <functional>
+#include <memory>
 
 #include "horus/pb/detection_service/detection_pb.h"
+#include "horus/sdk/event_ring.h"
 
 namespace horus {
 namespace sdk {
@@ -17,6 +19,10 @@ namespace sdk {
 struct ZoneEventSubscriptionRequest {
   /// Function to call when a batch of zone events for a frame is received.
   std::function<void(pb::ZoneEventList&&)> on_zone_events;
+
+  /// If non-null, received zone events are pushed to this ring to be polled by the user instead of
+  /// being passed to `on_zone_events`.
+  std::shared_ptr<EventRing<pb::ZoneEventList>> event_ring{nullptr};
 };
 
 }  // namespace sdk
@@ -4,11 +4,16 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <mutex>
+#include <stdexcept>
+#include <string>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #include "horus/event_loop/event_loop.h"
 #include "horus/pb/cow_bytes.h"
@@ -17,18 +22,94 @@
 #include "horus/pb/notification_service/service_client.h"
 #include "horus/pb/notification_service/service_handler.h"
 #include "horus/pb/notification_service/service_pb.h"
+#include "horus/pb/point/point_message_pb.h"
+#include "horus/pb/point_aggregator/point_aggregator_service_client.h"
+#include "horus/pb/point_aggregator/point_aggregator_service_handler.h"
+#include "horus/pb/preprocessing/messages_pb.h"
+#include "horus/pb/profiling_pb.h"
+#include "horus/pb/project_manager/service_handler.h"
+#include "horus/pb/project_manager/service_pb.h"
 #include "horus/pb/rpc_pb.h"
+#include "horus/pb/status_service/messages_pb.h"
+#include "horus/pb/status_service/service_handler.h"
+#include "horus/pb/status_service/service_pb.h"
 #include "horus/rpc/endpoint.h"
 #include "horus/rpc/retry_policy.h"
 #include "horus/rpc/services.h"
+#include "horus/sdk/delivery.h"
+#include "horus/sdk/event_ring.h"
+#include "horus/sdk/health.h"
+#include "horus/sdk/logs.h"
+#include "horus/sdk/options.h"
+#include "horus/sdk/point_clouds.h"
+#include "horus/sdk/sensor.h"
+#include "horus/sdk/version.h"
+#include "horus/strings/string_view.h"
 #include "horus/testing/timing.h"
 #include "horus/testing/ws_server.h"
+#include "horus/types/one_of.h"
 
 namespace horus {
 namespace {
 
 constexpr std::chrono::milliseconds kWaitForNetwork{20};
 constexpr std::chrono::milliseconds kWaitForBackgroundThread{10};
+/// How long to wait for a condition which should hold shortly, e.g. for callbacks to run. Only
+/// elapses if a test fails.
+constexpr std::chrono::seconds kWaitForCondition{5};
+
+/// Waits until `predicate()` holds, for at most `kWaitForCondition`. Returns whether it holds.
+template <class Predicate>
+bool WaitUntil(const Predicate& predicate) {
+  const std::chrono::steady_clock::time_point deadline{std::chrono::steady_clock::now() +
+                                                       kWaitForCondition};
+  while (!predicate()) {
+    if (std::chrono::steady_clock::now() >= deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+  return true;
+}
+
+/// The endpoint of the last client which subscribed to a test service, through which the test
+/// sends events to the `Sdk`.
+class SubscriberEndpoint final {
+ public:
+  /// Records the endpoint of the client sending the request of `context`.
+  void Set(const RpcContext& context) {
+    const std::unique_lock<std::mutex> lock{mutex_};
+    endpoint_ = context.Endpoint();
+  }
+
+  /// Returns the endpoint of the last subscriber, or null if it disconnected.
+  std::shared_ptr<RpcEndpoint> Get() {
+    const std::unique_lock<std::mutex> lock{mutex_};
+    return endpoint_.lock();
+  }
+
+ private:
+  /// Mutex which guards `endpoint_`.
+  std::mutex mutex_;
+  /// @see Get()
+  std::weak_ptr<RpcEndpoint> endpoint_;
+};
+
+/// Returns a log message whose text is `text`.
+pb::LogMessage LogMessageWithText(StringView text) {
+  return pb::LogMessage{}.set_data(
+      pb::LogData{}.set_generic(pb::logs::Generic{}.set_message(CowBytes::OwnedCopy(text))));
+}
+
+/// Returns a `StatusService` which responds to `GetVersion()` with version `major`.0 and counts
+/// calls in `call_count`.
+auto CreateStatusService(std::uint32_t major, std::atomic<std::int32_t>& call_count) {
+  return pb::CreateFunctionalStatusService().GetVersionWith(
+      [major, &call_count](const pb::GetVersionRequest&) -> pb::GetVersionResponse {
+        ++call_count;
+        return pb::GetVersionResponse{}.set_version(pb::Version{}.set_major(major));
+      });
+}
 
 TEST(Sdk, SubscribeToLogs) {
   FLAKY_BLOCK() {
@@ -100,5 +181,343 @@ TEST(Sdk, SubscribeToLogs) {
   }
 }
 
+TEST(Sdk, SubscriptionsToTheSameServiceShareAConnection) {
+  FLAKY_BLOCK() {
+    std::mutex endpoint_mtx;
+    std::weak_ptr<RpcEndpoint> weak_endpoint{};
+    std::atomic<std::int32_t> subscribe_count{0};
+
+    auto notification_service =
+        pb::CreateFunctionalNotificationService().SubscribeWith(
+            [&endpoint_mtx, &weak_endpoint, &subscribe_count](
+                const RpcContext& context,
+                const pb::DefaultSubscribeRequest&) -> pb::DefaultSubscribeResponse {
+              const std::unique_lock<std::mutex> lock{endpoint_mtx};
+              weak_endpoint = context.Endpoint();
+              ++subscribe_count;
+              return {};
+            });
+    WebSocketServer server{HandleMessagesWith(notification_service)};
+    horus_internal::EventLoop event_loop;
+
+    const auto get_endpoint = [&endpoint_mtx, &weak_endpoint]() -> std::shared_ptr<RpcEndpoint> {
+      const std::unique_lock<std::mutex> lock{endpoint_mtx};
+      return weak_endpoint.lock();
+    };
+
+    RpcServices::ServiceResolutionMap service_map{};
+    service_map.notification = {"127.0.0.1", server.Port()};
+
+    Sdk sdk{service_map};
+    std::atomic<std::int32_t> log_count{0};
+    std::atomic<std::int32_t> profiling_count{0};
+    {
+      const SdkSubscription log_subscription{
+          sdk.SubscribeToLogs(
+                 {/*on_log_message=*/[&log_count](const pb::LogMessage&) { ++log_count; }})
+              .WaitFor(kWaitForNetwork)
+              .As<SdkSubscription>()};
+      const SdkSubscription profiling_subscription{
+          sdk.SubscribeToProfiling({/*on_profiling_info=*/[&profiling_count](
+                                        const pb::ProfilingInfo&) { ++profiling_count; }})
+              .WaitFor(kWaitForNetwork)
+              .As<SdkSubscription>()};
+
+      // The subscription happens in the background, so we need to sleep to await it.
+      std::this_thread::sleep_for(kWaitForBackgroundThread);
+      FLAKY_EXPECT_EQ(server.ClientCount(), 1);
+      FLAKY_EXPECT_EQ(subscribe_count, 1);
+      FLAKY_EXPECT_EQ(log_subscription.CurrentStatus(), SdkSubscription::Status::kSubscribed);
+      FLAKY_EXPECT_EQ(profiling_subscription.CurrentStatus(),
+                      SdkSubscription::Status::kSubscribed);
+
+      {
+        std::shared_ptr<RpcEndpoint> endpoint{get_endpoint()};
+        FLAKY_ASSERT_NE(endpoint, nullptr);
+
+        pb::NotificationListenerServiceClient client{std::move(endpoint)};
+        event_loop.RunFuture(client.NotifyLogMessage(
+            pb::LogMessageEvent{}.set_log_message(pb::LogMessage{}),
+            RetryIndefinitely(std::chrono::milliseconds{1})));
+        event_loop.RunFuture(client.NotifyProfilingInfo(
+            pb::ProfilingInfoEvent{}.set_profiling_info(pb::ProfilingInfo{}),
+            RetryIndefinitely(std::chrono::milliseconds{1})));
+      }
+      std::this_thread::sleep_for(kWaitForBackgroundThread);
+      FLAKY_EXPECT_EQ(log_count, 1);
+      FLAKY_EXPECT_EQ(profiling_count, 1);
+    }
+    // Let `Sdk` event-loop destroy the subscriptions in the background.
+    std::this_thread::sleep_for(kWaitForBackgroundThread);
+
+    FLAKY_EXPECT_EQ(get_endpoint(), nullptr);
+    FLAKY_EXPECT_EQ(server.ClientCount(), 0);
+  }
+}
+
+TEST(Sdk, RejectsEmptyDropOldestQueues) {
+  Sdk sdk{RpcServices::ServiceResolutionMap{}};
+
+  sdk::PointCloudSubscriptionRequest point_clouds;
+  point_clouds.on_point_cloud = [](pb::PointFrame&&) {};
+  point_clouds.delivery_policy = sdk::DeliveryPolicy::kDropOldest;
+  point_clouds.max_pending_point_clouds = 0;
+  EXPECT_THROW(static_cast<void>(sdk.SubscribeToPointClouds(std::move(point_clouds))),
+               std::invalid_argument);
+
+  sdk::OccupancyGridSubscriptionRequest occupancy_grids;
+  occupancy_grids.on_occupancy_grid = [](pb::OccupancyGridListEvent&&) {};
+  occupancy_grids.delivery_policy = sdk::DeliveryPolicy::kDropOldest;
+  occupancy_grids.max_pending_occupancy_grids = 0;
+  EXPECT_THROW(static_cast<void>(sdk.SubscribeToOccupancyGrid(std::move(occupancy_grids))),
+               std::invalid_argument);
+}
+
+TEST(Sdk, CallbackWorkersRunSubscriptionsInParallelAndInOrder) {
+  SubscriberEndpoint subscriber;
+  auto notification_service = pb::CreateFunctionalNotificationService().SubscribeWith(
+      [&subscriber](const RpcContext& context,
+                    const pb::DefaultSubscribeRequest&) -> pb::DefaultSubscribeResponse {
+        subscriber.Set(context);
+        return {};
+      });
+  WebSocketServer server{HandleMessagesWith(notification_service)};
+  horus_internal::EventLoop event_loop;
+
+  RpcServices::ServiceResolutionMap service_map{};
+  service_map.notification = {"127.0.0.1", server.Port()};
+  sdk::SdkOptions options;
+  options.callback_worker_count = 2;
+  Sdk sdk{service_map, options};
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<std::string> logs;
+  bool profiling_received{false};
+  bool ran_in_parallel{false};
+  const SdkSubscription log_subscription{
+      sdk.SubscribeToLogs({/*on_log_message=*/[&](const pb::LogMessage& message) {
+           std::unique_lock<std::mutex> lock{mutex};
+           if (logs.empty()) {
+             // Only returns early if the profiling callback runs while this one is running.
+             ran_in_parallel =
+                 cv.wait_for(lock, kWaitForCondition, [&]() { return profiling_received; });
+           }
+           logs.emplace_back(message.data().generic().message().Str());
+           cv.notify_all();
+         }})
+          .WaitFor(kWaitForNetwork)
+          .As<SdkSubscription>()};
+  const SdkSubscription profiling_subscription{
+      sdk.SubscribeToProfiling({/*on_profiling_info=*/[&](const pb::ProfilingInfo&) {
+           const std::unique_lock<std::mutex> lock{mutex};
+           profiling_received = true;
+           cv.notify_all();
+         }})
+          .WaitFor(kWaitForNetwork)
+          .As<SdkSubscription>()};
+  ASSERT_TRUE(WaitUntil([&]() {
+    return log_subscription.CurrentStatus() == SdkSubscription::Status::kSubscribed &&
+           profiling_subscription.CurrentStatus() == SdkSubscription::Status::kSubscribed;
+  }));
+
+  constexpr std::size_t kLogCount{20};
+  {
+    pb::NotificationListenerServiceClient client{subscriber.Get()};
+    for (std::size_t i{0}; i < kLogCount; ++i) {
+      event_loop.RunFuture(client.NotifyLogMessage(
+          pb::LogMessageEvent{}.set_log_message(LogMessageWithText(std::to_string(i))),
+          RetryIndefinitely(std::chrono::milliseconds{1})));
+    }
+    // The first log callback is still waiting for this event, which is delivered on another
+    // worker.
+    event_loop.RunFuture(client.NotifyProfilingInfo(
+        pb::ProfilingInfoEvent{}.set_profiling_info(pb::ProfilingInfo{}),
+        RetryIndefinitely(std::chrono::milliseconds{1})));
+  }
+
+  std::unique_lock<std::mutex> lock{mutex};
+  ASSERT_TRUE(cv.wait_for(lock, kWaitForCondition, [&]() { return logs.size() == kLogCount; }));
+  EXPECT_TRUE(ran_in_parallel);
+  for (std::size_t i{0}; i < kLogCount; ++i) {
+    EXPECT_EQ(logs[i], std::to_string(i));
+  }
+}
+
+
+TEST(Sdk, SubscriptionsDeliverToEventRings) {
+  SubscriberEndpoint subscriber;
+  auto notification_service = pb::CreateFunctionalNotificationService().SubscribeWith(
+      [&subscriber](const RpcContext& context,
+                    const pb::DefaultSubscribeRequest&) -> pb::DefaultSubscribeResponse {
+        subscriber.Set(context);
+        return {};
+      });
+  WebSocketServer server{HandleMessagesWith(notification_service)};
+  horus_internal::EventLoop event_loop;
+
+  RpcServices::ServiceResolutionMap service_map{};
+  service_map.notification = {"127.0.0.1", server.Port()};
+  Sdk sdk{service_map};
+
+  const std::shared_ptr<sdk::EventRing<pb::LogMessage>> ring{
+      std::make_shared<sdk::EventRing<pb::LogMessage>>(4)};
+  sdk::LogSubscriptionRequest request;
+  request.event_ring = ring;
+  const SdkSubscription subscription{
+      sdk.SubscribeToLogs(std::move(request)).WaitFor(kWaitForNetwork).As<SdkSubscription>()};
+  ASSERT_TRUE(WaitUntil(
+      [&]() { return subscription.CurrentStatus() == SdkSubscription::Status::kSubscribed; }));
+
+  // Nothing pops from the ring while logs are sent, so the logs which do not fit are dropped.
+  constexpr std::size_t kLogCount{6};
+  {
+    pb::NotificationListenerServiceClient client{subscriber.Get()};
+    for (std::size_t i{0}; i < kLogCount; ++i) {
+      event_loop.RunFuture(client.NotifyLogMessage(
+          pb::LogMessageEvent{}.set_log_message(LogMessageWithText(std::to_string(i))),
+          RetryIndefinitely(std::chrono::milliseconds{1})));
+    }
+  }
+  ASSERT_TRUE(WaitUntil(
+      [&]() { return subscription.DroppedEventCount() == kLogCount - ring->Capacity(); }));
+  EXPECT_EQ(ring->DroppedCount(), kLogCount - ring->Capacity());
+
+  for (std::size_t i{0}; i < ring->Capacity(); ++i) {
+    OneOf<pb::LogMessage, void> log{ring->TryPop()};
+    const pb::LogMessage* const maybe_log{log.TryAs<pb::LogMessage>()};
+    ASSERT_NE(maybe_log, nullptr);
+    EXPECT_EQ(maybe_log->data().generic().message().Str(), std::to_string(i));
+  }
+  EXPECT_TRUE(ring->TryPop().Is<void>());
+}
+
+TEST(Sdk, SlowConflatingSubscriptionsDoNotBlockOtherSubscriptions) {
+  // Without callback workers, the point cloud callback would hold on to the event loop; with a
+  // single one, it would hold on to the worker shared by both subscriptions.
+  for (const std::size_t callback_worker_count : {std::size_t{0}, std::size_t{1}}) {
+    SCOPED_TRACE(callback_worker_count);
+    SubscriberEndpoint subscriber;
+    auto point_aggregator_service = pb::CreateFunctionalPointAggregatorService().SubscribeWith(
+        [&subscriber](const RpcContext& context,
+                      const pb::DefaultSubscribeRequest&) -> pb::DefaultSubscribeResponse {
+          subscriber.Set(context);
+          return {};
+        });
+    WebSocketServer server{HandleMessagesWith(point_aggregator_service)};
+    horus_internal::EventLoop event_loop;
+
+    RpcServices::ServiceResolutionMap service_map{};
+    service_map.point_aggregator = {"127.0.0.1", server.Port()};
+    sdk::SdkOptions options;
+    options.callback_worker_count = callback_worker_count;
+    Sdk sdk{service_map, options};
+
+    sdk::PointCloudSubscriptionRequest point_clouds;
+    point_clouds.on_point_cloud = [](pb::PointFrame&&) {
+      std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    };
+    point_clouds.delivery_policy = sdk::DeliveryPolicy::kKeepLatest;
+    const SdkSubscription point_cloud_subscription{
+        sdk.SubscribeToPointClouds(std::move(point_clouds))
+            .WaitFor(kWaitForNetwork)
+            .As<SdkSubscription>()};
+    std::atomic<std::size_t> occupancy_grid_count{0};
+    const SdkSubscription occupancy_grid_subscription{
+        sdk.SubscribeToOccupancyGrid(
+               {/*on_occupancy_grid=*/[&occupancy_grid_count](pb::OccupancyGridListEvent&&) {
+                 ++occupancy_grid_count;
+               }})
+            .WaitFor(kWaitForNetwork)
+            .As<SdkSubscription>()};
+    ASSERT_TRUE(WaitUntil([&]() {
+      return point_cloud_subscription.CurrentStatus() == SdkSubscription::Status::kSubscribed &&
+             occupancy_grid_subscription.CurrentStatus() == SdkSubscription::Status::kSubscribed;
+    }));
+
+    // Point clouds are sent faster than they are consumed, so their queue never becomes empty while
+    // occupancy grids are sent; these must still be delivered in the meantime.
+    constexpr std::size_t kOccupancyGridCount{5};
+    pb::AggregatedPointEvents points;
+    points.mutable_events().Vector().push_back(
+        pb::ProcessedPointsEvent{}.set_point_frame(pb::PointFrame{}));
+    pb::PointAggregatorSubscriberServiceClient client{subscriber.Get()};
+    const std::chrono::steady_clock::time_point deadline{std::chrono::steady_clock::now() +
+                                                         kWaitForCondition};
+    while (occupancy_grid_count < kOccupancyGridCount &&
+           std::chrono::steady_clock::now() < deadline) {
+      for (int i{0}; i < 4; ++i) {
+        event_loop.RunFuture(client.BroadcastProcessedPoints(
+            points, RetryIndefinitely(std::chrono::milliseconds{1})));
+      }
+      event_loop.RunFuture(client.BroadcastOccupancyGridList(
+          pb::OccupancyGridListEvent{}, RetryIndefinitely(std::chrono::milliseconds{1})));
+    }
+    EXPECT_LT(std::chrono::steady_clock::now(), deadline);
+    EXPECT_GE(occupancy_grid_count, kOccupancyGridCount);
+    EXPECT_GT(point_cloud_subscription.DroppedEventCount(), 0);
+  }
+}
+
+TEST(Sdk, UnaryCallsToTheSameAddressShareAConnection) {
+  std::atomic<std::int32_t> health_status_count{0};
+  auto project_manager_service = pb::CreateFunctionalProjectManagerService().GetHealthStatusWith(
+      [&health_status_count](const pb::GetHealthStatusRequest&) -> pb::GetHealthStatusResponse {
+        ++health_status_count;
+        return pb::GetHealthStatusResponse{}.set_license_status(
+            pb::LicenseStatus{}.set_license_level(
+                pb::LicenseLevel{}.set_level_4(pb::LicenseLevel_Level4{})));
+      });
+  std::atomic<std::int32_t> version_count{0};
+  auto status_service = CreateStatusService(1, version_count);
+  WebSocketServer server{HandleMessagesWith({&project_manager_service, &status_service})};
+
+  RpcServices::ServiceResolutionMap service_map{};
+  service_map.project_manager = {"127.0.0.1", server.Port()};
+  Sdk sdk{service_map};
+
+  // Both calls are requested before either of them completes.
+  SdkFuture<sdk::HealthStatus> health_status{sdk.GetHealthStatus({})};
+  SdkFuture<sdk::Version> version{sdk.GetVersion({})};
+  const OneOf<sdk::HealthStatus, void> maybe_health_status{
+      health_status.WaitFor(kWaitForCondition)};
+  ASSERT_TRUE(maybe_health_status.Is<sdk::HealthStatus>());
+  EXPECT_EQ(maybe_health_status.As<sdk::HealthStatus>().GetLicenseStatus().LicenseLevel(), 4);
+  const OneOf<sdk::Version, void> maybe_version{version.WaitFor(kWaitForCondition)};
+  ASSERT_TRUE(maybe_version.Is<sdk::Version>());
+  EXPECT_EQ(maybe_version.As<sdk::Version>().Major(), 1);
+
+  EXPECT_EQ(health_status_count, 1);
+  EXPECT_EQ(version_count, 1);
+  EXPECT_EQ(server.ClientCount(), 1);
+}
+
+TEST(Sdk, UnaryCallsReconnectAfterTheServerRestarts) {
+  std::atomic<std::int32_t> version_count{0};
+  auto status_service = CreateStatusService(1, version_count);
+  std::unique_ptr<WebSocketServer> server{
+      std::make_unique<WebSocketServer>(HandleMessagesWith(status_service))};
+  const std::uint16_t port{server->Port()};
+
+  RpcServices::ServiceResolutionMap service_map{};
+  service_map.project_manager = {"127.0.0.1", port};
+  Sdk sdk{service_map};
+  ASSERT_TRUE(sdk.GetVersion({}).WaitFor(kWaitForCondition).Is<sdk::Version>());
+
+  // Drop the connection of the first call, then restart the server at the same address.
+  server.reset();
+  std::this_thread::sleep_for(kWaitForBackgroundThread);
+  std::atomic<std::int32_t> restarted_version_count{0};
+  auto restarted_status_service = CreateStatusService(2, restarted_version_count);
+  server = std::make_unique<WebSocketServer>(port, HandleMessagesWith(restarted_status_service));
+
+  const OneOf<sdk::Version, void> version{sdk.GetVersion({}).WaitFor(kWaitForCondition)};
+  ASSERT_TRUE(version.Is<sdk::Version>());
+  EXPECT_EQ(version.As<sdk::Version>().Major(), 2);
+  EXPECT_EQ(version_count, 1);
+  EXPECT_EQ(restarted_version_count, 1);
+  EXPECT_TRUE(WaitUntil([&server]() { return server->ClientCount() == 1; }));
+}
+
 }  // namespace
 }  // namespace horus
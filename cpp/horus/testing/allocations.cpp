@@ -0,0 +1,76 @@
+#include "horus/testing/allocations.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace horus {
+namespace {
+
+/// @see ThreadAllocationCount()
+thread_local std::size_t thread_allocation_count{0};
+
+/// @see ProcessAllocationCount()
+std::atomic<std::size_t> process_allocation_count{0};
+
+/// Allocates `size` bytes and counts the allocation, returning null if it failed.
+void* CountedAllocate(std::size_t size) noexcept {
+  ++thread_allocation_count;
+  static_cast<void>(process_allocation_count.fetch_add(1, std::memory_order_relaxed));
+  // NOLINTNEXTLINE(*-no-malloc, *-owning-memory)
+  return std::malloc(size == 0 ? 1 : size);
+}
+
+/// Allocates `size` bytes and counts the allocation.
+///
+/// @throws std::bad_alloc If the allocation failed.
+void* CountedAllocateOrThrow(std::size_t size) noexcept(false) {
+  void* const ptr{CountedAllocate(size)};
+  if (ptr == nullptr) {
+    throw std::bad_alloc{};
+  }
+  return ptr;
+}
+
+}  // namespace
+
+std::size_t ThreadAllocationCount() noexcept { return thread_allocation_count; }
+
+std::size_t ProcessAllocationCount() noexcept {
+  return process_allocation_count.load(std::memory_order_relaxed);
+}
+
+}  // namespace horus
+
+// NOLINTBEGIN(*-no-malloc, *-owning-memory, misc-new-delete-overloads)
+
+void* operator new(std::size_t size) noexcept(false) {
+  return horus::CountedAllocateOrThrow(size);
+}
+
+void* operator new[](std::size_t size) noexcept(false) {
+  return horus::CountedAllocateOrThrow(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t& /* tag */) noexcept {
+  return horus::CountedAllocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& /* tag */) noexcept {
+  return horus::CountedAllocate(size);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t /* size */) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr, std::size_t /* size */) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, const std::nothrow_t& /* tag */) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr, const std::nothrow_t& /* tag */) noexcept { std::free(ptr); }
+
+// NOLINTEND(*-no-malloc, *-owning-memory, misc-new-delete-overloads)
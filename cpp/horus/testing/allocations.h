@@ -0,0 +1,57 @@
+/// @file
+///
+/// Testing helpers for counting heap allocations.
+
+#ifndef HORUS_TESTING_ALLOCATIONS_H_
+#define HORUS_TESTING_ALLOCATIONS_H_
+
+#include <cstddef>
+
+namespace horus {
+
+/// Returns the number of heap allocations made by the current thread since it started.
+///
+/// Allocations are counted by the replacements of the global `operator new` defined along with this
+/// function, which are linked into the test binary.
+std::size_t ThreadAllocationCount() noexcept;
+
+/// Returns the number of heap allocations made by all threads since the program started, e.g. to
+/// check that code running on worker threads does not allocate.
+std::size_t ProcessAllocationCount() noexcept;
+
+/// Counts the heap allocations made by the current thread while the counter is alive.
+///
+/// Example:
+///
+///  const AllocationCounter counter;
+///  ProcessFrame();
+///  EXPECT_EQ(counter.Count(), 0);
+class AllocationCounter final {
+ public:
+  /// Starts counting allocations.
+  AllocationCounter() noexcept : start_{ThreadAllocationCount()} {}
+
+  /// Cannot copy.
+  AllocationCounter(const AllocationCounter&) = delete;
+  /// Cannot copy.
+  AllocationCounter& operator=(const AllocationCounter&) = delete;
+  /// Cannot move.
+  AllocationCounter(AllocationCounter&&) = delete;
+  /// Cannot move.
+  AllocationCounter& operator=(AllocationCounter&&) = delete;
+
+  /// Destructor.
+  ~AllocationCounter() noexcept = default;
+
+  /// Returns the number of allocations made by the current thread since the counter was
+  /// constructed.
+  std::size_t Count() const noexcept { return ThreadAllocationCount() - start_; }
+
+ private:
+  /// The value of `ThreadAllocationCount()` when the counter was constructed.
+  std::size_t start_;
+};
+
+}  // namespace horus
+
+#endif  // HORUS_TESTING_ALLOCATIONS_H_
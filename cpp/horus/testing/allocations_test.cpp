@@ -0,0 +1,40 @@
+#include "horus/testing/allocations.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace horus {
+namespace {
+
+TEST(AllocationCounter, CountsAllocationsOfCurrentThread) {
+  const AllocationCounter counter;
+  EXPECT_EQ(counter.Count(), 0);
+
+  const std::unique_ptr<int> allocated{std::make_unique<int>(1)};
+  EXPECT_EQ(counter.Count(), 1);
+
+  std::size_t other_thread_count{0};
+  std::thread thread{[&other_thread_count]() {
+    const AllocationCounter other_counter;
+    const std::vector<int> values(10);
+    other_thread_count = other_counter.Count();
+  }};
+  thread.join();
+  EXPECT_EQ(other_thread_count, 1);
+}
+
+TEST(AllocationCounter, CountsAllocationsOfAllThreads) {
+  std::thread thread;
+  const std::size_t start{ProcessAllocationCount()};
+  thread = std::thread{[]() { const std::vector<int> values(10); }};
+  thread.join();
+  // The state of the thread and the vector.
+  EXPECT_EQ(ProcessAllocationCount() - start, 2);
+}
+
+}  // namespace
+}  // namespace horus
@@ -0,0 +1,73 @@
+#include "horus/testing/point_clouds.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "horus/pb/point/point_message_pb.h"
+#include "horus/sdk/simd.h"
+
+namespace horus {
+namespace {
+
+/// Appends `value` to `values`, which pack two 16-bit values per element, the first one in the low
+/// half.
+void PushPacked(std::vector<std::uint32_t>& values, std::size_t index, std::uint16_t value) {
+  if (index % 2 == 0) {
+    values.push_back(value);
+  } else {
+    values.back() |= static_cast<std::uint32_t>(value) << 16;
+  }
+}
+
+}  // namespace
+
+std::vector<sdk::SimdLevel> SupportedSimdLevels() {
+  std::vector<sdk::SimdLevel> levels;
+  for (const sdk::SimdLevel level :
+       {sdk::SimdLevel::kScalar, sdk::SimdLevel::kSse41, sdk::SimdLevel::kAvx2}) {
+    if (sdk::IsSimdLevelSupported(level)) {
+      levels.push_back(level);
+    }
+  }
+  return levels;
+}
+
+pb::PointFrame MakePointFrame(std::size_t size,
+                              const std::function<TestPoint(std::size_t)>& point_at,
+                              unsigned fields) noexcept(false) {
+  pb::PointFrame frame;
+  pb::AttributedPoints& points{frame.mutable_points()};
+  std::vector<float>& xyz{points.mutable_flattened_points().Vector()};
+  for (std::size_t i{0}; i < size; ++i) {
+    const TestPoint point{point_at(i)};
+    xyz.insert(xyz.end(), {point.x, point.y, point.z});
+    if ((fields & kTestPointRingIndices) != 0) {
+      std::vector<std::uint8_t>& ring_indices{points.mutable_ring_indices().String()};
+      ring_indices.push_back(static_cast<std::uint8_t>(point.ring & 0xFF));
+      ring_indices.push_back(static_cast<std::uint8_t>(point.ring >> 8));
+    }
+    if ((fields & kTestPointAttributes) != 0) {
+      PushPacked(points.mutable_attributes().Vector(), i, point.attributes);
+    }
+    if ((fields & kTestPointIntensities) != 0) {
+      PushPacked(points.mutable_intensities().Vector(), i, point.intensity);
+    }
+    if ((fields & kTestPointTimestamps) != 0) {
+      points.mutable_timestamps().Vector().push_back(
+          pb::Timestamp{}
+              .set_seconds(point.timestamp_ns / 1000000000)
+              .set_nanos(static_cast<std::int32_t>(point.timestamp_ns % 1000000000)));
+    }
+  }
+  return frame;
+}
+
+pb::PointFrame MakePointFrame(const std::vector<TestPoint>& points,
+                              unsigned fields) noexcept(false) {
+  return MakePointFrame(
+      points.size(), [&points](std::size_t i) { return points[i]; }, fields);
+}
+
+}  // namespace horus
@@ -0,0 +1,67 @@
+/// @file
+///
+/// Testing helpers for building point frames and running point cloud kernels with each SIMD
+/// instruction set.
+
+#ifndef HORUS_TESTING_POINT_CLOUDS_H_
+#define HORUS_TESTING_POINT_CLOUDS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "horus/pb/point/point_message_pb.h"
+#include "horus/sdk/simd.h"
+
+namespace horus {
+
+/// Returns the instruction sets supported by this CPU, from `SimdLevel::kScalar` up.
+std::vector<sdk::SimdLevel> SupportedSimdLevels();
+
+/// A point of a frame returned by `MakePointFrame()`.
+struct TestPoint final {
+  /// The x coordinate.
+  float x{0.F};
+  /// The y coordinate.
+  float y{0.F};
+  /// The z coordinate.
+  float z{0.F};
+  /// The ring index.
+  std::uint16_t ring{0};
+  /// The attributes.
+  std::uint16_t attributes{0};
+  /// The intensity.
+  std::uint16_t intensity{0};
+  /// The timestamp in nanoseconds since the epoch.
+  std::int64_t timestamp_ns{0};
+};
+
+/// The optional fields of the points of a frame returned by `MakePointFrame()`, combined with `|`.
+enum TestPointFields : unsigned {
+  /// Only the coordinates of the points are set.
+  kTestPointCoordinates = 0,
+  /// The ring indices of the points are set.
+  kTestPointRingIndices = 1U << 0,
+  /// The attributes of the points are set.
+  kTestPointAttributes = 1U << 1,
+  /// The intensities of the points are set.
+  kTestPointIntensities = 1U << 2,
+  /// The timestamps of the points are set.
+  kTestPointTimestamps = 1U << 3,
+};
+
+/// Returns a frame with `size` points, where point `i` is `point_at(i)`; `point_at` is called
+/// for `i` from 0 to `size - 1` in order. Only the coordinates and the given `fields` are set.
+pb::PointFrame MakePointFrame(std::size_t size,
+                              const std::function<TestPoint(std::size_t)>& point_at,
+                              unsigned fields) noexcept(false);
+
+/// Returns a frame with the given points, of which only the coordinates and the given `fields`
+/// are set.
+pb::PointFrame MakePointFrame(const std::vector<TestPoint>& points,
+                              unsigned fields) noexcept(false);
+
+}  // namespace horus
+
+#endif  // HORUS_TESTING_POINT_CLOUDS_H_
@@ -10,9 +10,12 @@
 #include <uv.h>
 
 #include <cstdint>
+#include <initializer_list>
 #include <memory>
 #include <stdexcept>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "horus/event_loop/uv.h"
 #include "horus/pb/buffer.h"
@@ -74,17 +77,7 @@ WebSocketServer::WebSocketServer(MessageHandler&& handler) : message_handler_{st
     // If we're unlucky, though, the port will be taken by the time the server starts, so we do this
     // in a loop until we succeed.
     port_ = FindFreePort();
-    server_ = std::make_unique<ix::WebSocketServer>(port_, "127.0.0.1");
-    server_->setOnConnectionCallback(
-        [this](const std::weak_ptr<ix::WebSocket>& websocket,
-               const std::shared_ptr<ix::ConnectionState> /* connection_state */) {
-          websocket.lock()->setOnMessageCallback(
-              [this, endpoint{std::make_shared<BasicWebSocketEndpoint>(websocket)}](
-                  const std::unique_ptr<ix::WebSocketMessage>& message) {
-                message_handler_(endpoint, *message);
-              });
-        });
-    const auto result = server_->listen();
+    const auto result = Listen();
     if (result.first) {
       break;  // Success!
     }
@@ -97,9 +90,39 @@ WebSocketServer::WebSocketServer(MessageHandler&& handler) : message_handler_{st
   server_->start();
 }
 
+WebSocketServer::WebSocketServer(std::uint16_t port, MessageHandler&& handler)
+    : port_{port}, message_handler_{std::move(handler)} {
+  const auto result = Listen();
+  if (!result.first) {
+    throw std::runtime_error{
+        StrCat("could not listen on port ", port_, " for test WS server: ", result.second)};
+  }
+  server_->start();
+}
+
+std::pair<bool, std::string> WebSocketServer::Listen() {
+  server_ = std::make_unique<ix::WebSocketServer>(port_, "127.0.0.1");
+  server_->setOnConnectionCallback(
+      [this](const std::weak_ptr<ix::WebSocket>& websocket,
+             const std::shared_ptr<ix::ConnectionState> /* connection_state */) {
+        websocket.lock()->setOnMessageCallback(
+            [this, endpoint{std::make_shared<BasicWebSocketEndpoint>(websocket)}](
+                const std::unique_ptr<ix::WebSocketMessage>& message) {
+              message_handler_(endpoint, *message);
+            });
+      });
+  return server_->listen();
+}
+
 WebSocketServer::MessageHandler HandleMessagesWith(horus_internal::RpcBaseHandler& handler) {
-  return [&handler](const std::shared_ptr<BasicWebSocketEndpoint>& endpoint,
-                    const ix::WebSocketMessage& ws_message) {
+  return HandleMessagesWith({&handler});
+}
+
+WebSocketServer::MessageHandler HandleMessagesWith(
+    std::initializer_list<horus_internal::RpcBaseHandler*> handlers) {
+  return [handlers1{std::vector<horus_internal::RpcBaseHandler*>{handlers}}](
+             const std::shared_ptr<BasicWebSocketEndpoint>& endpoint,
+             const ix::WebSocketMessage& ws_message) {
     if (ws_message.type != ix::WebSocketMessageType::Message) {
       return;
     }
@@ -107,11 +130,19 @@ WebSocketServer::MessageHandler HandleMessagesWith(horus_internal::RpcBaseHandle
     pb::RpcMessage rpc_message{reader};
     const bool is_two_way{rpc_message.request_id() != kOneWayRpcRequestId};
 
-    const RpcContext context{endpoint};
-    pb::RpcMessage result_message{TestOnlyExecute(handler.Handle(context, std::move(rpc_message)))};
-    if (is_two_way) {
-      endpoint->Send(std::move(result_message), RetryServerClientDefault());
+    for (horus_internal::RpcBaseHandler* const handler : handlers1) {
+      if (handler->ServiceId() != rpc_message.service_id()) {
+        continue;
+      }
+      const RpcContext context{endpoint};
+      pb::RpcMessage result_message{
+          TestOnlyExecute(handler->Handle(context, std::move(rpc_message)))};
+      if (is_two_way) {
+        endpoint->Send(std::move(result_message), RetryServerClientDefault());
+      }
+      return;
     }
+    ADD_FAILURE() << "no handler for service " << rpc_message.service_id();
   };
 }
 
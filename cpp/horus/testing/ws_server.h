@@ -13,6 +13,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <initializer_list>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -76,6 +77,12 @@ class WebSocketServer final {
 
   explicit WebSocketServer(MessageHandler&& handler);
 
+  /// Constructs a server listening on `port`, e.g. that of a server destroyed since, which lets
+  /// tests restart a server at the same address.
+  ///
+  /// @throws std::runtime_error If the server cannot listen on `port`.
+  WebSocketServer(std::uint16_t port, MessageHandler&& handler);
+
   /// Returns the port on which the server listens.
   constexpr std::uint16_t Port() const noexcept { return port_; }
 
@@ -83,6 +90,10 @@ class WebSocketServer final {
   std::size_t ClientCount() noexcept { return server_->getClients().size(); }
 
  private:
+  /// Creates `server_` and makes it listen on `port_`. Returns whether it succeeded and, if not,
+  /// why.
+  std::pair<bool, std::string> Listen();
+
   /// @see Port()
   std::uint16_t port_{0};
   /// WebSocket server.
@@ -95,6 +106,11 @@ class WebSocketServer final {
 WebSocketServer::MessageHandler HandleMessagesWith(
     horus_internal::RpcBaseHandler& handler HORUS_LIFETIME_BOUND);
 
+/// Returns a `MessageHandler` which handles each incoming message using the RPC handler of its
+/// service among `handlers`, so that a single server can implement several services.
+WebSocketServer::MessageHandler HandleMessagesWith(
+    std::initializer_list<horus_internal::RpcBaseHandler*> handlers);
+
 }  // namespace horus
 
 #endif  // HORUS_TESTING_WS_SERVER_H_